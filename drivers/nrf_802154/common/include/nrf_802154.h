@@ -73,13 +73,28 @@ extern "C" {
  */
 #define NRF_802154_RESERVED_IMM_RX_WINDOW_ID   (UINT32_MAX - 1)
 
+/**
+ * @brief Number of reception window identifiers reserved for periodic reception schedules.
+ */
+#define NRF_802154_RESERVED_PERIODIC_RX_ID_NUM 16
+
+/**
+ * @brief Reception window identifier used by the periodic reception schedule @p schedule.
+ *
+ * Frames received in the windows of a schedule and reception errors detected in them
+ * are reported with this identifier.
+ */
+#define NRF_802154_RESERVED_PERIODIC_RX_ID(schedule) \
+    ((uint32_t)(UINT32_MAX - 4 - (uint32_t)(schedule)))
+
 /**
  * @brief Upper bound for delayed reception window identifiers used by the application.
  *
  * All integers ranging from 0 to @ref NRF_802154_RESERVED_DRX_ID_UPPER_BOUND (inclusive)
  * can be used by the application as identifiers of delayed reception windows.
  */
-#define NRF_802154_RESERVED_DRX_ID_UPPER_BOUND (UINT32_MAX - 4)
+#define NRF_802154_RESERVED_DRX_ID_UPPER_BOUND \
+    (UINT32_MAX - 4 - NRF_802154_RESERVED_PERIODIC_RX_ID_NUM)
 
 /**
  * @brief Maximum number of simultaneously pending notifications the driver can issue.
@@ -89,8 +104,9 @@ extern "C" {
  * that can result from successfully received frames, disregardable notifications, all supported
  * delayed operations and the latest requested immediate operation.
  */
-#define NRF_802154_MAX_PENDING_NOTIFICATIONS \
-    (NRF_802154_RX_BUFFERS + NRF_802154_MAX_DISREGARDABLE_NOTIFICATIONS + 4 + 1)
+#define NRF_802154_MAX_PENDING_NOTIFICATIONS                              \
+    (NRF_802154_RX_BUFFERS + NRF_802154_MAX_DISREGARDABLE_NOTIFICATIONS + \
+     NRF_802154_DELAYED_TIMESLOTS + 1)
 
 /**
  * @brief Initializes the 802.15.4 driver.
@@ -167,7 +183,9 @@ nrf_802154_sl_ant_div_mode_t nrf_802154_antenna_diversity_rx_mode_get(void);
  * @brief Sets the antenna diversity tx mode.
  *
  * @note This function should not be called while reception or transmission are currently ongoing.
- * @note NRF_802154_SL_ANT_DIV_MODE_AUTO is not supported for transmission.
+ * @note NRF_802154_SL_ANT_DIV_MODE_AUTO is supported for transmission only if
+ *       @ref NRF_802154_ANT_DIV_PEER_ANTENNA_ENABLED is set. The frame is then transmitted
+ *       with the antenna that received frames from its destination with a stronger signal.
  *
  * @param[in] mode Antenna diversity tx mode to be set.
  *
@@ -348,6 +366,97 @@ void nrf_802154_extended_address_set(const uint8_t * p_extended_address);
  */
 void nrf_802154_short_address_set(const uint8_t * p_short_address);
 
+#if ((NRF_802154_IDENTITIES_NUM > 1) && !NRF_802154_SERIALIZATION_HOST) || defined(DOXYGEN)
+
+/**
+ * @brief Configures an additional identity of the device.
+ *
+ * The device receives and acknowledges the frames addressed to the PAN ID, the short address or
+ * the extended address of the identity, in addition to the ones set by @ref nrf_802154_pan_id_set,
+ * @ref nrf_802154_short_address_set and @ref nrf_802154_extended_address_set, which form identity 0.
+ * The Acks sent as the identity carry its PAN ID, are secured with its extended address and have
+ * the pending bit set according to its source address matching method. The frames transmitted
+ * with a source address of the identity are secured with its extended address.
+ *
+ * This function makes a copy of the identity.
+ *
+ * @note The lists of addresses for which the pending bit is set and of Ack IEs are shared
+ *       between all identities.
+ *
+ * @param[in]  index       Index of the identity, from 1 to @ref NRF_802154_IDENTITIES_NUM - 1.
+ * @param[in]  p_identity  Pointer to the identity.
+ *
+ * @retval  true   The identity has been configured.
+ * @retval  false  The index is out of range.
+ */
+bool nrf_802154_identity_set(uint8_t index, const nrf_802154_identity_t * p_identity);
+
+/**
+ * @brief Removes an additional identity of the device.
+ *
+ * @param[in]  index  Index of the identity, from 1 to @ref NRF_802154_IDENTITIES_NUM - 1.
+ *
+ * @retval  true   The identity has been removed.
+ * @retval  false  The index is out of range.
+ */
+bool nrf_802154_identity_clear(uint8_t index);
+
+#endif // ((NRF_802154_IDENTITIES_NUM > 1) && !NRF_802154_SERIALIZATION_HOST) || defined(DOXYGEN)
+
+/**
+ * @}
+ * @defgroup nrf_802154_filter_rules Receive filter rules
+ * @{
+ */
+
+#if (NRF_802154_FILTER_RULES_ENABLED && !NRF_802154_SERIALIZATION_HOST) || defined(DOXYGEN)
+
+/**
+ * @brief Sets a receive filter rule.
+ *
+ * The received frames that pass the address filtering, or all received frames in promiscuous
+ * mode, are checked against the rules in the order of their indexes. The first rule the frame
+ * matches with the @ref NRF_802154_FILTER_RULE_ACTION_ACCEPT or
+ * @ref NRF_802154_FILTER_RULE_ACTION_DROP action decides if the frame is received. A dropped frame
+ * is neither acknowledged nor notified. The rules with the @ref NRF_802154_FILTER_RULE_ACTION_COUNT
+ * action only count the frames that match them. The frames that match no deciding rule are
+ * received.
+ *
+ * The rules are evaluated while the frame is being received. A frame is dropped as soon as
+ * the fields deciding on it are received.
+ *
+ * Setting a rule clears its hit counter.
+ *
+ * @param[in]  index   Index of the rule, lower than @ref NRF_802154_FILTER_RULES_NUM.
+ * @param[in]  p_rule  Pointer to the rule.
+ *
+ * @retval  true   The rule has been set.
+ * @retval  false  The index is out of range, the action is invalid or the source address prefix
+ *                 is longer than the source address.
+ */
+bool nrf_802154_filter_rule_set(uint8_t index, const nrf_802154_filter_rule_t * p_rule);
+
+/**
+ * @brief Removes a receive filter rule.
+ *
+ * @param[in]  index  Index of the rule, lower than @ref NRF_802154_FILTER_RULES_NUM.
+ *
+ * @retval  true   The rule has been removed.
+ * @retval  false  The index is out of range.
+ */
+bool nrf_802154_filter_rule_clear(uint8_t index);
+
+/**
+ * @brief Gets the number of received frames that matched a receive filter rule.
+ *
+ * @param[in]  index  Index of the rule, lower than @ref NRF_802154_FILTER_RULES_NUM.
+ *
+ * @returns  Number of frames that matched the rule since it was set.
+ */
+uint32_t nrf_802154_filter_rule_hits_get(uint8_t index);
+
+#endif // (NRF_802154_FILTER_RULES_ENABLED && !NRF_802154_SERIALIZATION_HOST) || defined(DOXYGEN)
+
 #if !NRF_802154_SERIALIZATION_HOST || defined(DOXYGEN)
 /**
  * @}
@@ -453,6 +562,64 @@ bool nrf_802154_receive_at(uint64_t rx_time,
  */
 bool nrf_802154_receive_at_cancel(uint32_t id);
 
+/**
+ * @brief Starts periodic reception.
+ *
+ * The driver opens a reception window of length @c p_params->window every @c p_params->period
+ * microseconds, starting at @c p_params->rx_time. The windows are scheduled one at a time by
+ * the driver itself, in the same way as by @ref nrf_802154_receive_at, so the higher layer is
+ * not involved between the windows. If more than one channel is given, consecutive windows
+ * cycle through the channels in the given order.
+ *
+ * Frames received in the windows are reported by @ref nrf_802154_received. The end of a window
+ * and a denied or aborted window are not reported by @ref nrf_802154_receive_failed. They are
+ * counted in the schedule statistics instead, see @ref nrf_802154_receive_periodic_stats_get.
+ * A window that cannot be requested early enough, for example because the preceding window was
+ * extended by a frame being received, is skipped and counted as late.
+ *
+ * Each schedule occupies a single delayed reception window at a time. The windows use
+ * the identifier @ref NRF_802154_RESERVED_PERIODIC_RX_ID of the schedule.
+ *
+ * @param[in]  schedule  Index of the schedule, lower than @ref NRF_802154_PERIODIC_RX_SCHEDULES.
+ * @param[in]  p_params  Pointer to the parameters of the schedule. The gap between the end of
+ *                       a window and the start of the next one must be long enough to request
+ *                       the next window, which is the reception setup time plus
+ *                       @ref NRF_802154_PERIODIC_RX_ARM_MARGIN_US. At least one channel must
+ *                       be given.
+ *
+ * @retval  true   The periodic reception was started.
+ * @retval  false  The parameters are invalid or the schedule is already running.
+ */
+bool nrf_802154_receive_periodic_start(uint8_t                                 schedule,
+                                       const nrf_802154_periodic_rx_params_t * p_params);
+
+/**
+ * @brief Stops periodic reception started by @ref nrf_802154_receive_periodic_start.
+ *
+ * A pending window of the schedule is cancelled. If the window has already started, the radio
+ * remains in the receive state until the window ends.
+ *
+ * @param[in]  schedule  Index of the schedule.
+ *
+ * @retval  true   The periodic reception was running and has been stopped.
+ * @retval  false  The schedule was not running.
+ */
+bool nrf_802154_receive_periodic_stop(uint8_t schedule);
+
+/**
+ * @brief Gets the statistics of a periodic reception schedule.
+ *
+ * The statistics are reset when the schedule is started and are kept after it is stopped.
+ *
+ * @param[in]   schedule  Index of the schedule.
+ * @param[out]  p_stats   Pointer to the structure to be filled with the statistics.
+ *
+ * @retval  true   @p p_stats has been filled.
+ * @retval  false  The schedule index is invalid.
+ */
+bool nrf_802154_receive_periodic_stats_get(uint8_t                          schedule,
+                                           nrf_802154_periodic_rx_stats_t * p_stats);
+
 #if NRF_802154_USE_RAW_API || defined(DOXYGEN)
 
 /**
@@ -670,6 +837,43 @@ bool nrf_802154_transmit_at_cancel(void);
  */
 bool nrf_802154_energy_detection(uint32_t time_us);
 
+#if NRF_802154_ED_SWEEP_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Changes the radio state to energy detection to measure the energy on a set of channels.
+ *
+ * The channels selected by @c channel_mask in @p p_params are measured in turns, each one for
+ * @c dwell_us, and the whole set is measured @c iterations times, in a new random order every
+ * time. The energy measured on a channel is split into samples of
+ * @ref NRF_802154_ED_SWEEP_SAMPLE_TIME_US, and the highest, mean and
+ * @ref NRF_802154_ED_SWEEP_PERCENTILE percentile sample of every channel, together with
+ * the histogram of its samples, is reported to the higher layer by a single call to
+ * @ref nrf_802154_energy_detected. Its @c ed_dbm field holds the highest sample of all
+ * the channels, and its @c p_sweep field points to the statistics of the channels.
+ *
+ * After the sweep, the radio is tuned back to the channel set by @ref nrf_802154_channel_set.
+ *
+ * @note @ref nrf_802154_energy_detected can be called before this function returns a result.
+ * @note As with @ref nrf_802154_energy_detection, the procedure can take longer than requested,
+ *       because it is performed only during the timeslots granted by a radio arbiter.
+ * @note When the driver is serialized, the single call to @ref nrf_802154_energy_detected is
+ *       carried by one message per measured channel followed by one message that ends the sweep,
+ *       that is 17 messages for all the 16 channels.
+ *
+ * @param[in]  p_params  Pointer to the parameters of the sweep. @c channel_mask must select at
+ *                       least one channel of @ref NRF_802154_ED_SWEEP_CHANNEL_MASK and no other
+ *                       bits, @c iterations must not be 0, and the number of samples of a single
+ *                       channel must not exceed @c UINT16_MAX. @c dwell_us is rounded up to
+ *                       multiplication of 8 symbols (128 us).
+ *
+ * @retval  true   The energy detection sweep was scheduled.
+ * @retval  false  The parameters are invalid or the driver could not schedule the energy
+ *                 detection sweep.
+ */
+bool nrf_802154_energy_detection_sweep(const nrf_802154_ed_sweep_params_t * p_params);
+
+#endif // NRF_802154_ED_SWEEP_ENABLED || defined(DOXYGEN)
+
 /**
  * @brief Changes the radio state to @ref RADIO_STATE_CCA.
  *
@@ -729,6 +933,9 @@ bool nrf_802154_modulated_carrier(const uint8_t * p_data);
  *       a callback or the IRQ context, use @ref nrf_802154_buffer_free_immediately_raw.
  * @note This function is available if @ref NRF_802154_USE_RAW_API is enabled.
  *
+ * @note A buffer that has already been freed, for example by a pending asynchronous request, is
+ *       not freed again, whatever the priority of the caller.
+ *
  * @param[in]  p_data  Pointer to the buffer containing the received data that is no longer needed
  *                     by the higher layer.
  */
@@ -748,7 +955,8 @@ void nrf_802154_buffer_free_raw(uint8_t * p_data);
  *                     by the higher layer.
  *
  * @retval true   Buffer was freed successfully.
- * @retval false  Buffer cannot be freed right now due to ongoing operation.
+ * @retval false  Buffer cannot be freed right now due to ongoing operation, or it has already
+ *                been freed, for example by a pending asynchronous request.
  */
 bool nrf_802154_buffer_free_immediately_raw(uint8_t * p_data);
 #endif // !NRF_802154_SERIALIZATION_HOST
@@ -766,6 +974,9 @@ bool nrf_802154_buffer_free_immediately_raw(uint8_t * p_data);
  *       a callback or IRQ context, use @ref nrf_802154_buffer_free_immediately.
  * @note This function is available if @ref NRF_802154_USE_RAW_API is disabled.
  *
+ * @note A buffer that has already been freed, for example by a pending asynchronous request, is
+ *       not freed again, whatever the priority of the caller.
+ *
  * @param[in]  p_data  Pointer to the buffer containing the received data that is no longer needed
  *                     by the higher layer.
  */
@@ -784,7 +995,8 @@ void nrf_802154_buffer_free(uint8_t * p_data);
  *                     by the higher layer.
  *
  * @retval true   Buffer was freed successfully.
- * @retval false  Buffer cannot be freed right now due to ongoing operation.
+ * @retval false  Buffer cannot be freed right now due to ongoing operation, or it has already
+ *                been freed, for example by a pending asynchronous request.
  */
 bool nrf_802154_buffer_free_immediately(uint8_t * p_data);
 
@@ -1251,6 +1463,39 @@ void nrf_802154_csma_ca_max_backoffs_set(uint8_t max_backoffs);
  */
 uint8_t nrf_802154_csma_ca_max_backoffs_get(void);
 
+/**
+ * @brief Selects one of the built-in backoff policies of the CSMA-CA algorithm.
+ *
+ * The policy decides the initial backoff exponent of a transmission, the number of backoff periods
+ * to wait and how the backoff exponent evolves when the channel is found busy. The default policy
+ * is @ref NRF_802154_CSMA_CA_BACKOFF_POLICY_IEEE.
+ *
+ * @note This function is available if @ref NRF_802154_CSMA_CA_ENABLED is enabled.
+ * @note The policy takes effect with the next CSMA-CA transmission.
+ *
+ * @param[in] policy  Identifier of the built-in policy.
+ *
+ * @retval true   The policy has been selected.
+ * @retval false  @p policy does not identify a built-in policy.
+ */
+bool nrf_802154_csma_ca_backoff_policy_set(nrf_802154_csma_ca_backoff_policy_id_t policy);
+
+#if !NRF_802154_SERIALIZATION_HOST || defined(DOXYGEN)
+/**
+ * @brief Installs a custom backoff policy of the CSMA-CA algorithm.
+ *
+ * @note This function is available if @ref NRF_802154_CSMA_CA_ENABLED is enabled.
+ * @note The structure pointed to by @p p_policy and its context must remain valid until another
+ *       policy is selected. Its callbacks are called from the context of the CSMA-CA procedure
+ *       and must not block.
+ *
+ * @param[in] p_policy  Pointer to the policy, or NULL to restore the IEEE 802.15.4 policy.
+ */
+void nrf_802154_csma_ca_backoff_policy_custom_set(
+    const nrf_802154_csma_ca_backoff_policy_t * p_policy);
+
+#endif // !NRF_802154_SERIALIZATION_HOST || defined(DOXYGEN)
+
 #endif // NRF_802154_CSMA_CA_ENABLED
 
 #if !NRF_802154_SERIALIZATION_HOST || defined(DOXYGEN)
@@ -1378,10 +1623,347 @@ void nrf_802154_stat_timestamps_get(nrf_802154_stat_timestamps_t * p_stat_timest
  *
  * @note @ref nrf_802154_stat_counters_get and @ref nrf_802154_stat_counters_reset may lead to
  * missing events if an counted event occurs between these calls. Use
- * @ref nrf_802154_stat_counters_subtract to avoid such condition if necessary.
+ * @ref nrf_802154_stat_counters_subtract or @ref nrf_802154_stat_snapshot_take to avoid such
+ * condition if necessary.
+ *
+ * @note Resetting or decreasing the counters does not affect snapshots, and taking a snapshot
+ *       does not affect the counters returned by @ref nrf_802154_stat_counters_get.
  */
 void nrf_802154_stat_counters_reset(void);
 
+/**
+ * @brief Takes a snapshot of statistics gathered since the previous snapshot.
+ *
+ * All counters and histograms in the snapshot come from the same instant: no event is counted
+ * in one of them and missed in another, and no event is lost or counted twice between
+ * consecutive snapshots. Time stamps are not part of the snapshot. Snapshots are independent
+ * of @ref nrf_802154_stat_counters_reset and @ref nrf_802154_stat_counters_subtract.
+ *
+ * The source table in @c rx_sources keeps the sources across snapshots. A snapshot reports only
+ * the entries that received frames since the previous one; the other entries are zeroed.
+ *
+ * @note Only one snapshot can be taken at a time. The function fails if it is called while
+ *       another snapshot is being taken, for example from a preempting interrupt.
+ *
+ * @param[out] p_snapshot  Structure that will be filled with the statistics gathered since
+ *                         the previous snapshot.
+ *
+ * @retval true   The snapshot was taken.
+ * @retval false  Another snapshot is being taken. @p p_snapshot was not modified.
+ */
+bool nrf_802154_stat_snapshot_take(nrf_802154_stat_snapshot_t * p_snapshot);
+
+#endif // !NRF_802154_SERIALIZATION_HOST
+
+/**
+ * @}
+ * @defgroup nrf_802154_neighbor_table Neighbor table
+ * @{
+ */
+
+#if (NRF_802154_NEIGHBOR_TABLE_ENABLED && !NRF_802154_SERIALIZATION_HOST) || defined(DOXYGEN)
+
+/**
+ * @brief Gets the link quality of all neighbors tracked by the driver.
+ *
+ * A neighbor is added to the table when a frame is received from it or a frame with the Ack
+ * Request bit set is transmitted to it. When the table is full, the least recently active
+ * neighbor is replaced. The neighbors are copied in no particular order.
+ *
+ * @param[out]  p_neighbors    Array to be filled with the neighbors.
+ * @param[in]   neighbors_max  Number of elements of @p p_neighbors. The table holds at most
+ *                             @ref NRF_802154_NEIGHBOR_TABLE_SIZE neighbors.
+ *
+ * @returns  Number of neighbors copied to @p p_neighbors.
+ */
+uint8_t nrf_802154_neighbor_table_get(nrf_802154_neighbor_t * p_neighbors,
+                                      uint8_t                 neighbors_max);
+
+/**
+ * @brief Gets the link quality of a single neighbor.
+ *
+ * @param[in]   p_addr      Pointer to the address of the neighbor, in little-endian byte order.
+ * @param[in]   extended    If the address is an extended address.
+ * @param[out]  p_neighbor  Structure to be filled with the link quality of the neighbor.
+ *
+ * @retval  true   The neighbor was found.
+ * @retval  false  The neighbor is not tracked. @p p_neighbor was not modified.
+ */
+bool nrf_802154_neighbor_get(const uint8_t         * p_addr,
+                             bool                    extended,
+                             nrf_802154_neighbor_t * p_neighbor);
+
+/**
+ * @brief Removes all neighbors from the neighbor table.
+ */
+void nrf_802154_neighbor_table_clear(void);
+
+#endif // (NRF_802154_NEIGHBOR_TABLE_ENABLED && !NRF_802154_SERIALIZATION_HOST) || defined(DOXYGEN)
+
+/**
+ * @}
+ * @defgroup nrf_802154_tx_queue Transmit queue
+ * @{
+ *
+ * The transmit queue holds up to @ref NRF_802154_TX_QUEUE_SIZE frames and transmits them in order
+ * without waiting for a new transmit request from the higher layer. When a frame is done, the next
+ * frame is started before the result of the previous one is notified.
+ *
+ * Each frame is transmitted with its own metadata. A frame that fails because of a busy channel or
+ * a missing or invalid Ack is retransmitted up to @c max_retries times. The frame properties
+ * returned by a failed attempt are reused, so that a secured frame is not secured again. If
+ * @ref NRF_802154_RETRANSMISSION_ENABLED is set, these retransmissions come on top of the ones
+ * configured with @ref nrf_802154_retransmission_config_set.
+ *
+ * The transmit queue must not be used together with the transmit functions. A frame may be
+ * transmitted directly only when the queue is empty.
+ */
+
+#if NRF_802154_TX_QUEUE_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Adds frames to the end of the transmit queue.
+ *
+ * The frames are added in order until the queue is full or a frame is rejected. A frame is
+ * rejected if it is already in the queue, if it requests CSMA-CA while CSMA-CA is disabled, or if
+ * its frame properties are invalid. If the queue was idle, the first frame is started before this
+ * function returns.
+ *
+ * The result of each added frame is notified with @ref nrf_802154_transmitted_raw or
+ * @ref nrf_802154_transmit_failed, or, in the batch notification mode, with
+ * @ref nrf_802154_tx_queue_done. A frame that the driver refuses to transmit is notified with
+ * @ref NRF_802154_TX_ERROR_ABORTED. Like any other result, it is notified after this function
+ * returns.
+ *
+ * @note The buffers pointed to by @c p_data must be kept unchanged until the results of the
+ *       frames are notified or the frames are canceled.
+ *
+ * @param[in]  p_entries  Array of frames to be added, in the same format as for
+ *                        @ref nrf_802154_transmit_raw.
+ * @param[in]  count      Number of elements of @p p_entries.
+ *
+ * @returns  Number of frames added to the queue, counted from the beginning of @p p_entries.
+ */
+uint8_t nrf_802154_tx_queue_enqueue_raw(const nrf_802154_tx_queue_entry_t * p_entries,
+                                        uint8_t                             count);
+
+/**
+ * @brief Removes a frame that waits in the transmit queue.
+ *
+ * A frame whose transmission has already started cannot be canceled. Its result is notified
+ * normally.
+ *
+ * @param[in]  p_data  Pointer to the frame to be removed.
+ *
+ * @retval  true   The frame was removed. Its result is not going to be notified.
+ * @retval  false  The frame is not in the queue or its transmission has already started.
+ */
+bool nrf_802154_tx_queue_cancel(const uint8_t * p_data);
+
+#endif // NRF_802154_TX_QUEUE_ENABLED || defined(DOXYGEN)
+
+#if (NRF_802154_TX_QUEUE_ENABLED && !NRF_802154_SERIALIZATION_HOST) || defined(DOXYGEN)
+
+/**
+ * @brief Gets the number of frames held by the transmit queue.
+ *
+ * @returns  Number of frames waiting for transmission, being transmitted and, in the batch
+ *           notification mode, waiting for their results to be notified.
+ */
+uint8_t nrf_802154_tx_queue_length_get(void);
+
+/**
+ * @brief Selects how the results of the queued frames are notified.
+ *
+ * In the batch notification mode, the results are stored by the driver and notified together with
+ * @ref nrf_802154_tx_queue_done when the queue becomes empty. The Ack frames are freed by the
+ * driver, only their Frame Pending bits are reported. The stored results occupy the queue until
+ * they are notified.
+ *
+ * @param[in]  enabled  If the batch notification mode is to be used.
+ *
+ * @retval  true   The mode was set.
+ * @retval  false  The queue is not empty and the mode was not changed.
+ */
+bool nrf_802154_tx_queue_batch_notify_set(bool enabled);
+
+#endif // (NRF_802154_TX_QUEUE_ENABLED && !NRF_802154_SERIALIZATION_HOST) || defined(DOXYGEN)
+
+/**
+ * @}
+ * @defgroup nrf_802154_retransmission Driver-side retransmissions
+ * @{
+ *
+ * A frame transmitted with @ref nrf_802154_transmit_raw or @ref nrf_802154_transmit_csma_ca_raw
+ * whose transmission fails because of a missing or invalid Ack is transmitted again by the driver,
+ * up to @c max_frame_retries times, before its result is notified. A frame transmitted with
+ * CSMA-CA is retransmitted according to @c csma_ca_restart, which also selects whether a channel
+ * access failure is retried. The frame properties returned by a failed attempt are reused, so that
+ * a secured frame is not secured again.
+ *
+ * Only the final result of a frame is notified, with @ref nrf_802154_transmitted_raw or
+ * @ref nrf_802154_transmit_failed. Its metadata reports the number of attempts and the causes
+ * of the failed ones in @c retries. A transmit request is rejected if the same buffer still waits
+ * for its result. A rejected request does not affect the frame being retransmitted.
+ */
+
+#if NRF_802154_RETRANSMISSION_ENABLED || defined(DOXYGEN)
+
+/**
+ * @brief Sets the settings of the driver-side retransmissions.
+ *
+ * The settings apply to the failed attempts that end after this call, including the ones of
+ * a frame being transmitted.
+ *
+ * @param[in]  p_config  Pointer to the settings.
+ *
+ * @retval  true   The settings were set.
+ * @retval  false  A policy has an unknown value or @c max_frame_retries equals @c UINT8_MAX.
+ *                 The settings were not changed.
+ */
+bool nrf_802154_retransmission_config_set(const nrf_802154_retransmission_config_t * p_config);
+
+#endif // NRF_802154_RETRANSMISSION_ENABLED || defined(DOXYGEN)
+
+#if (NRF_802154_RETRANSMISSION_ENABLED && !NRF_802154_SERIALIZATION_HOST) || defined(DOXYGEN)
+
+/**
+ * @brief Gets the settings of the driver-side retransmissions.
+ *
+ * @param[out]  p_config  Pointer to the structure to be filled with the current settings.
+ */
+void nrf_802154_retransmission_config_get(nrf_802154_retransmission_config_t * p_config);
+
+#endif // (NRF_802154_RETRANSMISSION_ENABLED && !NRF_802154_SERIALIZATION_HOST) || defined(DOXYGEN)
+
+/**
+ * @}
+ * @defgroup nrf_802154_async Asynchronous requests
+ * @{
+ *
+ * The asynchronous versions of requests do not wait until the driver processes them. A request
+ * is queued and @p done is called with the value that the synchronous version would have
+ * returned. Requests queued in a burst, for example from a context that masks the driver
+ * interrupts, are processed together.
+ *
+ * The requests of a context are processed in the order in which they were issued. Pending
+ * asynchronous requests are processed before a synchronous request, including a synchronous
+ * request issued from a context whose priority is equal to or higher than the priority of
+ * the driver's request processing. The only exception is a synchronous request issued while
+ * an asynchronous request is being processed, that is from a notification called by it or from
+ * a context preempting it. Such a request is processed immediately.
+ *
+ * If @ref NRF_802154_REQUEST_ASYNC_QUEUE_SIZE requests are already pending, the request is
+ * not queued and false is returned, so that the caller can retry after a pending request
+ * completes.
+ *
+ * @note @p done is called from the driver's request processing context or from the context of
+ *       a synchronous request that processes the pending asynchronous requests. It may queue
+ *       another asynchronous request.
+ */
+
+#if !NRF_802154_SERIALIZATION_HOST || defined(DOXYGEN)
+
+/**
+ * @brief Asynchronous version of @ref nrf_802154_sleep.
+ *
+ * @param[in]  done       Function called with the result of the request. May be NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   The request was queued.
+ * @retval  false  Too many asynchronous requests are pending.
+ */
+bool nrf_802154_sleep_async(nrf_802154_async_done_t done, void * p_context);
+
+/**
+ * @brief Asynchronous version of @ref nrf_802154_receive.
+ *
+ * @param[in]  done       Function called with the result of the request. May be NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   The request was queued.
+ * @retval  false  Too many asynchronous requests are pending.
+ */
+bool nrf_802154_receive_async(nrf_802154_async_done_t done, void * p_context);
+
+/**
+ * @brief Asynchronous version of @ref nrf_802154_receive_at.
+ *
+ * @param[in]  rx_time    Absolute time used by the SL Timer, in microseconds (us).
+ * @param[in]  timeout    Reception timeout (counted from @p rx_time), in microseconds (us).
+ * @param[in]  channel    Radio channel on which the frame is to be received.
+ * @param[in]  id         Identifier of the scheduled reception window.
+ * @param[in]  done       Function called with the result of the request. May be NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   The request was queued.
+ * @retval  false  Too many asynchronous requests are pending.
+ */
+bool nrf_802154_receive_at_async(uint64_t                rx_time,
+                                 uint32_t                timeout,
+                                 uint8_t                 channel,
+                                 uint32_t                id,
+                                 nrf_802154_async_done_t done,
+                                 void                  * p_context);
+
+/**
+ * @brief Asynchronous version of @ref nrf_802154_receive_at_cancel.
+ *
+ * @param[in]  id         Identifier of the delayed reception window to be cancelled.
+ * @param[in]  done       Function called with the result of the request. May be NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   The request was queued.
+ * @retval  false  Too many asynchronous requests are pending.
+ */
+bool nrf_802154_receive_at_cancel_async(uint32_t                id,
+                                        nrf_802154_async_done_t done,
+                                        void                  * p_context);
+
+#if NRF_802154_USE_RAW_API || defined(DOXYGEN)
+
+/**
+ * @brief Asynchronous version of @ref nrf_802154_buffer_free_raw.
+ *
+ * @note This function is available if @ref NRF_802154_USE_RAW_API is enabled.
+ *
+ * @param[in]  p_data     Pointer to the buffer containing the received data that is no longer
+ *                        needed by the higher layer.
+ * @param[in]  done       Function called with the result of the request. May be NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   The request was queued. @p done is called with false if the buffer was freed
+ *                 by another request before this request was processed.
+ * @retval  false  Too many asynchronous requests are pending.
+ */
+bool nrf_802154_buffer_free_raw_async(uint8_t               * p_data,
+                                      nrf_802154_async_done_t done,
+                                      void                  * p_context);
+
+#endif // NRF_802154_USE_RAW_API
+
+#if !NRF_802154_USE_RAW_API || defined(DOXYGEN)
+
+/**
+ * @brief Asynchronous version of @ref nrf_802154_buffer_free.
+ *
+ * @note This function is available if @ref NRF_802154_USE_RAW_API is disabled.
+ *
+ * @param[in]  p_data     Pointer to the buffer containing the received data that is no longer
+ *                        needed by the higher layer.
+ * @param[in]  done       Function called with the result of the request. May be NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   The request was queued. @p done is called with false if the buffer was freed
+ *                 by another request before this request was processed.
+ * @retval  false  Too many asynchronous requests are pending.
+ */
+bool nrf_802154_buffer_free_async(uint8_t               * p_data,
+                                  nrf_802154_async_done_t done,
+                                  void                  * p_context);
+
+#endif // !NRF_802154_USE_RAW_API
+
 #endif // !NRF_802154_SERIALIZATION_HOST
 
 /**
@@ -71,7 +71,8 @@ extern void nrf_802154_cca_failed(nrf_802154_cca_error_t error);
  * @brief Notifies that the energy detection procedure finished.
  *
  * @param[in]  p_result     Pointer to structure containing the result of the operation.
- *                          The pointer is valid within the @ref nrf_802154_energy_detected only.
+ *                          The pointer is valid within the @ref nrf_802154_energy_detected only,
+ *                          and so is the result of an energy detection sweep it points to.
  */
 extern void nrf_802154_energy_detected(const nrf_802154_energy_detected_t * p_result);
 
@@ -307,6 +308,21 @@ extern void nrf_802154_transmit_failed(uint8_t
                                        nrf_802154_tx_error_t                       error,
                                        const nrf_802154_transmit_done_metadata_t * p_metadata);
 
+#if (NRF_802154_TX_QUEUE_ENABLED && !NRF_802154_SERIALIZATION_HOST) || defined(DOXYGEN)
+/**
+ * @brief Notifies the results of the frames transmitted from the transmit queue.
+ *
+ * This function is called in the batch notification mode when the transmit queue becomes empty.
+ * The results are ordered as the frames were completed. Canceled frames are not reported.
+ *
+ * @param[in]  p_results  Array of the results. It is valid only during the call.
+ * @param[in]  count      Number of elements of @p p_results.
+ */
+extern void nrf_802154_tx_queue_done(const nrf_802154_tx_queue_result_t * p_results,
+                                     uint8_t                              count);
+
+#endif // (NRF_802154_TX_QUEUE_ENABLED && !NRF_802154_SERIALIZATION_HOST) || defined(DOXYGEN)
+
 #if !NRF_802154_SERIALIZATION_HOST || defined(DOXYGEN)
 /**
  * @brief Notifies that transmitting a frame has started.
@@ -210,6 +210,20 @@ extern "C" {
 #define NRF_802154_MAX_DISREGARDABLE_NOTIFICATIONS 4
 #endif
 
+/**
+ * @def NRF_802154_DELAYED_TIMESLOTS
+ *
+ * The number of delayed timeslots that can be scheduled simultaneously. It must be equal to
+ * the sum of NRF_802154_RSCH_DLY_TS_OP_DTX_SLOTS, NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS and
+ * NRF_802154_RSCH_DLY_TS_OP_CSMACA_SLOTS of the Radio Scheduler, and it must be set to the same
+ * value on both cores when the serialization is used.
+ *
+ * @note This value is a part of @ref NRF_802154_MAX_PENDING_NOTIFICATIONS.
+ */
+#ifndef NRF_802154_DELAYED_TIMESLOTS
+#define NRF_802154_DELAYED_TIMESLOTS 4
+#endif
+
 /**
  * @def NRF_802154_NOTIFY_CRCERROR
  *
@@ -249,6 +263,42 @@ extern "C" {
 #endif
 #endif
 
+/**
+ * @def NRF_802154_PERIODIC_RX_SCHEDULES
+ *
+ * Number of periodic reception schedules that can be active at the same time.
+ * Each schedule keeps at most one delayed reception window pending and uses one of
+ * the delayed timeslot identifiers reserved for periodic reception.
+ * Used only when @ref NRF_802154_DELAYED_TRX_ENABLED is set to 1.
+ * Setting this option to 0 disables the periodic reception feature.
+ *
+ */
+#ifndef NRF_802154_PERIODIC_RX_SCHEDULES
+#define NRF_802154_PERIODIC_RX_SCHEDULES 1
+#endif
+
+/**
+ * @def NRF_802154_PERIODIC_RX_CHANNELS_MAX
+ *
+ * Maximum length of the channel hopping sequence of a periodic reception schedule.
+ *
+ */
+#ifndef NRF_802154_PERIODIC_RX_CHANNELS_MAX
+#define NRF_802154_PERIODIC_RX_CHANNELS_MAX 16
+#endif
+
+/**
+ * @def NRF_802154_PERIODIC_RX_ARM_MARGIN_US
+ *
+ * Time in microseconds by which a periodic reception window is armed before the latest
+ * moment at which its delayed timeslot can still be requested. It is also the minimum
+ * distance between the end of a window and the arming of the next one.
+ *
+ */
+#ifndef NRF_802154_PERIODIC_RX_ARM_MARGIN_US
+#define NRF_802154_PERIODIC_RX_ARM_MARGIN_US 500
+#endif
+
 /**
  * @def NRF_802154_TEST_MODES_ENABLED
  *
@@ -271,6 +321,30 @@ extern "C" {
 #define NRF_802154_PAN_COORD_GET_ENABLED 0
 #endif
 
+/**
+ * @def NRF_802154_TRX_SIM_ENABLED
+ *
+ * Replaces the RADIO-based trx module with a host-side simulator (see nrf_802154_trx_sim.h).
+ * The simulator implements the trx API on top of a virtual clock and a scripted medium,
+ * which allows the driver core to be exercised without the radio hardware. The platform
+ * modules required by the driver (clock, interrupts, timers) are simulated on the same
+ * clock by nrf_802154_platform_sim.c.
+ * It must not be enabled in end products.
+ */
+#ifndef NRF_802154_TRX_SIM_ENABLED
+#define NRF_802154_TRX_SIM_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TRX_SIM_FRAMES_NUM
+ *
+ * Number of frames that can be injected into the simulated medium at the same time.
+ * Used only when @ref NRF_802154_TRX_SIM_ENABLED is set to 1.
+ */
+#ifndef NRF_802154_TRX_SIM_FRAMES_NUM
+#define NRF_802154_TRX_SIM_FRAMES_NUM 16
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_csma CSMA/CA procedure configuration
@@ -359,6 +433,17 @@ extern "C" {
 #define NRF_802154_CSMA_CA_WAIT_FOR_TIMESLOT 1
 #endif
 
+/**
+ * @def NRF_802154_CSMA_CA_BACKOFF_DESTINATIONS_NUM
+ *
+ * The number of destination addresses for which the
+ * @ref NRF_802154_CSMA_CA_BACKOFF_POLICY_DESTINATION backoff policy keeps the history of CCA
+ * results. When the history is full, the least recently used destination is replaced.
+ */
+#ifndef NRF_802154_CSMA_CA_BACKOFF_DESTINATIONS_NUM
+#define NRF_802154_CSMA_CA_BACKOFF_DESTINATIONS_NUM 8
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_timeout ACK timeout feature configuration
@@ -405,6 +490,21 @@ extern "C" {
 #define NRF_802154_MAX_ACK_IE_SIZE 16
 #endif
 
+/**
+ * @def NRF_802154_ENH_ACK_TEMPLATES_NUM
+ *
+ * The number of Enh-Ack templates cached by the Enh-Ack generator.
+ *
+ * A template holds a complete Enh-Ack sent to a peer together with the offsets of the fields that
+ * change between Acks. When a frame from the same peer with the same header layout is received,
+ * the Enh-Ack is copied from the template and only the per-frame fields are updated.
+ * Set to 0 to disable the templates.
+ *
+ */
+#ifndef NRF_802154_ENH_ACK_TEMPLATES_NUM
+#define NRF_802154_ENH_ACK_TEMPLATES_NUM 4
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_ifs Interframe spacing feature configuration
@@ -424,12 +524,45 @@ extern "C" {
 #endif
 #endif
 
+/**
+ * @def NRF_802154_IFS_HISTORY_SIZE
+ *
+ * Configures the number of destinations for which the end of the last transmitted frame is
+ * remembered. When the history is full, the destination of the oldest frame is replaced.
+ *
+ * @note This option is used only if @ref NRF_802154_IFS_ENABLED is set.
+ */
+#ifndef NRF_802154_IFS_HISTORY_SIZE
+#define NRF_802154_IFS_HISTORY_SIZE 4
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_transmission Transmission start notification feature configuration
  * @{
  */
 
+/**
+ * @def NRF_802154_TX_PIPELINE_DEPTH
+ *
+ * Number of transmit work buffers kept by the driver.
+ *
+ * Each frame that needs to be modified before transmission (security writer, IE writer,
+ * encryption) is processed in a work buffer that stays bound to the frame until its transmission
+ * result is reported. With a depth greater than 1 and @ref NRF_802154_TX_QUEUE_ENABLED set,
+ * the transmission setup of the next queued frame is performed while the current frame is
+ * on air, so that it does not add to the gap between consecutive frames. Only one frame is
+ * prepared ahead, so a depth greater than 2 brings no benefit. Each additional work buffer costs
+ * 128 bytes of RAM.
+ *
+ * @note Unless @ref NRF_802154_ENCRYPTION_ACCELERATOR_SW is set, the next frame is prepared only
+ *       while an unsecured frame is on air, because the AES-CCM* peripherals encrypt the frame
+ *       during its transmission.
+ */
+#ifndef NRF_802154_TX_PIPELINE_DEPTH
+#define NRF_802154_TX_PIPELINE_DEPTH 1
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_stats Statistics configuration
@@ -462,6 +595,319 @@ extern "C" {
 #define NRF_802154_STATS_COUNT_RECEIVED_PREAMBLES 1
 #endif
 
+/**
+ * @def NRF_802154_STATS_HISTOGRAMS_ENABLED
+ *
+ * Configures if the driver collects statistic histograms: Ack turnaround times, CCA results
+ * per channel, CSMA-CA backoff counts and RSSI and LQI distributions per source address.
+ * The histograms are retrieved by a call to @ref nrf_802154_stat_snapshot_take.
+ */
+#ifndef NRF_802154_STATS_HISTOGRAMS_ENABLED
+#define NRF_802154_STATS_HISTOGRAMS_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_STATS_RX_SOURCES_NUM
+ *
+ * Configures the number of source addresses for which RSSI and LQI distributions are collected.
+ * When the table is full, the entry with the lowest number of received frames is replaced.
+ *
+ * @note This option is used only if @ref NRF_802154_STATS_HISTOGRAMS_ENABLED is set.
+ */
+#ifndef NRF_802154_STATS_RX_SOURCES_NUM
+#define NRF_802154_STATS_RX_SOURCES_NUM 8
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_identities Multiple identities configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_IDENTITIES_NUM
+ *
+ * Configures the number of identities of the device. An identity is a PAN ID with a short and
+ * an extended address. The receive filter accepts frames addressed to any of the identities.
+ * Identity 0 is configured with @ref nrf_802154_pan_id_set, @ref nrf_802154_short_address_set
+ * and @ref nrf_802154_extended_address_set. The other ones are configured with
+ * @ref nrf_802154_identity_set.
+ *
+ * The receive filter compares the destination of each frame with every configured identity,
+ * so the value is expected to be small.
+ */
+#ifndef NRF_802154_IDENTITIES_NUM
+#define NRF_802154_IDENTITIES_NUM 1
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_filter_rules Receive filter rules configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_FILTER_RULES_ENABLED
+ *
+ * Configures if the received frames are checked against a table of rules set by
+ * @ref nrf_802154_filter_rule_set. Rules can drop frames before they are notified, or count them.
+ * The rules are evaluated while the frame is being received, as soon as the fields they match are
+ * received, so that a dropped frame is not received to the end.
+ */
+#ifndef NRF_802154_FILTER_RULES_ENABLED
+#define NRF_802154_FILTER_RULES_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_FILTER_RULES_NUM
+ *
+ * Configures the number of entries in the receive filter rule table.
+ *
+ * @note This option is used only if @ref NRF_802154_FILTER_RULES_ENABLED is set.
+ */
+#ifndef NRF_802154_FILTER_RULES_NUM
+#define NRF_802154_FILTER_RULES_NUM 8
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_neighbor_table Neighbor table configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_NEIGHBOR_TABLE_ENABLED
+ *
+ * Configures if the driver tracks the link quality of its neighbors: averaged RSSI and LQI of
+ * the received frames, frame and Ack counts and the time of the last received frame, per
+ * source address. The table is retrieved by a call to @ref nrf_802154_neighbor_table_get.
+ */
+#ifndef NRF_802154_NEIGHBOR_TABLE_ENABLED
+#define NRF_802154_NEIGHBOR_TABLE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_NEIGHBOR_TABLE_SIZE
+ *
+ * Configures the number of neighbors tracked by the driver. When the table is full, the least
+ * recently active neighbor is replaced.
+ *
+ * @note This option is used only if @ref NRF_802154_NEIGHBOR_TABLE_ENABLED is set.
+ */
+#ifndef NRF_802154_NEIGHBOR_TABLE_SIZE
+#define NRF_802154_NEIGHBOR_TABLE_SIZE 16
+#endif
+
+/**
+ * @def NRF_802154_NEIGHBOR_TABLE_EWMA_SHIFT
+ *
+ * Configures the weight of a new sample in the averaged RSSI and LQI of a neighbor,
+ * which is 1 / 2^NRF_802154_NEIGHBOR_TABLE_EWMA_SHIFT.
+ *
+ * @note This option is used only if @ref NRF_802154_NEIGHBOR_TABLE_ENABLED is set.
+ */
+#ifndef NRF_802154_NEIGHBOR_TABLE_EWMA_SHIFT
+#define NRF_802154_NEIGHBOR_TABLE_EWMA_SHIFT 3
+#endif
+
+/**
+ * @def NRF_802154_NEIGHBOR_TABLE_LINK_METRICS_ENABLED
+ *
+ * Configures if the Link Metrics IEs written by the IE writer to Enh-Acks report the averaged
+ * RSSI and LQI of the neighbor, updated with the acknowledged frame, instead of the RSSI and LQI
+ * of the acknowledged frame alone.
+ *
+ * @note This option is used only if @ref NRF_802154_NEIGHBOR_TABLE_ENABLED and
+ *       @ref NRF_802154_IE_WRITER_ENABLED are set.
+ */
+#ifndef NRF_802154_NEIGHBOR_TABLE_LINK_METRICS_ENABLED
+#define NRF_802154_NEIGHBOR_TABLE_LINK_METRICS_ENABLED 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_tx_queue Transmit queue configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_TX_QUEUE_ENABLED
+ *
+ * Configures if the driver provides a transmit queue. Frames added to the queue with
+ * @ref nrf_802154_tx_queue_enqueue_raw are transmitted one after another by the driver, without
+ * waiting for the higher layer to request each transmission.
+ *
+ * @note This option requires @ref NRF_802154_USE_RAW_API.
+ */
+#ifndef NRF_802154_TX_QUEUE_ENABLED
+#define NRF_802154_TX_QUEUE_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_TX_QUEUE_SIZE
+ *
+ * Configures the number of frames the transmit queue can hold, including the frame being
+ * transmitted and, if batch notifications are enabled, the frames whose results are not notified
+ * yet.
+ *
+ * @note This option is used only if @ref NRF_802154_TX_QUEUE_ENABLED is set.
+ */
+#ifndef NRF_802154_TX_QUEUE_SIZE
+#define NRF_802154_TX_QUEUE_SIZE 8
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_retransmission Retransmission configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_RETRANSMISSION_ENABLED
+ *
+ * Configures if the driver retransmits frames by itself. If enabled, a frame transmitted with
+ * @ref nrf_802154_transmit_raw or @ref nrf_802154_transmit_csma_ca_raw whose transmission fails
+ * because of a missing or invalid ACK is transmitted again, according to the settings passed to
+ * @ref nrf_802154_retransmission_config_set, before the result is notified to the higher layer.
+ *
+ * @note This option requires @ref NRF_802154_USE_RAW_API.
+ */
+#ifndef NRF_802154_RETRANSMISSION_ENABLED
+#define NRF_802154_RETRANSMISSION_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_RETRANSMISSION_MAX_FRAME_RETRIES_DEFAULT
+ *
+ * The default number of retransmissions of a frame, used until
+ * @ref nrf_802154_retransmission_config_set is called. The default value of 0 leaves
+ * the retransmissions to the higher layer.
+ *
+ * @note This option is used only if @ref NRF_802154_RETRANSMISSION_ENABLED is set.
+ */
+#ifndef NRF_802154_RETRANSMISSION_MAX_FRAME_RETRIES_DEFAULT
+#define NRF_802154_RETRANSMISSION_MAX_FRAME_RETRIES_DEFAULT 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_ed_sweep Energy detection sweep configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_ED_SWEEP_ENABLED
+ *
+ * Configures if the driver supports the energy detection sweep started with
+ * @ref nrf_802154_energy_detection_sweep. The sweep measures the energy on a set of channels in
+ * turns and reports the statistics of all the channels in a single call to
+ * @ref nrf_802154_energy_detected. When the driver is serialized, the call is carried by one
+ * message per measured channel followed by one message that ends the sweep.
+ */
+#ifndef NRF_802154_ED_SWEEP_ENABLED
+#define NRF_802154_ED_SWEEP_ENABLED 0
+#endif
+
+/**
+ * @def NRF_802154_ED_SWEEP_SAMPLE_TIME_US
+ *
+ * Duration of a single sample of the energy detection sweep, in microseconds. The energy measured
+ * on a channel during its dwell time is split into samples of this duration, and the statistics
+ * of the channel are calculated from the peak energy of each sample.
+ *
+ * Every sample is measured by a separate energy detection procedure of the radio. The receiver
+ * stays enabled between the samples and is only retuned when the sweep moves to the next channel.
+ * Shorter samples resolve shorter bursts of interference, longer samples take fewer interrupts.
+ *
+ * @note The value is rounded down to a multiple of the duration of a single energy detection
+ *       iteration of the radio, which is 128 us.
+ */
+#ifndef NRF_802154_ED_SWEEP_SAMPLE_TIME_US
+#define NRF_802154_ED_SWEEP_SAMPLE_TIME_US 512
+#endif
+
+/**
+ * @def NRF_802154_ED_SWEEP_PERCENTILE
+ *
+ * Percentile of the samples of a channel reported by the energy detection sweep.
+ */
+#ifndef NRF_802154_ED_SWEEP_PERCENTILE
+#define NRF_802154_ED_SWEEP_PERCENTILE 90
+#endif
+
+/**
+ * @def NRF_802154_ED_SWEEP_HISTOGRAM_BINS
+ *
+ * Number of bins of the histogram of the samples reported for every channel by the energy
+ * detection sweep.
+ */
+#ifndef NRF_802154_ED_SWEEP_HISTOGRAM_BINS
+#define NRF_802154_ED_SWEEP_HISTOGRAM_BINS 16
+#endif
+
+/**
+ * @def NRF_802154_ED_SWEEP_HISTOGRAM_MIN_DBM
+ *
+ * Lower edge of the first bin of the energy detection sweep histogram, in dBm. Samples below
+ * this value are counted in the first bin.
+ */
+#ifndef NRF_802154_ED_SWEEP_HISTOGRAM_MIN_DBM
+#define NRF_802154_ED_SWEEP_HISTOGRAM_MIN_DBM (-92)
+#endif
+
+/**
+ * @def NRF_802154_ED_SWEEP_HISTOGRAM_BIN_WIDTH_DBM
+ *
+ * Width of a single bin of the energy detection sweep histogram, in dB. Samples above the upper
+ * edge of the last bin are counted in the last bin.
+ */
+#ifndef NRF_802154_ED_SWEEP_HISTOGRAM_BIN_WIDTH_DBM
+#define NRF_802154_ED_SWEEP_HISTOGRAM_BIN_WIDTH_DBM 4
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_ant_div Antenna diversity configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_ANT_DIV_PEER_ANTENNA_ENABLED
+ *
+ * Configures if the antenna diversity module selects the transmit antenna per peer. If enabled,
+ * the driver passes the source address of each received frame and the destination address
+ * of each transmitted frame to the antenna diversity module, and
+ * @ref NRF_802154_SL_ANT_DIV_MODE_AUTO can be set for transmission.
+ *
+ * @note This option requires a service layer that implements
+ *       @ref nrf_802154_sl_ant_div_rx_frame_source_notify,
+ *       @ref nrf_802154_sl_ant_div_tx_frame_notify and
+ *       @ref nrf_802154_sl_ant_div_tx_started_notify, like the open-source one.
+ */
+#ifndef NRF_802154_ANT_DIV_PEER_ANTENNA_ENABLED
+#define NRF_802154_ANT_DIV_PEER_ANTENNA_ENABLED 0
+#endif
+
+/**
+ * @}
+ * @defgroup nrf_802154_config_coex Wi-Fi coexistence configuration
+ * @{
+ */
+
+/**
+ * @def NRF_802154_COEX_OPERATION_NOTIFY_ENABLED
+ *
+ * Configures if the driver notifies the coexistence module of the radio operation it requests
+ * the radio for, so that the coexistence arbiter can be requested with the priority configured
+ * for receptions, transmissions, acknowledgments and CCA separately.
+ *
+ * @note This option requires a service layer that implements
+ *       @ref nrf_802154_sl_coex_operation_set, like the open-source one.
+ */
+#ifndef NRF_802154_COEX_OPERATION_NOTIFY_ENABLED
+#define NRF_802154_COEX_OPERATION_NOTIFY_ENABLED 0
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_config_security Security configuration
@@ -472,12 +918,38 @@ extern "C" {
  * @def NRF_802154_SECURITY_KEY_STORAGE_SIZE
  *
  * Configures the number of keys which are available in the Key Storage.
- * This configuration is implementation-independent.
+ * This configuration is implementation-independent. The RAM Key Storage supports up to 128 keys,
+ * which are looked up through a hash index.
  */
 #ifndef NRF_802154_SECURITY_KEY_STORAGE_SIZE
 #define NRF_802154_SECURITY_KEY_STORAGE_SIZE 3
 #endif
 
+/**
+ * @def NRF_802154_SECURITY_FRAME_COUNTER_BLOCK_SIZE
+ *
+ * Configures the number of global frame counters reserved at once for the frames to be secured.
+ * The counters of a block are used without atomic operations. Setting the global frame counter
+ * with @ref nrf_802154_security_global_frame_counter_set or with
+ * @ref nrf_802154_security_global_frame_counter_set_if_larger to a value beyond the counter used
+ * next discards the rest of the block, so up to this number of counters may be skipped.
+ */
+#ifndef NRF_802154_SECURITY_FRAME_COUNTER_BLOCK_SIZE
+#define NRF_802154_SECURITY_FRAME_COUNTER_BLOCK_SIZE 16
+#endif
+
+/**
+ * @def NRF_802154_ENCRYPT_KEY_CACHE_SIZE
+ *
+ * Configures the number of entries in the cache of AES-CCM* inputs precomputed per key identifier
+ * and source address. The cache holds the key, the source address part of the nonce and, with
+ * @ref NRF_802154_ENCRYPTION_ACCELERATOR_SW, the expanded key, so that only the frame counter
+ * is patched for every secured frame and Enh-Ack. Set to 0 to disable the cache.
+ */
+#ifndef NRF_802154_ENCRYPT_KEY_CACHE_SIZE
+#define NRF_802154_ENCRYPT_KEY_CACHE_SIZE NRF_802154_SECURITY_KEY_STORAGE_SIZE
+#endif
+
 /**
  * @def NRF_802154_SECURITY_WRITER_ENABLED
  *
@@ -498,19 +970,38 @@ extern "C" {
 #define NRF_802154_ENCRYPTION_ENABLED 1
 #endif
 
+/**
+ * @def NRF_802154_ENCRYPTION_ACCELERATOR_SW
+ *
+ * Enables the software AES-CCM* implementation instead of a hardware accelerator. The whole
+ * transformation is computed in a single call, without the per-block ECB interrupt round trips.
+ * This option is intended for host builds and for parts that lack a CCM peripheral. It cannot be
+ * enabled together with @ref NRF_802154_ENCRYPTION_ACCELERATOR_ECB.
+ */
+#ifndef NRF_802154_ENCRYPTION_ACCELERATOR_SW
+#define NRF_802154_ENCRYPTION_ACCELERATOR_SW 0
+#endif
+
 /**
  * @def NRF_802154_ENCRYPTION_ACCELERATOR_ECB
  *
  * Enables ECB peripheral to be used as hardware accelerator for on-the-fly AES-CCM* encryption.
  */
 #ifndef NRF_802154_ENCRYPTION_ACCELERATOR_ECB
-#if defined(NRF52_SERIES) || defined(NRF5340_XXAA)
+#if NRF_802154_ENCRYPTION_ACCELERATOR_SW
+#define NRF_802154_ENCRYPTION_ACCELERATOR_ECB 0
+#elif defined(NRF52_SERIES) || defined(NRF5340_XXAA)
 #define NRF_802154_ENCRYPTION_ACCELERATOR_ECB 1
 #elif defined(NRF54H_SERIES) || defined(NRF54L_SERIES)
 #define NRF_802154_ENCRYPTION_ACCELERATOR_ECB 0
 #endif
 #endif
 
+#if NRF_802154_ENCRYPTION_ACCELERATOR_SW && NRF_802154_ENCRYPTION_ACCELERATOR_ECB
+#error \
+    "NRF_802154_ENCRYPTION_ACCELERATOR_SW cannot be used together with NRF_802154_ENCRYPTION_ACCELERATOR_ECB"
+#endif
+
 /**
  * @}
  * @defgroup nrf_802154_ie Information Elements configuration
@@ -594,6 +1085,16 @@ extern "C" {
 #define NRF_802154_REQUEST_IMPL NRF_802154_REQUEST_IMPL_SWI
 #endif
 
+/**
+ * @def NRF_802154_REQUEST_ASYNC_QUEUE_SIZE
+ *
+ * Number of asynchronous requests that can be pending at the same time. When the queue is full,
+ * the asynchronous request functions return false and the request must be retried later.
+ */
+#ifndef NRF_802154_REQUEST_ASYNC_QUEUE_SIZE
+#define NRF_802154_REQUEST_ASYNC_QUEUE_SIZE 4
+#endif
+
 /**
  *@}
  **/
@@ -118,6 +118,19 @@
 #define MAC_CMD_COORD_REALIGN           0x08                                         ///< Command frame identifier for MAC Coordinator realignment.
 #define MAC_CMD_GTS_REQUEST             0x09                                         ///< Command frame identifier for MAC GTS request.
 
+#define MP_LONG_FRAME_CONTROL_OFFSET    1                                            ///< Byte containing the Long Frame Control bit of a Multipurpose frame (+1 for the frame length byte).
+#define MP_LONG_FRAME_CONTROL_BIT       0x08                                         ///< Bit containing the Long Frame Control field of a Multipurpose frame.
+#define MP_SHORT_FCF_SIZE               1                                            ///< Size of the short Frame Control field of a Multipurpose frame.
+#define MP_DEST_ADDR_TYPE_OFFSET        1                                            ///< Byte containing the destination address type of a Multipurpose frame (+1 for the frame length byte).
+#define MP_DEST_ADDR_TYPE_MASK          0x30                                         ///< Mask of bits containing the destination address type of a Multipurpose frame.
+#define MP_DEST_ADDR_TYPE_NONE          0x00                                         ///< Bits containing the not-present destination address type of a Multipurpose frame.
+#define MP_DEST_ADDR_TYPE_SHORT         0x20                                         ///< Bits containing the short destination address type of a Multipurpose frame.
+#define MP_DEST_ADDR_TYPE_EXTENDED      0x30                                         ///< Bits containing the extended destination address type of a Multipurpose frame.
+#define MP_PAN_ID_PRESENT_OFFSET        2                                            ///< Byte containing the PAN ID Present bit of a long Multipurpose frame (+1 for the frame length byte).
+#define MP_PAN_ID_PRESENT_BIT           0x01                                         ///< Bit containing the PAN ID Present field of a long Multipurpose frame.
+#define MP_DSN_SUPPRESS_OFFSET          2                                            ///< Byte containing the DSN suppression bit of a long Multipurpose frame (+1 for the frame length byte).
+#define MP_DSN_SUPPRESS_BIT             0x04                                         ///< Bit containing the DSN suppression field of a long Multipurpose frame.
+
 #define PAN_ID_COMPR_OFFSET             1                                            ///< Byte containing the PAN ID compression bit (+1 for the frame length byte).
 #define PAN_ID_COMPR_MASK               0x40                                         ///< PAN ID compression bit.
 
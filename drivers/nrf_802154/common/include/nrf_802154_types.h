@@ -314,6 +314,11 @@ typedef struct
     uint32_t coex_denied_requests;
     /**@brief Number of coex grant activations that have been not requested. */
     uint32_t coex_unsolicited_grants;
+    /**@brief Number of transmissions delayed to keep the interframe spacing. */
+    uint32_t ifs_delayed_transmissions;
+    /**@brief Total time in microseconds by which transmissions were delayed to keep
+     *        the interframe spacing. */
+    uint32_t ifs_delay_us;
 } nrf_802154_stat_counters_t;
 
 /**
@@ -347,6 +352,189 @@ typedef struct
     nrf_802154_stat_timestamps_t timestamps;
 } nrf_802154_stats_t;
 
+#define NRF_802154_STAT_ACK_TURNAROUND_BINS      16    // !< Number of bins of the Ack turnaround histogram.
+#define NRF_802154_STAT_ACK_TURNAROUND_BIN_US    32    // !< Width of a bin of the Ack turnaround histogram, in microseconds (us).
+#define NRF_802154_STAT_CSMACA_BACKOFFS_BINS     8     // !< Number of bins of the CSMA-CA backoffs histogram.
+#define NRF_802154_STAT_CCA_CHANNELS             16    // !< Number of channels for which CCA results are counted.
+#define NRF_802154_STAT_RSSI_BINS                8     // !< Number of bins of the RSSI histogram.
+#define NRF_802154_STAT_RSSI_BIN_DBM             10    // !< Width of a bin of the RSSI histogram, in dBm.
+#define NRF_802154_STAT_RSSI_FIRST_BIN_UPPER_DBM (-90) // !< Upper bound (exclusive) of the first bin of the RSSI histogram, in dBm.
+#define NRF_802154_STAT_LQI_BINS                 8     // !< Number of bins of the LQI histogram.
+#define NRF_802154_STAT_LQI_BIN                  32    // !< Width of a bin of the LQI histogram.
+
+/**
+ * @brief Type of structure holding RSSI and LQI distributions of frames from a single source.
+ *
+ * RSSI bin 0 counts frames below @ref NRF_802154_STAT_RSSI_FIRST_BIN_UPPER_DBM. Each subsequent bin
+ * is @ref NRF_802154_STAT_RSSI_BIN_DBM wide and the last bin counts all stronger frames.
+ * LQI bin @c n counts frames with LQI in range <n * @ref NRF_802154_STAT_LQI_BIN,
+ * (n + 1) * @ref NRF_802154_STAT_LQI_BIN).
+ */
+typedef struct
+{
+    /**@brief Source address as it appears in the frame. Only @c addr_len first bytes are valid. */
+    uint8_t  addr[8];
+    /**@brief Length of the source address: 2 for a short address, 8 for an extended one, 0 if unused. */
+    uint8_t  addr_len;
+    /**@brief Number of frames received from the source. */
+    uint32_t frames;
+    /**@brief RSSI distribution. */
+    uint32_t rssi[NRF_802154_STAT_RSSI_BINS];
+    /**@brief LQI distribution. */
+    uint32_t lqi[NRF_802154_STAT_LQI_BINS];
+} nrf_802154_stat_rx_source_t;
+
+/**
+ * @brief Type of structure holding statistic histograms.
+ */
+typedef struct
+{
+    /**@brief Distribution of times between the end of a transmitted frame and the start of
+     *        the received Ack. Bin @c n counts turnarounds in range
+     *        <n * @ref NRF_802154_STAT_ACK_TURNAROUND_BIN_US, (n + 1) *
+     *        @ref NRF_802154_STAT_ACK_TURNAROUND_BIN_US) microseconds, the last bin counts all
+     *        longer turnarounds. */
+    uint32_t                    ack_turnaround[NRF_802154_STAT_ACK_TURNAROUND_BINS];
+    /**@brief Distribution of the number of backoffs of finished CSMA-CA procedures. Bin @c n
+     *        counts procedures that backed off @c n times, the last bin counts procedures that
+     *        backed off at least as many times as its index. */
+    uint32_t                    csmaca_backoffs[NRF_802154_STAT_CSMACA_BACKOFFS_BINS];
+    /**@brief Number of CCA attempts per channel, indexed from channel 11. */
+    uint32_t                    cca_attempts[NRF_802154_STAT_CCA_CHANNELS];
+    /**@brief Number of CCA attempts per channel that found the channel busy. Together with
+     *        @c cca_attempts gives the CCA busy ratio. */
+    uint32_t                    cca_busy[NRF_802154_STAT_CCA_CHANNELS];
+    /**@brief Number of times an entry of @c rx_sources was replaced by a new source. */
+    uint32_t                    rx_sources_replaced;
+    /**@brief RSSI and LQI distributions per source address. */
+    nrf_802154_stat_rx_source_t rx_sources[NRF_802154_STATS_RX_SOURCES_NUM];
+} nrf_802154_stat_histograms_t;
+
+/**
+ * @brief Type of structure holding a consistent snapshot of statistics.
+ */
+typedef struct
+{
+    /**@brief Statistic counters */
+    nrf_802154_stat_counters_t   counters;
+
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+    /**@brief Statistic histograms */
+    nrf_802154_stat_histograms_t histograms;
+#endif
+} nrf_802154_stat_snapshot_t;
+
+/**
+ * @brief Type of structure holding the link quality of a neighbor.
+ *
+ * A neighbor is identified by the address it uses in the frames. A device that uses both its
+ * short and extended address is tracked as two neighbors.
+ */
+typedef struct
+{
+    /**@brief Address as it appears in the frames. Only @c addr_len first bytes are valid. */
+    uint8_t  addr[8];
+    /**@brief Length of the address: 2 for a short address, 8 for an extended one. */
+    uint8_t  addr_len;
+    /**@brief Averaged RSSI of the frames received from the neighbor, in dBm.
+     *        Valid only if @c rx_frames is not 0. */
+    int8_t   rssi;
+    /**@brief Averaged LQI of the frames received from the neighbor.
+     *        Valid only if @c rx_frames is not 0. */
+    uint8_t  lqi;
+    /**@brief Number of frames received from the neighbor. */
+    uint32_t rx_frames;
+    /**@brief Number of frames with the Ack Request bit set transmitted to the neighbor. */
+    uint32_t tx_frames;
+    /**@brief Number of frames transmitted to the neighbor that were acknowledged. */
+    uint32_t tx_acked;
+    /**@brief Time of the last frame received from the neighbor, in microseconds (us), as
+     *        returned by @ref nrf_802154_time_get. Valid only if @c rx_frames is not 0. */
+    uint64_t last_rx_time;
+} nrf_802154_neighbor_t;
+
+/**
+ * @brief Type of structure holding an identity of the device.
+ *
+ * The device accepts the frames addressed to any of its identities and acknowledges them as the
+ * addressed identity.
+ */
+typedef struct
+{
+    /**@brief PAN ID (2 bytes, little-endian). */
+    uint8_t                     pan_id[2];
+    /**@brief Short address (2 bytes, little-endian). */
+    uint8_t                     short_addr[2];
+    /**@brief Extended address (8 bytes, little-endian). */
+    uint8_t                     extended_addr[8];
+    /**@brief Method of setting the pending bit in Acks sent as this identity.
+     *        Ignored for identity 0, which uses the method set by
+     *        @ref nrf_802154_src_addr_matching_method_set. */
+    nrf_802154_src_addr_match_t src_addr_match;
+} nrf_802154_identity_t;
+
+/**
+ * @brief Actions of the receive filter rules.
+ *
+ * Possible values:
+ * - @ref NRF_802154_FILTER_RULE_ACTION_ACCEPT,
+ * - @ref NRF_802154_FILTER_RULE_ACTION_DROP,
+ * - @ref NRF_802154_FILTER_RULE_ACTION_COUNT
+ */
+typedef uint8_t nrf_802154_filter_rule_action_t;
+
+#define NRF_802154_FILTER_RULE_ACTION_ACCEPT 0x00 // !< Accept the frame and skip the remaining rules.
+#define NRF_802154_FILTER_RULE_ACTION_DROP   0x01 // !< Drop the frame without notifying it.
+#define NRF_802154_FILTER_RULE_ACTION_COUNT  0x02 // !< Only count the frame and continue with the next rule.
+
+/**
+ * @brief Fields of the frame matched by a receive filter rule.
+ *
+ * Possible values are a bitwise OR of:
+ * - @ref NRF_802154_FILTER_RULE_FIELD_FRAME_TYPE,
+ * - @ref NRF_802154_FILTER_RULE_FIELD_SECURITY,
+ * - @ref NRF_802154_FILTER_RULE_FIELD_IE_PRESENT,
+ * - @ref NRF_802154_FILTER_RULE_FIELD_SRC_PAN_ID,
+ * - @ref NRF_802154_FILTER_RULE_FIELD_SRC_ADDR
+ */
+typedef uint8_t nrf_802154_filter_rule_fields_t;
+
+#define NRF_802154_FILTER_RULE_FIELD_FRAME_TYPE 0x01 // !< Frame type is one of the rule's frame types.
+#define NRF_802154_FILTER_RULE_FIELD_SECURITY   0x02 // !< Security Enabled bit equals the rule's value.
+#define NRF_802154_FILTER_RULE_FIELD_IE_PRESENT 0x04 // !< IE Present bit equals the rule's value.
+#define NRF_802154_FILTER_RULE_FIELD_SRC_PAN_ID 0x08 // !< Source PAN ID equals the rule's PAN ID.
+#define NRF_802154_FILTER_RULE_FIELD_SRC_ADDR   0x10 // !< Source address starts with the rule's prefix.
+
+/**
+ * @brief Type of structure holding a receive filter rule.
+ *
+ * A frame matches the rule if it matches all fields selected by @c fields. A rule with no fields
+ * selected matches all frames.
+ */
+typedef struct
+{
+    /**@brief Fields of the frame matched by the rule. */
+    nrf_802154_filter_rule_fields_t fields;
+    /**@brief Action performed on the frames matching the rule. */
+    nrf_802154_filter_rule_action_t action;
+    /**@brief Frame types matched by the rule. Bit n is set to match the frames with the
+     *        Frame Type field equal to n. */
+    uint8_t                         frame_types;
+    /**@brief Value of the Security Enabled bit matched by the rule. */
+    bool                            security_enabled;
+    /**@brief Value of the IE Present bit matched by the rule. */
+    bool                            ie_present;
+    /**@brief Source PAN ID matched by the rule (2 bytes, little-endian). For frames without
+     *        the Source PAN ID field, the Destination PAN ID field is matched. */
+    uint8_t                         src_pan_id[2];
+    /**@brief If the rule matches extended source addresses. Otherwise, it matches short ones. */
+    bool                            src_addr_extended;
+    /**@brief Source address (8 bytes or 2 bytes, little-endian) holding the prefix. */
+    uint8_t                         src_addr[8];
+    /**@brief Number of the most significant bits of the source address matched by the rule. */
+    uint8_t                         src_addr_prefix_len;
+} nrf_802154_filter_rule_t;
+
 /**
  * @brief Type holding the value of Key Id Mode of the key stored in nRF 802.15.4 Radio Driver.
  */
@@ -466,12 +654,82 @@ typedef struct
     nrf_802154_tx_channel_metadata_t     tx_channel;  // !< Information about the TX channel to be used.
 } nrf_802154_transmit_csma_ca_metadata_t;
 
+/**
+ * @brief Type holding the CSMA-CA backoff policy.
+ *
+ * Possible values:
+ * - @ref NRF_802154_CSMA_CA_BACKOFF_POLICY_IEEE
+ * - @ref NRF_802154_CSMA_CA_BACKOFF_POLICY_ADAPTIVE
+ * - @ref NRF_802154_CSMA_CA_BACKOFF_POLICY_PRIORITY
+ * - @ref NRF_802154_CSMA_CA_BACKOFF_POLICY_DESTINATION
+ * - @ref NRF_802154_CSMA_CA_BACKOFF_POLICY_CUSTOM
+ */
+typedef uint8_t nrf_802154_csma_ca_backoff_policy_id_t;
+
+#define NRF_802154_CSMA_CA_BACKOFF_POLICY_IEEE        0x00 // !< Backoff exponent progression and random backoff as specified by IEEE Std. 802.15.4.
+#define NRF_802154_CSMA_CA_BACKOFF_POLICY_ADAPTIVE    0x01 // !< Initial backoff exponent follows the ratio of busy CCA attempts.
+#define NRF_802154_CSMA_CA_BACKOFF_POLICY_PRIORITY    0x02 // !< Backoff exponent depends on the priority of the frame type.
+#define NRF_802154_CSMA_CA_BACKOFF_POLICY_DESTINATION 0x03 // !< Initial backoff exponent follows the ratio of busy CCA attempts per destination address.
+#define NRF_802154_CSMA_CA_BACKOFF_POLICY_CUSTOM      0xFF // !< Policy provided by the application.
+
+/**
+ * @brief Structure with the state of the CSMA-CA procedure passed to the backoff policy.
+ */
+typedef struct
+{
+    const uint8_t * p_frame;      // !< Pointer to a buffer containing PHR and PSDU of the frame being transmitted.
+    uint8_t         min_be;       // !< The minimum value of the backoff exponent (macMinBe).
+    uint8_t         max_be;       // !< The maximum value of the backoff exponent (macMaxBe).
+    uint8_t         max_backoffs; // !< The maximum number of backoffs (macMaxCsmaBackoffs).
+    uint8_t         nb;           // !< Number of times the procedure backed off because of busy channel (NB).
+    uint8_t         be;           // !< Backoff exponent (BE). Set and updated by the policy.
+} nrf_802154_csma_ca_backoff_state_t;
+
+/**
+ * @brief Structure with the functions of a CSMA-CA backoff policy.
+ *
+ * The CSMA-CA procedure keeps counting the number of backoffs and fails when it exceeds
+ * macMaxCsmaBackoffs. The policy decides how long to wait before each CCA attempt.
+ * All functions are called with @c p_context of the policy.
+ */
+typedef struct
+{
+    /**@brief Called when the procedure starts. Sets the initial backoff exponent. */
+    void (* start)(void * p_context, nrf_802154_csma_ca_backoff_state_t * p_state);
+
+    /**@brief Returns the number of unit backoff periods to wait before the next CCA attempt. */
+    uint16_t (* periods_get)(void * p_context, const nrf_802154_csma_ca_backoff_state_t * p_state);
+
+    /**@brief Called when a CCA attempt found the channel busy and the procedure backs off again.
+     *        @c nb is already incremented. Updates the backoff exponent. */
+    void (* busy)(void * p_context, nrf_802154_csma_ca_backoff_state_t * p_state);
+
+    /**@brief Called when the procedure ends, either because a CCA attempt found the channel idle
+     *        or because the number of backoffs was exceeded. Can be NULL. */
+    void (* finished)(void                                     * p_context,
+                      const nrf_802154_csma_ca_backoff_state_t * p_state,
+                      bool                                       channel_idle);
+
+    void * p_context; // !< Context passed to the functions of the policy.
+} nrf_802154_csma_ca_backoff_policy_t;
+
+/**
+ * @brief Structure with the retransmission statistics of a frame.
+ */
+typedef struct
+{
+    uint8_t attempts;     // !< Number of transmission attempts, including the first one.
+    uint8_t busy_channel; // !< Number of attempts that failed because the channel was busy.
+    uint8_t no_ack;       // !< Number of attempts that failed because of a missing or invalid ACK.
+} nrf_802154_transmit_retries_t;
+
 /**
  * @brief Structure that holds transmission result metadata.
  */
 typedef struct
 {
     nrf_802154_transmitted_frame_props_t frame_props; // !< Properties of the returned frame.
+    nrf_802154_transmit_retries_t        retries;     // !< Retransmission statistics of the frame. All fields are 0 unless the frame was transmitted with @ref NRF_802154_RETRANSMISSION_ENABLED set.
 
     union
     {
@@ -498,12 +756,162 @@ typedef void (* nrf_802154_transmit_failed_notification_t)(
     nrf_802154_tx_error_t                       error,
     const nrf_802154_transmit_done_metadata_t * p_meta);
 
+/**
+ * @brief Structure with transmit request metadata for a frame added to the transmit queue.
+ */
+typedef struct
+{
+    nrf_802154_transmitted_frame_props_t frame_props; // !< Properties of the frame to be transmitted.
+    bool                                 csma_ca;     // !< If the frame is to be transmitted with the CSMA-CA procedure.
+    bool                                 cca;         // !< If the driver is to perform a CCA procedure before transmission. Ignored if @ref csma_ca equals @c true.
+    uint8_t                              max_retries; // !< Maximum number of retransmissions after a busy channel, a missing ACK or an invalid ACK.
+    nrf_802154_tx_power_metadata_t       tx_power;    // !< Information about the TX power to be used.
+    nrf_802154_tx_channel_metadata_t     tx_channel;  // !< Information about the TX channel to be used.
+} nrf_802154_tx_queue_metadata_t;
+
+/**
+ * @brief Structure describing a frame to be added to the transmit queue.
+ */
+typedef struct
+{
+    uint8_t                      * p_data;   // !< Pointer to a buffer that contains PHR and PSDU of the frame to be transmitted.
+    nrf_802154_tx_queue_metadata_t metadata; // !< Transmit request metadata of the frame.
+} nrf_802154_tx_queue_entry_t;
+
+/**
+ * @brief Structure with the transmission result of a frame from the transmit queue.
+ */
+typedef struct
+{
+    uint8_t                            * p_data;        // !< Pointer to a buffer that contains PHR and PSDU of the frame.
+    nrf_802154_tx_error_t                error;         // !< Result of the transmission, @ref NRF_802154_TX_ERROR_NONE if the frame was transmitted.
+    nrf_802154_transmitted_frame_props_t frame_props;   // !< Properties of the returned frame.
+    uint8_t                              attempts;      // !< Number of transmission attempts.
+    bool                                 frame_pending; // !< If the received ACK had the Frame Pending bit set.
+} nrf_802154_tx_queue_result_t;
+
+/**
+ * @brief Policy of restarting the CSMA-CA procedure for retransmissions.
+ *
+ * Possible values:
+ * - @ref NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ACK_FAILURE,
+ * - @ref NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ALWAYS,
+ * - @ref NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_NEVER
+ */
+typedef uint8_t nrf_802154_retransmission_csma_ca_restart_t;
+
+#define NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ACK_FAILURE 0x00 // !< A frame that failed because of a missing or invalid ACK is retransmitted with a new CSMA-CA procedure. A channel access failure is notified.
+#define NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ALWAYS      0x01 // !< As @ref NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ACK_FAILURE, and a frame that failed because of a channel access failure is retransmitted with a new CSMA-CA procedure too.
+#define NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_NEVER       0x02 // !< A frame that failed because of a missing or invalid ACK is retransmitted after a single CCA, without random backoff. A channel access failure is notified.
+
+/**
+ * @brief Handling of the Frame Pending bit of the received ACK.
+ *
+ * Possible values:
+ * - @ref NRF_802154_RETRANSMISSION_FRAME_PENDING_DATA_REQ,
+ * - @ref NRF_802154_RETRANSMISSION_FRAME_PENDING_ANY
+ */
+typedef uint8_t nrf_802154_retransmission_frame_pending_t;
+
+#define NRF_802154_RETRANSMISSION_FRAME_PENDING_DATA_REQ 0x00 // !< The driver stays in the receive state after an ACK with the Frame Pending bit set only if the transmitted frame is a MAC Data Request command.
+#define NRF_802154_RETRANSMISSION_FRAME_PENDING_ANY      0x01 // !< The driver stays in the receive state after an ACK with the Frame Pending bit set, whatever the transmitted frame is.
+
+/**
+ * @brief Structure with the settings of the driver-side retransmissions.
+ */
+typedef struct
+{
+    uint8_t                                     max_frame_retries; // !< Maximum number of retransmissions of a frame. 0 disables the retransmissions.
+    nrf_802154_retransmission_csma_ca_restart_t csma_ca_restart;   // !< Policy of restarting the CSMA-CA procedure for retransmissions.
+    nrf_802154_retransmission_frame_pending_t   frame_pending;     // !< Handling of the Frame Pending bit of the received ACK.
+} nrf_802154_retransmission_config_t;
+
+/**
+ * @brief Function pointer used for notifying about the completion of an asynchronous request.
+ *
+ * @param[in]  result     Value that the synchronous version of the request would have returned.
+ * @param[in]  p_context  Context passed to the asynchronous request.
+ */
+typedef void (* nrf_802154_async_done_t)(bool result, void * p_context);
+
+/**
+ * @brief Structure with parameters of a periodic reception schedule.
+ */
+typedef struct
+{
+    uint64_t rx_time;                                       // !< Start time of the first window, in microseconds (us) of the SL Timer. It sets the phase of the schedule.
+    uint32_t period;                                        // !< Distance between the starts of consecutive windows, in microseconds (us).
+    uint32_t window;                                        // !< Length of each window (counted from its start), in microseconds (us).
+    uint8_t  channels[NRF_802154_PERIODIC_RX_CHANNELS_MAX]; // !< Channel hopping sequence. Window n uses channels[n % channels_len].
+    uint8_t  channels_len;                                  // !< Number of valid entries in @ref channels.
+} nrf_802154_periodic_rx_params_t;
+
+/**
+ * @brief Structure with statistics of a periodic reception schedule.
+ *
+ * Each window that has passed is counted exactly once: as completed, missed or late.
+ */
+typedef struct
+{
+    uint32_t armed;     // !< Number of windows accepted by the radio scheduler.
+    uint32_t completed; // !< Number of windows that ended with their timeout.
+    uint32_t missed;    // !< Number of windows that were rejected, denied or aborted.
+    uint32_t late;      // !< Number of windows skipped because they could not be requested in time.
+} nrf_802154_periodic_rx_stats_t;
+
+/**
+ * @brief Number of channels that can be measured by the energy detection sweep.
+ */
+#define NRF_802154_ED_SWEEP_CHANNELS_NUM 16U
+
+/**
+ * @brief Mask of the channels that can be measured by the energy detection sweep.
+ *
+ * Bit @c n of a channel mask selects channel @c n.
+ */
+#define NRF_802154_ED_SWEEP_CHANNEL_MASK 0x07fff800UL
+
+/**
+ * @brief Parameters of the energy detection sweep.
+ */
+typedef struct
+{
+    uint32_t channel_mask; // !< Channels to measure, bit @c n selects channel @c n.
+    uint32_t dwell_us;     // !< Time of a single measurement of a channel [us].
+    uint16_t iterations;   // !< Number of times every channel is measured.
+} nrf_802154_ed_sweep_params_t;
+
+/**
+ * @brief Statistics of a single channel measured by the energy detection sweep.
+ *
+ * The statistics are calculated from the samples of the channel. A sample is the peak energy
+ * measured during @ref NRF_802154_ED_SWEEP_SAMPLE_TIME_US.
+ */
+typedef struct
+{
+    uint16_t samples;                                        // !< Number of samples.
+    int8_t   max_dbm;                                        // !< Highest sample in dBm.
+    int8_t   mean_dbm;                                       // !< Mean of the samples in dBm.
+    int8_t   percentile_dbm;                                 // !< @ref NRF_802154_ED_SWEEP_PERCENTILE percentile of the samples in dBm, rounded up to the upper edge of its histogram bin.
+    uint16_t histogram[NRF_802154_ED_SWEEP_HISTOGRAM_BINS]; // !< Number of samples in each bin of @ref NRF_802154_ED_SWEEP_HISTOGRAM_BIN_WIDTH_DBM dB, starting at @ref NRF_802154_ED_SWEEP_HISTOGRAM_MIN_DBM.
+} nrf_802154_ed_sweep_channel_result_t;
+
+/**
+ * @brief Result of the energy detection sweep.
+ */
+typedef struct
+{
+    uint32_t                             channel_mask;                                // !< Channels measured by the sweep.
+    nrf_802154_ed_sweep_channel_result_t channels[NRF_802154_ED_SWEEP_CHANNELS_NUM]; // !< Statistics of the channels, indexed by the channel number minus 11.
+} nrf_802154_ed_sweep_result_t;
+
 /**
  * @brief Structure that holds results of energy detection procedure.
  */
 typedef struct
 {
-    int8_t ed_dbm; // !< Maximum detected ED in dBm.
+    int8_t                               ed_dbm;  // !< Maximum detected ED in dBm.
+    const nrf_802154_ed_sweep_result_t * p_sweep; // !< Result of the energy detection sweep, or NULL if the procedure was not a sweep.
 } nrf_802154_energy_detected_t;
 
 /**
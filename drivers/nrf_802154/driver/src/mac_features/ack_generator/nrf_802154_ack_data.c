@@ -44,9 +44,11 @@
 #include "nrf_802154_assert.h"
 #include <string.h>
 
+#include "mac_features/nrf_802154_filter.h"
 #include "mac_features/nrf_802154_frame_parser.h"
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "nrf_802154_pib.h"
 
 /// Maximum number of Short Addresses of nodes for which there is ACK data to set.
 #define NUM_SHORT_ADDRESSES    NRF_802154_PENDING_SHORT_ADDRESSES
@@ -97,6 +99,7 @@ typedef struct
 static pending_bit_arrays_t        m_pending_bit;
 static ie_arrays_t                 m_ie;
 static nrf_802154_src_addr_match_t m_src_matching_method;
+static uint32_t                    m_ie_generation; ///< Incremented on every change of the IE data.
 
 /***************************************************************************************************
  * @section Array handling helper functions
@@ -658,6 +661,11 @@ bool nrf_802154_ack_data_for_addr_set(const uint8_t       * p_addr,
 {
     uint32_t location = 0;
 
+    if (data_type == NRF_802154_ACK_DATA_IE)
+    {
+        m_ie_generation++;
+    }
+
     if (addr_index_find(p_addr, &location, data_type, extended) ||
         addr_add(p_addr, location, data_type, extended))
     {
@@ -680,6 +688,11 @@ bool nrf_802154_ack_data_for_addr_clear(const uint8_t       * p_addr,
 {
     uint32_t location = 0;
 
+    if (data_type == NRF_802154_ACK_DATA_IE)
+    {
+        m_ie_generation++;
+    }
+
     if (addr_index_find(p_addr, &location, data_type, extended))
     {
         return addr_remove(location, data_type, extended);
@@ -714,6 +727,7 @@ void nrf_802154_ack_data_reset(bool extended, nrf_802154_ack_data_t data_type)
             {
                 m_ie.num_of_short_data = 0;
             }
+            m_ie_generation++;
             break;
 
         default:
@@ -740,9 +754,25 @@ void nrf_802154_ack_data_src_addr_matching_method_set(nrf_802154_src_addr_match_
 bool nrf_802154_ack_data_pending_bit_should_be_set(
     const nrf_802154_frame_parser_data_t * p_frame_data)
 {
-    bool ret;
+    bool                        ret;
+    nrf_802154_src_addr_match_t src_matching_method = m_src_matching_method;
+
+#if NRF_802154_IDENTITIES_NUM > 1
+    uint8_t identity = nrf_802154_filter_frame_identity_get();
 
-    switch (m_src_matching_method)
+    if (identity != 0U)
+    {
+        const nrf_802154_identity_t * p_identity = nrf_802154_pib_identity_get(identity);
+
+        // The identity might have been removed after the frame was filtered.
+        if (p_identity != NULL)
+        {
+            src_matching_method = p_identity->src_addr_match;
+        }
+    }
+#endif
+
+    switch (src_matching_method)
     {
         case NRF_802154_SRC_ADDR_MATCH_THREAD:
             ret = addr_match_thread(p_frame_data);
@@ -794,3 +824,8 @@ const uint8_t * nrf_802154_ack_data_ie_get(const uint8_t * p_src_addr,
         return NULL;
     }
 }
+
+uint32_t nrf_802154_ack_data_ie_generation_get(void)
+{
+    return m_ie_generation;
+}
@@ -124,6 +124,9 @@ void nrf_802154_ack_data_src_addr_matching_method_set(nrf_802154_src_addr_match_
 /**
  * @brief Checks if a pending bit is to be set in the ACK frame sent in response to a given frame.
  *
+ * If the frame is addressed to an identity other than identity 0, the source matching method
+ * of that identity is used.
+ *
  * @param[in]  p_frame_data  Pointer to the frame parser data for which the ACK frame is being prepared.
  *
  * @retval true   Pending bit is to be set.
@@ -145,4 +148,14 @@ const uint8_t * nrf_802154_ack_data_ie_get(const uint8_t * p_src_addr,
                                            bool            src_addr_ext,
                                            uint8_t       * p_ie_length);
 
+/**
+ * @brief Gets the generation of the IE data stored in the list.
+ *
+ * The generation changes whenever the IE data of any address is set or cleared. It allows
+ * caching data derived from @ref nrf_802154_ack_data_ie_get without tracking individual addresses.
+ *
+ * @returns  Current generation of the IE data.
+ */
+uint32_t nrf_802154_ack_data_ie_generation_get(void);
+
 #endif // NRF_802154_ACK_DATA_H
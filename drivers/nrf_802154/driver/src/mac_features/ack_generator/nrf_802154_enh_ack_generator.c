@@ -43,6 +43,7 @@
 #include "nrf_802154_assert.h"
 #include <string.h>
 
+#include "mac_features/nrf_802154_filter.h"
 #include "mac_features/nrf_802154_frame_parser.h"
 #include "mac_features/nrf_802154_ie_writer.h"
 #include "mac_features/nrf_802154_security_pib.h"
@@ -68,6 +69,40 @@ static uint8_t                        m_ack[ENH_ACK_MAX_SIZE + PHR_SIZE];
 static nrf_802154_frame_parser_data_t m_ack_data;
 static const uint8_t                * mp_ie_data;
 static uint8_t                        m_ie_data_len;
+static uint32_t                       m_ie_generation;
+
+#if NRF_802154_ENH_ACK_TEMPLATES_NUM > 0
+
+/**
+ * @brief Enh-Ack prepared for a peer, reused for subsequent frames with the same header layout.
+ *
+ * The Ack is stored complete, with the Frame Pending bit cleared. The fields that change from
+ * frame to frame (sequence number, destination PAN ID, auxiliary security header fields and the
+ * fields written by the IE writer) are updated in the copy using the stored offsets.
+ */
+typedef struct
+{
+    uint8_t                        src_addr[EXTENDED_ADDRESS_SIZE];   ///< Source address of the frames the template responds to.
+    uint8_t                        src_addr_size;                     ///< Size of the source address, 0 for an unused template.
+    uint8_t                        fcf_key[FCF_SIZE];                 ///< Frame Control field bits of the frame that shape the Ack.
+    uint8_t                        sec_ctrl;                          ///< Security Control field of the frame, if present.
+    uint32_t                       ie_generation;                     ///< Generation of the Ack IE data used for the template.
+    uint32_t                       last_used;                         ///< Value of the use counter at the latest use.
+    nrf_802154_frame_parser_data_t ack_data;                          ///< Parser data of the Ack.
+#if NRF_802154_IE_WRITER_ENABLED
+    nrf_802154_ie_writer_layout_t  ie_layout;                         ///< Layout of the fields written by the IE writer.
+#endif
+    uint8_t                        ack[ENH_ACK_MAX_SIZE + PHR_SIZE];  ///< PHR and PSDU of the Ack.
+} ack_template_t;
+
+static ack_template_t   m_templates[NRF_802154_ENH_ACK_TEMPLATES_NUM];
+static uint32_t         m_templates_use_counter;
+static ack_template_t * mp_template;              ///< Template used for the Ack being generated.
+static ack_template_t * mp_template_store;        ///< Template to be replaced with the Ack being generated.
+static const uint8_t  * mp_template_src_addr;     ///< Source address of the frame being acknowledged.
+static uint8_t          m_template_src_addr_size; ///< Size of the source address of the frame.
+
+#endif // NRF_802154_ENH_ACK_TEMPLATES_NUM > 0
 
 static void ack_state_set(ack_state_t state_to_set)
 {
@@ -199,6 +234,29 @@ static uint8_t frame_control_set(const nrf_802154_frame_parser_data_t * p_frame_
  * @section Addressing fields functions
  **************************************************************************************************/
 
+static const uint8_t * destination_panid_get(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    const uint8_t * p_frame_src_panid = nrf_802154_frame_parser_src_panid_get(p_frame_data);
+    const uint8_t * p_frame_dst_panid = nrf_802154_frame_parser_dst_panid_get(p_frame_data);
+
+    if (p_frame_src_panid != NULL)
+    {
+        return p_frame_src_panid;
+    }
+    else if (p_frame_dst_panid != NULL)
+    {
+        return p_frame_dst_panid;
+    }
+    else
+    {
+        // The frame is addressed to the PAN of the identity that accepted it.
+        const nrf_802154_identity_t * p_identity =
+            nrf_802154_pib_identity_get(nrf_802154_filter_frame_identity_get());
+
+        return (p_identity != NULL) ? p_identity->pan_id : nrf_802154_pib_pan_id_get();
+    }
+}
+
 static uint8_t destination_set(const nrf_802154_frame_parser_data_t * p_frame_data,
                                nrf_802154_frame_parser_data_t       * p_ack_data)
 {
@@ -206,31 +264,14 @@ static uint8_t destination_set(const nrf_802154_frame_parser_data_t * p_frame_da
     uint8_t * p_ack_dst_panid = (uint8_t *)nrf_802154_frame_parser_dst_panid_get(p_ack_data);
     uint8_t * p_ack_dst_addr  = (uint8_t *)nrf_802154_frame_parser_dst_addr_get(p_ack_data);
 
-    const uint8_t * p_frame_src_panid = nrf_802154_frame_parser_src_panid_get(p_frame_data);
-    const uint8_t * p_frame_dst_panid = nrf_802154_frame_parser_dst_panid_get(p_frame_data);
-    const uint8_t * p_frame_src_addr  = nrf_802154_frame_parser_src_addr_get(p_frame_data);
+    const uint8_t * p_frame_src_addr = nrf_802154_frame_parser_src_addr_get(p_frame_data);
 
     uint8_t src_addr_size = nrf_802154_frame_parser_src_addr_size_get(p_frame_data);
 
     // Fill the Ack destination PAN ID field.
     if (p_ack_dst_panid != NULL)
     {
-        const uint8_t * p_dst_panid;
-
-        if (p_frame_src_panid != NULL)
-        {
-            p_dst_panid = p_frame_src_panid;
-        }
-        else if (p_frame_dst_panid != NULL)
-        {
-            p_dst_panid = p_frame_dst_panid;
-        }
-        else
-        {
-            p_dst_panid = nrf_802154_pib_pan_id_get();
-        }
-
-        memcpy(p_ack_dst_panid, p_dst_panid, PAN_ID_SIZE);
+        memcpy(p_ack_dst_panid, destination_panid_get(p_frame_data), PAN_ID_SIZE);
         bytes_written += PAN_ID_SIZE;
     }
 
@@ -330,6 +371,43 @@ static bool frame_counter_set(nrf_802154_frame_parser_data_t * p_ack_data,
     return true;
 }
 
+static bool security_fields_set(const nrf_802154_frame_parser_data_t * p_frame_data,
+                                nrf_802154_frame_parser_data_t       * p_ack_data,
+                                uint8_t                              * p_bytes_written)
+{
+    bool            security_fields_prepared;
+    uint8_t         bytes_written    = 0U;
+    uint8_t         fc_bytes_written = 0U;
+    uint8_t       * ack_sec_ctrl     = (uint8_t *)nrf_802154_frame_parser_addressing_end_get(
+        p_ack_data);
+    const uint8_t * frame_sec_ctrl   = nrf_802154_frame_parser_sec_ctrl_get(p_frame_data);
+
+    if (nrf_802154_frame_parser_sec_ctrl_sec_lvl_get(p_frame_data) == SECURITY_LEVEL_NONE)
+    {
+        // The security level value is zero, therefore no auxiliary security header processing
+        // is performed according to 802.15.4 specification. This also applies to the frame counter,
+        // the value of which is left as it is in the message to which the ACK responds.
+        // The entire auxiliary security header content is simply copied to ACK.
+        uint8_t sec_hdr_size = security_header_size(p_frame_data) - SECURITY_CONTROL_SIZE;
+
+        memcpy(ack_sec_ctrl + SECURITY_CONTROL_SIZE,
+               frame_sec_ctrl + SECURITY_CONTROL_SIZE,
+               sec_hdr_size);
+        bytes_written           += sec_hdr_size;
+        security_fields_prepared = true;
+    }
+    else
+    {
+        bytes_written           += security_key_id_set(p_frame_data, p_ack_data);
+        security_fields_prepared = frame_counter_set(p_ack_data, &fc_bytes_written);
+        bytes_written           += fc_bytes_written;
+    }
+
+    *p_bytes_written = bytes_written;
+
+    return security_fields_prepared;
+}
+
 static bool security_header_set(const nrf_802154_frame_parser_data_t * p_frame_data,
                                 nrf_802154_frame_parser_data_t       * p_ack_data,
                                 uint8_t                              * p_bytes_written)
@@ -337,8 +415,8 @@ static bool security_header_set(const nrf_802154_frame_parser_data_t * p_frame_d
     bool security_header_prepared;
     bool result;
 
-    uint8_t bytes_written       = 0U;
-    uint8_t fc_bytes_written    = 0U;
+    uint8_t bytes_written        = 0U;
+    uint8_t fields_bytes_written = 0U;
     uint8_t ack_sec_ctrl_offset = nrf_802154_frame_parser_addressing_end_offset_get(
         p_ack_data);
     uint8_t * ack_sec_ctrl = (uint8_t *)nrf_802154_frame_parser_addressing_end_get(
@@ -362,26 +440,8 @@ static bool security_header_set(const nrf_802154_frame_parser_data_t * p_frame_d
     NRF_802154_ASSERT(result);
     (void)result;
 
-    if (nrf_802154_frame_parser_sec_ctrl_sec_lvl_get(p_frame_data) == SECURITY_LEVEL_NONE)
-    {
-        // The security level value is zero, therefore no auxiliary security header processing
-        // is performed according to 802.15.4 specification. This also applies to the frame counter,
-        // the value of which is left as it is in the message to which the ACK responds.
-        // The entire auxiliary security header content is simply copied to ACK.
-        uint8_t sec_hdr_size = security_header_size(p_frame_data) - SECURITY_CONTROL_SIZE;
-
-        memcpy(ack_sec_ctrl + SECURITY_CONTROL_SIZE,
-               frame_sec_ctrl + SECURITY_CONTROL_SIZE,
-               sec_hdr_size);
-        bytes_written           += sec_hdr_size;
-        security_header_prepared = true;
-    }
-    else
-    {
-        bytes_written           += security_key_id_set(p_frame_data, p_ack_data);
-        security_header_prepared = frame_counter_set(p_ack_data, &fc_bytes_written);
-        bytes_written           += fc_bytes_written;
-    }
+    security_header_prepared = security_fields_set(p_frame_data, p_ack_data, &fields_bytes_written);
+    bytes_written           += fields_bytes_written;
 
     bytes_written   += nrf_802154_frame_parser_mic_size_get(p_ack_data);
     *p_bytes_written = bytes_written;
@@ -500,7 +560,8 @@ static void addr_end_process(const nrf_802154_frame_parser_data_t * p_frame_data
 
     // Having the frame's source address, presence of IEs can be determined.
     // coverity[unchecked_value]
-    mp_ie_data = nrf_802154_ack_data_ie_get(
+    m_ie_generation = nrf_802154_ack_data_ie_generation_get();
+    mp_ie_data      = nrf_802154_ack_data_ie_get(
         nrf_802154_frame_parser_src_addr_get(p_frame_data),
         nrf_802154_frame_parser_src_addr_is_extended(p_frame_data),
         &m_ie_data_len);
@@ -559,6 +620,250 @@ static bool encryption_process(void)
     return encryption_prepare(&m_ack_data);
 }
 
+/***************************************************************************************************
+ * @section Enhanced ACK templates
+ **************************************************************************************************/
+
+#if NRF_802154_ENH_ACK_TEMPLATES_NUM > 0
+
+/**
+ * @brief Gets the bits of the Frame Control field of a frame that determine the Ack header.
+ */
+static void template_fcf_key_get(const nrf_802154_frame_parser_data_t * p_frame_data,
+                                 uint8_t                              * p_fcf_key)
+{
+    p_fcf_key[0] = p_frame_data->p_frame[SECURITY_ENABLED_OFFSET] &
+                   (SECURITY_ENABLED_BIT | PAN_ID_COMPR_MASK);
+    p_fcf_key[1] = p_frame_data->p_frame[DSN_SUPPRESS_OFFSET] &
+                   (DSN_SUPPRESS_BIT | SRC_ADDR_TYPE_MASK);
+}
+
+/**
+ * @brief Finds the template of the Ack for a frame or a template to be replaced.
+ *
+ * @param[in]   p_src_addr     Pointer to the source address of the frame to be acknowledged.
+ * @param[in]   src_addr_size  Size of the source address.
+ * @param[in]   p_fcf_key      Frame Control field bits of the frame that shape the Ack.
+ * @param[out]  p_found        Set to true if the returned template matches the frame.
+ *
+ * @returns  Matching template or, if none matches, the template to be replaced.
+ */
+static ack_template_t * template_find(const uint8_t * p_src_addr,
+                                      uint8_t         src_addr_size,
+                                      const uint8_t * p_fcf_key,
+                                      bool          * p_found)
+{
+    ack_template_t * p_victim = &m_templates[0];
+
+    for (uint32_t i = 0U; i < NRF_802154_ENH_ACK_TEMPLATES_NUM; i++)
+    {
+        ack_template_t * p_template = &m_templates[i];
+
+        // Comparing the first byte of the address first rejects most templates cheaply.
+        if ((p_template->src_addr_size == src_addr_size) &&
+            (p_template->src_addr[0] == p_src_addr[0]) &&
+            (p_template->fcf_key[0] == p_fcf_key[0]) &&
+            (p_template->fcf_key[1] == p_fcf_key[1]) &&
+            (memcmp(p_template->src_addr, p_src_addr, src_addr_size) == 0))
+        {
+            *p_found = true;
+            return p_template;
+        }
+
+        if ((p_victim->src_addr_size != 0U) &&
+            ((p_template->src_addr_size == 0U) || (p_template->last_used < p_victim->last_used)))
+        {
+            p_victim = p_template;
+        }
+    }
+
+    *p_found = false;
+    return p_victim;
+}
+
+/**
+ * @brief Copies the Ack from a template matching the frame, if there is one.
+ *
+ * The copied Ack is complete except for the auxiliary security header fields and the IE writer
+ * arming, which require the auxiliary security header of the frame.
+ *
+ * @retval true   The Ack has been copied from a template.
+ * @retval false  There is no matching template.
+ */
+static bool template_apply(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    const uint8_t  * p_src_addr = nrf_802154_frame_parser_src_addr_get(p_frame_data);
+    ack_template_t * p_template;
+    uint8_t        * p_ack_dst_panid;
+    uint8_t          fcf_key[FCF_SIZE];
+    bool             found;
+
+    if (p_src_addr == NULL)
+    {
+        return false;
+    }
+
+    template_fcf_key_get(p_frame_data, fcf_key);
+
+    p_template = template_find(p_src_addr,
+                               nrf_802154_frame_parser_src_addr_size_get(p_frame_data),
+                               fcf_key,
+                               &found);
+
+    if (!found || (p_template->ie_generation != nrf_802154_ack_data_ie_generation_get()))
+    {
+        mp_template_store = p_template;
+        return false;
+    }
+
+    p_template->last_used = ++m_templates_use_counter;
+    mp_template           = p_template;
+
+    memcpy(m_ack, p_template->ack, p_template->ack[PHR_OFFSET] + PHR_SIZE);
+    m_ack_data             = p_template->ack_data;
+    m_ack_data.p_frame     = m_ack;
+    m_ack_data.parse_level = PARSE_LEVEL_ADDRESSING_END;
+
+    // The destination address is the source address of the frame, which is a part of the key.
+    p_ack_dst_panid = (uint8_t *)nrf_802154_frame_parser_dst_panid_get(&m_ack_data);
+
+    if (p_ack_dst_panid != NULL)
+    {
+        memcpy(p_ack_dst_panid, destination_panid_get(p_frame_data), PAN_ID_SIZE);
+    }
+
+    (void)sequence_number_set(p_frame_data);
+
+    return true;
+}
+
+/**
+ * @brief Checks if the template in use matches the auxiliary security header of the frame.
+ *
+ * If the frame is secured differently than the frame the template was created for, the template
+ * is abandoned and the Ack header is built from scratch up to the addressing fields.
+ *
+ * @retval true   The template in use can be completed for the frame.
+ * @retval false  No template is in use.
+ */
+static bool template_validate(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    const uint8_t * p_sec_ctrl = nrf_802154_frame_parser_sec_ctrl_get(p_frame_data);
+
+    if (mp_template == NULL)
+    {
+        return false;
+    }
+
+    if ((p_sec_ctrl == NULL) || (*p_sec_ctrl == mp_template->sec_ctrl))
+    {
+        return true;
+    }
+
+    mp_template_store = mp_template;
+    mp_template       = NULL;
+
+    memset(m_ack, 0U, sizeof(m_ack));
+    (void)nrf_802154_frame_parser_data_init(m_ack, 0U, PARSE_LEVEL_NONE, &m_ack_data);
+
+    fcf_process(p_frame_data);
+    addr_end_process(p_frame_data);
+
+    return false;
+}
+
+/**
+ * @brief Completes the Ack copied from the template with the auxiliary security header fields
+ *        and arms the IE writer.
+ *
+ * @retval true   The Ack is complete except for the Frame Pending bit.
+ * @retval false  The auxiliary security header could not be set.
+ */
+static bool template_aux_sec_hdr_process(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    uint8_t bytes_written;
+
+    m_ack_data.parse_level = mp_template->ack_data.parse_level;
+
+    if ((nrf_802154_frame_parser_sec_ctrl_get(p_frame_data) != NULL) &&
+        !security_fields_set(p_frame_data, &m_ack_data, &bytes_written))
+    {
+        return false;
+    }
+
+#if NRF_802154_IE_WRITER_ENABLED
+    nrf_802154_ie_writer_layout_apply(m_ack, &mp_template->ie_layout);
+#endif
+
+    return true;
+}
+
+/**
+ * @brief Records the properties of the frame the Ack is being built for, to store the Ack
+ *        as a template once it is transmitted.
+ *
+ * The template is unusable until @ref nrf_802154_enh_ack_generator_tx_ack_started_hook copies
+ * the Ack into it, so that the copying does not delay the Ack preparation.
+ */
+static void template_store_prepare(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    const uint8_t  * p_sec_ctrl = nrf_802154_frame_parser_sec_ctrl_get(p_frame_data);
+    ack_template_t * p_template = mp_template_store;
+
+    if (p_template == NULL)
+    {
+        return;
+    }
+
+    // The frame stays in the receive buffer until its Ack is transmitted.
+    mp_template_src_addr     = nrf_802154_frame_parser_src_addr_get(p_frame_data);
+    m_template_src_addr_size = nrf_802154_frame_parser_src_addr_size_get(p_frame_data);
+
+    p_template->src_addr_size = 0U;
+    p_template->sec_ctrl      = (p_sec_ctrl != NULL) ? *p_sec_ctrl : 0U;
+    p_template->ie_generation = m_ie_generation;
+
+    template_fcf_key_get(p_frame_data, p_template->fcf_key);
+
+#if NRF_802154_IE_WRITER_ENABLED
+    nrf_802154_ie_writer_layout_get(m_ack, &p_template->ie_layout);
+#endif
+}
+
+#else // NRF_802154_ENH_ACK_TEMPLATES_NUM > 0
+
+static bool template_apply(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    // Intentionally empty
+    (void)p_frame_data;
+
+    return false;
+}
+
+static bool template_validate(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    // Intentionally empty
+    (void)p_frame_data;
+
+    return false;
+}
+
+static bool template_aux_sec_hdr_process(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    // Intentionally empty
+    (void)p_frame_data;
+
+    return false;
+}
+
+static void template_store_prepare(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    // Intentionally empty
+    (void)p_frame_data;
+}
+
+#endif // NRF_802154_ENH_ACK_TEMPLATES_NUM > 0
+
 static uint8_t * ack_process(
     const nrf_802154_frame_parser_data_t * p_frame_data,
     bool                                 * p_processing_done)
@@ -570,6 +875,14 @@ static uint8_t * ack_process(
 
     *p_processing_done = false;
 
+    // With the source address known, the Ack header may be copied from a template at once.
+    if ((frame_parse_level >= PARSE_LEVEL_ADDRESSING_END) &&
+        (ack_parse_level < PARSE_LEVEL_ADDRESSING_END) &&
+        template_apply(p_frame_data))
+    {
+        ack_parse_level = PARSE_LEVEL_ADDRESSING_END;
+    }
+
     if ((frame_parse_level >= PARSE_LEVEL_FCF_OFFSETS) &&
         (ack_parse_level < PARSE_LEVEL_FCF_OFFSETS))
     {
@@ -585,14 +898,29 @@ static uint8_t * ack_process(
     if ((frame_parse_level >= PARSE_LEVEL_AUX_SEC_HDR_END) &&
         (ack_parse_level < PARSE_LEVEL_AUX_SEC_HDR_END))
     {
-        if (!aux_sec_hdr_process(p_frame_data))
+        bool aux_sec_hdr_set;
+
+        if (template_validate(p_frame_data))
+        {
+            aux_sec_hdr_set = template_aux_sec_hdr_process(p_frame_data);
+        }
+        else
+        {
+            aux_sec_hdr_set = aux_sec_hdr_process(p_frame_data);
+
+            if (aux_sec_hdr_set)
+            {
+                ie_process(p_frame_data);
+                template_store_prepare(p_frame_data);
+            }
+        }
+
+        if (!aux_sec_hdr_set)
         {
             // Failure to set auxiliary security header, the ACK cannot be created. Exit immediately
             *p_processing_done = true;
             return NULL;
         }
-
-        ie_process(p_frame_data);
     }
 
     if (frame_parse_level == PARSE_LEVEL_FULL)
@@ -634,6 +962,10 @@ void nrf_802154_enh_ack_generator_reset(void)
     mp_ie_data    = 0U;
     m_ie_data_len = 0U;
     m_ack_state   = ACK_STATE_RESET;
+#if NRF_802154_ENH_ACK_TEMPLATES_NUM > 0
+    mp_template       = NULL;
+    mp_template_store = NULL;
+#endif
 }
 
 uint8_t * nrf_802154_enh_ack_generator_create(
@@ -679,3 +1011,29 @@ uint8_t * nrf_802154_enh_ack_generator_create(
             return NULL;
     }
 }
+
+#if NRF_802154_ENH_ACK_TEMPLATES_NUM > 0
+
+void nrf_802154_enh_ack_generator_tx_ack_started_hook(uint8_t * p_ack)
+{
+    ack_template_t * p_template = mp_template_store;
+
+    if ((p_template == NULL) || (p_ack != m_ack) || (ack_state_get() != ACK_STATE_COMPLETE))
+    {
+        return;
+    }
+
+    mp_template_store = NULL;
+
+    memcpy(p_template->src_addr, mp_template_src_addr, m_template_src_addr_size);
+    memcpy(p_template->ack, m_ack, m_ack[PHR_OFFSET] + PHR_SIZE);
+    p_template->ack_data = m_ack_data;
+
+    // The Frame Pending bit is set for each frame when the entire frame is received.
+    p_template->ack[FRAME_PENDING_OFFSET] &= (uint8_t)~FRAME_PENDING_BIT;
+
+    p_template->last_used     = ++m_templates_use_counter;
+    p_template->src_addr_size = m_template_src_addr_size;
+}
+
+#endif // NRF_802154_ENH_ACK_TEMPLATES_NUM > 0
@@ -73,4 +73,13 @@ void nrf_802154_enh_ack_generator_reset(void);
 uint8_t * nrf_802154_enh_ack_generator_create(
     const nrf_802154_frame_parser_data_t * p_frame_data);
 
+/** @brief ACK TX started hook for the Enhanced ACK generator module.
+ *
+ * If the transmitted Enh-Ack was built from scratch, this hook stores it as a template for
+ * subsequent frames from the same peer.
+ *
+ * @param[in]  p_ack  Pointer to the buffer that contains the PHR and PSDU of the ACK frame.
+ */
+void nrf_802154_enh_ack_generator_tx_ack_started_hook(uint8_t * p_ack);
+
 #endif // NRF_802154_ENH_ACK_GENERATOR_H
@@ -56,7 +56,6 @@
 #include "nrf_802154_request.h"
 #include "nrf_802154_tx_power.h"
 #include "nrf_802154_stats.h"
-#include "platform/nrf_802154_random.h"
 #include "rsch/nrf_802154_rsch.h"
 #include "nrf_802154_sl_timer.h"
 #include "nrf_802154_sl_atomics.h"
@@ -72,8 +71,8 @@ typedef enum
     CSMA_CA_STATE_ABORTED                                 ///< The CSMA-CA procedure is being aborted.
 } csma_ca_state_t;
 
-static uint8_t m_nb;                                      ///< The number of times the CSMA-CA algorithm was required to back off while attempting the current transmission.
-static uint8_t m_be;                                      ///< Backoff exponent, which is related to how many backoff periods a device shall wait before attempting to assess a channel.
+static nrf_802154_csma_ca_backoff_state_t          m_backoff; ///< State of the current procedure passed to the backoff policy.
+static const nrf_802154_csma_ca_backoff_policy_t * mp_policy; ///< Backoff policy used by the current procedure.
 
 static uint8_t                            * mp_data;      ///< Pointer to a buffer containing PHR and PSDU of the frame being transmitted.
 static nrf_802154_transmitted_frame_props_t m_data_props; ///< Structure containing detailed properties of data in buffer.
@@ -115,7 +114,7 @@ static void priority_leverage(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
-    bool first_transmit_attempt     = (0 == m_nb);
+    bool first_transmit_attempt     = (0 == m_backoff.nb);
     bool coex_requires_boosted_prio = (nrf_802154_pib_coex_tx_request_mode_get() ==
                                        NRF_802154_COEX_TX_REQUEST_MODE_CCA_START);
 
@@ -136,16 +135,17 @@ static void priority_leverage(void)
 /**
  * @brief Notify MAC layer that CSMA-CA failed
  *
- * @param[in]  error  The error that caused the failure
+ * @param[in]  p_data  Pointer to a buffer containing PHR and PSDU of the frame
+ * @param[in]  error   The error that caused the failure
  */
-static void notify_failed(nrf_802154_tx_error_t error)
+static void notify_failed(uint8_t * p_data, nrf_802154_tx_error_t error)
 {
     // core rejected attempt, use my current frame_props
     nrf_802154_transmit_done_metadata_t metadata = {};
 
     metadata.frame_props = m_data_props;
 
-    nrf_802154_notify_transmit_failed(mp_data, error, &metadata);
+    nrf_802154_notify_transmit_failed(p_data, error, &metadata);
 }
 
 /**
@@ -159,13 +159,20 @@ static void notify_busy_channel(bool result)
 
     nrf_802154_rsch_delayed_timeslot_cancel(NRF_802154_RESERVED_CSMACA_ID, true);
 
-    // The 802.15.4 specification requires CSMA-CA to continue until m_nb is strictly greater
+    // The 802.15.4 specification requires CSMA-CA to continue until NB is strictly greater
     // than nrf_802154_pib_csmaca_max_backoffs_get(), but at the moment this function is executed
-    // the value of m_nb has not yet been incremented to reflect the latest attempt. Therefore
+    // the value of NB has not yet been incremented to reflect the latest attempt. Therefore
     // the comparison uses `greater or equal` instead of `greater than`.
-    if (!result && (m_nb >= nrf_802154_pib_csmaca_max_backoffs_get()))
+    if (!result && (m_backoff.nb >= nrf_802154_pib_csmaca_max_backoffs_get()))
     {
-        notify_failed(NRF_802154_TX_ERROR_BUSY_CHANNEL);
+        uint8_t * p_data = mp_data;
+
+        // End the procedure before the failure is notified, so that the procedure can be started
+        // again from the notification. The busy channel handling that follows the rejected
+        // request in frame_transmit() then finds the procedure inactive.
+        (void)channel_busy();
+
+        notify_failed(p_data, NRF_802154_TX_ERROR_BUSY_CHANNEL);
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
@@ -218,11 +225,11 @@ static void frame_transmit(rsch_dly_ts_id_t dly_ts_id)
 }
 
 /**
- * @brief Calculates number of backoff periods as random value according to IEEE Std. 802.15.4.
+ * @brief Calculates number of backoff periods using the backoff policy.
  */
-static uint8_t backoff_periods_calc_random(void)
+static uint16_t backoff_periods_calc_policy(void)
 {
-    return nrf_802154_random_get() % (1U << m_be);
+    return mp_policy->periods_get(mp_policy->p_context, &m_backoff);
 }
 
 /**
@@ -230,20 +237,20 @@ static uint8_t backoff_periods_calc_random(void)
  *
  * @return Number of backoff periods
  */
-static uint8_t backoff_periods_calc(void)
+static uint16_t backoff_periods_calc(void)
 {
-    uint8_t result;
+    uint16_t result;
 
 #if NRF_802154_TEST_MODES_ENABLED
 
     switch (nrf_802154_pib_test_mode_csmaca_backoff_get())
     {
         case NRF_802154_TEST_MODE_CSMACA_BACKOFF_RANDOM:
-            result = backoff_periods_calc_random();
+            result = backoff_periods_calc_policy();
             break;
 
         case NRF_802154_TEST_MODE_CSMACA_BACKOFF_ALWAYS_MAX:
-            result = (1U << m_be) - 1U;
+            result = (1U << m_backoff.be) - 1U;
             break;
 
         case NRF_802154_TEST_MODE_CSMACA_BACKOFF_ALWAYS_MIN:
@@ -251,25 +258,25 @@ static uint8_t backoff_periods_calc(void)
             break;
 
         default:
-            result = backoff_periods_calc_random();
+            result = backoff_periods_calc_policy();
             NRF_802154_ASSERT(false);
             break;
     }
 #else
-    result = backoff_periods_calc_random();
+    result = backoff_periods_calc_policy();
 #endif
 
     return result;
 }
 
 /**
- * @brief Delay CCA procedure for random (2^BE - 1) unit backoff periods.
+ * @brief Delay CCA procedure for the number of unit backoff periods selected by the policy.
  */
 static void random_backoff_start(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
 
-    uint64_t backoff_us = backoff_periods_calc() * UNIT_BACKOFF_PERIOD;
+    uint64_t backoff_us = (uint64_t)backoff_periods_calc() * UNIT_BACKOFF_PERIOD;
 
     rsch_dly_ts_param_t backoff_ts_param =
     {
@@ -290,7 +297,7 @@ static void random_backoff_start(void)
 
         case NRF_802154_COEX_TX_REQUEST_MODE_CCA_START:
             // Coex should be requested for all backoff periods but the first one
-            backoff_ts_param.prio = (m_nb == 0) ? RSCH_PRIO_IDLE_LISTENING : RSCH_PRIO_TX;
+            backoff_ts_param.prio = (m_backoff.nb == 0) ? RSCH_PRIO_IDLE_LISTENING : RSCH_PRIO_TX;
             break;
 
         case NRF_802154_COEX_TX_REQUEST_MODE_CCA_DONE:
@@ -321,15 +328,19 @@ static bool channel_busy(void)
 
     if (csma_ca_state_set(CSMA_CA_STATE_ONGOING, CSMA_CA_STATE_BACKOFF))
     {
-        m_nb++;
+        m_backoff.nb++;
 
-        if (m_be < nrf_802154_pib_csmaca_max_be_get())
+        if (m_backoff.nb > nrf_802154_pib_csmaca_max_backoffs_get())
         {
-            m_be++;
-        }
+#if (NRF_802154_STATS_HISTOGRAMS_ENABLED)
+            nrf_802154_stat_csmaca_backoffs_record(m_backoff.nb);
+#endif
+
+            if (mp_policy->finished != NULL)
+            {
+                mp_policy->finished(mp_policy->p_context, &m_backoff, false);
+            }
 
-        if (m_nb > nrf_802154_pib_csmaca_max_backoffs_get())
-        {
             mp_data = NULL;
             bool ret = csma_ca_state_set(CSMA_CA_STATE_BACKOFF, CSMA_CA_STATE_IDLE);
 
@@ -338,6 +349,7 @@ static bool channel_busy(void)
         }
         else
         {
+            mp_policy->busy(mp_policy->p_context, &m_backoff);
             random_backoff_start();
             result = false;
         }
@@ -369,9 +381,16 @@ bool nrf_802154_csma_ca_start(uint8_t                                      * p_d
 
     mp_data      = p_data;
     m_data_props = p_metadata->frame_props;
-    m_nb         = 0;
-    m_be         = nrf_802154_pib_csmaca_min_be_get();
     m_tx_channel = channel;
+
+    m_backoff.p_frame      = p_data;
+    m_backoff.min_be       = nrf_802154_pib_csmaca_min_be_get();
+    m_backoff.max_be       = nrf_802154_pib_csmaca_max_be_get();
+    m_backoff.max_backoffs = nrf_802154_pib_csmaca_max_backoffs_get();
+    m_backoff.nb           = 0;
+    mp_policy              = nrf_802154_pib_csmaca_backoff_policy_get();
+    mp_policy->start(mp_policy->p_context, &m_backoff);
+
     (void)nrf_802154_tx_power_convert_metadata_to_tx_power_split(channel,
                                                                  p_metadata->tx_power,
                                                                  &m_tx_power);
@@ -448,7 +467,7 @@ bool nrf_802154_csma_ca_tx_failed_hook(uint8_t * p_frame, nrf_802154_tx_error_t
                     // The procedure was aborted while another operation was holding
                     // frame pointer in the core - hence p_frame points to a different
                     // frame than mp_data. CSMA-CA failure must be notified directly.
-                    notify_failed(error);
+                    notify_failed(mp_data, error);
                 }
             }
             else if (p_frame == mp_data)
@@ -474,6 +493,15 @@ bool nrf_802154_csma_ca_tx_started_hook(uint8_t * p_frame)
 
     if (mp_data == p_frame)
     {
+#if (NRF_802154_STATS_HISTOGRAMS_ENABLED)
+        nrf_802154_stat_csmaca_backoffs_record(m_backoff.nb);
+#endif
+
+        if (mp_policy->finished != NULL)
+        {
+            mp_policy->finished(mp_policy->p_context, &m_backoff, true);
+        }
+
         mp_data = NULL;
         nrf_802154_sl_atomic_store_u8(&m_state, CSMA_CA_STATE_IDLE);
     }
@@ -0,0 +1,351 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the built-in CSMA-CA backoff policies.
+ *
+ */
+
+#include "nrf_802154_csma_ca_backoff.h"
+
+#if NRF_802154_CSMA_CA_ENABLED
+
+#include <stddef.h>
+#include <string.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_utils.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+#include "platform/nrf_802154_random.h"
+
+#define BUSY_RATIO_ONE        UINT16_MAX ///< Busy ratio of a channel that is always busy.
+#define BUSY_RATIO_WEIGHT_LOG 3U         ///< Weight of a new CCA result in the busy ratio, as a power of 1/2.
+
+static nrf_802154_csma_ca_backoff_adaptive_ctx_t    m_adaptive_ctx;    ///< Context of the adaptive policy.
+static nrf_802154_csma_ca_backoff_destination_ctx_t m_destination_ctx; ///< Context of the per-destination policy.
+
+/**
+ * @brief Calculates number of backoff periods as random value according to IEEE Std. 802.15.4.
+ */
+static uint16_t random_periods_get(uint8_t be)
+{
+    return nrf_802154_random_get() % (1UL << be);
+}
+
+/**
+ * @brief Increments the backoff exponent without exceeding @p max_be.
+ */
+static uint8_t be_increment(uint8_t be, uint8_t max_be)
+{
+    return (be < max_be) ? (be + 1U) : be;
+}
+
+/**
+ * @brief Updates the moving average of the ratio of busy CCA attempts.
+ */
+static uint16_t busy_ratio_update(uint16_t busy_ratio, bool busy)
+{
+    if (busy)
+    {
+        busy_ratio += (BUSY_RATIO_ONE - busy_ratio) >> BUSY_RATIO_WEIGHT_LOG;
+    }
+    else
+    {
+        busy_ratio -= busy_ratio >> BUSY_RATIO_WEIGHT_LOG;
+    }
+
+    return busy_ratio;
+}
+
+/**
+ * @brief Maps the ratio of busy CCA attempts linearly onto the range of backoff exponents.
+ */
+static uint8_t be_from_busy_ratio(uint16_t busy_ratio, uint8_t min_be, uint8_t max_be)
+{
+    if (max_be <= min_be)
+    {
+        return min_be;
+    }
+
+    return min_be + (uint8_t)(((uint32_t)busy_ratio * (max_be - min_be) + (BUSY_RATIO_ONE / 2U)) /
+                              BUSY_RATIO_ONE);
+}
+
+static void ieee_start(void * p_context, nrf_802154_csma_ca_backoff_state_t * p_state)
+{
+    (void)p_context;
+
+    p_state->be = p_state->min_be;
+}
+
+static uint16_t ieee_periods_get(void * p_context, const nrf_802154_csma_ca_backoff_state_t * p_state)
+{
+    (void)p_context;
+
+    return random_periods_get(p_state->be);
+}
+
+static void ieee_busy(void * p_context, nrf_802154_csma_ca_backoff_state_t * p_state)
+{
+    (void)p_context;
+
+    p_state->be = be_increment(p_state->be, p_state->max_be);
+}
+
+static void adaptive_start(void * p_context, nrf_802154_csma_ca_backoff_state_t * p_state)
+{
+    nrf_802154_csma_ca_backoff_adaptive_ctx_t * p_ctx = p_context;
+
+    p_state->be = be_from_busy_ratio(p_ctx->busy_ratio, p_state->min_be, p_state->max_be);
+}
+
+static void adaptive_busy(void * p_context, nrf_802154_csma_ca_backoff_state_t * p_state)
+{
+    nrf_802154_csma_ca_backoff_adaptive_ctx_t * p_ctx = p_context;
+
+    p_ctx->busy_ratio = busy_ratio_update(p_ctx->busy_ratio, true);
+    p_state->be       = be_increment(p_state->be, p_state->max_be);
+}
+
+static void adaptive_finished(void                                     * p_context,
+                              const nrf_802154_csma_ca_backoff_state_t * p_state,
+                              bool                                       channel_idle)
+{
+    nrf_802154_csma_ca_backoff_adaptive_ctx_t * p_ctx = p_context;
+
+    (void)p_state;
+
+    p_ctx->busy_ratio = busy_ratio_update(p_ctx->busy_ratio, !channel_idle);
+}
+
+/**
+ * @brief Checks if the frame is a Beacon or a MAC command, which are sent with high priority.
+ */
+static bool frame_is_high_priority(const uint8_t * p_frame)
+{
+    uint8_t frame_type = p_frame[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK;
+
+    return (frame_type == FRAME_TYPE_BEACON) || (frame_type == FRAME_TYPE_COMMAND);
+}
+
+/**
+ * @brief Checks if the frame requests no Ack, which makes it sent with low priority.
+ */
+static bool frame_is_low_priority(const uint8_t * p_frame)
+{
+    return (p_frame[ACK_REQUEST_OFFSET] & ACK_REQUEST_BIT) == 0U;
+}
+
+static void priority_start(void * p_context, nrf_802154_csma_ca_backoff_state_t * p_state)
+{
+    (void)p_context;
+
+    p_state->be = p_state->min_be;
+
+    if (frame_is_high_priority(p_state->p_frame))
+    {
+        p_state->be = (p_state->be > 0U) ? (p_state->be - 1U) : 0U;
+    }
+    else if (frame_is_low_priority(p_state->p_frame))
+    {
+        p_state->be = be_increment(p_state->be, p_state->max_be);
+    }
+    else
+    {
+        // Intentionally empty: other frames use macMinBe.
+    }
+}
+
+static void priority_busy(void * p_context, nrf_802154_csma_ca_backoff_state_t * p_state)
+{
+    uint8_t max_be = p_state->max_be;
+
+    (void)p_context;
+
+    // High priority frames never reach the longest backoff window.
+    if (frame_is_high_priority(p_state->p_frame) && (max_be > 0U))
+    {
+        max_be--;
+    }
+
+    p_state->be = be_increment(p_state->be, max_be);
+}
+
+/**
+ * @brief Finds the history entry of the destination of the frame, or allocates one.
+ *
+ * @returns  Index of the entry or -1 if the frame has no destination address.
+ */
+static int8_t destination_find(nrf_802154_csma_ca_backoff_destination_ctx_t * p_ctx,
+                               const uint8_t                                * p_frame)
+{
+    nrf_802154_frame_parser_data_t frame_data;
+    const uint8_t                * p_addr;
+    uint8_t                        addr_size;
+    uint32_t                       victim = 0U;
+
+    if (!nrf_802154_frame_parser_data_init(p_frame,
+                                           p_frame[PHR_OFFSET] + PHR_SIZE,
+                                           PARSE_LEVEL_DST_ADDRESSING_END,
+                                           &frame_data))
+    {
+        return -1;
+    }
+
+    p_addr    = nrf_802154_frame_parser_dst_addr_get(&frame_data);
+    addr_size = nrf_802154_frame_parser_dst_addr_size_get(&frame_data);
+
+    if ((p_addr == NULL) || (addr_size == 0U) || (addr_size > EXTENDED_ADDRESS_SIZE))
+    {
+        return -1;
+    }
+
+    for (uint32_t i = 0U; i < NUMELTS(p_ctx->destinations); i++)
+    {
+        nrf_802154_csma_ca_backoff_destination_t * p_entry = &p_ctx->destinations[i];
+
+        if ((p_entry->addr_size == addr_size) && (memcmp(p_entry->addr, p_addr, addr_size) == 0))
+        {
+            return (int8_t)i;
+        }
+
+        if ((p_ctx->destinations[victim].addr_size != 0U) &&
+            ((p_entry->addr_size == 0U) ||
+             (p_entry->last_used < p_ctx->destinations[victim].last_used)))
+        {
+            victim = i;
+        }
+    }
+
+    memset(&p_ctx->destinations[victim], 0, sizeof(p_ctx->destinations[victim]));
+    memcpy(p_ctx->destinations[victim].addr, p_addr, addr_size);
+    p_ctx->destinations[victim].addr_size = addr_size;
+
+    return (int8_t)victim;
+}
+
+static void destination_start(void * p_context, nrf_802154_csma_ca_backoff_state_t * p_state)
+{
+    nrf_802154_csma_ca_backoff_destination_ctx_t * p_ctx = p_context;
+
+    p_ctx->current = destination_find(p_ctx, p_state->p_frame);
+    p_state->be    = p_state->min_be;
+
+    if (p_ctx->current >= 0)
+    {
+        nrf_802154_csma_ca_backoff_destination_t * p_entry = &p_ctx->destinations[p_ctx->current];
+
+        p_entry->last_used = ++p_ctx->use_counter;
+        p_state->be        = be_from_busy_ratio(p_entry->busy_ratio,
+                                                p_state->min_be,
+                                                p_state->max_be);
+    }
+}
+
+static void destination_busy(void * p_context, nrf_802154_csma_ca_backoff_state_t * p_state)
+{
+    nrf_802154_csma_ca_backoff_destination_ctx_t * p_ctx = p_context;
+
+    if (p_ctx->current >= 0)
+    {
+        nrf_802154_csma_ca_backoff_destination_t * p_entry = &p_ctx->destinations[p_ctx->current];
+
+        p_entry->busy_ratio = busy_ratio_update(p_entry->busy_ratio, true);
+    }
+
+    p_state->be = be_increment(p_state->be, p_state->max_be);
+}
+
+static void destination_finished(void                                     * p_context,
+                                 const nrf_802154_csma_ca_backoff_state_t * p_state,
+                                 bool                                       channel_idle)
+{
+    nrf_802154_csma_ca_backoff_destination_ctx_t * p_ctx = p_context;
+
+    (void)p_state;
+
+    if (p_ctx->current >= 0)
+    {
+        nrf_802154_csma_ca_backoff_destination_t * p_entry = &p_ctx->destinations[p_ctx->current];
+
+        p_entry->busy_ratio = busy_ratio_update(p_entry->busy_ratio, !channel_idle);
+    }
+
+    p_ctx->current = -1;
+}
+
+static const nrf_802154_csma_ca_backoff_policy_t m_policies[] =
+{
+    [NRF_802154_CSMA_CA_BACKOFF_POLICY_IEEE] =
+    {
+        .start       = ieee_start,
+        .periods_get = ieee_periods_get,
+        .busy        = ieee_busy,
+        .finished    = NULL,
+        .p_context   = NULL,
+    },
+    [NRF_802154_CSMA_CA_BACKOFF_POLICY_ADAPTIVE] =
+    {
+        .start       = adaptive_start,
+        .periods_get = ieee_periods_get,
+        .busy        = adaptive_busy,
+        .finished    = adaptive_finished,
+        .p_context   = &m_adaptive_ctx,
+    },
+    [NRF_802154_CSMA_CA_BACKOFF_POLICY_PRIORITY] =
+    {
+        .start       = priority_start,
+        .periods_get = ieee_periods_get,
+        .busy        = priority_busy,
+        .finished    = NULL,
+        .p_context   = NULL,
+    },
+    [NRF_802154_CSMA_CA_BACKOFF_POLICY_DESTINATION] =
+    {
+        .start       = destination_start,
+        .periods_get = ieee_periods_get,
+        .busy        = destination_busy,
+        .finished    = destination_finished,
+        .p_context   = &m_destination_ctx,
+    },
+};
+
+const nrf_802154_csma_ca_backoff_policy_t * nrf_802154_csma_ca_backoff_policy_builtin_get(
+    nrf_802154_csma_ca_backoff_policy_id_t id)
+{
+    return (id < NUMELTS(m_policies)) ? &m_policies[id] : NULL;
+}
+
+#endif // NRF_802154_CSMA_CA_ENABLED
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file declares the built-in CSMA-CA backoff policies.
+ *
+ */
+
+#ifndef NRF_802154_CSMA_CA_BACKOFF_H__
+#define NRF_802154_CSMA_CA_BACKOFF_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_types.h"
+
+/**
+ * @brief Context of the @ref NRF_802154_CSMA_CA_BACKOFF_POLICY_ADAPTIVE policy.
+ *
+ * A zero-initialized context is a valid initial one.
+ */
+typedef struct
+{
+    uint16_t busy_ratio; ///< Moving average of the ratio of busy CCA attempts, in 1/65536 units.
+} nrf_802154_csma_ca_backoff_adaptive_ctx_t;
+
+/**
+ * @brief Entry of the history kept by the @ref NRF_802154_CSMA_CA_BACKOFF_POLICY_DESTINATION policy.
+ */
+typedef struct
+{
+    uint8_t  addr[EXTENDED_ADDRESS_SIZE]; ///< Destination address. Only @c addr_size first bytes are valid.
+    uint8_t  addr_size;                   ///< Size of the destination address, 0 if the entry is unused.
+    uint16_t busy_ratio;                  ///< Moving average of the ratio of busy CCA attempts, in 1/65536 units.
+    uint32_t last_used;                   ///< Value of the use counter when the entry was last used.
+} nrf_802154_csma_ca_backoff_destination_t;
+
+/**
+ * @brief Context of the @ref NRF_802154_CSMA_CA_BACKOFF_POLICY_DESTINATION policy.
+ *
+ * A zero-initialized context is a valid initial one.
+ */
+typedef struct
+{
+    nrf_802154_csma_ca_backoff_destination_t
+             destinations[NRF_802154_CSMA_CA_BACKOFF_DESTINATIONS_NUM]; ///< History of destinations.
+    uint32_t use_counter;                                               ///< Counter of procedures.
+    int8_t   current;                                                   ///< Index of the destination of the ongoing procedure, -1 if none.
+} nrf_802154_csma_ca_backoff_destination_ctx_t;
+
+/**
+ * @brief Gets a built-in backoff policy.
+ *
+ * The returned policies use contexts allocated by this module. A policy can be used with
+ * another context by copying it and replacing @c p_context with a pointer to a context
+ * of the matching type.
+ *
+ * @param[in]  id  Identifier of the policy.
+ *
+ * @returns  Pointer to the policy or NULL if @p id does not identify a built-in policy.
+ */
+const nrf_802154_csma_ca_backoff_policy_t * nrf_802154_csma_ca_backoff_policy_builtin_get(
+    nrf_802154_csma_ca_backoff_policy_id_t id);
+
+#endif // NRF_802154_CSMA_CA_BACKOFF_H__
@@ -51,6 +51,7 @@
 #include "nrf_802154_const.h"
 #include "nrf_802154_frame_parser.h"
 #include "nrf_802154_notification.h"
+#include "nrf_802154_periodic_rx.h"
 #include "nrf_802154_pib.h"
 #include "nrf_802154_procedures_duration.h"
 #include "nrf_802154_queue.h"
@@ -115,6 +116,9 @@ typedef struct
     nrf_802154_sl_timer_t            timeout_timer;   ///< Timer for delayed RX timeout handling.
     uint32_t                         timeout_length;  ///< Requested length [us] of RX window plus RX_RAMP_UP_TIME.
     volatile delayed_rx_frame_data_t extension_frame; ///< Data of frame that caused extension of RX window.
+    uint64_t                         start_time;      ///< Time at which the delayed timeslot of RX window starts.
+    uint16_t                         heap_idx;        ///< Position in @ref m_dly_rx_heap while RX window is pending.
+    uint16_t                         ongoing_idx;     ///< Position in @ref m_dly_rx_ongoing while RX window is ongoing.
     uint8_t                          channel;         ///< Channel number on which reception should be performed.
 } dly_rx_data_t;
 
@@ -168,6 +172,266 @@ static nrf_802154_queue_t m_dly_rx_id_q;
  */
 static dly_op_data_t * m_dly_rx_id_q_mem[NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS];
 
+/*
+ * RX delayed operation slots are indexed so that none of the operations on them depends on
+ * the number of slots:
+ * - stopped slots are kept on a free list,
+ * - slots with an assigned ID are found through an open-addressing ID map,
+ * - pending slots are kept in a min-heap ordered by the start time of their timeslots,
+ * - ongoing slots are kept in a compact array.
+ *
+ * All the indexes are modified with interrupts disabled, either by the functions entering a
+ * critical section themselves or by @ref dly_op_state_set for the state-dependent indexes.
+ */
+
+#define DLY_RX_SLOT_NONE   UINT16_MAX                                   ///< Marks an empty ID map entry or a slot out of an index.
+#define DLY_RX_ID_MAP_SIZE (2 * NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS + 1) ///< Number of ID map entries. Kept at most half full.
+
+#if NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS >= 0xFFFF
+#error "Too many DRX slots to be indexed"
+#endif
+
+/**
+ * @brief Stack of indexes of stopped RX delayed operation slots.
+ */
+static uint16_t m_dly_rx_free[NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS];
+
+/**
+ * @brief Number of entries in @ref m_dly_rx_free.
+ */
+static uint16_t m_dly_rx_free_cnt;
+
+/**
+ * @brief Map from ID of a RX delayed operation to index of its slot.
+ */
+static uint16_t m_dly_rx_id_map[DLY_RX_ID_MAP_SIZE];
+
+/**
+ * @brief Min-heap of indexes of pending RX delayed operation slots, ordered by start time.
+ */
+static uint16_t m_dly_rx_heap[NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS];
+
+/**
+ * @brief Number of entries in @ref m_dly_rx_heap.
+ */
+static uint16_t m_dly_rx_heap_cnt;
+
+/**
+ * @brief Indexes of ongoing RX delayed operation slots.
+ */
+static uint16_t m_dly_rx_ongoing[NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS];
+
+/**
+ * @brief Number of entries in @ref m_dly_rx_ongoing.
+ */
+static uint16_t m_dly_rx_ongoing_cnt;
+
+static uint16_t dly_rx_slot_idx_get(const dly_op_data_t * p_dly_op_data)
+{
+    return (uint16_t)(p_dly_op_data - m_dly_rx_data);
+}
+
+static uint32_t dly_rx_id_map_home_get(rsch_dly_ts_id_t id)
+{
+    return (uint32_t)(((uint64_t)id * 2654435761UL) % DLY_RX_ID_MAP_SIZE);
+}
+
+/**
+ * @brief Find position of ID in the ID map.
+ *
+ * @return Position of the ID or DLY_RX_ID_MAP_SIZE if the ID is not mapped.
+ */
+static uint32_t dly_rx_id_map_find(rsch_dly_ts_id_t id)
+{
+    uint32_t pos = dly_rx_id_map_home_get(id);
+
+    while (m_dly_rx_id_map[pos] != DLY_RX_SLOT_NONE)
+    {
+        if (m_dly_rx_data[m_dly_rx_id_map[pos]].id == id)
+        {
+            return pos;
+        }
+
+        pos = (pos + 1) % DLY_RX_ID_MAP_SIZE;
+    }
+
+    return DLY_RX_ID_MAP_SIZE;
+}
+
+/**
+ * @brief Remove the entry at given position of the ID map.
+ *
+ * Entries following the removed one are shifted back so that no lookup chain gets broken.
+ */
+static void dly_rx_id_map_remove(uint32_t pos)
+{
+    uint32_t next = pos;
+
+    while (true)
+    {
+        next = (next + 1) % DLY_RX_ID_MAP_SIZE;
+
+        if (m_dly_rx_id_map[next] == DLY_RX_SLOT_NONE)
+        {
+            break;
+        }
+
+        uint32_t home = dly_rx_id_map_home_get(m_dly_rx_data[m_dly_rx_id_map[next]].id);
+
+        // Move the entry unless its home lies cyclically in (pos, next].
+        bool home_in_range = (pos <= next) ? ((home > pos) && (home <= next)) :
+                             ((home > pos) || (home <= next));
+
+        if (!home_in_range)
+        {
+            m_dly_rx_id_map[pos] = m_dly_rx_id_map[next];
+            pos                  = next;
+        }
+    }
+
+    m_dly_rx_id_map[pos] = DLY_RX_SLOT_NONE;
+}
+
+static void dly_rx_heap_entry_set(uint16_t heap_idx, uint16_t slot_idx)
+{
+    m_dly_rx_heap[heap_idx]             = slot_idx;
+    m_dly_rx_data[slot_idx].rx.heap_idx = heap_idx;
+}
+
+static bool dly_rx_heap_is_before(uint16_t heap_idx_a, uint16_t heap_idx_b)
+{
+    return m_dly_rx_data[m_dly_rx_heap[heap_idx_a]].rx.start_time <
+           m_dly_rx_data[m_dly_rx_heap[heap_idx_b]].rx.start_time;
+}
+
+static void dly_rx_heap_sift_up(uint16_t heap_idx)
+{
+    uint16_t slot_idx = m_dly_rx_heap[heap_idx];
+
+    while (heap_idx > 0)
+    {
+        uint16_t parent = (heap_idx - 1) / 2;
+
+        if (m_dly_rx_data[m_dly_rx_heap[parent]].rx.start_time <=
+            m_dly_rx_data[slot_idx].rx.start_time)
+        {
+            break;
+        }
+
+        dly_rx_heap_entry_set(heap_idx, m_dly_rx_heap[parent]);
+        heap_idx = parent;
+    }
+
+    dly_rx_heap_entry_set(heap_idx, slot_idx);
+}
+
+static void dly_rx_heap_sift_down(uint16_t heap_idx)
+{
+    while (true)
+    {
+        uint32_t child    = 2 * (uint32_t)heap_idx + 1;
+        uint16_t smallest = heap_idx;
+
+        if ((child < m_dly_rx_heap_cnt) && dly_rx_heap_is_before(child, smallest))
+        {
+            smallest = child;
+        }
+
+        if ((child + 1 < m_dly_rx_heap_cnt) && dly_rx_heap_is_before(child + 1, smallest))
+        {
+            smallest = child + 1;
+        }
+
+        if (smallest == heap_idx)
+        {
+            break;
+        }
+
+        uint16_t slot_idx = m_dly_rx_heap[heap_idx];
+
+        dly_rx_heap_entry_set(heap_idx, m_dly_rx_heap[smallest]);
+        dly_rx_heap_entry_set(smallest, slot_idx);
+        heap_idx = smallest;
+    }
+}
+
+static void dly_rx_heap_remove(dly_op_data_t * p_dly_op_data)
+{
+    uint16_t heap_idx = p_dly_op_data->rx.heap_idx;
+
+    if (heap_idx == DLY_RX_SLOT_NONE)
+    {
+        return;
+    }
+
+    p_dly_op_data->rx.heap_idx = DLY_RX_SLOT_NONE;
+    m_dly_rx_heap_cnt--;
+
+    if (heap_idx != m_dly_rx_heap_cnt)
+    {
+        // Fill the gap with the last entry and restore the heap order around it.
+        uint16_t slot_idx = m_dly_rx_heap[m_dly_rx_heap_cnt];
+
+        dly_rx_heap_entry_set(heap_idx, slot_idx);
+        dly_rx_heap_sift_up(heap_idx);
+        dly_rx_heap_sift_down(m_dly_rx_data[slot_idx].rx.heap_idx);
+    }
+}
+
+static void dly_rx_ongoing_remove(dly_op_data_t * p_dly_op_data)
+{
+    uint16_t ongoing_idx = p_dly_op_data->rx.ongoing_idx;
+
+    if (ongoing_idx == DLY_RX_SLOT_NONE)
+    {
+        return;
+    }
+
+    p_dly_op_data->rx.ongoing_idx = DLY_RX_SLOT_NONE;
+    m_dly_rx_ongoing_cnt--;
+
+    if (ongoing_idx != m_dly_rx_ongoing_cnt)
+    {
+        uint16_t slot_idx = m_dly_rx_ongoing[m_dly_rx_ongoing_cnt];
+
+        m_dly_rx_ongoing[ongoing_idx]          = slot_idx;
+        m_dly_rx_data[slot_idx].rx.ongoing_idx = ongoing_idx;
+    }
+}
+
+/**
+ * @brief Update state-dependent indexes of a RX delayed operation slot after its state changed.
+ *
+ * Must be called with interrupts disabled.
+ */
+static void dly_rx_indexes_update(dly_op_data_t        * p_dly_op_data,
+                                  delayed_trx_op_state_t old_state,
+                                  delayed_trx_op_state_t new_state)
+{
+    if (old_state == DELAYED_TRX_OP_STATE_PENDING)
+    {
+        dly_rx_heap_remove(p_dly_op_data);
+    }
+    else if (old_state == DELAYED_TRX_OP_STATE_ONGOING)
+    {
+        dly_rx_ongoing_remove(p_dly_op_data);
+    }
+
+    if (new_state == DELAYED_TRX_OP_STATE_ONGOING)
+    {
+        p_dly_op_data->rx.ongoing_idx            = m_dly_rx_ongoing_cnt;
+        m_dly_rx_ongoing[m_dly_rx_ongoing_cnt++] = dly_rx_slot_idx_get(p_dly_op_data);
+    }
+    else if (new_state == DELAYED_TRX_OP_STATE_STOPPED)
+    {
+        // The ID must be unmapped before the slot can be reused.
+        NRF_802154_ASSERT(p_dly_op_data->id == NRF_802154_RESERVED_INVALID_ID);
+        NRF_802154_ASSERT(m_dly_rx_free_cnt < NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS);
+
+        m_dly_rx_free[m_dly_rx_free_cnt++] = dly_rx_slot_idx_get(p_dly_op_data);
+    }
+}
+
 /**
  * @brief Search for a RX delayed operation with given ID.
  *
@@ -177,30 +441,94 @@ static dly_op_data_t * m_dly_rx_id_q_mem[NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS];
  */
 static dly_op_data_t * dly_rx_data_by_id_search(rsch_dly_ts_id_t id)
 {
-    dly_op_data_t * p_dly_op_data = NULL;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    dly_op_data_t                 * p_dly_op_data = NULL;
 
-    for (uint32_t i = 0; i < sizeof(m_dly_rx_data) / sizeof(m_dly_rx_data[0]); i++)
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    uint32_t pos = dly_rx_id_map_find(id);
+
+    if (pos != DLY_RX_ID_MAP_SIZE)
+    {
+        p_dly_op_data = &m_dly_rx_data[m_dly_rx_id_map[pos]];
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return p_dly_op_data;
+}
+
+/**
+ * @brief Assign ID to a freshly allocated RX delayed operation slot and mark the slot pending.
+ *
+ * @param[inout]  p_dly_op_data  Slot with start time of its timeslot already set.
+ * @param[in]     id             Identifier to assign.
+ *
+ * @retval true   ID assigned.
+ * @retval false  Another RX delayed operation with the same ID exists.
+ */
+static bool dly_rx_data_schedule(dly_op_data_t * p_dly_op_data, rsch_dly_ts_id_t id)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            result = false;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if ((id != NRF_802154_RESERVED_INVALID_ID) &&
+        (dly_rx_id_map_find(id) == DLY_RX_ID_MAP_SIZE))
     {
-        if (m_dly_rx_data[i].id == id)
+        uint32_t pos = dly_rx_id_map_home_get(id);
+
+        while (m_dly_rx_id_map[pos] != DLY_RX_SLOT_NONE)
         {
-            // Slot with a matching identifier found
-            if ((p_dly_op_data == NULL))
-            {
-                // It's the first matching slot found
-                p_dly_op_data = &m_dly_rx_data[i];
-            }
-            else
-            {
-                // There's already been a matching slot. We expect all active slots to have unique
-                // IDs and all inactive slots to have their IDs set to NRF_802154_RESERVED_INVALID_ID.
-                // If we ended up here then either we're searching for invalid ID or the IDs assigned
-                // to active slots aren't unique. Either way - assert.
-                NRF_802154_ASSERT(false);
-            }
+            pos = (pos + 1) % DLY_RX_ID_MAP_SIZE;
         }
+
+        p_dly_op_data->id    = id;
+        m_dly_rx_id_map[pos] = dly_rx_slot_idx_get(p_dly_op_data);
+
+        dly_rx_heap_entry_set(m_dly_rx_heap_cnt, dly_rx_slot_idx_get(p_dly_op_data));
+        m_dly_rx_heap_cnt++;
+        dly_rx_heap_sift_up(p_dly_op_data->rx.heap_idx);
+
+        result = true;
     }
 
-    return p_dly_op_data;
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+/**
+ * @brief Invalidate ID of a delayed operation.
+ *
+ * For RX delayed operations the ID is also removed from the ID map.
+ *
+ * @param[inout]  p_dly_op_data  Data of the delayed operation.
+ */
+static void dly_op_id_invalidate(dly_op_data_t * p_dly_op_data)
+{
+    if (p_dly_op_data->op == RSCH_DLY_TS_OP_DRX)
+    {
+        nrf_802154_mcu_critical_state_t mcu_cs;
+
+        nrf_802154_mcu_critical_enter(mcu_cs);
+
+        uint32_t pos = dly_rx_id_map_find(p_dly_op_data->id);
+
+        if (pos != DLY_RX_ID_MAP_SIZE)
+        {
+            dly_rx_id_map_remove(pos);
+        }
+
+        p_dly_op_data->id = NRF_802154_RESERVED_INVALID_ID;
+
+        nrf_802154_mcu_critical_exit(mcu_cs);
+    }
+    else
+    {
+        p_dly_op_data->id = NRF_802154_RESERVED_INVALID_ID;
+    }
 }
 
 /**
@@ -224,8 +552,21 @@ static bool dly_op_state_set(dly_op_data_t        * p_dly_op_data,
     switch (p_dly_op_data->op)
     {
         case RSCH_DLY_TS_OP_DTX:
+        {
+            result = nrf_802154_sl_atomic_cas_u8(
+                (uint8_t *)&p_dly_op_data->state,
+                (uint8_t *)&expected_state,
+                new_state);
+        }
+        break;
+
         case RSCH_DLY_TS_OP_DRX:
         {
+            nrf_802154_mcu_critical_state_t mcu_cs;
+
+            // The state and the indexes depending on it must change together.
+            nrf_802154_mcu_critical_enter(mcu_cs);
+
             result = nrf_802154_sl_atomic_cas_u8(
                 (uint8_t *)&p_dly_op_data->state,
                 (uint8_t *)&expected_state,
@@ -233,10 +574,10 @@ static bool dly_op_state_set(dly_op_data_t        * p_dly_op_data,
 
             if (result)
             {
-                nrf_802154_log_local_event(NRF_802154_LOG_VERBOSITY_LOW,
-                                           NRF_802154_LOG_LOCAL_EVENT_ID_DELAYED_TRX__SET_STATE,
-                                           (uint32_t)new_state);
+                dly_rx_indexes_update(p_dly_op_data, expected_state, new_state);
             }
+
+            nrf_802154_mcu_critical_exit(mcu_cs);
         }
         break;
 
@@ -246,6 +587,13 @@ static bool dly_op_state_set(dly_op_data_t        * p_dly_op_data,
         }
     }
 
+    if (result)
+    {
+        nrf_802154_log_local_event(NRF_802154_LOG_VERBOSITY_LOW,
+                                   NRF_802154_LOG_LOCAL_EVENT_ID_DELAYED_TRX__SET_STATE,
+                                   (uint32_t)new_state);
+    }
+
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 
     return result;
@@ -312,9 +660,30 @@ static dly_op_data_t * available_dly_tx_slot_get(void)
  */
 static dly_op_data_t * available_dly_rx_slot_get(void)
 {
-    return available_dly_ts_slot_from_pool_get(
-        m_dly_rx_data,
-        sizeof(m_dly_rx_data) / sizeof(m_dly_rx_data[0]));
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    dly_op_data_t                 * p_dly_op_data = NULL;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (m_dly_rx_free_cnt > 0)
+    {
+        p_dly_op_data = &m_dly_rx_data[m_dly_rx_free[--m_dly_rx_free_cnt]];
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (p_dly_op_data != NULL)
+    {
+        // Slots on the free list are always stopped.
+        bool result = dly_op_state_set(p_dly_op_data,
+                                       DELAYED_TRX_OP_STATE_STOPPED,
+                                       DELAYED_TRX_OP_STATE_PENDING);
+
+        NRF_802154_ASSERT(result);
+        (void)result;
+    }
+
+    return p_dly_op_data;
 }
 
 /**
@@ -324,16 +693,18 @@ static dly_op_data_t * available_dly_rx_slot_get(void)
  */
 static dly_op_data_t * ongoing_dly_rx_slot_get(void)
 {
-    dly_op_data_t * p_dly_op_data = NULL;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    dly_op_data_t                 * p_dly_op_data = NULL;
 
-    for (uint32_t i = 0; i < sizeof(m_dly_rx_data) / sizeof(m_dly_rx_data[0]); i++)
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (m_dly_rx_ongoing_cnt > 0)
     {
-        if (m_dly_rx_data[i].state == DELAYED_TRX_OP_STATE_ONGOING)
-        {
-            p_dly_op_data = &m_dly_rx_data[i];
-        }
+        p_dly_op_data = &m_dly_rx_data[m_dly_rx_ongoing[m_dly_rx_ongoing_cnt - 1]];
     }
 
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
     return p_dly_op_data;
 }
 
@@ -410,7 +781,7 @@ static bool dly_op_request(const rsch_dly_ts_param_t * p_dly_ts_param,
 
     if (!result)
     {
-        p_dly_op_data->id = NRF_802154_RESERVED_INVALID_ID;
+        dly_op_id_invalidate(p_dly_op_data);
 
         // Release the delayed operation slot immediately in case of failure.
         bool state_set = dly_op_state_set(p_dly_op_data,
@@ -424,6 +795,30 @@ static bool dly_op_request(const rsch_dly_ts_param_t * p_dly_ts_param,
     return result;
 }
 
+/**
+ * @brief Notifies the end of a delayed reception window that did not end with a received frame.
+ *
+ * Windows opened by periodic reception schedules are accounted by the schedules instead of being
+ * reported to the MAC layer.
+ *
+ * @param[in]  error  Reason for which the window ended.
+ * @param[in]  id     Identifier of the window.
+ *
+ * @retval  true   The notification was issued or consumed.
+ * @retval  false  The notification could not be issued.
+ */
+static bool dly_rx_failed_notify(nrf_802154_rx_error_t error, uint32_t id)
+{
+#if NRF_802154_PERIODIC_RX_SCHEDULES > 0
+    if (nrf_802154_periodic_rx_window_ended(id, error))
+    {
+        return true;
+    }
+#endif
+
+    return nrf_802154_notify_receive_failed(error, id, false);
+}
+
 /**
  * Notify MAC layer that no frame was received before timeout.
  *
@@ -458,16 +853,14 @@ static void notify_rx_timeout(nrf_802154_sl_timer_t * p_timer)
     }
     else
     {
-        bool notified = nrf_802154_notify_receive_failed(
-            NRF_802154_RX_ERROR_DELAYED_TIMEOUT,
-            p_dly_op_data->id,
-            false);
+        bool notified = dly_rx_failed_notify(NRF_802154_RX_ERROR_DELAYED_TIMEOUT,
+                                             p_dly_op_data->id);
 
         // It should always be possible to notify DRX result
         NRF_802154_ASSERT(notified);
         (void)notified;
 
-        p_dly_op_data->id = NRF_802154_RESERVED_INVALID_ID;
+        dly_op_id_invalidate(p_dly_op_data);
 
         bool result = dly_op_state_set(p_dly_op_data,
                                        DELAYED_TRX_OP_STATE_ONGOING,
@@ -519,9 +912,16 @@ static void dly_rx_all_ongoing_abort(void)
     dly_op_data_t           * p_dly_op_data;
     bool                      result;
 
-    for (int i = 0; i < sizeof(m_dly_rx_data) / sizeof(m_dly_rx_data[0]); i++)
+    // Iterate backwards, as stopping an operation moves the last ongoing slot into its place.
+    for (uint16_t i = m_dly_rx_ongoing_cnt; i-- > 0;)
     {
-        p_dly_op_data = &m_dly_rx_data[i];
+        if (i >= m_dly_rx_ongoing_cnt)
+        {
+            // The operation has been stopped in the meantime by a higher priority context.
+            continue;
+        }
+
+        p_dly_op_data = &m_dly_rx_data[m_dly_rx_ongoing[i]];
 
         ret = nrf_802154_sl_timer_remove(&p_dly_op_data->rx.timeout_timer);
 
@@ -532,15 +932,14 @@ static void dly_rx_all_ongoing_abort(void)
             continue;
         }
 
-        bool notified = nrf_802154_notify_receive_failed(NRF_802154_RX_ERROR_DELAYED_ABORTED,
-                                                         p_dly_op_data->id,
-                                                         false);
+        bool notified = dly_rx_failed_notify(NRF_802154_RX_ERROR_DELAYED_ABORTED,
+                                             p_dly_op_data->id);
 
         // It should always be possible to notify DRX result
         NRF_802154_ASSERT(notified);
         (void)notified;
 
-        p_dly_op_data->id = NRF_802154_RESERVED_INVALID_ID;
+        dly_op_id_invalidate(p_dly_op_data);
 
         result = dly_op_state_set(p_dly_op_data,
                                   DELAYED_TRX_OP_STATE_ONGOING,
@@ -593,10 +992,8 @@ static void dly_rx_result_notify(bool result)
     }
     else
     {
-        bool notified = nrf_802154_notify_receive_failed(
-            NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED,
-            p_dly_op_data->id,
-            false);
+        bool notified = dly_rx_failed_notify(NRF_802154_RX_ERROR_DELAYED_TIMESLOT_DENIED,
+                                             p_dly_op_data->id);
 
         // It should always be possible to notify DRX result
         NRF_802154_ASSERT(notified);
@@ -722,7 +1119,7 @@ static void rx_timeslot_started_callback(rsch_dly_ts_id_t dly_ts_id)
 
     if (!attempt_success)
     {
-        p_dly_op_data->id = NRF_802154_RESERVED_INVALID_ID;
+        dly_op_id_invalidate(p_dly_op_data);
 
         result = dly_op_state_set(p_dly_op_data,
                                   DELAYED_TRX_OP_STATE_ONGOING,
@@ -741,6 +1138,13 @@ void nrf_802154_delayed_trx_module_reset(void)
     memset(m_dly_tx_data, 0, sizeof(m_dly_tx_data));
     memset(&m_dly_rx_id_q, 0, sizeof(m_dly_rx_id_q));
     memset(m_dly_rx_id_q_mem, 0, sizeof(m_dly_rx_id_q_mem));
+    memset(m_dly_rx_free, 0, sizeof(m_dly_rx_free));
+    memset(m_dly_rx_id_map, 0, sizeof(m_dly_rx_id_map));
+    memset(m_dly_rx_heap, 0, sizeof(m_dly_rx_heap));
+    memset(m_dly_rx_ongoing, 0, sizeof(m_dly_rx_ongoing));
+    m_dly_rx_free_cnt    = 0;
+    m_dly_rx_heap_cnt    = 0;
+    m_dly_rx_ongoing_cnt = 0;
 }
 
 #endif // TEST
@@ -754,11 +1158,30 @@ void nrf_802154_delayed_trx_init(void)
 
     for (uint32_t i = 0; i < sizeof(m_dly_rx_data) / sizeof(m_dly_rx_data[0]); i++)
     {
-        m_dly_rx_data[i].state = DELAYED_TRX_OP_STATE_STOPPED;
-        m_dly_rx_data[i].id    = NRF_802154_RESERVED_INVALID_ID;
+        m_dly_rx_data[i].state          = DELAYED_TRX_OP_STATE_STOPPED;
+        m_dly_rx_data[i].id             = NRF_802154_RESERVED_INVALID_ID;
+        m_dly_rx_data[i].op             = RSCH_DLY_TS_OP_DRX;
+        m_dly_rx_data[i].rx.heap_idx    = DLY_RX_SLOT_NONE;
+        m_dly_rx_data[i].rx.ongoing_idx = DLY_RX_SLOT_NONE;
         nrf_802154_sl_timer_init(&m_dly_rx_data[i].rx.timeout_timer);
     }
 
+    // Slots are handed out starting from the lowest index.
+    m_dly_rx_free_cnt = NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS;
+
+    for (uint16_t i = 0; i < NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS; i++)
+    {
+        m_dly_rx_free[i] = NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS - 1 - i;
+    }
+
+    for (uint32_t i = 0; i < DLY_RX_ID_MAP_SIZE; i++)
+    {
+        m_dly_rx_id_map[i] = DLY_RX_SLOT_NONE;
+    }
+
+    m_dly_rx_heap_cnt    = 0;
+    m_dly_rx_ongoing_cnt = 0;
+
     for (uint32_t i = 0; i < sizeof(m_dly_tx_data) / sizeof(m_dly_tx_data[0]); i++)
     {
         m_dly_tx_data[i].state = DELAYED_TRX_OP_STATE_STOPPED;
@@ -827,12 +1250,6 @@ bool nrf_802154_delayed_trx_receive(uint64_t rx_time,
                                     uint8_t  channel,
                                     uint32_t id)
 {
-    if (dly_rx_data_by_id_search(id) != NULL)
-    {
-        /* DRX with given id is already present. */
-        return false;
-    }
-
     dly_op_data_t * p_dly_rx_data = available_dly_rx_slot_get();
     bool            result        = false;
 
@@ -847,8 +1264,19 @@ bool nrf_802154_delayed_trx_receive(uint64_t rx_time,
                                            RX_SETUP_TIME_MAX;
         p_dly_rx_data->rx.timeout_timer.action.callback.callback = notify_rx_timeout;
 
-        p_dly_rx_data->rx.channel = channel;
-        p_dly_rx_data->id         = id;
+        p_dly_rx_data->rx.channel    = channel;
+        p_dly_rx_data->rx.start_time = rx_time;
+
+        if (!dly_rx_data_schedule(p_dly_rx_data, id))
+        {
+            /* DRX with given id is already present. */
+            result = dly_op_state_set(p_dly_rx_data,
+                                      DELAYED_TRX_OP_STATE_PENDING,
+                                      DELAYED_TRX_OP_STATE_STOPPED);
+            NRF_802154_ASSERT(result);
+
+            return false;
+        }
 
         rsch_dly_ts_param_t dly_ts_param =
         {
@@ -908,11 +1336,17 @@ bool nrf_802154_delayed_trx_receive_cancel(uint32_t id)
 
     if (result || was_running)
     {
-        p_dly_op_data->id = NRF_802154_RESERVED_INVALID_ID;
-        stopped           = true;
+        dly_op_id_invalidate(p_dly_op_data);
+        stopped = true;
 
-        nrf_802154_sl_atomic_store_u8((uint8_t *)&p_dly_op_data->state,
-                                      DELAYED_TRX_OP_STATE_STOPPED);
+        if (!dly_op_state_set(p_dly_op_data,
+                              DELAYED_TRX_OP_STATE_PENDING,
+                              DELAYED_TRX_OP_STATE_STOPPED))
+        {
+            (void)dly_op_state_set(p_dly_op_data,
+                                   DELAYED_TRX_OP_STATE_ONGOING,
+                                   DELAYED_TRX_OP_STATE_STOPPED);
+        }
     }
 
     return stopped;
@@ -961,39 +1395,45 @@ void nrf_802154_delayed_trx_rx_started_hook(const uint8_t * p_frame)
 
 bool nrf_802154_delayed_trx_nearest_drx_time_to_midpoint_get(uint32_t * p_drx_time_to_midpoint)
 {
-    bool     result            = false;
-    uint32_t min_time_to_start = 0xffffffff;
-    uint64_t drx_time_to_start = UINT64_C(0xffffffff);
-    uint32_t drx_time_to_midpoint;
-    uint32_t drx_window_duration_time;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            result            = false;
+    rsch_dly_ts_id_t                id                = NRF_802154_RESERVED_INVALID_ID;
+    uint32_t                        timeout_length    = 0;
+    uint64_t                        drx_time_to_start = UINT64_C(0xffffffff);
+
+    // The nearest pending window is at the top of the heap.
+    nrf_802154_mcu_critical_enter(mcu_cs);
 
-    for (int i = 0; i < sizeof(m_dly_rx_data) / sizeof(m_dly_rx_data[0]); i++)
+    if (m_dly_rx_heap_cnt > 0)
     {
-        if (m_dly_rx_data[i].state != DELAYED_TRX_OP_STATE_PENDING)
-        {
-            continue;
-        }
+        const dly_op_data_t * p_dly_op_data = &m_dly_rx_data[m_dly_rx_heap[0]];
+
+        id             = p_dly_op_data->id;
+        timeout_length = p_dly_op_data->rx.timeout_length;
+    }
 
-        result = nrf_802154_rsch_delayed_timeslot_time_to_start_get(m_dly_rx_data[i].id,
-                                                                    &drx_time_to_start);
-        drx_time_to_start += RX_SETUP_TIME_MAX + RX_RAMP_UP_TIME;
+    nrf_802154_mcu_critical_exit(mcu_cs);
 
-        if (result)
-        {
-            min_time_to_start = drx_time_to_start < min_time_to_start ?
-                                (uint32_t)drx_time_to_start : min_time_to_start;
-            drx_window_duration_time = m_dly_rx_data[i].rx.timeout_length -
-                                       (RX_SETUP_TIME_MAX + RX_RAMP_UP_TIME);
-            drx_time_to_midpoint = min_time_to_start + drx_window_duration_time / 2;
-        }
+    if (id != NRF_802154_RESERVED_INVALID_ID)
+    {
+        result = nrf_802154_rsch_delayed_timeslot_time_to_start_get(id, &drx_time_to_start);
     }
 
     if (result)
     {
-        *p_drx_time_to_midpoint = drx_time_to_midpoint;
+        uint32_t drx_window_duration_time = timeout_length -
+                                            (RX_SETUP_TIME_MAX + RX_RAMP_UP_TIME);
+
+        drx_time_to_start      += RX_SETUP_TIME_MAX + RX_RAMP_UP_TIME;
+        *p_drx_time_to_midpoint = (uint32_t)drx_time_to_start + drx_window_duration_time / 2;
     }
 
     return result;
 }
 
+uint32_t nrf_802154_delayed_trx_rx_lead_time_get(void)
+{
+    return RX_SETUP_TIME_MAX + RX_RAMP_UP_TIME;
+}
+
 #endif // NRF_802154_DELAYED_TRX_ENABLED
@@ -181,6 +181,16 @@ void nrf_802154_delayed_trx_rx_started_hook(const uint8_t * p_frame);
  */
 bool nrf_802154_delayed_trx_nearest_drx_time_to_midpoint_get(uint32_t * p_drx_time_to_midpoint);
 
+/**
+ * @brief Gets the time in microseconds by which a delayed reception timeslot precedes the start
+ *        of its reception window.
+ *
+ * A reception window must be requested at least this long before its start.
+ *
+ * @return Time to prepare and ramp up the reception before the window starts.
+ */
+uint32_t nrf_802154_delayed_trx_rx_lead_time_get(void);
+
 /**
  *@}
  **/
@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+/**
+ * @file
+ *   This file implements the energy detection sweep of the 802.15.4 driver.
+ *
+ * The core measures the channels selected by this module in turns, each one for the dwell time of
+ * the sweep, and passes every sample to this module. The samples of a channel are accumulated in
+ * a histogram with a running sum and maximum, so the memory needed by the sweep does not depend on
+ * its duration. The statistics are calculated once all the channels have been measured
+ * the requested number of times.
+ *
+ * The channels are visited in a new random order in every iteration of the sweep. With a fixed
+ * order, a channel would be measured at the same offset of every iteration, and interference
+ * with a period that divides the duration of an iteration would be seen always or never.
+ */
+
+#include "mac_features/nrf_802154_ed_sweep.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "platform/nrf_802154_random.h"
+
+#if NRF_802154_ED_SWEEP_ENABLED
+
+#define CHANNEL_MIN   11U  ///< Lowest channel that can be measured.
+#define ITER_DURATION 128U ///< Duration of a single energy detection iteration of the radio [us].
+#define SAMPLE_ITERS  ((NRF_802154_ED_SWEEP_SAMPLE_TIME_US < ITER_DURATION) ? 1U : \
+                       (NRF_802154_ED_SWEEP_SAMPLE_TIME_US / ITER_DURATION)) ///< Iterations in a sample.
+
+#if (NRF_802154_ED_SWEEP_PERCENTILE < 1) || (NRF_802154_ED_SWEEP_PERCENTILE > 100)
+#error "NRF_802154_ED_SWEEP_PERCENTILE must be in range 1-100"
+#endif
+
+#if (NRF_802154_ED_SWEEP_HISTOGRAM_BINS < 1) || (NRF_802154_ED_SWEEP_HISTOGRAM_BIN_WIDTH_DBM < 1)
+#error "The energy detection sweep histogram must have at least one bin of at least 1 dB"
+#endif
+
+static nrf_802154_ed_sweep_params_t m_params;                                  ///< Parameters of the current sweep.
+static uint8_t                      m_order[NRF_802154_ED_SWEEP_CHANNELS_NUM]; ///< Channels of the sweep in the order of the current iteration.
+static uint8_t                      m_order_len;                               ///< Number of channels of the sweep.
+static uint8_t                      m_order_idx;                               ///< Index of the channel being measured in @ref m_order.
+static uint16_t                     m_iteration;                               ///< Number of the current measurement of all the channels.
+static int32_t                      m_sums[NRF_802154_ED_SWEEP_CHANNELS_NUM];  ///< Sums of the samples of the channels [dBm].
+static nrf_802154_ed_sweep_result_t m_result;                                  ///< Result of the sweep.
+
+/**
+ * @brief Shuffles the order of the channels for the next iteration of the sweep.
+ *
+ * The first channel of the new order differs from @p last, if there is another channel, so that
+ * no channel is measured twice in a row.
+ *
+ * @param[in]  last  Last channel of the previous iteration, or 0 if there is none.
+ */
+static void order_shuffle(uint8_t last)
+{
+    for (uint8_t i = m_order_len - 1U; i > 0U; i--)
+    {
+        uint8_t j   = (uint8_t)(nrf_802154_random_get() % (i + 1U));
+        uint8_t tmp = m_order[i];
+
+        m_order[i] = m_order[j];
+        m_order[j] = tmp;
+    }
+
+    if ((m_order_len > 1U) && (m_order[0] == last))
+    {
+        uint8_t j = 1U + (uint8_t)(nrf_802154_random_get() % (m_order_len - 1U));
+
+        m_order[0] = m_order[j];
+        m_order[j] = last;
+    }
+}
+
+/**
+ * @brief Calculates the percentile of the samples of a channel from its histogram.
+ */
+static int8_t percentile_calculate(const nrf_802154_ed_sweep_channel_result_t * p_channel)
+{
+    uint32_t rank  = ((uint32_t)p_channel->samples * NRF_802154_ED_SWEEP_PERCENTILE + 99U) / 100U;
+    uint32_t count = 0U;
+    size_t   bin   = 0U;
+
+    for (; bin < NRF_802154_ED_SWEEP_HISTOGRAM_BINS - 1U; bin++)
+    {
+        count += p_channel->histogram[bin];
+
+        if (count >= rank)
+        {
+            break;
+        }
+    }
+
+    // The samples within the bin are not known, so the highest value that falls into it is used.
+    // The last bin is not bounded from above, but none of its samples exceeds the maximum.
+    int32_t edge = (int32_t)NRF_802154_ED_SWEEP_HISTOGRAM_MIN_DBM +
+                   (int32_t)(bin + 1U) * NRF_802154_ED_SWEEP_HISTOGRAM_BIN_WIDTH_DBM - 1;
+
+    return (edge < p_channel->max_dbm) ? (int8_t)edge : p_channel->max_dbm;
+}
+
+/**
+ * @brief Calculates the statistics of the channels once all the samples are collected.
+ */
+static void result_calculate(void)
+{
+    for (size_t i = 0U; i < NRF_802154_ED_SWEEP_CHANNELS_NUM; i++)
+    {
+        nrf_802154_ed_sweep_channel_result_t * p_channel = &m_result.channels[i];
+        int32_t                                n         = p_channel->samples;
+
+        if (n == 0)
+        {
+            continue;
+        }
+
+        // Round half away from zero, the integer division truncates towards zero
+        p_channel->mean_dbm       = (int8_t)((2 * m_sums[i] + ((m_sums[i] < 0) ? -n : n)) /
+                                             (2 * n));
+        p_channel->percentile_dbm = percentile_calculate(p_channel);
+    }
+}
+
+bool nrf_802154_ed_sweep_params_check(const nrf_802154_ed_sweep_params_t * p_params)
+{
+    if ((p_params->channel_mask == 0U) ||
+        ((p_params->channel_mask & ~NRF_802154_ED_SWEEP_CHANNEL_MASK) != 0U) ||
+        (p_params->iterations == 0U))
+    {
+        return false;
+    }
+
+    // The samples of a channel are counted with 16 bits, so a sweep that would overflow
+    // the counters is rejected. The last sample of a dwell time may be shorter than the others.
+    uint32_t iters_per_dwell   = (p_params->dwell_us > ITER_DURATION) ?
+                                 (p_params->dwell_us / ITER_DURATION) : 1U;
+    uint32_t samples_per_dwell = (iters_per_dwell + SAMPLE_ITERS - 1U) / SAMPLE_ITERS;
+
+    return ((uint64_t)samples_per_dwell * p_params->iterations) <= UINT16_MAX;
+}
+
+void nrf_802154_ed_sweep_start(const nrf_802154_ed_sweep_params_t * p_params)
+{
+    m_params    = *p_params;
+    m_iteration = 0U;
+    m_order_len = 0U;
+    m_order_idx = 0U;
+
+    for (uint8_t i = 0U; i < NRF_802154_ED_SWEEP_CHANNELS_NUM; i++)
+    {
+        if ((p_params->channel_mask & (1UL << (CHANNEL_MIN + i))) != 0U)
+        {
+            m_order[m_order_len++] = CHANNEL_MIN + i;
+        }
+    }
+
+    order_shuffle(0U);
+
+    memset(m_sums, 0, sizeof(m_sums));
+    memset(&m_result, 0, sizeof(m_result));
+    m_result.channel_mask = p_params->channel_mask;
+}
+
+uint8_t nrf_802154_ed_sweep_channel_get(void)
+{
+    return m_order[m_order_idx];
+}
+
+uint32_t nrf_802154_ed_sweep_dwell_get(void)
+{
+    return (m_params.dwell_us > ITER_DURATION) ? m_params.dwell_us : ITER_DURATION;
+}
+
+void nrf_802154_ed_sweep_sample_add(int8_t ed_dbm)
+{
+    size_t                                 idx       = m_order[m_order_idx] - CHANNEL_MIN;
+    nrf_802154_ed_sweep_channel_result_t * p_channel = &m_result.channels[idx];
+    int32_t                                bin       = ((int32_t)ed_dbm -
+                                                        NRF_802154_ED_SWEEP_HISTOGRAM_MIN_DBM) /
+                                                       NRF_802154_ED_SWEEP_HISTOGRAM_BIN_WIDTH_DBM;
+
+    // A sample split by the end of a timeslot or by the antenna diversity is counted twice,
+    // so the counters saturate instead of relying on the limit checked when the sweep was started
+    if (p_channel->samples == UINT16_MAX)
+    {
+        return;
+    }
+
+    if (ed_dbm < NRF_802154_ED_SWEEP_HISTOGRAM_MIN_DBM)
+    {
+        bin = 0;
+    }
+    else if (bin >= NRF_802154_ED_SWEEP_HISTOGRAM_BINS)
+    {
+        bin = NRF_802154_ED_SWEEP_HISTOGRAM_BINS - 1;
+    }
+
+    if ((p_channel->samples == 0U) || (p_channel->max_dbm < ed_dbm))
+    {
+        p_channel->max_dbm = ed_dbm;
+    }
+
+    p_channel->samples++;
+    p_channel->histogram[bin]++;
+    m_sums[idx] += ed_dbm;
+}
+
+bool nrf_802154_ed_sweep_channel_next(void)
+{
+    m_order_idx++;
+
+    if (m_order_idx >= m_order_len)
+    {
+        m_iteration++;
+
+        if (m_iteration >= m_params.iterations)
+        {
+            result_calculate();
+            return false;
+        }
+
+        m_order_idx = 0U;
+        order_shuffle(m_order[m_order_len - 1U]);
+    }
+
+    return true;
+}
+
+const nrf_802154_ed_sweep_result_t * nrf_802154_ed_sweep_result_get(void)
+{
+    return &m_result;
+}
+
+#endif // NRF_802154_ED_SWEEP_ENABLED
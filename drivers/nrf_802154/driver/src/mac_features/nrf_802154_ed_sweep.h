@@ -0,0 +1,110 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_ED_SWEEP_H
+#define NRF_802154_ED_SWEEP_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+
+/**
+ * @brief Checks if the parameters of an energy detection sweep are valid.
+ *
+ * The channel mask must select at least one channel and no channel outside of
+ * @ref NRF_802154_ED_SWEEP_CHANNEL_MASK, at least one iteration is required, and the number of
+ * samples of a single channel must not exceed @c UINT16_MAX.
+ *
+ * @param[in]  p_params  Pointer to the parameters of the sweep.
+ *
+ * @retval  true   The parameters are valid.
+ * @retval  false  The parameters are invalid.
+ */
+bool nrf_802154_ed_sweep_params_check(const nrf_802154_ed_sweep_params_t * p_params);
+
+/**
+ * @brief Starts a new energy detection sweep.
+ *
+ * The statistics of the previous sweep are discarded and the first channel of the sweep is
+ * selected.
+ *
+ * @param[in]  p_params  Pointer to the parameters of the sweep, checked with
+ *                       @ref nrf_802154_ed_sweep_params_check.
+ */
+void nrf_802154_ed_sweep_start(const nrf_802154_ed_sweep_params_t * p_params);
+
+/**
+ * @brief Gets the channel to measure.
+ *
+ * @returns  Channel selected by the sweep.
+ */
+uint8_t nrf_802154_ed_sweep_channel_get(void);
+
+/**
+ * @brief Gets the time of a single measurement of a channel.
+ *
+ * @returns  Dwell time of the sweep, but not less than a single energy detection iteration [us].
+ */
+uint32_t nrf_802154_ed_sweep_dwell_get(void);
+
+/**
+ * @brief Adds a sample measured on the selected channel.
+ *
+ * @param[in]  ed_dbm  Peak energy measured during the sample, in dBm.
+ */
+void nrf_802154_ed_sweep_sample_add(int8_t ed_dbm);
+
+/**
+ * @brief Selects the next channel to measure.
+ *
+ * Every channel of the sweep is measured once per iteration, in a random order that changes from
+ * one iteration to the next.
+ *
+ * @retval  true   The next channel is selected.
+ * @retval  false  All the channels have been measured the requested number of times and
+ *                 the result of the sweep is ready.
+ */
+bool nrf_802154_ed_sweep_channel_next(void);
+
+/**
+ * @brief Gets the result of the last energy detection sweep.
+ *
+ * The result stays valid until the next sweep is started.
+ *
+ * @returns  Pointer to the result of the sweep.
+ */
+const nrf_802154_ed_sweep_result_t * nrf_802154_ed_sweep_result_get(void);
+
+#endif // NRF_802154_ED_SWEEP_H
@@ -57,6 +57,107 @@
 #define SHORT_ADDR_CHECK_OFFSET    (DEST_ADDR_OFFSET + SHORT_ADDRESS_SIZE)
 #define EXTENDED_ADDR_CHECK_OFFSET (DEST_ADDR_OFFSET + EXTENDED_ADDRESS_SIZE)
 
+/**
+ * @brief Destination addressing fields of a frame.
+ */
+typedef struct
+{
+    const uint8_t * p_panid;   ///< Destination PAN ID or NULL if not present.
+    const uint8_t * p_addr;    ///< Destination address or NULL if not present.
+    uint8_t         addr_size; ///< Size of the destination address, 0 if not present.
+} dst_addressing_t;
+
+static uint8_t m_frame_identity; ///< Index of the identity the last accepted frame is addressed to.
+
+/**
+ * @brief Check if the Multipurpose frame has the long Frame Control field.
+ *
+ * @param[in] p_frame_data  Pointer to the frame parser data of a Multipurpose frame.
+ *
+ * @retval true   The frame has the long Frame Control field.
+ * @retval false  The frame has the short Frame Control field.
+ */
+static bool mp_long_fcf_is_set(const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    return (p_frame_data->p_frame[MP_LONG_FRAME_CONTROL_OFFSET] & MP_LONG_FRAME_CONTROL_BIT) ?
+           true : false;
+}
+
+/**
+ * @brief Get the destination addressing fields of a Multipurpose frame.
+ *
+ * The frame parser does not support the Multipurpose frame format, so the fields are located
+ * according to IEEE 802.15.4-2015: 7.3.5. The frame is expected to be received up to the end of
+ * the destination addressing fields.
+ *
+ * @param[in]  p_frame_data  Pointer to the frame parser data of a Multipurpose frame.
+ * @param[out] p_dst         Destination addressing fields of the frame.
+ *
+ * @retval true   The destination addressing fields were found.
+ * @retval false  The destination address mode is reserved or the fields exceed the frame.
+ */
+static bool mp_dst_addressing_get(const nrf_802154_frame_parser_data_t * p_frame_data,
+                                  dst_addressing_t                     * p_dst)
+{
+    const uint8_t * p_frame  = p_frame_data->p_frame;
+    bool            long_fcf = mp_long_fcf_is_set(p_frame_data);
+    uint8_t         offset   = PSDU_OFFSET + (long_fcf ? FCF_SIZE : MP_SHORT_FCF_SIZE);
+
+    if (!long_fcf || !(p_frame[MP_DSN_SUPPRESS_OFFSET] & MP_DSN_SUPPRESS_BIT))
+    {
+        offset += DSN_SIZE;
+    }
+
+    if (long_fcf && (p_frame[MP_PAN_ID_PRESENT_OFFSET] & MP_PAN_ID_PRESENT_BIT))
+    {
+        p_dst->p_panid = &p_frame[offset];
+        offset        += PAN_ID_SIZE;
+    }
+    else
+    {
+        p_dst->p_panid = NULL;
+    }
+
+    switch (p_frame[MP_DEST_ADDR_TYPE_OFFSET] & MP_DEST_ADDR_TYPE_MASK)
+    {
+        case MP_DEST_ADDR_TYPE_NONE:
+            p_dst->addr_size = 0U;
+            break;
+
+        case MP_DEST_ADDR_TYPE_SHORT:
+            p_dst->addr_size = SHORT_ADDRESS_SIZE;
+            break;
+
+        case MP_DEST_ADDR_TYPE_EXTENDED:
+            p_dst->addr_size = EXTENDED_ADDRESS_SIZE;
+            break;
+
+        default:
+            return false;
+    }
+
+    p_dst->p_addr = (p_dst->addr_size != 0U) ? &p_frame[offset] : NULL;
+    offset       += p_dst->addr_size;
+
+    return (offset + FCS_SIZE) <=
+           (PHR_SIZE + nrf_802154_frame_parser_frame_length_get(p_frame_data));
+}
+
+/**
+ * @brief Get the destination addressing fields of a frame resolved by the frame parser.
+ *
+ * @param[in]  p_frame_data  Pointer to the frame parser data.
+ * @param[out] p_dst         Destination addressing fields of the frame.
+ */
+static void dst_addressing_get(const nrf_802154_frame_parser_data_t * p_frame_data,
+                               dst_addressing_t                     * p_dst)
+{
+    p_dst->p_panid   = nrf_802154_frame_parser_dst_panid_get(p_frame_data);
+    p_dst->p_addr    = nrf_802154_frame_parser_dst_addr_get(p_frame_data);
+    p_dst->addr_size =
+        p_dst->p_addr ? nrf_802154_frame_parser_dst_addr_size_get(p_frame_data) : 0U;
+}
+
 /**
  * @brief Check if given frame version is allowed for given frame type.
  *
@@ -238,9 +339,19 @@ static nrf_802154_rx_error_t dst_addressing_fcf_check_2015(
         break;
 
         case FRAME_TYPE_MULTIPURPOSE:
-            // TODO: Implement dst addressing filtering according to 2015 spec
-            result = NRF_802154_RX_ERROR_INVALID_FRAME;
-            break;
+        {
+            dst_addressing_t dst;
+
+            if (mp_dst_addressing_get(p_frame_data, &dst))
+            {
+                result = NRF_802154_RX_ERROR_NONE;
+            }
+            else
+            {
+                result = NRF_802154_RX_ERROR_INVALID_FRAME;
+            }
+        }
+        break;
 
         case FRAME_TYPE_FRAGMENT:
         case FRAME_TYPE_EXTENDED:
@@ -259,7 +370,8 @@ static nrf_802154_rx_error_t dst_addressing_fcf_check_2015(
  * @brief Verify if destination addressing bits in the FCF field are correct.
  *
  * This function relays its arguments to either @ref dst_addressing_end_offset_get_2006
- * or @ref dst_addressing_end_offset_get_2015 depending on the frame version.
+ * or @ref dst_addressing_end_offset_get_2015 depending on the frame version. Multipurpose frames
+ * are defined by the 2015 specification only, so they are always relayed to the latter.
  *
  * @param[in]  p_frame_data  Pointer to the frame parser data.
  * @param[in]  frame_type    Type of incoming frame.
@@ -278,6 +390,11 @@ static nrf_802154_rx_error_t dst_addressing_fcf_check(
 {
     nrf_802154_rx_error_t result;
 
+    if (frame_type == FRAME_TYPE_MULTIPURPOSE)
+    {
+        return dst_addressing_fcf_check_2015(p_frame_data, frame_type);
+    }
+
     switch (frame_version)
     {
         case FRAME_VERSION_0:
@@ -297,25 +414,28 @@ static nrf_802154_rx_error_t dst_addressing_fcf_check(
 }
 
 /**
- * Verify if destination PAN Id of incoming frame allows processing by this node.
+ * Verify if destination PAN Id of incoming frame allows processing by an identity of this node.
  *
  * @param[in] p_panid     Pointer of PAN ID of incoming frame.
+ * @param[in] p_identity  Pointer to the identity.
  * @param[in] frame_type  Type of the frame being filtered.
  *
  * @retval true   PAN Id of incoming frame allows further processing of the frame.
  * @retval false  PAN Id of incoming frame does not allow further processing.
  */
-static bool dst_pan_id_check(const uint8_t * p_panid, uint8_t frame_type)
+static bool dst_pan_id_check(const uint8_t               * p_panid,
+                             const nrf_802154_identity_t * p_identity,
+                             uint8_t                       frame_type)
 {
     bool result;
 
-    if ((0 == memcmp(p_panid, nrf_802154_pib_pan_id_get(), PAN_ID_SIZE)) ||
+    if ((0 == memcmp(p_panid, p_identity->pan_id, PAN_ID_SIZE)) ||
         (0 == memcmp(p_panid, BROADCAST_ADDRESS, PAN_ID_SIZE)))
     {
         result = true;
     }
     else if ((FRAME_TYPE_BEACON == frame_type) &&
-             (0 == memcmp(nrf_802154_pib_pan_id_get(), BROADCAST_ADDRESS, PAN_ID_SIZE)))
+             (0 == memcmp(p_identity->pan_id, BROADCAST_ADDRESS, PAN_ID_SIZE)))
     {
         result = true;
     }
@@ -328,18 +448,21 @@ static bool dst_pan_id_check(const uint8_t * p_panid, uint8_t frame_type)
 }
 
 /**
- * Verify if destination short address of incoming frame allows processing by this node.
+ * Verify if destination short address of incoming frame allows processing by an identity of this
+ * node.
  *
  * @param[in] p_dst_addr  Pointer of destination address of incoming frame.
+ * @param[in] p_identity  Pointer to the identity.
  *
  * @retval true   Destination address of incoming frame allows further processing of the frame.
  * @retval false  Destination address of incoming frame does not allow further processing.
  */
-static bool dst_short_addr_check(const uint8_t * p_dst_addr)
+static bool dst_short_addr_check(const uint8_t               * p_dst_addr,
+                                 const nrf_802154_identity_t * p_identity)
 {
     bool result;
 
-    if ((0 == memcmp(p_dst_addr, nrf_802154_pib_short_address_get(), SHORT_ADDRESS_SIZE)) ||
+    if ((0 == memcmp(p_dst_addr, p_identity->short_addr, SHORT_ADDRESS_SIZE)) ||
         (0 == memcmp(p_dst_addr, BROADCAST_ADDRESS, SHORT_ADDRESS_SIZE)))
     {
         result = true;
@@ -353,18 +476,21 @@ static bool dst_short_addr_check(const uint8_t * p_dst_addr)
 }
 
 /**
- * Verify if destination extended address of incoming frame allows processing by this node.
+ * Verify if destination extended address of incoming frame allows processing by an identity of
+ * this node.
  *
  * @param[in] p_dst_addr  Pointer of destination address of incoming frame.
+ * @param[in] p_identity  Pointer to the identity.
  *
  * @retval true   Destination address of incoming frame allows further processing of the frame.
  * @retval false  Destination address of incoming frame does not allow further processing.
  */
-static bool dst_extended_addr_check(const uint8_t * p_dst_addr)
+static bool dst_extended_addr_check(const uint8_t               * p_dst_addr,
+                                    const nrf_802154_identity_t * p_identity)
 {
     bool result;
 
-    if (0 == memcmp(p_dst_addr, nrf_802154_pib_extended_address_get(), EXTENDED_ADDRESS_SIZE))
+    if (0 == memcmp(p_dst_addr, p_identity->extended_addr, EXTENDED_ADDRESS_SIZE))
     {
         result = true;
     }
@@ -377,55 +503,79 @@ static bool dst_extended_addr_check(const uint8_t * p_dst_addr)
 }
 
 /**
- * Verify if destination addressing of incoming frame allows processing by this node.
- * This function checks addressing according to IEEE 802.15.4-2015.
+ * Verify if destination addressing of incoming frame allows processing by an identity of this
+ * node.
  *
- * @param[in]  p_frame_data Pointer to the frame parser data.
+ * @param[in] p_dst       Destination addressing fields of incoming frame.
+ * @param[in] p_identity  Pointer to the identity.
+ * @param[in] frame_type  Type of the frame being filtered.
  *
- * @retval NRF_802154_RX_ERROR_NONE               Destination address of incoming frame allows further processing of the frame.
- * @retval NRF_802154_RX_ERROR_INVALID_FRAME      Received frame is invalid.
- * @retval NRF_802154_RX_ERROR_INVALID_DEST_ADDR  Destination address of incoming frame does not allow further processing.
+ * @retval true   Destination addressing of incoming frame allows further processing of the frame.
+ * @retval false  Destination addressing of incoming frame does not allow further processing.
  */
-static nrf_802154_rx_error_t dst_addr_check(const nrf_802154_frame_parser_data_t * p_frame_data)
+static bool identity_dst_addr_check(const dst_addressing_t      * p_dst,
+                                    const nrf_802154_identity_t * p_identity,
+                                    uint8_t                       frame_type)
 {
-    const uint8_t * p_dst_panid = nrf_802154_frame_parser_dst_panid_get(p_frame_data);
-    const uint8_t * p_dst_addr  = nrf_802154_frame_parser_dst_addr_get(p_frame_data);
-    uint8_t         frame_type  = nrf_802154_frame_parser_frame_type_get(p_frame_data);
+    bool result;
 
-    if (p_dst_panid != NULL)
+    if ((p_dst->p_panid != NULL) && !dst_pan_id_check(p_dst->p_panid, p_identity, frame_type))
     {
-        if (!dst_pan_id_check(p_dst_panid, frame_type))
-        {
-            return NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
-        }
+        return false;
     }
 
-    uint8_t dst_addr_size =
-        p_dst_addr ? nrf_802154_frame_parser_dst_addr_size_get(p_frame_data) : 0U;
-
-    switch (dst_addr_size)
+    switch (p_dst->addr_size)
     {
         case SHORT_ADDRESS_SIZE:
-            return dst_short_addr_check(p_dst_addr) ? NRF_802154_RX_ERROR_NONE :
-                   NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
+            result = dst_short_addr_check(p_dst->p_addr, p_identity);
+            break;
 
         case EXTENDED_ADDRESS_SIZE:
-            return dst_extended_addr_check(p_dst_addr) ? NRF_802154_RX_ERROR_NONE :
-                   NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
+            result = dst_extended_addr_check(p_dst->p_addr, p_identity);
+            break;
 
         case 0:
             // Allow frames destined to the Pan Coordinator without destination address or
             // beacon frames without destination address
-            return (nrf_802154_pib_pan_coord_get() ||
-                    (frame_type ==
-                     FRAME_TYPE_BEACON)) ? NRF_802154_RX_ERROR_NONE :
-                   NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
+            result = (nrf_802154_pib_pan_coord_get() || (frame_type == FRAME_TYPE_BEACON));
+            break;
 
         default:
+            result = false;
             NRF_802154_ASSERT(false);
     }
 
-    return NRF_802154_RX_ERROR_INVALID_FRAME;
+    return result;
+}
+
+/**
+ * Verify if destination addressing of incoming frame allows processing by this node.
+ * This function checks addressing according to IEEE 802.15.4-2015.
+ *
+ * The identities of this node are checked in the order of their indexes and the index of the first
+ * one that accepts the frame is stored. The check takes at most @ref NRF_802154_IDENTITIES_NUM
+ * comparisons of each destination addressing field.
+ *
+ * @param[in]  p_dst       Destination addressing fields of incoming frame.
+ * @param[in]  frame_type  Type of the frame being filtered.
+ *
+ * @retval NRF_802154_RX_ERROR_NONE               Destination address of incoming frame allows further processing of the frame.
+ * @retval NRF_802154_RX_ERROR_INVALID_DEST_ADDR  Destination address of incoming frame does not allow further processing.
+ */
+static nrf_802154_rx_error_t dst_addr_check(const dst_addressing_t * p_dst, uint8_t frame_type)
+{
+    for (uint8_t i = 0U; i < NRF_802154_IDENTITIES_NUM; i++)
+    {
+        const nrf_802154_identity_t * p_identity = nrf_802154_pib_identity_get(i);
+
+        if ((p_identity != NULL) && identity_dst_addr_check(p_dst, p_identity, frame_type))
+        {
+            m_frame_identity = i;
+            return NRF_802154_RX_ERROR_NONE;
+        }
+    }
+
+    return NRF_802154_RX_ERROR_INVALID_DEST_ADDR;
 }
 
 nrf_802154_rx_error_t nrf_802154_filter_frame_part(
@@ -439,11 +589,20 @@ nrf_802154_rx_error_t nrf_802154_filter_frame_part(
         p_frame_data);
     uint8_t psdu_length = nrf_802154_frame_parser_frame_length_get(
         p_frame_data);
+    bool multipurpose = (frame_type == FRAME_TYPE_MULTIPURPOSE);
+
+    if (multipurpose && !mp_long_fcf_is_set(p_frame_data))
+    {
+        // The short Frame Control field of a Multipurpose frame has no Frame Version field
+        frame_version = FRAME_VERSION_0;
+    }
 
     if (filter_mode & NRF_802154_FILTER_MODE_FCF)
     {
-        NRF_802154_ASSERT(nrf_802154_frame_parser_parse_level_get(
-                              p_frame_data) >= PARSE_LEVEL_FCF_OFFSETS);
+        // The frame parser does not resolve offsets of Multipurpose frames
+        NRF_802154_ASSERT(multipurpose ||
+                          (nrf_802154_frame_parser_parse_level_get(
+                               p_frame_data) >= PARSE_LEVEL_FCF_OFFSETS));
 
         if ((psdu_length < IMM_ACK_LENGTH) || (psdu_length > MAX_PACKET_SIZE))
         {
@@ -470,11 +629,32 @@ nrf_802154_rx_error_t nrf_802154_filter_frame_part(
 
     if (filter_mode & NRF_802154_FILTER_MODE_DST_ADDR)
     {
-        NRF_802154_ASSERT(nrf_802154_frame_parser_parse_level_get(
-                              p_frame_data) >= PARSE_LEVEL_DST_ADDRESSING_END);
+        dst_addressing_t dst;
+
+        m_frame_identity = 0U;
+
+        if (multipurpose)
+        {
+            if (!mp_dst_addressing_get(p_frame_data, &dst))
+            {
+                return NRF_802154_RX_ERROR_INVALID_FRAME;
+            }
+        }
+        else
+        {
+            NRF_802154_ASSERT(nrf_802154_frame_parser_parse_level_get(
+                                  p_frame_data) >= PARSE_LEVEL_DST_ADDRESSING_END);
+
+            dst_addressing_get(p_frame_data, &dst);
+        }
 
-        result = dst_addr_check(p_frame_data);
+        result = dst_addr_check(&dst, frame_type);
     }
 
     return result;
 }
+
+uint8_t nrf_802154_filter_frame_identity_get(void)
+{
+    return m_frame_identity;
+}
@@ -87,6 +87,9 @@ typedef uint32_t nrf_802154_filter_mode_t;
  * with both @c NRF_802154_FILTER_MODE_FCF and @c NRF_802154_FILTER_MODE_DST_ADDR scopes in
  * two iterations, or both at once using @c NRF_802154_FILTER_MODE_ALL.
  *
+ * Multipurpose frames are not parsed by the frame parser. They are filtered based on the content
+ * of the frame, which must be received up to the end of the destination addressing fields.
+ *
  * @param[in] p_frame_data Pointer to a frame parser data of the frame to be filtered.
  * @param[in] filter_mode  The filtering scope that should be performed by the function.
  *
@@ -100,6 +103,17 @@ nrf_802154_rx_error_t nrf_802154_filter_frame_part(
     const nrf_802154_frame_parser_data_t * p_frame_data,
     nrf_802154_filter_mode_t               filter_mode);
 
+/**
+ * @brief Gets the index of the identity of this node the last filtered frame is addressed to.
+ *
+ * The index is valid after @ref nrf_802154_filter_frame_part accepted a frame in the
+ * @c NRF_802154_FILTER_MODE_DST_ADDR filter mode, until the next frame is filtered in this mode.
+ * Frames addressed to broadcast addresses are assigned to the first identity that accepts them.
+ *
+ * @returns  Index of the identity, lower than @ref NRF_802154_IDENTITIES_NUM.
+ */
+uint8_t nrf_802154_filter_frame_identity_get(void);
+
 /**
  *@}
  **/
@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the receive filter rules of the 802.15.4 driver.
+ *
+ */
+
+#include "mac_features/nrf_802154_filter_rules.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_sl_atomics.h"
+
+#if NRF_802154_FILTER_RULES_ENABLED
+
+/** Fields of the rule that are known once the Frame Control field is received. */
+#define FCF_FIELDS  (NRF_802154_FILTER_RULE_FIELD_SECURITY | NRF_802154_FILTER_RULE_FIELD_IE_PRESENT)
+
+/** Fields of the rule that are known once the addressing fields are received. */
+#define ADDR_FIELDS (NRF_802154_FILTER_RULE_FIELD_SRC_PAN_ID | NRF_802154_FILTER_RULE_FIELD_SRC_ADDR)
+
+/**
+ * @brief Result of matching a frame against a rule.
+ */
+typedef enum
+{
+    RULE_MATCH_NO,      ///< The frame does not match the rule.
+    RULE_MATCH_YES,     ///< The frame matches the rule.
+    RULE_MATCH_UNKNOWN, ///< The fields matched by the rule have not been received yet.
+} rule_match_t;
+
+/**
+ * @brief Entry of the rule table.
+ */
+typedef struct
+{
+    nrf_802154_filter_rule_t rule;                                 ///< Rule with the source address prefix masked.
+    uint8_t                  src_addr_mask[EXTENDED_ADDRESS_SIZE]; ///< Mask of the prefix bits of the source address.
+    uint8_t                  src_addr_size;                        ///< Size of the source address matched by the rule.
+    uint32_t                 hits;                                 ///< Number of frames that matched the rule.
+    bool                     used;                                 ///< If the entry holds a rule.
+} rule_entry_t;
+
+static rule_entry_t                      m_rules[NRF_802154_FILTER_RULES_NUM];
+static uint8_t                           m_next_rule; ///< Index of the next rule to be evaluated for the current frame.
+static nrf_802154_filter_rules_verdict_t m_verdict;   ///< Verdict of the rules for the current frame.
+
+/**
+ * @brief Prepares the mask of the most significant @p prefix_len bits of a little-endian address.
+ */
+static void src_addr_mask_prepare(uint8_t * p_mask, uint8_t addr_size, uint8_t prefix_len)
+{
+    memset(p_mask, 0, EXTENDED_ADDRESS_SIZE);
+
+    for (uint8_t i = addr_size; (i > 0U) && (prefix_len > 0U); i--)
+    {
+        uint8_t bits = (prefix_len < 8U) ? prefix_len : 8U;
+
+        p_mask[i - 1U] = (uint8_t)(0xffU << (8U - bits));
+        prefix_len    -= bits;
+    }
+}
+
+/**
+ * @brief Matches the source PAN ID of a frame against a rule.
+ */
+static bool src_pan_id_match(const rule_entry_t                   * p_entry,
+                             const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    const uint8_t * p_panid = nrf_802154_frame_parser_src_panid_get(p_frame_data);
+
+    if (p_panid == NULL)
+    {
+        p_panid = nrf_802154_frame_parser_dst_panid_get(p_frame_data);
+    }
+
+    return (p_panid != NULL) && (memcmp(p_panid, p_entry->rule.src_pan_id, PAN_ID_SIZE) == 0);
+}
+
+/**
+ * @brief Matches the source address of a frame against the prefix of a rule.
+ */
+static bool src_addr_match(const rule_entry_t                   * p_entry,
+                           const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+    const uint8_t * p_src_addr = nrf_802154_frame_parser_src_addr_get(p_frame_data);
+
+    if ((p_src_addr == NULL) ||
+        (nrf_802154_frame_parser_src_addr_size_get(p_frame_data) != p_entry->src_addr_size))
+    {
+        return false;
+    }
+
+    for (uint8_t i = 0U; i < p_entry->src_addr_size; i++)
+    {
+        if ((p_src_addr[i] & p_entry->src_addr_mask[i]) != p_entry->rule.src_addr[i])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Matches a frame against a rule.
+ *
+ * The fields are matched in the order in which they are received, so that a frame that mismatches
+ * a rule on an early field is not matched on the later ones.
+ */
+static rule_match_t rule_match(const rule_entry_t                   * p_entry,
+                               const nrf_802154_frame_parser_data_t * p_frame_data,
+                               bool                                   frame_complete)
+{
+    const nrf_802154_filter_rule_t * p_rule     = &p_entry->rule;
+    nrf_802154_frame_parser_level_t  level      =
+        nrf_802154_frame_parser_parse_level_get(p_frame_data);
+    rule_match_t                     incomplete = frame_complete ? RULE_MATCH_NO : RULE_MATCH_UNKNOWN;
+    uint8_t                          frame_type =
+        nrf_802154_frame_parser_frame_type_get(p_frame_data);
+
+    if ((p_rule->fields & NRF_802154_FILTER_RULE_FIELD_FRAME_TYPE) &&
+        !(p_rule->frame_types & (1U << frame_type)))
+    {
+        return RULE_MATCH_NO;
+    }
+
+    if (!(p_rule->fields & (FCF_FIELDS | ADDR_FIELDS)))
+    {
+        return RULE_MATCH_YES;
+    }
+
+    if (frame_type == FRAME_TYPE_MULTIPURPOSE)
+    {
+        // The frame parser does not support Multipurpose frames, so only their type is matched.
+        return RULE_MATCH_NO;
+    }
+
+    if (level < PARSE_LEVEL_FCF_OFFSETS)
+    {
+        return incomplete;
+    }
+
+    if ((p_rule->fields & NRF_802154_FILTER_RULE_FIELD_SECURITY) &&
+        (nrf_802154_frame_parser_security_enabled_bit_is_set(p_frame_data) !=
+         p_rule->security_enabled))
+    {
+        return RULE_MATCH_NO;
+    }
+
+    if ((p_rule->fields & NRF_802154_FILTER_RULE_FIELD_IE_PRESENT) &&
+        (nrf_802154_frame_parser_ie_present_bit_is_set(p_frame_data) != p_rule->ie_present))
+    {
+        return RULE_MATCH_NO;
+    }
+
+    if (!(p_rule->fields & ADDR_FIELDS))
+    {
+        return RULE_MATCH_YES;
+    }
+
+    if (level < PARSE_LEVEL_ADDRESSING_END)
+    {
+        return incomplete;
+    }
+
+    if ((p_rule->fields & NRF_802154_FILTER_RULE_FIELD_SRC_PAN_ID) &&
+        !src_pan_id_match(p_entry, p_frame_data))
+    {
+        return RULE_MATCH_NO;
+    }
+
+    if ((p_rule->fields & NRF_802154_FILTER_RULE_FIELD_SRC_ADDR) &&
+        !src_addr_match(p_entry, p_frame_data))
+    {
+        return RULE_MATCH_NO;
+    }
+
+    return RULE_MATCH_YES;
+}
+
+void nrf_802154_filter_rules_init(void)
+{
+    memset(m_rules, 0, sizeof(m_rules));
+    nrf_802154_filter_rules_frame_reset();
+}
+
+bool nrf_802154_filter_rules_set(uint8_t index, const nrf_802154_filter_rule_t * p_rule)
+{
+    rule_entry_t * p_entry;
+    uint8_t        src_addr_size;
+
+    if (index >= NRF_802154_FILTER_RULES_NUM)
+    {
+        return false;
+    }
+
+    switch (p_rule->action)
+    {
+        case NRF_802154_FILTER_RULE_ACTION_ACCEPT:
+        case NRF_802154_FILTER_RULE_ACTION_DROP:
+        case NRF_802154_FILTER_RULE_ACTION_COUNT:
+            break;
+
+        default:
+            return false;
+    }
+
+    src_addr_size = p_rule->src_addr_extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+
+    if ((p_rule->fields & NRF_802154_FILTER_RULE_FIELD_SRC_ADDR) &&
+        (p_rule->src_addr_prefix_len > (src_addr_size * 8U)))
+    {
+        return false;
+    }
+
+    p_entry = &m_rules[index];
+
+    // The rule is not evaluated while it is being modified.
+    p_entry->used = false;
+    __DMB();
+
+    p_entry->rule          = *p_rule;
+    p_entry->src_addr_size = src_addr_size;
+    p_entry->hits          = 0U;
+    src_addr_mask_prepare(p_entry->src_addr_mask, src_addr_size, p_rule->src_addr_prefix_len);
+
+    for (uint8_t i = 0U; i < EXTENDED_ADDRESS_SIZE; i++)
+    {
+        p_entry->rule.src_addr[i] &= p_entry->src_addr_mask[i];
+    }
+
+    __DMB();
+    p_entry->used = true;
+
+    return true;
+}
+
+bool nrf_802154_filter_rules_clear(uint8_t index)
+{
+    if (index >= NRF_802154_FILTER_RULES_NUM)
+    {
+        return false;
+    }
+
+    m_rules[index].used = false;
+
+    return true;
+}
+
+uint32_t nrf_802154_filter_rules_hits_get(uint8_t index)
+{
+    return (index < NRF_802154_FILTER_RULES_NUM) ? m_rules[index].hits : 0U;
+}
+
+void nrf_802154_filter_rules_frame_reset(void)
+{
+    m_next_rule = 0U;
+    m_verdict   = NRF_802154_FILTER_RULES_VERDICT_PENDING;
+}
+
+nrf_802154_filter_rules_verdict_t nrf_802154_filter_rules_evaluate(
+    const nrf_802154_frame_parser_data_t * p_frame_data,
+    bool                                   frame_complete)
+{
+    while ((m_verdict == NRF_802154_FILTER_RULES_VERDICT_PENDING) &&
+           (m_next_rule < NRF_802154_FILTER_RULES_NUM))
+    {
+        rule_entry_t * p_entry = &m_rules[m_next_rule];
+
+        if (p_entry->used)
+        {
+            rule_match_t match = rule_match(p_entry, p_frame_data, frame_complete);
+
+            if (match == RULE_MATCH_UNKNOWN)
+            {
+                return NRF_802154_FILTER_RULES_VERDICT_PENDING;
+            }
+
+            if (match == RULE_MATCH_YES)
+            {
+                p_entry->hits++;
+
+                switch (p_entry->rule.action)
+                {
+                    case NRF_802154_FILTER_RULE_ACTION_ACCEPT:
+                        m_verdict = NRF_802154_FILTER_RULES_VERDICT_ACCEPT;
+                        break;
+
+                    case NRF_802154_FILTER_RULE_ACTION_DROP:
+                        m_verdict = NRF_802154_FILTER_RULES_VERDICT_DROP;
+                        break;
+
+                    default:
+                        // Counting rules do not decide on the frame.
+                        break;
+                }
+            }
+        }
+
+        m_next_rule++;
+    }
+
+    if (m_verdict == NRF_802154_FILTER_RULES_VERDICT_PENDING)
+    {
+        m_verdict = NRF_802154_FILTER_RULES_VERDICT_ACCEPT;
+    }
+
+    return m_verdict;
+}
+
+#endif // NRF_802154_FILTER_RULES_ENABLED
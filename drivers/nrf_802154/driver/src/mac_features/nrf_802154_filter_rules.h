@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_FILTER_RULES_H
+#define NRF_802154_FILTER_RULES_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+/**
+ * @brief Results of the evaluation of the receive filter rules.
+ */
+typedef enum
+{
+    NRF_802154_FILTER_RULES_VERDICT_PENDING, ///< The rules need more fields of the frame.
+    NRF_802154_FILTER_RULES_VERDICT_ACCEPT,  ///< The frame is to be received.
+    NRF_802154_FILTER_RULES_VERDICT_DROP,    ///< The frame is to be dropped.
+} nrf_802154_filter_rules_verdict_t;
+
+/**
+ * @brief Initializes the receive filter rules.
+ */
+void nrf_802154_filter_rules_init(void);
+
+/**
+ * @brief Sets a receive filter rule and clears its hit counter.
+ *
+ * @param[in]  index   Index of the rule.
+ * @param[in]  p_rule  Pointer to the rule.
+ *
+ * @retval  true   The rule has been set.
+ * @retval  false  The index is out of range or the rule is invalid.
+ */
+bool nrf_802154_filter_rules_set(uint8_t index, const nrf_802154_filter_rule_t * p_rule);
+
+/**
+ * @brief Removes a receive filter rule.
+ *
+ * @param[in]  index  Index of the rule.
+ *
+ * @retval  true   The rule has been removed.
+ * @retval  false  The index is out of range.
+ */
+bool nrf_802154_filter_rules_clear(uint8_t index);
+
+/**
+ * @brief Gets the number of frames that matched a receive filter rule.
+ *
+ * @param[in]  index  Index of the rule.
+ *
+ * @returns  Number of frames that matched the rule since it was set.
+ */
+uint32_t nrf_802154_filter_rules_hits_get(uint8_t index);
+
+/**
+ * @brief Starts the evaluation of the rules for a new frame.
+ */
+void nrf_802154_filter_rules_frame_reset(void);
+
+/**
+ * @brief Evaluates the receive filter rules for the frame being received.
+ *
+ * The rules are evaluated in the order of their indexes. The evaluation stops at the first rule
+ * that needs the fields beyond the current parse level of the frame and is resumed from that rule
+ * by the next call.
+ *
+ * @param[in]  p_frame_data    Pointer to the parser data of the frame being received.
+ * @param[in]  frame_complete  If the whole frame has been received. Rules matching the fields that
+ *                             are not present in the frame are not matched then.
+ *
+ * @returns  Verdict of the rules. The frames that matched no accepting or dropping rule are
+ *           accepted once all rules are evaluated.
+ */
+nrf_802154_filter_rules_verdict_t nrf_802154_filter_rules_evaluate(
+    const nrf_802154_frame_parser_data_t * p_frame_data,
+    bool                                   frame_complete);
+
+#endif // NRF_802154_FILTER_RULES_H
@@ -42,6 +42,7 @@
 
 #include "mac_features/nrf_802154_frame_parser.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
+#include "mac_features/nrf_802154_neighbor_table.h"
 #include "nrf_802154_core.h"
 #include "nrf_802154_nrfx_addons.h"
 #include "nrf_802154_tx_work_buffer.h"
@@ -49,6 +50,7 @@
 #include "nrf_802154_sl_timer.h"
 
 #include "nrf_802154_assert.h"
+#include <string.h>
 
 #if defined(CONFIG_SOC_SERIES_BSIM_NRFXX)
 #include "nrf_802154_bsim_utils.h"
@@ -432,26 +434,34 @@ static uint8_t margin_scale(int16_t margin)
  */
 static void link_metrics_ie_write_commit(bool * p_written)
 {
-    if ((mp_lm_rssi_addr != NULL) || (mp_lm_margin_addr != NULL))
+    int8_t  rssi = nrf_802154_core_last_frame_rssi_get();
+    uint8_t lqi  = nrf_802154_core_last_frame_lqi_get();
+
+#if NRF_802154_NEIGHBOR_TABLE_ENABLED && NRF_802154_NEIGHBOR_TABLE_LINK_METRICS_ENABLED
+    if ((mp_lm_rssi_addr != NULL) || (mp_lm_margin_addr != NULL) || (mp_lm_lqi_addr != NULL))
     {
-        int8_t rssi = (uint8_t)nrf_802154_core_last_frame_rssi_get();
+        uint8_t         src_addr_size;
+        const uint8_t * p_src_addr = nrf_802154_core_last_frame_src_addr_get(&src_addr_size);
 
-        if (mp_lm_rssi_addr != NULL)
-        {
-            *mp_lm_rssi_addr = rssi_scale(rssi);
-            *p_written       = true;
-        }
+        nrf_802154_neighbor_table_link_metrics_get(p_src_addr, src_addr_size, &rssi, &lqi);
+    }
+#endif
 
-        if (mp_lm_margin_addr != NULL)
-        {
-            *mp_lm_margin_addr = margin_scale((int16_t)rssi - ED_RSSIOFFS);
-            *p_written         = true;
-        }
+    if (mp_lm_rssi_addr != NULL)
+    {
+        *mp_lm_rssi_addr = rssi_scale(rssi);
+        *p_written       = true;
+    }
+
+    if (mp_lm_margin_addr != NULL)
+    {
+        *mp_lm_margin_addr = margin_scale((int16_t)rssi - ED_RSSIOFFS);
+        *p_written         = true;
     }
 
     if (mp_lm_lqi_addr != NULL)
     {
-        *mp_lm_lqi_addr = (uint8_t)nrf_802154_core_last_frame_lqi_get();
+        *mp_lm_lqi_addr = lqi;
         *p_written      = true;
     }
 }
@@ -606,6 +616,22 @@ static void ie_writer_commit(bool * p_written)
     link_metrics_ie_write_commit(p_written);
 }
 
+/**
+ * @brief Converts the address of a latched field to its offset from the start of the frame.
+ */
+static uint8_t field_offset_get(const uint8_t * p_frame, const uint8_t * p_field)
+{
+    return (p_field == NULL) ? 0U : (uint8_t)(p_field - p_frame);
+}
+
+/**
+ * @brief Converts the offset of a field from the start of the frame to its address.
+ */
+static uint8_t * field_addr_get(uint8_t * p_frame, uint8_t offset)
+{
+    return (offset == 0U) ? NULL : (p_frame + offset);
+}
+
 void nrf_802154_ie_writer_reset(void)
 {
     m_writer_state = IE_WRITER_RESET;
@@ -623,6 +649,58 @@ void nrf_802154_ie_writer_prepare(uint8_t * p_ie_header, const uint8_t * p_end_a
     ie_writer_prepare(p_ie_header, p_end_addr);
 }
 
+void nrf_802154_ie_writer_layout_get(const uint8_t                 * p_frame,
+                                     nrf_802154_ie_writer_layout_t * p_layout)
+{
+    memset(p_layout, 0, sizeof(*p_layout));
+
+    if (m_writer_state != IE_WRITER_PREPARE)
+    {
+        return;
+    }
+
+    p_layout->prepared = true;
+
+#if NRF_802154_DELAYED_TRX_ENABLED
+    p_layout->csl_phase_offset = field_offset_get(p_frame, mp_csl_phase_addr);
+    p_layout->cst_phase_offset = field_offset_get(p_frame, mp_cst_phase_addr);
+#endif
+    p_layout->lm_rssi_offset   = field_offset_get(p_frame, mp_lm_rssi_addr);
+    p_layout->lm_margin_offset = field_offset_get(p_frame, mp_lm_margin_addr);
+    p_layout->lm_lqi_offset    = field_offset_get(p_frame, mp_lm_lqi_addr);
+}
+
+void nrf_802154_ie_writer_layout_apply(uint8_t                             * p_frame,
+                                       const nrf_802154_ie_writer_layout_t * p_layout)
+{
+    nrf_802154_ie_writer_reset();
+
+    if (!p_layout->prepared)
+    {
+        return;
+    }
+
+    m_writer_state = IE_WRITER_PREPARE;
+
+#if NRF_802154_DELAYED_TRX_ENABLED
+    mp_csl_phase_addr = field_addr_get(p_frame, p_layout->csl_phase_offset);
+    mp_cst_phase_addr = field_addr_get(p_frame, p_layout->cst_phase_offset);
+
+    if (mp_csl_phase_addr != NULL)
+    {
+        mp_csl_period_addr = mp_csl_phase_addr + sizeof(uint16_t);
+    }
+
+    if (mp_cst_phase_addr != NULL)
+    {
+        mp_cst_period_addr = mp_cst_phase_addr + sizeof(uint16_t);
+    }
+#endif
+    mp_lm_rssi_addr   = field_addr_get(p_frame, p_layout->lm_rssi_offset);
+    mp_lm_margin_addr = field_addr_get(p_frame, p_layout->lm_margin_offset);
+    mp_lm_lqi_addr    = field_addr_get(p_frame, p_layout->lm_lqi_offset);
+}
+
 bool nrf_802154_ie_writer_tx_setup(
     uint8_t                                 * p_frame,
     nrf_802154_transmit_params_t            * p_params,
@@ -676,8 +754,6 @@ bool nrf_802154_ie_writer_tx_setup(
 
 bool nrf_802154_ie_writer_tx_started_hook(uint8_t * p_frame)
 {
-    (void)p_frame;
-
     if (m_writer_state != IE_WRITER_PREPARE)
     {
         return true;
@@ -698,7 +774,7 @@ bool nrf_802154_ie_writer_tx_started_hook(uint8_t * p_frame)
 
     if (written)
     {
-        nrf_802154_tx_work_buffer_is_dynamic_data_updated_set();
+        nrf_802154_tx_work_buffer_is_dynamic_data_updated_set(p_frame);
     }
 
     return true;
@@ -706,8 +782,6 @@ bool nrf_802154_ie_writer_tx_started_hook(uint8_t * p_frame)
 
 void nrf_802154_ie_writer_tx_ack_started_hook(uint8_t * p_ack)
 {
-    (void)p_ack;
-
     if (m_writer_state != IE_WRITER_PREPARE)
     {
         return;
@@ -728,7 +802,7 @@ void nrf_802154_ie_writer_tx_ack_started_hook(uint8_t * p_ack)
 
     if (written)
     {
-        nrf_802154_tx_work_buffer_is_dynamic_data_updated_set();
+        nrf_802154_tx_work_buffer_is_dynamic_data_updated_set(p_ack);
     }
 }
 
@@ -47,6 +47,23 @@
  * @brief Information element writer module.
  */
 
+/**
+ * @brief Offsets of the fields written by the IE writer module, relative to the start of a frame.
+ *
+ * The layout allows arming the IE writer for a frame that is a copy of a frame previously
+ * prepared with @ref nrf_802154_ie_writer_prepare, without parsing its IEs again.
+ * Offset 0 indicates that the field is absent, as it is the offset of the PHR.
+ */
+typedef struct
+{
+    bool    prepared;         ///< If the IE writer was armed for the frame.
+    uint8_t csl_phase_offset; ///< Offset of the CSL phase field, followed by the CSL period field.
+    uint8_t cst_phase_offset; ///< Offset of the CST phase field, followed by the CST period field.
+    uint8_t lm_rssi_offset;   ///< Offset of the Link Metrics RSSI field.
+    uint8_t lm_margin_offset; ///< Offset of the Link Metrics link margin field.
+    uint8_t lm_lqi_offset;    ///< Offset of the Link Metrics LQI field.
+} nrf_802154_ie_writer_layout_t;
+
 /**
  * @brief Resets the IE writer module to pristine state.
  */
@@ -75,6 +92,28 @@ void nrf_802154_ie_writer_reset(void);
  */
 void nrf_802154_ie_writer_prepare(uint8_t * p_ie_header, const uint8_t * p_end_addr);
 
+/**
+ * @brief Gets the layout of the fields latched by the IE writer module.
+ *
+ * @param[in]   p_frame   Pointer to the buffer that contains the PHR and PSDU of the frame passed
+ *                        to the latest call to @ref nrf_802154_ie_writer_prepare.
+ * @param[out]  p_layout  Layout of the latched fields.
+ */
+void nrf_802154_ie_writer_layout_get(const uint8_t                 * p_frame,
+                                     nrf_802154_ie_writer_layout_t * p_layout);
+
+/**
+ * @brief Arms the IE writer module using a previously retrieved layout.
+ *
+ * This function has the same effect as @ref nrf_802154_ie_writer_prepare called for a frame
+ * with the same layout of header IEs as the frame @p p_layout was retrieved for.
+ *
+ * @param[in]  p_frame   Pointer to the buffer that contains the PHR and PSDU of the frame.
+ * @param[in]  p_layout  Layout of the fields to be written.
+ */
+void nrf_802154_ie_writer_layout_apply(uint8_t                             * p_frame,
+                                       const nrf_802154_ie_writer_layout_t * p_layout);
+
 /**
  * @brief Transmission setup hook for the IE writer module.
  *
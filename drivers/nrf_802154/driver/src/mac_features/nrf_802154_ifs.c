@@ -46,6 +46,7 @@
 
 #include "nrf_802154_pib.h"
 #include "nrf_802154_request.h"
+#include "nrf_802154_stats.h"
 #include "mac_features/nrf_802154_frame_parser.h"
 #include "nrf_802154_sl_timer.h"
 #include "nrf_802154_sl_utils.h"
@@ -77,17 +78,20 @@ typedef struct
     nrf_802154_transmit_params_t params;
 } ifs_operation_t;
 
-static union
+/**
+ * @brief Entry of the history of transmitted frames.
+ */
+typedef struct
 {
-    uint8_t sh[SHORT_ADDRESS_SIZE];                      ///< Short address of the last frame transmitted.
-    uint8_t ext[EXTENDED_ADDRESS_SIZE];                  ///< Extended address of the last frame transmitted.
-} m_last_address;
+    uint8_t  addr[EXTENDED_ADDRESS_SIZE]; ///< Destination address.
+    uint8_t  addr_len;                    ///< Length of @c addr, 0 if the entry is unused.
+    uint8_t  frame_length;                ///< Length in bytes of the last frame.
+    uint64_t frame_timestamp;             ///< Timestamp of the last frame (end of frame).
+} ifs_history_entry_t;
 
-static bool                  m_is_last_address_extended; ///< Whether the last transmitted frame had the extended address populated.
-static uint64_t              m_last_frame_timestamp;     ///< Timestamp of the last transmitted frame (end of frame).
-static uint8_t               m_last_frame_length;        ///< Length in bytes of the last transmitted frame.
-static ifs_operation_t       m_context;                  ///< Context passed to the timer.
-static nrf_802154_sl_timer_t m_timer;                    ///< Interframe space timer.
+static ifs_history_entry_t   m_history[NRF_802154_IFS_HISTORY_SIZE]; ///< Last frame per destination.
+static ifs_operation_t       m_context;                              ///< Context passed to the timer.
+static nrf_802154_sl_timer_t m_timer;                                ///< Interframe space timer.
 
 /**
  * Set state of IFS procedure.
@@ -137,12 +141,17 @@ static void callback_fired(nrf_802154_sl_timer_t * p_timer)
     }
 }
 
-/**@brief Checks if the IFS is needed by comparing the addresses of the actual and the last frames. */
-static bool is_ifs_needed_by_address(const uint8_t * p_frame)
+/**@brief Gets the destination address of a frame.
+ *
+ * @param[in]   p_frame     Pointer to the buffer that contains the PHR and PSDU of the frame.
+ * @param[out]  p_addr_len  Length of the destination address.
+ *
+ * @returns  Pointer to the destination address or NULL if the frame has none.
+ */
+static const uint8_t * dst_addr_get(const uint8_t * p_frame, uint8_t * p_addr_len)
 {
     nrf_802154_frame_parser_data_t frame_data;
-    const uint8_t                * addr;
-    bool                           is_extended;
+    const uint8_t                * p_addr = NULL;
 
     bool result = nrf_802154_frame_parser_data_init(p_frame,
                                                     p_frame[PHR_OFFSET] + PHR_SIZE,
@@ -151,51 +160,64 @@ static bool is_ifs_needed_by_address(const uint8_t * p_frame)
 
     if (result)
     {
-        addr        = nrf_802154_frame_parser_dst_addr_get(&frame_data);
-        is_extended = nrf_802154_frame_parser_dst_addr_is_extended(&frame_data);
-    }
-    else
-    {
-        addr        = NULL;
-        is_extended = false;
+        p_addr      = nrf_802154_frame_parser_dst_addr_get(&frame_data);
+        *p_addr_len = nrf_802154_frame_parser_dst_addr_is_extended(&frame_data) ?
+                      EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
     }
 
-    if (!addr)
-    {
-        return true;
-    }
+    return p_addr;
+}
 
-    if (is_extended == m_is_last_address_extended)
+/**@brief Finds the history entry of the given destination address, NULL if there is none. */
+static ifs_history_entry_t * history_entry_find(const uint8_t * p_addr, uint8_t addr_len)
+{
+    for (uint32_t i = 0; i < NRF_802154_IFS_HISTORY_SIZE; i++)
     {
-        uint8_t * last_addr = is_extended ? m_last_address.ext : m_last_address.sh;
-        size_t    addr_len  = is_extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE;
+        ifs_history_entry_t * p_entry = &m_history[i];
 
-        if (0 == memcmp(addr, last_addr, addr_len))
+        if ((p_entry->addr_len == addr_len) && (0 == memcmp(p_entry->addr, p_addr, addr_len)))
         {
-            return true;
+            return p_entry;
         }
     }
 
-    return false;
+    return NULL;
 }
 
-/**@brief Checks if the IFS is needed by measuring time between the actual and the last frames.
- *        Returns the needed ifs, 0 if none.
+/**@brief Gets the history entry to be replaced: an unused one or the one of the oldest frame.
+ *
+ * The interframe space of the oldest frame is the first to elapse, so replacing its entry
+ * cannot make the next frame to that destination miss its interframe space.
  */
-static uint16_t ifs_needed_by_time(uint64_t current_timestamp)
+static ifs_history_entry_t * history_entry_oldest_get(void)
 {
-    if (!nrf_802154_sl_time64_is_in_future(m_last_frame_timestamp, current_timestamp))
+    ifs_history_entry_t * p_oldest = &m_history[0];
+
+    for (uint32_t i = 0; i < NRF_802154_IFS_HISTORY_SIZE; i++)
     {
-        /* Explicitly allow case where the timstamps are equal, i.e. we are running very fast. */
-        if (current_timestamp != m_last_frame_timestamp)
+        ifs_history_entry_t * p_entry = &m_history[i];
+
+        if (p_entry->addr_len == 0U)
         {
-            return 0;
+            return p_entry;
+        }
+
+        if (nrf_802154_sl_time64_is_in_future(p_entry->frame_timestamp,
+                                              p_oldest->frame_timestamp))
+        {
+            p_oldest = p_entry;
         }
     }
+
+    return p_oldest;
+}
+
+/**@brief Gets the time at which the interframe space after the frame of a history entry ends. */
+static uint64_t history_entry_ifs_end_get(const ifs_history_entry_t * p_entry)
+{
     uint16_t ifs_period;
-    uint64_t dt = current_timestamp - m_last_frame_timestamp;
 
-    if (m_last_frame_length > MAX_SIFS_FRAME_SIZE)
+    if (p_entry->frame_length > MAX_SIFS_FRAME_SIZE)
     {
         ifs_period = nrf_802154_pib_ifs_min_lifs_period_get();
     }
@@ -204,21 +226,66 @@ static uint16_t ifs_needed_by_time(uint64_t current_timestamp)
         ifs_period = nrf_802154_pib_ifs_min_sifs_period_get();
     }
 
-    if (dt > ifs_period)
+    return p_entry->frame_timestamp + ifs_period;
+}
+
+/**@brief Gets the time before which the given frame must not be transmitted.
+ *
+ * In @ref NRF_802154_IFS_MODE_MATCHING_ADDRESSES mode only the last frame transmitted to
+ * the destination of the given frame is taken into account. In @ref NRF_802154_IFS_MODE_ALWAYS
+ * mode and for frames without a destination address all recorded frames are taken into account.
+ *
+ * @param[in]   p_frame     Pointer to the buffer that contains the PHR and PSDU of the frame.
+ * @param[in]   mode        Current IFS mode.
+ * @param[out]  p_ifs_end   Time at which the interframe space ends.
+ *
+ * @retval  true   The interframe space has been found.
+ * @retval  false  No frame that requires the interframe space was transmitted before.
+ */
+static bool ifs_end_get(const uint8_t * p_frame, nrf_802154_ifs_mode_t mode, uint64_t * p_ifs_end)
+{
+    uint8_t         addr_len;
+    const uint8_t * p_addr = dst_addr_get(p_frame, &addr_len);
+    bool            found  = false;
+
+    if ((mode == NRF_802154_IFS_MODE_MATCHING_ADDRESSES) && (p_addr != NULL))
+    {
+        const ifs_history_entry_t * p_entry = history_entry_find(p_addr, addr_len);
+
+        if (p_entry != NULL)
+        {
+            *p_ifs_end = history_entry_ifs_end_get(p_entry);
+            found      = true;
+        }
+
+        return found;
+    }
+
+    for (uint32_t i = 0; i < NRF_802154_IFS_HISTORY_SIZE; i++)
     {
-        return 0;
+        if (m_history[i].addr_len == 0U)
+        {
+            continue;
+        }
+
+        uint64_t ifs_end = history_entry_ifs_end_get(&m_history[i]);
+
+        if (!found || nrf_802154_sl_time64_is_in_future(*p_ifs_end, ifs_end))
+        {
+            *p_ifs_end = ifs_end;
+            found      = true;
+        }
     }
 
-    return ifs_period;
+    return found;
 }
 
 void nrf_802154_ifs_init(void)
 {
-    m_state                    = IFS_STATE_STOPPED;
-    m_is_last_address_extended = false;
-    m_last_frame_timestamp     = 0;
-    m_last_frame_length        = 0;
-    m_context                  = (ifs_operation_t){ .p_data = NULL };
+    m_state   = IFS_STATE_STOPPED;
+    m_context = (ifs_operation_t){ .p_data = NULL };
+
+    memset(m_history, 0, sizeof(m_history));
 
     nrf_802154_sl_timer_init(&m_timer);
 }
@@ -250,21 +317,17 @@ bool nrf_802154_ifs_pretransmission(
         return true;
     }
 
-    if (!m_last_frame_length)
-    {
-        // No frame was transmitted before - skip the routine.
-        return true;
-    }
+    uint64_t ifs_end = 0U;
 
-    if ((mode == NRF_802154_IFS_MODE_MATCHING_ADDRESSES) && !is_ifs_needed_by_address(p_frame))
+    if (!ifs_end_get(p_frame, mode, &ifs_end))
     {
+        // No frame that requires the interframe space was transmitted before - skip the routine.
         return true;
     }
 
     uint64_t current_timestamp = nrf_802154_sl_timer_current_time_get();
-    uint32_t dt                = ifs_needed_by_time(current_timestamp);
 
-    if (dt == 0)
+    if (!nrf_802154_sl_time64_is_in_future(current_timestamp, ifs_end))
     {
         return true;
     }
@@ -278,7 +341,7 @@ bool nrf_802154_ifs_pretransmission(
         m_context.p_data                 = p_frame;
         m_context.params                 = *p_params;
         m_context.params.immediate       = true;
-        m_timer.trigger_time             = m_last_frame_timestamp + dt;
+        m_timer.trigger_time             = ifs_end;
         m_timer.action_type              = NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK;
         m_timer.action.callback.callback = callback_fired;
         m_timer.user_data.p_pointer      = &m_context;
@@ -287,6 +350,9 @@ bool nrf_802154_ifs_pretransmission(
         {
             NRF_802154_ASSERT(false);
         }
+
+        nrf_802154_stat_counter_increment(ifs_delayed_transmissions);
+        nrf_802154_stat_counter_add(ifs_delay_us, (uint32_t)(ifs_end - current_timestamp));
     }
 
     return false;
@@ -296,44 +362,29 @@ void nrf_802154_ifs_transmitted_hook(const uint8_t * p_frame)
 {
     NRF_802154_ASSERT(p_frame[0] != 0U);
 
-    m_last_frame_timestamp = nrf_802154_sl_timer_current_time_get();
-
-    nrf_802154_frame_parser_data_t frame_data;
-    const uint8_t                * addr;
+    uint64_t              timestamp = nrf_802154_sl_timer_current_time_get();
+    uint8_t               addr_len;
+    const uint8_t       * p_addr = dst_addr_get(p_frame, &addr_len);
+    ifs_history_entry_t * p_entry;
 
-    bool result = nrf_802154_frame_parser_data_init(p_frame,
-                                                    p_frame[PHR_OFFSET] + PHR_SIZE,
-                                                    PARSE_LEVEL_ADDRESSING_END,
-                                                    &frame_data);
-
-    if (result)
-    {
-        addr                       = nrf_802154_frame_parser_dst_addr_get(&frame_data);
-        m_is_last_address_extended = nrf_802154_frame_parser_dst_addr_is_extended(&frame_data);
-    }
-    else
-    {
-        addr                       = NULL;
-        m_is_last_address_extended = false;
-    }
-
-    if (!addr)
+    if (!p_addr)
     {
         // If the transmitted frame has no address, we consider that enough time has passed so no IFS insertion will be needed.
-        m_last_frame_length = 0;
         return;
     }
 
-    if (m_is_last_address_extended)
-    {
-        memcpy(m_last_address.ext, addr, EXTENDED_ADDRESS_SIZE);
-    }
-    else
+    p_entry = history_entry_find(p_addr, addr_len);
+
+    if (p_entry == NULL)
     {
-        memcpy(m_last_address.sh, addr, SHORT_ADDRESS_SIZE);
+        p_entry = history_entry_oldest_get();
+
+        memcpy(p_entry->addr, p_addr, addr_len);
+        p_entry->addr_len = addr_len;
     }
 
-    m_last_frame_length = p_frame[0];
+    p_entry->frame_length    = p_frame[0];
+    p_entry->frame_timestamp = timestamp;
 }
 
 bool nrf_802154_ifs_abort(nrf_802154_term_t term_lvl, req_originator_t req_orig)
@@ -0,0 +1,316 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the neighbor link quality table of the 802.15.4 driver.
+ *
+ */
+
+#include "mac_features/nrf_802154_neighbor_table.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_sl_timer.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_NEIGHBOR_TABLE_ENABLED
+
+#define AVG_FRACTION_BITS 4U ///< Number of fractional bits of the averaged RSSI and LQI.
+
+/**
+ * @brief Entry of the neighbor table.
+ */
+typedef struct
+{
+    nrf_802154_neighbor_t info;      ///< Entry as reported to the higher layer.
+    int16_t               rssi_avg;  ///< Averaged RSSI with @ref AVG_FRACTION_BITS fractional bits.
+    uint16_t              lqi_avg;   ///< Averaged LQI with @ref AVG_FRACTION_BITS fractional bits.
+    uint32_t              last_used; ///< Value of the use counter at the latest activity of the neighbor.
+} neighbor_entry_t;
+
+static neighbor_entry_t m_neighbors[NRF_802154_NEIGHBOR_TABLE_SIZE];
+static uint32_t         m_use_counter;
+
+static int32_t avg_update(int32_t avg, int32_t sample)
+{
+    return avg + (sample - avg) / (1 << NRF_802154_NEIGHBOR_TABLE_EWMA_SHIFT);
+}
+
+static int32_t avg_round(int32_t avg)
+{
+    int32_t half = 1 << (AVG_FRACTION_BITS - 1U);
+
+    return (avg >= 0) ? ((avg + half) >> AVG_FRACTION_BITS) :
+           -((-avg + half) >> AVG_FRACTION_BITS);
+}
+
+static neighbor_entry_t * entry_find(const uint8_t * p_addr, uint8_t addr_len)
+{
+    for (uint32_t i = 0U; i < NRF_802154_NEIGHBOR_TABLE_SIZE; i++)
+    {
+        neighbor_entry_t * p_entry = &m_neighbors[i];
+
+        if ((p_entry->info.addr_len == addr_len) &&
+            (memcmp(p_entry->info.addr, p_addr, addr_len) == 0))
+        {
+            return p_entry;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Finds the entry of a neighbor or replaces the least recently active entry with it.
+ */
+static neighbor_entry_t * entry_get(const uint8_t * p_addr, uint8_t addr_len)
+{
+    neighbor_entry_t * p_victim = &m_neighbors[0];
+
+    for (uint32_t i = 0U; i < NRF_802154_NEIGHBOR_TABLE_SIZE; i++)
+    {
+        neighbor_entry_t * p_entry = &m_neighbors[i];
+
+        if ((p_entry->info.addr_len == addr_len) &&
+            (memcmp(p_entry->info.addr, p_addr, addr_len) == 0))
+        {
+            p_entry->last_used = ++m_use_counter;
+            return p_entry;
+        }
+
+        if ((p_victim->info.addr_len != 0U) &&
+            ((p_entry->info.addr_len == 0U) || (p_entry->last_used < p_victim->last_used)))
+        {
+            p_victim = p_entry;
+        }
+    }
+
+    memset(p_victim, 0, sizeof(neighbor_entry_t));
+    memcpy(p_victim->info.addr, p_addr, addr_len);
+    p_victim->info.addr_len = addr_len;
+    p_victim->last_used     = ++m_use_counter;
+
+    return p_victim;
+}
+
+static void entry_info_get(const neighbor_entry_t * p_entry, nrf_802154_neighbor_t * p_neighbor)
+{
+    *p_neighbor      = p_entry->info;
+    p_neighbor->rssi = (int8_t)avg_round(p_entry->rssi_avg);
+    p_neighbor->lqi  = (uint8_t)avg_round(p_entry->lqi_avg);
+}
+
+/**
+ * @brief Counts a transmitted frame with the Ack Request bit set in the entry of its destination.
+ */
+static void tx_record(const uint8_t * p_frame, bool acked)
+{
+    nrf_802154_frame_parser_data_t  frame_data;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    const uint8_t                 * p_dst_addr;
+
+    if (!nrf_802154_frame_parser_data_init(p_frame,
+                                           p_frame[PHR_OFFSET] + PHR_SIZE,
+                                           PARSE_LEVEL_ADDRESSING_END,
+                                           &frame_data) ||
+        !nrf_802154_frame_parser_ar_bit_is_set(&frame_data))
+    {
+        return;
+    }
+
+    p_dst_addr = nrf_802154_frame_parser_dst_addr_get(&frame_data);
+
+    if (p_dst_addr == NULL)
+    {
+        return;
+    }
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    neighbor_entry_t * p_entry =
+        entry_get(p_dst_addr, nrf_802154_frame_parser_dst_addr_size_get(&frame_data));
+
+    p_entry->info.tx_frames++;
+
+    if (acked)
+    {
+        p_entry->info.tx_acked++;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_neighbor_table_init(void)
+{
+    nrf_802154_neighbor_table_clear();
+}
+
+void nrf_802154_neighbor_table_clear(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    memset(m_neighbors, 0, sizeof(m_neighbors));
+    m_use_counter = 0U;
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_neighbor_table_rx_record(const nrf_802154_frame_parser_data_t * p_frame_data,
+                                         int8_t                                 rssi,
+                                         uint8_t                                lqi)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    const uint8_t                 * p_src_addr = nrf_802154_frame_parser_src_addr_get(
+        p_frame_data);
+    uint64_t                        now = nrf_802154_sl_timer_current_time_get();
+
+    if (p_src_addr == NULL)
+    {
+        return;
+    }
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    neighbor_entry_t * p_entry =
+        entry_get(p_src_addr, nrf_802154_frame_parser_src_addr_size_get(p_frame_data));
+
+    if (p_entry->info.rx_frames == 0U)
+    {
+        p_entry->rssi_avg = (int16_t)((int32_t)rssi << AVG_FRACTION_BITS);
+        p_entry->lqi_avg  = (uint16_t)((uint32_t)lqi << AVG_FRACTION_BITS);
+    }
+    else
+    {
+        p_entry->rssi_avg = (int16_t)avg_update(p_entry->rssi_avg,
+                                                (int32_t)rssi << AVG_FRACTION_BITS);
+        p_entry->lqi_avg = (uint16_t)avg_update(p_entry->lqi_avg,
+                                                (int32_t)lqi << AVG_FRACTION_BITS);
+    }
+
+    p_entry->info.rx_frames++;
+    p_entry->info.last_rx_time = now;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_neighbor_table_link_metrics_get(const uint8_t * p_src_addr,
+                                                uint8_t         src_addr_size,
+                                                int8_t        * p_rssi,
+                                                uint8_t       * p_lqi)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    const neighbor_entry_t        * p_entry;
+
+    if (p_src_addr == NULL)
+    {
+        return;
+    }
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    p_entry = entry_find(p_src_addr, src_addr_size);
+
+    if ((p_entry != NULL) && (p_entry->info.rx_frames != 0U))
+    {
+        *p_rssi = (int8_t)avg_round(avg_update(p_entry->rssi_avg,
+                                               (int32_t)*p_rssi << AVG_FRACTION_BITS));
+        *p_lqi = (uint8_t)avg_round(avg_update(p_entry->lqi_avg,
+                                               (int32_t)*p_lqi << AVG_FRACTION_BITS));
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_neighbor_table_transmitted_hook(const uint8_t * p_frame)
+{
+    tx_record(p_frame, true);
+}
+
+bool nrf_802154_neighbor_table_tx_failed_hook(uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    if (error == NRF_802154_TX_ERROR_NO_ACK)
+    {
+        tx_record(p_frame, false);
+    }
+
+    return true;
+}
+
+uint8_t nrf_802154_neighbor_table_copy(nrf_802154_neighbor_t * p_neighbors,
+                                       uint8_t                 neighbors_max)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    uint8_t                         count = 0U;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (uint32_t i = 0U; (i < NRF_802154_NEIGHBOR_TABLE_SIZE) && (count < neighbors_max); i++)
+    {
+        if (m_neighbors[i].info.addr_len != 0U)
+        {
+            entry_info_get(&m_neighbors[i], &p_neighbors[count++]);
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return count;
+}
+
+bool nrf_802154_neighbor_table_entry_copy(const uint8_t         * p_addr,
+                                          bool                    extended,
+                                          nrf_802154_neighbor_t * p_neighbor)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    const neighbor_entry_t        * p_entry;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    p_entry = entry_find(p_addr, extended ? EXTENDED_ADDRESS_SIZE : SHORT_ADDRESS_SIZE);
+
+    if (p_entry != NULL)
+    {
+        entry_info_get(p_entry, p_neighbor);
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return p_entry != NULL;
+}
+
+#endif // NRF_802154_NEIGHBOR_TABLE_ENABLED
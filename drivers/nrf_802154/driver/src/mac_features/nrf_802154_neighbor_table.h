@@ -0,0 +1,125 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_NEIGHBOR_TABLE_H
+#define NRF_802154_NEIGHBOR_TABLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+/**
+ * @brief Initializes the neighbor table.
+ */
+void nrf_802154_neighbor_table_init(void);
+
+/**
+ * @brief Removes all neighbors from the table.
+ */
+void nrf_802154_neighbor_table_clear(void);
+
+/**
+ * @brief Records a frame received from a neighbor.
+ *
+ * Frames without a source address are ignored.
+ *
+ * @param[in]  p_frame_data  Pointer to the parser data of the received frame, parsed at least
+ *                           up to the addressing fields.
+ * @param[in]  rssi          RSSI of the frame, in dBm.
+ * @param[in]  lqi           LQI of the frame.
+ */
+void nrf_802154_neighbor_table_rx_record(const nrf_802154_frame_parser_data_t * p_frame_data,
+                                         int8_t                                 rssi,
+                                         uint8_t                                lqi);
+
+/**
+ * @brief Averages the RSSI and LQI of a frame being acknowledged with those of its source.
+ *
+ * The table is not modified. If the source is unknown, @p p_rssi and @p p_lqi are not modified.
+ *
+ * @param[in]     p_src_addr     Pointer to the source address of the frame.
+ * @param[in]     src_addr_size  Size of the source address.
+ * @param[inout]  p_rssi         RSSI of the frame on input, averaged RSSI on output.
+ * @param[inout]  p_lqi          LQI of the frame on input, averaged LQI on output.
+ */
+void nrf_802154_neighbor_table_link_metrics_get(const uint8_t * p_src_addr,
+                                                uint8_t         src_addr_size,
+                                                int8_t        * p_rssi,
+                                                uint8_t       * p_lqi);
+
+/**
+ * @brief Counts an acknowledged frame transmitted to a neighbor.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the PHR and PSDU of the transmitted frame.
+ */
+void nrf_802154_neighbor_table_transmitted_hook(const uint8_t * p_frame);
+
+/**
+ * @brief Counts a frame transmitted to a neighbor that was not acknowledged.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the PHR and PSDU of the frame.
+ * @param[in]  error    Cause of the failed transmission.
+ *
+ * @retval  true  Always, the failure is to be notified.
+ */
+bool nrf_802154_neighbor_table_tx_failed_hook(uint8_t * p_frame, nrf_802154_tx_error_t error);
+
+/**
+ * @brief Copies the neighbor table.
+ *
+ * @param[out]  p_neighbors    Array to be filled with the neighbors.
+ * @param[in]   neighbors_max  Number of elements of @p p_neighbors.
+ *
+ * @returns  Number of neighbors copied to @p p_neighbors.
+ */
+uint8_t nrf_802154_neighbor_table_copy(nrf_802154_neighbor_t * p_neighbors,
+                                       uint8_t                 neighbors_max);
+
+/**
+ * @brief Copies the entry of a single neighbor.
+ *
+ * @param[in]   p_addr      Pointer to the address of the neighbor, in little-endian byte order.
+ * @param[in]   extended    If the address is an extended address.
+ * @param[out]  p_neighbor  Structure to be filled with the entry.
+ *
+ * @retval  true   The neighbor was found.
+ * @retval  false  The neighbor is not in the table.
+ */
+bool nrf_802154_neighbor_table_entry_copy(const uint8_t         * p_addr,
+                                          bool                    extended,
+                                          nrf_802154_neighbor_t * p_neighbor);
+
+#endif // NRF_802154_NEIGHBOR_TABLE_H
@@ -0,0 +1,377 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements periodic reception windows.
+ *
+ */
+
+#define NRF_802154_MODULE_ID NRF_802154_DRV_MODULE_ID_PERIODIC_RX
+
+#include "nrf_802154_periodic_rx.h"
+
+#include "nrf_802154_assert.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../nrf_802154_debug.h"
+#include "nrf_802154.h"
+#include "nrf_802154_config.h"
+#include "nrf_802154_delayed_trx.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_utils.h"
+#include "nrf_802154_sl_timer.h"
+#include "nrf_802154_sl_utils.h"
+
+#if NRF_802154_DELAYED_TRX_ENABLED && (NRF_802154_PERIODIC_RX_SCHEDULES > 0)
+
+#if NRF_802154_PERIODIC_RX_SCHEDULES > NRF_802154_RESERVED_PERIODIC_RX_ID_NUM
+#error "NRF_802154_PERIODIC_RX_SCHEDULES exceeds the number of reserved window identifiers"
+#endif
+
+#if NRF_802154_PERIODIC_RX_CHANNELS_MAX > UINT8_MAX
+#error "NRF_802154_PERIODIC_RX_CHANNELS_MAX must fit in uint8_t"
+#endif
+
+/**
+ * @brief Periodic reception schedule data.
+ */
+typedef struct
+{
+    nrf_802154_periodic_rx_params_t params;         ///< Parameters of the schedule.
+    nrf_802154_sl_timer_t           arm_timer;      ///< Timer that arms consecutive windows.
+    uint64_t                        window_idx;     ///< Index of the next window to be armed.
+    nrf_802154_periodic_rx_stats_t  stats;          ///< Statistics of the schedule.
+    volatile bool                   active;         ///< Flag indicating if the schedule is running.
+    volatile bool                   window_pending; ///< Flag indicating if a window of the schedule has been armed and has not ended yet.
+} periodic_rx_schedule_t;
+
+static periodic_rx_schedule_t m_schedules[NRF_802154_PERIODIC_RX_SCHEDULES]; ///< Periodic reception schedules.
+
+/**
+ * @brief Gets the index of a schedule in @ref m_schedules.
+ */
+static uint8_t schedule_idx_get(const periodic_rx_schedule_t * p_schedule)
+{
+    return (uint8_t)(p_schedule - m_schedules);
+}
+
+/**
+ * @brief Gets the start time of the window with a given index.
+ */
+static uint64_t window_start_get(const periodic_rx_schedule_t * p_schedule, uint64_t window_idx)
+{
+    return p_schedule->params.rx_time + window_idx * p_schedule->params.period;
+}
+
+/**
+ * @brief Gets the time at which the window with a given index is to be armed.
+ *
+ * A window is armed @ref NRF_802154_PERIODIC_RX_ARM_MARGIN_US before the latest time at which
+ * it can still be requested, but not earlier than that margin after the end of the preceding
+ * window, so that the preceding window releases its delayed reception slot first.
+ */
+static uint64_t window_arm_time_get(const periodic_rx_schedule_t * p_schedule,
+                                    uint64_t                       window_idx)
+{
+    uint64_t rx_time  = window_start_get(p_schedule, window_idx);
+    uint64_t ahead    = nrf_802154_delayed_trx_rx_lead_time_get() +
+                        NRF_802154_PERIODIC_RX_ARM_MARGIN_US;
+    uint64_t arm_time = (rx_time > ahead) ? (rx_time - ahead) : 0;
+
+    if (window_idx > 0)
+    {
+        uint64_t prev_end = window_start_get(p_schedule, window_idx - 1) +
+                            p_schedule->params.window + NRF_802154_PERIODIC_RX_ARM_MARGIN_US;
+
+        if (prev_end > arm_time)
+        {
+            arm_time = prev_end;
+        }
+    }
+
+    return arm_time;
+}
+
+/**
+ * @brief Adds the given values to the statistics of a schedule.
+ */
+static void stats_add(periodic_rx_schedule_t * p_schedule,
+                      uint32_t                 armed,
+                      uint32_t                 completed,
+                      uint32_t                 missed,
+                      uint32_t                 late)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    p_schedule->stats.armed     += armed;
+    p_schedule->stats.completed += completed;
+    p_schedule->stats.missed    += missed;
+    p_schedule->stats.late      += late;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+/**
+ * @brief Sets the arm timer of a schedule to fire at a given time.
+ */
+static nrf_802154_sl_timer_ret_t arm_timer_set(periodic_rx_schedule_t * p_schedule,
+                                               uint64_t                 trigger_time)
+{
+    p_schedule->arm_timer.trigger_time = trigger_time;
+
+    return nrf_802154_sl_timer_add(&p_schedule->arm_timer);
+}
+
+/**
+ * @brief Arms the next window of a schedule or skips the windows that are too late to be armed.
+ *
+ * @param[in]  p_timer  Arm timer of the schedule.
+ */
+static void window_arm(nrf_802154_sl_timer_t * p_timer)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_HIGH);
+
+    periodic_rx_schedule_t  * p_schedule = (periodic_rx_schedule_t *)p_timer->user_data.p_pointer;
+    nrf_802154_sl_timer_ret_t ret;
+
+    if (!p_schedule->active)
+    {
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+        return;
+    }
+
+    uint64_t now      = nrf_802154_sl_timer_current_time_get();
+    uint64_t deadline = now + nrf_802154_delayed_trx_rx_lead_time_get();
+    uint64_t rx_time  = window_start_get(p_schedule, p_schedule->window_idx);
+    uint64_t next_arm_time;
+
+    if (!nrf_802154_sl_time64_is_in_future(deadline, rx_time))
+    {
+        // The window and possibly some of the following ones cannot be requested anymore.
+        uint64_t skipped = (deadline - rx_time) / p_schedule->params.period + 1;
+
+        p_schedule->window_idx += skipped;
+        stats_add(p_schedule, 0, 0, 0, (uint32_t)skipped);
+
+        next_arm_time = window_arm_time_get(p_schedule, p_schedule->window_idx);
+    }
+    else if (p_schedule->window_pending)
+    {
+        // The preceding window has been extended by a frame being received. Retry later.
+        next_arm_time = now + NRF_802154_PERIODIC_RX_ARM_MARGIN_US;
+    }
+    else
+    {
+        const nrf_802154_periodic_rx_params_t * p_params = &p_schedule->params;
+
+        uint8_t channel = p_params->channels[p_schedule->window_idx % p_params->channels_len];
+        bool    result;
+
+        p_schedule->window_pending = true;
+
+        result = nrf_802154_request_receive_at(rx_time,
+                                               p_params->window,
+                                               channel,
+                                               NRF_802154_RESERVED_PERIODIC_RX_ID(
+                                                   schedule_idx_get(p_schedule)));
+
+        if (result)
+        {
+            stats_add(p_schedule, 1, 0, 0, 0);
+        }
+        else
+        {
+            p_schedule->window_pending = false;
+            stats_add(p_schedule, 0, 0, 1, 0);
+        }
+
+        p_schedule->window_idx++;
+
+        next_arm_time = window_arm_time_get(p_schedule, p_schedule->window_idx);
+    }
+
+    ret = arm_timer_set(p_schedule, next_arm_time);
+    NRF_802154_ASSERT(ret == NRF_802154_SL_TIMER_RET_SUCCESS);
+    (void)ret;
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_HIGH);
+}
+
+void nrf_802154_periodic_rx_init(void)
+{
+    for (uint32_t i = 0; i < NRF_802154_PERIODIC_RX_SCHEDULES; i++)
+    {
+        periodic_rx_schedule_t * p_schedule = &m_schedules[i];
+
+        p_schedule->active         = false;
+        p_schedule->window_pending = false;
+
+        nrf_802154_sl_timer_init(&p_schedule->arm_timer);
+
+        p_schedule->arm_timer.action_type              = NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK;
+        p_schedule->arm_timer.action.callback.callback = window_arm;
+        p_schedule->arm_timer.user_data.p_pointer      = p_schedule;
+    }
+}
+
+void nrf_802154_periodic_rx_deinit(void)
+{
+    for (uint32_t i = 0; i < NRF_802154_PERIODIC_RX_SCHEDULES; i++)
+    {
+        m_schedules[i].active = false;
+        nrf_802154_sl_timer_deinit(&m_schedules[i].arm_timer);
+    }
+}
+
+bool nrf_802154_periodic_rx_start(uint8_t                                 schedule,
+                                  const nrf_802154_periodic_rx_params_t * p_params)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    periodic_rx_schedule_t        * p_schedule;
+
+    if ((schedule >= NRF_802154_PERIODIC_RX_SCHEDULES) ||
+        (p_params->channels_len == 0) ||
+        (p_params->channels_len > NRF_802154_PERIODIC_RX_CHANNELS_MAX) ||
+        (p_params->window == 0) ||
+        (p_params->window >= p_params->period) ||
+        ((p_params->period - p_params->window) <
+         (nrf_802154_delayed_trx_rx_lead_time_get() + NRF_802154_PERIODIC_RX_ARM_MARGIN_US)))
+    {
+        return false;
+    }
+
+    p_schedule = &m_schedules[schedule];
+
+    if (p_schedule->active)
+    {
+        return false;
+    }
+
+    p_schedule->params     = *p_params;
+    p_schedule->window_idx = 0;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    memset(&p_schedule->stats, 0, sizeof(p_schedule->stats));
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    p_schedule->active = true;
+
+    if (arm_timer_set(p_schedule, window_arm_time_get(p_schedule, 0)) !=
+        NRF_802154_SL_TIMER_RET_SUCCESS)
+    {
+        p_schedule->active = false;
+        return false;
+    }
+
+    return true;
+}
+
+bool nrf_802154_periodic_rx_stop(uint8_t schedule)
+{
+    periodic_rx_schedule_t * p_schedule;
+
+    if (schedule >= NRF_802154_PERIODIC_RX_SCHEDULES)
+    {
+        return false;
+    }
+
+    p_schedule = &m_schedules[schedule];
+
+    if (!p_schedule->active)
+    {
+        return false;
+    }
+
+    p_schedule->active = false;
+    (void)nrf_802154_sl_timer_remove(&p_schedule->arm_timer);
+
+    // A window that has already started cannot be cancelled. It is accounted when it ends.
+    if (p_schedule->window_pending &&
+        nrf_802154_request_receive_at_cancel(NRF_802154_RESERVED_PERIODIC_RX_ID(schedule)))
+    {
+        p_schedule->window_pending = false;
+    }
+
+    return true;
+}
+
+bool nrf_802154_periodic_rx_stats_get(uint8_t                          schedule,
+                                      nrf_802154_periodic_rx_stats_t * p_stats)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    if (schedule >= NRF_802154_PERIODIC_RX_SCHEDULES)
+    {
+        return false;
+    }
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    *p_stats = m_schedules[schedule].stats;
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return true;
+}
+
+bool nrf_802154_periodic_rx_window_ended(uint32_t id, nrf_802154_rx_error_t error)
+{
+    uint32_t schedule = NRF_802154_RESERVED_PERIODIC_RX_ID(0) - id;
+
+    if ((id > NRF_802154_RESERVED_PERIODIC_RX_ID(0)) ||
+        (schedule >= NRF_802154_PERIODIC_RX_SCHEDULES))
+    {
+        return false;
+    }
+
+    periodic_rx_schedule_t * p_schedule = &m_schedules[schedule];
+
+    if (error == NRF_802154_RX_ERROR_DELAYED_TIMEOUT)
+    {
+        stats_add(p_schedule, 0, 1, 0, 0);
+    }
+    else
+    {
+        stats_add(p_schedule, 0, 0, 1, 0);
+    }
+
+    p_schedule->window_pending = false;
+
+    return true;
+}
+
+#endif // NRF_802154_DELAYED_TRX_ENABLED && (NRF_802154_PERIODIC_RX_SCHEDULES > 0)
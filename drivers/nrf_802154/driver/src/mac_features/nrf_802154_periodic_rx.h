@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_PERIODIC_RX_H__
+#define NRF_802154_PERIODIC_RX_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_types.h"
+
+#if NRF_802154_DELAYED_TRX_ENABLED && (NRF_802154_PERIODIC_RX_SCHEDULES > 0)
+
+/**
+ * @defgroup nrf_802154_periodic_rx Periodic reception windows
+ * @{
+ * @ingroup nrf_802154
+ * @brief Periodic reception windows.
+ *
+ * This module opens delayed reception windows periodically on behalf of the higher layer, as
+ * needed by CSL receivers and TSCH slotframes. Each window is requested from the delayed
+ * reception module shortly before it is due, so a schedule holds a single delayed reception
+ * window at a time.
+ */
+
+/**
+ * @brief Initializes the periodic reception module.
+ */
+void nrf_802154_periodic_rx_init(void);
+
+/**
+ * @brief Deinitializes the periodic reception module.
+ */
+void nrf_802154_periodic_rx_deinit(void);
+
+/**
+ * @brief Starts a periodic reception schedule.
+ *
+ * @param[in]  schedule  Index of the schedule.
+ * @param[in]  p_params  Pointer to the parameters of the schedule.
+ *
+ * @retval  true   The schedule was started.
+ * @retval  false  The parameters are invalid or the schedule is already running.
+ */
+bool nrf_802154_periodic_rx_start(uint8_t                                 schedule,
+                                  const nrf_802154_periodic_rx_params_t * p_params);
+
+/**
+ * @brief Stops a periodic reception schedule.
+ *
+ * @param[in]  schedule  Index of the schedule.
+ *
+ * @retval  true   The schedule was running and has been stopped.
+ * @retval  false  The schedule was not running.
+ */
+bool nrf_802154_periodic_rx_stop(uint8_t schedule);
+
+/**
+ * @brief Gets the statistics of a periodic reception schedule.
+ *
+ * @param[in]   schedule  Index of the schedule.
+ * @param[out]  p_stats   Pointer to the structure to be filled with the statistics.
+ *
+ * @retval  true   @p p_stats has been filled.
+ * @retval  false  The schedule index is invalid.
+ */
+bool nrf_802154_periodic_rx_stats_get(uint8_t                          schedule,
+                                      nrf_802154_periodic_rx_stats_t * p_stats);
+
+/**
+ * @brief Accounts for the end of a delayed reception window.
+ *
+ * This function is called by the delayed reception module for every window that ends
+ * with a timeout or that is denied or aborted.
+ *
+ * @param[in]  id     Identifier of the window.
+ * @param[in]  error  Reason for which the window ended.
+ *
+ * @retval  true   The window belonged to a periodic reception schedule and has been accounted.
+ * @retval  false  The window does not belong to any periodic reception schedule.
+ */
+bool nrf_802154_periodic_rx_window_ended(uint32_t id, nrf_802154_rx_error_t error);
+
+/**
+ *@}
+ **/
+
+#endif // NRF_802154_DELAYED_TRX_ENABLED && (NRF_802154_PERIODIC_RX_SCHEDULES > 0)
+
+#endif // NRF_802154_PERIODIC_RX_H__
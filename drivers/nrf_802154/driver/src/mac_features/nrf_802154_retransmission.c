@@ -0,0 +1,348 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the driver-side retransmissions of the 802.15.4 driver.
+ *
+ * Each frame registered by a higher layer transmission request is followed through
+ * the notification path, with its own retransmission state. When its transmission fails because
+ * of a missing or invalid ACK, or because of a channel access failure if so configured, the frame
+ * is requested again before the failure reaches the higher layer. A frame transmitted with
+ * the CSMA-CA procedure is retransmitted by the CSMA-CA module, and a missing ACK is detected as
+ * for any other frame.
+ */
+
+#include "mac_features/nrf_802154_retransmission.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_tx_power.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_RETRANSMISSION_ENABLED
+
+#if !NRF_802154_USE_RAW_API
+#error "NRF_802154_RETRANSMISSION_ENABLED requires NRF_802154_USE_RAW_API"
+#endif
+
+/**
+ * @brief Number of frames that can be registered at the same time.
+ *
+ * The frame being transmitted and one more frame, whose transmission request is either rejected
+ * or made while the final result of the first frame is being notified.
+ */
+#define RETRANSMISSION_FRAMES_NUM 2U
+
+/**
+ * @brief Retransmission state of a registered frame.
+ */
+typedef struct
+{
+    uint8_t                              * p_data;           ///< Pointer to the registered frame, NULL if the entry is free.
+    bool                                   csma_ca;          ///< If the frame is transmitted with the CSMA-CA procedure.
+    nrf_802154_transmit_params_t           params;           ///< Transmission parameters of the frame.
+    nrf_802154_transmit_retries_t          retries;          ///< Retransmission statistics of the frame.
+    uint32_t                               done_cnt;         ///< Number of transmission attempts of the frames registered in this entry that have ended.
+#if NRF_802154_CSMA_CA_ENABLED
+    nrf_802154_transmit_csma_ca_metadata_t csma_ca_metadata; ///< CSMA-CA metadata of the frame, if @ref csma_ca is true.
+#endif
+} retransmission_frame_t;
+
+static retransmission_frame_t m_frames[RETRANSMISSION_FRAMES_NUM]; ///< Registered frames.
+
+/**
+ * @brief Finds the entry of a registered frame.
+ *
+ * @param[in]  p_data  Pointer to the frame.
+ *
+ * @returns  Pointer to the entry, or NULL if the frame is not registered.
+ */
+static retransmission_frame_t * frame_find(const uint8_t * p_data)
+{
+    for (uint32_t i = 0; i < RETRANSMISSION_FRAMES_NUM; i++)
+    {
+        if (m_frames[i].p_data == p_data)
+        {
+            return &m_frames[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Finds a free entry for a frame that is not registered yet.
+ *
+ * Must be called in the MCU critical section, together with the filling of the entry.
+ *
+ * @param[in]  p_data  Pointer to the frame.
+ *
+ * @returns  Pointer to the entry, or NULL if the frame is already registered or no entry is free.
+ */
+static retransmission_frame_t * frame_claim(const uint8_t * p_data)
+{
+    return (frame_find(p_data) == NULL) ? frame_find(NULL) : NULL;
+}
+
+/**
+ * @brief Makes a filled entry visible to the notification path.
+ */
+static void frame_commit(retransmission_frame_t * p_frame, uint8_t * p_data)
+{
+    p_frame->retries = (nrf_802154_transmit_retries_t){.attempts = 1U};
+    p_frame->p_data  = p_data;
+}
+
+/**
+ * @brief Checks if the frame that failed to be transmitted is to be transmitted again.
+ */
+static bool retransmission_required(const retransmission_frame_t * p_frame,
+                                    nrf_802154_tx_error_t          error)
+{
+    const nrf_802154_retransmission_config_t * p_config =
+        nrf_802154_pib_retransmission_config_get();
+
+    if (p_frame->retries.attempts > p_config->max_frame_retries)
+    {
+        return false;
+    }
+
+    switch (error)
+    {
+        case NRF_802154_TX_ERROR_NO_ACK:
+        case NRF_802154_TX_ERROR_INVALID_ACK:
+            return true;
+
+        case NRF_802154_TX_ERROR_BUSY_CHANNEL:
+            // Without the random backoff of CSMA-CA, an immediate retransmission would most likely
+            // find the channel busy again
+            return p_frame->csma_ca &&
+                   (p_config->csma_ca_restart == NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ALWAYS);
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Requests the next transmission attempt of a registered frame.
+ */
+static bool frame_retransmit(retransmission_frame_t                     * p_frame,
+                             const nrf_802154_transmitted_frame_props_t * p_frame_props)
+{
+#if NRF_802154_CSMA_CA_ENABLED
+    if (p_frame->csma_ca)
+    {
+        nrf_802154_transmit_csma_ca_metadata_t * p_metadata = &p_frame->csma_ca_metadata;
+
+        p_metadata->frame_props = *p_frame_props;
+
+        if (nrf_802154_pib_retransmission_config_get()->csma_ca_restart !=
+            NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_NEVER)
+        {
+            return nrf_802154_request_csma_ca_start(p_frame->p_data, p_metadata);
+        }
+
+        uint8_t channel = p_metadata->tx_channel.use_metadata_value ?
+                          p_metadata->tx_channel.channel :
+                          nrf_802154_pib_channel_get();
+
+        p_frame->params.channel            = channel;
+        p_frame->params.cca                = true;
+        p_frame->params.immediate          = false;
+        p_frame->params.extra_cca_attempts = 0U;
+
+        (void)nrf_802154_tx_power_convert_metadata_to_tx_power_split(channel,
+                                                                     p_metadata->tx_power,
+                                                                     &p_frame->params.tx_power);
+    }
+#endif
+
+    // A retransmission keeps the security material and the frame counter of the first attempt
+    p_frame->params.frame_props = *p_frame_props;
+
+    return nrf_802154_request_transmit(NRF_802154_TERM_NONE,
+                                       REQ_ORIG_HIGHER_LAYER,
+                                       p_frame->p_data,
+                                       &p_frame->params,
+                                       NULL);
+}
+
+void nrf_802154_retransmission_init(void)
+{
+    memset(m_frames, 0, sizeof(m_frames));
+}
+
+bool nrf_802154_retransmission_transmit_register(uint8_t                            * p_data,
+                                                 const nrf_802154_transmit_params_t * p_params)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    retransmission_frame_t        * p_frame;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    p_frame = frame_claim(p_data);
+
+    if (p_frame != NULL)
+    {
+        p_frame->csma_ca = false;
+        p_frame->params  = *p_params;
+        frame_commit(p_frame, p_data);
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return p_frame != NULL;
+}
+
+bool nrf_802154_retransmission_csma_ca_register(
+    uint8_t                                      * p_data,
+    const nrf_802154_transmit_csma_ca_metadata_t * p_metadata)
+{
+#if NRF_802154_CSMA_CA_ENABLED
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    retransmission_frame_t        * p_frame;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    p_frame = frame_claim(p_data);
+
+    if (p_frame != NULL)
+    {
+        p_frame->csma_ca          = true;
+        p_frame->csma_ca_metadata = *p_metadata;
+        frame_commit(p_frame, p_data);
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return p_frame != NULL;
+#else
+    (void)p_data;
+    (void)p_metadata;
+
+    return false;
+#endif
+}
+
+void nrf_802154_retransmission_unregister(const uint8_t * p_data)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    retransmission_frame_t        * p_frame;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    p_frame = frame_find(p_data);
+
+    if (p_frame != NULL)
+    {
+        p_frame->p_data = NULL;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_retransmission_transmitted_hook(uint8_t                             * p_frame,
+                                                nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    retransmission_frame_t * p_entry = frame_find(p_frame);
+
+    if (p_entry == NULL)
+    {
+        return;
+    }
+
+    p_entry->done_cnt++;
+    p_metadata->retries = p_entry->retries;
+    p_entry->p_data     = NULL;
+}
+
+bool nrf_802154_retransmission_transmit_failed_hook(
+    uint8_t                             * p_frame,
+    nrf_802154_tx_error_t                 error,
+    nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    retransmission_frame_t * p_entry = frame_find(p_frame);
+
+    if (p_entry == NULL)
+    {
+        return false;
+    }
+
+    p_entry->done_cnt++;
+
+    switch (error)
+    {
+        case NRF_802154_TX_ERROR_BUSY_CHANNEL:
+            p_entry->retries.busy_channel++;
+            break;
+
+        case NRF_802154_TX_ERROR_NO_ACK:
+        case NRF_802154_TX_ERROR_INVALID_ACK:
+            p_entry->retries.no_ack++;
+            break;
+
+        default:
+            break;
+    }
+
+    if (retransmission_required(p_entry, error))
+    {
+        uint32_t done_cnt = p_entry->done_cnt;
+
+        p_entry->retries.attempts++;
+
+        if (frame_retransmit(p_entry, &p_metadata->frame_props) || (done_cnt != p_entry->done_cnt))
+        {
+            // The frame is being retransmitted, or the retransmission has already failed and
+            // the failure has been handled when it was notified
+            return true;
+        }
+
+        // The request was rejected, so the failure of the previous attempt is notified
+        p_entry->retries.attempts--;
+    }
+
+    p_metadata->retries = p_entry->retries;
+    p_entry->p_data     = NULL;
+
+    return false;
+}
+
+#endif // NRF_802154_RETRANSMISSION_ENABLED
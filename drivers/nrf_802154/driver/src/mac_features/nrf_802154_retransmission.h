@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_RETRANSMISSION_H
+#define NRF_802154_RETRANSMISSION_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+#include "nrf_802154_types_internal.h"
+
+/**
+ * @brief Initializes the retransmission module.
+ */
+void nrf_802154_retransmission_init(void);
+
+/**
+ * @brief Registers a frame whose transmission is about to be requested by the higher layer.
+ *
+ * The frames registered before keep their own retransmission state, so a frame whose request is
+ * rejected does not affect the frame being transmitted. The registration is atomic with respect
+ * to the notification path.
+ *
+ * @param[in]  p_data    Pointer to the buffer that contains the PHR and PSDU of the frame.
+ * @param[in]  p_params  Pointer to the transmission parameters of the frame.
+ *
+ * @retval  true   The frame has been registered.
+ * @retval  false  The frame is already registered or too many frames are registered.
+ */
+bool nrf_802154_retransmission_transmit_register(uint8_t                            * p_data,
+                                                 const nrf_802154_transmit_params_t * p_params);
+
+/**
+ * @brief Registers a frame whose transmission with the CSMA-CA procedure is about to be requested
+ *        by the higher layer.
+ *
+ * @param[in]  p_data      Pointer to the buffer that contains the PHR and PSDU of the frame.
+ * @param[in]  p_metadata  Pointer to the CSMA-CA transmission metadata of the frame.
+ *
+ * @retval  true   The frame has been registered.
+ * @retval  false  The frame is already registered or too many frames are registered.
+ */
+bool nrf_802154_retransmission_csma_ca_register(
+    uint8_t                                      * p_data,
+    const nrf_802154_transmit_csma_ca_metadata_t * p_metadata);
+
+/**
+ * @brief Unregisters a frame whose transmission request was rejected.
+ *
+ * @param[in]  p_data  Pointer to the buffer that contains the PHR and PSDU of the frame.
+ */
+void nrf_802154_retransmission_unregister(const uint8_t * p_data);
+
+/**
+ * @brief Handles a successful transmission of a frame.
+ *
+ * If the frame is the registered one, its retransmission statistics are written to
+ * @p p_metadata.
+ *
+ * @param[in]     p_frame     Pointer to the buffer that contains the PHR and PSDU of the frame.
+ * @param[inout]  p_metadata  Pointer to the metadata of the transmission.
+ */
+void nrf_802154_retransmission_transmitted_hook(uint8_t                             * p_frame,
+                                                nrf_802154_transmit_done_metadata_t * p_metadata);
+
+/**
+ * @brief Handles a failed transmission of a frame.
+ *
+ * If the frame is the registered one, it is either retransmitted or its retransmission statistics
+ * are written to @p p_metadata.
+ *
+ * @param[in]     p_frame     Pointer to the buffer that contains the PHR and PSDU of the frame.
+ * @param[in]     error       Cause of the failed transmission.
+ * @param[inout]  p_metadata  Pointer to the metadata of the transmission.
+ *
+ * @retval  true   The frame is being retransmitted and the failure must not be notified.
+ * @retval  false  The failure is to be notified to the higher layer.
+ */
+bool nrf_802154_retransmission_transmit_failed_hook(
+    uint8_t                             * p_frame,
+    nrf_802154_tx_error_t                 error,
+    nrf_802154_transmit_done_metadata_t * p_metadata);
+
+#endif // NRF_802154_RETRANSMISSION_H
@@ -37,6 +37,18 @@
 
 #include "nrf_802154_types.h"
 
+/**
+ * @brief Handle of a key stored in the Key Storage.
+ *
+ * A handle stays valid until the key is removed. It does not become valid again when a key with
+ * the same ID is stored afterwards, for example when the keys are rotated.
+ */
+typedef struct
+{
+    uint8_t  index;      ///< Position of the key in the Key Storage.
+    uint32_t generation; ///< Generation of the position when the handle was taken.
+} nrf_802154_security_pib_key_handle_t;
+
 /**
  * @brief Initialises the Key Storage inside the nRF 802.15.4 Radio Driver.
  *
@@ -103,6 +115,33 @@ void nrf_802154_security_pib_key_remove_all(void);
 nrf_802154_security_error_t nrf_802154_security_pib_key_use(nrf_802154_key_id_t * p_id,
                                                             void                * destination);
 
+/**
+ * @brief Gets the handle of a stored 802.15.4 MAC Security Key.
+ *
+ * Modules caching data derived from a key use the handle to detect that the key was removed,
+ * without being affected by the removal of other keys.
+ *
+ * @param[in]  p_id      Pointer to the ID of the key.
+ * @param[out] p_handle  Handle of the key.
+ *
+ * @retval NRF_802154_SECURITY_ERROR_NONE          The handle was populated.
+ * @retval NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND No such key found.
+ */
+nrf_802154_security_error_t nrf_802154_security_pib_key_handle_get(
+    nrf_802154_key_id_t                  * p_id,
+    nrf_802154_security_pib_key_handle_t * p_handle);
+
+/**
+ * @brief Checks if the key a handle was taken for is still stored.
+ *
+ * @param[in] p_handle  Pointer to the handle.
+ *
+ * @retval true   The key is stored.
+ * @retval false  The key was removed.
+ */
+bool nrf_802154_security_pib_key_handle_is_valid(
+    const nrf_802154_security_pib_key_handle_t * p_handle);
+
 /**
  * @brief Sets nRF 802.15.4 Radio Driver MAC Global Frame Counter.
  *
@@ -120,6 +159,11 @@ void nrf_802154_security_pib_global_frame_counter_set_if_larger(uint32_t frame_c
 /**
  * @brief Get the next 802.15.4 global frame counter.
  *
+ * The global frame counters are handed out from blocks of
+ * @ref NRF_802154_SECURITY_FRAME_COUNTER_BLOCK_SIZE counters reserved at once. This function must
+ * be called only from the contexts that cannot preempt each other, that is from the critical
+ * section and from the RADIO IRQ handler.
+ *
  * @param[out] p_frame_counter Pointer to the frame counter to populate.
  * @param[in]  p_id            Pointer to the ID of the key to get the frame counter for.
  *
@@ -42,6 +42,38 @@
 #include <stdbool.h>
 #include "nrf_802154_assert.h"
 
+/**
+ * The keys are looked up through an open addressing hash index of the key storage, with linear
+ * probing. An index bucket holds the position of a key in the storage or one of the values below.
+ * Removed keys leave a tombstone in their bucket so that the probe sequences of the other keys
+ * are not broken, which allows the lookups to run without locking while keys are being stored
+ * and removed in thread context. A key is stored in the first tombstone on its probe sequence,
+ * and the tombstones that end up followed by an empty bucket are emptied when a key is removed.
+ * The tombstones left in front of stored keys are dropped by rebuilding the index once they
+ * exceed @ref KEY_HASH_TOMBSTONES_MAX, so that rotated keys do not lengthen the lookups. The index
+ * is rebuilt in a second array, which then replaces the one used by the lookups.
+ */
+#define KEY_HASH_EMPTY     UINT8_MAX       ///< Bucket that has never been used since the last reset.
+#define KEY_HASH_TOMBSTONE (UINT8_MAX - 1) ///< Bucket of a removed key.
+
+#if NRF_802154_SECURITY_KEY_STORAGE_SIZE <= 4
+#define KEY_HASH_SIZE 8U
+#elif NRF_802154_SECURITY_KEY_STORAGE_SIZE <= 8
+#define KEY_HASH_SIZE 16U
+#elif NRF_802154_SECURITY_KEY_STORAGE_SIZE <= 16
+#define KEY_HASH_SIZE 32U
+#elif NRF_802154_SECURITY_KEY_STORAGE_SIZE <= 32
+#define KEY_HASH_SIZE 64U
+#elif NRF_802154_SECURITY_KEY_STORAGE_SIZE <= 64
+#define KEY_HASH_SIZE 128U
+#elif NRF_802154_SECURITY_KEY_STORAGE_SIZE <= 128
+#define KEY_HASH_SIZE 256U
+#else
+#error "NRF_802154_SECURITY_KEY_STORAGE_SIZE must not exceed 128"
+#endif
+
+#define KEY_HASH_TOMBSTONES_MAX (KEY_HASH_SIZE / 4U) ///< Tombstones that trigger an index rebuild.
+
 typedef struct
 {
     uint8_t                  key[AES_CCM_KEY_SIZE];
@@ -50,10 +82,32 @@ typedef struct
     uint32_t                 frame_counter;
     bool                     use_global_frame_counter;
     bool                     taken;
+    uint8_t                  bucket;     ///< Index bucket pointing at the entry.
+    uint32_t                 generation; ///< Incremented each time the entry is stored or removed.
 } table_entry_t;
 
-static table_entry_t m_key_storage[NRF_802154_SECURITY_KEY_STORAGE_SIZE];
-static uint32_t      m_global_frame_counter;
+static table_entry_t               m_key_storage[NRF_802154_SECURITY_KEY_STORAGE_SIZE];
+static volatile uint8_t            m_key_hash[2][KEY_HASH_SIZE];  ///< Index in use and spare index.
+static volatile uint8_t * volatile mp_key_hash = m_key_hash[0];   ///< Index used by the lookups.
+static uint32_t                    m_key_hash_tombstones;         ///< Tombstones in the index in use.
+static uint32_t                    m_global_frame_counter;        ///< First global frame counter not reserved yet.
+
+/**
+ * @brief Block of global frame counters reserved for the frames to be secured.
+ *
+ * Frame counters are requested only from the critical section and from the RADIO IRQ handler,
+ * which never preempt each other, so the block is consumed without atomic operations. Only
+ * the reservation of a block, which competes with the higher layer setting the counter, is atomic.
+ */
+static struct
+{
+    uint32_t next;       ///< Next frame counter to be used.
+    uint32_t end;        ///< Frame counter following the block.
+    uint32_t generation; ///< Value of @ref m_global_frame_counter_generation at the reservation.
+} m_global_frame_counter_block;
+
+/** Incremented when the higher layer sets the global frame counter, which discards the block. */
+static volatile uint32_t m_global_frame_counter_generation = 1U;
 
 static bool mode_is_valid(nrf_802154_key_id_mode_t mode)
 {
@@ -115,17 +169,216 @@ static bool key_matches(table_entry_t * p_key, nrf_802154_key_id_t * p_id)
     }
 }
 
-static bool key_is_present(nrf_802154_key_id_t * p_id)
+/**
+ * @brief Calculates the index bucket at which the probing for a key starts.
+ *
+ * The Key Index, which is the last byte of the Key Identifier, differs between the keys rotated
+ * by the higher layer, so it is mixed in last, without being diluted by further rounds.
+ */
+static uint32_t key_hash_get(const nrf_802154_key_id_t * p_id)
+{
+    uint32_t hash = 2166136261UL; // FNV-1a offset basis
+    int      len  = id_length_get(p_id->mode);
+
+    hash = (hash ^ (uint32_t)p_id->mode) * 16777619UL;
+
+    for (int i = 0; (i < len) && (p_id->p_key_id != NULL); i++)
+    {
+        hash = (hash ^ p_id->p_key_id[i]) * 16777619UL;
+    }
+
+    return (hash ^ (hash >> 16)) & (KEY_HASH_SIZE - 1U);
+}
+
+/**
+ * @brief Finds the key with the given identifier.
+ *
+ * @param[in]   p_id       Pointer to the ID of the key to find.
+ * @param[out]  p_free     If not NULL, set to the first bucket on the probe sequence of the key
+ *                         that can be used to store it, or to KEY_HASH_SIZE if there is none.
+ *
+ * @return Pointer to the key or NULL if the key was not found.
+ */
+static table_entry_t * key_find_with_free(nrf_802154_key_id_t * p_id, uint32_t * p_free)
 {
+    volatile uint8_t * p_hash = mp_key_hash;
+    uint32_t           bucket = key_hash_get(p_id);
+
+    if (p_free != NULL)
+    {
+        *p_free = KEY_HASH_SIZE;
+    }
+
+    for (uint32_t probe = 0U; probe < KEY_HASH_SIZE; probe++)
+    {
+        uint8_t index = p_hash[bucket];
+
+        if (index == KEY_HASH_EMPTY)
+        {
+            if ((p_free != NULL) && (*p_free == KEY_HASH_SIZE))
+            {
+                *p_free = bucket;
+            }
+
+            break;
+        }
+
+        if (index == KEY_HASH_TOMBSTONE)
+        {
+            if ((p_free != NULL) && (*p_free == KEY_HASH_SIZE))
+            {
+                *p_free = bucket;
+            }
+        }
+        else if (key_matches(&m_key_storage[index], p_id))
+        {
+            return &m_key_storage[index];
+        }
+
+        bucket = (bucket + 1U) & (KEY_HASH_SIZE - 1U);
+    }
+
+    return NULL;
+}
+
+static table_entry_t * key_find(nrf_802154_key_id_t * p_id)
+{
+    return key_find_with_free(p_id, NULL);
+}
+
+/**
+ * @brief Reserves a block of global frame counters.
+ *
+ * @retval true   The block was reserved.
+ * @retval false  All frame counters are used.
+ */
+static bool global_frame_counter_block_reserve(void)
+{
+    uint32_t generation;
+    uint32_t fc;
+    uint32_t end;
+
+    do
+    {
+        generation = m_global_frame_counter_generation;
+        fc         = m_global_frame_counter;
+
+        if (fc == UINT32_MAX)
+        {
+            return false;
+        }
+
+        end = ((UINT32_MAX - fc) > NRF_802154_SECURITY_FRAME_COUNTER_BLOCK_SIZE) ?
+              (fc + NRF_802154_SECURITY_FRAME_COUNTER_BLOCK_SIZE) : UINT32_MAX;
+    }
+    while (!nrf_802154_sl_atomic_cas_u32(&m_global_frame_counter, &fc, end));
+
+    m_global_frame_counter_block.next       = fc;
+    m_global_frame_counter_block.end        = end;
+    m_global_frame_counter_block.generation = generation;
+
+    return true;
+}
+
+/**
+ * @brief Gets the global frame counter to be used next.
+ */
+static uint32_t global_frame_counter_next_get(void)
+{
+    if (m_global_frame_counter_block.generation == m_global_frame_counter_generation)
+    {
+        return m_global_frame_counter_block.next;
+    }
+
+    return m_global_frame_counter;
+}
+
+static void key_hash_reset(void)
+{
+    for (uint32_t i = 0; i < KEY_HASH_SIZE; i++)
+    {
+        mp_key_hash[i] = KEY_HASH_EMPTY;
+    }
+
+    m_key_hash_tombstones = 0U;
+}
+
+/**
+ * @brief Rebuilds the index without tombstones in the spare array and starts using it.
+ *
+ * The lookups already in progress keep probing the previous index, which is left unchanged
+ * until the next rebuild.
+ */
+static void key_hash_rebuild(void)
+{
+    volatile uint8_t * p_hash = (mp_key_hash == m_key_hash[0]) ? m_key_hash[1] : m_key_hash[0];
+
+    for (uint32_t i = 0; i < KEY_HASH_SIZE; i++)
+    {
+        p_hash[i] = KEY_HASH_EMPTY;
+    }
+
     for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
     {
-        if (key_matches(&m_key_storage[i], p_id))
+        table_entry_t     * p_key = &m_key_storage[i];
+        nrf_802154_key_id_t id    = {.mode = p_key->mode, .p_key_id = p_key->id};
+        uint32_t            bucket;
+
+        if (!p_key->taken)
         {
-            return true;
+            continue;
         }
+
+        bucket = key_hash_get(&id);
+
+        while (p_hash[bucket] != KEY_HASH_EMPTY)
+        {
+            bucket = (bucket + 1U) & (KEY_HASH_SIZE - 1U);
+        }
+
+        p_hash[bucket] = (uint8_t)i;
+        p_key->bucket  = (uint8_t)bucket;
+    }
+
+    __DMB();
+
+    mp_key_hash           = p_hash;
+    m_key_hash_tombstones = 0U;
+}
+
+/**
+ * @brief Empties the tombstones at and before the given bucket that are followed by an empty bucket.
+ *
+ * A probe sequence stops at the first empty bucket, so such tombstones are not on the probe
+ * sequence of any stored key and lookups running in the meantime find the same keys.
+ */
+static void key_hash_tombstones_reclaim(uint32_t bucket)
+{
+    while ((mp_key_hash[bucket] == KEY_HASH_TOMBSTONE) &&
+           (mp_key_hash[(bucket + 1U) & (KEY_HASH_SIZE - 1U)] == KEY_HASH_EMPTY))
+    {
+        mp_key_hash[bucket] = KEY_HASH_EMPTY;
+        bucket              = (bucket - 1U) & (KEY_HASH_SIZE - 1U);
+        m_key_hash_tombstones--;
     }
+}
+
+static void key_remove(table_entry_t * p_key)
+{
+    p_key->taken = false;
+    p_key->generation++;
+
+    __DMB();
 
-    return false;
+    mp_key_hash[p_key->bucket] = KEY_HASH_TOMBSTONE;
+    m_key_hash_tombstones++;
+
+    key_hash_tombstones_reclaim(p_key->bucket);
+
+    if (m_key_hash_tombstones > KEY_HASH_TOMBSTONES_MAX)
+    {
+        key_hash_rebuild();
+    }
 }
 
 nrf_802154_security_error_t nrf_802154_security_pib_init(void)
@@ -133,8 +386,11 @@ nrf_802154_security_error_t nrf_802154_security_pib_init(void)
     for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
     {
         m_key_storage[i].taken = false;
+        m_key_storage[i].generation++;
     }
 
+    key_hash_reset();
+
     return NRF_802154_SECURITY_ERROR_NONE;
 }
 
@@ -147,6 +403,8 @@ nrf_802154_security_error_t nrf_802154_security_pib_key_store(nrf_802154_key_t *
 {
     NRF_802154_ASSERT(p_key != NULL);
 
+    uint32_t bucket;
+
     if (p_key->type != NRF_802154_KEY_CLEARTEXT)
     {
         return NRF_802154_SECURITY_ERROR_TYPE_NOT_SUPPORTED;
@@ -157,11 +415,14 @@ nrf_802154_security_error_t nrf_802154_security_pib_key_store(nrf_802154_key_t *
         return NRF_802154_SECURITY_ERROR_MODE_NOT_SUPPORTED;
     }
 
-    if (key_is_present(&p_key->id))
+    if (key_find_with_free(&p_key->id, &bucket) != NULL)
     {
         return NRF_802154_SECURITY_ERROR_ALREADY_PRESENT;
     }
 
+    // The index has more buckets than the storage has entries, so a free bucket is always found.
+    NRF_802154_ASSERT(bucket < KEY_HASH_SIZE);
+
     for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
     {
         if (m_key_storage[i].taken == false)
@@ -173,10 +434,21 @@ nrf_802154_security_error_t nrf_802154_security_pib_key_store(nrf_802154_key_t *
             memcpy(m_key_storage[i].id, p_key->id.p_key_id, id_length_get(p_key->id.mode));
             m_key_storage[i].frame_counter            = p_key->frame_counter;
             m_key_storage[i].use_global_frame_counter = p_key->use_global_frame_counter;
+            m_key_storage[i].bucket                   = (uint8_t)bucket;
+            m_key_storage[i].generation++;
 
             __DMB();
 
             m_key_storage[i].taken = true;
+
+            __DMB();
+
+            if (mp_key_hash[bucket] == KEY_HASH_TOMBSTONE)
+            {
+                m_key_hash_tombstones--;
+            }
+
+            mp_key_hash[bucket] = (uint8_t)i;
             return NRF_802154_SECURITY_ERROR_NONE;
         }
     }
@@ -188,24 +460,68 @@ nrf_802154_security_error_t nrf_802154_security_pib_key_remove(nrf_802154_key_id
 {
     NRF_802154_ASSERT(p_id != NULL);
 
+    table_entry_t * p_key = key_find(p_id);
+
+    if (p_key == NULL)
+    {
+        return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
+    }
+
+    key_remove(p_key);
+
+    return NRF_802154_SECURITY_ERROR_NONE;
+}
+
+void nrf_802154_security_pib_key_remove_all(void)
+{
     for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
     {
-        if (key_matches(&m_key_storage[i], p_id))
+        if (m_key_storage[i].taken)
         {
             m_key_storage[i].taken = false;
-            return NRF_802154_SECURITY_ERROR_NONE;
+            m_key_storage[i].generation++;
         }
     }
 
-    return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
+    __DMB();
+
+    // With no keys stored, the tombstones are not needed anymore.
+    key_hash_reset();
 }
 
-void nrf_802154_security_pib_key_remove_all(void)
+nrf_802154_security_error_t nrf_802154_security_pib_key_handle_get(
+    nrf_802154_key_id_t                  * p_id,
+    nrf_802154_security_pib_key_handle_t * p_handle)
 {
-    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
+    NRF_802154_ASSERT(p_id != NULL);
+    NRF_802154_ASSERT(p_handle != NULL);
+
+    table_entry_t * p_key = key_find(p_id);
+
+    if (p_key == NULL)
     {
-        m_key_storage[i].taken = false;
+        return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
     }
+
+    p_handle->index      = (uint8_t)(p_key - m_key_storage);
+    p_handle->generation = p_key->generation;
+
+    return NRF_802154_SECURITY_ERROR_NONE;
+}
+
+bool nrf_802154_security_pib_key_handle_is_valid(
+    const nrf_802154_security_pib_key_handle_t * p_handle)
+{
+    const table_entry_t * p_key;
+
+    if (p_handle->index >= NRF_802154_SECURITY_KEY_STORAGE_SIZE)
+    {
+        return false;
+    }
+
+    p_key = &m_key_storage[p_handle->index];
+
+    return p_key->taken && (p_key->generation == p_handle->generation);
 }
 
 nrf_802154_security_error_t nrf_802154_security_pib_key_use(nrf_802154_key_id_t * p_id,
@@ -214,27 +530,39 @@ nrf_802154_security_error_t nrf_802154_security_pib_key_use(nrf_802154_key_id_t
     NRF_802154_ASSERT(destination != NULL);
     NRF_802154_ASSERT(p_id != NULL);
 
-    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
+    table_entry_t * p_key = key_find(p_id);
+
+    if (p_key == NULL)
     {
-        if (key_matches(&m_key_storage[i], p_id))
-        {
-            memcpy((uint8_t *)destination, m_key_storage[i].key, sizeof(m_key_storage[i].key));
-            return NRF_802154_SECURITY_ERROR_NONE;
-        }
+        return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
     }
 
-    return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
+    memcpy((uint8_t *)destination, p_key->key, sizeof(p_key->key));
+
+    return NRF_802154_SECURITY_ERROR_NONE;
 }
 
 void nrf_802154_security_pib_global_frame_counter_set(uint32_t frame_counter)
 {
     m_global_frame_counter = frame_counter;
+
+    __DMB();
+
+    // Discard the block reserved from the previous value.
+    m_global_frame_counter_generation++;
 }
 
 void nrf_802154_security_pib_global_frame_counter_set_if_larger(uint32_t frame_counter)
 {
     uint32_t fc;
 
+    // The next counter of the block can only grow, so a stale read at worst discards the block
+    // unnecessarily. Setting the counter used next, as done after each transmission, is a no-op.
+    if (frame_counter <= global_frame_counter_next_get())
+    {
+        return;
+    }
+
     do
     {
         fc = m_global_frame_counter;
@@ -243,9 +571,12 @@ void nrf_802154_security_pib_global_frame_counter_set_if_larger(uint32_t frame_c
         {
             break;
         }
-
     }
     while (!nrf_802154_sl_atomic_cas_u32(&m_global_frame_counter, &fc, frame_counter));
+
+    __DMB();
+
+    m_global_frame_counter_generation++;
 }
 
 nrf_802154_security_error_t nrf_802154_security_pib_frame_counter_get_next(
@@ -255,44 +586,37 @@ nrf_802154_security_error_t nrf_802154_security_pib_frame_counter_get_next(
     NRF_802154_ASSERT(p_frame_counter != NULL);
     NRF_802154_ASSERT(p_id != NULL);
 
-    uint32_t * p_frame_counter_to_use = NULL;
-    uint32_t   fc;
+    table_entry_t * p_key = key_find(p_id);
 
-    for (uint32_t i = 0; i < NRF_802154_SECURITY_KEY_STORAGE_SIZE; i++)
+    if (p_key == NULL)
+    {
+        /* No proper key found. */
+        return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
+    }
+
+    if (p_key->use_global_frame_counter)
     {
-        if (key_matches(&m_key_storage[i], p_id))
+        if ((m_global_frame_counter_block.generation != m_global_frame_counter_generation) ||
+            (m_global_frame_counter_block.next == m_global_frame_counter_block.end))
         {
-            if (m_key_storage[i].use_global_frame_counter)
+            if (!global_frame_counter_block_reserve())
             {
-                p_frame_counter_to_use = &m_global_frame_counter;
+                return NRF_802154_SECURITY_ERROR_FRAME_COUNTER_OVERFLOW;
             }
-            else
-            {
-                p_frame_counter_to_use = &m_key_storage[i].frame_counter;
-            }
-            break;
         }
-    }
 
-    if (p_frame_counter_to_use == NULL)
-    {
-        /* No proper key found. */
-        return NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND;
+        *p_frame_counter = m_global_frame_counter_block.next++;
     }
-
-    do
+    else
     {
-        fc = __LDREXW(p_frame_counter_to_use);
-
-        if (fc == UINT32_MAX)
+        // Key frame counters are modified only here, so no atomic access is needed.
+        if (p_key->frame_counter == UINT32_MAX)
         {
-            __CLREX();
             return NRF_802154_SECURITY_ERROR_FRAME_COUNTER_OVERFLOW;
         }
-    }
-    while (__STREXW(fc + 1, p_frame_counter_to_use));
 
-    *p_frame_counter = *p_frame_counter_to_use - 1;
+        *p_frame_counter = p_key->frame_counter++;
+    }
 
     return NRF_802154_SECURITY_ERROR_NONE;
 }
@@ -240,7 +240,7 @@ bool nrf_802154_security_writer_tx_started_hook(uint8_t * p_frame)
     if (m_frame_counter_injected)
     {
         /* Mark dynamic data updated in the work buffer. */
-        nrf_802154_tx_work_buffer_is_dynamic_data_updated_set();
+        nrf_802154_tx_work_buffer_is_dynamic_data_updated_set(p_frame);
     }
 
     return true;
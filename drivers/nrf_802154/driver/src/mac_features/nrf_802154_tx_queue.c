@@ -0,0 +1,468 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the transmit queue of the 802.15.4 driver.
+ *
+ * Queued frames are kept in a ring in the order they were added. The frame at the head of the ring
+ * is the one being transmitted. When its result arrives through the notification path, the queue
+ * starts the next frame before the result reaches the higher layer, so consecutive frames are
+ * chained without a request from the higher layer. If @ref NRF_802154_TX_PIPELINE_DEPTH allows,
+ * the core sets up the next frame while the current one is on air.
+ */
+
+#include "mac_features/nrf_802154_tx_queue.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_core_hooks.h"
+#include "nrf_802154_notification.h"
+#include "nrf_802154_utils.h"
+
+#if NRF_802154_TX_QUEUE_ENABLED
+
+#if !NRF_802154_USE_RAW_API
+#error "NRF_802154_TX_QUEUE_ENABLED requires NRF_802154_USE_RAW_API"
+#endif
+
+/**
+ * @brief Frame held by the transmit queue.
+ */
+typedef struct
+{
+    uint8_t                      * p_data;   ///< Pointer to the frame to be transmitted.
+    nrf_802154_tx_queue_metadata_t metadata; ///< Transmit request metadata of the frame.
+    uint8_t                        attempts; ///< Number of transmission attempts started so far.
+} tx_queue_entry_t;
+
+static tx_queue_entry_t             m_entries[NRF_802154_TX_QUEUE_SIZE]; ///< Ring of queued frames.
+static uint8_t                      m_head;                              ///< Index of the oldest queued frame.
+static uint8_t                      m_count;                             ///< Number of queued frames.
+static bool                         m_active;                            ///< If the frame at the head of the ring is being transmitted.
+static uint32_t                     m_failed_cnt;                        ///< Number of failures of the frame being transmitted notified by the driver.
+static bool                         m_batch_mode;                        ///< If the results are notified in batches.
+static nrf_802154_tx_queue_result_t m_results[NRF_802154_TX_QUEUE_SIZE]; ///< Results waiting for the batch notification.
+static uint8_t                      m_results_count;                     ///< Number of valid elements of @ref m_results.
+
+static tx_queue_entry_t * entry_get(uint8_t idx)
+{
+    return &m_entries[(m_head + idx) % NRF_802154_TX_QUEUE_SIZE];
+}
+
+static bool metadata_is_valid(const nrf_802154_tx_queue_metadata_t * p_metadata)
+{
+#if !NRF_802154_CSMA_CA_ENABLED
+    if (p_metadata->csma_ca)
+    {
+        return false;
+    }
+#endif
+
+    // Secured frames must have their dynamic data set, see nrf_802154_transmitted_frame_props_t
+    return !(p_metadata->frame_props.is_secured && !p_metadata->frame_props.dynamic_data_is_set);
+}
+
+static bool entry_find(const uint8_t * p_data, uint8_t * p_idx)
+{
+    for (uint8_t i = 0; i < m_count; i++)
+    {
+        if (entry_get(i)->p_data == p_data)
+        {
+            *p_idx = i;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static bool error_is_retryable(nrf_802154_tx_error_t error)
+{
+    switch (error)
+    {
+        case NRF_802154_TX_ERROR_BUSY_CHANNEL:
+        case NRF_802154_TX_ERROR_NO_ACK:
+        case NRF_802154_TX_ERROR_INVALID_ACK:
+            return true;
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Requests the transmission of a queued frame from the driver.
+ */
+static bool frame_start(const tx_queue_entry_t * p_entry)
+{
+    const nrf_802154_tx_queue_metadata_t * p_metadata = &p_entry->metadata;
+
+#if NRF_802154_CSMA_CA_ENABLED
+    if (p_metadata->csma_ca)
+    {
+        nrf_802154_transmit_csma_ca_metadata_t metadata =
+        {
+            .frame_props = p_metadata->frame_props,
+            .tx_power    = p_metadata->tx_power,
+            .tx_channel  = p_metadata->tx_channel,
+        };
+
+        return nrf_802154_transmit_csma_ca_raw(p_entry->p_data, &metadata);
+    }
+#endif
+
+    nrf_802154_transmit_metadata_t metadata =
+    {
+        .frame_props = p_metadata->frame_props,
+        .cca         = p_metadata->cca,
+        .tx_power    = p_metadata->tx_power,
+        .tx_channel  = p_metadata->tx_channel,
+    };
+
+    return nrf_802154_transmit_raw(p_entry->p_data, &metadata);
+}
+
+/**
+ * @brief Ends the transmission attempt of the frame at the head of the queue.
+ *
+ * The frame is either kept at the head to be retransmitted or removed from the queue. In the batch
+ * mode, the result of a removed frame is stored for the batch notification.
+ *
+ * @retval  true   The result is consumed by the queue.
+ * @retval  false  The result is to be notified to the higher layer.
+ */
+static bool frame_done(nrf_802154_tx_error_t                       error,
+                       const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    tx_queue_entry_t              * p_entry = entry_get(0);
+    bool                            retry;
+    bool                            consumed;
+
+    retry = error_is_retryable(error) &&
+            (p_entry->attempts <= p_entry->metadata.max_retries);
+
+    // A retransmission keeps the security material and the frame counter of the first attempt
+    p_entry->metadata.frame_props = p_metadata->frame_props;
+
+    nrf_802154_tx_queue_result_t result =
+    {
+        .p_data        = p_entry->p_data,
+        .error         = error,
+        .frame_props   = p_metadata->frame_props,
+        .attempts      = p_entry->attempts,
+        .frame_pending = false,
+    };
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    m_active = false;
+
+    if (!retry)
+    {
+        m_head = (m_head + 1) % NRF_802154_TX_QUEUE_SIZE;
+        m_count--;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (retry)
+    {
+        consumed = true;
+    }
+    else if (m_batch_mode)
+    {
+        uint8_t * p_ack = (error == NRF_802154_TX_ERROR_NONE) ?
+                          p_metadata->data.transmitted.p_ack : NULL;
+
+        if (p_ack != NULL)
+        {
+            result.frame_pending = (p_ack[FRAME_PENDING_OFFSET] & FRAME_PENDING_BIT) != 0;
+            nrf_802154_buffer_free_raw(p_ack);
+        }
+
+        m_results[m_results_count++] = result;
+        consumed                     = true;
+    }
+    else
+    {
+        consumed = false;
+    }
+
+    return consumed;
+}
+
+/**
+ * @brief Notifies the stored results if the queue has become empty.
+ */
+static void batch_notify(void)
+{
+    nrf_802154_tx_queue_result_t    results[NRF_802154_TX_QUEUE_SIZE];
+    uint8_t                         results_count = 0;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (!m_active && (m_count == 0))
+    {
+        results_count = m_results_count;
+        memcpy(results, m_results, results_count * sizeof(results[0]));
+        m_results_count = 0;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (results_count != 0)
+    {
+        nrf_802154_tx_queue_done(results, results_count);
+    }
+}
+
+/**
+ * @brief Starts the frame at the head of the queue, unless a frame is already being transmitted.
+ *
+ * A frame that the driver refuses to transmit is reported as aborted and the next frame is tried.
+ */
+static void queue_process(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    tx_queue_entry_t              * p_entry = NULL;
+    uint32_t                        failed_cnt;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (!m_active && (m_count != 0))
+    {
+        p_entry  = entry_get(0);
+        m_active = true;
+        p_entry->attempts++;
+    }
+
+    failed_cnt = m_failed_cnt;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if ((p_entry != NULL) && !frame_start(p_entry) && (failed_cnt == m_failed_cnt))
+    {
+        // Unless the driver has already notified the failure, it is notified here. The failure is
+        // queued like the ones of the driver, so that the higher layer is not called from within
+        // the function that added the frame. The transmit failed hook then continues processing
+        // of the queue.
+        nrf_802154_transmit_done_metadata_t metadata = {};
+
+        metadata.frame_props = p_entry->metadata.frame_props;
+
+        nrf_802154_notify_transmit_failed(p_entry->p_data, NRF_802154_TX_ERROR_ABORTED, &metadata);
+    }
+
+    if (m_batch_mode)
+    {
+        batch_notify();
+    }
+}
+
+void nrf_802154_tx_queue_init(void)
+{
+    m_head          = 0;
+    m_count         = 0;
+    m_active        = false;
+    m_failed_cnt    = 0;
+    m_batch_mode    = false;
+    m_results_count = 0;
+}
+
+uint8_t nrf_802154_tx_queue_push(const nrf_802154_tx_queue_entry_t * p_entries, uint8_t count)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    uint8_t                         pushed = 0;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (; pushed < count; pushed++)
+    {
+        const nrf_802154_tx_queue_entry_t * p_new = &p_entries[pushed];
+        uint8_t                             idx;
+
+        if ((m_count + m_results_count >= NRF_802154_TX_QUEUE_SIZE) ||
+            (p_new->p_data == NULL) ||
+            !metadata_is_valid(&p_new->metadata) ||
+            entry_find(p_new->p_data, &idx))
+        {
+            break;
+        }
+
+        tx_queue_entry_t * p_entry = entry_get(m_count);
+
+        p_entry->p_data   = p_new->p_data;
+        p_entry->metadata = p_new->metadata;
+        p_entry->attempts = 0;
+        m_count++;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    if (pushed != 0)
+    {
+        queue_process();
+    }
+
+    return pushed;
+}
+
+bool nrf_802154_tx_queue_remove(const uint8_t * p_data)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    uint8_t                         idx;
+    bool                            result;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    result = entry_find(p_data, &idx) && !(m_active && (idx == 0));
+
+    if (result)
+    {
+        for (; idx + 1 < m_count; idx++)
+        {
+            *entry_get(idx) = *entry_get(idx + 1);
+        }
+
+        m_count--;
+
+        // The removed frame might have been set up ahead of its transmission
+        nrf_802154_core_hooks_tx_prepared_discard(p_data);
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+bool nrf_802154_tx_queue_next_get(const uint8_t                        * p_frame,
+                                  uint8_t                             ** pp_next,
+                                  nrf_802154_transmitted_frame_props_t * p_frame_props)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            result;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    result = m_active && (m_count > 1) && (entry_get(0)->p_data == p_frame);
+
+    if (result)
+    {
+        const tx_queue_entry_t * p_next = entry_get(1);
+
+        *pp_next       = p_next->p_data;
+        *p_frame_props = p_next->metadata.frame_props;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+uint8_t nrf_802154_tx_queue_count_get(void)
+{
+    return m_count + m_results_count;
+}
+
+bool nrf_802154_tx_queue_batch_mode_set(bool enabled)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    bool                            result;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    result = (m_count == 0) && (m_results_count == 0);
+
+    if (result)
+    {
+        m_batch_mode = enabled;
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+bool nrf_802154_tx_queue_tx_failed_hook(uint8_t * p_frame, nrf_802154_tx_error_t error)
+{
+    (void)error;
+
+    if (m_active && (entry_get(0)->p_data == p_frame))
+    {
+        m_failed_cnt++;
+    }
+
+    return true;
+}
+
+bool nrf_802154_tx_queue_transmitted_hook(uint8_t                                   * p_frame,
+                                          const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    if (!m_active || (entry_get(0)->p_data != p_frame))
+    {
+        return false;
+    }
+
+    bool consumed = frame_done(NRF_802154_TX_ERROR_NONE, p_metadata);
+
+    queue_process();
+
+    return consumed;
+}
+
+bool nrf_802154_tx_queue_transmit_failed_hook(
+    uint8_t                                   * p_frame,
+    nrf_802154_tx_error_t                       error,
+    const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    if (!m_active || (entry_get(0)->p_data != p_frame))
+    {
+        return false;
+    }
+
+    bool consumed = frame_done(error, p_metadata);
+
+    queue_process();
+
+    return consumed;
+}
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_TX_QUEUE_H
+#define NRF_802154_TX_QUEUE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_types.h"
+
+/**
+ * @brief Initializes the transmit queue.
+ */
+void nrf_802154_tx_queue_init(void);
+
+/**
+ * @brief Adds frames to the transmit queue and starts transmitting them if the queue was idle.
+ *
+ * Frames are added in order until the queue is full or a frame is rejected. A frame is rejected
+ * if its metadata is invalid or if it is already in the queue.
+ *
+ * @param[in]  p_entries  Array of frames to be added.
+ * @param[in]  count      Number of elements of @p p_entries.
+ *
+ * @returns  Number of frames added to the queue.
+ */
+uint8_t nrf_802154_tx_queue_push(const nrf_802154_tx_queue_entry_t * p_entries, uint8_t count);
+
+/**
+ * @brief Removes a frame that is waiting in the transmit queue.
+ *
+ * @param[in]  p_data  Pointer to the frame to be removed.
+ *
+ * @retval  true   The frame was removed. Its transmission result is not going to be notified.
+ * @retval  false  The frame is not in the queue or its transmission has already started.
+ */
+bool nrf_802154_tx_queue_remove(const uint8_t * p_data);
+
+/**
+ * @brief Gets the frame that follows the given one in the transmit queue.
+ *
+ * @param[in]   p_frame        Pointer to the frame being transmitted.
+ * @param[out]  pp_next        Pointer to the next frame to be transmitted.
+ * @param[out]  p_frame_props  Properties the next frame is to be transmitted with.
+ *
+ * @retval  true   @p p_frame is being transmitted from the queue and the next frame is waiting.
+ * @retval  false  There is no next frame to be transmitted after @p p_frame.
+ */
+bool nrf_802154_tx_queue_next_get(const uint8_t                        * p_frame,
+                                  uint8_t                             ** pp_next,
+                                  nrf_802154_transmitted_frame_props_t * p_frame_props);
+
+/**
+ * @brief Gets the number of frames held by the transmit queue.
+ *
+ * @returns  Number of frames waiting for transmission, being transmitted and, in the batch
+ *           notification mode, waiting for their results to be notified.
+ */
+uint8_t nrf_802154_tx_queue_count_get(void);
+
+/**
+ * @brief Selects how the transmission results of the queued frames are notified.
+ *
+ * @param[in]  enabled  If the results are notified together with @ref nrf_802154_tx_queue_done
+ *                      when the queue becomes empty. Otherwise, each result is notified with
+ *                      @ref nrf_802154_transmitted_raw or @ref nrf_802154_transmit_failed.
+ *
+ * @retval  true   The mode was set.
+ * @retval  false  The queue is not empty and the mode was not changed.
+ */
+bool nrf_802154_tx_queue_batch_mode_set(bool enabled);
+
+/**
+ * @brief Counts a failure of the frame being transmitted from the transmit queue.
+ *
+ * The driver is about to notify the failure. The transmit queue notifies a frame that the driver
+ * refuses to transmit by itself only if the driver does not.
+ *
+ * @param[in]  p_frame  Pointer to the buffer that contains the PHR and PSDU of the frame.
+ * @param[in]  error    Cause of the failed transmission.
+ *
+ * @retval  true  Always, the failure is to be notified.
+ */
+bool nrf_802154_tx_queue_tx_failed_hook(uint8_t * p_frame, nrf_802154_tx_error_t error);
+
+/**
+ * @brief Handles a successful transmission of a frame.
+ *
+ * If the frame comes from the transmit queue, the next queued frame is started before returning.
+ *
+ * @param[in]  p_frame     Pointer to the buffer that contains the PHR and PSDU of the frame.
+ * @param[in]  p_metadata  Pointer to the metadata of the transmission.
+ *
+ * @retval  true   The result was consumed by the queue and must not be notified.
+ * @retval  false  The result is to be notified to the higher layer.
+ */
+bool nrf_802154_tx_queue_transmitted_hook(uint8_t                                   * p_frame,
+                                          const nrf_802154_transmit_done_metadata_t * p_metadata);
+
+/**
+ * @brief Handles a failed transmission of a frame.
+ *
+ * If the frame comes from the transmit queue, it is either retransmitted or the next queued frame
+ * is started before returning.
+ *
+ * @param[in]  p_frame     Pointer to the buffer that contains the PHR and PSDU of the frame.
+ * @param[in]  error       Cause of the failed transmission.
+ * @param[in]  p_metadata  Pointer to the metadata of the transmission.
+ *
+ * @retval  true   The failure was consumed by the queue and must not be notified.
+ * @retval  false  The failure is to be notified to the higher layer.
+ */
+bool nrf_802154_tx_queue_transmit_failed_hook(
+    uint8_t                                   * p_frame,
+    nrf_802154_tx_error_t                       error,
+    const nrf_802154_transmit_done_metadata_t * p_metadata);
+
+#endif // NRF_802154_TX_QUEUE_H
@@ -54,6 +54,7 @@
 #include "nrf_802154_core.h"
 #include "nrf_802154_critical_section.h"
 #include "nrf_802154_debug.h"
+#include "nrf_802154_encrypt.h"
 #include "nrf_802154_notification.h"
 #include "nrf_802154_pib.h"
 #include "nrf_802154_request.h"
@@ -69,10 +70,17 @@
 #include "timer/nrf_802154_timer_coord.h"
 
 #include "mac_features/nrf_802154_ack_timeout.h"
+#include "mac_features/nrf_802154_csma_ca_backoff.h"
 #include "mac_features/nrf_802154_delayed_trx.h"
+#include "mac_features/nrf_802154_ed_sweep.h"
+#include "mac_features/nrf_802154_filter_rules.h"
 #include "mac_features/nrf_802154_ie_writer.h"
 #include "mac_features/nrf_802154_ifs.h"
+#include "mac_features/nrf_802154_neighbor_table.h"
+#include "mac_features/nrf_802154_periodic_rx.h"
+#include "mac_features/nrf_802154_retransmission.h"
 #include "mac_features/nrf_802154_security_pib.h"
+#include "mac_features/nrf_802154_tx_queue.h"
 #include "mac_features/ack_generator/nrf_802154_ack_data.h"
 
 #include "nrf_802154_sl_ant_div.h"
@@ -206,6 +214,39 @@ void nrf_802154_short_address_set(const uint8_t * p_short_address)
     nrf_802154_pib_short_address_set(p_short_address);
 }
 
+#if NRF_802154_IDENTITIES_NUM > 1
+
+bool nrf_802154_identity_set(uint8_t index, const nrf_802154_identity_t * p_identity)
+{
+    return nrf_802154_pib_identity_set(index, p_identity);
+}
+
+bool nrf_802154_identity_clear(uint8_t index)
+{
+    return nrf_802154_pib_identity_clear(index);
+}
+
+#endif // NRF_802154_IDENTITIES_NUM > 1
+
+#if NRF_802154_FILTER_RULES_ENABLED
+
+bool nrf_802154_filter_rule_set(uint8_t index, const nrf_802154_filter_rule_t * p_rule)
+{
+    return nrf_802154_filter_rules_set(index, p_rule);
+}
+
+bool nrf_802154_filter_rule_clear(uint8_t index)
+{
+    return nrf_802154_filter_rules_clear(index);
+}
+
+uint32_t nrf_802154_filter_rule_hits_get(uint8_t index)
+{
+    return nrf_802154_filter_rules_hits_get(index);
+}
+
+#endif // NRF_802154_FILTER_RULES_ENABLED
+
 void nrf_802154_init(void)
 {
     static const nrf_802154_sl_crit_sect_interface_t crit_sect_int =
@@ -236,10 +277,25 @@ void nrf_802154_init(void)
 #endif
 #if NRF_802154_DELAYED_TRX_ENABLED
     nrf_802154_delayed_trx_init();
+#if NRF_802154_PERIODIC_RX_SCHEDULES > 0
+    nrf_802154_periodic_rx_init();
+#endif
 #endif
 #if NRF_802154_IFS_ENABLED
     nrf_802154_ifs_init();
 #endif
+#if NRF_802154_NEIGHBOR_TABLE_ENABLED
+    nrf_802154_neighbor_table_init();
+#endif
+#if NRF_802154_FILTER_RULES_ENABLED
+    nrf_802154_filter_rules_init();
+#endif
+#if NRF_802154_TX_QUEUE_ENABLED
+    nrf_802154_tx_queue_init();
+#endif
+#if NRF_802154_RETRANSMISSION_ENABLED
+    nrf_802154_retransmission_init();
+#endif
 }
 
 void nrf_802154_deinit(void)
@@ -256,6 +312,9 @@ void nrf_802154_deinit(void)
     nrf_802154_ack_timeout_deinit();
 #endif
 #if NRF_802154_DELAYED_TRX_ENABLED
+#if NRF_802154_PERIODIC_RX_SCHEDULES > 0
+    nrf_802154_periodic_rx_deinit();
+#endif
     nrf_802154_delayed_trx_deinit();
 #endif
 #if NRF_802154_IFS_ENABLED
@@ -496,6 +555,11 @@ bool nrf_802154_transmit_raw(uint8_t                              * p_data,
                                                                  &params.tx_power);
 
     result = are_frame_properties_valid(&params.frame_props);
+
+#if NRF_802154_RETRANSMISSION_ENABLED
+    result = result && nrf_802154_retransmission_transmit_register(p_data, &params);
+#endif
+
     if (result)
     {
         result = nrf_802154_request_transmit(NRF_802154_TERM_NONE,
@@ -503,6 +567,13 @@ bool nrf_802154_transmit_raw(uint8_t                              * p_data,
                                              p_data,
                                              &params,
                                              NULL);
+
+#if NRF_802154_RETRANSMISSION_ENABLED
+        if (!result)
+        {
+            nrf_802154_retransmission_unregister(p_data);
+        }
+#endif
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
@@ -640,6 +711,41 @@ bool nrf_802154_receive_at_cancel(uint32_t id)
     return result;
 }
 
+#if NRF_802154_PERIODIC_RX_SCHEDULES > 0
+
+bool nrf_802154_receive_periodic_start(uint8_t                                 schedule,
+                                       const nrf_802154_periodic_rx_params_t * p_params)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_periodic_rx_start(schedule, p_params);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_receive_periodic_stop(uint8_t schedule)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_periodic_rx_stop(schedule);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_receive_periodic_stats_get(uint8_t                          schedule,
+                                           nrf_802154_periodic_rx_stats_t * p_stats)
+{
+    return nrf_802154_periodic_rx_stats_get(schedule, p_stats);
+}
+
+#endif // NRF_802154_PERIODIC_RX_SCHEDULES > 0
+
 #endif // NRF_802154_DELAYED_TRX_ENABLED
 
 bool nrf_802154_energy_detection(uint32_t time_us)
@@ -654,6 +760,22 @@ bool nrf_802154_energy_detection(uint32_t time_us)
     return result;
 }
 
+#if NRF_802154_ED_SWEEP_ENABLED
+bool nrf_802154_energy_detection_sweep(const nrf_802154_ed_sweep_params_t * p_params)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_ed_sweep_params_check(p_params) &&
+             nrf_802154_request_energy_detection_sweep(NRF_802154_TERM_NONE, p_params);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#endif // NRF_802154_ED_SWEEP_ENABLED
+
 bool nrf_802154_cca(void)
 {
     bool result;
@@ -768,6 +890,112 @@ bool nrf_802154_buffer_free_immediately(uint8_t * p_data)
 
 #endif // NRF_802154_USE_RAW_API
 
+bool nrf_802154_sleep_async(nrf_802154_async_done_t done, void * p_context)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_sleep_async(NRF_802154_TERM_802154, done, p_context);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_receive_async(nrf_802154_async_done_t done, void * p_context)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_receive_async(NRF_802154_TERM_802154,
+                                              REQ_ORIG_HIGHER_LAYER,
+                                              NULL,
+                                              true,
+                                              NRF_802154_RESERVED_IMM_RX_WINDOW_ID,
+                                              done,
+                                              p_context);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#if NRF_802154_DELAYED_TRX_ENABLED
+bool nrf_802154_receive_at_async(uint64_t                rx_time,
+                                 uint32_t                timeout,
+                                 uint8_t                 channel,
+                                 uint32_t                id,
+                                 nrf_802154_async_done_t done,
+                                 void                  * p_context)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_receive_at_async(rx_time, timeout, channel, id, done, p_context);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+bool nrf_802154_receive_at_cancel_async(uint32_t                id,
+                                        nrf_802154_async_done_t done,
+                                        void                  * p_context)
+{
+    bool result;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    result = nrf_802154_request_receive_at_cancel_async(id, done, p_context);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#endif // NRF_802154_DELAYED_TRX_ENABLED
+
+#if NRF_802154_USE_RAW_API
+
+bool nrf_802154_buffer_free_raw_async(uint8_t               * p_data,
+                                      nrf_802154_async_done_t done,
+                                      void                  * p_context)
+{
+    bool          result;
+    rx_buffer_t * p_buffer = (rx_buffer_t *)p_data;
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    NRF_802154_ASSERT(p_buffer->free == false);
+    (void)p_buffer;
+
+    result = nrf_802154_request_buffer_free_async(p_data, done, p_context);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#else // NRF_802154_USE_RAW_API
+
+bool nrf_802154_buffer_free_async(uint8_t               * p_data,
+                                  nrf_802154_async_done_t done,
+                                  void                  * p_context)
+{
+    bool          result;
+    rx_buffer_t * p_buffer = (rx_buffer_t *)(p_data - RAW_PAYLOAD_OFFSET);
+
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    NRF_802154_ASSERT(p_buffer->free == false);
+    (void)p_buffer;
+
+    result = nrf_802154_request_buffer_free_async(p_data - RAW_PAYLOAD_OFFSET, done, p_context);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+    return result;
+}
+
+#endif // NRF_802154_USE_RAW_API
+
 bool nrf_802154_rssi_measure_begin(void)
 {
     return nrf_802154_request_rssi_measure();
@@ -905,9 +1133,21 @@ bool nrf_802154_transmit_csma_ca_raw(uint8_t
     }
 
     result = are_frame_properties_valid(&p_metadata->frame_props);
+
+#if NRF_802154_RETRANSMISSION_ENABLED
+    result = result && nrf_802154_retransmission_csma_ca_register(p_data, p_metadata);
+#endif
+
     if (result)
     {
         result = nrf_802154_request_csma_ca_start(p_data, p_metadata);
+
+#if NRF_802154_RETRANSMISSION_ENABLED
+        if (!result)
+        {
+            nrf_802154_retransmission_unregister(p_data);
+        }
+#endif
     }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
@@ -979,6 +1219,39 @@ uint8_t nrf_802154_csma_ca_max_backoffs_get(void)
     return nrf_802154_pib_csmaca_max_backoffs_get();
 }
 
+bool nrf_802154_csma_ca_backoff_policy_set(nrf_802154_csma_ca_backoff_policy_id_t policy)
+{
+    const nrf_802154_csma_ca_backoff_policy_t * p_policy =
+        nrf_802154_csma_ca_backoff_policy_builtin_get(policy);
+
+    if (p_policy == NULL)
+    {
+        return false;
+    }
+
+    nrf_802154_pib_csmaca_backoff_policy_set(p_policy);
+
+    return true;
+}
+
+void nrf_802154_csma_ca_backoff_policy_custom_set(
+    const nrf_802154_csma_ca_backoff_policy_t * p_policy)
+{
+    if (p_policy == NULL)
+    {
+        p_policy = nrf_802154_csma_ca_backoff_policy_builtin_get(
+            NRF_802154_CSMA_CA_BACKOFF_POLICY_IEEE);
+    }
+    else
+    {
+        NRF_802154_ASSERT((p_policy->start != NULL) &&
+                          (p_policy->periods_get != NULL) &&
+                          (p_policy->busy != NULL));
+    }
+
+    nrf_802154_pib_csmaca_backoff_policy_set(p_policy);
+}
+
 #endif // NRF_802154_CSMA_CA_ENABLED
 
 #if NRF_802154_ACK_TIMEOUT_ENABLED
@@ -1072,6 +1345,62 @@ uint64_t nrf_802154_time_get(void)
     return nrf_802154_sl_timer_current_time_get();
 }
 
+#if NRF_802154_NEIGHBOR_TABLE_ENABLED
+
+uint8_t nrf_802154_neighbor_table_get(nrf_802154_neighbor_t * p_neighbors,
+                                      uint8_t                 neighbors_max)
+{
+    return nrf_802154_neighbor_table_copy(p_neighbors, neighbors_max);
+}
+
+bool nrf_802154_neighbor_get(const uint8_t         * p_addr,
+                             bool                    extended,
+                             nrf_802154_neighbor_t * p_neighbor)
+{
+    return nrf_802154_neighbor_table_entry_copy(p_addr, extended, p_neighbor);
+}
+
+#endif // NRF_802154_NEIGHBOR_TABLE_ENABLED
+
+#if NRF_802154_TX_QUEUE_ENABLED
+
+uint8_t nrf_802154_tx_queue_enqueue_raw(const nrf_802154_tx_queue_entry_t * p_entries,
+                                        uint8_t                             count)
+{
+    return nrf_802154_tx_queue_push(p_entries, count);
+}
+
+bool nrf_802154_tx_queue_cancel(const uint8_t * p_data)
+{
+    return nrf_802154_tx_queue_remove(p_data);
+}
+
+uint8_t nrf_802154_tx_queue_length_get(void)
+{
+    return nrf_802154_tx_queue_count_get();
+}
+
+bool nrf_802154_tx_queue_batch_notify_set(bool enabled)
+{
+    return nrf_802154_tx_queue_batch_mode_set(enabled);
+}
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
+#if NRF_802154_RETRANSMISSION_ENABLED
+
+bool nrf_802154_retransmission_config_set(const nrf_802154_retransmission_config_t * p_config)
+{
+    return nrf_802154_pib_retransmission_config_set(p_config);
+}
+
+void nrf_802154_retransmission_config_get(nrf_802154_retransmission_config_t * p_config)
+{
+    *p_config = *nrf_802154_pib_retransmission_config_get();
+}
+
+#endif // NRF_802154_RETRANSMISSION_ENABLED
+
 void nrf_802154_security_global_frame_counter_set(uint32_t frame_counter)
 {
     nrf_802154_security_pib_global_frame_counter_set(frame_counter);
@@ -1089,12 +1418,25 @@ nrf_802154_security_error_t nrf_802154_security_key_store(nrf_802154_key_t * p_k
 
 nrf_802154_security_error_t nrf_802154_security_key_remove(nrf_802154_key_id_t * p_id)
 {
-    return nrf_802154_security_pib_key_remove(p_id);
+    nrf_802154_security_error_t result = nrf_802154_security_pib_key_remove(p_id);
+
+#if NRF_802154_ENCRYPTION_ENABLED
+    if (result == NRF_802154_SECURITY_ERROR_NONE)
+    {
+        nrf_802154_encrypt_key_cache_purge();
+    }
+#endif
+
+    return result;
 }
 
 void nrf_802154_security_key_remove_all(void)
 {
     nrf_802154_security_pib_key_remove_all();
+
+#if NRF_802154_ENCRYPTION_ENABLED
+    nrf_802154_encrypt_key_cache_purge();
+#endif
 }
 
 #if NRF_802154_DELAYED_TRX_ENABLED && NRF_802154_IE_WRITER_ENABLED
@@ -1231,6 +1573,16 @@ __WEAK void nrf_802154_transmit_failed(uint8_t
     (void)p_metadata;
 }
 
+#if NRF_802154_TX_QUEUE_ENABLED
+__WEAK void nrf_802154_tx_queue_done(const nrf_802154_tx_queue_result_t * p_results,
+                                     uint8_t                              count)
+{
+    (void)p_results;
+    (void)count;
+}
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
 __WEAK void nrf_802154_energy_detected(const nrf_802154_energy_detected_t * p_result)
 {
     (void)p_result;
@@ -38,8 +38,13 @@
 #include <stdbool.h>
 #include <stdint.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 
+#if NRF_802154_ENCRYPTION_ACCELERATOR_SW
+#include "nrf_802154_aes_sw.h"
+#endif
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -60,6 +65,9 @@ typedef struct
     uint8_t   nonce[NRF_802154_AES_CCM_NONCE_SIZE]; ///< Pointer to AES-CCM* nonce
     uint8_t   mic_level;                            ///< Message Integrity Code level
     uint8_t * raw_frame;                            ///< Pointer to the buffer that contains the PHR and PSDU of the transmitted frame.
+#if NRF_802154_ENCRYPTION_ACCELERATOR_SW
+    const nrf_802154_aes_sw_ctx_t * p_key_ctx;      ///< Pointer to the expanded @c key or NULL if the key needs to be expanded
+#endif
 } nrf_802154_aes_ccm_data_t;
 
 /**
@@ -34,7 +34,8 @@
 
 #include "nrf_802154_config.h"
 
-#if NRF_802154_ENCRYPTION_ENABLED && !NRF_802154_ENCRYPTION_ACCELERATOR_ECB
+#if NRF_802154_ENCRYPTION_ENABLED && !NRF_802154_ENCRYPTION_ACCELERATOR_ECB && \
+    !NRF_802154_ENCRYPTION_ACCELERATOR_SW
 
 /** Configures if the CCM's OUT.PTR pointer points to the same memory location as PACKETPTR register
  *  of the RADIO.
@@ -103,6 +104,7 @@ static bool             m_initialized;              ///< Module init status.
 static nrf_ccm_config_t m_ccm_config;               ///< CCM configuration used during the next transmission.
 static uint32_t         m_key[4];                   ///< Key used during the next transmission.
 static uint32_t         m_nonce[4];                 ///< Nonce used during the next transmission.
+static const uint8_t  * mp_frame;                   ///< Frame being secured.
 
 static void ccm_disable(void)
 {
@@ -126,7 +128,7 @@ static void ccm_irq_handler(void)
         nrf_ccm_event_check(NRF_802154_CCM_INSTANCE, NRF_CCM_EVENT_END))
     {
         nrf_ccm_event_clear(NRF_802154_CCM_INSTANCE, NRF_CCM_EVENT_END);
-        nrf_802154_tx_work_buffer_is_secured_set();
+        nrf_802154_tx_work_buffer_is_secured_set(mp_frame);
         ccm_disable();
     }
 }
@@ -334,7 +336,7 @@ bool nrf_802154_aes_ccm_transform_prepare(const nrf_802154_aes_ccm_data_t * p_ae
 
     NRF_802154_ASSERT((offset >= 0) && (offset <= MAX_PACKET_SIZE + PHR_SIZE));
 
-    nrf_802154_tx_work_buffer_plain_text_offset_set(offset);
+    nrf_802154_tx_work_buffer_plain_text_offset_set(p_aes_ccm_data->raw_frame, offset);
     p_work_buffer = nrf_802154_tx_work_buffer_enable_for(p_aes_ccm_data->raw_frame);
     p_ciphertext  = p_work_buffer + offset;
 
@@ -362,6 +364,8 @@ void nrf_802154_aes_ccm_transform_start(uint8_t * p_frame)
         return;
     }
 
+    mp_frame = p_frame;
+
     ccm_peripheral_configure();
     ppi_configure();
 
@@ -383,4 +387,4 @@ void nrf_802154_aes_ccm_transform_reset(void)
     memset(m_nonce, 0, sizeof(m_nonce));
 }
 
-#endif // NRF_802154_ENCRYPTION_ENABLED && !NRF_802154_ENCRYPTION_ACCELERATOR_ECB
+#endif // NRF_802154_ENCRYPTION_ENABLED && !NRF_802154_ENCRYPTION_ACCELERATOR_ECB && !NRF_802154_ENCRYPTION_ACCELERATOR_SW
@@ -439,7 +439,7 @@ static void perform_plain_text_authorization(void)
 
 static void transformation_finished(void)
 {
-    nrf_802154_tx_work_buffer_is_secured_set();
+    nrf_802154_tx_work_buffer_is_secured_set(m_aes_ccm_data.raw_frame);
     m_aes_ccm_data.raw_frame = NULL;
 }
 
@@ -569,7 +569,7 @@ bool nrf_802154_aes_ccm_transform_prepare(const nrf_802154_aes_ccm_data_t * p_ae
 
     NRF_802154_ASSERT((offset >= 0) && (offset <= MAX_PACKET_SIZE + PHR_SIZE));
 
-    nrf_802154_tx_work_buffer_plain_text_offset_set(offset);
+    nrf_802154_tx_work_buffer_plain_text_offset_set(p_aes_ccm_data->raw_frame, offset);
     mp_work_buffer = nrf_802154_tx_work_buffer_enable_for(p_aes_ccm_data->raw_frame);
     mp_ciphertext  = mp_work_buffer + offset;
 
@@ -0,0 +1,325 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the AES-CCM* transformation in software.
+ *
+ * Unlike the ECB-based implementation, which is driven block by block from the ECB event handler,
+ * the whole authentication and encryption transformation is computed in a single call
+ * to @ref nrf_802154_aes_ccm_transform_start using @ref nrf_802154_aes_sw_block_encrypt.
+ */
+
+#include "nrf_802154_config.h"
+
+#if NRF_802154_ENCRYPTION_ENABLED && NRF_802154_ENCRYPTION_ACCELERATOR_SW
+
+#include "nrf_802154_aes_ccm.h"
+
+#include <stddef.h>
+#include <string.h>
+
+#include "nrf_802154_aes_sw.h"
+#include "nrf_802154_assert.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_tx_work_buffer.h"
+
+#ifndef MIN
+#define MIN(a, b)                           ((a) < (b) ? (a) : (b)) ///< Leaves the minimum of the two arguments
+#endif
+
+#define NRF_802154_AES_CCM_BLOCK_SIZE       NRF_802154_AES_SW_BLOCK_SIZE // Annex B4 Specification of generic CCM* a)
+
+#define NRF_802154_AES_CCM_ADATA_AUTH_FLAG  (0x40)                  // Annex B4.1.2 - Adata flag for authentication transform
+#define NRF_802154_AES_CCM_M_BITS_AUTH_FLAG 3                       // Annex B4.1.2 - Nr of bits for MIC flag for authentication transform
+#define NRF_802154_AES_CCM_FLAGS_OCTET      0                       // Annex B4.1.2b), B4.1.3b) - Position of octet for flags in B0 and Ai fields
+#define NRF_802154_AES_CCM_NONCE_OCTET      1                       // Annex B4.1.2b), B4.1.3b) - Position of octet for nonce in B0 and Ai fields
+#define NRF_802154_AES_CCM_ADATA_LEN_SIZE   2                       // Annex B4.1.1b) - Size of the length of auth data in AddAuthData
+
+static nrf_802154_aes_ccm_data_t m_aes_ccm_data;                                   ///< AES CCM Frame
+static nrf_802154_aes_sw_ctx_t   m_aes_ctx;                                        ///< Expanded key of the frame being transformed
+static uint8_t                 * mp_ciphertext;                                    ///< Pointer to ciphertext destination buffer.
+static uint8_t                 * mp_work_buffer;                                   ///< Pointer to work buffer that stores the frame being transformed.
+
+static const uint8_t m_mic_size[] = { 0, MIC_32_SIZE, MIC_64_SIZE, MIC_128_SIZE }; ///< Security level - 802.15.4-2015 Standard Table 9.6
+
+/**
+ * @brief XORs @p len bytes of @p p_second into @p p_first.
+ */
+static inline void block_xor(uint8_t * p_first, const uint8_t * p_second, uint8_t len)
+{
+    for (uint8_t i = 0; i < len; i++)
+    {
+        p_first[i] ^= p_second[i];
+    }
+}
+
+/**
+ * @brief   Forms 16-octet B0 or Ai field
+ * IEEE std 802.15.4-2015, B.4.1.2b Authentication transformation and B.4.1.3 Encryption transformation
+ *
+ * @param[in]  flags    Flags octet
+ * @param[in]  counter  Value of the two last octets: l(m) for B0 or the counter for Ai
+ * @param[out] p_block  Pointer to memory for the block
+ */
+static void block_format(uint8_t flags, uint16_t counter, uint8_t * p_block)
+{
+    p_block[NRF_802154_AES_CCM_FLAGS_OCTET] = flags;
+    memcpy(&p_block[NRF_802154_AES_CCM_NONCE_OCTET],
+           m_aes_ccm_data.nonce,
+           NRF_802154_AES_CCM_NONCE_SIZE);
+    p_block[NRF_802154_AES_CCM_BLOCK_SIZE - 2] = (uint8_t)(counter >> 8);
+    p_block[NRF_802154_AES_CCM_BLOCK_SIZE - 1] = (uint8_t)counter;
+}
+
+/**
+ * @brief Feeds @p len bytes of data into the CBC-MAC, padding the last block with zeros.
+ *
+ * @param[inout] p_x     Current CBC-MAC value, Annex B4.1.2 d)
+ * @param[inout] p_fill  Number of bytes already absorbed into the current block of @p p_x
+ * @param[in]    p_data  Data to authenticate
+ * @param[in]    len     Length of @p p_data
+ */
+static void cbc_mac_update(uint8_t       * p_x,
+                           uint8_t       * p_fill,
+                           const uint8_t * p_data,
+                           size_t          len)
+{
+    while (len > 0)
+    {
+        uint8_t chunk = MIN(len, (size_t)(NRF_802154_AES_CCM_BLOCK_SIZE - *p_fill));
+
+        block_xor(&p_x[*p_fill], p_data, chunk);
+
+        *p_fill += chunk;
+        p_data  += chunk;
+        len     -= chunk;
+
+        if (*p_fill == NRF_802154_AES_CCM_BLOCK_SIZE)
+        {
+            nrf_802154_aes_sw_block_encrypt(&m_aes_ctx, p_x, p_x);
+            *p_fill = 0;
+        }
+    }
+}
+
+/**
+ * @brief Finishes the current CBC-MAC block, which is implicitly padded with zeros.
+ */
+static void cbc_mac_pad(uint8_t * p_x, uint8_t * p_fill)
+{
+    if (*p_fill != 0)
+    {
+        nrf_802154_aes_sw_block_encrypt(&m_aes_ctx, p_x, p_x);
+        *p_fill = 0;
+    }
+}
+
+/**
+ * @brief   Computes the authentication tag T
+ * IEEE std 802.15.4-2015, B.4.1.2 Authentication transformation
+ *
+ * @param[in]  mic_size  Size of the MIC
+ * @param[out] p_tag     Pointer to memory for the tag
+ */
+static void auth_tag_calculate(uint8_t mic_size, uint8_t * p_tag)
+{
+    uint8_t x[NRF_802154_AES_CCM_BLOCK_SIZE];
+    uint8_t fill       = 0;
+    uint8_t auth_flags = NRF_802154_AES_CCM_L_VALUE - 1;
+
+    auth_flags |= (m_aes_ccm_data.auth_data_len == 0) ? 0 : NRF_802154_AES_CCM_ADATA_AUTH_FLAG;
+    auth_flags |= ((mic_size - 2) >> 1) << NRF_802154_AES_CCM_M_BITS_AUTH_FLAG;
+
+    block_format(auth_flags, m_aes_ccm_data.plain_text_data_len, x);
+    nrf_802154_aes_sw_block_encrypt(&m_aes_ctx, x, x);
+
+    if (m_aes_ccm_data.auth_data_len != 0)
+    {
+        uint8_t adata_len[NRF_802154_AES_CCM_ADATA_LEN_SIZE] =
+        {
+            (uint8_t)(m_aes_ccm_data.auth_data_len >> 8),
+            (uint8_t)m_aes_ccm_data.auth_data_len,
+        };
+
+        cbc_mac_update(x, &fill, adata_len, sizeof(adata_len));
+        cbc_mac_update(x, &fill, m_aes_ccm_data.auth_data, (size_t)m_aes_ccm_data.auth_data_len);
+        cbc_mac_pad(x, &fill);
+    }
+
+    cbc_mac_update(x, &fill, m_aes_ccm_data.plain_text_data, m_aes_ccm_data.plain_text_data_len);
+    cbc_mac_pad(x, &fill);
+
+    memcpy(p_tag, x, mic_size);
+}
+
+/**
+ * @brief   Encrypts the plain text and the authentication tag
+ * IEEE std 802.15.4-2015, B.4.1.3 Encryption transformation
+ *
+ * @param[in]    mic_size  Size of the MIC
+ * @param[inout] p_tag     Pointer to the tag to be encrypted in place
+ */
+static void ctr_encrypt(uint8_t mic_size, uint8_t * p_tag)
+{
+    uint8_t a[NRF_802154_AES_CCM_BLOCK_SIZE];
+    uint8_t s[NRF_802154_AES_CCM_BLOCK_SIZE];
+    uint8_t enc_flags = NRF_802154_AES_CCM_L_VALUE - 1;
+    uint8_t offset    = 0;
+
+    for (uint16_t i = 1; offset < m_aes_ccm_data.plain_text_data_len; i++)
+    {
+        uint8_t len = MIN(m_aes_ccm_data.plain_text_data_len - offset,
+                          NRF_802154_AES_CCM_BLOCK_SIZE);
+
+        block_format(enc_flags, i, a);
+        nrf_802154_aes_sw_block_encrypt(&m_aes_ctx, a, s);
+
+        memcpy(mp_ciphertext + offset, m_aes_ccm_data.plain_text_data + offset, len);
+        block_xor(mp_ciphertext + offset, s, len);
+
+        offset += len;
+    }
+
+    if (mic_size != 0)
+    {
+        block_format(enc_flags, 0, a);
+        nrf_802154_aes_sw_block_encrypt(&m_aes_ctx, a, s);
+        block_xor(p_tag, s, mic_size);
+    }
+}
+
+void nrf_802154_aes_ccm_transform_reset(void)
+{
+    m_aes_ccm_data.raw_frame = NULL;
+}
+
+bool nrf_802154_aes_ccm_transform_prepare(const nrf_802154_aes_ccm_data_t * p_aes_ccm_data)
+{
+    // Verify that all necessary data is available
+    if (p_aes_ccm_data->raw_frame == NULL)
+    {
+        return false;
+    }
+
+    // Verify that the optional data, if exists, is complete
+    if (((p_aes_ccm_data->auth_data_len != 0) && (p_aes_ccm_data->auth_data == NULL)) ||
+        ((p_aes_ccm_data->plain_text_data_len != 0) && (p_aes_ccm_data->plain_text_data == NULL)))
+    {
+        return false;
+    }
+
+    // Verify that the MIC level is valid
+    if (p_aes_ccm_data->mic_level > SECURITY_LEVEL_MIC_LEVEL_MASK)
+    {
+        return false;
+    }
+
+    // Store the encryption data for future use
+    memcpy(&m_aes_ccm_data, p_aes_ccm_data, sizeof(nrf_802154_aes_ccm_data_t));
+
+    // Expand the key now to shorten the transformation itself, unless it is already expanded
+    if (p_aes_ccm_data->p_key_ctx != NULL)
+    {
+        m_aes_ctx = *p_aes_ccm_data->p_key_ctx;
+    }
+    else
+    {
+        nrf_802154_aes_sw_key_expand(&m_aes_ctx, m_aes_ccm_data.key);
+    }
+
+    ptrdiff_t offset = p_aes_ccm_data->raw_frame[PHR_OFFSET] + PHR_SIZE;
+
+    if (p_aes_ccm_data->plain_text_data)
+    {
+        offset = p_aes_ccm_data->plain_text_data - p_aes_ccm_data->raw_frame;
+    }
+
+    NRF_802154_ASSERT((offset >= 0) && (offset <= MAX_PACKET_SIZE + PHR_SIZE));
+
+    nrf_802154_tx_work_buffer_plain_text_offset_set(p_aes_ccm_data->raw_frame, offset);
+    mp_work_buffer = nrf_802154_tx_work_buffer_enable_for(p_aes_ccm_data->raw_frame);
+    mp_ciphertext  = mp_work_buffer + offset;
+
+    memcpy(mp_work_buffer, p_aes_ccm_data->raw_frame, offset);
+    memset(mp_ciphertext, 0, p_aes_ccm_data->raw_frame[PHR_OFFSET] + PHR_SIZE - offset);
+
+    return true;
+}
+
+void nrf_802154_aes_ccm_transform_start(uint8_t * p_frame)
+{
+    // Verify that the algorithm's inputs were prepared properly
+    if ((p_frame != m_aes_ccm_data.raw_frame) || (m_aes_ccm_data.raw_frame == NULL))
+    {
+        return;
+    }
+
+    uint8_t   mic_size = m_mic_size[m_aes_ccm_data.mic_level];
+    uint8_t   tag[MIC_128_SIZE];
+    ptrdiff_t offset = mp_ciphertext - mp_work_buffer;
+
+    // Copy updated part of the frame
+    memcpy(mp_work_buffer, p_frame, offset);
+
+    if (mic_size != 0)
+    {
+        auth_tag_calculate(mic_size, tag);
+    }
+
+    ctr_encrypt(mic_size, tag);
+
+    if (mic_size != 0)
+    {
+        memcpy(mp_work_buffer + (mp_work_buffer[PHR_OFFSET] - FCS_SIZE - mic_size + PHR_SIZE),
+               tag,
+               mic_size);
+    }
+
+    nrf_802154_tx_work_buffer_is_secured_set(p_frame);
+    m_aes_ccm_data.raw_frame = NULL;
+}
+
+void nrf_802154_aes_ccm_transform_abort(uint8_t * p_frame)
+{
+    // Verify that the encryption of the correct frame is being aborted.
+    if (p_frame != m_aes_ccm_data.raw_frame)
+    {
+        return;
+    }
+
+    m_aes_ccm_data.raw_frame = NULL;
+}
+
+#endif // NRF_802154_ENCRYPTION_ENABLED && NRF_802154_ENCRYPTION_ACCELERATOR_SW
@@ -0,0 +1,302 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file implements the AES-128 forward cipher in software.
+ *
+ * The portable variant uses a single 1 KB T-table with rotations, which keeps the flash footprint
+ * small while still replacing the per-round SubBytes, ShiftRows and MixColumns steps with table
+ * lookups. Hosts built with AES-NI support use the dedicated instructions instead.
+ */
+
+#if defined(__AES__) && (defined(__x86_64__) || defined(__i386__))
+// The intrinsics must precede the nrfx headers, as the CMSIS core headers define __I as a macro
+#include <wmmintrin.h>
+#endif
+
+#include "nrf_802154_config.h"
+
+#if NRF_802154_ENCRYPTION_ENABLED && NRF_802154_ENCRYPTION_ACCELERATOR_SW
+
+#include "nrf_802154_aes_sw.h"
+
+#include <stdint.h>
+
+#if defined(__AES__) && (defined(__x86_64__) || defined(__i386__))
+#define AES_SW_USE_AESNI 1
+#else
+#define AES_SW_USE_AESNI 0
+#endif
+
+#if AES_SW_USE_AESNI
+
+/**
+ * @brief Derives the next AES-128 round key from the previous one.
+ *
+ * @param[in]  key     Previous round key.
+ * @param[in]  assist  Result of the key generation assist instruction for @p key.
+ *
+ * @return Next round key.
+ */
+static inline __m128i aesni_key_expand_step(__m128i key, __m128i assist)
+{
+    assist = _mm_shuffle_epi32(assist, _MM_SHUFFLE(3, 3, 3, 3));
+    key    = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key    = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+    key    = _mm_xor_si128(key, _mm_slli_si128(key, 4));
+
+    return _mm_xor_si128(key, assist);
+}
+
+// The round constant must be an immediate operand of the key generation assist instruction
+#define AESNI_KEY_EXPAND(key, rcon) aesni_key_expand_step((key), _mm_aeskeygenassist_si128((key), (rcon)))
+
+void nrf_802154_aes_sw_key_expand(nrf_802154_aes_sw_ctx_t * p_ctx,
+                                  const uint8_t           * p_key)
+{
+    __m128i * p_rk = (__m128i *)p_ctx->round_keys;
+    __m128i   key  = _mm_loadu_si128((const __m128i *)p_key);
+
+    _mm_storeu_si128(&p_rk[0], key);
+    key = AESNI_KEY_EXPAND(key, 0x01);
+    _mm_storeu_si128(&p_rk[1], key);
+    key = AESNI_KEY_EXPAND(key, 0x02);
+    _mm_storeu_si128(&p_rk[2], key);
+    key = AESNI_KEY_EXPAND(key, 0x04);
+    _mm_storeu_si128(&p_rk[3], key);
+    key = AESNI_KEY_EXPAND(key, 0x08);
+    _mm_storeu_si128(&p_rk[4], key);
+    key = AESNI_KEY_EXPAND(key, 0x10);
+    _mm_storeu_si128(&p_rk[5], key);
+    key = AESNI_KEY_EXPAND(key, 0x20);
+    _mm_storeu_si128(&p_rk[6], key);
+    key = AESNI_KEY_EXPAND(key, 0x40);
+    _mm_storeu_si128(&p_rk[7], key);
+    key = AESNI_KEY_EXPAND(key, 0x80);
+    _mm_storeu_si128(&p_rk[8], key);
+    key = AESNI_KEY_EXPAND(key, 0x1B);
+    _mm_storeu_si128(&p_rk[9], key);
+    key = AESNI_KEY_EXPAND(key, 0x36);
+    _mm_storeu_si128(&p_rk[10], key);
+}
+
+void nrf_802154_aes_sw_block_encrypt(const nrf_802154_aes_sw_ctx_t * p_ctx,
+                                     const uint8_t                 * p_in,
+                                     uint8_t                       * p_out)
+{
+    const __m128i * p_rk  = (const __m128i *)p_ctx->round_keys;
+    __m128i         state = _mm_loadu_si128((const __m128i *)p_in);
+
+    state = _mm_xor_si128(state, _mm_loadu_si128(&p_rk[0]));
+
+    for (uint8_t round = 1; round < NRF_802154_AES_SW_ROUNDS; round++)
+    {
+        state = _mm_aesenc_si128(state, _mm_loadu_si128(&p_rk[round]));
+    }
+
+    state = _mm_aesenclast_si128(state, _mm_loadu_si128(&p_rk[NRF_802154_AES_SW_ROUNDS]));
+
+    _mm_storeu_si128((__m128i *)p_out, state);
+}
+
+#else // AES_SW_USE_AESNI
+
+static const uint8_t m_sbox[256] =
+{
+    0x63, 0x7C, 0x77, 0x7B, 0xF2, 0x6B, 0x6F, 0xC5, 0x30, 0x01, 0x67, 0x2B, 0xFE, 0xD7, 0xAB, 0x76,
+    0xCA, 0x82, 0xC9, 0x7D, 0xFA, 0x59, 0x47, 0xF0, 0xAD, 0xD4, 0xA2, 0xAF, 0x9C, 0xA4, 0x72, 0xC0,
+    0xB7, 0xFD, 0x93, 0x26, 0x36, 0x3F, 0xF7, 0xCC, 0x34, 0xA5, 0xE5, 0xF1, 0x71, 0xD8, 0x31, 0x15,
+    0x04, 0xC7, 0x23, 0xC3, 0x18, 0x96, 0x05, 0x9A, 0x07, 0x12, 0x80, 0xE2, 0xEB, 0x27, 0xB2, 0x75,
+    0x09, 0x83, 0x2C, 0x1A, 0x1B, 0x6E, 0x5A, 0xA0, 0x52, 0x3B, 0xD6, 0xB3, 0x29, 0xE3, 0x2F, 0x84,
+    0x53, 0xD1, 0x00, 0xED, 0x20, 0xFC, 0xB1, 0x5B, 0x6A, 0xCB, 0xBE, 0x39, 0x4A, 0x4C, 0x58, 0xCF,
+    0xD0, 0xEF, 0xAA, 0xFB, 0x43, 0x4D, 0x33, 0x85, 0x45, 0xF9, 0x02, 0x7F, 0x50, 0x3C, 0x9F, 0xA8,
+    0x51, 0xA3, 0x40, 0x8F, 0x92, 0x9D, 0x38, 0xF5, 0xBC, 0xB6, 0xDA, 0x21, 0x10, 0xFF, 0xF3, 0xD2,
+    0xCD, 0x0C, 0x13, 0xEC, 0x5F, 0x97, 0x44, 0x17, 0xC4, 0xA7, 0x7E, 0x3D, 0x64, 0x5D, 0x19, 0x73,
+    0x60, 0x81, 0x4F, 0xDC, 0x22, 0x2A, 0x90, 0x88, 0x46, 0xEE, 0xB8, 0x14, 0xDE, 0x5E, 0x0B, 0xDB,
+    0xE0, 0x32, 0x3A, 0x0A, 0x49, 0x06, 0x24, 0x5C, 0xC2, 0xD3, 0xAC, 0x62, 0x91, 0x95, 0xE4, 0x79,
+    0xE7, 0xC8, 0x37, 0x6D, 0x8D, 0xD5, 0x4E, 0xA9, 0x6C, 0x56, 0xF4, 0xEA, 0x65, 0x7A, 0xAE, 0x08,
+    0xBA, 0x78, 0x25, 0x2E, 0x1C, 0xA6, 0xB4, 0xC6, 0xE8, 0xDD, 0x74, 0x1F, 0x4B, 0xBD, 0x8B, 0x8A,
+    0x70, 0x3E, 0xB5, 0x66, 0x48, 0x03, 0xF6, 0x0E, 0x61, 0x35, 0x57, 0xB9, 0x86, 0xC1, 0x1D, 0x9E,
+    0xE1, 0xF8, 0x98, 0x11, 0x69, 0xD9, 0x8E, 0x94, 0x9B, 0x1E, 0x87, 0xE9, 0xCE, 0x55, 0x28, 0xDF,
+    0x8C, 0xA1, 0x89, 0x0D, 0xBF, 0xE6, 0x42, 0x68, 0x41, 0x99, 0x2D, 0x0F, 0xB0, 0x54, 0xBB, 0x16,
+};
+
+static const uint32_t m_te0[256] =
+{
+    0xC66363A5U, 0xF87C7C84U, 0xEE777799U, 0xF67B7B8DU, 0xFFF2F20DU, 0xD66B6BBDU,
+    0xDE6F6FB1U, 0x91C5C554U, 0x60303050U, 0x02010103U, 0xCE6767A9U, 0x562B2B7DU,
+    0xE7FEFE19U, 0xB5D7D762U, 0x4DABABE6U, 0xEC76769AU, 0x8FCACA45U, 0x1F82829DU,
+    0x89C9C940U, 0xFA7D7D87U, 0xEFFAFA15U, 0xB25959EBU, 0x8E4747C9U, 0xFBF0F00BU,
+    0x41ADADECU, 0xB3D4D467U, 0x5FA2A2FDU, 0x45AFAFEAU, 0x239C9CBFU, 0x53A4A4F7U,
+    0xE4727296U, 0x9BC0C05BU, 0x75B7B7C2U, 0xE1FDFD1CU, 0x3D9393AEU, 0x4C26266AU,
+    0x6C36365AU, 0x7E3F3F41U, 0xF5F7F702U, 0x83CCCC4FU, 0x6834345CU, 0x51A5A5F4U,
+    0xD1E5E534U, 0xF9F1F108U, 0xE2717193U, 0xABD8D873U, 0x62313153U, 0x2A15153FU,
+    0x0804040CU, 0x95C7C752U, 0x46232365U, 0x9DC3C35EU, 0x30181828U, 0x379696A1U,
+    0x0A05050FU, 0x2F9A9AB5U, 0x0E070709U, 0x24121236U, 0x1B80809BU, 0xDFE2E23DU,
+    0xCDEBEB26U, 0x4E272769U, 0x7FB2B2CDU, 0xEA75759FU, 0x1209091BU, 0x1D83839EU,
+    0x582C2C74U, 0x341A1A2EU, 0x361B1B2DU, 0xDC6E6EB2U, 0xB45A5AEEU, 0x5BA0A0FBU,
+    0xA45252F6U, 0x763B3B4DU, 0xB7D6D661U, 0x7DB3B3CEU, 0x5229297BU, 0xDDE3E33EU,
+    0x5E2F2F71U, 0x13848497U, 0xA65353F5U, 0xB9D1D168U, 0x00000000U, 0xC1EDED2CU,
+    0x40202060U, 0xE3FCFC1FU, 0x79B1B1C8U, 0xB65B5BEDU, 0xD46A6ABEU, 0x8DCBCB46U,
+    0x67BEBED9U, 0x7239394BU, 0x944A4ADEU, 0x984C4CD4U, 0xB05858E8U, 0x85CFCF4AU,
+    0xBBD0D06BU, 0xC5EFEF2AU, 0x4FAAAAE5U, 0xEDFBFB16U, 0x864343C5U, 0x9A4D4DD7U,
+    0x66333355U, 0x11858594U, 0x8A4545CFU, 0xE9F9F910U, 0x04020206U, 0xFE7F7F81U,
+    0xA05050F0U, 0x783C3C44U, 0x259F9FBAU, 0x4BA8A8E3U, 0xA25151F3U, 0x5DA3A3FEU,
+    0x804040C0U, 0x058F8F8AU, 0x3F9292ADU, 0x219D9DBCU, 0x70383848U, 0xF1F5F504U,
+    0x63BCBCDFU, 0x77B6B6C1U, 0xAFDADA75U, 0x42212163U, 0x20101030U, 0xE5FFFF1AU,
+    0xFDF3F30EU, 0xBFD2D26DU, 0x81CDCD4CU, 0x180C0C14U, 0x26131335U, 0xC3ECEC2FU,
+    0xBE5F5FE1U, 0x359797A2U, 0x884444CCU, 0x2E171739U, 0x93C4C457U, 0x55A7A7F2U,
+    0xFC7E7E82U, 0x7A3D3D47U, 0xC86464ACU, 0xBA5D5DE7U, 0x3219192BU, 0xE6737395U,
+    0xC06060A0U, 0x19818198U, 0x9E4F4FD1U, 0xA3DCDC7FU, 0x44222266U, 0x542A2A7EU,
+    0x3B9090ABU, 0x0B888883U, 0x8C4646CAU, 0xC7EEEE29U, 0x6BB8B8D3U, 0x2814143CU,
+    0xA7DEDE79U, 0xBC5E5EE2U, 0x160B0B1DU, 0xADDBDB76U, 0xDBE0E03BU, 0x64323256U,
+    0x743A3A4EU, 0x140A0A1EU, 0x924949DBU, 0x0C06060AU, 0x4824246CU, 0xB85C5CE4U,
+    0x9FC2C25DU, 0xBDD3D36EU, 0x43ACACEFU, 0xC46262A6U, 0x399191A8U, 0x319595A4U,
+    0xD3E4E437U, 0xF279798BU, 0xD5E7E732U, 0x8BC8C843U, 0x6E373759U, 0xDA6D6DB7U,
+    0x018D8D8CU, 0xB1D5D564U, 0x9C4E4ED2U, 0x49A9A9E0U, 0xD86C6CB4U, 0xAC5656FAU,
+    0xF3F4F407U, 0xCFEAEA25U, 0xCA6565AFU, 0xF47A7A8EU, 0x47AEAEE9U, 0x10080818U,
+    0x6FBABAD5U, 0xF0787888U, 0x4A25256FU, 0x5C2E2E72U, 0x381C1C24U, 0x57A6A6F1U,
+    0x73B4B4C7U, 0x97C6C651U, 0xCBE8E823U, 0xA1DDDD7CU, 0xE874749CU, 0x3E1F1F21U,
+    0x964B4BDDU, 0x61BDBDDCU, 0x0D8B8B86U, 0x0F8A8A85U, 0xE0707090U, 0x7C3E3E42U,
+    0x71B5B5C4U, 0xCC6666AAU, 0x904848D8U, 0x06030305U, 0xF7F6F601U, 0x1C0E0E12U,
+    0xC26161A3U, 0x6A35355FU, 0xAE5757F9U, 0x69B9B9D0U, 0x17868691U, 0x99C1C158U,
+    0x3A1D1D27U, 0x279E9EB9U, 0xD9E1E138U, 0xEBF8F813U, 0x2B9898B3U, 0x22111133U,
+    0xD26969BBU, 0xA9D9D970U, 0x078E8E89U, 0x339494A7U, 0x2D9B9BB6U, 0x3C1E1E22U,
+    0x15878792U, 0xC9E9E920U, 0x87CECE49U, 0xAA5555FFU, 0x50282878U, 0xA5DFDF7AU,
+    0x038C8C8FU, 0x59A1A1F8U, 0x09898980U, 0x1A0D0D17U, 0x65BFBFDAU, 0xD7E6E631U,
+    0x844242C6U, 0xD06868B8U, 0x824141C3U, 0x299999B0U, 0x5A2D2D77U, 0x1E0F0F11U,
+    0x7BB0B0CBU, 0xA85454FCU, 0x6DBBBBD6U, 0x2C16163AU,
+};
+
+static const uint8_t m_rcon[NRF_802154_AES_SW_ROUNDS] =
+{
+    0x01, 0x02, 0x04, 0x08, 0x10, 0x20, 0x40, 0x80, 0x1B, 0x36,
+};
+
+#define ROR32(x, n) (((x) >> (n)) | ((x) << (32 - (n))))
+
+#define TE0(x)      (m_te0[(x) & 0xFF])             ///< Combined SubBytes and MixColumns for row 0.
+#define TE1(x)      ROR32(m_te0[(x) & 0xFF], 8)     ///< Combined SubBytes and MixColumns for row 1.
+#define TE2(x)      ROR32(m_te0[(x) & 0xFF], 16)    ///< Combined SubBytes and MixColumns for row 2.
+#define TE3(x)      ROR32(m_te0[(x) & 0xFF], 24)    ///< Combined SubBytes and MixColumns for row 3.
+#define SBOX(x, n)  ((uint32_t)m_sbox[(x) & 0xFF] << (n))
+
+static inline uint32_t big_32_to_host(const uint8_t * p_buffer)
+{
+    return ((uint32_t)p_buffer[0] << 24) |
+           ((uint32_t)p_buffer[1] << 16) |
+           ((uint32_t)p_buffer[2] << 8) |
+           ((uint32_t)p_buffer[3]);
+}
+
+static inline void host_32_to_big(uint32_t value, uint8_t * p_buffer)
+{
+    p_buffer[0] = (uint8_t)(value >> 24);
+    p_buffer[1] = (uint8_t)(value >> 16);
+    p_buffer[2] = (uint8_t)(value >> 8);
+    p_buffer[3] = (uint8_t)(value);
+}
+
+void nrf_802154_aes_sw_key_expand(nrf_802154_aes_sw_ctx_t * p_ctx,
+                                  const uint8_t           * p_key)
+{
+    uint32_t * p_rk = p_ctx->round_keys;
+
+    for (uint8_t i = 0; i < 4; i++)
+    {
+        p_rk[i] = big_32_to_host(&p_key[4 * i]);
+    }
+
+    for (uint8_t i = 4; i < 4 * (NRF_802154_AES_SW_ROUNDS + 1); i++)
+    {
+        uint32_t temp = p_rk[i - 1];
+
+        if ((i % 4) == 0)
+        {
+            // RotWord followed by SubWord and the round constant
+            temp = SBOX(temp >> 16, 24) ^ SBOX(temp >> 8, 16) ^ SBOX(temp, 8) ^ SBOX(temp >> 24, 0) ^
+                   ((uint32_t)m_rcon[(i / 4) - 1] << 24);
+        }
+
+        p_rk[i] = p_rk[i - 4] ^ temp;
+    }
+}
+
+void nrf_802154_aes_sw_block_encrypt(const nrf_802154_aes_sw_ctx_t * p_ctx,
+                                     const uint8_t                 * p_in,
+                                     uint8_t                       * p_out)
+{
+    const uint32_t * p_rk = p_ctx->round_keys;
+    uint32_t         s0   = big_32_to_host(&p_in[0]) ^ p_rk[0];
+    uint32_t         s1   = big_32_to_host(&p_in[4]) ^ p_rk[1];
+    uint32_t         s2   = big_32_to_host(&p_in[8]) ^ p_rk[2];
+    uint32_t         s3   = big_32_to_host(&p_in[12]) ^ p_rk[3];
+    uint32_t         t0;
+    uint32_t         t1;
+    uint32_t         t2;
+    uint32_t         t3;
+
+    for (uint8_t round = 1; round < NRF_802154_AES_SW_ROUNDS; round++)
+    {
+        p_rk += 4;
+
+        t0 = TE0(s0 >> 24) ^ TE1(s1 >> 16) ^ TE2(s2 >> 8) ^ TE3(s3) ^ p_rk[0];
+        t1 = TE0(s1 >> 24) ^ TE1(s2 >> 16) ^ TE2(s3 >> 8) ^ TE3(s0) ^ p_rk[1];
+        t2 = TE0(s2 >> 24) ^ TE1(s3 >> 16) ^ TE2(s0 >> 8) ^ TE3(s1) ^ p_rk[2];
+        t3 = TE0(s3 >> 24) ^ TE1(s0 >> 16) ^ TE2(s1 >> 8) ^ TE3(s2) ^ p_rk[3];
+
+        s0 = t0;
+        s1 = t1;
+        s2 = t2;
+        s3 = t3;
+    }
+
+    p_rk += 4;
+
+    // The last round omits MixColumns
+    t0 = SBOX(s0 >> 24, 24) ^ SBOX(s1 >> 16, 16) ^ SBOX(s2 >> 8, 8) ^ SBOX(s3, 0) ^ p_rk[0];
+    t1 = SBOX(s1 >> 24, 24) ^ SBOX(s2 >> 16, 16) ^ SBOX(s3 >> 8, 8) ^ SBOX(s0, 0) ^ p_rk[1];
+    t2 = SBOX(s2 >> 24, 24) ^ SBOX(s3 >> 16, 16) ^ SBOX(s0 >> 8, 8) ^ SBOX(s1, 0) ^ p_rk[2];
+    t3 = SBOX(s3 >> 24, 24) ^ SBOX(s0 >> 16, 16) ^ SBOX(s1 >> 8, 8) ^ SBOX(s2, 0) ^ p_rk[3];
+
+    host_32_to_big(t0, &p_out[0]);
+    host_32_to_big(t1, &p_out[4]);
+    host_32_to_big(t2, &p_out[8]);
+    host_32_to_big(t3, &p_out[12]);
+}
+
+#endif // AES_SW_USE_AESNI
+
+#endif // NRF_802154_ENCRYPTION_ENABLED && NRF_802154_ENCRYPTION_ACCELERATOR_SW
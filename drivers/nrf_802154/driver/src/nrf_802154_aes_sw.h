@@ -0,0 +1,90 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#ifndef NRF_802154_AES_SW_H_
+#define NRF_802154_AES_SW_H_
+
+#include <stdint.h>
+
+#include "nrf_802154_const.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Software implementation of the AES-128 forward cipher used by the AES-CCM* module.
+ *
+ * Only the forward cipher is provided, as CCM* uses AES solely in the encrypt direction.
+ * The portable variant is table-driven. On x86 hosts built with AES-NI support (__AES__),
+ * the AES-NI instructions are used instead.
+ */
+
+#define NRF_802154_AES_SW_BLOCK_SIZE 16 ///< Size of the AES block in bytes.
+#define NRF_802154_AES_SW_ROUNDS     10 ///< Number of AES-128 rounds.
+
+/**
+ * @brief Expanded AES-128 key.
+ */
+typedef struct
+{
+    uint32_t round_keys[4 * (NRF_802154_AES_SW_ROUNDS + 1)]; ///< Round keys in a layout specific to the cipher variant.
+} nrf_802154_aes_sw_ctx_t;
+
+/**
+ * @brief Expands an AES-128 key into round keys.
+ *
+ * @param[out] p_ctx  Context to store the round keys in.
+ * @param[in]  p_key  Pointer to the 16-byte key.
+ */
+void nrf_802154_aes_sw_key_expand(nrf_802154_aes_sw_ctx_t * p_ctx,
+                                  const uint8_t           * p_key);
+
+/**
+ * @brief Encrypts a single block.
+ *
+ * @p p_in and @p p_out may point to the same buffer.
+ *
+ * @param[in]  p_ctx  Context with the expanded key.
+ * @param[in]  p_in   Pointer to the 16-byte plain text block.
+ * @param[out] p_out  Pointer to the 16-byte cipher text block.
+ */
+void nrf_802154_aes_sw_block_encrypt(const nrf_802154_aes_sw_ctx_t * p_ctx,
+                                     const uint8_t                 * p_in,
+                                     uint8_t                       * p_out);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_802154_AES_SW_H_
@@ -43,6 +43,8 @@
 
 #include "nrf_802154_co.h"
 #include "nrf_802154_debug.h"
+#include "mac_features/nrf_802154_retransmission.h"
+#include "mac_features/nrf_802154_tx_queue.h"
 
 void nrf_802154_co_cca_done(bool channel_free)
 {
@@ -120,6 +122,22 @@ void nrf_802154_co_transmitted_raw(uint8_t                                   * p
                                    const nrf_802154_transmit_done_metadata_t * p_metadata)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+#if NRF_802154_RETRANSMISSION_ENABLED
+    nrf_802154_transmit_done_metadata_t metadata = *p_metadata;
+
+    nrf_802154_retransmission_transmitted_hook(p_frame, &metadata);
+    p_metadata = &metadata;
+#endif
+
+#if NRF_802154_TX_QUEUE_ENABLED
+    if (nrf_802154_tx_queue_transmitted_hook(p_frame, p_metadata))
+    {
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return;
+    }
+#endif
+
     nrf_802154_transmitted_raw(p_frame, p_metadata);
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
@@ -143,6 +161,27 @@ void nrf_802154_co_transmit_failed(uint8_t                                   * p
                                    const nrf_802154_transmit_done_metadata_t * p_metadata)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+#if NRF_802154_RETRANSMISSION_ENABLED
+    nrf_802154_transmit_done_metadata_t metadata = *p_metadata;
+
+    if (nrf_802154_retransmission_transmit_failed_hook(p_frame, error, &metadata))
+    {
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return;
+    }
+
+    p_metadata = &metadata;
+#endif
+
+#if NRF_802154_TX_QUEUE_ENABLED
+    if (nrf_802154_tx_queue_transmit_failed_hook(p_frame, error, p_metadata))
+    {
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return;
+    }
+#endif
+
     nrf_802154_transmit_failed(p_frame, error, p_metadata);
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
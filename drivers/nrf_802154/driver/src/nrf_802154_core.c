@@ -69,8 +69,11 @@
 #include "nrf_802154_utils.h"
 #include "drivers/nrfx_errors.h"
 #include "hal/nrf_radio.h"
+#include "mac_features/nrf_802154_ed_sweep.h"
 #include "mac_features/nrf_802154_filter.h"
+#include "mac_features/nrf_802154_filter_rules.h"
 #include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/nrf_802154_neighbor_table.h"
 #include "mac_features/ack_generator/nrf_802154_ack_generator.h"
 #include "rsch/nrf_802154_rsch.h"
 #include "rsch/nrf_802154_rsch_crit_sect.h"
@@ -80,6 +83,7 @@
 
 #include "nrf_802154_core_hooks.h"
 #include "nrf_802154_sl_ant_div.h"
+#include "nrf_802154_sl_coex.h"
 
 #if defined(CONFIG_SOC_SERIES_BSIM_NRFXX)
 #include "nrf_802154_bsim_utils.h"
@@ -93,6 +97,9 @@
 #define ED_ITER_DURATION            128U
 /// Overhead of hardware preparation for ED procedure (aTurnaroundTime) [number of iterations]
 #define ED_ITERS_OVERHEAD           2U
+/// Number of iterations of Energy Detection procedure in a single sample of energy detection sweep
+#define ED_SWEEP_SAMPLE_ITERS       ((NRF_802154_ED_SWEEP_SAMPLE_TIME_US < ED_ITER_DURATION) ? 1U : \
+                                     (NRF_802154_ED_SWEEP_SAMPLE_TIME_US / ED_ITER_DURATION))
 
 #define MAX_CRIT_SECT_TIME          60   ///< Maximal time that the driver spends in single critical section.
 
@@ -130,6 +137,7 @@ static int8_t                          m_last_rssi;             ///< RSSI of the
 static uint8_t                         m_no_rx_buffer_notified; ///< Set when NRF_802154_RX_ERROR_NO_BUFFER has been notified.
 
 static nrf_802154_frame_parser_data_t m_current_rx_frame_data;  ///< RX frame parser data.
+static nrf_802154_frame_parser_data_t m_last_rx_frame_data;     ///< Parser data of the last received non-ACK frame.
 
 static volatile radio_state_t m_state;                          ///< State of the radio driver.
 
@@ -140,6 +148,7 @@ typedef struct
     bool rx_timeslot_requested : 1; ///< If timeslot for the frame being received is already requested.
     bool tx_with_cca           : 1; ///< If currently transmitted frame is transmitted with cca.
     bool tx_diminished_prio    : 1; ///< If priority of the current transmission should be diminished.
+    bool ed_sweep              : 1; ///< If the current energy detection procedure is a sweep over channels.
 
 #if defined(CONFIG_SOC_SERIES_BSIM_NRFXX)
     bool tx_started_notify     : 1; ///< If higher layer should be notified that transmission started.
@@ -180,6 +189,51 @@ static void request_preconditions_for_state(radio_state_t state)
     nrf_802154_rsch_crit_sect_prio_request(min_required_rsch_prio(state));
 }
 
+#if NRF_802154_COEX_OPERATION_NOTIFY_ENABLED
+
+/** Notify the coexistence module of the radio operation performed in the given state.
+ *
+ * @param[in]  state  Driver state to be set.
+ */
+static void coex_operation_notify(radio_state_t state)
+{
+    nrf_802154_sl_coex_op_t op;
+
+    switch (state)
+    {
+        case RADIO_STATE_RX:
+            op = NRF_802154_SL_COEX_OP_RX;
+            break;
+
+        case RADIO_STATE_TX_ACK:
+            op = NRF_802154_SL_COEX_OP_ACK;
+            break;
+
+        case RADIO_STATE_ED:
+        case RADIO_STATE_CCA:
+            op = NRF_802154_SL_COEX_OP_CCA;
+            break;
+
+        case RADIO_STATE_TX:
+        case RADIO_STATE_CCA_TX:
+        case RADIO_STATE_RX_ACK:
+#if NRF_802154_CARRIER_FUNCTIONS_ENABLED
+        case RADIO_STATE_CONTINUOUS_CARRIER:
+        case RADIO_STATE_MODULATED_CARRIER:
+#endif // NRF_802154_CARRIER_FUNCTIONS_ENABLED
+            op = NRF_802154_SL_COEX_OP_TX;
+            break;
+
+        default:
+            op = NRF_802154_SL_COEX_OP_NONE;
+            break;
+    }
+
+    nrf_802154_sl_coex_operation_set(op);
+}
+
+#endif // NRF_802154_COEX_OPERATION_NOTIFY_ENABLED
+
 /** Set driver state.
  *
  * @param[in]  state  Driver state to set.
@@ -192,6 +246,10 @@ static void state_set(radio_state_t state)
                                NRF_802154_LOG_LOCAL_EVENT_ID_CORE__SET_STATE,
                                (uint32_t)state);
 
+#if NRF_802154_COEX_OPERATION_NOTIFY_ENABLED
+    coex_operation_notify(state);
+#endif
+
     request_preconditions_for_state(state);
 }
 
@@ -223,6 +281,30 @@ static void rx_flags_clear(void)
     m_flags.frame_filtered        = false;
     m_flags.rx_timeslot_requested = false;
     m_flags.frame_parsed          = false;
+
+#if NRF_802154_FILTER_RULES_ENABLED
+    nrf_802154_filter_rules_frame_reset();
+#endif
+}
+
+/**
+ * @brief Checks if the receive filter rules drop the frame being received.
+ *
+ * @param[in]  frame_complete  If the whole frame has been received.
+ *
+ * @retval  true   The frame is to be dropped.
+ * @retval  false  The frame is to be received or the rules need more of the frame.
+ */
+static bool rx_filter_rules_drop(bool frame_complete)
+{
+#if NRF_802154_FILTER_RULES_ENABLED
+    return nrf_802154_filter_rules_evaluate(&m_current_rx_frame_data, frame_complete) ==
+           NRF_802154_FILTER_RULES_VERDICT_DROP;
+#else
+    (void)frame_complete;
+
+    return false;
+#endif
 }
 
 /** Wait for the RSSI measurement. */
@@ -302,8 +384,42 @@ static uint64_t timer_coord_timestamp_get(void)
 
 #endif
 
+#if (NRF_802154_STATS_HISTOGRAMS_ENABLED || NRF_802154_NEIGHBOR_TABLE_ENABLED || \
+    NRF_802154_ANT_DIV_PEER_ANTENNA_ENABLED)
+
+/** Record RSSI and LQI of the last received frame in the statistics and neighbor table entry
+ *  of its source address, and pass the address to the antenna diversity module.
+ *
+ *  The parser data latched when the frame was received is used, as the RX frame parser data
+ *  may already describe the next frame. */
+static void received_frame_source_record(void)
+{
+#if (NRF_802154_STATS_HISTOGRAMS_ENABLED)
+    nrf_802154_stat_rx_source_record(nrf_802154_frame_parser_src_addr_get(&m_last_rx_frame_data),
+                                     nrf_802154_frame_parser_src_addr_size_get(
+                                         &m_last_rx_frame_data),
+                                     m_last_rssi,
+                                     m_last_lqi);
+#endif
+#if (NRF_802154_NEIGHBOR_TABLE_ENABLED)
+    nrf_802154_neighbor_table_rx_record(&m_last_rx_frame_data, m_last_rssi, m_last_lqi);
+#endif
+#if (NRF_802154_ANT_DIV_PEER_ANTENNA_ENABLED)
+    nrf_802154_sl_ant_div_rx_frame_source_notify(
+        nrf_802154_frame_parser_src_addr_get(&m_last_rx_frame_data),
+        nrf_802154_frame_parser_src_addr_size_get(&m_last_rx_frame_data));
+#endif
+}
+
+#endif
+
 static void received_frame_notify(uint8_t * p_data)
 {
+#if (NRF_802154_STATS_HISTOGRAMS_ENABLED || NRF_802154_NEIGHBOR_TABLE_ENABLED || \
+    NRF_802154_ANT_DIV_PEER_ANTENNA_ENABLED)
+    received_frame_source_record();
+#endif
+
     nrf_802154_notify_received(p_data, m_last_rssi, m_last_lqi);
 }
 
@@ -344,6 +460,9 @@ static void transmit_started_notify(void)
 #endif
     {
         nrf_802154_tx_started(p_frame);
+
+        // Set up the next frame while this one is on air
+        nrf_802154_core_hooks_tx_next_prepare(p_frame);
     }
 
 }
@@ -549,6 +668,14 @@ static bool ed_iter_setup(uint32_t * p_requested_ed_time_us, uint32_t * p_next_t
 
         uint32_t requested_iters = *p_requested_ed_time_us / ED_ITER_DURATION;
 
+#if NRF_802154_ED_SWEEP_ENABLED
+        if (m_flags.ed_sweep && (iters_left_in_timeslot > ED_SWEEP_SAMPLE_ITERS))
+        {
+            /* Each iteration of energy detection sweep provides a single sample */
+            iters_left_in_timeslot = ED_SWEEP_SAMPLE_ITERS;
+        }
+#endif
+
         if (requested_iters < iters_left_in_timeslot)
         {
             /* We will finish all iterations before timeslot end, thus no time is left */
@@ -838,6 +965,18 @@ static bool current_operation_terminate(nrf_802154_term_t term_lvl,
             if (m_state == RADIO_STATE_ED)
             {
                 nrf_802154_sl_ant_div_energy_detection_aborted_notify();
+
+#if NRF_802154_ED_SWEEP_ENABLED
+                if (m_flags.ed_sweep)
+                {
+                    m_flags.ed_sweep = false;
+
+                    if (timeslot_is_granted())
+                    {
+                        nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
+                    }
+                }
+#endif
             }
 
             if (notify)
@@ -1041,6 +1180,31 @@ static void rx_init(nrf_802154_trx_ramp_up_trigger_mode_t ru_tr_mode, bool * p_a
     mp_ack = NULL;
 }
 
+#if NRF_802154_ANT_DIV_PEER_ANTENNA_ENABLED
+
+/** Pass the destination address of the frame to be transmitted to the antenna diversity module. */
+static void tx_destination_antenna_notify(const uint8_t * p_data)
+{
+    nrf_802154_frame_parser_data_t frame_data;
+    const uint8_t                * p_dst_addr    = NULL;
+    uint8_t                        dst_addr_size = 0U;
+
+    bool parse_result = nrf_802154_frame_parser_data_init(p_data,
+                                                          p_data[PHR_OFFSET] + PHR_SIZE,
+                                                          PARSE_LEVEL_ADDRESSING_END,
+                                                          &frame_data);
+
+    if (parse_result)
+    {
+        p_dst_addr    = nrf_802154_frame_parser_dst_addr_get(&frame_data);
+        dst_addr_size = nrf_802154_frame_parser_dst_addr_size_get(&frame_data);
+    }
+
+    nrf_802154_sl_ant_div_tx_frame_notify(p_dst_addr, dst_addr_size);
+}
+
+#endif
+
 /** Initialize TX operation. */
 static bool tx_init(const uint8_t                       * p_data,
                     nrf_802154_trx_ramp_up_trigger_mode_t rampup_trigg_mode,
@@ -1074,6 +1238,10 @@ static bool tx_init(const uint8_t                       * p_data,
     }
 #endif
 
+#if NRF_802154_ANT_DIV_PEER_ANTENNA_ENABLED
+    tx_destination_antenna_notify(p_data);
+#endif
+
     nrf_802154_trx_channel_set(m_tx_channel);
     m_flags.tx_with_cca = cca;
     nrf_802154_trx_transmit_frame(nrf_802154_tx_work_buffer_get(p_data),
@@ -1139,6 +1307,35 @@ static bool tx_init(const uint8_t                       * p_data,
     return true;
 }
 
+/** Start the energy detection of the radio.
+ *
+ * During an energy detection sweep the receiver stays enabled between the samples. It is only
+ * retuned when the sweep moves to the next channel.
+ */
+static void ed_trx_start(uint32_t trx_ed_count)
+{
+#if NRF_802154_ED_SWEEP_ENABLED
+    if (m_flags.ed_sweep)
+    {
+        nrf_802154_trx_energy_detection_sample(trx_ed_count);
+        return;
+    }
+#endif
+
+    nrf_802154_trx_energy_detection(trx_ed_count);
+}
+
+/** Disable the receiver kept enabled after a sample of an energy detection sweep. */
+static void ed_trx_stop(void)
+{
+#if NRF_802154_ED_SWEEP_ENABLED
+    if (m_flags.ed_sweep)
+    {
+        nrf_802154_trx_abort();
+    }
+#endif
+}
+
 /** Initialize ED operation */
 static void ed_init(void)
 {
@@ -1149,6 +1346,7 @@ static void ed_init(void)
 
     if (!are_preconditions_met())
     {
+        ed_trx_stop();
         return;
     }
 
@@ -1161,10 +1359,19 @@ static void ed_init(void)
     if (!ed_iter_setup(&m_ed_time_left, &trx_ed_count))
     {
         // Just wait for next timeslot if there is not enough time in this one.
+        ed_trx_stop();
         return;
     }
 
-    nrf_802154_trx_energy_detection(trx_ed_count);
+#if NRF_802154_ED_SWEEP_ENABLED
+    if (m_flags.ed_sweep)
+    {
+        // The channel is set to the PIB channel whenever the timeslot is granted.
+        nrf_802154_trx_channel_set(nrf_802154_ed_sweep_channel_get());
+    }
+#endif
+
+    ed_trx_start(trx_ed_count);
 }
 
 /** Initialize CCA operation. */
@@ -1791,7 +1998,7 @@ uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
 
     if (nrf_802154_frame_parser_frame_type_get(&m_current_rx_frame_data) == FRAME_TYPE_MULTIPURPOSE)
     {
-        m_flags.frame_filtered = true;
+        // The frame parser does not support Multipurpose frames. They are filtered when received.
         return 0;
     }
 
@@ -1833,15 +2040,20 @@ uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
         }
     }
 
-    if (filter_result != NRF_802154_RX_ERROR_NONE)
+    bool rules_drop = (filter_result == NRF_802154_RX_ERROR_NONE) && rx_filter_rules_drop(false);
+
+    if ((filter_result != NRF_802154_RX_ERROR_NONE) || rules_drop)
     {
+        uint8_t frame_type = nrf_802154_frame_parser_frame_type_get(&m_current_rx_frame_data);
+
         nrf_802154_trx_abort();
         rx_init(TRX_RAMP_UP_SW_TRIGGER, NULL);
 
         /* Release boosted preconditions */
         request_preconditions_for_state(m_state);
 
-        if (nrf_802154_frame_parser_frame_type_get(&m_current_rx_frame_data) != FRAME_TYPE_ACK)
+        // Frames dropped by the filter rules are only counted by the rules.
+        if (!rules_drop && (frame_type != FRAME_TYPE_ACK))
         {
             receive_failed_notify(filter_result);
         }
@@ -1906,6 +2118,7 @@ uint8_t nrf_802154_trx_receive_frame_bcmatched(uint8_t bcc)
         nrf_802154_frame_parser_ar_bit_is_set(&m_current_rx_frame_data) &&
         nrf_802154_pib_auto_ack_get())
     {
+        nrf_802154_core_hooks_tx_prepared_discard(NULL);
         mp_ack = nrf_802154_ack_generator_create(&m_current_rx_frame_data);
     }
 
@@ -1979,7 +2192,12 @@ void nrf_802154_trx_receive_frame_received(void)
         PHR_SIZE + nrf_802154_frame_parser_frame_length_get(&m_current_rx_frame_data),
         PARSE_LEVEL_FULL);
 
-    if (parse_result && !m_flags.frame_filtered)
+    m_last_rx_frame_data = m_current_rx_frame_data;
+
+    bool multipurpose = (nrf_802154_frame_parser_frame_type_get(&m_current_rx_frame_data) ==
+                         FRAME_TYPE_MULTIPURPOSE);
+
+    if ((parse_result || multipurpose) && !m_flags.frame_filtered)
     {
         filter_result = nrf_802154_filter_frame_part(&m_current_rx_frame_data,
                                                      NRF_802154_FILTER_MODE_ALL);
@@ -2003,7 +2221,15 @@ void nrf_802154_trx_receive_frame_received(void)
         }
     }
 
-    if (m_flags.frame_filtered || nrf_802154_pib_promiscuous_get())
+    bool frame_accepted = m_flags.frame_filtered || nrf_802154_pib_promiscuous_get();
+
+    if (frame_accepted && rx_filter_rules_drop(true))
+    {
+        // The frame is dropped by the filter rules. Receive to the same buffer.
+        request_preconditions_for_state(m_state);
+        rx_init(TRX_RAMP_UP_SW_TRIGGER, NULL);
+    }
+    else if (frame_accepted)
     {
         nrf_802154_stat_counter_increment(received_frames);
 
@@ -2022,7 +2248,8 @@ void nrf_802154_trx_receive_frame_received(void)
             nrf_802154_frame_parser_ar_bit_is_set(&m_current_rx_frame_data) &&
             nrf_802154_pib_auto_ack_get())
         {
-            nrf_802154_tx_work_buffer_reset(&m_default_frame_props);
+            nrf_802154_core_hooks_tx_prepared_discard(NULL);
+            nrf_802154_tx_work_buffer_reset(NULL, &m_default_frame_props);
             mp_ack   = nrf_802154_ack_generator_create(&m_current_rx_frame_data);
             send_ack = (mp_ack != NULL);
         }
@@ -2384,6 +2611,29 @@ void nrf_802154_trx_receive_ack_received(void)
         uint64_t ts = timer_coord_timestamp_get();
 
         nrf_802154_stat_timestamp_write(last_ack_end_timestamp, ts);
+
+#if (NRF_802154_STATS_HISTOGRAMS_ENABLED)
+        uint64_t tx_end_ts;
+
+        nrf_802154_stat_timestamp_read(&tx_end_ts, last_tx_end_timestamp);
+
+        if ((ts != NRF_802154_NO_TIMESTAMP) && (tx_end_ts != NRF_802154_NO_TIMESTAMP))
+        {
+            // ts holds the timestamp of the end of the Ack, so the start of the Ack is
+            // calculated from its duration.
+            uint64_t ack_start_ts = ts - nrf_802154_frame_duration_get(p_ack_data[PHR_OFFSET],
+                                                                       true,
+                                                                       true);
+
+            if (ack_start_ts >= tx_end_ts)
+            {
+                uint64_t turnaround = ack_start_ts - tx_end_ts;
+
+                nrf_802154_stat_ack_turnaround_record(
+                    (turnaround > UINT32_MAX) ? UINT32_MAX : (uint32_t)turnaround);
+            }
+        }
+#endif
 #endif
 
         rx_buffer_t * p_ack_buffer = mp_current_rx_buffer;
@@ -2413,6 +2663,16 @@ void nrf_802154_trx_receive_ack_received(void)
             }
         }
 
+#if NRF_802154_RETRANSMISSION_ENABLED
+        // Detect Frame Pending field set to one on Ack frame received after any frame, if enabled
+        if ((nrf_802154_pib_retransmission_config_get()->frame_pending ==
+             NRF_802154_RETRANSMISSION_FRAME_PENDING_ANY) &&
+            (p_ack_data[FRAME_PENDING_OFFSET] & FRAME_PENDING_BIT))
+        {
+            should_receive = true;
+        }
+#endif
+
         if (should_receive)
         {
             state_set(RADIO_STATE_RX);
@@ -2441,6 +2701,10 @@ void nrf_802154_trx_standalone_cca_finished(bool channel_was_idle)
 
     switch_to_idle();
 
+#if (NRF_802154_STATS_HISTOGRAMS_ENABLED)
+    nrf_802154_stat_cca_record(nrf_802154_pib_channel_get(), !channel_was_idle);
+#endif
+
     cca_notify(channel_was_idle);
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
@@ -2460,6 +2724,10 @@ void nrf_802154_trx_transmit_frame_ccaidle(void)
     NRF_802154_ASSERT(m_state == RADIO_STATE_CCA_TX);
     NRF_802154_ASSERT(m_trx_transmit_frame_notifications_mask & TRX_TRANSMIT_NOTIFICATION_CCAIDLE);
 
+#if (NRF_802154_STATS_HISTOGRAMS_ENABLED)
+    nrf_802154_stat_cca_record(m_tx_channel, false);
+#endif
+
 #if (NRF_802154_FRAME_TIMESTAMP_ENABLED)
     uint64_t ts = timer_coord_timestamp_get();
 
@@ -2485,6 +2753,10 @@ void nrf_802154_trx_transmit_frame_ccabusy(void)
 
     nrf_802154_stat_counter_increment(cca_failed_attempts);
 
+#if (NRF_802154_STATS_HISTOGRAMS_ENABLED)
+    nrf_802154_stat_cca_record(m_tx_channel, true);
+#endif
+
     switch_to_idle();
 
     nrf_802154_transmit_done_metadata_t metadata = {};
@@ -2505,26 +2777,42 @@ void nrf_802154_trx_energy_detection_finished(uint8_t ed_sample)
         m_ed_result = ed_sample;
     }
 
+#if NRF_802154_ED_SWEEP_ENABLED
+    if (m_flags.ed_sweep)
+    {
+        nrf_802154_ed_sweep_sample_add(nrf_802154_rssi_ed_sample_to_dbm_convert(ed_sample));
+    }
+#endif
+
     if (m_ed_time_left >= ED_ITER_DURATION)
     {
         uint32_t trx_ed_count = 0U;
 
         if (ed_iter_setup(&m_ed_time_left, &trx_ed_count))
         {
-            nrf_802154_trx_energy_detection(trx_ed_count);
+            ed_trx_start(trx_ed_count);
         }
         else
         {
             /* There is too little time in current timeslot, just wait for timeslot end.
              * Operation will be resumed in next timeslot */
+            ed_trx_stop();
         }
     }
     else if (nrf_802154_sl_ant_div_energy_detection_finished_notify())
     {
         ed_init();
     }
+#if NRF_802154_ED_SWEEP_ENABLED
+    else if (m_flags.ed_sweep && nrf_802154_ed_sweep_channel_next())
+    {
+        m_ed_time_left = nrf_802154_ed_sweep_dwell_get();
+        ed_init();
+    }
+#endif
     else
     {
+        ed_trx_stop();
         nrf_802154_trx_channel_set(nrf_802154_pib_channel_get());
 
         switch_to_idle();
@@ -2533,6 +2821,14 @@ void nrf_802154_trx_energy_detection_finished(uint8_t ed_sample)
 
         ed_result.ed_dbm = nrf_802154_rssi_ed_sample_to_dbm_convert(m_ed_result);
 
+#if NRF_802154_ED_SWEEP_ENABLED
+        if (m_flags.ed_sweep)
+        {
+            m_flags.ed_sweep  = false;
+            ed_result.p_sweep = nrf_802154_ed_sweep_result_get();
+        }
+#endif
+
         energy_detected_notify(&ed_result);
     }
 
@@ -2716,8 +3012,13 @@ bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
 
             if (result)
             {
-                nrf_802154_tx_work_buffer_reset(&p_params->frame_props);
-                result = nrf_802154_core_hooks_tx_setup(p_data, p_params, &transmit_failed_notify);
+                if (!nrf_802154_core_hooks_tx_prepared_take(p_data, p_params))
+                {
+                    nrf_802154_tx_work_buffer_reset(p_data, &p_params->frame_props);
+                    result = nrf_802154_core_hooks_tx_setup(p_data,
+                                                            p_params,
+                                                            &transmit_failed_notify);
+                }
 
                 if (!result)
                 {
@@ -2853,6 +3154,40 @@ bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_
     return result;
 }
 
+#if NRF_802154_ED_SWEEP_ENABLED
+bool nrf_802154_core_energy_detection_sweep(nrf_802154_term_t                    term_lvl,
+                                            const nrf_802154_ed_sweep_params_t * p_params)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    bool result = critical_section_enter_and_verify_timeslot_length();
+
+    if (result)
+    {
+        result = current_operation_terminate(term_lvl, REQ_ORIG_CORE, true);
+
+        if (result)
+        {
+            nrf_802154_ed_sweep_start(p_params);
+
+            m_ed_time_left   = nrf_802154_ed_sweep_dwell_get();
+            m_ed_result      = 0;
+            m_flags.ed_sweep = true;
+
+            state_set(RADIO_STATE_ED);
+            ed_init();
+        }
+
+        nrf_802154_critical_section_exit();
+    }
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+
+    return result;
+}
+
+#endif // NRF_802154_ED_SWEEP_ENABLED
+
 bool nrf_802154_core_cca(nrf_802154_term_t term_lvl)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -2935,9 +3270,18 @@ bool nrf_802154_core_notify_buffer_free(uint8_t * p_data)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
 
-    rx_buffer_t * p_buffer     = (rx_buffer_t *)p_data;
-    bool          in_crit_sect = critical_section_enter_and_verify_timeslot_length();
+    rx_buffer_t * p_buffer = (rx_buffer_t *)p_data;
+    bool          in_crit_sect;
+
+    if (p_buffer->free)
+    {
+        // A buffer freed twice could already be receiving the next frame
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 
+        return false;
+    }
+
+    in_crit_sect   = critical_section_enter_and_verify_timeslot_length();
     p_buffer->free = true;
     nrf_802154_sl_atomic_store_u8(&m_no_rx_buffer_notified, 0U);
 
@@ -3105,6 +3449,13 @@ uint8_t nrf_802154_core_last_frame_lqi_get(void)
     return m_last_lqi;
 }
 
+const uint8_t * nrf_802154_core_last_frame_src_addr_get(uint8_t * p_src_addr_size)
+{
+    *p_src_addr_size = nrf_802154_frame_parser_src_addr_size_get(&m_last_rx_frame_data);
+
+    return nrf_802154_frame_parser_src_addr_get(&m_last_rx_frame_data);
+}
+
 bool nrf_802154_core_antenna_update(void)
 {
     nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
@@ -178,6 +178,27 @@ bool nrf_802154_core_ack_timeout_handle(const nrf_802154_ack_timeout_handle_para
  */
 bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us);
 
+#if NRF_802154_ED_SWEEP_ENABLED
+
+/**
+ * @brief Requests the transition to the @ref RADIO_STATE_ED state to perform the energy detection
+ *        sweep.
+ *
+ * The channels selected by @p p_params are measured in turns. When the sweep is finished,
+ * the driver transitions to the @ref RADIO_STATE_RX state.
+ *
+ * @param[in]  term_lvl  Termination level of this request. Selects procedures to abort.
+ * @param[in]  p_params  Pointer to the valid parameters of the sweep.
+ *
+ * @retval  true   Entering the energy detection state succeeded.
+ * @retval  false  Entering the energy detection state failed
+ *                 (the driver is performing other procedure).
+ */
+bool nrf_802154_core_energy_detection_sweep(nrf_802154_term_t                    term_lvl,
+                                            const nrf_802154_ed_sweep_params_t * p_params);
+
+#endif // NRF_802154_ED_SWEEP_ENABLED
+
 /**
  * @brief Requests the transition to the @ref RADIO_STATE_CCA state.
  *
@@ -230,6 +251,9 @@ bool nrf_802154_core_modulated_carrier(nrf_802154_term_t term_lvl,
  * the receiver is started if requested.
  *
  * @param[in]  p_data  Pointer to buffer that has been freed.
+ *
+ * @retval  true   The buffer was freed.
+ * @retval  false  The buffer had already been freed.
  */
 bool nrf_802154_core_notify_buffer_free(uint8_t * p_data);
 
@@ -281,6 +305,18 @@ int8_t nrf_802154_core_last_frame_rssi_get(void);
  */
 uint8_t nrf_802154_core_last_frame_lqi_get(void);
 
+/**
+ * Get the source address of the last received non-ACK frame.
+ *
+ * The address points to the receive buffer of the frame and is valid until the next frame is
+ * received or the buffer is freed.
+ *
+ * @param[out]  p_src_addr_size  Size of the source address.
+ *
+ * @returns Pointer to the source address of the last received frame or NULL if it has none.
+ */
+const uint8_t * nrf_802154_core_last_frame_src_addr_get(uint8_t * p_src_addr_size);
+
 /**
  * @brief Notifies the core module that the next higher layer requested the change of the antenna.
  */
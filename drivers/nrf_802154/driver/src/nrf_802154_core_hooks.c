@@ -51,8 +51,18 @@
 #include "mac_features/nrf_802154_ie_writer.h"
 #include "mac_features/nrf_802154_security_writer.h"
 #include "mac_features/nrf_802154_ifs.h"
+#include "mac_features/nrf_802154_neighbor_table.h"
+#include "mac_features/nrf_802154_tx_queue.h"
+#include "mac_features/ack_generator/nrf_802154_enh_ack_generator.h"
 #include "nrf_802154_encrypt.h"
 #include "nrf_802154_config.h"
+#include "nrf_802154_tx_work_buffer.h"
+
+#if (NRF_802154_TX_PIPELINE_DEPTH > 1) && NRF_802154_TX_QUEUE_ENABLED
+#define TX_PREPARE_AHEAD_ENABLED 1
+#else
+#define TX_PREPARE_AHEAD_ENABLED 0
+#endif
 
 typedef bool (* abort_hook)(nrf_802154_term_t term_lvl, req_originator_t req_orig);
 typedef bool (* pre_transmission_hook)(uint8_t                                 * p_frame,
@@ -124,6 +134,9 @@ static const transmitted_hook m_transmitted_hooks[] =
 #endif
 #if NRF_802154_IFS_ENABLED
     nrf_802154_ifs_transmitted_hook,
+#endif
+#if NRF_802154_NEIGHBOR_TABLE_ENABLED
+    nrf_802154_neighbor_table_transmitted_hook,
 #endif
     NULL,
 };
@@ -142,6 +155,15 @@ static const tx_failed_hook m_tx_failed_hooks[] =
     nrf_802154_encrypt_tx_failed_hook,
 #endif
 
+#if NRF_802154_NEIGHBOR_TABLE_ENABLED
+    nrf_802154_neighbor_table_tx_failed_hook,
+#endif
+
+    // Must be the last one, so that it is called only if the failure is going to be notified
+#if NRF_802154_TX_QUEUE_ENABLED
+    nrf_802154_tx_queue_tx_failed_hook,
+#endif
+
     NULL,
 };
 
@@ -207,21 +229,35 @@ static const tx_ack_started_hook m_tx_ack_started_hooks[] =
     nrf_802154_encrypt_tx_ack_started_hook,
 #endif
 
+#if NRF_802154_ENH_ACK_TEMPLATES_NUM > 0
+    // Not time critical, must follow the hooks that complete the Ack.
+    nrf_802154_enh_ack_generator_tx_ack_started_hook,
+#endif
+
     NULL,
 };
 
-bool nrf_802154_core_hooks_terminate(nrf_802154_term_t term_lvl, req_originator_t req_orig)
+#if TX_PREPARE_AHEAD_ENABLED
+static const uint8_t                      * mp_prepared_frame;      ///< Frame whose transmission was set up ahead.
+static nrf_802154_transmitted_frame_props_t m_prepared_frame_props; ///< Properties the frame pointed by @ref mp_prepared_frame was set up with.
+#endif
+
+static bool tx_setup_hooks_process(
+    uint8_t                                 * p_frame,
+    nrf_802154_transmit_params_t            * p_params,
+    nrf_802154_transmit_failed_notification_t notify_function)
 {
     bool result = true;
 
-    for (uint32_t i = 0; i < sizeof(m_abort_hooks) / sizeof(m_abort_hooks[0]); i++)
+    for (uint32_t i = 0; i < sizeof(m_tx_setup_hooks) / sizeof(m_tx_setup_hooks[0]);
+         i++)
     {
-        if (m_abort_hooks[i] == NULL)
+        if (m_tx_setup_hooks[i] == NULL)
         {
             break;
         }
 
-        result = m_abort_hooks[i](term_lvl, req_orig);
+        result = m_tx_setup_hooks[i](p_frame, p_params, notify_function);
 
         if (!result)
         {
@@ -232,22 +268,31 @@ bool nrf_802154_core_hooks_terminate(nrf_802154_term_t term_lvl, req_originator_
     return result;
 }
 
-bool nrf_802154_core_hooks_pre_transmission(
-    uint8_t                                 * p_frame,
-    nrf_802154_transmit_params_t            * p_params,
-    nrf_802154_transmit_failed_notification_t notify_function)
+#if TX_PREPARE_AHEAD_ENABLED
+static void tx_prepare_failed_notify(uint8_t                                   * p_frame,
+                                     nrf_802154_tx_error_t                       error,
+                                     const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    // The frame is set up again when its transmission is requested, which notifies the failure
+    (void)p_frame;
+    (void)error;
+    (void)p_metadata;
+}
+
+#endif
+
+bool nrf_802154_core_hooks_terminate(nrf_802154_term_t term_lvl, req_originator_t req_orig)
 {
     bool result = true;
 
-    for (uint32_t i = 0; i < sizeof(m_pre_transmission_hooks) / sizeof(m_pre_transmission_hooks[0]);
-         i++)
+    for (uint32_t i = 0; i < sizeof(m_abort_hooks) / sizeof(m_abort_hooks[0]); i++)
     {
-        if (m_pre_transmission_hooks[i] == NULL)
+        if (m_abort_hooks[i] == NULL)
         {
             break;
         }
 
-        result = m_pre_transmission_hooks[i](p_frame, p_params, notify_function);
+        result = m_abort_hooks[i](term_lvl, req_orig);
 
         if (!result)
         {
@@ -258,22 +303,22 @@ bool nrf_802154_core_hooks_pre_transmission(
     return result;
 }
 
-bool nrf_802154_core_hooks_tx_setup(
+bool nrf_802154_core_hooks_pre_transmission(
     uint8_t                                 * p_frame,
     nrf_802154_transmit_params_t            * p_params,
     nrf_802154_transmit_failed_notification_t notify_function)
 {
     bool result = true;
 
-    for (uint32_t i = 0; i < sizeof(m_tx_setup_hooks) / sizeof(m_tx_setup_hooks[0]);
+    for (uint32_t i = 0; i < sizeof(m_pre_transmission_hooks) / sizeof(m_pre_transmission_hooks[0]);
          i++)
     {
-        if (m_tx_setup_hooks[i] == NULL)
+        if (m_pre_transmission_hooks[i] == NULL)
         {
             break;
         }
 
-        result = m_tx_setup_hooks[i](p_frame, p_params, notify_function);
+        result = m_pre_transmission_hooks[i](p_frame, p_params, notify_function);
 
         if (!result)
         {
@@ -284,6 +329,17 @@ bool nrf_802154_core_hooks_tx_setup(
     return result;
 }
 
+bool nrf_802154_core_hooks_tx_setup(
+    uint8_t                                 * p_frame,
+    nrf_802154_transmit_params_t            * p_params,
+    nrf_802154_transmit_failed_notification_t notify_function)
+{
+    // The setup of another frame overwrites the state of the modules processed by the hooks
+    nrf_802154_core_hooks_tx_prepared_discard(NULL);
+
+    return tx_setup_hooks_process(p_frame, p_params, notify_function);
+}
+
 void nrf_802154_core_hooks_transmitted(const uint8_t * p_frame)
 {
     for (uint32_t i = 0; i < sizeof(m_transmitted_hooks) / sizeof(m_transmitted_hooks[0]); i++)
@@ -301,6 +357,9 @@ bool nrf_802154_core_hooks_tx_failed(uint8_t * p_frame, nrf_802154_tx_error_t er
 {
     bool result = true;
 
+    // The failed frame is going to be transmitted again or the queue is going to skip frames
+    nrf_802154_core_hooks_tx_prepared_discard(NULL);
+
     for (uint32_t i = 0; i < sizeof(m_tx_failed_hooks) / sizeof(m_tx_failed_hooks[0]); i++)
     {
         if (m_tx_failed_hooks[i] == NULL)
@@ -394,3 +453,68 @@ void nrf_802154_core_hooks_tx_ack_started(uint8_t * p_ack)
         m_tx_ack_started_hooks[i](p_ack);
     }
 }
+
+void nrf_802154_core_hooks_tx_next_prepare(const uint8_t * p_frame)
+{
+#if TX_PREPARE_AHEAD_ENABLED
+    nrf_802154_transmit_params_t params = {0};
+    uint8_t                    * p_next;
+
+    mp_prepared_frame = NULL;
+
+#if NRF_802154_ENCRYPTION_ENABLED && !NRF_802154_ENCRYPTION_ACCELERATOR_SW
+    if ((p_frame[SECURITY_ENABLED_OFFSET] & SECURITY_ENABLED_BIT) != 0U)
+    {
+        // The AES-CCM* peripheral might still be encrypting the frame that is on air
+        return;
+    }
+#endif
+
+    if (!nrf_802154_tx_queue_next_get(p_frame, &p_next, &params.frame_props))
+    {
+        return;
+    }
+
+    nrf_802154_tx_work_buffer_reset(p_next, &params.frame_props);
+
+    if (tx_setup_hooks_process(p_next, &params, &tx_prepare_failed_notify))
+    {
+        mp_prepared_frame      = p_next;
+        m_prepared_frame_props = params.frame_props;
+    }
+#else
+    (void)p_frame;
+#endif
+}
+
+bool nrf_802154_core_hooks_tx_prepared_take(const uint8_t                      * p_frame,
+                                            const nrf_802154_transmit_params_t * p_params)
+{
+#if TX_PREPARE_AHEAD_ENABLED
+    bool result = (p_frame == mp_prepared_frame) &&
+                  (p_params->frame_props.is_secured == m_prepared_frame_props.is_secured) &&
+                  (p_params->frame_props.dynamic_data_is_set ==
+                   m_prepared_frame_props.dynamic_data_is_set);
+
+    mp_prepared_frame = NULL;
+
+    return result;
+#else
+    (void)p_frame;
+    (void)p_params;
+
+    return false;
+#endif
+}
+
+void nrf_802154_core_hooks_tx_prepared_discard(const uint8_t * p_frame)
+{
+#if TX_PREPARE_AHEAD_ENABLED
+    if ((p_frame == NULL) || (p_frame == mp_prepared_frame))
+    {
+        mp_prepared_frame = NULL;
+    }
+#else
+    (void)p_frame;
+#endif
+}
@@ -159,6 +159,42 @@ void nrf_802154_core_hooks_rx_ack_started(void);
  */
 void nrf_802154_core_hooks_tx_ack_started(uint8_t * p_ack);
 
+/**
+ * @brief Sets up the transmission of the frame that follows the given one.
+ *
+ * Called when the transmission of @p p_frame has started. If the transmit queue holds the next
+ * frame, the TX setup hooks are processed for it in its own work buffer, so that its transmission
+ * request does not need to process them again.
+ *
+ * @param[in]  p_frame  Pointer to a buffer that contains PHR and PSDU of the frame
+ *                      that is being transmitted.
+ */
+void nrf_802154_core_hooks_tx_next_prepare(const uint8_t * p_frame);
+
+/**
+ * @brief Takes the transmission setup performed ahead for the given frame.
+ *
+ * @param[in] p_frame   Pointer to a buffer that contains PHR and PSDU of the frame
+ *                      that is to be transmitted.
+ * @param[in] p_params  Pointer to the transmission parameters.
+ *
+ * @retval true   The frame is set up and the TX setup hooks must not be processed for it.
+ * @retval false  The frame is to be set up with @ref nrf_802154_core_hooks_tx_setup.
+ */
+bool nrf_802154_core_hooks_tx_prepared_take(const uint8_t                      * p_frame,
+                                            const nrf_802154_transmit_params_t * p_params);
+
+/**
+ * @brief Discards the transmission setup performed ahead.
+ *
+ * Must be called when the state of the modules processed by the TX setup hooks is modified for
+ * another frame, for example when an ACK frame is generated.
+ *
+ * @param[in]  p_frame  Pointer to the frame whose setup is to be discarded or NULL to discard
+ *                      the setup of any frame.
+ */
+void nrf_802154_core_hooks_tx_prepared_discard(const uint8_t * p_frame);
+
 /**
  *@}
  **/
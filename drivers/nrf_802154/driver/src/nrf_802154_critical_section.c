@@ -52,6 +52,10 @@
 #include "platform/nrf_802154_platform_sl_lptimer.h"
 #include "platform/nrf_802154_irq.h"
 
+#if NRF_802154_TRX_SIM_ENABLED
+#include "nrf_802154_platform_sim.h"
+#endif
+
 #include <nrfx.h>
 
 #define CMSIS_IRQ_NUM_VECTACTIVE_DIFF                 16
@@ -254,6 +258,11 @@ bool nrf_802154_critical_section_is_nested(void)
 
 uint32_t nrf_802154_critical_section_active_vector_priority_get(void)
 {
+#if NRF_802154_TRX_SIM_ENABLED
+    /* There is no NVIC on the host. The simulated platform tracks the priority of the simulated
+     * ISR being executed instead */
+    return nrf_802154_platform_sim_active_priority_get();
+#else
     uint32_t active_priority;
 
 #if defined(CONFIG_SOC_SERIES_BSIM_NRFXX)
@@ -282,4 +291,5 @@ uint32_t nrf_802154_critical_section_active_vector_priority_get(void)
     active_priority = NVIC_GetPriority(irq_number);
 
     return active_priority;
+#endif
 }
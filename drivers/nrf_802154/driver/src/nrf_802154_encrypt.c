@@ -41,9 +41,38 @@
 #include "nrf_802154_const.h"
 #include "nrf_802154_pib.h"
 #include "nrf_802154_types_internal.h"
+#include "nrf_802154_utils.h"
+#include "mac_features/nrf_802154_filter.h"
 #include "mac_features/nrf_802154_frame_parser.h"
 #include "mac_features/nrf_802154_security_pib.h"
 
+#if NRF_802154_ENCRYPT_KEY_CACHE_SIZE > 0
+
+/**
+ * @brief AES-CCM* inputs precomputed for a key identifier and a source address.
+ *
+ * The cache is accessed only from the critical section and from the RADIO IRQ handler,
+ * which never preempt each other.
+ */
+typedef struct
+{
+    bool                                 valid;                               ///< If the entry holds valid data.
+    nrf_802154_security_pib_key_handle_t key_handle;                          ///< Handle of the key the entry was built for.
+    nrf_802154_key_id_mode_t             mode;                                ///< Key identifier mode.
+    uint8_t                              id[KEY_ID_MODE_3_SIZE];              ///< Key identifier.
+    uint8_t                              src_addr[EXTENDED_ADDRESS_SIZE];     ///< Extended address the entry was built for.
+    uint8_t                              nonce_prefix[EXTENDED_ADDRESS_SIZE]; ///< Source address part of the nonce.
+    uint8_t                              key[AES_CCM_KEY_SIZE];               ///< Key value.
+#if NRF_802154_ENCRYPTION_ACCELERATOR_SW
+    nrf_802154_aes_sw_ctx_t              key_ctx;                             ///< Expanded key.
+#endif
+} key_cache_entry_t;
+
+static key_cache_entry_t m_key_cache[NRF_802154_ENCRYPT_KEY_CACHE_SIZE];
+static uint8_t           m_key_cache_next; ///< Index of the entry to be replaced on the next miss.
+
+#endif // NRF_802154_ENCRYPT_KEY_CACHE_SIZE > 0
+
 /**
  * @brief Copies memory in reversed byte order.
  *
@@ -148,6 +177,134 @@ static bool a_data_and_m_data_prepare(
     return result;
 }
 
+#if NRF_802154_ENCRYPT_KEY_CACHE_SIZE > 0
+
+static uint8_t key_id_length_get(nrf_802154_key_id_mode_t mode)
+{
+    switch (mode)
+    {
+        case KEY_ID_MODE_1:
+            return KEY_ID_MODE_1_SIZE;
+
+        case KEY_ID_MODE_2:
+            return KEY_ID_MODE_2_SIZE;
+
+        case KEY_ID_MODE_3:
+            return KEY_ID_MODE_3_SIZE;
+
+        default:
+            return 0;
+    }
+}
+
+/**
+ * @brief Gets the cache entry for the given key identifier and extended address.
+ *
+ * On a miss, the least recently built entry is replaced with data retrieved from the security PIB.
+ *
+ * @param[in]  p_key_id    Pointer to the key identifier.
+ * @param[in]  p_src_addr  Pointer to the extended address of this node securing the frame.
+ *
+ * @return Pointer to the cache entry or NULL if the key could not be found.
+ */
+static const key_cache_entry_t * key_cache_entry_get(nrf_802154_key_id_t * p_key_id,
+                                                     const uint8_t       * p_src_addr)
+{
+    uint8_t             id_len = key_id_length_get(p_key_id->mode);
+    key_cache_entry_t * p_entry;
+
+    if ((id_len != 0) && (p_key_id->p_key_id == NULL))
+    {
+        return NULL;
+    }
+
+    for (uint32_t i = 0; i < NRF_802154_ENCRYPT_KEY_CACHE_SIZE; i++)
+    {
+        p_entry = &m_key_cache[i];
+
+        if (p_entry->valid &&
+            (p_entry->mode == p_key_id->mode) &&
+            (memcmp(p_entry->id, p_key_id->p_key_id, id_len) == 0) &&
+            (memcmp(p_entry->src_addr, p_src_addr, EXTENDED_ADDRESS_SIZE) == 0) &&
+            nrf_802154_security_pib_key_handle_is_valid(&p_entry->key_handle))
+        {
+            return p_entry;
+        }
+    }
+
+    p_entry = &m_key_cache[m_key_cache_next];
+
+    // Do not leave the key material of the replaced entry behind if the lookup below fails.
+    memset(p_entry, 0, sizeof(*p_entry));
+
+    if ((nrf_802154_security_pib_key_handle_get(p_key_id, &p_entry->key_handle) !=
+         NRF_802154_SECURITY_ERROR_NONE) ||
+        (nrf_802154_security_pib_key_use(p_key_id, p_entry->key) != NRF_802154_SECURITY_ERROR_NONE))
+    {
+        return NULL;
+    }
+
+    p_entry->mode = p_key_id->mode;
+    memcpy(p_entry->id, p_key_id->p_key_id, id_len);
+    memcpy(p_entry->src_addr, p_src_addr, EXTENDED_ADDRESS_SIZE);
+    memcpy_rev(p_entry->nonce_prefix, p_src_addr, EXTENDED_ADDRESS_SIZE);
+#if NRF_802154_ENCRYPTION_ACCELERATOR_SW
+    nrf_802154_aes_sw_key_expand(&p_entry->key_ctx, p_entry->key);
+#endif
+    p_entry->valid = true;
+
+    m_key_cache_next = (m_key_cache_next + 1) % NRF_802154_ENCRYPT_KEY_CACHE_SIZE;
+
+    return p_entry;
+}
+
+/**
+ * @brief Prepares the key and the nonce for the AES CCM transformation using the key cache.
+ *
+ * @param[in]   p_frame_data     Pointer to the frame parser data.
+ * @param[in]   p_src_addr       Pointer to the extended address of this node securing the frame.
+ * @param[out]  p_aes_ccm_data   Pointer to AES CCM transformation data to be filled.
+ *
+ * @retval  true   Key and nonce were prepared successfully.
+ * @retval  false  Key could not be found.
+ */
+static bool aes_ccm_data_key_and_nonce_prepare(const nrf_802154_frame_parser_data_t * p_frame_data,
+                                               const uint8_t                        * p_src_addr,
+                                               nrf_802154_aes_ccm_data_t            * p_aes_ccm_data)
+{
+    nrf_802154_key_id_t key_id =
+    {
+        .mode     = nrf_802154_frame_parser_sec_ctrl_key_id_mode_get(p_frame_data),
+        .p_key_id = (uint8_t *)nrf_802154_frame_parser_key_id_get(p_frame_data),
+    };
+
+    const key_cache_entry_t * p_entry = key_cache_entry_get(&key_id, p_src_addr);
+    uint8_t                 * p_nonce = p_aes_ccm_data->nonce;
+
+    if (p_entry == NULL)
+    {
+        return false;
+    }
+
+    memcpy(p_aes_ccm_data->key, p_entry->key, AES_CCM_KEY_SIZE);
+#if NRF_802154_ENCRYPTION_ACCELERATOR_SW
+    p_aes_ccm_data->p_key_ctx = &p_entry->key_ctx;
+#endif
+
+    // Only the frame counter and the security level need to be patched into the nonce.
+    // See aes_ccm_nonce_generate for the layout
+    memcpy(p_nonce, p_entry->nonce_prefix, EXTENDED_ADDRESS_SIZE);
+    memcpy_rev(&p_nonce[EXTENDED_ADDRESS_SIZE],
+               nrf_802154_frame_parser_frame_counter_get(p_frame_data),
+               FRAME_COUNTER_SIZE);
+    p_nonce[EXTENDED_ADDRESS_SIZE + FRAME_COUNTER_SIZE] =
+        nrf_802154_frame_parser_sec_ctrl_sec_lvl_get(p_frame_data);
+
+    return true;
+}
+
+#endif // NRF_802154_ENCRYPT_KEY_CACHE_SIZE > 0
+
 /**
  * @brief Retrieves key to be used for the AES CCM transformation.
  *
@@ -163,6 +320,10 @@ bool aes_ccm_data_key_prepare(const nrf_802154_frame_parser_data_t * p_frame_dat
         .p_key_id = (uint8_t *)nrf_802154_frame_parser_key_id_get(p_frame_data),
     };
 
+#if NRF_802154_ENCRYPTION_ACCELERATOR_SW
+    p_aes_ccm_data->p_key_ctx = NULL;
+#endif
+
     return NRF_802154_SECURITY_ERROR_NONE ==
            nrf_802154_security_pib_key_use(&key_id, p_aes_ccm_data->key);
 }
@@ -171,12 +332,14 @@ bool aes_ccm_data_key_prepare(const nrf_802154_frame_parser_data_t * p_frame_dat
  * @brief Generates a CCM nonce.
  *
  * @param[in]  p_frame_data   Pointer to the frame parser data.
+ * @param[in]  p_src_addr     Pointer to the extended address of this node securing the frame.
  * @param[out] p_nonce        Pointer to the buffer to be filled with generated nonce.
  *
  * @retval  true   Nonce was generated successfully.
  * @retval  false  Nonce could not be generated.
  */
 bool aes_ccm_nonce_generate(const nrf_802154_frame_parser_data_t * p_frame_data,
+                            const uint8_t                        * p_src_addr,
                             uint8_t                              * p_nonce)
 {
     if ((p_frame_data == NULL) || (p_nonce == NULL))
@@ -184,8 +347,7 @@ bool aes_ccm_nonce_generate(const nrf_802154_frame_parser_data_t * p_frame_data,
         return false;
     }
 
-    const uint8_t * p_src_addr = nrf_802154_pib_extended_address_get();
-    uint8_t         offset     = 0;
+    uint8_t offset = 0;
 
     memcpy_rev(p_nonce, p_src_addr, EXTENDED_ADDRESS_SIZE);
     offset += EXTENDED_ADDRESS_SIZE;
@@ -249,33 +411,101 @@ bool aes_ccm_data_a_data_and_m_data_prepare(
     return result;
 }
 
+/**
+ * @brief Gets the extended address of this node that secures an Ack.
+ *
+ * The Ack is sent by the identity the acknowledged frame is addressed to.
+ *
+ * @returns Pointer to the extended address.
+ */
+static const uint8_t * ack_src_extended_address_get(void)
+{
+    const nrf_802154_identity_t * p_identity =
+        nrf_802154_pib_identity_get(nrf_802154_filter_frame_identity_get());
+
+    return (p_identity != NULL) ? p_identity->extended_addr :
+           nrf_802154_pib_extended_address_get();
+}
+
+/**
+ * @brief Gets the extended address of this node that secures a transmitted frame.
+ *
+ * The frame is sent by the identity whose short or extended address is the source address of
+ * the frame. If no additional identity matches, the frame is sent by identity 0.
+ *
+ * @param[in]  p_frame_data  Pointer to the frame parser data.
+ *
+ * @returns Pointer to the extended address.
+ */
+static const uint8_t * tx_src_extended_address_get(
+    const nrf_802154_frame_parser_data_t * p_frame_data)
+{
+#if NRF_802154_IDENTITIES_NUM > 1
+    const uint8_t * p_frame_src_addr = nrf_802154_frame_parser_src_addr_get(p_frame_data);
+    uint8_t         src_addr_size    = nrf_802154_frame_parser_src_addr_size_get(p_frame_data);
+
+    for (uint8_t i = 1U; (p_frame_src_addr != NULL) && (i < NRF_802154_IDENTITIES_NUM); i++)
+    {
+        const nrf_802154_identity_t * p_identity = nrf_802154_pib_identity_get(i);
+        const uint8_t               * p_addr;
+
+        if (p_identity == NULL)
+        {
+            continue;
+        }
+
+        p_addr = (src_addr_size == SHORT_ADDRESS_SIZE) ? p_identity->short_addr :
+                 p_identity->extended_addr;
+
+        if (memcmp(p_frame_src_addr, p_addr, src_addr_size) == 0)
+        {
+            return p_identity->extended_addr;
+        }
+    }
+#else
+    (void)p_frame_data;
+#endif
+
+    return nrf_802154_pib_extended_address_get();
+}
+
 /**
  * @brief Prepares data for AES CCM transformation.
  *
  * @param[in]   p_frame_data     Pointer to the frame parser data.
+ * @param[in]   p_src_addr       Pointer to the extended address of this node securing the frame.
  * @param[out]  p_aes_ccm_data   Pointer to AES CCM transformation data to be filled.
  *
  * @retval  true    AES CCM transformation data was prepared successfully.
  * @retval  false   AES CCM transformation could not be prepared.
  */
 static bool aes_ccm_data_content_prepare(const nrf_802154_frame_parser_data_t * p_frame_data,
+                                         const uint8_t                        * p_src_addr,
                                          nrf_802154_aes_ccm_data_t            * p_aes_ccm_data)
 {
     bool retval = false;
 
     do
     {
+#if NRF_802154_ENCRYPT_KEY_CACHE_SIZE > 0
+        if (!aes_ccm_data_key_and_nonce_prepare(p_frame_data, p_src_addr, p_aes_ccm_data))
+        {
+            // Return immediately if specified key could not be found
+            break;
+        }
+#else
         if (!aes_ccm_data_key_prepare(p_frame_data, p_aes_ccm_data))
         {
             // Return immediately if specified key could not be found
             break;
         }
 
-        if (!aes_ccm_nonce_generate(p_frame_data, p_aes_ccm_data->nonce))
+        if (!aes_ccm_nonce_generate(p_frame_data, p_src_addr, p_aes_ccm_data->nonce))
         {
             // Return immediately if nonce could not be generated
             break;
         }
+#endif
 
         // Fill _a_ data (authenticity) and _m_ data (confidentiality)
         if (!aes_ccm_data_a_data_and_m_data_prepare(p_frame_data, p_aes_ccm_data))
@@ -306,7 +536,9 @@ bool nrf_802154_encrypt_ack_prepare(const nrf_802154_frame_parser_data_t * p_ack
     {
         success = true;
     }
-    else if (aes_ccm_data_content_prepare(p_ack_data, &aes_ccm_data))
+    else if (aes_ccm_data_content_prepare(p_ack_data,
+                                          ack_src_extended_address_get(),
+                                          &aes_ccm_data))
     {
         // Algorithm's inputs prepared. Schedule transformation
         success = nrf_802154_aes_ccm_transform_prepare(&aes_ccm_data);
@@ -324,6 +556,27 @@ void nrf_802154_encrypt_ack_reset(void)
     nrf_802154_aes_ccm_transform_reset();
 }
 
+void nrf_802154_encrypt_key_cache_purge(void)
+{
+#if NRF_802154_ENCRYPT_KEY_CACHE_SIZE > 0
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    for (uint32_t i = 0; i < NRF_802154_ENCRYPT_KEY_CACHE_SIZE; i++)
+    {
+        key_cache_entry_t * p_entry = &m_key_cache[i];
+
+        if (p_entry->valid && !nrf_802154_security_pib_key_handle_is_valid(&p_entry->key_handle))
+        {
+            memset(p_entry, 0, sizeof(*p_entry));
+        }
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+#endif
+}
+
 bool nrf_802154_encrypt_tx_setup(
     uint8_t                                 * p_frame,
     nrf_802154_transmit_params_t            * p_params,
@@ -359,7 +612,9 @@ bool nrf_802154_encrypt_tx_setup(
     {
         success = true;
     }
-    else if (aes_ccm_data_content_prepare(&frame_data, &aes_ccm_data))
+    else if (aes_ccm_data_content_prepare(&frame_data,
+                                          tx_src_extended_address_get(&frame_data),
+                                          &aes_ccm_data))
     {
         // Algorithm's inputs prepared. Schedule transformation
         success = nrf_802154_aes_ccm_transform_prepare(&aes_ccm_data);
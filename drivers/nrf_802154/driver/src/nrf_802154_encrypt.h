@@ -57,6 +57,14 @@ bool nrf_802154_encrypt_ack_prepare(const nrf_802154_frame_parser_data_t * p_ack
  */
 void nrf_802154_encrypt_ack_reset(void);
 
+/**
+ * @brief Wipes the cached copies of keys that are no longer stored in the security PIB.
+ *
+ * This function must be called after a key is removed from the security PIB, so that no copy
+ * of the removed key material is left in RAM.
+ */
+void nrf_802154_encrypt_key_cache_purge(void);
+
 /**
  * @brief Transmission setup hook for the encryption module.
  *
@@ -80,11 +80,11 @@
     (NRF_802154_RX_BUFFERS + NRF_802154_RSCH_DLY_TS_SLOTS + 1)
 
 /**
- * The implementation uses 8-bit integers to address slots with the oldest bit
- * indicating pool. That leaves 7 bits for addressing slots within a fixed pool.
+ * The implementation uses 16-bit integers to address slots with the oldest bit
+ * indicating pool. That leaves 15 bits for addressing slots within a fixed pool.
  * If the pool's size exceeds that width, throw an error.
  */
-#if NTF_PRIMARY_POOL_SIZE > 0x7FU
+#if NTF_PRIMARY_POOL_SIZE > 0x7FFFU
 #error NTF_PRIMARY_POOL_SIZE exceeds its bit width
 #endif
 
@@ -94,11 +94,11 @@
 
 /** @brief Bitmask that represents slot pool used.
  */
-#define NTF_POOL_ID_MASK           (1U << 7)
+#define NTF_POOL_ID_MASK           (1U << 15)
 
 /** @brief Bitmask that indicates a given slot comes from the primary pool.
  */
-#define NTF_PRIMARY_POOL_ID_MASK   (1U << 7)
+#define NTF_PRIMARY_POOL_ID_MASK   (1U << 15)
 
 /** @brief Bitmask that indicates a given slot comes from the secondary pool.
  */
@@ -106,7 +106,7 @@
 
 /** @brief Identifier of an invalid slot.
  */
-#define NTF_INVALID_SLOT_ID        UINT8_MAX
+#define NTF_INVALID_SLOT_ID        UINT16_MAX
 
 /** @brief Size of notification queue.
  *
@@ -193,7 +193,7 @@ typedef struct
 /// Entry in the notification queue
 typedef struct
 {
-    uint8_t id; ///< Identifier of the pool and an entry within.
+    uint16_t id; ///< Identifier of the pool and an entry within.
 } nrf_802154_queue_entry_t;
 
 static nrf_802154_ntf_data_t m_primary_ntf_pool[NTF_PRIMARY_POOL_SIZE];
@@ -204,7 +204,9 @@ static nrf_802154_queue_entry_t m_notifications_queue_memory[NTF_QUEUE_SIZE];
 
 static volatile nrf_802154_mcu_critical_state_t m_mcu_cs;
 
-#if (NRF_802154_MAX_PENDING_NOTIFICATIONS + 1) != (NTF_QUEUE_SIZE)
+#if NRF_802154_DELAYED_TIMESLOTS != NRF_802154_RSCH_DLY_TS_SLOTS
+#error "NRF_802154_DELAYED_TIMESLOTS does not match the number of delayed timeslots"
+#elif (NRF_802154_MAX_PENDING_NOTIFICATIONS + 1) != (NTF_QUEUE_SIZE)
 #error "Mismatching sizes of notification queue and maximum number of pending notifications"
 #endif
 
@@ -215,7 +217,7 @@ static volatile nrf_802154_mcu_critical_state_t m_mcu_cs;
  *
  * @return   Index of the allocated slot or NTF_INVALID_SLOT_ID in case of failure.
  */
-static uint8_t ntf_slot_alloc(nrf_802154_ntf_data_t * p_pool, size_t pool_len)
+static uint16_t ntf_slot_alloc(nrf_802154_ntf_data_t * p_pool, size_t pool_len)
 {
     // Linear search for a free slot
     for (size_t i = 0; i < pool_len; i++)
@@ -294,7 +296,7 @@ static void ntf_exit(void)
  *
  * @param[in]  slot_id  Identifier of the pool and a slot within.
  */
-static void ntf_push(uint8_t slot_id)
+static void ntf_push(uint16_t slot_id)
 {
     nrf_802154_queue_entry_t * p_entry = ntf_enter();
 
@@ -316,7 +318,7 @@ static void ntf_push(uint8_t slot_id)
  */
 bool swi_notify_received(uint8_t * p_data, int8_t power, uint8_t lqi)
 {
-    uint8_t slot_id = ntf_slot_alloc(m_primary_ntf_pool, NTF_PRIMARY_POOL_SIZE);
+    uint16_t slot_id = ntf_slot_alloc(m_primary_ntf_pool, NTF_PRIMARY_POOL_SIZE);
 
     if (slot_id == NTF_INVALID_SLOT_ID)
     {
@@ -365,7 +367,7 @@ bool swi_notify_receive_failed(nrf_802154_rx_error_t error, uint32_t id, bool al
         pool_id_bitmask = NTF_SECONDARY_POOL_ID_MASK;
     }
 
-    uint8_t slot_id = ntf_slot_alloc(p_pool, pool_len);
+    uint16_t slot_id = ntf_slot_alloc(p_pool, pool_len);
 
     if (slot_id == NTF_INVALID_SLOT_ID)
     {
@@ -398,7 +400,7 @@ bool swi_notify_receive_failed(nrf_802154_rx_error_t error, uint32_t id, bool al
 bool swi_notify_transmitted(uint8_t                             * p_frame,
                             nrf_802154_transmit_done_metadata_t * p_metadata)
 {
-    uint8_t slot_id = ntf_slot_alloc(m_primary_ntf_pool, NTF_PRIMARY_POOL_SIZE);
+    uint16_t slot_id = ntf_slot_alloc(m_primary_ntf_pool, NTF_PRIMARY_POOL_SIZE);
 
     if (slot_id == NTF_INVALID_SLOT_ID)
     {
@@ -433,7 +435,7 @@ bool swi_notify_transmit_failed(uint8_t                                   * p_fr
                                 nrf_802154_tx_error_t                       error,
                                 const nrf_802154_transmit_done_metadata_t * p_metadata)
 {
-    uint8_t slot_id = ntf_slot_alloc(m_primary_ntf_pool, NTF_PRIMARY_POOL_SIZE);
+    uint16_t slot_id = ntf_slot_alloc(m_primary_ntf_pool, NTF_PRIMARY_POOL_SIZE);
 
     if (slot_id == NTF_INVALID_SLOT_ID)
     {
@@ -464,7 +466,7 @@ bool swi_notify_transmit_failed(uint8_t                                   * p_fr
  */
 bool swi_notify_energy_detected(const nrf_802154_energy_detected_t * p_result)
 {
-    uint8_t slot_id = ntf_slot_alloc(m_primary_ntf_pool, NTF_PRIMARY_POOL_SIZE);
+    uint16_t slot_id = ntf_slot_alloc(m_primary_ntf_pool, NTF_PRIMARY_POOL_SIZE);
 
     if (slot_id == NTF_INVALID_SLOT_ID)
     {
@@ -493,7 +495,7 @@ bool swi_notify_energy_detected(const nrf_802154_energy_detected_t * p_result)
  */
 bool swi_notify_energy_detection_failed(nrf_802154_ed_error_t error)
 {
-    uint8_t slot_id = ntf_slot_alloc(m_primary_ntf_pool, NTF_PRIMARY_POOL_SIZE);
+    uint16_t slot_id = ntf_slot_alloc(m_primary_ntf_pool, NTF_PRIMARY_POOL_SIZE);
 
     if (slot_id == NTF_INVALID_SLOT_ID)
     {
@@ -523,7 +525,7 @@ bool swi_notify_energy_detection_failed(nrf_802154_ed_error_t error)
  */
 bool swi_notify_cca(bool channel_free)
 {
-    uint8_t slot_id = ntf_slot_alloc(m_primary_ntf_pool, NTF_PRIMARY_POOL_SIZE);
+    uint16_t slot_id = ntf_slot_alloc(m_primary_ntf_pool, NTF_PRIMARY_POOL_SIZE);
 
     if (slot_id == NTF_INVALID_SLOT_ID)
     {
@@ -553,7 +555,7 @@ bool swi_notify_cca(bool channel_free)
  */
 bool swi_notify_cca_failed(nrf_802154_cca_error_t error)
 {
-    uint8_t slot_id = ntf_slot_alloc(m_primary_ntf_pool, NTF_PRIMARY_POOL_SIZE);
+    uint16_t slot_id = ntf_slot_alloc(m_primary_ntf_pool, NTF_PRIMARY_POOL_SIZE);
 
     if (slot_id == NTF_INVALID_SLOT_ID)
     {
@@ -702,7 +704,7 @@ static void irq_handler_ntf_event(void)
         nrf_802154_queue_entry_t * p_entry =
             (nrf_802154_queue_entry_t *)nrf_802154_queue_pop_begin(&m_notifications_queue);
 
-        uint8_t slot_id = p_entry->id & (~NTF_POOL_ID_MASK);
+        uint16_t slot_id = p_entry->id & (~NTF_POOL_ID_MASK);
 
         nrf_802154_ntf_data_t * p_slot =
             (p_entry->id & NTF_POOL_ID_MASK) ? &m_primary_ntf_pool[slot_id] :
@@ -47,6 +47,8 @@
 
 #include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
+#include "mac_features/nrf_802154_csma_ca_backoff.h"
+#include "nrf_802154_sl_atomics.h"
 
 #define CSMACA_BE_MAXIMUM 8 ///< The maximum allowed CSMA-CA backoff exponent (BE) that results from the implementation
 
@@ -59,9 +61,10 @@ typedef struct
 #if NRF_802154_CSMA_CA_ENABLED
 typedef struct
 {
-    uint8_t min_be;       // The minimum value of the backoff exponent (BE) in the CSMA-CA algorithm
-    uint8_t max_be;       // The maximum value of the backoff exponent (BE) in the CSMA-CA algorithm
-    uint8_t max_backoffs; // The maximum number of backoffs that the CSMA-CA algorithm will attempt before declaring a channel access failure.
+    uint8_t                                     min_be;           // The minimum value of the backoff exponent (BE) in the CSMA-CA algorithm
+    uint8_t                                     max_be;           // The maximum value of the backoff exponent (BE) in the CSMA-CA algorithm
+    uint8_t                                     max_backoffs;     // The maximum number of backoffs that the CSMA-CA algorithm will attempt before declaring a channel access failure.
+    const nrf_802154_csma_ca_backoff_policy_t * p_backoff_policy; // The policy deciding how long the CSMA-CA algorithm backs off.
 } nrf_802154_pib_csmaca_t;
 
 #endif  // NRF_802154_CSMA_CA_ENABLED
@@ -86,11 +89,10 @@ typedef struct
 
 typedef struct
 {
-    int8_t                  tx_power;                             ///< Transmit power.
-    uint8_t                 pan_id[PAN_ID_SIZE];                  ///< Pan Id of this node.
-    uint8_t                 short_addr[SHORT_ADDRESS_SIZE];       ///< Short Address of this node.
-    uint8_t                 extended_addr[EXTENDED_ADDRESS_SIZE]; ///< Extended Address of this node.
-    nrf_802154_cca_cfg_t    cca;                                  ///< CCA mode and thresholds.
+    int8_t                  tx_power;                                     ///< Transmit power.
+    nrf_802154_identity_t   identities[NRF_802154_IDENTITIES_NUM];        ///< Identities of this node. Identity 0 holds the Pan Id and addresses of this node.
+    bool                    identities_used[NRF_802154_IDENTITIES_NUM];   ///< Indicating which identities are configured.
+    nrf_802154_cca_cfg_t    cca;                                          ///< CCA mode and thresholds.
     bool                    promiscuous : 1;                      ///< Indicating if radio is in promiscuous mode.
     bool                    auto_ack    : 1;                      ///< Indicating if auto ACK procedure is enabled.
     bool                    pan_coord   : 1;                      ///< Indicating if radio is configured as the PAN coordinator.
@@ -108,6 +110,11 @@ typedef struct
 
 #endif
 
+#if NRF_802154_RETRANSMISSION_ENABLED
+    nrf_802154_retransmission_config_t retransmission; ///< Driver-side retransmission settings.
+
+#endif
+
 #if NRF_802154_TEST_MODES_ENABLED
     nrf_802154_pib_test_modes_t test_modes; ///< Test modes
 
@@ -183,10 +190,12 @@ void nrf_802154_pib_init(void)
     m_data.pan_coord       = false;
     m_data.channel         = 11;
 
-    memset(m_data.pan_id, 0xff, sizeof(m_data.pan_id));
-    m_data.short_addr[0] = 0xfe;
-    m_data.short_addr[1] = 0xff;
-    memset(m_data.extended_addr, 0, sizeof(m_data.extended_addr));
+    memset(m_data.identities, 0, sizeof(m_data.identities));
+    memset(m_data.identities_used, 0, sizeof(m_data.identities_used));
+    memset(m_data.identities[0].pan_id, 0xff, sizeof(m_data.identities[0].pan_id));
+    m_data.identities[0].short_addr[0] = 0xfe;
+    m_data.identities[0].short_addr[1] = 0xff;
+    m_data.identities_used[0]          = true;
 
     m_data.cca.mode           = NRF_802154_CCA_MODE_DEFAULT;
     m_data.cca.ed_threshold   = NRF_802154_CCA_ED_THRESHOLD_DEFAULT;
@@ -200,6 +209,8 @@ void nrf_802154_pib_init(void)
     m_data.csmaca.min_be       = NRF_802154_CSMA_CA_MIN_BE_DEFAULT;
     m_data.csmaca.max_be       = NRF_802154_CSMA_CA_MAX_BE_DEFAULT;
     m_data.csmaca.max_backoffs = NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS_DEFAULT;
+    m_data.csmaca.p_backoff_policy =
+        nrf_802154_csma_ca_backoff_policy_builtin_get(NRF_802154_CSMA_CA_BACKOFF_POLICY_IEEE);
 #endif // NRF_802154_CSMA_CA_ENABLED
 
 #if NRF_802154_IFS_ENABLED
@@ -208,6 +219,13 @@ void nrf_802154_pib_init(void)
     m_data.ifs.mode               = NRF_802154_IFS_MODE_DISABLED;
 #endif // NRF_802154_IFS_ENABLED
 
+#if NRF_802154_RETRANSMISSION_ENABLED
+    m_data.retransmission.max_frame_retries = NRF_802154_RETRANSMISSION_MAX_FRAME_RETRIES_DEFAULT;
+    m_data.retransmission.csma_ca_restart   =
+        NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ACK_FAILURE;
+    m_data.retransmission.frame_pending = NRF_802154_RETRANSMISSION_FRAME_PENDING_DATA_REQ;
+#endif // NRF_802154_RETRANSMISSION_ENABLED
+
 #if NRF_802154_TEST_MODES_ENABLED
     m_data.test_modes.csmaca_backoff = NRF_802154_TEST_MODE_CSMACA_BACKOFF_RANDOM;
 #endif
@@ -276,32 +294,71 @@ void nrf_802154_pib_tx_power_set(int8_t dbm)
 
 const uint8_t * nrf_802154_pib_pan_id_get(void)
 {
-    return m_data.pan_id;
+    return m_data.identities[0].pan_id;
 }
 
 void nrf_802154_pib_pan_id_set(const uint8_t * p_pan_id)
 {
-    memcpy(m_data.pan_id, p_pan_id, PAN_ID_SIZE);
+    memcpy(m_data.identities[0].pan_id, p_pan_id, PAN_ID_SIZE);
 }
 
 const uint8_t * nrf_802154_pib_extended_address_get(void)
 {
-    return m_data.extended_addr;
+    return m_data.identities[0].extended_addr;
 }
 
 void nrf_802154_pib_extended_address_set(const uint8_t * p_extended_address)
 {
-    memcpy(m_data.extended_addr, p_extended_address, EXTENDED_ADDRESS_SIZE);
+    memcpy(m_data.identities[0].extended_addr, p_extended_address, EXTENDED_ADDRESS_SIZE);
 }
 
 const uint8_t * nrf_802154_pib_short_address_get(void)
 {
-    return m_data.short_addr;
+    return m_data.identities[0].short_addr;
 }
 
 void nrf_802154_pib_short_address_set(const uint8_t * p_short_address)
 {
-    memcpy(m_data.short_addr, p_short_address, SHORT_ADDRESS_SIZE);
+    memcpy(m_data.identities[0].short_addr, p_short_address, SHORT_ADDRESS_SIZE);
+}
+
+const nrf_802154_identity_t * nrf_802154_pib_identity_get(uint8_t index)
+{
+    if ((index >= NRF_802154_IDENTITIES_NUM) || !m_data.identities_used[index])
+    {
+        return NULL;
+    }
+
+    return &m_data.identities[index];
+}
+
+bool nrf_802154_pib_identity_set(uint8_t index, const nrf_802154_identity_t * p_identity)
+{
+    if ((index == 0U) || (index >= NRF_802154_IDENTITIES_NUM))
+    {
+        return false;
+    }
+
+    // The identity is not matched by the receive filter while it is being modified.
+    m_data.identities_used[index] = false;
+    __DMB();
+    m_data.identities[index] = *p_identity;
+    __DMB();
+    m_data.identities_used[index] = true;
+
+    return true;
+}
+
+bool nrf_802154_pib_identity_clear(uint8_t index)
+{
+    if ((index == 0U) || (index >= NRF_802154_IDENTITIES_NUM))
+    {
+        return false;
+    }
+
+    m_data.identities_used[index] = false;
+
+    return true;
 }
 
 void nrf_802154_pib_cca_cfg_set(const nrf_802154_cca_cfg_t * p_cca_cfg)
@@ -413,6 +470,16 @@ uint8_t nrf_802154_pib_csmaca_max_backoffs_get(void)
     return m_data.csmaca.max_backoffs;
 }
 
+void nrf_802154_pib_csmaca_backoff_policy_set(const nrf_802154_csma_ca_backoff_policy_t * p_policy)
+{
+    m_data.csmaca.p_backoff_policy = p_policy;
+}
+
+const nrf_802154_csma_ca_backoff_policy_t * nrf_802154_pib_csmaca_backoff_policy_get(void)
+{
+    return m_data.csmaca.p_backoff_policy;
+}
+
 #endif // NRF_802154_CSMA_CA_ENABLED
 
 #if NRF_802154_IFS_ENABLED
@@ -460,6 +527,56 @@ void nrf_802154_pib_ifs_min_lifs_period_set(uint16_t period)
 
 #endif // NRF_802154_IFS_ENABLED
 
+#if NRF_802154_RETRANSMISSION_ENABLED
+bool nrf_802154_pib_retransmission_config_set(const nrf_802154_retransmission_config_t * p_config)
+{
+    bool result;
+
+    switch (p_config->csma_ca_restart)
+    {
+        case NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ACK_FAILURE:
+        case NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ALWAYS:
+        case NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_NEVER:
+            result = true;
+            break;
+
+        default:
+            result = false;
+            break;
+    }
+
+    switch (p_config->frame_pending)
+    {
+        case NRF_802154_RETRANSMISSION_FRAME_PENDING_DATA_REQ:
+        case NRF_802154_RETRANSMISSION_FRAME_PENDING_ANY:
+            break;
+
+        default:
+            result = false;
+            break;
+    }
+
+    // The number of attempts, including the first one, must fit in nrf_802154_transmit_retries_t
+    if (p_config->max_frame_retries == UINT8_MAX)
+    {
+        result = false;
+    }
+
+    if (result)
+    {
+        m_data.retransmission = *p_config;
+    }
+
+    return result;
+}
+
+const nrf_802154_retransmission_config_t * nrf_802154_pib_retransmission_config_get(void)
+{
+    return &m_data.retransmission;
+}
+
+#endif // NRF_802154_RETRANSMISSION_ENABLED
+
 #if NRF_802154_TEST_MODES_ENABLED
 nrf_802154_test_mode_csmaca_backoff_t nrf_802154_pib_test_mode_csmaca_backoff_get(void)
 {
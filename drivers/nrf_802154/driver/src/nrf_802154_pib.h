@@ -190,6 +190,41 @@ const uint8_t * nrf_802154_pib_short_address_get(void);
  */
 void nrf_802154_pib_short_address_set(const uint8_t * p_short_address);
 
+/**
+ * @brief Gets an identity of this device.
+ *
+ * Identity 0 holds the PAN ID, the short address and the extended address of this device and is
+ * always configured.
+ *
+ * @param[in]  index  Index of the identity.
+ *
+ * @returns Pointer to the identity or NULL if the identity with given index is not configured.
+ */
+const nrf_802154_identity_t * nrf_802154_pib_identity_get(uint8_t index);
+
+/**
+ * @brief Configures an additional identity of this device.
+ *
+ * This function makes a copy of the identity.
+ *
+ * @param[in]  index       Index of the identity, from 1 to @ref NRF_802154_IDENTITIES_NUM - 1.
+ * @param[in]  p_identity  Pointer to the identity.
+ *
+ * @retval true   The identity has been configured.
+ * @retval false  The index is out of range.
+ */
+bool nrf_802154_pib_identity_set(uint8_t index, const nrf_802154_identity_t * p_identity);
+
+/**
+ * @brief Removes an additional identity of this device.
+ *
+ * @param[in]  index  Index of the identity, from 1 to @ref NRF_802154_IDENTITIES_NUM - 1.
+ *
+ * @retval true   The identity has been removed.
+ * @retval false  The index is out of range.
+ */
+bool nrf_802154_pib_identity_clear(uint8_t index);
+
 /**
  * @brief Sets the radio CCA mode and threshold.
  *
@@ -289,6 +324,20 @@ void nrf_802154_pib_csmaca_max_backoffs_set(uint8_t max_backoffs);
  * @return Current maximum number of backoffs.
  */
 uint8_t nrf_802154_pib_csmaca_max_backoffs_get(void);
+
+/**
+ * @brief Sets the backoff policy used by the CSMA-CA algorithm.
+ *
+ * @param[in] p_policy  Pointer to the policy.
+ */
+void nrf_802154_pib_csmaca_backoff_policy_set(const nrf_802154_csma_ca_backoff_policy_t * p_policy);
+
+/**
+ * @brief Gets the backoff policy used by the CSMA-CA algorithm.
+ *
+ * @return Pointer to the current policy.
+ */
+const nrf_802154_csma_ca_backoff_policy_t * nrf_802154_pib_csmaca_backoff_policy_get(void);
 #endif // NRF_802154_CSMA_CA_ENABLED
 
 #if NRF_802154_IFS_ENABLED
@@ -340,6 +389,26 @@ uint16_t nrf_802154_pib_ifs_min_lifs_period_get(void);
 void nrf_802154_pib_ifs_min_lifs_period_set(uint16_t period);
 #endif // NRF_802154_IFS_ENABLED
 
+#if NRF_802154_RETRANSMISSION_ENABLED
+/**
+ * @brief Sets the settings of the driver-side retransmissions.
+ *
+ * @param[in] p_config  Pointer to the settings.
+ *
+ * @retval true   The settings are valid and have been set.
+ * @retval false  The settings are invalid.
+ */
+bool nrf_802154_pib_retransmission_config_set(const nrf_802154_retransmission_config_t * p_config);
+
+/**
+ * @brief Gets the settings of the driver-side retransmissions.
+ *
+ * @return Pointer to the current settings.
+ */
+const nrf_802154_retransmission_config_t * nrf_802154_pib_retransmission_config_get(void);
+
+#endif // NRF_802154_RETRANSMISSION_ENABLED
+
 #if NRF_802154_TEST_MODES_ENABLED
 /**
  * @brief Gets the current CSMA/CA backoff test mode.
@@ -0,0 +1,627 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/**
+ * @file
+ *   This file implements the host-side simulator of the platform modules used by the
+ *   802.15.4 driver.
+ *
+ */
+
+#include "nrf_802154_platform_sim.h"
+
+#if NRF_802154_TRX_SIM_ENABLED
+
+#include "nrf_802154_assert.h"
+#include <stddef.h>
+#include <string.h>
+
+#include "nrf_802154_sl_config.h"
+#include "nrf_802154_sl_timer.h"
+#include "nrf_802154_trx_sim.h"
+#include "platform/nrf_802154_clock.h"
+#include "platform/nrf_802154_irq.h"
+#include "platform/nrf_802154_platform_sl_lptimer.h"
+#include "platform/nrf_802154_random.h"
+#include "platform/nrf_802154_temperature.h"
+#include "timer/nrf_802154_timer_coord.h"
+
+#define IRQS_NUM            64U            ///< Number of simulated interrupt lines
+#define HFCLK_STARTUP_TIME  360UL          ///< Startup time of the simulated high-frequency clock [us]
+#define CLOCK_IRQ_PRIORITY  6U             ///< Priority of the simulated ISR notifying about the clock
+#define TIMER_IRQ_PRIORITY  NRF_802154_SL_RTC_IRQ_PRIORITY ///< Priority of the simulated timer ISR
+#define RANDOM_SEED_DEFAULT 0x6C078965UL   ///< Default seed of the random number generator
+#define TEMPERATURE_DEFAULT 25             ///< Default temperature reported by the sensor [C]
+#define PRIORITY_THREAD     UINT32_MAX     ///< Priority reported when no simulated ISR is executed
+
+/**@brief Sources of the simulated events. */
+typedef enum
+{
+    SIM_SOURCE_NONE,  ///< No event is due.
+    SIM_SOURCE_IRQ,   ///< Pending interrupt.
+    SIM_SOURCE_RADIO, ///< Event of the simulated radio.
+    SIM_SOURCE_CLOCK, ///< High-frequency clock has started.
+    SIM_SOURCE_TIMER, ///< Timer has expired.
+} sim_source_t;
+
+/**@brief States of the simulated high-frequency clock. */
+typedef enum
+{
+    HFCLK_STATE_OFF,      ///< Clock is stopped.
+    HFCLK_STATE_STARTING, ///< Clock has been requested and it is starting.
+    HFCLK_STATE_RUNNING,  ///< Clock is running.
+} hfclk_state_t;
+
+/**@brief Simulated interrupt line. */
+typedef struct
+{
+    nrf_802154_isr_t isr;      ///< Interrupt service routine.
+    uint32_t         priority; ///< Priority of the interrupt.
+    bool             enabled;  ///< If the interrupt is enabled.
+    bool             pending;  ///< If the interrupt is pending.
+} sim_irq_t;
+
+/**@brief Private fields of a simulated timer, stored in the placeholder of the timer. */
+typedef struct
+{
+    nrf_802154_sl_timer_t * p_next; ///< Next active timer in the order of trigger times.
+} sim_timer_priv_t;
+
+static sim_irq_t               m_irqs[IRQS_NUM];         ///< Simulated interrupt lines.
+static uint32_t                m_active_priority;        ///< Priority of the simulated ISR being executed.
+
+static hfclk_state_t           m_hfclk_state;            ///< State of the high-frequency clock.
+static uint64_t                m_hfclk_ready_time;       ///< Time at which the starting clock becomes ready [us].
+static bool                    m_lfclk_running;          ///< If the low-frequency clock is running.
+
+static nrf_802154_sl_timer_t * mp_timers;                ///< Active timers sorted by trigger time.
+static uint32_t                m_lptimer_cs_nesting;     ///< Nesting level of the lptimer critical section.
+
+static bool                    m_timer_coord_running;    ///< If the timer coordinator is running.
+static bool                    m_timestamp_prepared;     ///< If a timestamp has been prepared.
+static uint32_t                m_timestamp_event;        ///< Address of the event to timestamp.
+static uint64_t                m_timestamp_prepare_time; ///< Time at which the timestamp was prepared [us].
+
+static uint32_t                m_random_state;           ///< State of the random number generator.
+static int8_t                  m_temperature;            ///< Temperature reported by the sensor [C].
+
+static sim_timer_priv_t * timer_priv_get(nrf_802154_sl_timer_t * p_timer)
+{
+    return (sim_timer_priv_t *)&p_timer->priv;
+}
+
+/** Removes a timer from the list of active timers. Returns false if it was not active. */
+static bool timer_unlink(nrf_802154_sl_timer_t * p_timer)
+{
+    nrf_802154_sl_timer_t ** pp_link = &mp_timers;
+
+    while (*pp_link != NULL)
+    {
+        if (*pp_link == p_timer)
+        {
+            *pp_link                        = timer_priv_get(p_timer)->p_next;
+            timer_priv_get(p_timer)->p_next = NULL;
+            return true;
+        }
+
+        pp_link = &timer_priv_get(*pp_link)->p_next;
+    }
+
+    return false;
+}
+
+/** Inserts a timer after all active timers with the same or earlier trigger time. */
+static void timer_link(nrf_802154_sl_timer_t * p_timer)
+{
+    nrf_802154_sl_timer_t ** pp_link = &mp_timers;
+
+    while ((*pp_link != NULL) && ((*pp_link)->trigger_time <= p_timer->trigger_time))
+    {
+        pp_link = &timer_priv_get(*pp_link)->p_next;
+    }
+
+    timer_priv_get(p_timer)->p_next = *pp_link;
+    *pp_link                        = p_timer;
+}
+
+static void timer_fire(nrf_802154_sl_timer_t * p_timer)
+{
+    if (((p_timer->action_type & NRF_802154_SL_TIMER_ACTION_TYPE_HARDWARE) != 0U) &&
+        (p_timer->action.hardware.ppi_channel != NRF_802154_SL_TIMER_INVALID_PPI_CHANNEL))
+    {
+        // The only task triggered through (D)PPI by the driver is the radio ramp-up.
+        nrf_802154_trx_sim_ramp_up_trigger();
+    }
+
+    if ((p_timer->action_type & NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK) != 0U)
+    {
+        p_timer->action.callback.callback(p_timer);
+    }
+}
+
+/** Selects the pending interrupt with the highest priority. Returns IRQS_NUM if there is none. */
+static uint32_t irq_pending_get(void)
+{
+    uint32_t result = IRQS_NUM;
+
+    for (uint32_t i = 0; i < IRQS_NUM; i++)
+    {
+        if (m_irqs[i].enabled && m_irqs[i].pending &&
+            ((result == IRQS_NUM) || (m_irqs[i].priority < m_irqs[result].priority)))
+        {
+            result = i;
+        }
+    }
+
+    return result;
+}
+
+static void candidate_update(sim_source_t   source,
+                             uint64_t       time,
+                             uint32_t       priority,
+                             sim_source_t * p_source,
+                             uint64_t     * p_time,
+                             uint32_t     * p_priority)
+{
+    if ((*p_source == SIM_SOURCE_NONE) ||
+        (time < *p_time) ||
+        ((time == *p_time) && (priority < *p_priority)))
+    {
+        *p_source   = source;
+        *p_time     = time;
+        *p_priority = priority;
+    }
+}
+
+/** Selects the earliest event, breaking ties with the priorities of the simulated ISRs. */
+static sim_source_t next_source_get(uint64_t * p_time, uint32_t * p_irqn)
+{
+    uint64_t     now      = nrf_802154_trx_sim_time_get();
+    sim_source_t source   = SIM_SOURCE_NONE;
+    uint32_t     priority = PRIORITY_THREAD;
+    uint64_t     time;
+
+    *p_time = now;
+    *p_irqn = irq_pending_get();
+
+    if (*p_irqn < IRQS_NUM)
+    {
+        candidate_update(SIM_SOURCE_IRQ, now, m_irqs[*p_irqn].priority,
+                         &source, p_time, &priority);
+    }
+
+    if (nrf_802154_trx_sim_next_event_time_get(&time))
+    {
+        candidate_update(SIM_SOURCE_RADIO, (time > now) ? time : now, NRF_802154_IRQ_PRIORITY,
+                         &source, p_time, &priority);
+    }
+
+    if (m_hfclk_state == HFCLK_STATE_STARTING)
+    {
+        time = m_hfclk_ready_time;
+        candidate_update(SIM_SOURCE_CLOCK, (time > now) ? time : now, CLOCK_IRQ_PRIORITY,
+                         &source, p_time, &priority);
+    }
+
+    if (mp_timers != NULL)
+    {
+        time = mp_timers->trigger_time;
+        candidate_update(SIM_SOURCE_TIMER, (time > now) ? time : now, TIMER_IRQ_PRIORITY,
+                         &source, p_time, &priority);
+    }
+
+    return source;
+}
+
+/** Processes a single simulated event as an ISR of the given priority. */
+static void source_process(sim_source_t source, uint32_t irqn)
+{
+    nrf_802154_sl_timer_t * p_timer;
+
+    switch (source)
+    {
+        case SIM_SOURCE_IRQ:
+            m_irqs[irqn].pending = false;
+            m_active_priority    = m_irqs[irqn].priority;
+            m_irqs[irqn].isr();
+            break;
+
+        case SIM_SOURCE_CLOCK:
+            m_hfclk_state     = HFCLK_STATE_RUNNING;
+            m_active_priority = CLOCK_IRQ_PRIORITY;
+            nrf_802154_clock_hfclk_ready();
+            break;
+
+        case SIM_SOURCE_TIMER:
+            p_timer = mp_timers;
+            (void)timer_unlink(p_timer);
+            m_active_priority = TIMER_IRQ_PRIORITY;
+            timer_fire(p_timer);
+            break;
+
+        default:
+            NRF_802154_ASSERT(false);
+    }
+
+    m_active_priority = PRIORITY_THREAD;
+}
+
+void nrf_802154_platform_sim_reset(void)
+{
+    memset(m_irqs, 0, sizeof(m_irqs));
+
+    while (mp_timers != NULL)
+    {
+        (void)timer_unlink(mp_timers);
+    }
+
+    m_active_priority     = PRIORITY_THREAD;
+    m_hfclk_state         = HFCLK_STATE_OFF;
+    m_lfclk_running       = false;
+    m_lptimer_cs_nesting  = 0U;
+    m_timer_coord_running = false;
+    m_timestamp_prepared  = false;
+    m_random_state        = RANDOM_SEED_DEFAULT;
+    m_temperature         = TEMPERATURE_DEFAULT;
+
+    nrf_802154_trx_sim_reset();
+}
+
+void nrf_802154_platform_sim_run_until(uint64_t time)
+{
+    sim_source_t source;
+    uint64_t     next;
+    uint32_t     irqn;
+
+    NRF_802154_ASSERT(m_active_priority == PRIORITY_THREAD);
+    NRF_802154_ASSERT(m_lptimer_cs_nesting == 0U);
+
+    while (((source = next_source_get(&next, &irqn)) != SIM_SOURCE_NONE) && (next <= time))
+    {
+        if (source == SIM_SOURCE_RADIO)
+        {
+            // The simulated radio calls the RADIO ISR by itself.
+            m_active_priority = NRF_802154_IRQ_PRIORITY;
+            nrf_802154_trx_sim_run_until(next);
+            m_active_priority = PRIORITY_THREAD;
+        }
+        else
+        {
+            if (next > nrf_802154_trx_sim_time_get())
+            {
+                nrf_802154_trx_sim_run_until(next);
+            }
+
+            source_process(source, irqn);
+        }
+    }
+
+    nrf_802154_trx_sim_run_until(time);
+}
+
+uint32_t nrf_802154_platform_sim_active_priority_get(void)
+{
+    return m_active_priority;
+}
+
+void nrf_802154_platform_sim_temperature_set(int8_t temperature)
+{
+    if (m_temperature != temperature)
+    {
+        m_temperature = temperature;
+        nrf_802154_temperature_changed();
+    }
+}
+
+/***************************************************************************************************
+ * @section Clock
+ **************************************************************************************************/
+
+void nrf_802154_clock_init(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_clock_deinit(void)
+{
+    m_hfclk_state   = HFCLK_STATE_OFF;
+    m_lfclk_running = false;
+}
+
+void nrf_802154_clock_hfclk_start(void)
+{
+    if (m_hfclk_state == HFCLK_STATE_OFF)
+    {
+        m_hfclk_state      = HFCLK_STATE_STARTING;
+        m_hfclk_ready_time = nrf_802154_trx_sim_time_get() + HFCLK_STARTUP_TIME;
+    }
+}
+
+void nrf_802154_clock_hfclk_stop(void)
+{
+    m_hfclk_state = HFCLK_STATE_OFF;
+}
+
+bool nrf_802154_clock_hfclk_is_running(void)
+{
+    return m_hfclk_state == HFCLK_STATE_RUNNING;
+}
+
+void nrf_802154_clock_lfclk_start(void)
+{
+    // The low-frequency clock is not used by the simulated timers, so it starts immediately
+    // and no notification is sent.
+    m_lfclk_running = true;
+}
+
+void nrf_802154_clock_lfclk_stop(void)
+{
+    m_lfclk_running = false;
+}
+
+bool nrf_802154_clock_lfclk_is_running(void)
+{
+    return m_lfclk_running;
+}
+
+/***************************************************************************************************
+ * @section Interrupts
+ **************************************************************************************************/
+
+void nrf_802154_irq_init(uint32_t irqn, int32_t prio, nrf_802154_isr_t isr)
+{
+    NRF_802154_ASSERT(irqn < IRQS_NUM);
+    NRF_802154_ASSERT(prio >= 0);
+
+    m_irqs[irqn].isr      = isr;
+    m_irqs[irqn].priority = (uint32_t)prio;
+}
+
+void nrf_802154_irq_enable(uint32_t irqn)
+{
+    NRF_802154_ASSERT(irqn < IRQS_NUM);
+
+    m_irqs[irqn].enabled = true;
+}
+
+void nrf_802154_irq_disable(uint32_t irqn)
+{
+    NRF_802154_ASSERT(irqn < IRQS_NUM);
+
+    m_irqs[irqn].enabled = false;
+}
+
+void nrf_802154_irq_set_pending(uint32_t irqn)
+{
+    NRF_802154_ASSERT(irqn < IRQS_NUM);
+
+    m_irqs[irqn].pending = true;
+}
+
+void nrf_802154_irq_clear_pending(uint32_t irqn)
+{
+    NRF_802154_ASSERT(irqn < IRQS_NUM);
+
+    m_irqs[irqn].pending = false;
+}
+
+bool nrf_802154_irq_is_enabled(uint32_t irqn)
+{
+    NRF_802154_ASSERT(irqn < IRQS_NUM);
+
+    return m_irqs[irqn].enabled;
+}
+
+uint32_t nrf_802154_irq_priority_get(uint32_t irqn)
+{
+    NRF_802154_ASSERT(irqn < IRQS_NUM);
+
+    return m_irqs[irqn].priority;
+}
+
+/***************************************************************************************************
+ * @section Timers
+ **************************************************************************************************/
+
+void nrf_802154_sl_timer_module_init(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_sl_timer_module_uninit(void)
+{
+    while (mp_timers != NULL)
+    {
+        (void)timer_unlink(mp_timers);
+    }
+}
+
+uint64_t nrf_802154_sl_timer_current_time_get(void)
+{
+    return nrf_802154_trx_sim_time_get();
+}
+
+void nrf_802154_sl_timer_init(nrf_802154_sl_timer_t * p_timer)
+{
+    NRF_802154_ASSERT(sizeof(sim_timer_priv_t) <= sizeof(p_timer->priv));
+
+    timer_priv_get(p_timer)->p_next = NULL;
+}
+
+void nrf_802154_sl_timer_deinit(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)timer_unlink(p_timer);
+}
+
+nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_add(nrf_802154_sl_timer_t * p_timer)
+{
+    NRF_802154_ASSERT(p_timer != NULL);
+    NRF_802154_ASSERT(((p_timer->action_type & NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK) == 0U) ||
+                      (p_timer->action.callback.callback != NULL));
+
+    (void)timer_unlink(p_timer);
+    timer_link(p_timer);
+
+    return NRF_802154_SL_TIMER_RET_SUCCESS;
+}
+
+nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_remove(nrf_802154_sl_timer_t * p_timer)
+{
+    return timer_unlink(p_timer) ? NRF_802154_SL_TIMER_RET_SUCCESS :
+           NRF_802154_SL_TIMER_RET_INACTIVE;
+}
+
+nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_update_ppi(nrf_802154_sl_timer_t * p_timer,
+                                                         uint32_t                ppi_chn)
+{
+    nrf_802154_sl_timer_t * p_active = mp_timers;
+
+    while ((p_active != NULL) && (p_active != p_timer))
+    {
+        p_active = timer_priv_get(p_active)->p_next;
+    }
+
+    if (p_active == NULL)
+    {
+        return NRF_802154_SL_TIMER_RET_INACTIVE;
+    }
+
+    p_timer->action.hardware.ppi_channel = ppi_chn;
+
+    return NRF_802154_SL_TIMER_RET_SUCCESS;
+}
+
+void nrf_802154_platform_sl_lptimer_critical_section_enter(void)
+{
+    m_lptimer_cs_nesting++;
+}
+
+void nrf_802154_platform_sl_lptimer_critical_section_exit(void)
+{
+    NRF_802154_ASSERT(m_lptimer_cs_nesting > 0U);
+
+    m_lptimer_cs_nesting--;
+}
+
+/***************************************************************************************************
+ * @section Timer coordinator
+ **************************************************************************************************/
+
+void nrf_802154_timer_coord_init(void)
+{
+    m_timer_coord_running = false;
+    m_timestamp_prepared  = false;
+}
+
+void nrf_802154_timer_coord_uninit(void)
+{
+    m_timer_coord_running = false;
+}
+
+void nrf_802154_timer_coord_start(void)
+{
+    m_timer_coord_running = true;
+}
+
+void nrf_802154_timer_coord_stop(void)
+{
+    m_timer_coord_running = false;
+    m_timestamp_prepared  = false;
+}
+
+void nrf_802154_timer_coord_timestamp_prepare(const nrf_802154_sl_event_handle_t * p_event)
+{
+    m_timestamp_event        = p_event->event_addr;
+    m_timestamp_prepare_time = nrf_802154_trx_sim_time_get();
+    m_timestamp_prepared     = true;
+}
+
+bool nrf_802154_timer_coord_timestamp_get(uint64_t * p_timestamp)
+{
+    uint64_t time;
+
+    // The timestamp is captured only by an event occurring after the preparation.
+    if (!m_timer_coord_running || !m_timestamp_prepared ||
+        !nrf_802154_trx_sim_event_time_get(m_timestamp_event, &time) ||
+        (time < m_timestamp_prepare_time))
+    {
+        return false;
+    }
+
+    *p_timestamp = time;
+
+    return true;
+}
+
+/***************************************************************************************************
+ * @section Temperature and random numbers
+ **************************************************************************************************/
+
+void nrf_802154_temperature_init(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_temperature_deinit(void)
+{
+    // Intentionally empty
+}
+
+int8_t nrf_802154_temperature_get(void)
+{
+    return m_temperature;
+}
+
+void nrf_802154_random_init(void)
+{
+    // Intentionally empty
+}
+
+void nrf_802154_random_deinit(void)
+{
+    // Intentionally empty
+}
+
+uint32_t nrf_802154_random_get(void)
+{
+    // xorshift32
+    m_random_state ^= m_random_state << 13;
+    m_random_state ^= m_random_state >> 17;
+    m_random_state ^= m_random_state << 5;
+
+    return m_random_state;
+}
+
+#endif // NRF_802154_TRX_SIM_ENABLED
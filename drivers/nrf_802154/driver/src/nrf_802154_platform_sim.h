@@ -0,0 +1,97 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+
+/**
+ * @brief Host-side simulator of the platform modules used by the nRF IEEE 802.15.4 radio driver.
+ *
+ * @details When @ref NRF_802154_TRX_SIM_ENABLED is set to 1, this module complements the
+ *          simulated trx module (see nrf_802154_trx_sim.h) with the platform modules the driver
+ *          core needs to run on a host: the clock, the interrupts, the timer module of the
+ *          Service Layer with its timer coordinator, the low-power timer critical section,
+ *          the temperature sensor and the random number generator.
+ *
+ *          All of them run on the virtual clock of the simulated radio. Timer callbacks,
+ *          clock notifications and pending interrupts are dispatched by
+ *          @ref nrf_802154_platform_sim_run_until in chronological order, interleaved with the
+ *          radio events. Each of them is called as a simulated ISR, so that the driver sees
+ *          the interrupt priority the handler would run at on the target.
+ */
+
+#ifndef NRF_802154_PLATFORM_SIM_H_
+#define NRF_802154_PLATFORM_SIM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Resets the simulated platform and the simulated radio.
+ *
+ * Removes all timers, restores the default state of the simulated interrupts and clocks and
+ * calls @ref nrf_802154_trx_sim_reset. Must be called before the driver is initialized.
+ */
+void nrf_802154_platform_sim_reset(void);
+
+/**@brief Advances the simulated clock, dispatching all simulated events on the way.
+ *
+ * Radio events, timer expirations, clock notifications and pending interrupts are processed
+ * in chronological order. Events occurring at the same time are processed in the order of
+ * the priorities of their simulated ISRs.
+ *
+ * @param[in] time  Simulated time to advance to, in microseconds. Must not be in the past.
+ */
+void nrf_802154_platform_sim_run_until(uint64_t time);
+
+/**@brief Gets the priority of the simulated ISR being executed.
+ *
+ * @return Priority of the simulated ISR or UINT32_MAX if called from the main thread.
+ */
+uint32_t nrf_802154_platform_sim_active_priority_get(void);
+
+/**@brief Sets the value reported by the simulated temperature sensor.
+ *
+ * @param[in] temperature  Temperature in degrees Celsius.
+ */
+void nrf_802154_platform_sim_temperature_set(int8_t temperature);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_PLATFORM_SIM_H_ */
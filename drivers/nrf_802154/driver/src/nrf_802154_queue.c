@@ -40,7 +40,7 @@
 
 #include "nrf_802154_queue.h"
 
-static inline uint8_t increment_modulo(uint8_t v, uint8_t wrap_at_value)
+static inline uint16_t increment_modulo(uint16_t v, uint16_t wrap_at_value)
 {
     v++;
 
@@ -75,8 +75,8 @@ void nrf_802154_queue_init(nrf_802154_queue_t * p_queue,
      * see nrf_802154_queue_is_empty and nrf_802154_queue_is_full */
     NRF_802154_ASSERT(capacity >= 2U);
 
-    /* Due uint8_t type of nrf_802154_queue_t::capacity */
-    NRF_802154_ASSERT(capacity <= UINT8_MAX);
+    /* Due uint16_t type of nrf_802154_queue_t::capacity */
+    NRF_802154_ASSERT(capacity <= UINT16_MAX);
 
     p_queue->p_memory  = p_memory;
     p_queue->capacity  = capacity;
@@ -48,19 +48,19 @@ typedef struct
 {
     /**@brief Pointer to items memory of the queue.
      * @details Memory pointed by this pointer has size @c item_size * @c capacity. */
-    void           * p_memory;
+    void            * p_memory;
 
     /**@brief Size of an item in the queue. */
-    uint8_t          item_size;
+    uint8_t           item_size;
 
     /**@brief Maximum number of items that can be stored in the memory of the queue */
-    uint8_t          capacity;
+    uint16_t          capacity;
 
     /**@brief Index in the items memory of the queue where next item is written. */
-    volatile uint8_t wridx;
+    volatile uint16_t wridx;
 
     /**@brief Index in the items memory of the queue where next item is read. */
-    volatile uint8_t rdidx;
+    volatile uint16_t rdidx;
 } nrf_802154_queue_t;
 
 /**@brief Initializes a queue.
@@ -123,6 +123,22 @@ bool nrf_802154_request_ack_timeout_handle(const nrf_802154_ack_timeout_handle_p
  */
 bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us);
 
+#if NRF_802154_ED_SWEEP_ENABLED
+
+/**
+ * @brief Requests entering the @ref RADIO_STATE_ED state to perform the energy detection sweep.
+ *
+ * @param[in]  term_lvl  Termination level of this request. Selects procedures to abort.
+ * @param[in]  p_params  Pointer to the valid parameters of the sweep.
+ *
+ * @retval  true   The driver will enter energy detection state.
+ * @retval  false  The driver cannot enter the energy detection state due to an ongoing operation.
+ */
+bool nrf_802154_request_energy_detection_sweep(nrf_802154_term_t                    term_lvl,
+                                               const nrf_802154_ed_sweep_params_t * p_params);
+
+#endif // NRF_802154_ED_SWEEP_ENABLED
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_CCA state.
  *
@@ -268,6 +284,108 @@ bool nrf_802154_request_receive_at_cancel(uint32_t id);
 bool nrf_802154_request_csma_ca_start(uint8_t                                      * p_data,
                                       const nrf_802154_transmit_csma_ca_metadata_t * p_metadata);
 
+/**
+ * @brief Requests entering the @ref RADIO_STATE_SLEEP state without waiting for the result.
+ *
+ * Asynchronous requests are queued and processed after the synchronous ones, even if they are
+ * called from a context with a priority high enough to call the core module directly. The
+ * completion function is called from the context processing the request, which is the SWI
+ * priority for @ref NRF_802154_REQUEST_IMPL_SWI and the caller context for
+ * @ref NRF_802154_REQUEST_IMPL_DIRECT.
+ *
+ * @param[in]  term_lvl   Termination level of this request. Selects procedures to abort.
+ * @param[in]  done       Function called with the result of the request. May be NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   The request was queued.
+ * @retval  false  The queue of asynchronous requests is full.
+ */
+bool nrf_802154_request_sleep_async(nrf_802154_term_t       term_lvl,
+                                    nrf_802154_async_done_t done,
+                                    void                  * p_context);
+
+/**
+ * @brief Requests entering the @ref RADIO_STATE_RX state without waiting for the result.
+ *
+ * See @ref nrf_802154_request_sleep_async for the rules of asynchronous requests.
+ *
+ * @param[in]  term_lvl         Termination level of this request. Selects procedures to abort.
+ * @param[in]  req_orig         Module that originates this request.
+ * @param[in]  notify_function  Function called to notify the status of this procedure. May be NULL.
+ * @param[in]  notify_abort     If the abort notification is to be triggered automatically.
+ * @param[in]  id               Identifier of a reception window.
+ * @param[in]  done             Function called with the result of the request. May be NULL.
+ * @param[in]  p_context        Context passed to @p done.
+ *
+ * @retval  true   The request was queued.
+ * @retval  false  The queue of asynchronous requests is full.
+ */
+bool nrf_802154_request_receive_async(nrf_802154_term_t              term_lvl,
+                                      req_originator_t               req_orig,
+                                      nrf_802154_notification_func_t notify_function,
+                                      bool                           notify_abort,
+                                      uint32_t                       id,
+                                      nrf_802154_async_done_t        done,
+                                      void                         * p_context);
+
+/**
+ * @brief Requests the driver to free the given buffer without waiting for the result.
+ *
+ * See @ref nrf_802154_request_sleep_async for the rules of asynchronous requests.
+ *
+ * @param[in]  p_data     Pointer to the buffer to be freed.
+ * @param[in]  done       Function called with the result of the request. May be NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   The request was queued.
+ * @retval  false  The queue of asynchronous requests is full.
+ */
+bool nrf_802154_request_buffer_free_async(uint8_t               * p_data,
+                                          nrf_802154_async_done_t done,
+                                          void                  * p_context);
+
+#if NRF_802154_DELAYED_TRX_ENABLED
+/**
+ * @brief Requests a call to @ref nrf_802154_delayed_trx_receive without waiting for the result.
+ *
+ * See @ref nrf_802154_request_sleep_async for the rules of asynchronous requests.
+ *
+ * @param[in]  rx_time    Absolute time used by the SL Timer, in microseconds (us).
+ * @param[in]  timeout    Reception timeout (counted from @p rx_time), in microseconds (us).
+ * @param[in]  channel    Radio channel on which the frame is to be received.
+ * @param[in]  id         Identifier of the scheduled reception window.
+ * @param[in]  done       Function called with the result of the request. May be NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   The request was queued.
+ * @retval  false  The queue of asynchronous requests is full.
+ */
+bool nrf_802154_request_receive_at_async(uint64_t                rx_time,
+                                         uint32_t                timeout,
+                                         uint8_t                 channel,
+                                         uint32_t                id,
+                                         nrf_802154_async_done_t done,
+                                         void                  * p_context);
+
+/**
+ * @brief Requests a call to @ref nrf_802154_delayed_trx_receive_cancel without waiting for
+ *        the result.
+ *
+ * See @ref nrf_802154_request_sleep_async for the rules of asynchronous requests.
+ *
+ * @param[in]  id         Identifier of the delayed reception window to be cancelled.
+ * @param[in]  done       Function called with the result of the request. May be NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @retval  true   The request was queued.
+ * @retval  false  The queue of asynchronous requests is full.
+ */
+bool nrf_802154_request_receive_at_cancel_async(uint32_t                id,
+                                                nrf_802154_async_done_t done,
+                                                void                  * p_context);
+
+#endif // NRF_802154_DELAYED_TRX_ENABLED
+
 /**
  *@}
  **/
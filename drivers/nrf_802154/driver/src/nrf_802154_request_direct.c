@@ -57,6 +57,18 @@
                                                \
     return result;
 
+#define REQUEST_FUNCTION_ASYNC(done, p_context, func_core, ...) \
+    bool result;                                               \
+                                                               \
+    result = func_core(__VA_ARGS__);                           \
+                                                               \
+    if (done != NULL)                                          \
+    {                                                          \
+        done(result, p_context);                               \
+    }                                                          \
+                                                               \
+    return true;
+
 #define REQUEST_FUNCTION(func_core) \
     bool result;                    \
                                     \
@@ -112,6 +124,16 @@ bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl, uint32_t ti
     REQUEST_FUNCTION_PARMS(nrf_802154_core_energy_detection, term_lvl, time_us)
 }
 
+#if NRF_802154_ED_SWEEP_ENABLED
+
+bool nrf_802154_request_energy_detection_sweep(nrf_802154_term_t                    term_lvl,
+                                               const nrf_802154_ed_sweep_params_t * p_params)
+{
+    REQUEST_FUNCTION_PARMS(nrf_802154_core_energy_detection_sweep, term_lvl, p_params)
+}
+
+#endif // NRF_802154_ED_SWEEP_ENABLED
+
 bool nrf_802154_request_cca(nrf_802154_term_t term_lvl)
 {
     REQUEST_FUNCTION_PARMS(nrf_802154_core_cca, term_lvl)
@@ -201,4 +223,62 @@ bool nrf_802154_request_csma_ca_start(uint8_t
     REQUEST_FUNCTION_PARMS(nrf_802154_csma_ca_start, p_data, p_metadata);
 }
 
+bool nrf_802154_request_sleep_async(nrf_802154_term_t       term_lvl,
+                                    nrf_802154_async_done_t done,
+                                    void                  * p_context)
+{
+    REQUEST_FUNCTION_ASYNC(done, p_context, nrf_802154_core_sleep, term_lvl)
+}
+
+bool nrf_802154_request_receive_async(nrf_802154_term_t              term_lvl,
+                                      req_originator_t               req_orig,
+                                      nrf_802154_notification_func_t notify_function,
+                                      bool                           notify_abort,
+                                      uint32_t                       id,
+                                      nrf_802154_async_done_t        done,
+                                      void                         * p_context)
+{
+    REQUEST_FUNCTION_ASYNC(done,
+                           p_context,
+                           nrf_802154_core_receive,
+                           term_lvl,
+                           req_orig,
+                           notify_function,
+                           notify_abort,
+                           id)
+}
+
+bool nrf_802154_request_buffer_free_async(uint8_t               * p_data,
+                                          nrf_802154_async_done_t done,
+                                          void                  * p_context)
+{
+    REQUEST_FUNCTION_ASYNC(done, p_context, nrf_802154_core_notify_buffer_free, p_data)
+}
+
+#if NRF_802154_DELAYED_TRX_ENABLED
+bool nrf_802154_request_receive_at_async(uint64_t                rx_time,
+                                         uint32_t                timeout,
+                                         uint8_t                 channel,
+                                         uint32_t                id,
+                                         nrf_802154_async_done_t done,
+                                         void                  * p_context)
+{
+    REQUEST_FUNCTION_ASYNC(done,
+                           p_context,
+                           nrf_802154_delayed_trx_receive,
+                           rx_time,
+                           timeout,
+                           channel,
+                           id)
+}
+
+bool nrf_802154_request_receive_at_cancel_async(uint32_t                id,
+                                                nrf_802154_async_done_t done,
+                                                void                  * p_context)
+{
+    REQUEST_FUNCTION_ASYNC(done, p_context, nrf_802154_delayed_trx_receive_cancel, id)
+}
+
+#endif // NRF_802154_DELAYED_TRX_ENABLED
+
 #endif /* NRF_802154_REQUEST_IMPL == NRF_802154_REQUEST_IMPL_DIRECT */
@@ -80,6 +80,7 @@ typedef enum
     REQ_TYPE_TRANSMIT,
     REQ_TYPE_ACK_TIMEOUT_HANDLE,
     REQ_TYPE_ENERGY_DETECTION,
+    REQ_TYPE_ENERGY_DETECTION_SWEEP,
     REQ_TYPE_CCA,
     REQ_TYPE_CONTINUOUS_CARRIER,
     REQ_TYPE_MODULATED_CARRIER,
@@ -142,6 +143,15 @@ typedef struct
             uint32_t          time_us;  ///< Requested time of energy detection procedure.
         } energy_detection;             ///< Energy detection request details.
 
+#if NRF_802154_ED_SWEEP_ENABLED
+        struct
+        {
+            nrf_802154_term_t                    term_lvl; ///< Request priority.
+            bool                               * p_result; ///< Energy detection sweep request result.
+            const nrf_802154_ed_sweep_params_t * p_params; ///< Parameters of the energy detection sweep.
+        } energy_detection_sweep;                          ///< Energy detection sweep request details.
+#endif // NRF_802154_ED_SWEEP_ENABLED
+
         struct
         {
             nrf_802154_term_t term_lvl; ///< Request priority.
@@ -237,15 +247,37 @@ typedef struct
     } data;              ///< Request data depending on its type.
 } nrf_802154_req_data_t;
 
+/// Asynchronous request data in asynchronous request queue.
+typedef struct
+{
+    nrf_802154_req_data_t   req;       ///< Request data.
+    nrf_802154_async_done_t done;      ///< Function called with the result of the request.
+    void                  * p_context; ///< Context passed to @ref done.
+    bool                    result;    ///< Result of the request, pointed to by the request data.
+} nrf_802154_async_req_data_t;
+
 /**@brief Instance of a requests queue */
 static nrf_802154_queue_t m_requests_queue;
 
 /**@brief Memory holding requests queue items */
 static nrf_802154_req_data_t m_requests_queue_memory[REQ_QUEUE_SIZE];
 
+/**@brief Instance of an asynchronous requests queue */
+static nrf_802154_queue_t m_async_requests_queue;
+
+/**@brief Memory holding asynchronous requests queue items
+ *
+ * One item more than the configured size is needed, as the queue keeps one item empty.
+ */
+static nrf_802154_async_req_data_t m_async_requests_queue_memory[
+    NRF_802154_REQUEST_ASYNC_QUEUE_SIZE + 1];
+
 /**@brief State of the MCU critical section */
 static volatile nrf_802154_mcu_critical_state_t m_mcu_cs;
 
+/**@brief If an asynchronous request is being processed */
+static volatile bool m_async_req_processing;
+
 /**
  * Enter request block.
  *
@@ -278,17 +310,78 @@ static void req_exit(void)
     nrf_802154_mcu_critical_exit(m_mcu_cs);
 }
 
+/**
+ * Enter asynchronous request block.
+ *
+ * This is a helper function used in asynchronous request functions to atomically find an empty
+ * slot in the asynchronous request queue. Unlike @ref req_enter, a full queue is not an error.
+ * It is reported to the caller, which can retry the request after a pending one completes.
+ *
+ * @param[in]  done       Function called with the result of the request. May be NULL.
+ * @param[in]  p_context  Context passed to @p done.
+ *
+ * @return Pointer to an empty slot in the asynchronous request queue or NULL if the queue is full.
+ *         Unless NULL is returned, @ref async_req_exit must be called after the slot is filled.
+ */
+static nrf_802154_req_data_t * async_req_enter(nrf_802154_async_done_t done, void * p_context)
+{
+    nrf_802154_async_req_data_t * p_slot;
+
+    nrf_802154_mcu_critical_enter(m_mcu_cs);
+
+    if (nrf_802154_queue_is_full(&m_async_requests_queue))
+    {
+        nrf_802154_mcu_critical_exit(m_mcu_cs);
+        return NULL;
+    }
+
+    p_slot = (nrf_802154_async_req_data_t *)nrf_802154_queue_push_begin(&m_async_requests_queue);
+
+    p_slot->done      = done;
+    p_slot->p_context = p_context;
+
+    return &p_slot->req;
+}
+
+/**
+ * Exit asynchronous request block.
+ *
+ * Bursts of asynchronous requests queued while the SWI is pending or masked are processed
+ * in a single SWI invocation.
+ */
+static void async_req_exit(void)
+{
+    nrf_802154_queue_push_commit(&m_async_requests_queue);
+
+    nrf_egu_task_trigger(NRF_802154_EGU_INSTANCE, REQ_TASK);
+
+    nrf_802154_mcu_critical_exit(m_mcu_cs);
+}
+
+/**
+ * Get the location of the result of an asynchronous request.
+ *
+ * @param[in]  p_req  Pointer to the request data returned by @ref async_req_enter.
+ */
+static inline bool * async_req_result_ptr(nrf_802154_req_data_t * p_req)
+{
+    return &((nrf_802154_async_req_data_t *)p_req)->result;
+}
+
 /** Assert if SWI interrupt is disabled. */
 static inline void assert_interrupt_status(void)
 {
     NRF_802154_ASSERT(nrf_802154_irq_is_enabled(nrfx_get_irq_number(NRF_802154_EGU_INSTANCE)));
 }
 
+static void async_requests_process(void);
+
 #define REQUEST_FUNCTION(func_core, func_swi, ...) \
     bool result = false;                           \
                                                    \
     if (active_vector_priority_is_high())          \
     {                                              \
+        async_requests_process();                  \
         result = func_core(__VA_ARGS__);           \
     }                                              \
     else                                           \
@@ -304,6 +397,7 @@ static inline void assert_interrupt_status(void)
                                                       \
     if (active_vector_priority_is_high())             \
     {                                                 \
+        async_requests_process();                     \
         result = func_core();                         \
     }                                                 \
     else                                              \
@@ -439,6 +533,32 @@ static void swi_energy_detection(nrf_802154_term_t term_lvl,
     req_exit();
 }
 
+#if NRF_802154_ED_SWEEP_ENABLED
+
+/**
+ * @brief Requests entering the @ref RADIO_STATE_ED state to perform the energy detection sweep
+ *        from the SWI priority.
+ *
+ * @param[in]   term_lvl  Termination level of this request. Selects procedures to abort.
+ * @param[in]   p_params  Pointer to the parameters of the energy detection sweep.
+ * @param[out]  p_result  Result of entering the energy detection state.
+ */
+static void swi_energy_detection_sweep(nrf_802154_term_t                    term_lvl,
+                                       const nrf_802154_ed_sweep_params_t * p_params,
+                                       bool                               * p_result)
+{
+    nrf_802154_req_data_t * p_slot = req_enter();
+
+    p_slot->type                                 = REQ_TYPE_ENERGY_DETECTION_SWEEP;
+    p_slot->data.energy_detection_sweep.term_lvl = term_lvl;
+    p_slot->data.energy_detection_sweep.p_params = p_params;
+    p_slot->data.energy_detection_sweep.p_result = p_result;
+
+    req_exit();
+}
+
+#endif // NRF_802154_ED_SWEEP_ENABLED
+
 /**
  * @brief Requests entering the @ref RADIO_STATE_CCA state from the SWI priority.
  *
@@ -677,6 +797,11 @@ void nrf_802154_request_init(void)
                           sizeof(m_requests_queue_memory),
                           sizeof(m_requests_queue_memory[0]));
 
+    nrf_802154_queue_init(&m_async_requests_queue,
+                          m_async_requests_queue_memory,
+                          sizeof(m_async_requests_queue_memory),
+                          sizeof(m_async_requests_queue_memory[0]));
+
     nrf_egu_int_enable(NRF_802154_EGU_INSTANCE, REQ_INT);
 
     nrf_802154_swi_init();
@@ -731,6 +856,18 @@ bool nrf_802154_request_energy_detection(nrf_802154_term_t term_lvl,
                      time_us)
 }
 
+#if NRF_802154_ED_SWEEP_ENABLED
+bool nrf_802154_request_energy_detection_sweep(nrf_802154_term_t                    term_lvl,
+                                               const nrf_802154_ed_sweep_params_t * p_params)
+{
+    REQUEST_FUNCTION(nrf_802154_core_energy_detection_sweep,
+                     swi_energy_detection_sweep,
+                     term_lvl,
+                     p_params)
+}
+
+#endif // NRF_802154_ED_SWEEP_ENABLED
+
 bool nrf_802154_request_cca(nrf_802154_term_t term_lvl)
 {
     REQUEST_FUNCTION(nrf_802154_core_cca, swi_cca, term_lvl)
@@ -824,135 +961,336 @@ bool nrf_802154_request_csma_ca_start(uint8_t
 
 #endif // NRF_802154_DELAYED_TRX_ENABLED
 
-/**@brief Handles REQ_EVENT on NRF_802154_EGU_INSTANCE */
-static void irq_handler_req_event(void)
+bool nrf_802154_request_sleep_async(nrf_802154_term_t       term_lvl,
+                                    nrf_802154_async_done_t done,
+                                    void                  * p_context)
 {
-    while (!nrf_802154_queue_is_empty(&m_requests_queue))
+    assert_interrupt_status();
+
+    nrf_802154_req_data_t * p_slot = async_req_enter(done, p_context);
+
+    if (p_slot == NULL)
     {
-        nrf_802154_req_data_t * p_slot =
-            (nrf_802154_req_data_t *)nrf_802154_queue_pop_begin(&m_requests_queue);
+        return false;
+    }
 
-        switch (p_slot->type)
-        {
-            case REQ_TYPE_SLEEP:
-                *(p_slot->data.sleep.p_result) =
-                    nrf_802154_core_sleep(p_slot->data.sleep.term_lvl);
-                break;
-
-            case REQ_TYPE_RECEIVE:
-                *(p_slot->data.receive.p_result) =
-                    nrf_802154_core_receive(p_slot->data.receive.term_lvl,
-                                            p_slot->data.receive.req_orig,
-                                            p_slot->data.receive.notif_func,
-                                            p_slot->data.receive.notif_abort,
-                                            p_slot->data.receive.id);
-                break;
-
-            case REQ_TYPE_TRANSMIT:
-                *(p_slot->data.transmit.p_result) =
-                    nrf_802154_core_transmit(p_slot->data.transmit.term_lvl,
-                                             p_slot->data.transmit.req_orig,
-                                             p_slot->data.transmit.p_data,
-                                             p_slot->data.transmit.p_params,
-                                             p_slot->data.transmit.notif_func);
-                break;
-
-            case REQ_TYPE_ACK_TIMEOUT_HANDLE:
-                *(p_slot->data.ack_timeout_handle.p_result) =
-                    nrf_802154_core_ack_timeout_handle(p_slot->data.ack_timeout_handle.p_param);
-                break;
-
-            case REQ_TYPE_ENERGY_DETECTION:
-                *(p_slot->data.energy_detection.p_result) =
-                    nrf_802154_core_energy_detection(
-                        p_slot->data.energy_detection.term_lvl,
-                        p_slot->data.energy_detection.time_us);
-                break;
-
-            case REQ_TYPE_CCA:
-                *(p_slot->data.cca.p_result) = nrf_802154_core_cca(p_slot->data.cca.term_lvl);
-                break;
+    p_slot->type                = REQ_TYPE_SLEEP;
+    p_slot->data.sleep.term_lvl = term_lvl;
+    p_slot->data.sleep.p_result = async_req_result_ptr(p_slot);
+
+    async_req_exit();
+
+    return true;
+}
+
+bool nrf_802154_request_receive_async(nrf_802154_term_t              term_lvl,
+                                      req_originator_t               req_orig,
+                                      nrf_802154_notification_func_t notify_function,
+                                      bool                           notify_abort,
+                                      uint32_t                       id,
+                                      nrf_802154_async_done_t        done,
+                                      void                         * p_context)
+{
+    assert_interrupt_status();
+
+    nrf_802154_req_data_t * p_slot = async_req_enter(done, p_context);
+
+    if (p_slot == NULL)
+    {
+        return false;
+    }
+
+    p_slot->type                     = REQ_TYPE_RECEIVE;
+    p_slot->data.receive.term_lvl    = term_lvl;
+    p_slot->data.receive.req_orig    = req_orig;
+    p_slot->data.receive.notif_func  = notify_function;
+    p_slot->data.receive.notif_abort = notify_abort;
+    p_slot->data.receive.id          = id;
+    p_slot->data.receive.p_result    = async_req_result_ptr(p_slot);
+
+    async_req_exit();
+
+    return true;
+}
+
+bool nrf_802154_request_buffer_free_async(uint8_t               * p_data,
+                                          nrf_802154_async_done_t done,
+                                          void                  * p_context)
+{
+    assert_interrupt_status();
+
+    nrf_802154_req_data_t * p_slot = async_req_enter(done, p_context);
+
+    if (p_slot == NULL)
+    {
+        return false;
+    }
+
+    p_slot->type                      = REQ_TYPE_BUFFER_FREE;
+    p_slot->data.buffer_free.p_data   = p_data;
+    p_slot->data.buffer_free.p_result = async_req_result_ptr(p_slot);
+
+    async_req_exit();
+
+    return true;
+}
+
+#if NRF_802154_DELAYED_TRX_ENABLED
+bool nrf_802154_request_receive_at_async(uint64_t                rx_time,
+                                         uint32_t                timeout,
+                                         uint8_t                 channel,
+                                         uint32_t                id,
+                                         nrf_802154_async_done_t done,
+                                         void                  * p_context)
+{
+    assert_interrupt_status();
+
+    nrf_802154_req_data_t * p_slot = async_req_enter(done, p_context);
+
+    if (p_slot == NULL)
+    {
+        return false;
+    }
+
+    p_slot->type                     = REQ_TYPE_RECEIVE_AT;
+    p_slot->data.receive_at.rx_time  = rx_time;
+    p_slot->data.receive_at.timeout  = timeout;
+    p_slot->data.receive_at.channel  = channel;
+    p_slot->data.receive_at.id       = id;
+    p_slot->data.receive_at.p_result = async_req_result_ptr(p_slot);
+
+    async_req_exit();
+
+    return true;
+}
+
+bool nrf_802154_request_receive_at_cancel_async(uint32_t                id,
+                                                nrf_802154_async_done_t done,
+                                                void                  * p_context)
+{
+    assert_interrupt_status();
+
+    nrf_802154_req_data_t * p_slot = async_req_enter(done, p_context);
+
+    if (p_slot == NULL)
+    {
+        return false;
+    }
+
+    p_slot->type                            = REQ_TYPE_RECEIVE_AT_CANCEL;
+    p_slot->data.receive_at_cancel.id       = id;
+    p_slot->data.receive_at_cancel.p_result = async_req_result_ptr(p_slot);
+
+    async_req_exit();
+
+    return true;
+}
+
+#endif // NRF_802154_DELAYED_TRX_ENABLED
+
+/**
+ * @brief Processes a request taken from a request queue.
+ *
+ * @param[in]  p_slot  Pointer to the request data.
+ */
+static void req_process(nrf_802154_req_data_t * p_slot)
+{
+    switch (p_slot->type)
+    {
+        case REQ_TYPE_SLEEP:
+            *(p_slot->data.sleep.p_result) =
+                nrf_802154_core_sleep(p_slot->data.sleep.term_lvl);
+            break;
+
+        case REQ_TYPE_RECEIVE:
+            *(p_slot->data.receive.p_result) =
+                nrf_802154_core_receive(p_slot->data.receive.term_lvl,
+                                        p_slot->data.receive.req_orig,
+                                        p_slot->data.receive.notif_func,
+                                        p_slot->data.receive.notif_abort,
+                                        p_slot->data.receive.id);
+            break;
+
+        case REQ_TYPE_TRANSMIT:
+            *(p_slot->data.transmit.p_result) =
+                nrf_802154_core_transmit(p_slot->data.transmit.term_lvl,
+                                         p_slot->data.transmit.req_orig,
+                                         p_slot->data.transmit.p_data,
+                                         p_slot->data.transmit.p_params,
+                                         p_slot->data.transmit.notif_func);
+            break;
+
+        case REQ_TYPE_ACK_TIMEOUT_HANDLE:
+            *(p_slot->data.ack_timeout_handle.p_result) =
+                nrf_802154_core_ack_timeout_handle(p_slot->data.ack_timeout_handle.p_param);
+            break;
+
+        case REQ_TYPE_ENERGY_DETECTION:
+            *(p_slot->data.energy_detection.p_result) =
+                nrf_802154_core_energy_detection(
+                    p_slot->data.energy_detection.term_lvl,
+                    p_slot->data.energy_detection.time_us);
+            break;
+
+#if NRF_802154_ED_SWEEP_ENABLED
+        case REQ_TYPE_ENERGY_DETECTION_SWEEP:
+            *(p_slot->data.energy_detection_sweep.p_result) =
+                nrf_802154_core_energy_detection_sweep(
+                    p_slot->data.energy_detection_sweep.term_lvl,
+                    p_slot->data.energy_detection_sweep.p_params);
+            break;
+#endif // NRF_802154_ED_SWEEP_ENABLED
+
+        case REQ_TYPE_CCA:
+            *(p_slot->data.cca.p_result) = nrf_802154_core_cca(p_slot->data.cca.term_lvl);
+            break;
 
 #if NRF_802154_CARRIER_FUNCTIONS_ENABLED
 
-            case REQ_TYPE_CONTINUOUS_CARRIER:
-                *(p_slot->data.continuous_carrier.p_result) =
-                    nrf_802154_core_continuous_carrier(
-                        p_slot->data.continuous_carrier.term_lvl);
-                break;
+        case REQ_TYPE_CONTINUOUS_CARRIER:
+            *(p_slot->data.continuous_carrier.p_result) =
+                nrf_802154_core_continuous_carrier(
+                    p_slot->data.continuous_carrier.term_lvl);
+            break;
 
-            case REQ_TYPE_MODULATED_CARRIER:
-                *(p_slot->data.modulated_carrier.p_result) =
-                    nrf_802154_core_modulated_carrier(p_slot->data.modulated_carrier.term_lvl,
-                                                      p_slot->data.modulated_carrier.p_data);
-                break;
+        case REQ_TYPE_MODULATED_CARRIER:
+            *(p_slot->data.modulated_carrier.p_result) =
+                nrf_802154_core_modulated_carrier(p_slot->data.modulated_carrier.term_lvl,
+                                                  p_slot->data.modulated_carrier.p_data);
+            break;
 
 #endif // NRF_802154_CARRIER_FUNCTIONS_ENABLED
 
-            case REQ_TYPE_BUFFER_FREE:
-                *(p_slot->data.buffer_free.p_result) =
-                    nrf_802154_core_notify_buffer_free(p_slot->data.buffer_free.p_data);
-                break;
+        case REQ_TYPE_BUFFER_FREE:
+            *(p_slot->data.buffer_free.p_result) =
+                nrf_802154_core_notify_buffer_free(p_slot->data.buffer_free.p_data);
+            break;
 
-            case REQ_TYPE_CHANNEL_UPDATE:
-                *(p_slot->data.channel_update.p_result) =
-                    nrf_802154_core_channel_update(p_slot->data.channel_update.req_orig);
-                break;
+        case REQ_TYPE_CHANNEL_UPDATE:
+            *(p_slot->data.channel_update.p_result) =
+                nrf_802154_core_channel_update(p_slot->data.channel_update.req_orig);
+            break;
 
-            case REQ_TYPE_CCA_CFG_UPDATE:
-                *(p_slot->data.cca_cfg_update.p_result) = nrf_802154_core_cca_cfg_update();
-                break;
+        case REQ_TYPE_CCA_CFG_UPDATE:
+            *(p_slot->data.cca_cfg_update.p_result) = nrf_802154_core_cca_cfg_update();
+            break;
 
-            case REQ_TYPE_RSSI_MEASURE:
-                *(p_slot->data.rssi_measure.p_result) = nrf_802154_core_rssi_measure();
-                break;
+        case REQ_TYPE_RSSI_MEASURE:
+            *(p_slot->data.rssi_measure.p_result) = nrf_802154_core_rssi_measure();
+            break;
 
-            case REQ_TYPE_RSSI_GET:
-                *(p_slot->data.rssi_get.p_result) =
-                    nrf_802154_core_last_rssi_measurement_get(p_slot->data.rssi_get.p_rssi);
-                break;
+        case REQ_TYPE_RSSI_GET:
+            *(p_slot->data.rssi_get.p_result) =
+                nrf_802154_core_last_rssi_measurement_get(p_slot->data.rssi_get.p_rssi);
+            break;
 
-            case REQ_TYPE_ANTENNA_UPDATE:
-                *(p_slot->data.antenna_update.p_result) = nrf_802154_core_antenna_update();
-                break;
+        case REQ_TYPE_ANTENNA_UPDATE:
+            *(p_slot->data.antenna_update.p_result) = nrf_802154_core_antenna_update();
+            break;
 
 #if NRF_802154_DELAYED_TRX_ENABLED
-            case REQ_TYPE_TRANSMIT_AT:
-                *(p_slot->data.transmit_at.p_result) =
-                    nrf_802154_delayed_trx_transmit(p_slot->data.transmit_at.p_data,
-                                                    p_slot->data.transmit_at.tx_time,
-                                                    p_slot->data.transmit_at.p_metadata);
-                break;
-
-            case REQ_TYPE_TRANSMIT_AT_CANCEL:
-                *(p_slot->data.transmit_at_cancel.p_result) =
-                    nrf_802154_delayed_trx_transmit_cancel();
-                break;
-
-            case REQ_TYPE_RECEIVE_AT:
-                *(p_slot->data.receive_at.p_result) =
-                    nrf_802154_delayed_trx_receive(p_slot->data.receive_at.rx_time,
-                                                   p_slot->data.receive_at.timeout,
-                                                   p_slot->data.receive_at.channel,
-                                                   p_slot->data.receive_at.id);
-                break;
-
-            case REQ_TYPE_RECEIVE_AT_CANCEL:
-                *(p_slot->data.receive_at_cancel.p_result) =
-                    nrf_802154_delayed_trx_receive_cancel(p_slot->data.receive_at_cancel.id);
-                break;
-
-            case REQ_TYPE_CSMA_CA_START:
-                *(p_slot->data.csma_ca_start.p_result) =
-                    nrf_802154_csma_ca_start(p_slot->data.csma_ca_start.p_data,
-                                             p_slot->data.csma_ca_start.p_metadata);
-                break;
+        case REQ_TYPE_TRANSMIT_AT:
+            *(p_slot->data.transmit_at.p_result) =
+                nrf_802154_delayed_trx_transmit(p_slot->data.transmit_at.p_data,
+                                                p_slot->data.transmit_at.tx_time,
+                                                p_slot->data.transmit_at.p_metadata);
+            break;
+
+        case REQ_TYPE_TRANSMIT_AT_CANCEL:
+            *(p_slot->data.transmit_at_cancel.p_result) =
+                nrf_802154_delayed_trx_transmit_cancel();
+            break;
+
+        case REQ_TYPE_RECEIVE_AT:
+            *(p_slot->data.receive_at.p_result) =
+                nrf_802154_delayed_trx_receive(p_slot->data.receive_at.rx_time,
+                                               p_slot->data.receive_at.timeout,
+                                               p_slot->data.receive_at.channel,
+                                               p_slot->data.receive_at.id);
+            break;
+
+        case REQ_TYPE_RECEIVE_AT_CANCEL:
+            *(p_slot->data.receive_at_cancel.p_result) =
+                nrf_802154_delayed_trx_receive_cancel(p_slot->data.receive_at_cancel.id);
+            break;
+
+        case REQ_TYPE_CSMA_CA_START:
+            *(p_slot->data.csma_ca_start.p_result) =
+                nrf_802154_csma_ca_start(p_slot->data.csma_ca_start.p_data,
+                                         p_slot->data.csma_ca_start.p_metadata);
+            break;
 #endif // NRF_802154_DELAYED_TRX_ENABLED
 
-            default:
-                NRF_802154_ASSERT(false);
+        default:
+            NRF_802154_ASSERT(false);
+    }
+}
+
+/**
+ * @brief Processes the asynchronous requests queued so far.
+ *
+ * A request is claimed in a critical section, so that a direct request issued from a higher
+ * priority context cannot process it again. Such a direct request preempting the processing of
+ * an asynchronous request, or issued synchronously by it, does not wait for the remaining ones.
+ */
+static void async_requests_process(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    while (true)
+    {
+        nrf_802154_async_req_data_t * p_slot = NULL;
+
+        nrf_802154_mcu_critical_enter(mcu_cs);
+
+        if (!m_async_req_processing && !nrf_802154_queue_is_empty(&m_async_requests_queue))
+        {
+            p_slot = (nrf_802154_async_req_data_t *)nrf_802154_queue_pop_begin(
+                &m_async_requests_queue);
+            m_async_req_processing = true;
+        }
+
+        nrf_802154_mcu_critical_exit(mcu_cs);
+
+        if (p_slot == NULL)
+        {
+            break;
         }
 
+        nrf_802154_async_done_t done      = p_slot->done;
+        void                  * p_context = p_slot->p_context;
+
+        req_process(&p_slot->req);
+
+        bool result = p_slot->result;
+
+        // Release the slot first, so that the completion function can queue another request.
+        nrf_802154_mcu_critical_enter(mcu_cs);
+        nrf_802154_queue_pop_commit(&m_async_requests_queue);
+        m_async_req_processing = false;
+        nrf_802154_mcu_critical_exit(mcu_cs);
+
+        if (done != NULL)
+        {
+            done(result, p_context);
+        }
+    }
+}
+
+/**@brief Handles REQ_EVENT on NRF_802154_EGU_INSTANCE */
+static void irq_handler_req_event(void)
+{
+    // Asynchronous requests queued before a synchronous request of the same context are
+    // processed first. No new synchronous request can be queued while this handler runs.
+    async_requests_process();
+
+    while (!nrf_802154_queue_is_empty(&m_requests_queue))
+    {
+        nrf_802154_req_data_t * p_slot =
+            (nrf_802154_req_data_t *)nrf_802154_queue_pop_begin(&m_requests_queue);
+
+        req_process(p_slot);
+
         nrf_802154_queue_pop_commit(&m_requests_queue);
     }
 }
@@ -33,54 +33,404 @@
  */
 
 #include <stddef.h>
+#include <string.h>
 
 #include "nrf_802154.h"
 #include "nrf_802154_stats.h"
 
 #define NUMBER_OF_STAT_COUNTERS (sizeof(nrf_802154_stat_counters_t) / sizeof(uint32_t))
 
+#define CCA_FIRST_CHANNEL       11U ///< Channel counted in the first element of CCA histograms.
+#define SNAPSHOT_READ_ATTEMPTS  4U  ///< Number of lock-free attempts to read the statistics.
+
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+/**@brief Number of histogram bins preceding the source table. */
+#define NUMBER_OF_STAT_BINS     (offsetof(nrf_802154_stat_histograms_t, rx_sources) / \
+                                 sizeof(uint32_t))
+
+/**@brief Number of bins of a source table entry. */
+#define NUMBER_OF_RX_SOURCE_BINS                                         \
+    ((sizeof(nrf_802154_stat_rx_source_t) -                              \
+      offsetof(nrf_802154_stat_rx_source_t, frames)) / sizeof(uint32_t))
+#endif
+
 /**@brief Structure holding statistics about the Radio Driver behavior. */
-volatile nrf_802154_stats_t g_nrf_802154_stats;
+volatile nrf_802154_stat_totals_t g_nrf_802154_stat_totals;
+
+/**@brief Structure holding time stamps of the Radio Driver events. */
+volatile nrf_802154_stat_timestamps_t g_nrf_802154_stat_timestamps;
+
+/**@brief Counter values reported as 0 by the legacy counters API. */
+static nrf_802154_stat_counters_t m_legacy_base;
+
+/**@brief Statistics at the moment the previous snapshot was taken. */
+static nrf_802154_stat_totals_t m_snapshot_base;
+
+/**@brief Flag indicating that a snapshot is being taken. */
+static volatile bool m_snapshot_in_progress;
+
+/**@brief Computes differences between two arrays of counters.
+ *
+ * @param[out] p_delta    Array to be filled with the differences. It may be the same as
+ *                        @p p_current or @p p_base.
+ * @param[in]  p_current  Current counter values.
+ * @param[in]  p_base     Counter values to subtract.
+ * @param[in]  count      Number of counters.
+ */
+static void counters_delta_get(uint32_t       * p_delta,
+                               const uint32_t * p_current,
+                               const uint32_t * p_base,
+                               size_t           count)
+{
+    for (size_t i = 0; i < count; i++)
+    {
+        p_delta[i] = p_current[i] - p_base[i];
+    }
+}
+
+/**@brief Gets the legacy counters.
+ *
+ * @note This function must be called from a critical section.
+ */
+static void legacy_counters_get(nrf_802154_stat_counters_t * p_stat_counters)
+{
+    *p_stat_counters = g_nrf_802154_stat_totals.totals.counters;
+    counters_delta_get((uint32_t *)p_stat_counters,
+                       (const uint32_t *)p_stat_counters,
+                       (const uint32_t *)&m_legacy_base,
+                       NUMBER_OF_STAT_COUNTERS);
+}
 
 void nrf_802154_stats_get(nrf_802154_stats_t * p_stats)
 {
-    *p_stats = g_nrf_802154_stats;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    legacy_counters_get(&p_stats->counters);
+    p_stats->timestamps = g_nrf_802154_stat_timestamps;
+    nrf_802154_mcu_critical_exit(mcu_cs);
 }
 
 void nrf_802154_stat_counters_get(nrf_802154_stat_counters_t * p_stat_counters)
 {
-    *p_stat_counters = g_nrf_802154_stats.counters;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    legacy_counters_get(p_stat_counters);
+    nrf_802154_mcu_critical_exit(mcu_cs);
 }
 
 void nrf_802154_stat_counters_subtract(const nrf_802154_stat_counters_t * p_stat_counters)
 {
-    volatile uint32_t * p_dst = (volatile uint32_t *)(&g_nrf_802154_stats.counters);
-    const uint32_t    * p_src = (const uint32_t *)p_stat_counters;
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    uint32_t       * p_dst = (uint32_t *)&m_legacy_base;
+    const uint32_t * p_src = (const uint32_t *)p_stat_counters;
 
     for (size_t i = 0; i < NUMBER_OF_STAT_COUNTERS; ++i)
     {
-        nrf_802154_mcu_critical_state_t mcu_cs;
+        *(p_dst++) += *(p_src++);
+    }
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_stat_timestamps_get(nrf_802154_stat_timestamps_t * p_stat_timestamps)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
 
-        nrf_802154_mcu_critical_enter(mcu_cs);
-        *p_dst -= *p_src;
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    *p_stat_timestamps = g_nrf_802154_stat_timestamps;
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_stat_counters_reset(void)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    m_legacy_base = g_nrf_802154_stat_totals.totals.counters;
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+/**@brief Reads all counters and histograms as they were at a single instant.
+ *
+ * The statistics are copied and the copy is compared with them. As they only change when an
+ * entry of the source table is replaced or when they grow, a match means that no update hit
+ * any of them between the copy and the comparison, so the copy holds their values at a point
+ * in between. If updates keep hitting the copy, it is made from a critical section instead.
+ *
+ * @param[out] p_totals  Structure to be filled with the statistics.
+ */
+static void totals_read(nrf_802154_stat_totals_t * p_totals)
+{
+    // The words are accessed one by one through volatile pointers, so that the compiler neither
+    // merges the comparison with the copy nor drops it.
+    const volatile uint32_t * p_src = (const volatile uint32_t *)&g_nrf_802154_stat_totals;
+    uint32_t                * p_dst = (uint32_t *)p_totals;
+    size_t                    count = sizeof(nrf_802154_stat_totals_t) / sizeof(uint32_t);
+
+    for (uint32_t attempt = 0; attempt < SNAPSHOT_READ_ATTEMPTS; attempt++)
+    {
+        size_t i;
+
+        for (i = 0; i < count; i++)
+        {
+            p_dst[i] = p_src[i];
+        }
+
+        for (i = 0; i < count; i++)
+        {
+            if (p_dst[i] != p_src[i])
+            {
+                break;
+            }
+        }
+
+        if (i == count)
+        {
+            return;
+        }
+    }
+
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    memcpy(p_totals, (const void *)&g_nrf_802154_stat_totals, sizeof(*p_totals));
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+bool nrf_802154_stat_snapshot_take(nrf_802154_stat_snapshot_t * p_snapshot)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (m_snapshot_in_progress)
+    {
         nrf_802154_mcu_critical_exit(mcu_cs);
+        return false;
+    }
+
+    m_snapshot_in_progress = true;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    // Only this function accesses the snapshot baseline. The previous one is kept in the output
+    // structure while the new one is read in its place.
+    nrf_802154_stat_totals_t * p_base = &m_snapshot_base;
+
+    *p_snapshot = p_base->totals;
+
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+    uint32_t generations[NRF_802154_STATS_RX_SOURCES_NUM];
+
+    memcpy(generations, p_base->rx_source_generations, sizeof(generations));
+#endif
+
+    totals_read(p_base);
+
+    counters_delta_get((uint32_t *)&p_snapshot->counters,
+                       (const uint32_t *)&p_base->totals.counters,
+                       (const uint32_t *)&p_snapshot->counters,
+                       NUMBER_OF_STAT_COUNTERS);
+
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+    nrf_802154_stat_histograms_t * p_histograms = &p_snapshot->histograms;
+
+    counters_delta_get((uint32_t *)p_histograms,
+                       (const uint32_t *)&p_base->totals.histograms,
+                       (const uint32_t *)p_histograms,
+                       NUMBER_OF_STAT_BINS);
 
-        p_dst++;
-        p_src++;
+    for (uint32_t i = 0; i < NRF_802154_STATS_RX_SOURCES_NUM; i++)
+    {
+        nrf_802154_stat_rx_source_t       * p_entry   = &p_histograms->rx_sources[i];
+        const nrf_802154_stat_rx_source_t * p_current = &p_base->totals.histograms.rx_sources[i];
+
+        if (generations[i] != p_base->rx_source_generations[i])
+        {
+            // The entry was assigned to another source, which was counted from 0.
+            *p_entry = *p_current;
+        }
+        else
+        {
+            counters_delta_get(&p_entry->frames,
+                               &p_current->frames,
+                               &p_entry->frames,
+                               NUMBER_OF_RX_SOURCE_BINS);
+        }
+
+        if (p_entry->frames == 0U)
+        {
+            // Report only the sources heard since the previous snapshot.
+            memset(p_entry, 0, sizeof(*p_entry));
+        }
     }
+#endif
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    m_snapshot_in_progress = false;
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    return true;
 }
 
-void nrf_802154_stat_timestamps_get(nrf_802154_stat_timestamps_t * p_stat_timestamps)
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+
+/**@brief Gets index of the RSSI histogram bin. */
+static uint8_t rssi_bin_get(int8_t rssi)
 {
-    *p_stat_timestamps = g_nrf_802154_stats.timestamps;
+    int32_t bin = 0;
+
+    if (rssi >= NRF_802154_STAT_RSSI_FIRST_BIN_UPPER_DBM)
+    {
+        bin = 1 + (rssi - NRF_802154_STAT_RSSI_FIRST_BIN_UPPER_DBM) / NRF_802154_STAT_RSSI_BIN_DBM;
+    }
+
+    return (bin < NRF_802154_STAT_RSSI_BINS) ? (uint8_t)bin : (NRF_802154_STAT_RSSI_BINS - 1);
 }
 
-void nrf_802154_stat_counters_reset(void)
+/**@brief Finds entry of the source table to record a frame from the given address.
+ *
+ * If the address is not in the table, a free entry is chosen. If there is no free entry, the one
+ * with the lowest number of frames is chosen.
+ *
+ * @note Only the driver modifies the source table, from its critical section, so the table can
+ *       be searched without masking interrupts.
+ *
+ * @param[in]  p_src_addr     Pointer to the source address.
+ * @param[in]  src_addr_size  Size of the source address.
+ * @param[out] p_found        Set to true if the address is already in the table.
+ *
+ * @return Index of the entry.
+ */
+static uint32_t rx_source_find(const uint8_t * p_src_addr, uint8_t src_addr_size, bool * p_found)
 {
-    volatile uint32_t * p_dst = (volatile uint32_t *)(&g_nrf_802154_stats.counters);
+    volatile nrf_802154_stat_rx_source_t * p_sources =
+        g_nrf_802154_stat_totals.totals.histograms.rx_sources;
+    uint32_t                               victim = NRF_802154_STATS_RX_SOURCES_NUM;
 
-    for (size_t i = 0; i < NUMBER_OF_STAT_COUNTERS; ++i)
+    for (uint32_t i = 0; i < NRF_802154_STATS_RX_SOURCES_NUM; i++)
+    {
+        volatile nrf_802154_stat_rx_source_t * p_entry = &p_sources[i];
+
+        if ((p_entry->addr_len == src_addr_size) &&
+            (memcmp((const void *)p_entry->addr, p_src_addr, src_addr_size) == 0))
+        {
+            *p_found = true;
+            return i;
+        }
+
+        if ((victim != NRF_802154_STATS_RX_SOURCES_NUM) && (p_sources[victim].addr_len == 0U))
+        {
+            // A free entry has already been found.
+            continue;
+        }
+
+        if ((victim == NRF_802154_STATS_RX_SOURCES_NUM) || (p_entry->addr_len == 0U) ||
+            (p_entry->frames < p_sources[victim].frames))
+        {
+            victim = i;
+        }
+    }
+
+    *p_found = false;
+    return victim;
+}
+
+void nrf_802154_stat_ack_turnaround_record(uint32_t turnaround_us)
+{
+    uint32_t bin = turnaround_us / NRF_802154_STAT_ACK_TURNAROUND_BIN_US;
+
+    if (bin >= NRF_802154_STAT_ACK_TURNAROUND_BINS)
     {
-        *(p_dst++) = 0U;
+        bin = NRF_802154_STAT_ACK_TURNAROUND_BINS - 1;
     }
+
+    g_nrf_802154_stat_totals.totals.histograms.ack_turnaround[bin]++;
 }
+
+void nrf_802154_stat_cca_record(uint8_t channel, bool busy)
+{
+    uint32_t idx = (uint32_t)channel - CCA_FIRST_CHANNEL;
+
+    if (idx >= NRF_802154_STAT_CCA_CHANNELS)
+    {
+        return;
+    }
+
+    g_nrf_802154_stat_totals.totals.histograms.cca_attempts[idx]++;
+
+    if (busy)
+    {
+        g_nrf_802154_stat_totals.totals.histograms.cca_busy[idx]++;
+    }
+}
+
+void nrf_802154_stat_csmaca_backoffs_record(uint8_t backoffs)
+{
+    uint32_t bin = backoffs;
+
+    if (bin >= NRF_802154_STAT_CSMACA_BACKOFFS_BINS)
+    {
+        bin = NRF_802154_STAT_CSMACA_BACKOFFS_BINS - 1;
+    }
+
+    g_nrf_802154_stat_totals.totals.histograms.csmaca_backoffs[bin]++;
+}
+
+void nrf_802154_stat_rx_source_record(const uint8_t * p_src_addr,
+                                      uint8_t         src_addr_size,
+                                      int8_t          rssi,
+                                      uint8_t         lqi)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    uint8_t                         rssi_bin = rssi_bin_get(rssi);
+    uint8_t                         lqi_bin  = lqi / NRF_802154_STAT_LQI_BIN;
+    uint32_t                        idx;
+    bool                            found;
+
+    if ((p_src_addr == NULL) || (src_addr_size == 0U) || (src_addr_size > 8U))
+    {
+        return;
+    }
+
+    if (lqi_bin >= NRF_802154_STAT_LQI_BINS)
+    {
+        lqi_bin = NRF_802154_STAT_LQI_BINS - 1;
+    }
+
+    idx = rx_source_find(p_src_addr, src_addr_size, &found);
+
+    volatile nrf_802154_stat_histograms_t * p_histograms =
+        &g_nrf_802154_stat_totals.totals.histograms;
+    volatile nrf_802154_stat_rx_source_t  * p_entry = &p_histograms->rx_sources[idx];
+
+    // The entry is updated from a critical section only to keep a snapshot taken from
+    // a preempting interrupt consistent.
+    nrf_802154_mcu_critical_enter(mcu_cs);
+
+    if (!found)
+    {
+        if (p_entry->addr_len != 0U)
+        {
+            p_histograms->rx_sources_replaced++;
+        }
+
+        memset((void *)p_entry, 0, sizeof(nrf_802154_stat_rx_source_t));
+        memcpy((void *)p_entry->addr, p_src_addr, src_addr_size);
+        p_entry->addr_len = src_addr_size;
+        g_nrf_802154_stat_totals.rx_source_generations[idx]++;
+    }
+
+    p_entry->frames++;
+    p_entry->rssi[rssi_bin]++;
+    p_entry->lqi[lqi_bin]++;
+
+    nrf_802154_mcu_critical_exit(mcu_cs);
+}
+
+#endif // NRF_802154_STATS_HISTOGRAMS_ENABLED
@@ -38,23 +38,48 @@
 #include "nrf_802154_types.h"
 #include "nrf_802154_utils.h"
 
+/**@brief Statistics collected since the initialization of the driver.
+ *
+ * Counters and histograms only grow. They are updated by the driver while it holds its critical
+ * section, so that updates never overlap and each one is a plain store. Readers never write them;
+ * the legacy counters API and snapshots report differences from their own baselines instead.
+ */
+typedef struct
+{
+    /**@brief Counters and histograms. */
+    nrf_802154_stat_snapshot_t totals;
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+    /**@brief Number of times each entry of the source table was assigned to a source. */
+    uint32_t                   rx_source_generations[NRF_802154_STATS_RX_SOURCES_NUM];
+#endif
+} nrf_802154_stat_totals_t;
+
 #if !defined(TEST)
 // Don't use directly. Use provided nrf_802154_stat_xxxx API macros.
-extern volatile nrf_802154_stats_t g_nrf_802154_stats;
+extern volatile nrf_802154_stat_totals_t     g_nrf_802154_stat_totals;
+extern volatile nrf_802154_stat_timestamps_t g_nrf_802154_stat_timestamps;
 
 /**@brief Increment one of the @ref nrf_802154_stat_counters_t fields.
  *
  * @param field_name    Identifier of struct member to increment
  */
-#define nrf_802154_stat_counter_increment(field_name) \
-    do                                                \
-    {                                                 \
-        nrf_802154_mcu_critical_state_t mcu_cs;       \
-                                                      \
-        nrf_802154_mcu_critical_enter(mcu_cs);        \
-        (g_nrf_802154_stats.counters.field_name)++;   \
-        nrf_802154_mcu_critical_exit(mcu_cs);         \
-    }                                                 \
+#define nrf_802154_stat_counter_increment(field_name)            \
+    do                                                           \
+    {                                                            \
+        (g_nrf_802154_stat_totals.totals.counters.field_name)++; \
+    }                                                            \
+    while (0)
+
+/**@brief Add a value to one of the @ref nrf_802154_stat_counters_t fields.
+ *
+ * @param field_name    Identifier of struct member to add to
+ * @param value         Value to add
+ */
+#define nrf_802154_stat_counter_add(field_name, value)                    \
+    do                                                                    \
+    {                                                                     \
+        (g_nrf_802154_stat_totals.totals.counters.field_name) += (value); \
+    }                                                                     \
     while (0)
 
 /**@brief Write one of the @ref nrf_802154_stat_timestamps_t fields.
@@ -62,34 +87,37 @@ extern volatile nrf_802154_stats_t g_nrf_802154_stats;
  * @param field_name    Identifier of struct member to write
  * @param value         Value to write
  */
-#define nrf_802154_stat_timestamp_write(field_name, value)    \
-    do                                                        \
-    {                                                         \
-        nrf_802154_mcu_critical_state_t mcu_cs;               \
-                                                              \
-        nrf_802154_mcu_critical_enter(mcu_cs);                \
-        (g_nrf_802154_stats.timestamps.field_name) = (value); \
-        nrf_802154_mcu_critical_exit(mcu_cs);                 \
-    }                                                         \
+#define nrf_802154_stat_timestamp_write(field_name, value)   \
+    do                                                       \
+    {                                                        \
+        nrf_802154_mcu_critical_state_t mcu_cs;              \
+                                                             \
+        nrf_802154_mcu_critical_enter(mcu_cs);               \
+        (g_nrf_802154_stat_timestamps.field_name) = (value); \
+        nrf_802154_mcu_critical_exit(mcu_cs);                \
+    }                                                        \
     while (0)
 
 /**@brief Read one of the @ref nrf_802154_stat_timestamps_t fields. */
-#define nrf_802154_stat_timestamp_read(variable, field_name)    \
-    do                                                          \
-    {                                                           \
-        nrf_802154_mcu_critical_state_t mcu_cs;                 \
-                                                                \
-        nrf_802154_mcu_critical_enter(mcu_cs);                  \
-        *(variable) = g_nrf_802154_stats.timestamps.field_name; \
-        nrf_802154_mcu_critical_exit(mcu_cs);                   \
-    }                                                           \
+#define nrf_802154_stat_timestamp_read(variable, field_name)   \
+    do                                                         \
+    {                                                          \
+        nrf_802154_mcu_critical_state_t mcu_cs;                \
+                                                               \
+        nrf_802154_mcu_critical_enter(mcu_cs);                 \
+        *(variable) = g_nrf_802154_stat_timestamps.field_name; \
+        nrf_802154_mcu_critical_exit(mcu_cs);                  \
+    }                                                          \
     while (0)
 
 #else // !defined(TEST)
 
-#define nrf_802154_stat_counter_increment(field_name) \
+#define nrf_802154_stat_counter_increment(field_name)                                        \
     nrf_802154_stat_counter_increment_func(offsetof(nrf_802154_stat_counters_t, field_name))
 
+#define nrf_802154_stat_counter_add(field_name, value)                                       \
+    nrf_802154_stat_counter_add_func(offsetof(nrf_802154_stat_counters_t, field_name), (value))
+
 #define nrf_802154_stat_timestamp_write(field_name, value)                                   \
     nrf_802154_stat_timestamp_write_func(offsetof(nrf_802154_stat_timestamps_t, field_name), \
                                          (value))
@@ -100,9 +128,45 @@ extern volatile nrf_802154_stats_t g_nrf_802154_stats;
 
 // Functions for which mocks are generated.
 void nrf_802154_stat_counter_increment_func(size_t field_offset);
+void nrf_802154_stat_counter_add_func(size_t field_offset, uint32_t value);
 void nrf_802154_stat_timestamp_write_func(size_t field_offset, uint64_t value);
 uint64_t nrf_802154_stat_timestamp_read_func(size_t field_offset);
 
 #endif // !defined(TEST)
 
+#if NRF_802154_STATS_HISTOGRAMS_ENABLED
+
+/**@brief Records the time between the end of a transmitted frame and the start of its Ack.
+ *
+ * @param[in]  turnaround_us  Turnaround time in microseconds.
+ */
+void nrf_802154_stat_ack_turnaround_record(uint32_t turnaround_us);
+
+/**@brief Records the result of a CCA attempt.
+ *
+ * @param[in]  channel  Channel on which CCA was performed.
+ * @param[in]  busy     If the channel was found busy.
+ */
+void nrf_802154_stat_cca_record(uint8_t channel, bool busy);
+
+/**@brief Records the number of backoffs of a finished CSMA-CA procedure.
+ *
+ * @param[in]  backoffs  Number of times the procedure backed off.
+ */
+void nrf_802154_stat_csmaca_backoffs_record(uint8_t backoffs);
+
+/**@brief Records RSSI and LQI of a frame received from the given source address.
+ *
+ * @param[in]  p_src_addr     Pointer to the source address field of the frame.
+ * @param[in]  src_addr_size  Size of the source address: 2 or 8 bytes.
+ * @param[in]  rssi           RSSI of the frame in dBm.
+ * @param[in]  lqi            LQI of the frame.
+ */
+void nrf_802154_stat_rx_source_record(const uint8_t * p_src_addr,
+                                      uint8_t         src_addr_size,
+                                      int8_t          rssi,
+                                      uint8_t         lqi);
+
+#endif // NRF_802154_STATS_HISTOGRAMS_ENABLED
+
 #endif /* NRF_802154_STATS_H_ */
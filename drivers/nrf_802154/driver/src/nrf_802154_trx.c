@@ -36,6 +36,8 @@
 
 #include "nrf_802154_trx.h"
 
+#if !NRF_802154_TRX_SIM_ENABLED
+
 #include "nrf_802154_assert.h"
 #include <string.h>
 
@@ -237,6 +239,8 @@ static nrf_802154_flags_t m_flags; ///< Flags used to store the current driver s
 static volatile uint32_t m_timer_value_on_radio_end_event;
 static volatile bool     m_transmit_with_cca;
 static volatile uint8_t  m_remaining_cca_attempts;
+static bool              m_ed_keep_rx;    ///< If the receiver stays enabled after ED.
+static uint16_t          m_ed_frequency;  ///< Frequency the receiver is enabled at for ED.
 
 static void timer_frequency_set_1mhz(void);
 
@@ -1110,8 +1114,8 @@ static void rx_antenna_update(void)
 /**
  * Updates the antenna for transmission, according to antenna diversity configuration.
  *
- * Antenna diversity for tx is not currently supported. If antenna diversity is not
- * in disabled state, default antenna will always be used for transmission.
+ * Automatic antenna selection for tx is supported only if
+ * @ref NRF_802154_ANT_DIV_PEER_ANTENNA_ENABLED is set.
  */
 static void tx_antenna_update(void)
 {
@@ -1130,7 +1134,12 @@ static void tx_antenna_update(void)
                 nrf_802154_sl_ant_div_cfg_antenna_get(NRF_802154_SL_ANT_DIV_OP_TX));
             break;
 
+#if NRF_802154_ANT_DIV_PEER_ANTENNA_ENABLED
         case NRF_802154_SL_ANT_DIV_MODE_AUTO:
+            nrf_802154_sl_ant_div_tx_started_notify();
+            break;
+#endif
+
         default:
             NRF_802154_ASSERT(false);
             break;
@@ -2262,13 +2271,13 @@ static void modulated_carrier_abort()
 
 #endif // NRF_802154_CARRIER_FUNCTIONS_ENABLED
 
-void nrf_802154_trx_energy_detection(uint32_t ed_count)
+static void energy_detection_start(uint32_t ed_count, bool keep_rx)
 {
-    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
-
     NRF_802154_ASSERT((m_trx_state == TRX_STATE_FINISHED) || (m_trx_state == TRX_STATE_IDLE));
 
-    m_trx_state = TRX_STATE_ENERGY_DETECTION;
+    m_trx_state    = TRX_STATE_ENERGY_DETECTION;
+    m_ed_keep_rx   = keep_rx;
+    m_ed_frequency = nrf_radio_frequency_get(NRF_RADIO);
 
     ed_count--;
     /* Check that vd_count will fit into defined bits of register */
@@ -2295,6 +2304,55 @@ void nrf_802154_trx_energy_detection(uint32_t ed_count)
     nrf_802154_trx_ppi_for_ramp_up_set(NRF_RADIO_TASK_RXEN, TRX_RAMP_UP_SW_TRIGGER, false);
 
     trigger_disable_to_start_rampup();
+}
+
+void nrf_802154_trx_energy_detection(uint32_t ed_count)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    energy_detection_start(ed_count, false);
+
+    nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+}
+
+void nrf_802154_trx_energy_detection_sample(uint32_t ed_count)
+{
+    nrf_802154_log_function_enter(NRF_802154_LOG_VERBOSITY_LOW);
+
+    if (m_trx_state != TRX_STATE_ENERGY_DETECTION)
+    {
+        energy_detection_start(ed_count, true);
+
+        nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
+        return;
+    }
+
+    // The receiver is idle since the previous sample ended
+    NRF_802154_ASSERT(m_ed_keep_rx);
+
+    ed_count--;
+#if defined(RADIO_EDCNT_EDCNT_Msk)
+    NRF_802154_ASSERT( (ed_count & (~RADIO_EDCNT_EDCNT_Msk)) == 0U);
+#endif
+
+    nrf_radio_ed_loop_count_set(NRF_RADIO, ed_count);
+    nrf_radio_event_clear(NRF_RADIO, NRF_RADIO_EVENT_EDEND);
+
+    nrf_802154_trx_antenna_update();
+
+    if (nrf_radio_frequency_get(NRF_RADIO) == m_ed_frequency)
+    {
+        nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_EDSTART);
+    }
+    else
+    {
+        // The frequency is latched when the receiver is enabled. The receiver is retuned by
+        // enabling it again right after it is disabled, and the sample starts when it is ready.
+        m_ed_frequency = nrf_radio_frequency_get(NRF_RADIO);
+
+        nrf_radio_shorts_set(NRF_RADIO, SHORTS_ED | NRF_RADIO_SHORT_DISABLED_RXEN_MASK);
+        nrf_radio_task_trigger(NRF_RADIO, NRF_RADIO_TASK_DISABLE);
+    }
 
     nrf_802154_log_function_exit(NRF_802154_LOG_VERBOSITY_LOW);
 }
@@ -2831,8 +2889,16 @@ static void irq_handler_edend(void)
 
     uint8_t ed_sample = nrf_radio_ed_sample_get(NRF_RADIO);
 
-    energy_detection_finish();
-    m_trx_state = TRX_STATE_FINISHED;
+    if (m_ed_keep_rx)
+    {
+        // The receiver stays idle, ready for the next sample
+        nrf_radio_shorts_set(NRF_RADIO, SHORTS_IDLE);
+    }
+    else
+    {
+        energy_detection_finish();
+        m_trx_state = TRX_STATE_FINISHED;
+    }
 
     nrf_802154_trx_energy_detection_finished(ed_sample);
 
@@ -3054,3 +3120,5 @@ const nrf_802154_sl_event_handle_t * nrf_802154_trx_radio_phyend_event_handle_ge
 
     return &r;
 }
+
+#endif // !NRF_802154_TRX_SIM_ENABLED
@@ -440,6 +440,22 @@ void nrf_802154_trx_modulated_carrier_restart(void);
  */
 void nrf_802154_trx_energy_detection(uint32_t ed_count);
 
+/**@brief Puts trx module into energy detection mode and keeps the receiver enabled when it ends.
+ *
+ * Operation ends up with a call to @ref nrf_802154_trx_energy_detection_finished handler, with
+ * the trx module still in @c ENERGY_DETECTION state and the receiver idle. The next sample can
+ * then be started with another call to this function. On the same channel, it starts without
+ * a ramp-up. On a channel set with @ref nrf_802154_trx_channel_set in the meantime, the receiver
+ * is only retuned.
+ *
+ * Operation can be terminated with a call to @ref nrf_802154_trx_abort or @ref nrf_802154_trx_disable.
+ * In this case no handler is called. One of them must also be called after the last sample.
+ *
+ * @param ed_count  Number of iterations to perform. Must be in range 1..2097152.
+ *                  One iteration takes 128 microseconds.
+ */
+void nrf_802154_trx_energy_detection_sample(uint32_t ed_count);
+
 /**@brief Aborts currently performed operation.
  *
  * When trx module is in @c DISABLED, @c IDLE or @c FINISHED state, this function has no effect.
@@ -764,12 +780,16 @@ extern void nrf_802154_trx_standalone_cca_finished(bool channel_was_idle);
  *
  *  This handler is called from an ISR when:
  *  - energy detection operation was requested by a call to @ref nrf_802154_trx_energy_detection
+ *    or @ref nrf_802154_trx_energy_detection_sample
  *  - the RADIO peripheral finished the operation
  *
  * When this handler is called following holds:
  * - the RADIO peripheral started ramping down (or it ramped down already)
  * - trx module is in @c FINISHED state
  *
+ * If the operation was requested by @ref nrf_802154_trx_energy_detection_sample, the receiver is
+ * idle instead and the trx module stays in @c ENERGY_DETECTION state.
+ *
  * Implementation is responsible for leaving @c FINISHED state by a call to:
  * - @ref nrf_802154_trx_receive_frame,
  * - @ref nrf_802154_trx_transmit_frame,
@@ -35,8 +35,9 @@
 #define NRF_802154_MODULE_ID NRF_802154_DRV_MODULE_ID_TRX_PPI
 
 #include "nrfx.h"
+#include "nrf_802154_config.h"
 
-#ifdef NRF52_SERIES
+#if defined(NRF52_SERIES) && !NRF_802154_TRX_SIM_ENABLED
 
 #include "nrf_802154_trx_ppi_api.h"
 
@@ -316,4 +317,4 @@ void nrf_802154_trx_ppi_for_radio_sync_clear(nrf_egu_task_t task)
 
 #endif
 
-#endif // NRF52_SERIES
+#endif // defined(NRF52_SERIES) && !NRF_802154_TRX_SIM_ENABLED
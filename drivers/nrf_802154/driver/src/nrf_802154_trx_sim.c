@@ -0,0 +1,1025 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+#define NRF_802154_MODULE_ID NRF_802154_DRV_MODULE_ID_TRX
+
+#include "nrf_802154_trx.h"
+
+#if NRF_802154_TRX_SIM_ENABLED
+
+#include "nrf_802154_trx_sim.h"
+
+#include "nrf_802154_assert.h"
+#include <string.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_critical_section.h"
+#include "nrf_802154_irq_handlers.h"
+#include "nrf_802154_procedures_duration.h"
+
+#if NRF_802154_INTERNAL_RADIO_IRQ_HANDLING
+void nrf_802154_radio_irq_handler(void); ///< Prototype required when RADIO IRQ is handled internally
+#endif  // NRF_802154_INTERNAL_RADIO_IRQ_HANDLING
+
+#define SHR_PHR_TIME        PHY_US_TIME_FROM_SYMBOLS(PHY_SHR_SYMBOLS + \
+                                                     PHY_SYMBOLS_FROM_OCTETS(PHR_SIZE)) ///< Time from the first symbol of SHR to the first symbol of PSDU [us]
+#define ED_ITERATION_TIME   128UL                                                        ///< Duration of a single energy detection iteration [us]
+
+#define LOSS_SEED_DEFAULT   0x2545F491UL                                                 ///< Default seed of the packet loss generator
+#define RSSI_SAMPLE_DEFAULT 90U                                                          ///< Default raw RSSI sample (-90 dBm)
+#define ED_IDLE_DEFAULT     0U                                                           ///< Default raw ED sample when the channel is idle
+#define ED_BUSY_DEFAULT     0x40U                                                        ///< Default raw ED sample when a frame is on air
+
+#define SIM_EVENT_END       1UL                                                          ///< Identifier of the simulated RADIO END event
+#define SIM_EVENT_READY     2UL                                                          ///< Identifier of the simulated RADIO READY event
+#define SIM_EVENT_CRCOK     3UL                                                          ///< Identifier of the simulated RADIO CRCOK event
+#define SIM_EVENT_PHYEND    4UL                                                          ///< Identifier of the simulated RADIO PHYEND event
+#define SIM_EVENTS_NUM      5UL                                                          ///< Number of event identifiers, including the unused zero
+
+/**@brief Steps of the simulated radio operations. */
+typedef enum
+{
+    SIM_STEP_NONE,          ///< No radio event is pending.
+    SIM_STEP_RX_READY,      ///< Receiver ramped up and starts listening.
+    SIM_STEP_RX_ADDRESS,    ///< SHR and PHR of a received frame are on air.
+    SIM_STEP_RX_BCMATCH,    ///< Requested number of PSDU octets has been received.
+    SIM_STEP_RX_END,        ///< Last octet of a received frame is on air.
+    SIM_STEP_CCA_START,     ///< Receiver ramped up and starts a CCA procedure.
+    SIM_STEP_CCA_END,       ///< CCA procedure has finished.
+    SIM_STEP_TX_READY,      ///< Transmitter ramped up and starts sending SHR of a frame.
+    SIM_STEP_TX_ADDRESS,    ///< SHR and PHR of a transmitted frame are on air.
+    SIM_STEP_TX_END,        ///< Last octet of a transmitted frame is on air.
+    SIM_STEP_TXACK_ADDRESS, ///< SHR and PHR of a transmitted ACK are on air.
+    SIM_STEP_TXACK_END,     ///< Last octet of a transmitted ACK is on air.
+    SIM_STEP_IDLE,          ///< Radio ramped down.
+    SIM_STEP_ED_END,        ///< Energy detection has finished.
+} sim_step_t;
+
+/**@brief Frame injected into the simulated medium. */
+typedef struct
+{
+    uint64_t time;                           ///< Time of the first symbol of the frame's SHR [us].
+    uint8_t  channel;                        ///< Channel on which the frame is transmitted.
+    bool     crc_ok;                         ///< If the frame is to be received with a correct CRC.
+    bool     used;                           ///< If this entry holds a frame.
+    uint8_t  psdu[MAX_PACKET_SIZE + PHR_SIZE]; ///< Frame, starting with PHR.
+} sim_frame_t;
+
+/**@brief Simulated medium. */
+typedef struct
+{
+    sim_frame_t                      frames[NRF_802154_TRX_SIM_FRAMES_NUM]; ///< Frames of virtual peers.
+    nrf_802154_trx_sim_tx_callback_t tx_callback;                          ///< Observer of frames transmitted by the driver.
+    uint32_t                         prng;                                 ///< State of the packet loss generator.
+    uint16_t                         loss_per_mille;                       ///< Packet loss probability.
+    uint32_t                         cca_busy_pattern;                     ///< Results of subsequent CCA procedures.
+    uint8_t                          cca_busy_bit;                         ///< Bit of the pattern used by the next CCA procedure.
+    uint8_t                          rssi_sample;                          ///< Raw RSSI sample.
+    uint8_t                          ed_idle;                              ///< Raw ED sample of an idle channel.
+    uint8_t                          ed_busy;                              ///< Raw ED sample of a busy channel.
+} sim_medium_t;
+
+static sim_medium_t m_medium;                     ///< Simulated medium.
+static uint64_t     m_time;                       ///< Simulated time [us].
+static uint64_t     m_event_time[SIM_EVENTS_NUM]; ///< Time of the last occurrence of each event [us].
+static uint32_t     m_event_occurred;             ///< Bitmask of events that occurred since the reset.
+
+static trx_state_t  m_trx_state;              ///< State of the trx module.
+static uint8_t      m_channel = 11U;          ///< Channel used by the next radio operation.
+static void       * mp_receive_buffer;        ///< Buffer for received frames.
+static const void * mp_transmit_buffer;       ///< Buffer of the frame or ACK being transmitted.
+
+static sim_step_t   m_step;                   ///< Pending step of the current radio operation.
+static uint64_t     m_step_time;              ///< Time of the pending step [us].
+static uint32_t     m_step_ramp_up_time;      ///< Ramp-up time of the step waiting for a trigger [us].
+static bool         m_step_wait_trigger;      ///< If the pending step waits for the ramp-up trigger.
+
+static bool         m_listening;              ///< If the receiver waits for a frame.
+static uint64_t     m_listen_start;           ///< Frames starting earlier than this time are missed [us].
+static uint64_t     m_frame_start;            ///< Time of the first symbol of the frame being on air [us].
+static uint64_t     m_frame_end;              ///< Time of the last symbol of the last received frame [us].
+static uint64_t     m_window_start;           ///< Start of the current CCA or ED window [us].
+static bool         m_ed_keep_rx;             ///< If the receiver stays enabled when the ED ends.
+static uint8_t      m_ed_channel;             ///< Channel the receiver was enabled at for the ED.
+static bool         m_rx_crc_ok;              ///< If the frame being received has a correct CRC.
+static uint8_t      m_bcc;                    ///< Number of octets triggering bcmatch.
+static bool         m_rssi_started;           ///< If RSSI measurement has been started.
+static uint8_t      m_cca_attempts;           ///< Remaining CCA procedures of the current transmission.
+
+static nrf_802154_trx_receive_notifications_t  m_rx_notifications; ///< Notifications of the current reception.
+static nrf_802154_trx_transmit_notifications_t m_tx_notifications; ///< Notifications of the current transmission.
+
+static uint32_t frame_duration_get(const uint8_t * p_psdu)
+{
+    return nrf_802154_frame_duration_get(p_psdu[PHR_OFFSET], true, true);
+}
+
+static uint32_t medium_random_get(void)
+{
+    uint32_t x = m_medium.prng;
+
+    x            ^= x << 13;
+    x            ^= x >> 17;
+    x            ^= x << 5;
+    m_medium.prng = x;
+
+    return x;
+}
+
+static bool medium_frame_is_lost(void)
+{
+    return (m_medium.loss_per_mille != 0U) &&
+           ((medium_random_get() % 1000U) < m_medium.loss_per_mille);
+}
+
+/** Releases frames that ended long enough ago not to affect any CCA or ED window. */
+static void medium_purge(void)
+{
+    for (uint32_t i = 0; i < NRF_802154_TRX_SIM_FRAMES_NUM; i++)
+    {
+        sim_frame_t * p_frame   = &m_medium.frames[i];
+        uint64_t      frame_end = p_frame->time + frame_duration_get(p_frame->psdu);
+
+        if (p_frame->used &&
+            (frame_end + CCA_TIME < m_time) &&
+            ((m_trx_state != TRX_STATE_ENERGY_DETECTION) || (frame_end < m_window_start)))
+        {
+            p_frame->used = false;
+        }
+    }
+}
+
+static bool medium_is_busy(uint64_t start, uint64_t end)
+{
+    for (uint32_t i = 0; i < NRF_802154_TRX_SIM_FRAMES_NUM; i++)
+    {
+        const sim_frame_t * p_frame = &m_medium.frames[i];
+
+        if (p_frame->used &&
+            (p_frame->channel == m_channel) &&
+            (p_frame->time < end) &&
+            (p_frame->time + frame_duration_get(p_frame->psdu) > start))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/** Finds the earliest frame the listening receiver can synchronize to. */
+static sim_frame_t * medium_next_frame_get(void)
+{
+    sim_frame_t * p_result = NULL;
+
+    for (uint32_t i = 0; i < NRF_802154_TRX_SIM_FRAMES_NUM; i++)
+    {
+        sim_frame_t * p_frame = &m_medium.frames[i];
+
+        if (p_frame->used &&
+            (p_frame->channel == m_channel) &&
+            (p_frame->time >= m_listen_start) &&
+            ((p_result == NULL) || (p_frame->time < p_result->time)))
+        {
+            p_result = p_frame;
+        }
+    }
+
+    return p_result;
+}
+
+static void medium_transmit(const uint8_t * p_psdu)
+{
+    if ((m_medium.tx_callback != NULL) && !medium_frame_is_lost())
+    {
+        m_medium.tx_callback(m_channel, p_psdu, m_frame_start);
+    }
+}
+
+static bool cca_is_busy(void)
+{
+    bool busy = ((m_medium.cca_busy_pattern >> m_medium.cca_busy_bit) & 1U) != 0U;
+
+    m_medium.cca_busy_bit = (m_medium.cca_busy_bit + 1U) % 32U;
+
+    return busy || medium_is_busy(m_window_start, m_time);
+}
+
+static void step_schedule(sim_step_t step, uint64_t time)
+{
+    m_step              = step;
+    m_step_time         = time;
+    m_step_wait_trigger = false;
+}
+
+static void step_after_ramp_up_schedule(sim_step_t                            step,
+                                        uint32_t                              ramp_up_time,
+                                        nrf_802154_trx_ramp_up_trigger_mode_t rampup_trigg_mode)
+{
+    step_schedule(step, m_time + ramp_up_time);
+
+    m_step_ramp_up_time = ramp_up_time;
+    m_step_wait_trigger = (rampup_trigg_mode == TRX_RAMP_UP_HW_TRIGGER);
+}
+
+/** Stops the current radio operation without calling any handler. */
+static void operation_stop(void)
+{
+    m_step         = SIM_STEP_NONE;
+    m_listening    = false;
+    m_rssi_started = false;
+}
+
+static void event_record(uint32_t event)
+{
+    m_event_time[event] = m_time;
+    m_event_occurred   |= (1UL << event);
+}
+
+static bool step_is_due(void)
+{
+    return (m_step != SIM_STEP_NONE) && !m_step_wait_trigger && (m_step_time <= m_time);
+}
+
+static void rx_frame_start(sim_frame_t * p_frame)
+{
+    // Whatever happens next, the receiver will not synchronize to this frame again.
+    m_listen_start = p_frame->time + 1U;
+
+    if ((mp_receive_buffer == NULL) || medium_frame_is_lost())
+    {
+        return;
+    }
+
+    memcpy(mp_receive_buffer, p_frame->psdu, p_frame->psdu[PHR_OFFSET] + PHR_SIZE);
+
+    m_listening   = false;
+    m_rx_crc_ok   = p_frame->crc_ok;
+    m_frame_start = p_frame->time;
+
+    step_schedule(SIM_STEP_RX_ADDRESS, m_frame_start + SHR_PHR_TIME);
+
+    if ((m_trx_state == TRX_STATE_RXFRAME) &&
+        ((m_rx_notifications & TRX_RECEIVE_NOTIFICATION_PRESTARTED) != 0U))
+    {
+        nrf_802154_trx_receive_frame_prestarted();
+    }
+}
+
+static void rx_address_process(void)
+{
+    uint8_t  psdu_length = ((const uint8_t *)mp_receive_buffer)[PHR_OFFSET];
+    uint64_t frame_end   = m_frame_start + frame_duration_get(mp_receive_buffer);
+
+    if (m_trx_state == TRX_STATE_RXACK)
+    {
+        step_schedule(SIM_STEP_RX_END, frame_end);
+        nrf_802154_trx_receive_ack_started();
+        return;
+    }
+
+    if ((m_bcc != 0U) && (m_bcc <= psdu_length))
+    {
+        step_schedule(SIM_STEP_RX_BCMATCH,
+                      m_frame_start + SHR_PHR_TIME +
+                      PHY_US_TIME_FROM_SYMBOLS(PHY_SYMBOLS_FROM_OCTETS(m_bcc)));
+    }
+    else
+    {
+        step_schedule(SIM_STEP_RX_END, frame_end);
+    }
+
+    if ((m_rx_notifications & TRX_RECEIVE_NOTIFICATION_STARTED) != 0U)
+    {
+        nrf_802154_trx_receive_frame_started();
+    }
+}
+
+static void rx_bcmatch_process(void)
+{
+    uint8_t psdu_length = ((const uint8_t *)mp_receive_buffer)[PHR_OFFSET];
+    uint8_t bcc         = m_bcc;
+
+    step_schedule(SIM_STEP_RX_END, m_frame_start + frame_duration_get(mp_receive_buffer));
+
+    uint8_t next_bcc = nrf_802154_trx_receive_frame_bcmatched(bcc);
+
+    // The handler might have aborted the reception.
+    if ((m_step == SIM_STEP_RX_END) && (next_bcc > bcc) && (next_bcc <= psdu_length))
+    {
+        m_bcc = next_bcc;
+        step_schedule(SIM_STEP_RX_BCMATCH,
+                      m_frame_start + SHR_PHR_TIME +
+                      PHY_US_TIME_FROM_SYMBOLS(PHY_SYMBOLS_FROM_OCTETS(m_bcc)));
+    }
+}
+
+static void rx_end_process(void)
+{
+    m_frame_end    = m_time;
+    m_rssi_started = false;
+
+    event_record(SIM_EVENT_END);
+
+    if (m_rx_crc_ok)
+    {
+        event_record(SIM_EVENT_CRCOK);
+    }
+
+    if (m_trx_state == TRX_STATE_RXACK)
+    {
+        m_trx_state = TRX_STATE_FINISHED;
+
+        if (m_rx_crc_ok)
+        {
+            nrf_802154_trx_receive_ack_received();
+        }
+        else
+        {
+            nrf_802154_trx_receive_ack_crcerror();
+        }
+    }
+    else if (m_rx_crc_ok)
+    {
+        m_trx_state = TRX_STATE_RXFRAME_FINISHED;
+        nrf_802154_trx_receive_frame_received();
+    }
+    else
+    {
+        m_trx_state = TRX_STATE_FINISHED;
+        nrf_802154_trx_receive_frame_crcerror();
+    }
+}
+
+static void cca_end_process(void)
+{
+    bool busy = cca_is_busy();
+
+    if (m_trx_state == TRX_STATE_STANDALONE_CCA)
+    {
+        m_trx_state = TRX_STATE_FINISHED;
+        nrf_802154_trx_standalone_cca_finished(!busy);
+    }
+    else if (!busy)
+    {
+        step_schedule(SIM_STEP_TX_READY, m_time + RX_TX_TURNAROUND_TIME);
+
+        if ((m_tx_notifications & TRX_TRANSMIT_NOTIFICATION_CCAIDLE) != 0U)
+        {
+            nrf_802154_trx_transmit_frame_ccaidle();
+        }
+    }
+    else if (--m_cca_attempts == 0U)
+    {
+        m_trx_state = TRX_STATE_FINISHED;
+        nrf_802154_trx_transmit_frame_ccabusy();
+    }
+    else
+    {
+        step_schedule(SIM_STEP_CCA_START, m_time);
+    }
+}
+
+static void step_process(sim_step_t step)
+{
+    switch (step)
+    {
+        case SIM_STEP_RX_READY:
+            event_record(SIM_EVENT_READY);
+            m_listening    = true;
+            m_listen_start = m_time;
+            break;
+
+        case SIM_STEP_RX_ADDRESS:
+            rx_address_process();
+            break;
+
+        case SIM_STEP_RX_BCMATCH:
+            rx_bcmatch_process();
+            break;
+
+        case SIM_STEP_RX_END:
+            rx_end_process();
+            break;
+
+        case SIM_STEP_CCA_START:
+            event_record(SIM_EVENT_READY);
+            m_window_start = m_time;
+            step_schedule(SIM_STEP_CCA_END, m_time + CCA_TIME);
+
+            if ((m_trx_state == TRX_STATE_TXFRAME) &&
+                ((m_tx_notifications & TRX_TRANSMIT_NOTIFICATION_CCASTARTED) != 0U))
+            {
+                nrf_802154_trx_transmit_frame_ccastarted();
+            }
+            break;
+
+        case SIM_STEP_CCA_END:
+            cca_end_process();
+            break;
+
+        case SIM_STEP_TX_READY:
+            event_record(SIM_EVENT_READY);
+            m_frame_start = m_time;
+            step_schedule(SIM_STEP_TX_ADDRESS, m_time + SHR_PHR_TIME);
+            break;
+
+        case SIM_STEP_TX_ADDRESS:
+            step_schedule(SIM_STEP_TX_END, m_frame_start + frame_duration_get(mp_transmit_buffer));
+            nrf_802154_trx_transmit_frame_started();
+            break;
+
+        case SIM_STEP_TX_END:
+            event_record(SIM_EVENT_END);
+            event_record(SIM_EVENT_PHYEND);
+            medium_transmit(mp_transmit_buffer);
+            m_trx_state = TRX_STATE_FINISHED;
+            nrf_802154_trx_transmit_frame_transmitted();
+            break;
+
+        case SIM_STEP_TXACK_ADDRESS:
+            step_schedule(SIM_STEP_TXACK_END,
+                          m_frame_start + frame_duration_get(mp_transmit_buffer));
+            nrf_802154_trx_transmit_ack_started();
+            break;
+
+        case SIM_STEP_TXACK_END:
+            event_record(SIM_EVENT_END);
+            event_record(SIM_EVENT_PHYEND);
+            medium_transmit(mp_transmit_buffer);
+            m_trx_state = TRX_STATE_FINISHED;
+            nrf_802154_trx_transmit_ack_transmitted();
+            break;
+
+        case SIM_STEP_IDLE:
+            m_trx_state = TRX_STATE_IDLE;
+            nrf_802154_trx_go_idle_finished();
+            break;
+
+        case SIM_STEP_ED_END:
+            if (!m_ed_keep_rx)
+            {
+                m_trx_state = TRX_STATE_FINISHED;
+            }
+
+            nrf_802154_trx_energy_detection_finished(
+                medium_is_busy(m_window_start, m_time) ? m_medium.ed_busy : m_medium.ed_idle);
+            break;
+
+        default:
+            NRF_802154_ASSERT(false);
+    }
+}
+
+void nrf_802154_trx_sim_reset(void)
+{
+    NRF_802154_ASSERT(m_trx_state == TRX_STATE_DISABLED);
+
+    memset(&m_medium, 0, sizeof(m_medium));
+
+    m_medium.prng        = LOSS_SEED_DEFAULT;
+    m_medium.rssi_sample = RSSI_SAMPLE_DEFAULT;
+    m_medium.ed_idle     = ED_IDLE_DEFAULT;
+    m_medium.ed_busy     = ED_BUSY_DEFAULT;
+
+    m_time           = 0U;
+    m_window_start   = 0U;
+    m_event_occurred = 0U;
+}
+
+uint64_t nrf_802154_trx_sim_time_get(void)
+{
+    return m_time;
+}
+
+bool nrf_802154_trx_sim_next_event_time_get(uint64_t * p_time)
+{
+    if ((m_step != SIM_STEP_NONE) && !m_step_wait_trigger)
+    {
+        *p_time = m_step_time;
+        return true;
+    }
+
+    if (m_listening)
+    {
+        const sim_frame_t * p_frame = medium_next_frame_get();
+
+        if (p_frame != NULL)
+        {
+            *p_time = p_frame->time;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool nrf_802154_trx_sim_event_time_get(uint32_t event_addr, uint64_t * p_time)
+{
+    if ((event_addr >= SIM_EVENTS_NUM) || ((m_event_occurred & (1UL << event_addr)) == 0U))
+    {
+        return false;
+    }
+
+    *p_time = m_event_time[event_addr];
+
+    return true;
+}
+
+void nrf_802154_trx_sim_run_until(uint64_t time)
+{
+    uint64_t next;
+
+    NRF_802154_ASSERT(time >= m_time);
+
+    while (nrf_802154_trx_sim_next_event_time_get(&next) && (next <= time))
+    {
+        if (next > m_time)
+        {
+            m_time = next;
+        }
+
+        nrf_802154_radio_irq_handler();
+    }
+
+    m_time = time;
+}
+
+bool nrf_802154_trx_sim_frame_inject(uint8_t         channel,
+                                     const uint8_t * p_psdu,
+                                     uint64_t        time,
+                                     bool            crc_ok)
+{
+    NRF_802154_ASSERT(p_psdu != NULL);
+    NRF_802154_ASSERT(p_psdu[PHR_OFFSET] <= MAX_PACKET_SIZE);
+
+    medium_purge();
+
+    for (uint32_t i = 0; i < NRF_802154_TRX_SIM_FRAMES_NUM; i++)
+    {
+        sim_frame_t * p_frame = &m_medium.frames[i];
+
+        if (!p_frame->used)
+        {
+            p_frame->time    = time;
+            p_frame->channel = channel;
+            p_frame->crc_ok  = crc_ok;
+            p_frame->used    = true;
+            memcpy(p_frame->psdu, p_psdu, p_psdu[PHR_OFFSET] + PHR_SIZE);
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+void nrf_802154_trx_sim_tx_callback_set(nrf_802154_trx_sim_tx_callback_t callback)
+{
+    m_medium.tx_callback = callback;
+}
+
+void nrf_802154_trx_sim_loss_set(uint16_t per_mille, uint32_t seed)
+{
+    NRF_802154_ASSERT(per_mille <= 1000U);
+
+    m_medium.loss_per_mille = per_mille;
+    m_medium.prng           = (seed != 0U) ? seed : LOSS_SEED_DEFAULT;
+}
+
+void nrf_802154_trx_sim_cca_busy_pattern_set(uint32_t pattern)
+{
+    m_medium.cca_busy_pattern = pattern;
+    m_medium.cca_busy_bit     = 0U;
+}
+
+void nrf_802154_trx_sim_rssi_set(uint8_t rssi_sample)
+{
+    m_medium.rssi_sample = rssi_sample;
+}
+
+void nrf_802154_trx_sim_ed_set(uint8_t ed_idle, uint8_t ed_busy)
+{
+    m_medium.ed_idle = ed_idle;
+    m_medium.ed_busy = ed_busy;
+}
+
+void nrf_802154_trx_sim_ramp_up_trigger(void)
+{
+    if ((m_step != SIM_STEP_NONE) && m_step_wait_trigger)
+    {
+        m_step_time         = m_time + m_step_ramp_up_time;
+        m_step_wait_trigger = false;
+    }
+}
+
+void nrf_802154_trx_module_reset(void)
+{
+    operation_stop();
+
+    m_trx_state       = TRX_STATE_DISABLED;
+    mp_receive_buffer = NULL;
+}
+
+void nrf_802154_trx_init(void)
+{
+    nrf_802154_trx_module_reset();
+}
+
+void nrf_802154_trx_enable(void)
+{
+    NRF_802154_ASSERT(m_trx_state == TRX_STATE_DISABLED);
+
+    m_trx_state = TRX_STATE_IDLE;
+}
+
+void nrf_802154_trx_disable(void)
+{
+    operation_stop();
+
+    m_trx_state = TRX_STATE_DISABLED;
+}
+
+void nrf_802154_trx_antenna_update(void)
+{
+    // The simulated radio has a single antenna.
+}
+
+void nrf_802154_trx_channel_set(uint8_t channel)
+{
+    m_channel = channel;
+}
+
+void nrf_802154_trx_cca_configuration_update(void)
+{
+    // CCA results are configured with nrf_802154_trx_sim_cca_busy_pattern_set.
+}
+
+void nrf_802154_trx_receive_frame(uint8_t                                 bcc,
+                                  nrf_802154_trx_ramp_up_trigger_mode_t   rampup_trigg_mode,
+                                  nrf_802154_trx_receive_notifications_t  notifications_mask,
+                                  const nrf_802154_fal_tx_power_split_t * p_ack_tx_power)
+{
+    (void)p_ack_tx_power;
+
+    operation_stop();
+
+    m_trx_state        = TRX_STATE_RXFRAME;
+    m_bcc              = bcc;
+    m_rx_notifications = notifications_mask;
+
+    step_after_ramp_up_schedule(SIM_STEP_RX_READY, RX_RAMP_UP_TIME, rampup_trigg_mode);
+}
+
+void nrf_802154_trx_receive_ack(void)
+{
+    operation_stop();
+
+    m_trx_state = TRX_STATE_RXACK;
+
+    step_after_ramp_up_schedule(SIM_STEP_RX_READY, RX_RAMP_UP_TIME, TRX_RAMP_UP_SW_TRIGGER);
+}
+
+bool nrf_802154_trx_rssi_measure(void)
+{
+    if (m_trx_state != TRX_STATE_RXFRAME)
+    {
+        return false;
+    }
+
+    m_rssi_started = true;
+
+    return true;
+}
+
+bool nrf_802154_trx_rssi_measure_is_started(void)
+{
+    return m_rssi_started;
+}
+
+bool nrf_802154_trx_rssi_sample_is_available(void)
+{
+    return m_rssi_started;
+}
+
+uint8_t nrf_802154_trx_rssi_last_sample_get(void)
+{
+    return m_medium.rssi_sample;
+}
+
+bool nrf_802154_trx_psdu_is_being_received(void)
+{
+    return (m_trx_state == TRX_STATE_RXFRAME) &&
+           ((m_step == SIM_STEP_RX_ADDRESS) ||
+            (m_step == SIM_STEP_RX_BCMATCH) ||
+            (m_step == SIM_STEP_RX_END));
+}
+
+bool nrf_802154_trx_receive_is_buffer_missing(void)
+{
+    return ((m_trx_state == TRX_STATE_RXFRAME) || (m_trx_state == TRX_STATE_RXACK)) &&
+           (mp_receive_buffer == NULL);
+}
+
+bool nrf_802154_trx_receive_buffer_set(void * p_receive_buffer)
+{
+    bool result = (p_receive_buffer != NULL) && nrf_802154_trx_receive_is_buffer_missing();
+
+    mp_receive_buffer = p_receive_buffer;
+
+    return result;
+}
+
+void nrf_802154_trx_transmit_frame(const void                            * p_transmit_buffer,
+                                   nrf_802154_trx_ramp_up_trigger_mode_t   rampup_trigg_mode,
+                                   uint8_t                                 cca_attempts,
+                                   const nrf_802154_fal_tx_power_split_t * p_tx_power,
+                                   nrf_802154_trx_transmit_notifications_t notifications_mask)
+{
+    NRF_802154_ASSERT(p_transmit_buffer != NULL);
+    (void)p_tx_power;
+
+    operation_stop();
+
+    m_trx_state        = TRX_STATE_TXFRAME;
+    mp_transmit_buffer = p_transmit_buffer;
+    m_cca_attempts     = cca_attempts;
+    m_tx_notifications = notifications_mask;
+
+    if (cca_attempts > 0U)
+    {
+        step_after_ramp_up_schedule(SIM_STEP_CCA_START, RX_RAMP_UP_TIME, rampup_trigg_mode);
+    }
+    else
+    {
+        step_after_ramp_up_schedule(SIM_STEP_TX_READY, TX_RAMP_UP_TIME, rampup_trigg_mode);
+    }
+}
+
+bool nrf_802154_trx_transmit_ack(const void * p_transmit_buffer, uint32_t delay_us)
+{
+    NRF_802154_ASSERT(m_trx_state == TRX_STATE_RXFRAME_FINISHED);
+    NRF_802154_ASSERT(p_transmit_buffer != NULL);
+
+    m_trx_state = TRX_STATE_TXACK;
+
+    uint64_t ack_start = m_frame_end + delay_us;
+
+    // Same as with the RADIO, the ACK must be requested before its ramp-up should begin.
+    if ((delay_us <= TX_RAMP_UP_TIME) || (ack_start < m_time + TX_RAMP_UP_TIME))
+    {
+        return false;
+    }
+
+    mp_transmit_buffer = p_transmit_buffer;
+    m_frame_start      = ack_start;
+
+    step_schedule(SIM_STEP_TXACK_ADDRESS, ack_start + SHR_PHR_TIME);
+
+    return true;
+}
+
+bool nrf_802154_trx_go_idle(void)
+{
+    bool result = false;
+
+    switch (m_trx_state)
+    {
+        case TRX_STATE_DISABLED:
+            NRF_802154_ASSERT(false);
+            break;
+
+        case TRX_STATE_IDLE:
+            /* There will be no callout */
+            break;
+
+        case TRX_STATE_GOING_IDLE:
+            /* There will be callout */
+            result = true;
+            break;
+
+        case TRX_STATE_RXFRAME_FINISHED:
+        case TRX_STATE_FINISHED:
+            operation_stop();
+            m_trx_state = TRX_STATE_GOING_IDLE;
+            step_schedule(SIM_STEP_IDLE, m_time + MAX_RAMP_DOWN_TIME);
+            result = true;
+            break;
+
+        default:
+            NRF_802154_ASSERT(false);
+    }
+
+    return result;
+}
+
+void nrf_802154_trx_standalone_cca(void)
+{
+    operation_stop();
+
+    m_trx_state = TRX_STATE_STANDALONE_CCA;
+
+    step_after_ramp_up_schedule(SIM_STEP_CCA_START, RX_RAMP_UP_TIME, TRX_RAMP_UP_SW_TRIGGER);
+}
+
+#if NRF_802154_CARRIER_FUNCTIONS_ENABLED
+
+void nrf_802154_trx_continuous_carrier(const nrf_802154_fal_tx_power_split_t * p_tx_power)
+{
+    (void)p_tx_power;
+
+    operation_stop();
+
+    m_trx_state = TRX_STATE_CONTINUOUS_CARRIER;
+}
+
+void nrf_802154_trx_continuous_carrier_restart(void)
+{
+    NRF_802154_ASSERT(m_trx_state == TRX_STATE_CONTINUOUS_CARRIER);
+}
+
+void nrf_802154_trx_modulated_carrier(const void                            * p_transmit_buffer,
+                                      const nrf_802154_fal_tx_power_split_t * p_tx_power)
+{
+    NRF_802154_ASSERT(p_transmit_buffer != NULL);
+    (void)p_tx_power;
+
+    operation_stop();
+
+    m_trx_state = TRX_STATE_MODULATED_CARRIER;
+}
+
+void nrf_802154_trx_modulated_carrier_restart(void)
+{
+    NRF_802154_ASSERT(m_trx_state == TRX_STATE_MODULATED_CARRIER);
+}
+
+#endif // NRF_802154_CARRIER_FUNCTIONS_ENABLED
+
+void nrf_802154_trx_energy_detection(uint32_t ed_count)
+{
+    NRF_802154_ASSERT((ed_count >= 1U) && (ed_count <= 2097152U));
+
+    operation_stop();
+
+    m_trx_state    = TRX_STATE_ENERGY_DETECTION;
+    m_window_start = m_time + RX_RAMP_UP_TIME;
+    m_ed_keep_rx   = false;
+
+    step_schedule(SIM_STEP_ED_END, m_window_start + (uint64_t)ed_count * ED_ITERATION_TIME);
+}
+
+void nrf_802154_trx_energy_detection_sample(uint32_t ed_count)
+{
+    bool rx_enabled = (m_trx_state == TRX_STATE_ENERGY_DETECTION);
+
+    NRF_802154_ASSERT(!rx_enabled || m_ed_keep_rx);
+
+    nrf_802154_trx_energy_detection(ed_count);
+
+    m_ed_keep_rx = true;
+
+    if (rx_enabled && (m_channel == m_ed_channel))
+    {
+        // The receiver is idle since the previous sample, on the same channel
+        m_window_start = m_time;
+        step_schedule(SIM_STEP_ED_END, m_window_start + (uint64_t)ed_count * ED_ITERATION_TIME);
+    }
+
+    m_ed_channel = m_channel;
+}
+
+void nrf_802154_trx_abort(void)
+{
+    switch (m_trx_state)
+    {
+        case TRX_STATE_DISABLED:
+        case TRX_STATE_IDLE:
+        case TRX_STATE_FINISHED:
+            /* Nothing to do, intentionally empty */
+            break;
+
+        default:
+            operation_stop();
+            m_trx_state = TRX_STATE_FINISHED;
+    }
+}
+
+trx_state_t nrf_802154_trx_state_get(void)
+{
+    return m_trx_state;
+}
+
+uint32_t nrf_802154_trx_ramp_up_ppi_channel_get(void)
+{
+    // There is no (D)PPI in the simulator, see nrf_802154_trx_sim_ramp_up_trigger.
+    return 0U;
+}
+
+void nrf_802154_radio_irq_handler(void)
+{
+    // Prevent interrupting of this handler by requests from higher priority code.
+    nrf_802154_critical_section_forcefully_enter();
+
+    medium_purge();
+
+    if (step_is_due())
+    {
+        sim_step_t step = m_step;
+
+        m_step = SIM_STEP_NONE;
+        step_process(step);
+    }
+    else if (m_listening)
+    {
+        sim_frame_t * p_frame = medium_next_frame_get();
+
+        if ((p_frame != NULL) && (p_frame->time <= m_time))
+        {
+            rx_frame_start(p_frame);
+        }
+    }
+
+    nrf_802154_critical_section_exit();
+}
+
+const nrf_802154_sl_event_handle_t * nrf_802154_trx_radio_end_event_handle_get(void)
+{
+    static const nrf_802154_sl_event_handle_t r = {
+        .event_addr = SIM_EVENT_END,
+#if defined(DPPI_PRESENT)
+        .shared     = false
+#endif
+    };
+
+    return &r;
+}
+
+const nrf_802154_sl_event_handle_t * nrf_802154_trx_radio_ready_event_handle_get(void)
+{
+    static const nrf_802154_sl_event_handle_t r = {
+        .event_addr = SIM_EVENT_READY,
+#if defined(DPPI_PRESENT)
+        .shared     = false
+#endif
+    };
+
+    return &r;
+}
+
+const nrf_802154_sl_event_handle_t * nrf_802154_trx_radio_crcok_event_handle_get(void)
+{
+    static const nrf_802154_sl_event_handle_t r = {
+        .event_addr = SIM_EVENT_CRCOK,
+#if defined(DPPI_PRESENT)
+        .shared     = false
+#endif
+    };
+
+    return &r;
+}
+
+const nrf_802154_sl_event_handle_t * nrf_802154_trx_radio_phyend_event_handle_get(void)
+{
+    static const nrf_802154_sl_event_handle_t r = {
+        .event_addr = SIM_EVENT_PHYEND,
+#if defined(DPPI_PRESENT)
+        .shared     = false
+#endif
+    };
+
+    return &r;
+}
+
+#endif // NRF_802154_TRX_SIM_ENABLED
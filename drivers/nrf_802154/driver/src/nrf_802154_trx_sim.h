@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief Host-side simulator of the trx module of the nRF IEEE 802.15.4 radio driver.
+ *
+ * @details When @ref NRF_802154_TRX_SIM_ENABLED is set to 1, this module provides the
+ *          nrf_802154_trx.h API instead of the RADIO-based implementation. Radio operations
+ *          are scheduled against a virtual microsecond clock and their handlers are called
+ *          from @ref nrf_802154_radio_irq_handler, which the simulator invokes while the
+ *          clock is advanced by @ref nrf_802154_trx_sim_run_until.
+ *
+ *          The medium is scripted: frames of virtual peers are injected with
+ *          @ref nrf_802154_trx_sim_frame_inject and frames transmitted by the driver (including
+ *          ACKs) are passed to the callback registered with @ref nrf_802154_trx_sim_tx_callback_set.
+ *          Packet loss, CCA results and energy levels are configurable, so that the MAC behavior
+ *          of the driver core can be exercised deterministically without the radio hardware.
+ */
+
+#ifndef NRF_802154_TRX_SIM_H_
+#define NRF_802154_TRX_SIM_H_
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_config.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**@brief Function called when the simulated radio finishes transmitting a frame.
+ *
+ * @param[in] channel    Channel on which the frame was transmitted.
+ * @param[in] p_psdu     Pointer to the transmitted frame. p_psdu[0] is the PHR.
+ * @param[in] timestamp  Simulated time of the first symbol of the frame's SHR, in microseconds.
+ */
+typedef void (* nrf_802154_trx_sim_tx_callback_t)(uint8_t         channel,
+                                                  const uint8_t * p_psdu,
+                                                  uint64_t        timestamp);
+
+/**@brief Resets the simulated clock and the simulated medium.
+ *
+ * Removes all injected frames, the TX callback and restores the default medium parameters.
+ */
+void nrf_802154_trx_sim_reset(void);
+
+/**@brief Gets current simulated time.
+ *
+ * @return Current simulated time in microseconds.
+ */
+uint64_t nrf_802154_trx_sim_time_get(void);
+
+/**@brief Gets simulated time of the next pending radio event.
+ *
+ * @param[out] p_time  Simulated time of the next event, in microseconds.
+ *
+ * @retval true   There is a pending event.
+ * @retval false  The radio waits for a request from the driver core or for a ramp-up trigger.
+ */
+bool nrf_802154_trx_sim_next_event_time_get(uint64_t * p_time);
+
+/**@brief Gets simulated time of the last occurrence of a radio event.
+ *
+ * Allows the timer coordinator to be simulated on top of the simulated radio.
+ *
+ * @param[in]  event_addr  Event address taken from a handle returned by one of the
+ *                         nrf_802154_trx_radio_*_event_handle_get functions.
+ * @param[out] p_time      Simulated time of the last occurrence of the event, in microseconds.
+ *
+ * @retval true   The event has occurred since the last reset.
+ * @retval false  The event has not occurred yet.
+ */
+bool nrf_802154_trx_sim_event_time_get(uint32_t event_addr, uint64_t * p_time);
+
+/**@brief Advances the simulated clock, processing radio events on the way.
+ *
+ * Events are processed in chronological order. Handlers called for an event may request new
+ * radio operations, which are processed within the same call if they end before @p time.
+ *
+ * @param[in] time  Simulated time to advance to, in microseconds. Must not be in the past.
+ */
+void nrf_802154_trx_sim_run_until(uint64_t time);
+
+/**@brief Injects a frame transmitted by a virtual peer into the simulated medium.
+ *
+ * The frame is received by the driver if the radio listens on @p channel when the frame's SHR
+ * starts and the frame is not lost. The frame also makes CCA report a busy channel
+ * while it is on air.
+ *
+ * @param[in] channel  Channel on which the frame is transmitted.
+ * @param[in] p_psdu   Pointer to the frame. p_psdu[0] is the PHR. The frame is copied.
+ * @param[in] time     Simulated time of the first symbol of the frame's SHR, in microseconds.
+ * @param[in] crc_ok   If the frame is to be received with a correct CRC.
+ *
+ * @retval true   The frame has been injected.
+ * @retval false  There is no room for the frame (see @ref NRF_802154_TRX_SIM_FRAMES_NUM).
+ */
+bool nrf_802154_trx_sim_frame_inject(uint8_t         channel,
+                                     const uint8_t * p_psdu,
+                                     uint64_t        time,
+                                     bool            crc_ok);
+
+/**@brief Sets function called for each frame transmitted by the driver.
+ *
+ * @param[in] callback  Function to call or NULL to stop observing transmitted frames.
+ */
+void nrf_802154_trx_sim_tx_callback_set(nrf_802154_trx_sim_tx_callback_t callback);
+
+/**@brief Configures packet loss of the simulated medium.
+ *
+ * The loss applies both to injected frames and to frames transmitted by the driver.
+ *
+ * @param[in] per_mille  Probability of losing a frame, in 1/1000 units.
+ * @param[in] seed       Seed of the pseudo-random generator. Zero selects the default seed.
+ */
+void nrf_802154_trx_sim_loss_set(uint16_t per_mille, uint32_t seed);
+
+/**@brief Configures results of the subsequent CCA procedures.
+ *
+ * Bits of @p pattern are consumed from the least significant one, one bit per CCA procedure,
+ * and the pattern repeats after 32 procedures. Bit set to 1 makes the CCA report a busy channel.
+ * A channel with an injected frame on air is reported busy regardless of the pattern.
+ *
+ * @param[in] pattern  CCA busy pattern.
+ */
+void nrf_802154_trx_sim_cca_busy_pattern_set(uint32_t pattern);
+
+/**@brief Sets the raw RSSI sample reported by the simulated radio.
+ *
+ * @param[in] rssi_sample  Raw RSSI sample, as returned by @ref nrf_802154_trx_rssi_last_sample_get.
+ */
+void nrf_802154_trx_sim_rssi_set(uint8_t rssi_sample);
+
+/**@brief Sets the raw energy levels reported by the energy detection procedure.
+ *
+ * @param[in] ed_idle  Raw ED sample reported when no injected frame is on air.
+ * @param[in] ed_busy  Raw ED sample reported when an injected frame is on air.
+ */
+void nrf_802154_trx_sim_ed_set(uint8_t ed_idle, uint8_t ed_busy);
+
+/**@brief Triggers the radio ramp-up of an operation requested with @ref TRX_RAMP_UP_HW_TRIGGER.
+ *
+ * Emulates the (D)PPI channel returned by @ref nrf_802154_trx_ramp_up_ppi_channel_get.
+ * Has no effect if no operation waits for the trigger.
+ */
+void nrf_802154_trx_sim_ramp_up_trigger(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_TRX_SIM_H_ */
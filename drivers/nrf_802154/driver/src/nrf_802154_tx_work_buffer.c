@@ -36,41 +36,142 @@
 #include <stddef.h>
 #include <string.h>
 
+#include "nrf_802154_config.h"
 #include "nrf_802154_const.h"
 #include "nrf_802154_tx_work_buffer.h"
 
-static uint8_t   m_work_buffer[MAX_PACKET_SIZE + PHR_SIZE]; ///< Work buffer.
-static uint8_t * mp_original_frame;                         ///< Pointer to the original frame the work buffer is currently bound to.
-static uint8_t   m_plain_text_offset;                       ///< Offset of encryption plain text.
-static bool      m_is_secured;                              ///< Flag that indicates if work buffer has been successfully secured.
-static bool      m_is_dynamic_data_updated;                 ///< Flag that indicates if work buffer has had dynamic data successfully updated.
+#if NRF_802154_TX_PIPELINE_DEPTH < 1
+#error "NRF_802154_TX_PIPELINE_DEPTH must be at least 1"
+#endif
 
-void nrf_802154_tx_work_buffer_reset(const nrf_802154_transmitted_frame_props_t * p_frame_props)
+/**@brief Work buffer allocated to a single frame. */
+typedef struct
 {
-    mp_original_frame   = NULL;
-    m_plain_text_offset = 0;
+    uint8_t         buffer[MAX_PACKET_SIZE + PHR_SIZE]; ///< Work buffer.
+    const uint8_t * p_original_frame;                   ///< Pointer to the original frame the work buffer is allocated to.
+    uint8_t         plain_text_offset;                  ///< Offset of encryption plain text.
+    bool            is_pending;                         ///< Flag that indicates if the frame's transmission result has not been reported yet.
+    bool            is_enabled;                         ///< Flag that indicates if the frame is transmitted from the work buffer.
+    bool            is_secured;                         ///< Flag that indicates if work buffer has been successfully secured.
+    bool            is_dynamic_data_updated;            ///< Flag that indicates if work buffer has had dynamic data successfully updated.
+} tx_work_buffer_t;
+
+static tx_work_buffer_t m_work_buffers[NRF_802154_TX_PIPELINE_DEPTH]; ///< Ring of work buffers.
+static uint8_t          m_current;                                    ///< Index of the most recently reset work buffer.
+
+/**
+ * @brief Finds the work buffer allocated to the given frame.
+ *
+ * @param[in]  p_original_frame  Pointer to the original frame.
+ * @param[in]  fallback          If no work buffer is allocated to @p p_original_frame, return
+ *                               the most recently reset work buffer, provided it has no frame
+ *                               allocated either.
+ *
+ * @returns  Pointer to the work buffer or NULL if none matches.
+ */
+static tx_work_buffer_t * work_buffer_find(const uint8_t * p_original_frame, bool fallback)
+{
+    if (p_original_frame != NULL)
+    {
+        for (uint32_t i = 0; i < NRF_802154_TX_PIPELINE_DEPTH; i++)
+        {
+            if (m_work_buffers[i].p_original_frame == p_original_frame)
+            {
+                return &m_work_buffers[i];
+            }
+        }
+    }
+
+    if (fallback && (m_work_buffers[m_current].p_original_frame == NULL))
+    {
+        return &m_work_buffers[m_current];
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Selects the work buffer to be used for the given frame.
+ *
+ * The work buffer already allocated to @p p_original_frame is reused. Otherwise the first work
+ * buffer following the current one whose transmission result has been reported is taken.
+ * If all work buffers are pending, the oldest one is overwritten.
+ */
+static uint8_t work_buffer_select(const uint8_t * p_original_frame)
+{
+    if (p_original_frame != NULL)
+    {
+        for (uint8_t i = 0; i < NRF_802154_TX_PIPELINE_DEPTH; i++)
+        {
+            if (m_work_buffers[i].p_original_frame == p_original_frame)
+            {
+                return i;
+            }
+        }
+    }
+
+    for (uint8_t i = 1; i <= NRF_802154_TX_PIPELINE_DEPTH; i++)
+    {
+        uint8_t idx = (m_current + i) % NRF_802154_TX_PIPELINE_DEPTH;
+
+        if (!m_work_buffers[idx].is_pending)
+        {
+            return idx;
+        }
+    }
+
+    return (m_current + 1) % NRF_802154_TX_PIPELINE_DEPTH;
+}
+
+void nrf_802154_tx_work_buffer_reset(const uint8_t                              * p_original_frame,
+                                     const nrf_802154_transmitted_frame_props_t * p_frame_props)
+{
+    m_current = work_buffer_select(p_original_frame);
+
+    tx_work_buffer_t * p_work_buffer = &m_work_buffers[m_current];
+
+    p_work_buffer->p_original_frame  = p_original_frame;
+    p_work_buffer->plain_text_offset = 0;
+    p_work_buffer->is_pending        = (p_original_frame != NULL);
+    p_work_buffer->is_enabled        = false;
 
     if (p_frame_props == NULL)
     {
-        m_is_secured              = false;
-        m_is_dynamic_data_updated = false;
+        p_work_buffer->is_secured              = false;
+        p_work_buffer->is_dynamic_data_updated = false;
     }
     else
     {
-        m_is_secured              = p_frame_props->is_secured;
-        m_is_dynamic_data_updated = p_frame_props->dynamic_data_is_set;
+        p_work_buffer->is_secured              = p_frame_props->is_secured;
+        p_work_buffer->is_dynamic_data_updated = p_frame_props->dynamic_data_is_set;
     }
 }
 
 uint8_t * nrf_802154_tx_work_buffer_enable_for(uint8_t * p_original_frame)
 {
-    mp_original_frame = p_original_frame;
-    return m_work_buffer;
+    tx_work_buffer_t * p_work_buffer = work_buffer_find(p_original_frame, true);
+
+    if (p_work_buffer == NULL)
+    {
+        p_work_buffer = &m_work_buffers[m_current];
+    }
+
+    p_work_buffer->p_original_frame = p_original_frame;
+    p_work_buffer->is_enabled       = true;
+
+    return p_work_buffer->buffer;
 }
 
 const uint8_t * nrf_802154_tx_work_buffer_get(const uint8_t * p_original_frame)
 {
-    return mp_original_frame ? m_work_buffer : p_original_frame;
+    const tx_work_buffer_t * p_work_buffer = work_buffer_find(p_original_frame, false);
+
+    if ((p_work_buffer != NULL) && p_work_buffer->is_enabled)
+    {
+        return p_work_buffer->buffer;
+    }
+
+    return p_original_frame;
 }
 
 void nrf_802154_tx_work_buffer_original_frame_update(
@@ -79,27 +180,41 @@ void nrf_802154_tx_work_buffer_original_frame_update(
 {
     NRF_802154_ASSERT(p_frame_props != NULL);
 
-    p_frame_props->is_secured          = m_is_secured;
-    p_frame_props->dynamic_data_is_set = m_is_dynamic_data_updated;
+    tx_work_buffer_t * p_work_buffer = work_buffer_find(p_original_frame, true);
+
+    if (p_work_buffer == NULL)
+    {
+        p_frame_props->is_secured          = false;
+        p_frame_props->dynamic_data_is_set = false;
+        return;
+    }
+
+    p_frame_props->is_secured          = p_work_buffer->is_secured;
+    p_frame_props->dynamic_data_is_set = p_work_buffer->is_dynamic_data_updated;
+
+    // The transmission result of the frame is being reported, so the work buffer can be reused
+    p_work_buffer->is_pending = false;
 
-    if (mp_original_frame == NULL)
+    if (!p_work_buffer->is_enabled)
     {
         return;
     }
 
-    uint8_t work_buffer_len = m_work_buffer[PHR_OFFSET] + PHR_SIZE;
+    const uint8_t * p_buffer          = p_work_buffer->buffer;
+    uint8_t         work_buffer_len   = p_buffer[PHR_OFFSET] + PHR_SIZE;
+    uint8_t         plain_text_offset = p_work_buffer->plain_text_offset;
 
-    if (m_is_dynamic_data_updated && m_is_secured)
+    if (p_work_buffer->is_dynamic_data_updated && p_work_buffer->is_secured)
     {
-        memcpy(p_original_frame, m_work_buffer, work_buffer_len);
+        memcpy(p_original_frame, p_buffer, work_buffer_len);
     }
-    else if (m_is_dynamic_data_updated)
+    else if (p_work_buffer->is_dynamic_data_updated)
     {
-        memcpy(p_original_frame, m_work_buffer, m_plain_text_offset);
+        memcpy(p_original_frame, p_buffer, plain_text_offset);
     }
-    else if (m_is_secured)
+    else if (p_work_buffer->is_secured)
     {
-        memcpy(p_original_frame, m_work_buffer, work_buffer_len - m_plain_text_offset);
+        memcpy(p_original_frame, p_buffer, work_buffer_len - plain_text_offset);
     }
     else
     {
@@ -107,17 +222,33 @@ void nrf_802154_tx_work_buffer_original_frame_update(
     }
 }
 
-void nrf_802154_tx_work_buffer_is_secured_set(void)
+void nrf_802154_tx_work_buffer_is_secured_set(const uint8_t * p_original_frame)
 {
-    m_is_secured = true;
+    tx_work_buffer_t * p_work_buffer = work_buffer_find(p_original_frame, true);
+
+    if (p_work_buffer != NULL)
+    {
+        p_work_buffer->is_secured = true;
+    }
 }
 
-void nrf_802154_tx_work_buffer_is_dynamic_data_updated_set(void)
+void nrf_802154_tx_work_buffer_is_dynamic_data_updated_set(const uint8_t * p_original_frame)
 {
-    m_is_dynamic_data_updated = true;
+    tx_work_buffer_t * p_work_buffer = work_buffer_find(p_original_frame, true);
+
+    if (p_work_buffer != NULL)
+    {
+        p_work_buffer->is_dynamic_data_updated = true;
+    }
 }
 
-void nrf_802154_tx_work_buffer_plain_text_offset_set(uint8_t offset)
+void nrf_802154_tx_work_buffer_plain_text_offset_set(const uint8_t * p_original_frame,
+                                                     uint8_t         offset)
 {
-    m_plain_text_offset = offset;
+    tx_work_buffer_t * p_work_buffer = work_buffer_find(p_original_frame, true);
+
+    if (p_work_buffer != NULL)
+    {
+        p_work_buffer->plain_text_offset = offset;
+    }
 }
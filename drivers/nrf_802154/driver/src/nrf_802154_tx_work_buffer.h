@@ -43,6 +43,12 @@
  * By default, the using of work buffer is turned off. If desired, it can be turned on with
  * @ref nrf_802154_tx_work_buffer_enable_for.
  *
+ * The module keeps a ring of @ref NRF_802154_TX_PIPELINE_DEPTH work buffers. A work buffer is
+ * allocated to a frame by @ref nrf_802154_tx_work_buffer_reset and stays allocated until
+ * the transmission result of the frame is reported with
+ * @ref nrf_802154_tx_work_buffer_original_frame_update, so that the next frame can be prepared
+ * while the previous one is still being transmitted.
+ *
  */
 
 #ifndef NRF_802154_TX_WORK_BUFFER_H_
@@ -56,14 +62,22 @@
 /**
  * @brief Resets work buffer.
  *
- * Internal state of the work buffer is completely reset after this call.
- * If @p p_frame_props is not NULL, the work buffer properties are set according to the contents
- * of the given structure.
+ * A work buffer is allocated to @p p_original_frame and its internal state is completely reset
+ * after this call. If @p p_frame_props is not NULL, the work buffer properties are set according
+ * to the contents of the given structure.
+ *
+ * The work buffer already allocated to @p p_original_frame is reused. Otherwise, a work buffer
+ * whose frame transmission result has already been reported is taken. If there is none, the oldest
+ * work buffer is overwritten.
  *
- * @param[in]  p_frame_props  Pointer to a structure containing the initial properties that will
- *                            be set for the work buffer.
+ * @param[in]  p_original_frame  Pointer to the original frame to be transmitted or NULL if
+ *                               the frame is not known yet, as it is the case for ACK frames.
+ *                               Work buffers reset with NULL can be reused at any time.
+ * @param[in]  p_frame_props     Pointer to a structure containing the initial properties that will
+ *                               be set for the work buffer.
  */
-void nrf_802154_tx_work_buffer_reset(const nrf_802154_transmitted_frame_props_t * p_frame_props);
+void nrf_802154_tx_work_buffer_reset(const uint8_t                              * p_original_frame,
+                                     const nrf_802154_transmitted_frame_props_t * p_frame_props);
 
 /**
  * @brief Enables work buffer for provided frame.
@@ -97,7 +111,8 @@ const uint8_t * nrf_802154_tx_work_buffer_get(const uint8_t * p_original_frame);
  * @brief Updates the original buffer with its bound work buffer contents.
  *
  * Processing performed on the work buffer might require copying its contents back to the original
- * buffer. This function performs all necessary updates of the original buffer in place.
+ * buffer. This function performs all necessary updates of the original buffer in place and
+ * releases the work buffer for the next frames.
  *
  * @param[inout]    p_original_frame    Pointer to the original frame to be transmitted.
  * @param[out]      p_frame_props       Pointer to a structure to which properties of the frame
@@ -109,19 +124,25 @@ void nrf_802154_tx_work_buffer_original_frame_update(
 
 /**
  * @brief Marks a work buffer as secured.
+ *
+ * @param[in]  p_original_frame  Pointer to the original frame the work buffer is allocated to.
  */
-void nrf_802154_tx_work_buffer_is_secured_set(void);
+void nrf_802154_tx_work_buffer_is_secured_set(const uint8_t * p_original_frame);
 
 /**
  * @brief Marks a work buffer as containing updated dynamic data.
+ *
+ * @param[in]  p_original_frame  Pointer to the original frame the work buffer is allocated to.
  */
-void nrf_802154_tx_work_buffer_is_dynamic_data_updated_set(void);
+void nrf_802154_tx_work_buffer_is_dynamic_data_updated_set(const uint8_t * p_original_frame);
 
 /**
  * @brief Sets offset of encryption plain text for the work buffer.
  *
- * @param[in]  offset  Offset of encryption plain text to be set.
+ * @param[in]  p_original_frame  Pointer to the original frame the work buffer is allocated to.
+ * @param[in]  offset            Offset of encryption plain text to be set.
  */
-void nrf_802154_tx_work_buffer_plain_text_offset_set(uint8_t offset);
+void nrf_802154_tx_work_buffer_plain_text_offset_set(const uint8_t * p_original_frame,
+                                                     uint8_t         offset);
 
 #endif // NRF_802154_TX_WORK_BUFFER_H_
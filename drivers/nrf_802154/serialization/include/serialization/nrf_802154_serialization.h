@@ -42,6 +42,8 @@
 #ifndef NRF_802154_SERIALIZATION_H_
 #define NRF_802154_SERIALIZATION_H_
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -52,6 +54,34 @@ extern "C" {
  */
 void nrf_802154_serialization_init(void);
 
+/**
+ * @brief Statistics of received frame notification batching.
+ */
+typedef struct
+{
+    uint32_t batches;              ///< Number of batches sent.
+    uint32_t frames;               ///< Number of frames sent in batches.
+    uint8_t  max_frames_per_batch; ///< Largest number of frames sent in a single batch.
+    uint32_t max_delay_us;         ///< Longest time a frame was held in a batch before it was sent.
+    uint64_t total_delay_us;       ///< Sum of times each frame was held in a batch before it was sent.
+} nrf_802154_serialization_rx_batch_stats_t;
+
+/**
+ * @brief Sends received frames pending in the notification batch.
+ *
+ * This function is available on the network core when @ref NRF_802154_SPINEL_RX_BATCH_ENABLED
+ * is set. The batch is sent automatically when it exceeds its budget, so calling this function is
+ * needed only to deliver the pending frames earlier. It may be called from any context.
+ */
+void nrf_802154_serialization_rx_batch_flush(void);
+
+/**
+ * @brief Gets statistics of received frame notification batching.
+ *
+ * @param[out]  p_stats  Pointer to the structure to be filled.
+ */
+void nrf_802154_serialization_rx_batch_stats_get(nrf_802154_serialization_rx_batch_stats_t * p_stats);
+
 #ifdef __cplusplus
 }
 #endif
@@ -49,4 +49,57 @@
 #define NRF_802154_TX_BUFFERS 4
 #endif
 
+/**
+ * @brief Enables precompiled spinel codecs for the most frequent properties.
+ *
+ * When enabled, properties on the frame reception path are packed and unpacked with the
+ * specialized functions from nrf_802154_spinel_codecs.h instead of the generic spinel
+ * format string interpreter. The codecs are generated by utils/gen_spinel_codecs.py.
+ */
+#ifndef NRF_802154_SPINEL_CODECS_ENABLED
+#define NRF_802154_SPINEL_CODECS_ENABLED 0
+#endif
+
+/**
+ * @brief Enables batching of received frame notifications on the network core.
+ *
+ * When enabled, the network core coalesces several received frames into a single
+ * SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH frame. A batch is sent when
+ * it reaches @ref NRF_802154_SPINEL_RX_BATCH_MAX_FRAMES frames or
+ * @ref NRF_802154_SPINEL_RX_BATCH_MAX_SIZE bytes, before any other notification, when
+ * @ref nrf_802154_serialization_rx_batch_flush is called and at the latest when a timer started
+ * by the oldest frame in the batch expires after @ref NRF_802154_SPINEL_RX_BATCH_MAX_LATENCY_US.
+ *
+ * The batch is taken over inside the serialization critical section and sent outside of it.
+ * A batch to be sent while a preempted context is sending the previous one is sent by that context
+ * right after, so the batches keep their order.
+ */
+#ifndef NRF_802154_SPINEL_RX_BATCH_ENABLED
+#define NRF_802154_SPINEL_RX_BATCH_ENABLED 0
+#endif
+
+/**
+ * @brief Maximum number of received frames in a single batch.
+ */
+#ifndef NRF_802154_SPINEL_RX_BATCH_MAX_FRAMES
+#define NRF_802154_SPINEL_RX_BATCH_MAX_FRAMES 8
+#endif
+
+/**
+ * @brief Maximum number of bytes of batch entries in a single batch.
+ *
+ * Together with the command header and the frame counter the batch must fit in
+ * @ref NRF_802154_SPINEL_FRAME_MAX_SIZE.
+ */
+#ifndef NRF_802154_SPINEL_RX_BATCH_MAX_SIZE
+#define NRF_802154_SPINEL_RX_BATCH_MAX_SIZE 280
+#endif
+
+/**
+ * @brief Maximum time in microseconds for which a received frame is held in a batch.
+ */
+#ifndef NRF_802154_SPINEL_RX_BATCH_MAX_LATENCY_US
+#define NRF_802154_SPINEL_RX_BATCH_MAX_LATENCY_US 2000
+#endif
+
 #endif // NRF_802154_SER_CONFIG_H__
@@ -193,6 +193,22 @@ bool nrf_802154_buffer_mgr_dst_search_by_local_pointer(
     void                        * p_local_pointer,
     uint32_t                    * p_buffer_handle);
 
+/**@brief Searches a local buffer pointer by a remote buffer handle.
+ *
+ * @param[in,out] p_obj            Pointer to a buffer manager object.
+ * @param[in]     buffer_handle    Handle of a remote buffer passed to
+ *                                 @ref nrf_802154_buffer_mgr_dst_add
+ * @param[out]    pp_local_pointer Local pointer associated with @p buffer_handle
+ *
+ * @retval true     Given @p buffer_handle has been found. The local pointer associated with
+ *                  the handle is available at @c *pp_local_pointer.
+ * @retval false    Given @p buffer_handle has not been found.
+ */
+bool nrf_802154_buffer_mgr_dst_search_by_buffer_handle(
+    nrf_802154_buffer_mgr_dst_t * p_obj,
+    uint32_t                      buffer_handle,
+    void                       ** pp_local_pointer);
+
 /**@brief Removes a local pointer to remote buffer handle association from a buffer manager.
  *
  * This function frees buffer pointed by a @p p_local_pointer if it exists in buffer manager.
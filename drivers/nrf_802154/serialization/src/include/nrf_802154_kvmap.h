@@ -171,4 +171,25 @@ bool nrf_802154_kvmap_search(const nrf_802154_kvmap_t * p_kvmap,
                              const void               * p_key,
                              void                     * p_value);
 
+/**@brief Searches for a value in a key-value map.
+ *
+ * If the value is associated with more than one key, the key added first is retrieved.
+ *
+ * @param[in]  p_kvmap  Pointer to a key-value map to search.
+ * @param[in]  p_value  Pointer to a value to search. Must not be NULL.
+ *                      The size of a memory pointed by @p p_value must correspond to
+ *                      @c val_size passed to recent call @ref nrf_802154_kvmap_init.
+ * @param[out] p_key    Pointer to a memory where the key associated with the found value is
+ *                      stored. The size of the memory must correspond to @c key_size passed
+ *                      to recent @ref nrf_802154_kvmap_init.
+ *
+ * @retval true     The value has been found. Key associated with the value is available
+ *                  behind @p p_key pointer.
+ * @retval false    The value has not been found. Memory pointed by @p p_key
+ *                  has been not modified.
+ */
+bool nrf_802154_kvmap_search_by_value(const nrf_802154_kvmap_t * p_kvmap,
+                                      const void               * p_value,
+                                      void                     * p_key);
+
 #endif /* NRF_802154_KVMAP_H_INCLUDED__ */
@@ -42,6 +42,10 @@
 #ifndef NRF_802154_SPINEL_H_
 #define NRF_802154_SPINEL_H_
 
+#include <stddef.h>
+#include <stdint.h>
+
+#include "../spinel_base/spinel.h"
 #include "nrf_802154_serialization_error.h"
 #include "nrf_802154_buffer_mgr_dst.h"
 #include "nrf_802154_buffer_mgr_src.h"
@@ -83,6 +87,42 @@ extern "C" {
  */
 nrf_802154_ser_err_t nrf_802154_spinel_send(const char * p_fmt, ...);
 
+/**
+ * @brief Maximal size of a spinel command header with a property key.
+ */
+#define NRF_802154_SPINEL_PROP_HEADER_MAX_SIZE 7
+
+/**
+ * @brief Packs spinel command header followed by a property key.
+ *
+ * The header is packed in the same way as @ref SPINEL_DATATYPE_COMMAND_PROP_S, so the property
+ * value can be packed directly after it by a precompiled codec.
+ *
+ * @param[out] p_buff  Buffer of at least @ref NRF_802154_SPINEL_PROP_HEADER_MAX_SIZE bytes.
+ * @param[in]  cmd     Spinel command.
+ * @param[in]  prop    Spinel property key.
+ *
+ * @returns  Number of bytes written to @p p_buff.
+ */
+size_t nrf_802154_spinel_prop_header_pack(uint8_t         * p_buff,
+                                          spinel_command_t  cmd,
+                                          spinel_prop_key_t prop);
+
+/**
+ * @brief Sends a spinel frame packed in place by @ref nrf_802154_spinel_prop_header_pack
+ *        and a precompiled codec.
+ *
+ * @param[in]  p_buff     Buffer containing the frame.
+ * @param[in]  hdr_len    Length of the header returned by @ref nrf_802154_spinel_prop_header_pack.
+ * @param[in]  value_len  Length of the property value returned by the codec, negative if
+ *                        packing failed.
+ *
+ * @returns  zero on success or negative error value on failure.
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_packed_send(const uint8_t * p_buff,
+                                                   size_t          hdr_len,
+                                                   spinel_ssize_t  value_len);
+
 /**
  * @brief Gets buffer manager for transactions originated by the remote serialization peer.
  *
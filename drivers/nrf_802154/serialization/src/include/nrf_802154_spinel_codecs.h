@@ -0,0 +1,6997 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* autogenerated using Nordic HAL utils/gen_spinel_codecs.py script */
+
+#ifndef NRF_802154_SPINEL_CODECS_H_
+#define NRF_802154_SPINEL_CODECS_H_
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../spinel_base/spinel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH 32767
+
+static inline void nrf_802154_spinel_codec_uint16_put(uint8_t * p_out, uint16_t value)
+{
+    p_out[0] = (uint8_t)(value >> 0);
+    p_out[1] = (uint8_t)(value >> 8);
+}
+
+static inline void nrf_802154_spinel_codec_uint32_put(uint8_t * p_out, uint32_t value)
+{
+    p_out[0] = (uint8_t)(value >> 0);
+    p_out[1] = (uint8_t)(value >> 8);
+    p_out[2] = (uint8_t)(value >> 16);
+    p_out[3] = (uint8_t)(value >> 24);
+}
+
+static inline void nrf_802154_spinel_codec_uint64_put(uint8_t * p_out, uint64_t value)
+{
+    nrf_802154_spinel_codec_uint32_put(&p_out[0], (uint32_t)value);
+    nrf_802154_spinel_codec_uint32_put(&p_out[4], (uint32_t)(value >> 32));
+}
+
+static inline uint16_t nrf_802154_spinel_codec_uint16_get(const uint8_t * p_in)
+{
+    return (uint16_t)(((uint16_t)p_in[1] << 8) | p_in[0]);
+}
+
+static inline uint32_t nrf_802154_spinel_codec_uint32_get(const uint8_t * p_in)
+{
+    return ((uint32_t)p_in[3] << 24) | ((uint32_t)p_in[2] << 16) |
+           ((uint32_t)p_in[1] << 8) | p_in[0];
+}
+
+static inline uint64_t nrf_802154_spinel_codec_uint64_get(const uint8_t * p_in)
+{
+    return ((uint64_t)nrf_802154_spinel_codec_uint32_get(&p_in[4]) << 32) |
+           nrf_802154_spinel_codec_uint32_get(&p_in[0]);
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR ("dC").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ack_data_clear_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    const void * p_arg0,
+    size_t       arg0_len,
+    uint8_t      arg1)
+{
+    size_t len = arg0_len + 3;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint16_put(&p_out[0], (uint16_t)arg0_len);
+    if (p_arg0 != NULL)
+    {
+        memcpy(&p_out[2], p_arg0, arg0_len);
+    }
+    p_out[arg0_len + 2] = arg1;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR ("dC").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ack_data_clear_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    const void   ** pp_arg0,
+    size_t        * p_arg0_len,
+    uint8_t       * p_arg1)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    *p_arg0_len = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+
+    if ((*p_arg0_len >= SPINEL_FRAME_MAX_SIZE) || ((in_len - off - 2U) < *p_arg0_len))
+    {
+        return -1;
+    }
+
+    *pp_arg0 = &p_in[off + 2U];
+    off      += 2U + *p_arg0_len;
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg1 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ack_data_clear_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ack_data_clear_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_ACK_DATA_REMOVE_ALL ("bC").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ack_data_remove_all_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0,
+    uint8_t   arg1)
+{
+    size_t len = 2;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+    p_out[1] = arg1;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_ACK_DATA_REMOVE_ALL ("bC").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ack_data_remove_all_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0,
+    uint8_t       * p_arg1)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    *p_arg1 = p_in[off + 1];
+    off += 2U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET ("ddC").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ack_data_set_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    const void * p_arg0,
+    size_t       arg0_len,
+    const void * p_arg1,
+    size_t       arg1_len,
+    uint8_t      arg2)
+{
+    size_t len = arg0_len + arg1_len + 5;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint16_put(&p_out[0], (uint16_t)arg0_len);
+    if (p_arg0 != NULL)
+    {
+        memcpy(&p_out[2], p_arg0, arg0_len);
+    }
+    nrf_802154_spinel_codec_uint16_put(&p_out[arg0_len + 2], (uint16_t)arg1_len);
+    if (p_arg1 != NULL)
+    {
+        memcpy(&p_out[arg0_len + 4], p_arg1, arg1_len);
+    }
+    p_out[arg0_len + arg1_len + 4] = arg2;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET ("ddC").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ack_data_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    const void   ** pp_arg0,
+    size_t        * p_arg0_len,
+    const void   ** pp_arg1,
+    size_t        * p_arg1_len,
+    uint8_t       * p_arg2)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    *p_arg0_len = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+
+    if ((*p_arg0_len >= SPINEL_FRAME_MAX_SIZE) || ((in_len - off - 2U) < *p_arg0_len))
+    {
+        return -1;
+    }
+
+    *pp_arg0 = &p_in[off + 2U];
+    off      += 2U + *p_arg0_len;
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    *p_arg1_len = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+
+    if ((*p_arg1_len >= SPINEL_FRAME_MAX_SIZE) || ((in_len - off - 2U) < *p_arg1_len))
+    {
+        return -1;
+    }
+
+    *pp_arg1 = &p_in[off + 2U];
+    off      += 2U + *p_arg1_len;
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg2 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ack_data_set_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ack_data_set_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_AUTO_PENDING_BIT_SET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_auto_pending_bit_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_AUTO_PENDING_BIT_SET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_auto_pending_bit_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW ("L").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_buffer_free_raw_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint32_t  arg0)
+{
+    size_t len = 4;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint32_put(&p_out[0], arg0);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW ("L").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_buffer_free_raw_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint32_t      * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 4U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint32_get(&p_in[off]);
+    off += 4U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CAPABILITIES_GET ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_capabilities_get_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CAPABILITIES_GET ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_capabilities_get_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CAPABILITIES_GET_RET ("L").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_capabilities_get_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint32_t  arg0)
+{
+    size_t len = 4;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint32_put(&p_out[0], arg0);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CAPABILITIES_GET_RET ("L").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_capabilities_get_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint32_t      * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 4U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint32_get(&p_in[off]);
+    off += 4U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CCA ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_cca_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CCA ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_cca_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CCA_CFG_GET ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_cca_cfg_get_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CCA_CFG_GET ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_cca_cfg_get_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CCA_CFG_GET_RET ("CCCC").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_cca_cfg_get_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0,
+    uint8_t   arg1,
+    uint8_t   arg2,
+    uint8_t   arg3)
+{
+    size_t len = 4;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+    p_out[1] = arg1;
+    p_out[2] = arg2;
+    p_out[3] = arg3;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CCA_CFG_GET_RET ("CCCC").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_cca_cfg_get_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0,
+    uint8_t       * p_arg1,
+    uint8_t       * p_arg2,
+    uint8_t       * p_arg3)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 4U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    *p_arg1 = p_in[off + 1];
+    *p_arg2 = p_in[off + 2];
+    *p_arg3 = p_in[off + 3];
+    off += 4U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CCA_CFG_SET ("CCCC").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_cca_cfg_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0,
+    uint8_t   arg1,
+    uint8_t   arg2,
+    uint8_t   arg3)
+{
+    size_t len = 4;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+    p_out[1] = arg1;
+    p_out[2] = arg2;
+    p_out[3] = arg3;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CCA_CFG_SET ("CCCC").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_cca_cfg_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0,
+    uint8_t       * p_arg1,
+    uint8_t       * p_arg2,
+    uint8_t       * p_arg3)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 4U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    *p_arg1 = p_in[off + 1];
+    *p_arg2 = p_in[off + 2];
+    *p_arg3 = p_in[off + 3];
+    off += 4U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CCA_DONE ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_cca_done_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CCA_DONE ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_cca_done_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CCA_FAILED ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_cca_failed_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CCA_FAILED ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_cca_failed_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CCA_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_cca_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CCA_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_cca_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CHANNEL_GET ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_channel_get_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CHANNEL_GET ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_channel_get_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CHANNEL_GET_RET ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_channel_get_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CHANNEL_GET_RET ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_channel_get_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CHANNEL_SET ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_channel_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CHANNEL_SET ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_channel_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CONTINUOUS_CARRIER ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_continuous_carrier_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CONTINUOUS_CARRIER ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_continuous_carrier_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CONTINUOUS_CARRIER_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_continuous_carrier_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CONTINUOUS_CARRIER_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_continuous_carrier_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CSL_WRITER_ANCHOR_TIME_SET ("X").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csl_writer_anchor_time_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint64_t  arg0)
+{
+    size_t len = 8;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint64_put(&p_out[0], arg0);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CSL_WRITER_ANCHOR_TIME_SET ("X").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csl_writer_anchor_time_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint64_t      * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 8U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint64_get(&p_in[off]);
+    off += 8U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CSL_WRITER_PERIOD_SET ("S").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csl_writer_period_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint16_t  arg0)
+{
+    size_t len = 2;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint16_put(&p_out[0], arg0);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CSL_WRITER_PERIOD_SET ("S").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csl_writer_period_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint16_t      * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+    off += 2U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_backoff_policy_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_backoff_policy_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_backoff_policy_set_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_backoff_policy_set_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_max_backoffs_get_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_max_backoffs_get_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET_RET ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_max_backoffs_get_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET_RET ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_max_backoffs_get_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_max_backoffs_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_max_backoffs_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_GET ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_max_be_get_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_GET ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_max_be_get_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_GET_RET ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_max_be_get_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_GET_RET ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_max_be_get_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_max_be_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_max_be_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_max_be_set_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_max_be_set_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_GET ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_min_be_get_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_GET ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_min_be_get_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_GET_RET ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_min_be_get_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_GET_RET ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_min_be_get_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_min_be_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_min_be_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_min_be_set_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_csma_ca_min_be_set_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED ("c").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_energy_detected_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    int8_t    arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = (uint8_t)arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED ("c").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_energy_detected_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    int8_t        * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (int8_t)p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED_SWEEP ("cL").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_energy_detected_sweep_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    int8_t    arg0,
+    uint32_t  arg1)
+{
+    size_t len = 5;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = (uint8_t)arg0;
+    nrf_802154_spinel_codec_uint32_put(&p_out[1], arg1);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED_SWEEP ("cL").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_energy_detected_sweep_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    int8_t        * p_arg0,
+    uint32_t      * p_arg1)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 5U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (int8_t)p_in[off];
+    *p_arg1 = nrf_802154_spinel_codec_uint32_get(&p_in[off + 1]);
+    off += 5U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION ("L").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_energy_detection_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint32_t  arg0)
+{
+    size_t len = 4;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint32_put(&p_out[0], arg0);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION ("L").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_energy_detection_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint32_t      * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 4U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint32_get(&p_in[off]);
+    off += 4U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_FAILED ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_energy_detection_failed_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_FAILED ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_energy_detection_failed_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_energy_detection_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_energy_detection_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP ("LLS").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_energy_detection_sweep_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint32_t  arg0,
+    uint32_t  arg1,
+    uint16_t  arg2)
+{
+    size_t len = 10;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint32_put(&p_out[0], arg0);
+    nrf_802154_spinel_codec_uint32_put(&p_out[4], arg1);
+    nrf_802154_spinel_codec_uint16_put(&p_out[8], arg2);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP ("LLS").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_energy_detection_sweep_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint32_t      * p_arg0,
+    uint32_t      * p_arg1,
+    uint16_t      * p_arg2)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 10U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint32_get(&p_in[off]);
+    *p_arg1 = nrf_802154_spinel_codec_uint32_get(&p_in[off + 4]);
+    *p_arg2 = nrf_802154_spinel_codec_uint16_get(&p_in[off + 8]);
+    off += 10U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP_CHANNEL ("CScccD").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_energy_detection_sweep_channel_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    uint8_t      arg0,
+    uint16_t     arg1,
+    int8_t       arg2,
+    int8_t       arg3,
+    int8_t       arg4,
+    const void * p_arg5,
+    size_t       arg5_len)
+{
+    size_t len = arg5_len + 6;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+    nrf_802154_spinel_codec_uint16_put(&p_out[1], arg1);
+    p_out[3] = (uint8_t)arg2;
+    p_out[4] = (uint8_t)arg3;
+    p_out[5] = (uint8_t)arg4;
+    if (p_arg5 != NULL)
+    {
+        memcpy(&p_out[6], p_arg5, arg5_len);
+    }
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP_CHANNEL ("CScccD").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_energy_detection_sweep_channel_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0,
+    uint16_t      * p_arg1,
+    int8_t        * p_arg2,
+    int8_t        * p_arg3,
+    int8_t        * p_arg4,
+    const void   ** pp_arg5,
+    size_t        * p_arg5_len)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 6U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    *p_arg1 = nrf_802154_spinel_codec_uint16_get(&p_in[off + 1]);
+    *p_arg2 = (int8_t)p_in[off + 3];
+    *p_arg3 = (int8_t)p_in[off + 4];
+    *p_arg4 = (int8_t)p_in[off + 5];
+    off += 6U;
+
+    *pp_arg5    = &p_in[off];
+    *p_arg5_len = in_len - off;
+    off         = in_len;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_energy_detection_sweep_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_energy_detection_sweep_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_EXTENDED_ADDRESS_SET ("D").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_extended_address_set_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    const void * p_arg0,
+    size_t       arg0_len)
+{
+    size_t len = arg0_len;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    if (p_arg0 != NULL)
+    {
+        memcpy(&p_out[0], p_arg0, arg0_len);
+    }
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_EXTENDED_ADDRESS_SET ("D").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_extended_address_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    const void   ** pp_arg0,
+    size_t        * p_arg0_len)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    *pp_arg0    = &p_in[off];
+    *p_arg0_len = in_len - off;
+    off         = in_len;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_GET ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_min_lifs_period_get_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_GET ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_min_lifs_period_get_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_GET_RET ("S").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_min_lifs_period_get_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint16_t  arg0)
+{
+    size_t len = 2;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint16_put(&p_out[0], arg0);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_GET_RET ("S").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_min_lifs_period_get_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint16_t      * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+    off += 2U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_SET ("S").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_min_lifs_period_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint16_t  arg0)
+{
+    size_t len = 2;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint16_put(&p_out[0], arg0);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_SET ("S").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_min_lifs_period_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint16_t      * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+    off += 2U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_GET ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_min_sifs_period_get_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_GET ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_min_sifs_period_get_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_GET_RET ("S").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_min_sifs_period_get_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint16_t  arg0)
+{
+    size_t len = 2;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint16_put(&p_out[0], arg0);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_GET_RET ("S").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_min_sifs_period_get_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint16_t      * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+    off += 2U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_SET ("S").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_min_sifs_period_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint16_t  arg0)
+{
+    size_t len = 2;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint16_put(&p_out[0], arg0);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_SET ("S").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_min_sifs_period_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint16_t      * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+    off += 2U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_IFS_MODE_GET ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_mode_get_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_IFS_MODE_GET ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_mode_get_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_IFS_MODE_GET_RET ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_mode_get_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_IFS_MODE_GET_RET ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_mode_get_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_mode_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_mode_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_mode_set_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_ifs_mode_set_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_MODULATED_CARRIER ("D").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_modulated_carrier_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    const void * p_arg0,
+    size_t       arg0_len)
+{
+    size_t len = arg0_len;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    if (p_arg0 != NULL)
+    {
+        memcpy(&p_out[0], p_arg0, arg0_len);
+    }
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_MODULATED_CARRIER ("D").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_modulated_carrier_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    const void   ** pp_arg0,
+    size_t        * p_arg0_len)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    *pp_arg0    = &p_in[off];
+    *p_arg0_len = in_len - off;
+    off         = in_len;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_MODULATED_CARRIER_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_modulated_carrier_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_MODULATED_CARRIER_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_modulated_carrier_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_PAN_COORD_GET ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_pan_coord_get_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_PAN_COORD_GET ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_pan_coord_get_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_PAN_COORD_GET_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_pan_coord_get_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_PAN_COORD_GET_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_pan_coord_get_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_PAN_COORD_SET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_pan_coord_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_PAN_COORD_SET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_pan_coord_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_PAN_ID_SET ("D").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_pan_id_set_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    const void * p_arg0,
+    size_t       arg0_len)
+{
+    size_t len = arg0_len;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    if (p_arg0 != NULL)
+    {
+        memcpy(&p_out[0], p_arg0, arg0_len);
+    }
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_PAN_ID_SET ("D").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_pan_id_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    const void   ** pp_arg0,
+    size_t        * p_arg0_len)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    *pp_arg0    = &p_in[off];
+    *p_arg0_len = in_len - off;
+    off         = in_len;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR ("D").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_pending_bit_for_addr_clear_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    const void * p_arg0,
+    size_t       arg0_len)
+{
+    size_t len = arg0_len;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    if (p_arg0 != NULL)
+    {
+        memcpy(&p_out[0], p_arg0, arg0_len);
+    }
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR ("D").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_pending_bit_for_addr_clear_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    const void   ** pp_arg0,
+    size_t        * p_arg0_len)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    *pp_arg0    = &p_in[off];
+    *p_arg0_len = in_len - off;
+    off         = in_len;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_pending_bit_for_addr_clear_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_pending_bit_for_addr_clear_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_RESET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_pending_bit_for_addr_reset_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_RESET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_pending_bit_for_addr_reset_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET ("D").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_pending_bit_for_addr_set_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    const void * p_arg0,
+    size_t       arg0_len)
+{
+    size_t len = arg0_len;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    if (p_arg0 != NULL)
+    {
+        memcpy(&p_out[0], p_arg0, arg0_len);
+    }
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET ("D").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_pending_bit_for_addr_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    const void   ** pp_arg0,
+    size_t        * p_arg0_len)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    *pp_arg0    = &p_in[off];
+    *p_arg0_len = in_len - off;
+    off         = in_len;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_pending_bit_for_addr_set_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_pending_bit_for_addr_set_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_PROMISCUOUS_SET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_promiscuous_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_PROMISCUOUS_SET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_promiscuous_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_RECEIVE ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_RECEIVE ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW ("t(LD)cCX").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_received_timestamp_raw_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    uint32_t     arg0,
+    const void * p_arg1,
+    size_t       arg1_len,
+    int8_t       arg2,
+    uint8_t      arg3,
+    uint64_t     arg4)
+{
+    size_t len = arg1_len + 16;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint16_put(&p_out[0], (uint16_t)(arg1_len + 4));
+    nrf_802154_spinel_codec_uint32_put(&p_out[2], arg0);
+    if (p_arg1 != NULL)
+    {
+        memcpy(&p_out[6], p_arg1, arg1_len);
+    }
+    p_out[arg1_len + 6] = (uint8_t)arg2;
+    p_out[arg1_len + 7] = arg3;
+    nrf_802154_spinel_codec_uint64_put(&p_out[arg1_len + 8], arg4);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW ("t(LD)cCX").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_received_timestamp_raw_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint32_t      * p_arg0,
+    const void   ** pp_arg1,
+    size_t        * p_arg1_len,
+    int8_t        * p_arg2,
+    uint8_t       * p_arg3,
+    uint64_t      * p_arg4)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    size_t struct0_end = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+
+    if ((struct0_end >= SPINEL_FRAME_MAX_SIZE) || ((in_len - off - 2U) < struct0_end))
+    {
+        return -1;
+    }
+
+    struct0_end += off + 2U;
+    off         += 2U;
+
+    if ((struct0_end - off) < 4U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint32_get(&p_in[off]);
+    off += 4U;
+
+    *pp_arg1    = &p_in[off];
+    *p_arg1_len = struct0_end - off;
+    off         = struct0_end;
+
+    if ((in_len - off) < 10U)
+    {
+        return -1;
+    }
+
+    *p_arg2 = (int8_t)p_in[off];
+    *p_arg3 = p_in[off + 1];
+    *p_arg4 = nrf_802154_spinel_codec_uint64_get(&p_in[off + 2]);
+    off += 10U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH ("CD").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_received_timestamp_raw_batch_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    uint8_t      arg0,
+    const void * p_arg1,
+    size_t       arg1_len)
+{
+    size_t len = arg1_len + 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+    if (p_arg1 != NULL)
+    {
+        memcpy(&p_out[1], p_arg1, arg1_len);
+    }
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH ("CD").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_received_timestamp_raw_batch_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0,
+    const void   ** pp_arg1,
+    size_t        * p_arg1_len)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    *pp_arg1    = &p_in[off];
+    *p_arg1_len = in_len - off;
+    off         = in_len;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH_ENTRY ("t(t(LD)cCX)").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_received_timestamp_raw_batch_entry_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    uint32_t     arg0,
+    const void * p_arg1,
+    size_t       arg1_len,
+    int8_t       arg2,
+    uint8_t      arg3,
+    uint64_t     arg4)
+{
+    size_t len = arg1_len + 18;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint16_put(&p_out[0], (uint16_t)(arg1_len + 16));
+    nrf_802154_spinel_codec_uint16_put(&p_out[2], (uint16_t)(arg1_len + 4));
+    nrf_802154_spinel_codec_uint32_put(&p_out[4], arg0);
+    if (p_arg1 != NULL)
+    {
+        memcpy(&p_out[8], p_arg1, arg1_len);
+    }
+    p_out[arg1_len + 8] = (uint8_t)arg2;
+    p_out[arg1_len + 9] = arg3;
+    nrf_802154_spinel_codec_uint64_put(&p_out[arg1_len + 10], arg4);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH_ENTRY ("t(t(LD)cCX)").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_received_timestamp_raw_batch_entry_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint32_t      * p_arg0,
+    const void   ** pp_arg1,
+    size_t        * p_arg1_len,
+    int8_t        * p_arg2,
+    uint8_t       * p_arg3,
+    uint64_t      * p_arg4)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    size_t struct0_end = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+
+    if ((struct0_end >= SPINEL_FRAME_MAX_SIZE) || ((in_len - off - 2U) < struct0_end))
+    {
+        return -1;
+    }
+
+    struct0_end += off + 2U;
+    off         += 2U;
+
+    if ((struct0_end - off) < 2U)
+    {
+        return -1;
+    }
+
+    size_t struct1_end = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+
+    if ((struct1_end >= SPINEL_FRAME_MAX_SIZE) || ((struct0_end - off - 2U) < struct1_end))
+    {
+        return -1;
+    }
+
+    struct1_end += off + 2U;
+    off         += 2U;
+
+    if ((struct1_end - off) < 4U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint32_get(&p_in[off]);
+    off += 4U;
+
+    *pp_arg1    = &p_in[off];
+    *p_arg1_len = struct1_end - off;
+    off         = struct1_end;
+
+    if ((struct0_end - off) < 10U)
+    {
+        return -1;
+    }
+
+    *p_arg2 = (int8_t)p_in[off];
+    *p_arg3 = p_in[off + 1];
+    *p_arg4 = nrf_802154_spinel_codec_uint64_get(&p_in[off + 2]);
+    off += 10U;
+
+    off = struct0_end;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_AT ("XLCL").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_at_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint64_t  arg0,
+    uint32_t  arg1,
+    uint8_t   arg2,
+    uint32_t  arg3)
+{
+    size_t len = 17;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint64_put(&p_out[0], arg0);
+    nrf_802154_spinel_codec_uint32_put(&p_out[8], arg1);
+    p_out[12] = arg2;
+    nrf_802154_spinel_codec_uint32_put(&p_out[13], arg3);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_AT ("XLCL").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_at_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint64_t      * p_arg0,
+    uint32_t      * p_arg1,
+    uint8_t       * p_arg2,
+    uint32_t      * p_arg3)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 17U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint64_get(&p_in[off]);
+    *p_arg1 = nrf_802154_spinel_codec_uint32_get(&p_in[off + 8]);
+    *p_arg2 = p_in[off + 12];
+    *p_arg3 = nrf_802154_spinel_codec_uint32_get(&p_in[off + 13]);
+    off += 17U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL ("L").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_at_cancel_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint32_t  arg0)
+{
+    size_t len = 4;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint32_put(&p_out[0], arg0);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL ("L").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_at_cancel_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint32_t      * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 4U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint32_get(&p_in[off]);
+    off += 4U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_at_cancel_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_at_cancel_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_at_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_at_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_FAILED ("CL").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_failed_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0,
+    uint32_t  arg1)
+{
+    size_t len = 5;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+    nrf_802154_spinel_codec_uint32_put(&p_out[1], arg1);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_FAILED ("CL").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_failed_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0,
+    uint32_t      * p_arg1)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 5U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    *p_arg1 = nrf_802154_spinel_codec_uint32_get(&p_in[off + 1]);
+    off += 5U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_START ("CXLLd").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_periodic_start_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    uint8_t      arg0,
+    uint64_t     arg1,
+    uint32_t     arg2,
+    uint32_t     arg3,
+    const void * p_arg4,
+    size_t       arg4_len)
+{
+    size_t len = arg4_len + 19;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+    nrf_802154_spinel_codec_uint64_put(&p_out[1], arg1);
+    nrf_802154_spinel_codec_uint32_put(&p_out[9], arg2);
+    nrf_802154_spinel_codec_uint32_put(&p_out[13], arg3);
+    nrf_802154_spinel_codec_uint16_put(&p_out[17], (uint16_t)arg4_len);
+    if (p_arg4 != NULL)
+    {
+        memcpy(&p_out[19], p_arg4, arg4_len);
+    }
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_START ("CXLLd").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_periodic_start_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0,
+    uint64_t      * p_arg1,
+    uint32_t      * p_arg2,
+    uint32_t      * p_arg3,
+    const void   ** pp_arg4,
+    size_t        * p_arg4_len)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 17U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    *p_arg1 = nrf_802154_spinel_codec_uint64_get(&p_in[off + 1]);
+    *p_arg2 = nrf_802154_spinel_codec_uint32_get(&p_in[off + 9]);
+    *p_arg3 = nrf_802154_spinel_codec_uint32_get(&p_in[off + 13]);
+    off += 17U;
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    *p_arg4_len = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+
+    if ((*p_arg4_len >= SPINEL_FRAME_MAX_SIZE) || ((in_len - off - 2U) < *p_arg4_len))
+    {
+        return -1;
+    }
+
+    *pp_arg4 = &p_in[off + 2U];
+    off      += 2U + *p_arg4_len;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_START_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_periodic_start_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_START_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_periodic_start_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STATS_GET ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_periodic_stats_get_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STATS_GET ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_periodic_stats_get_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STATS_GET_RET ("bLLLL").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_periodic_stats_get_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0,
+    uint32_t  arg1,
+    uint32_t  arg2,
+    uint32_t  arg3,
+    uint32_t  arg4)
+{
+    size_t len = 17;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+    nrf_802154_spinel_codec_uint32_put(&p_out[1], arg1);
+    nrf_802154_spinel_codec_uint32_put(&p_out[5], arg2);
+    nrf_802154_spinel_codec_uint32_put(&p_out[9], arg3);
+    nrf_802154_spinel_codec_uint32_put(&p_out[13], arg4);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STATS_GET_RET ("bLLLL").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_periodic_stats_get_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0,
+    uint32_t      * p_arg1,
+    uint32_t      * p_arg2,
+    uint32_t      * p_arg3,
+    uint32_t      * p_arg4)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 17U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    *p_arg1 = nrf_802154_spinel_codec_uint32_get(&p_in[off + 1]);
+    *p_arg2 = nrf_802154_spinel_codec_uint32_get(&p_in[off + 5]);
+    *p_arg3 = nrf_802154_spinel_codec_uint32_get(&p_in[off + 9]);
+    *p_arg4 = nrf_802154_spinel_codec_uint32_get(&p_in[off + 13]);
+    off += 17U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STOP ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_periodic_stop_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STOP ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_periodic_stop_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STOP_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_periodic_stop_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STOP_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_periodic_stop_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_RECEIVE_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_receive_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_RETRANSMISSION_CONFIG_SET ("CCC").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_retransmission_config_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0,
+    uint8_t   arg1,
+    uint8_t   arg2)
+{
+    size_t len = 3;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+    p_out[1] = arg1;
+    p_out[2] = arg2;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_RETRANSMISSION_CONFIG_SET ("CCC").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_retransmission_config_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0,
+    uint8_t       * p_arg1,
+    uint8_t       * p_arg2)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 3U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    *p_arg1 = p_in[off + 1];
+    *p_arg2 = p_in[off + 2];
+    off += 3U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_RETRANSMISSION_CONFIG_SET_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_retransmission_config_set_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_RETRANSMISSION_CONFIG_SET_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_retransmission_config_set_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_RX_ON_WHEN_IDLE_SET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_rx_on_when_idle_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_RX_ON_WHEN_IDLE_SET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_rx_on_when_idle_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_SECURITY_ERROR_RET ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_security_error_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_SECURITY_ERROR_RET ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_security_error_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET ("L").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_security_global_frame_counter_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint32_t  arg0)
+{
+    size_t len = 4;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint32_put(&p_out[0], arg0);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET ("L").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_security_global_frame_counter_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint32_t      * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 4U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint32_get(&p_in[off]);
+    off += 4U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE ("t(CD)").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_security_key_remove_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    uint8_t      arg0,
+    const void * p_arg1,
+    size_t       arg1_len)
+{
+    size_t len = arg1_len + 3;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint16_put(&p_out[0], (uint16_t)(arg1_len + 1));
+    p_out[2] = arg0;
+    if (p_arg1 != NULL)
+    {
+        memcpy(&p_out[3], p_arg1, arg1_len);
+    }
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE ("t(CD)").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_security_key_remove_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0,
+    const void   ** pp_arg1,
+    size_t        * p_arg1_len)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    size_t struct0_end = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+
+    if ((struct0_end >= SPINEL_FRAME_MAX_SIZE) || ((in_len - off - 2U) < struct0_end))
+    {
+        return -1;
+    }
+
+    struct0_end += off + 2U;
+    off         += 2U;
+
+    if ((struct0_end - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    *pp_arg1    = &p_in[off];
+    *p_arg1_len = struct0_end - off;
+    off         = struct0_end;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE_ALL ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_security_key_remove_all_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE_ALL ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_security_key_remove_all_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_STORE ("t(D)t(CD)LLb").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_security_key_store_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    const void * p_arg0,
+    size_t       arg0_len,
+    uint8_t      arg1,
+    const void * p_arg2,
+    size_t       arg2_len,
+    uint32_t     arg3,
+    uint32_t     arg4,
+    bool         arg5)
+{
+    size_t len = arg0_len + arg2_len + 14;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint16_put(&p_out[0], (uint16_t)(arg0_len));
+    if (p_arg0 != NULL)
+    {
+        memcpy(&p_out[2], p_arg0, arg0_len);
+    }
+    nrf_802154_spinel_codec_uint16_put(&p_out[arg0_len + 2], (uint16_t)(arg2_len + 1));
+    p_out[arg0_len + 4] = arg1;
+    if (p_arg2 != NULL)
+    {
+        memcpy(&p_out[arg0_len + 5], p_arg2, arg2_len);
+    }
+    nrf_802154_spinel_codec_uint32_put(&p_out[arg0_len + arg2_len + 5], arg3);
+    nrf_802154_spinel_codec_uint32_put(&p_out[arg0_len + arg2_len + 9], arg4);
+    p_out[arg0_len + arg2_len + 13] = arg5 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_STORE ("t(D)t(CD)LLb").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_security_key_store_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    const void   ** pp_arg0,
+    size_t        * p_arg0_len,
+    uint8_t       * p_arg1,
+    const void   ** pp_arg2,
+    size_t        * p_arg2_len,
+    uint32_t      * p_arg3,
+    uint32_t      * p_arg4,
+    bool          * p_arg5)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    size_t struct0_end = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+
+    if ((struct0_end >= SPINEL_FRAME_MAX_SIZE) || ((in_len - off - 2U) < struct0_end))
+    {
+        return -1;
+    }
+
+    struct0_end += off + 2U;
+    off         += 2U;
+
+    *pp_arg0    = &p_in[off];
+    *p_arg0_len = struct0_end - off;
+    off         = struct0_end;
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    size_t struct1_end = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+
+    if ((struct1_end >= SPINEL_FRAME_MAX_SIZE) || ((in_len - off - 2U) < struct1_end))
+    {
+        return -1;
+    }
+
+    struct1_end += off + 2U;
+    off         += 2U;
+
+    if ((struct1_end - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg1 = p_in[off];
+    off += 1U;
+
+    *pp_arg2    = &p_in[off];
+    *p_arg2_len = struct1_end - off;
+    off         = struct1_end;
+
+    if ((in_len - off) < 9U)
+    {
+        return -1;
+    }
+
+    *p_arg3 = nrf_802154_spinel_codec_uint32_get(&p_in[off]);
+    *p_arg4 = nrf_802154_spinel_codec_uint32_get(&p_in[off + 4]);
+    *p_arg5 = (p_in[off + 8] != 0U);
+    off += 9U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_SHORT_ADDRESS_SET ("D").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_short_address_set_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    const void * p_arg0,
+    size_t       arg0_len)
+{
+    size_t len = arg0_len;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    if (p_arg0 != NULL)
+    {
+        memcpy(&p_out[0], p_arg0, arg0_len);
+    }
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_SHORT_ADDRESS_SET ("D").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_short_address_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    const void   ** pp_arg0,
+    size_t        * p_arg0_len)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    *pp_arg0    = &p_in[off];
+    *p_arg0_len = in_len - off;
+    off         = in_len;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_SLEEP ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_sleep_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_SLEEP ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_sleep_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_SLEEP_IF_IDLE ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_sleep_if_idle_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_SLEEP_IF_IDLE ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_sleep_if_idle_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_SLEEP_IF_IDLE_RET ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_sleep_if_idle_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_SLEEP_IF_IDLE_RET ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_sleep_if_idle_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_SLEEP_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_sleep_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_SLEEP_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_sleep_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_SRC_ADDR_MATCHING_METHOD_SET ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_src_addr_matching_method_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_SRC_ADDR_MATCHING_METHOD_SET ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_src_addr_matching_method_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_STAT_TIMESTAMPS_GET ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_stat_timestamps_get_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_STAT_TIMESTAMPS_GET ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_stat_timestamps_get_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_STAT_TIMESTAMPS_GET_RET ("XXXXXX").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_stat_timestamps_get_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint64_t  arg0,
+    uint64_t  arg1,
+    uint64_t  arg2,
+    uint64_t  arg3,
+    uint64_t  arg4,
+    uint64_t  arg5)
+{
+    size_t len = 48;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint64_put(&p_out[0], arg0);
+    nrf_802154_spinel_codec_uint64_put(&p_out[8], arg1);
+    nrf_802154_spinel_codec_uint64_put(&p_out[16], arg2);
+    nrf_802154_spinel_codec_uint64_put(&p_out[24], arg3);
+    nrf_802154_spinel_codec_uint64_put(&p_out[32], arg4);
+    nrf_802154_spinel_codec_uint64_put(&p_out[40], arg5);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_STAT_TIMESTAMPS_GET_RET ("XXXXXX").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_stat_timestamps_get_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint64_t      * p_arg0,
+    uint64_t      * p_arg1,
+    uint64_t      * p_arg2,
+    uint64_t      * p_arg3,
+    uint64_t      * p_arg4,
+    uint64_t      * p_arg5)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 48U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint64_get(&p_in[off]);
+    *p_arg1 = nrf_802154_spinel_codec_uint64_get(&p_in[off + 8]);
+    *p_arg2 = nrf_802154_spinel_codec_uint64_get(&p_in[off + 16]);
+    *p_arg3 = nrf_802154_spinel_codec_uint64_get(&p_in[off + 24]);
+    *p_arg4 = nrf_802154_spinel_codec_uint64_get(&p_in[off + 32]);
+    *p_arg5 = nrf_802154_spinel_codec_uint64_get(&p_in[off + 40]);
+    off += 48U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_test_mode_csmaca_backoff_get_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_test_mode_csmaca_backoff_get_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET_RET ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_test_mode_csmaca_backoff_get_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET_RET ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_test_mode_csmaca_backoff_get_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TEST_MODE_CSMACA_BACKOFF_SET ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_test_mode_csmaca_backoff_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TEST_MODE_CSMACA_BACKOFF_SET ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_test_mode_csmaca_backoff_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TIME_GET ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_time_get_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TIME_GET ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_time_get_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TIME_GET_RET ("X").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_time_get_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint64_t  arg0)
+{
+    size_t len = 8;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint64_put(&p_out[0], arg0);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TIME_GET_RET ("X").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_time_get_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint64_t      * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 8U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint64_get(&p_in[off]);
+    off += 8U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TRANSMITTED_RAW ("t(LD)bbCCCCcCXt(LD)").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmitted_raw_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    uint32_t     arg0,
+    const void * p_arg1,
+    size_t       arg1_len,
+    bool         arg2,
+    bool         arg3,
+    uint8_t      arg4,
+    uint8_t      arg5,
+    uint8_t      arg6,
+    uint8_t      arg7,
+    int8_t       arg8,
+    uint8_t      arg9,
+    uint64_t     arg10,
+    uint32_t     arg11,
+    const void * p_arg12,
+    size_t       arg12_len)
+{
+    size_t len = arg1_len + arg12_len + 28;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint16_put(&p_out[0], (uint16_t)(arg1_len + 4));
+    nrf_802154_spinel_codec_uint32_put(&p_out[2], arg0);
+    if (p_arg1 != NULL)
+    {
+        memcpy(&p_out[6], p_arg1, arg1_len);
+    }
+    p_out[arg1_len + 6] = arg2 ? 1U : 0U;
+    p_out[arg1_len + 7] = arg3 ? 1U : 0U;
+    p_out[arg1_len + 8] = arg4;
+    p_out[arg1_len + 9] = arg5;
+    p_out[arg1_len + 10] = arg6;
+    p_out[arg1_len + 11] = arg7;
+    p_out[arg1_len + 12] = (uint8_t)arg8;
+    p_out[arg1_len + 13] = arg9;
+    nrf_802154_spinel_codec_uint64_put(&p_out[arg1_len + 14], arg10);
+    nrf_802154_spinel_codec_uint16_put(&p_out[arg1_len + 22], (uint16_t)(arg12_len + 4));
+    nrf_802154_spinel_codec_uint32_put(&p_out[arg1_len + 24], arg11);
+    if (p_arg12 != NULL)
+    {
+        memcpy(&p_out[arg1_len + 28], p_arg12, arg12_len);
+    }
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TRANSMITTED_RAW ("t(LD)bbCCCCcCXt(LD)").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmitted_raw_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint32_t      * p_arg0,
+    const void   ** pp_arg1,
+    size_t        * p_arg1_len,
+    bool          * p_arg2,
+    bool          * p_arg3,
+    uint8_t       * p_arg4,
+    uint8_t       * p_arg5,
+    uint8_t       * p_arg6,
+    uint8_t       * p_arg7,
+    int8_t        * p_arg8,
+    uint8_t       * p_arg9,
+    uint64_t      * p_arg10,
+    uint32_t      * p_arg11,
+    const void   ** pp_arg12,
+    size_t        * p_arg12_len)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    size_t struct0_end = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+
+    if ((struct0_end >= SPINEL_FRAME_MAX_SIZE) || ((in_len - off - 2U) < struct0_end))
+    {
+        return -1;
+    }
+
+    struct0_end += off + 2U;
+    off         += 2U;
+
+    if ((struct0_end - off) < 4U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint32_get(&p_in[off]);
+    off += 4U;
+
+    *pp_arg1    = &p_in[off];
+    *p_arg1_len = struct0_end - off;
+    off         = struct0_end;
+
+    if ((in_len - off) < 16U)
+    {
+        return -1;
+    }
+
+    *p_arg2 = (p_in[off] != 0U);
+    *p_arg3 = (p_in[off + 1] != 0U);
+    *p_arg4 = p_in[off + 2];
+    *p_arg5 = p_in[off + 3];
+    *p_arg6 = p_in[off + 4];
+    *p_arg7 = p_in[off + 5];
+    *p_arg8 = (int8_t)p_in[off + 6];
+    *p_arg9 = p_in[off + 7];
+    *p_arg10 = nrf_802154_spinel_codec_uint64_get(&p_in[off + 8]);
+    off += 16U;
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    size_t struct1_end = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+
+    if ((struct1_end >= SPINEL_FRAME_MAX_SIZE) || ((in_len - off - 2U) < struct1_end))
+    {
+        return -1;
+    }
+
+    struct1_end += off + 2U;
+    off         += 2U;
+
+    if ((struct1_end - off) < 4U)
+    {
+        return -1;
+    }
+
+    *p_arg11 = nrf_802154_spinel_codec_uint32_get(&p_in[off]);
+    off += 4U;
+
+    *pp_arg12    = &p_in[off];
+    *p_arg12_len = struct1_end - off;
+    off          = struct1_end;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_AT_CANCEL ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmit_at_cancel_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_AT_CANCEL ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmit_at_cancel_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_AT_CANCEL_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmit_at_cancel_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_AT_CANCEL_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmit_at_cancel_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW ("bbbcbCt(LD)").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmit_csma_ca_raw_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    bool         arg0,
+    bool         arg1,
+    bool         arg2,
+    int8_t       arg3,
+    bool         arg4,
+    uint8_t      arg5,
+    uint32_t     arg6,
+    const void * p_arg7,
+    size_t       arg7_len)
+{
+    size_t len = arg7_len + 12;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+    p_out[1] = arg1 ? 1U : 0U;
+    p_out[2] = arg2 ? 1U : 0U;
+    p_out[3] = (uint8_t)arg3;
+    p_out[4] = arg4 ? 1U : 0U;
+    p_out[5] = arg5;
+    nrf_802154_spinel_codec_uint16_put(&p_out[6], (uint16_t)(arg7_len + 4));
+    nrf_802154_spinel_codec_uint32_put(&p_out[8], arg6);
+    if (p_arg7 != NULL)
+    {
+        memcpy(&p_out[12], p_arg7, arg7_len);
+    }
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW ("bbbcbCt(LD)").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmit_csma_ca_raw_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0,
+    bool          * p_arg1,
+    bool          * p_arg2,
+    int8_t        * p_arg3,
+    bool          * p_arg4,
+    uint8_t       * p_arg5,
+    uint32_t      * p_arg6,
+    const void   ** pp_arg7,
+    size_t        * p_arg7_len)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 6U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    *p_arg1 = (p_in[off + 1] != 0U);
+    *p_arg2 = (p_in[off + 2] != 0U);
+    *p_arg3 = (int8_t)p_in[off + 3];
+    *p_arg4 = (p_in[off + 4] != 0U);
+    *p_arg5 = p_in[off + 5];
+    off += 6U;
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    size_t struct0_end = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+
+    if ((struct0_end >= SPINEL_FRAME_MAX_SIZE) || ((in_len - off - 2U) < struct0_end))
+    {
+        return -1;
+    }
+
+    struct0_end += off + 2U;
+    off         += 2U;
+
+    if ((struct0_end - off) < 4U)
+    {
+        return -1;
+    }
+
+    *p_arg6 = nrf_802154_spinel_codec_uint32_get(&p_in[off]);
+    off += 4U;
+
+    *pp_arg7    = &p_in[off];
+    *p_arg7_len = struct0_end - off;
+    off         = struct0_end;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmit_csma_ca_raw_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmit_csma_ca_raw_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED ("t(LD)CbbCCC").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmit_failed_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    uint32_t     arg0,
+    const void * p_arg1,
+    size_t       arg1_len,
+    uint8_t      arg2,
+    bool         arg3,
+    bool         arg4,
+    uint8_t      arg5,
+    uint8_t      arg6,
+    uint8_t      arg7)
+{
+    size_t len = arg1_len + 12;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint16_put(&p_out[0], (uint16_t)(arg1_len + 4));
+    nrf_802154_spinel_codec_uint32_put(&p_out[2], arg0);
+    if (p_arg1 != NULL)
+    {
+        memcpy(&p_out[6], p_arg1, arg1_len);
+    }
+    p_out[arg1_len + 6] = arg2;
+    p_out[arg1_len + 7] = arg3 ? 1U : 0U;
+    p_out[arg1_len + 8] = arg4 ? 1U : 0U;
+    p_out[arg1_len + 9] = arg5;
+    p_out[arg1_len + 10] = arg6;
+    p_out[arg1_len + 11] = arg7;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED ("t(LD)CbbCCC").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmit_failed_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint32_t      * p_arg0,
+    const void   ** pp_arg1,
+    size_t        * p_arg1_len,
+    uint8_t       * p_arg2,
+    bool          * p_arg3,
+    bool          * p_arg4,
+    uint8_t       * p_arg5,
+    uint8_t       * p_arg6,
+    uint8_t       * p_arg7)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    size_t struct0_end = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+
+    if ((struct0_end >= SPINEL_FRAME_MAX_SIZE) || ((in_len - off - 2U) < struct0_end))
+    {
+        return -1;
+    }
+
+    struct0_end += off + 2U;
+    off         += 2U;
+
+    if ((struct0_end - off) < 4U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint32_get(&p_in[off]);
+    off += 4U;
+
+    *pp_arg1    = &p_in[off];
+    *p_arg1_len = struct0_end - off;
+    off         = struct0_end;
+
+    if ((in_len - off) < 6U)
+    {
+        return -1;
+    }
+
+    *p_arg2 = p_in[off];
+    *p_arg3 = (p_in[off + 1] != 0U);
+    *p_arg4 = (p_in[off + 2] != 0U);
+    *p_arg5 = p_in[off + 3];
+    *p_arg6 = p_in[off + 4];
+    *p_arg7 = p_in[off + 5];
+    off += 6U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW ("bbbbcbCt(LD)").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmit_raw_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    bool         arg0,
+    bool         arg1,
+    bool         arg2,
+    bool         arg3,
+    int8_t       arg4,
+    bool         arg5,
+    uint8_t      arg6,
+    uint32_t     arg7,
+    const void * p_arg8,
+    size_t       arg8_len)
+{
+    size_t len = arg8_len + 13;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+    p_out[1] = arg1 ? 1U : 0U;
+    p_out[2] = arg2 ? 1U : 0U;
+    p_out[3] = arg3 ? 1U : 0U;
+    p_out[4] = (uint8_t)arg4;
+    p_out[5] = arg5 ? 1U : 0U;
+    p_out[6] = arg6;
+    nrf_802154_spinel_codec_uint16_put(&p_out[7], (uint16_t)(arg8_len + 4));
+    nrf_802154_spinel_codec_uint32_put(&p_out[9], arg7);
+    if (p_arg8 != NULL)
+    {
+        memcpy(&p_out[13], p_arg8, arg8_len);
+    }
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW ("bbbbcbCt(LD)").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmit_raw_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0,
+    bool          * p_arg1,
+    bool          * p_arg2,
+    bool          * p_arg3,
+    int8_t        * p_arg4,
+    bool          * p_arg5,
+    uint8_t       * p_arg6,
+    uint32_t      * p_arg7,
+    const void   ** pp_arg8,
+    size_t        * p_arg8_len)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 7U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    *p_arg1 = (p_in[off + 1] != 0U);
+    *p_arg2 = (p_in[off + 2] != 0U);
+    *p_arg3 = (p_in[off + 3] != 0U);
+    *p_arg4 = (int8_t)p_in[off + 4];
+    *p_arg5 = (p_in[off + 5] != 0U);
+    *p_arg6 = p_in[off + 6];
+    off += 7U;
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    size_t struct0_end = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+
+    if ((struct0_end >= SPINEL_FRAME_MAX_SIZE) || ((in_len - off - 2U) < struct0_end))
+    {
+        return -1;
+    }
+
+    struct0_end += off + 2U;
+    off         += 2U;
+
+    if ((struct0_end - off) < 4U)
+    {
+        return -1;
+    }
+
+    *p_arg7 = nrf_802154_spinel_codec_uint32_get(&p_in[off]);
+    off += 4U;
+
+    *pp_arg8    = &p_in[off];
+    *p_arg8_len = struct0_end - off;
+    off         = struct0_end;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT ("bbbCbcCXt(LD)").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmit_raw_at_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    bool         arg0,
+    bool         arg1,
+    bool         arg2,
+    uint8_t      arg3,
+    bool         arg4,
+    int8_t       arg5,
+    uint8_t      arg6,
+    uint64_t     arg7,
+    uint32_t     arg8,
+    const void * p_arg9,
+    size_t       arg9_len)
+{
+    size_t len = arg9_len + 21;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+    p_out[1] = arg1 ? 1U : 0U;
+    p_out[2] = arg2 ? 1U : 0U;
+    p_out[3] = arg3;
+    p_out[4] = arg4 ? 1U : 0U;
+    p_out[5] = (uint8_t)arg5;
+    p_out[6] = arg6;
+    nrf_802154_spinel_codec_uint64_put(&p_out[7], arg7);
+    nrf_802154_spinel_codec_uint16_put(&p_out[15], (uint16_t)(arg9_len + 4));
+    nrf_802154_spinel_codec_uint32_put(&p_out[17], arg8);
+    if (p_arg9 != NULL)
+    {
+        memcpy(&p_out[21], p_arg9, arg9_len);
+    }
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT ("bbbCbcCXt(LD)").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmit_raw_at_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0,
+    bool          * p_arg1,
+    bool          * p_arg2,
+    uint8_t       * p_arg3,
+    bool          * p_arg4,
+    int8_t        * p_arg5,
+    uint8_t       * p_arg6,
+    uint64_t      * p_arg7,
+    uint32_t      * p_arg8,
+    const void   ** pp_arg9,
+    size_t        * p_arg9_len)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 15U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    *p_arg1 = (p_in[off + 1] != 0U);
+    *p_arg2 = (p_in[off + 2] != 0U);
+    *p_arg3 = p_in[off + 3];
+    *p_arg4 = (p_in[off + 4] != 0U);
+    *p_arg5 = (int8_t)p_in[off + 5];
+    *p_arg6 = p_in[off + 6];
+    *p_arg7 = nrf_802154_spinel_codec_uint64_get(&p_in[off + 7]);
+    off += 15U;
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    size_t struct0_end = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+
+    if ((struct0_end >= SPINEL_FRAME_MAX_SIZE) || ((in_len - off - 2U) < struct0_end))
+    {
+        return -1;
+    }
+
+    struct0_end += off + 2U;
+    off         += 2U;
+
+    if ((struct0_end - off) < 4U)
+    {
+        return -1;
+    }
+
+    *p_arg8 = nrf_802154_spinel_codec_uint32_get(&p_in[off]);
+    off += 4U;
+
+    *pp_arg9    = &p_in[off];
+    *p_arg9_len = struct0_end - off;
+    off         = struct0_end;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmit_raw_at_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmit_raw_at_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmit_raw_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_transmit_raw_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TX_ACK_STARTED ("D").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_tx_ack_started_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    const void * p_arg0,
+    size_t       arg0_len)
+{
+    size_t len = arg0_len;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    if (p_arg0 != NULL)
+    {
+        memcpy(&p_out[0], p_arg0, arg0_len);
+    }
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TX_ACK_STARTED ("D").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_tx_ack_started_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    const void   ** pp_arg0,
+    size_t        * p_arg0_len)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    *pp_arg0    = &p_in[off];
+    *p_arg0_len = in_len - off;
+    off         = in_len;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TX_POWER_GET ("").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_tx_power_get_pack(
+    uint8_t * p_out,
+    size_t    out_len)
+{
+    (void)p_out;
+
+    size_t len = 0;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TX_POWER_GET ("").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_tx_power_get_unpack(
+    const uint8_t * p_in,
+    size_t          in_len)
+{
+    size_t off = 0U;
+
+    (void)p_in;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TX_POWER_GET_RET ("c").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_tx_power_get_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    int8_t    arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = (uint8_t)arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TX_POWER_GET_RET ("c").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_tx_power_get_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    int8_t        * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (int8_t)p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TX_POWER_SET ("c").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_tx_power_set_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    int8_t    arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = (uint8_t)arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TX_POWER_SET ("c").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_tx_power_set_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    int8_t        * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (int8_t)p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TX_QUEUE_CANCEL ("L").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_tx_queue_cancel_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint32_t  arg0)
+{
+    size_t len = 4;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint32_put(&p_out[0], arg0);
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TX_QUEUE_CANCEL ("L").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_tx_queue_cancel_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint32_t      * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 4U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = nrf_802154_spinel_codec_uint32_get(&p_in[off]);
+    off += 4U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TX_QUEUE_CANCEL_RET ("b").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_tx_queue_cancel_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    bool      arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0 ? 1U : 0U;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TX_QUEUE_CANCEL_RET ("b").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_tx_queue_cancel_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW ("CD").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_tx_queue_enqueue_raw_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    uint8_t      arg0,
+    const void * p_arg1,
+    size_t       arg1_len)
+{
+    size_t len = arg1_len + 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+    if (p_arg1 != NULL)
+    {
+        memcpy(&p_out[1], p_arg1, arg1_len);
+    }
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW ("CD").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_tx_queue_enqueue_raw_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0,
+    const void   ** pp_arg1,
+    size_t        * p_arg1_len)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    *pp_arg1    = &p_in[off];
+    *p_arg1_len = in_len - off;
+    off         = in_len;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW_ENTRY ("t(bbbbCbcbCt(LD))").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_tx_queue_enqueue_raw_entry_pack(
+    uint8_t    * p_out,
+    size_t       out_len,
+    bool         arg0,
+    bool         arg1,
+    bool         arg2,
+    bool         arg3,
+    uint8_t      arg4,
+    bool         arg5,
+    int8_t       arg6,
+    bool         arg7,
+    uint8_t      arg8,
+    uint32_t     arg9,
+    const void * p_arg10,
+    size_t       arg10_len)
+{
+    size_t len = arg10_len + 17;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    nrf_802154_spinel_codec_uint16_put(&p_out[0], (uint16_t)(arg10_len + 15));
+    p_out[2] = arg0 ? 1U : 0U;
+    p_out[3] = arg1 ? 1U : 0U;
+    p_out[4] = arg2 ? 1U : 0U;
+    p_out[5] = arg3 ? 1U : 0U;
+    p_out[6] = arg4;
+    p_out[7] = arg5 ? 1U : 0U;
+    p_out[8] = (uint8_t)arg6;
+    p_out[9] = arg7 ? 1U : 0U;
+    p_out[10] = arg8;
+    nrf_802154_spinel_codec_uint16_put(&p_out[11], (uint16_t)(arg10_len + 4));
+    nrf_802154_spinel_codec_uint32_put(&p_out[13], arg9);
+    if (p_arg10 != NULL)
+    {
+        memcpy(&p_out[17], p_arg10, arg10_len);
+    }
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW_ENTRY ("t(bbbbCbcbCt(LD))").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_tx_queue_enqueue_raw_entry_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    bool          * p_arg0,
+    bool          * p_arg1,
+    bool          * p_arg2,
+    bool          * p_arg3,
+    uint8_t       * p_arg4,
+    bool          * p_arg5,
+    int8_t        * p_arg6,
+    bool          * p_arg7,
+    uint8_t       * p_arg8,
+    uint32_t      * p_arg9,
+    const void   ** pp_arg10,
+    size_t        * p_arg10_len)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 2U)
+    {
+        return -1;
+    }
+
+    size_t struct0_end = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+
+    if ((struct0_end >= SPINEL_FRAME_MAX_SIZE) || ((in_len - off - 2U) < struct0_end))
+    {
+        return -1;
+    }
+
+    struct0_end += off + 2U;
+    off         += 2U;
+
+    if ((struct0_end - off) < 9U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = (p_in[off] != 0U);
+    *p_arg1 = (p_in[off + 1] != 0U);
+    *p_arg2 = (p_in[off + 2] != 0U);
+    *p_arg3 = (p_in[off + 3] != 0U);
+    *p_arg4 = p_in[off + 4];
+    *p_arg5 = (p_in[off + 5] != 0U);
+    *p_arg6 = (int8_t)p_in[off + 6];
+    *p_arg7 = (p_in[off + 7] != 0U);
+    *p_arg8 = p_in[off + 8];
+    off += 9U;
+
+    if ((struct0_end - off) < 2U)
+    {
+        return -1;
+    }
+
+    size_t struct1_end = nrf_802154_spinel_codec_uint16_get(&p_in[off]);
+
+    if ((struct1_end >= SPINEL_FRAME_MAX_SIZE) || ((struct0_end - off - 2U) < struct1_end))
+    {
+        return -1;
+    }
+
+    struct1_end += off + 2U;
+    off         += 2U;
+
+    if ((struct1_end - off) < 4U)
+    {
+        return -1;
+    }
+
+    *p_arg9 = nrf_802154_spinel_codec_uint32_get(&p_in[off]);
+    off += 4U;
+
+    *pp_arg10    = &p_in[off];
+    *p_arg10_len = struct1_end - off;
+    off          = struct1_end;
+
+    off = struct0_end;
+
+    return (spinel_ssize_t)off;
+}
+
+/**
+ * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW_RET ("C").
+ *
+ * @returns Number of bytes written to @p p_out or -1 if the data does not fit.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_tx_queue_enqueue_raw_ret_pack(
+    uint8_t * p_out,
+    size_t    out_len,
+    uint8_t   arg0)
+{
+    size_t len = 1;
+
+    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))
+    {
+        return -1;
+    }
+
+    p_out[0] = arg0;
+
+    return (spinel_ssize_t)len;
+}
+
+/**
+ * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW_RET ("C").
+ *
+ * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.
+ */
+static inline spinel_ssize_t nrf_802154_spinel_codec_tx_queue_enqueue_raw_ret_unpack(
+    const uint8_t * p_in,
+    size_t          in_len,
+    uint8_t       * p_arg0)
+{
+    size_t off = 0U;
+
+    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)
+    {
+        return -1;
+    }
+
+    if ((in_len - off) < 1U)
+    {
+        return -1;
+    }
+
+    *p_arg0 = p_in[off];
+    off += 1U;
+
+    return (spinel_ssize_t)off;
+}
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* NRF_802154_SPINEL_CODECS_H_ */
@@ -477,6 +477,74 @@ typedef enum
     SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ACK_DATA_REMOVE_ALL =
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 68,
 
+    /**
+     * Vendor property for batched nrf_802154_received_timestamp_raw serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 69,
+
+    /**
+     * Vendor property for nrf_802154_receive_periodic_start serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_START =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 70,
+
+    /**
+     * Vendor property for nrf_802154_receive_periodic_stop serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_STOP =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 71,
+
+    /**
+     * Vendor property for nrf_802154_receive_periodic_stats_get serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_STATS_GET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 72,
+
+    /**
+     * Vendor property for nrf_802154_csma_ca_backoff_policy_set serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 73,
+
+    /**
+     * Vendor property for nrf_802154_tx_queue_enqueue_raw serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_QUEUE_ENQUEUE_RAW =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 74,
+
+    /**
+     * Vendor property for nrf_802154_tx_queue_cancel serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_QUEUE_CANCEL =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 75,
+
+    /**
+     * Vendor property for nrf_802154_retransmission_config_set serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RETRANSMISSION_CONFIG_SET =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 76,
+
+    /**
+     * Vendor property for nrf_802154_energy_detection_sweep serialization.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION_SWEEP =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 77,
+
+    /**
+     * Vendor property for serialization of the statistics of a single channel passed to
+     * nrf_802154_energy_detected by the energy detection sweep.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION_SWEEP_CHANNEL =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 78,
+
+    /**
+     * Vendor property for nrf_802154_energy_detected serialization at the end of the energy
+     * detection sweep.
+     */
+    SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTED_SWEEP =
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154__BEGIN + 79,
+
 } spinel_prop_vendor_key_t;
 
 /**
@@ -637,6 +705,39 @@ typedef enum
     NRF_802154_TX_POWER_METADATA_DECODE((tx_metadata).tx_power),          \
     NRF_802154_TX_CHANNEL_METADATA_DECODE((tx_metadata).tx_channel)
 
+/**
+ * @brief Spinel data type description for nrf_802154_tx_queue_metadata_t.
+ */
+#define SPINEL_DATATYPE_NRF_802154_TX_QUEUE_METADATA_S                     \
+    SPINEL_DATATYPE_NRF_802154_TRANSMITTED_FRAME_PROPS_S /* frame_props */ \
+    SPINEL_DATATYPE_BOOL_S                               /* csma_ca */     \
+    SPINEL_DATATYPE_BOOL_S                               /* cca */         \
+    SPINEL_DATATYPE_UINT8_S                              /* max_retries */ \
+    SPINEL_DATATYPE_NRF_802154_TX_POWER_METADATA_S       /* tx_power */    \
+    SPINEL_DATATYPE_NRF_802154_TX_CHANNEL_METADATA_S     /* tx_channel */
+
+/**
+ * @brief Encodes an instance of @ref SPINEL_DATATYPE_NRF_802154_TX_QUEUE_METADATA_S data type.
+ */
+#define NRF_802154_TX_QUEUE_METADATA_ENCODE(tx_metadata)                  \
+    NRF_802154_TRANSMITTED_FRAME_PROPS_ENCODE((tx_metadata).frame_props), \
+    ((tx_metadata).csma_ca),                                              \
+    ((tx_metadata).cca),                                                  \
+    ((tx_metadata).max_retries),                                          \
+    NRF_802154_TX_POWER_METADATA_ENCODE((tx_metadata).tx_power),          \
+    NRF_802154_TX_CHANNEL_METADATA_ENCODE((tx_metadata).tx_channel)
+
+/**
+ * @brief Decodes an instance of @ref SPINEL_DATATYPE_NRF_802154_TX_QUEUE_METADATA_S data type.
+ */
+#define NRF_802154_TX_QUEUE_METADATA_DECODE(tx_metadata)                  \
+    NRF_802154_TRANSMITTED_FRAME_PROPS_DECODE((tx_metadata).frame_props), \
+    (&(tx_metadata).csma_ca),                                             \
+    (&(tx_metadata).cca),                                                 \
+    (&(tx_metadata).max_retries),                                         \
+    NRF_802154_TX_POWER_METADATA_DECODE((tx_metadata).tx_power),          \
+    NRF_802154_TX_CHANNEL_METADATA_DECODE((tx_metadata).tx_channel)
+
 /**
  * @brief Spinel data type description for nrf_802154_csma_ca_min_be_set.
  */
@@ -692,6 +793,16 @@ typedef enum
  */
 #define SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET_RET     SPINEL_DATATYPE_UINT8_S
 
+/**
+ * @brief Spinel data type description for nrf_802154_csma_ca_backoff_policy_set.
+ */
+#define SPINEL_DATATYPE_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET       SPINEL_DATATYPE_UINT8_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_csma_ca_backoff_policy_set result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET_RET   SPINEL_DATATYPE_BOOL_S
+
 /**
  * @brief Spinel data type description for nrf_802154_test_mode_csmaca_backoff_set.
  */
@@ -853,6 +964,70 @@ typedef enum
  */
 #define SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL_RET   SPINEL_DATATYPE_BOOL_S
 
+/**
+ * @brief Spinel data type description for nrf_802154_receive_periodic_start.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_START \
+    SPINEL_DATATYPE_UINT8_S     /* schedule */            \
+    SPINEL_DATATYPE_UINT64_S    /* rx_time */             \
+    SPINEL_DATATYPE_UINT32_S    /* period */              \
+    SPINEL_DATATYPE_UINT32_S    /* window */              \
+    SPINEL_DATATYPE_DATA_WLEN_S /* channels */
+
+/**
+ * @brief Spinel data type description for nrf_802154_receive_periodic_start result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_START_RET SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_receive_periodic_stop.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STOP      SPINEL_DATATYPE_UINT8_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_receive_periodic_stop result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STOP_RET  SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_periodic_rx_stats_t.
+ */
+#define SPINEL_DATATYPE_NRF_802154_PERIODIC_RX_STATS_S \
+    SPINEL_DATATYPE_UINT32_S /* armed */               \
+    SPINEL_DATATYPE_UINT32_S /* completed */           \
+    SPINEL_DATATYPE_UINT32_S /* missed */              \
+    SPINEL_DATATYPE_UINT32_S /* late */
+
+/**
+ * @brief Encodes an instance of @ref SPINEL_DATATYPE_NRF_802154_PERIODIC_RX_STATS_S data type.
+ */
+#define NRF_802154_PERIODIC_RX_STATS_ENCODE(stats) \
+    ((stats).armed),                               \
+    ((stats).completed),                           \
+    ((stats).missed),                              \
+    ((stats).late)
+
+/**
+ * @brief Decodes an instance of @ref SPINEL_DATATYPE_NRF_802154_PERIODIC_RX_STATS_S data type.
+ */
+#define NRF_802154_PERIODIC_RX_STATS_DECODE(stats) \
+    (&(stats).armed),                              \
+    (&(stats).completed),                          \
+    (&(stats).missed),                             \
+    (&(stats).late)
+
+/**
+ * @brief Spinel data type description for nrf_802154_receive_periodic_stats_get.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STATS_GET SPINEL_DATATYPE_UINT8_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_receive_periodic_stats_get result.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STATS_GET_RET \
+    SPINEL_DATATYPE_BOOL_S /* result */                           \
+    SPINEL_DATATYPE_NRF_802154_PERIODIC_RX_STATS_S
+
 /**
  * @brief Spinel data type description for nrf_802154_pan_id_set.
  */
@@ -928,6 +1103,45 @@ typedef enum
  */
 #define SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED         SPINEL_DATATYPE_INT8_S
 
+/**
+ * @brief Spinel data type description for nrf_802154_energy_detection_sweep.
+ */
+#define SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP \
+    SPINEL_DATATYPE_UINT32_S /* channel_mask */           \
+    SPINEL_DATATYPE_UINT32_S /* dwell_us */               \
+    SPINEL_DATATYPE_UINT16_S /* iterations */
+
+/**
+ * @brief Spinel data type description for return value of nrf_802154_energy_detection_sweep.
+ */
+#define SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP_RET SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type description for the statistics of a single channel measured by
+ *        the energy detection sweep.
+ *
+ * The histogram is passed as the array of @ref NRF_802154_ED_SWEEP_HISTOGRAM_BINS 16-bit
+ * counters in the byte order of the cores.
+ */
+#define SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP_CHANNEL \
+    SPINEL_DATATYPE_UINT8_S  /* channel */                        \
+    SPINEL_DATATYPE_UINT16_S /* samples */                        \
+    SPINEL_DATATYPE_INT8_S   /* max_dbm */                        \
+    SPINEL_DATATYPE_INT8_S   /* mean_dbm */                       \
+    SPINEL_DATATYPE_INT8_S   /* percentile_dbm */                 \
+    SPINEL_DATATYPE_DATA_S   /* histogram */
+
+/**
+ * @brief Spinel data type description for nrf_802154_energy_detected at the end of the energy
+ *        detection sweep.
+ *
+ * The statistics of the channels are passed before with
+ * @ref SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP_CHANNEL, one channel at a time.
+ */
+#define SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED_SWEEP \
+    SPINEL_DATATYPE_INT8_S   /* ed_dbm */                \
+    SPINEL_DATATYPE_UINT32_S /* channel_mask */
+
 /**
  * @brief Spinel data type description for nrf_802154_energy_detection_failed.
  */
@@ -977,6 +1191,20 @@ typedef enum
     SPINEL_DATATYPE_UINT8_S            /* lqi */            \
     SPINEL_DATATYPE_UINT64_S           /* timestamp */
 
+/**
+ * @brief Spinel data type description for a single frame of
+ *        @ref SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH_ENTRY \
+    SPINEL_DATATYPE_STRUCT_S(SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW)
+
+/**
+ * @brief Spinel data type description for a batch of nrf_802154_received_timestamp_raw calls.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH \
+    SPINEL_DATATYPE_UINT8_S /* Number of frames */            \
+    SPINEL_DATATYPE_DATA_S  /* Concatenated batch entries */
+
 /**
  * @brief Spinel data type description for nrf_802154_receive_failed
  */
@@ -1105,6 +1333,53 @@ typedef enum
     SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_METADATA_S \
     SPINEL_DATATYPE_NRF_802154_HDATA_S /* Frame to transmit with its handle */
 
+/**
+ * @brief Spinel data type description for a single frame of
+ *        @ref SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW.
+ */
+#define SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW_ENTRY                        \
+    SPINEL_DATATYPE_STRUCT_S(                                                        \
+        SPINEL_DATATYPE_NRF_802154_TX_QUEUE_METADATA_S                               \
+        SPINEL_DATATYPE_NRF_802154_HDATA_S /* Frame to transmit with its handle */   \
+                            )
+
+/**
+ * @brief Spinel data type description for nrf_802154_tx_queue_enqueue_raw.
+ */
+#define SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW \
+    SPINEL_DATATYPE_UINT8_S /* Number of frames */      \
+    SPINEL_DATATYPE_DATA_S  /* Concatenated entries */
+
+/**
+ * @brief Spinel data type description for return value of nrf_802154_tx_queue_enqueue_raw.
+ */
+#define SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW_RET \
+    SPINEL_DATATYPE_UINT8_S /* Number of frames added */
+
+/**
+ * @brief Spinel data type description for nrf_802154_tx_queue_cancel.
+ */
+#define SPINEL_DATATYPE_NRF_802154_TX_QUEUE_CANCEL \
+    SPINEL_DATATYPE_UINT32_S /* Handle of the frame to cancel */
+
+/**
+ * @brief Spinel data type description for return value of nrf_802154_tx_queue_cancel.
+ */
+#define SPINEL_DATATYPE_NRF_802154_TX_QUEUE_CANCEL_RET SPINEL_DATATYPE_BOOL_S
+
+/**
+ * @brief Spinel data type description for nrf_802154_retransmission_config_set.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RETRANSMISSION_CONFIG_SET \
+    SPINEL_DATATYPE_UINT8_S /* max_frame_retries */          \
+    SPINEL_DATATYPE_UINT8_S /* csma_ca_restart */            \
+    SPINEL_DATATYPE_UINT8_S /* frame_pending */
+
+/**
+ * @brief Spinel data type description for return value of nrf_802154_retransmission_config_set.
+ */
+#define SPINEL_DATATYPE_NRF_802154_RETRANSMISSION_CONFIG_SET_RET SPINEL_DATATYPE_BOOL_S
+
 /**
  * @brief Spinel data type description for nrf_802154_transmit_raw_at
  */
@@ -1118,11 +1393,40 @@ typedef enum
  */
 #define SPINEL_DATATYPE_NRF_802154_TRANSMIT_AT_CANCEL SPINEL_DATATYPE_NULL_S
 
+/**
+ * @brief Spinel data type description for nrf_802154_transmit_retries_t.
+ */
+#define SPINEL_DATATYPE_NRF_802154_TRANSMIT_RETRIES_S \
+    SPINEL_DATATYPE_UINT8_S /* attempts */            \
+    SPINEL_DATATYPE_UINT8_S /* busy_channel */        \
+    SPINEL_DATATYPE_UINT8_S /* no_ack */
+
+/**
+ * @brief Encodes an instance of @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_RETRIES_S data type.
+ *
+ * @param[in]  retries  Retransmission statistics structure to be encoded.
+ */
+#define NRF_802154_TRANSMIT_RETRIES_ENCODE(retries) \
+    (retries).attempts,                             \
+    (retries).busy_channel,                         \
+    (retries).no_ack
+
+/**
+ * @brief Decodes an instance of @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_RETRIES_S data type.
+ *
+ * @param[out]  retries  Retransmission statistics structure to which store decoded data.
+ */
+#define NRF_802154_TRANSMIT_RETRIES_DECODE(retries) \
+    &(retries).attempts,                            \
+    &(retries).busy_channel,                        \
+    &(retries).no_ack
+
 /**
  * @brief Spinel data type description for nrf_802154_transmit_done_metadata.
  */
 #define SPINEL_DATATYPE_NRF_802154_TRANSMIT_DONE_METADATA_S                \
     SPINEL_DATATYPE_NRF_802154_TRANSMITTED_FRAME_PROPS_S /* Frame props */ \
+    SPINEL_DATATYPE_NRF_802154_TRANSMIT_RETRIES_S        /* Retries */     \
     SPINEL_DATATYPE_UINT8_S                              /* Length */      \
     SPINEL_DATATYPE_INT8_S                               /* Power */       \
     SPINEL_DATATYPE_UINT8_S                              /* LQI */         \
@@ -1137,6 +1441,7 @@ typedef enum
  */
 #define NRF_802154_TRANSMIT_DONE_METADATA_ENCODE(metadata, ack_handle) \
     NRF_802154_TRANSMITTED_FRAME_PROPS_ENCODE((metadata).frame_props), \
+    NRF_802154_TRANSMIT_RETRIES_ENCODE((metadata).retries),            \
     (metadata).data.transmitted.length,                                \
     (metadata).data.transmitted.power,                                 \
     (metadata).data.transmitted.lqi,                                   \
@@ -1155,6 +1460,7 @@ typedef enum
  */
 #define NRF_802154_TRANSMIT_DONE_METADATA_DECODE(metadata, ack_handle, ack_length) \
     NRF_802154_TRANSMITTED_FRAME_PROPS_DECODE((metadata).frame_props),             \
+    NRF_802154_TRANSMIT_RETRIES_DECODE((metadata).retries),                        \
     &(metadata).data.transmitted.length,                                           \
     &(metadata).data.transmitted.power,                                            \
     &(metadata).data.transmitted.lqi,                                              \
@@ -1164,24 +1470,27 @@ typedef enum
 /**
  * @brief Spinel data type description for nrf_802154_transmit_failed_metadata.
  */
-#define SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED_METADATA_S \
-    SPINEL_DATATYPE_NRF_802154_TRANSMITTED_FRAME_PROPS_S /* Frame props */
+#define SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED_METADATA_S                \
+    SPINEL_DATATYPE_NRF_802154_TRANSMITTED_FRAME_PROPS_S /* Frame props */ \
+    SPINEL_DATATYPE_NRF_802154_TRANSMIT_RETRIES_S        /* Retries */
 
 /**
  * @brief Encodes an instance of @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED_METADATA_S data type.
  *
  * @param[in]  metadata    Transmit failed metadata structure to be encoded.
  */
-#define NRF_802154_TRANSMIT_FAILED_METADATA_ENCODE(metadata) \
-    NRF_802154_TRANSMITTED_FRAME_PROPS_ENCODE((metadata).frame_props)
+#define NRF_802154_TRANSMIT_FAILED_METADATA_ENCODE(metadata)           \
+    NRF_802154_TRANSMITTED_FRAME_PROPS_ENCODE((metadata).frame_props), \
+    NRF_802154_TRANSMIT_RETRIES_ENCODE((metadata).retries)
 
 /**
  * @brief Decodes an instance of @ref SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED_METADATA_S data type.
  *
  * @param[out]  metadata    Transmit failed metadata structure to which store decoded data.
  */
-#define NRF_802154_TRANSMIT_FAILED_METADATA_DECODE(metadata) \
-    NRF_802154_TRANSMITTED_FRAME_PROPS_DECODE((metadata).frame_props)
+#define NRF_802154_TRANSMIT_FAILED_METADATA_DECODE(metadata)           \
+    NRF_802154_TRANSMITTED_FRAME_PROPS_DECODE((metadata).frame_props), \
+    NRF_802154_TRANSMIT_RETRIES_DECODE((metadata).retries)
 
 /**
  * @brief Spinel data type description for nrf_802154_transmitted_raw.
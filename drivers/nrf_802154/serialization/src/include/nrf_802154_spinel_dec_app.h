@@ -207,6 +207,23 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_stat_timestamps_ge
     size_t                         property_data_len,
     nrf_802154_stat_timestamps_t * p_stat_timestamps);
 
+/**
+ * @brief Decode SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_STATS_GET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ * @param[out] p_result           Decoded result of the call.
+ * @param[out] p_stats            Decoded periodic reception statistics.
+ *
+ * @returns zero on success or negative error value on failure.
+ *
+ */
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_receive_periodic_stats_get_ret(
+    const void                     * p_property_data,
+    size_t                           property_data_len,
+    bool                           * p_result,
+    nrf_802154_periodic_rx_stats_t * p_stats);
+
 /**
  * @brief Decode and dispatch SPINEL_CMD_PROP_VALUE_IS.
  *
@@ -91,6 +91,14 @@ bool nrf_802154_buffer_mgr_dst_search_by_local_pointer(
     return nrf_802154_kvmap_search(&p_obj->map, &p_local_pointer, p_buffer_handle);
 }
 
+bool nrf_802154_buffer_mgr_dst_search_by_buffer_handle(
+    nrf_802154_buffer_mgr_dst_t * p_obj,
+    uint32_t                      buffer_handle,
+    void                       ** pp_local_pointer)
+{
+    return nrf_802154_kvmap_search_by_value(&p_obj->map, &buffer_handle, pp_local_pointer);
+}
+
 bool nrf_802154_buffer_mgr_dst_remove_by_local_pointer(
     nrf_802154_buffer_mgr_dst_t * p_obj,
     void                        * p_local_pointer)
@@ -198,3 +198,33 @@ bool nrf_802154_kvmap_search(const nrf_802154_kvmap_t * p_kvmap,
 
     return success;
 }
+
+bool nrf_802154_kvmap_search_by_value(const nrf_802154_kvmap_t * p_kvmap,
+                                      const void               * p_value,
+                                      void                     * p_key)
+{
+    uint32_t  crit_sect = 0UL;
+    size_t    item_size = NRF_802154_KVMAP_ITEMSIZE(p_kvmap->key_size, p_kvmap->val_size);
+    uint8_t * p_item;
+    size_t    idx;
+    bool      success = false;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    p_item = p_kvmap->p_memory;
+
+    /* Linear search */
+    for (idx = 0U; idx < p_kvmap->count; ++idx, p_item += item_size)
+    {
+        if (memcmp(p_item + p_kvmap->key_size, p_value, p_kvmap->val_size) == 0)
+        {
+            memcpy(p_key, p_item, p_kvmap->key_size);
+            success = true;
+            break;
+        }
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return success;
+}
@@ -89,6 +89,14 @@ bail:
     return;
 }
 
+static nrf_802154_ser_err_t spinel_frame_send(const uint8_t * p_buff, size_t len)
+{
+    NRF_802154_SPINEL_LOG_RAW("Sending spinel frame\n");
+    NRF_802154_SPINEL_LOG_BUFF_NAMED(p_buff, len, "data");
+
+    return nrf_802154_spinel_encoded_packet_send(p_buff, len);
+}
+
 nrf_802154_ser_err_t nrf_802154_spinel_send(const char * p_fmt, ...)
 {
     uint8_t        command_buff[NRF_802154_SPINEL_FRAME_BUFFER_SIZE];
@@ -107,10 +115,37 @@ nrf_802154_ser_err_t nrf_802154_spinel_send(const char * p_fmt, ...)
         return NRF_802154_SERIALIZATION_ERROR_ENCODING_FAILURE;
     }
 
-    NRF_802154_SPINEL_LOG_RAW("Sending spinel frame\n");
-    NRF_802154_SPINEL_LOG_BUFF_NAMED(command_buff, siz, "data");
+    return spinel_frame_send(command_buff, (size_t)siz);
+}
+
+size_t nrf_802154_spinel_prop_header_pack(uint8_t         * p_buff,
+                                          spinel_command_t  cmd,
+                                          spinel_prop_key_t prop)
+{
+    size_t len = 0;
+
+    p_buff[len++] = SPINEL_HEADER_FLAG;
+
+    len += (size_t)spinel_packed_uint_encode(&p_buff[len],
+                                             NRF_802154_SPINEL_PROP_HEADER_MAX_SIZE - len,
+                                             cmd);
+    len += (size_t)spinel_packed_uint_encode(&p_buff[len],
+                                             NRF_802154_SPINEL_PROP_HEADER_MAX_SIZE - len,
+                                             prop);
+
+    return len;
+}
+
+nrf_802154_ser_err_t nrf_802154_spinel_packed_send(const uint8_t * p_buff,
+                                                   size_t          hdr_len,
+                                                   spinel_ssize_t  value_len)
+{
+    if (value_len < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_ENCODING_FAILURE;
+    }
 
-    return nrf_802154_spinel_encoded_packet_send(command_buff, (size_t)siz);
+    return spinel_frame_send(p_buff, hdr_len + (size_t)value_len);
 }
 
 void nrf_802154_spinel_encoded_packet_received(const void * p_data, size_t data_len)
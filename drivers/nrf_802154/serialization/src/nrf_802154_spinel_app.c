@@ -59,6 +59,11 @@
 #include "nrf_802154_serialization_error_helper.h"
 #include "nrf_802154_buffer_mgr_dst.h"
 #include "nrf_802154_buffer_mgr_src.h"
+#include "nrf_802154_serialization_config.h"
+
+#if NRF_802154_SPINEL_CODECS_ENABLED
+#include "nrf_802154_spinel_codecs.h"
+#endif
 
 #include "nrf_802154.h"
 #include "nrf_802154_config.h"
@@ -572,6 +577,141 @@ bail:
     return cancel_result;
 }
 
+bool nrf_802154_receive_periodic_start(uint8_t                                 schedule,
+                                       const nrf_802154_periodic_rx_params_t * p_params)
+{
+    nrf_802154_ser_err_t res;
+    bool                 start_result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_START);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_START,
+        SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_START,
+        schedule,
+        p_params->rx_time,
+        p_params->period,
+        p_params->window,
+        p_params->channels,
+        (uint32_t)p_params->channels_len);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                          &start_result);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return start_result;
+}
+
+bool nrf_802154_receive_periodic_stop(uint8_t schedule)
+{
+    nrf_802154_ser_err_t res;
+    bool                 stop_result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_STOP);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_STOP,
+        SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STOP,
+        schedule);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                          &stop_result);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return stop_result;
+}
+
+static nrf_802154_ser_err_t receive_periodic_stats_get_ret_await(
+    uint32_t                         timeout,
+    bool                           * p_result,
+    nrf_802154_periodic_rx_stats_t * p_stats)
+{
+    nrf_802154_ser_err_t              res;
+    nrf_802154_spinel_notify_buff_t * p_notify_data = NULL;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    p_notify_data = nrf_802154_spinel_response_notifier_property_await(
+        timeout);
+
+    SERIALIZATION_ERROR_IF(p_notify_data == NULL,
+                           NRF_802154_SERIALIZATION_ERROR_RESPONSE_TIMEOUT,
+                           error,
+                           bail);
+
+    res = nrf_802154_spinel_decode_prop_nrf_802154_receive_periodic_stats_get_ret(
+        p_notify_data->data,
+        p_notify_data->data_len,
+        p_result,
+        p_stats);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    NRF_802154_SPINEL_LOG_BANNER_RESPONSE();
+
+bail:
+    if (p_notify_data != NULL)
+    {
+        nrf_802154_spinel_response_notifier_free(p_notify_data);
+    }
+
+    return error;
+}
+
+bool nrf_802154_receive_periodic_stats_get(uint8_t                          schedule,
+                                           nrf_802154_periodic_rx_stats_t * p_stats)
+{
+    nrf_802154_ser_err_t res;
+    bool                 stats_result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_STATS_GET);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_STATS_GET,
+        SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STATS_GET,
+        schedule);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = receive_periodic_stats_get_ret_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                               &stats_result,
+                                               p_stats);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return stats_result;
+}
+
 void nrf_802154_pan_id_set(const uint8_t * p_pan_id)
 {
     nrf_802154_ser_err_t res;
@@ -1192,6 +1332,42 @@ bail:
     return ed_result;
 }
 
+#if NRF_802154_ED_SWEEP_ENABLED
+
+bool nrf_802154_energy_detection_sweep(const nrf_802154_ed_sweep_params_t * p_params)
+{
+    nrf_802154_ser_err_t res;
+    bool                 ed_result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION_SWEEP);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION_SWEEP,
+        SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP,
+        p_params->channel_mask,
+        p_params->dwell_us,
+        p_params->iterations);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                          &ed_result);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return ed_result;
+}
+
+#endif // NRF_802154_ED_SWEEP_ENABLED
+
 #if NRF_802154_CSMA_CA_ENABLED
 
 bool nrf_802154_transmit_csma_ca_raw(uint8_t                                      * p_data,
@@ -1430,8 +1606,256 @@ bail:
     return max_backoffs;
 }
 
+bool nrf_802154_csma_ca_backoff_policy_set(nrf_802154_csma_ca_backoff_policy_id_t policy)
+{
+    nrf_802154_ser_err_t res;
+    bool                 result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", policy);
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET,
+        SPINEL_DATATYPE_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET,
+        policy);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                          &result);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return result;
+}
+
 #endif // NRF_802154_CSMA_CA_ENABLED
 
+#if NRF_802154_TX_QUEUE_ENABLED
+
+/**
+ * @brief Maximal size of the concatenated entries of a single
+ *        @ref SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_QUEUE_ENQUEUE_RAW command.
+ */
+#define TX_QUEUE_ENQUEUE_ENTRIES_MAX_SIZE \
+    (NRF_802154_SPINEL_FRAME_MAX_SIZE - NRF_802154_SPINEL_PROP_HEADER_MAX_SIZE - sizeof(uint8_t))
+
+/**
+ * @brief Adds the frames that fit in a single command to the transmit queue of the remote driver.
+ *
+ * @param[in]   p_entries  Array of frames to be added.
+ * @param[in]   count      Number of elements of @p p_entries.
+ * @param[out]  p_sent     Number of frames sent in the command.
+ *
+ * @returns  Number of frames added to the queue.
+ */
+static uint8_t tx_queue_entries_enqueue(const nrf_802154_tx_queue_entry_t * p_entries,
+                                        uint8_t                             count,
+                                        uint8_t                           * p_sent)
+{
+    nrf_802154_ser_err_t res;
+    uint8_t              entries[TX_QUEUE_ENQUEUE_ENTRIES_MAX_SIZE];
+    uint32_t             data_handles[NRF_802154_TX_QUEUE_SIZE];
+    size_t               entries_len    = 0;
+    uint8_t              sent           = 0;
+    uint8_t              enqueue_result = 0;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    // Frames that exceed the capacity of the queue would be rejected anyway
+    count = (count < NRF_802154_TX_QUEUE_SIZE) ? count : NRF_802154_TX_QUEUE_SIZE;
+
+    for (; sent < count; sent++)
+    {
+        uint8_t      * p_data = p_entries[sent].p_data;
+        spinel_ssize_t siz;
+
+        if (!nrf_802154_buffer_mgr_src_add(nrf_802154_spinel_src_buffer_mgr_get(),
+                                           p_data,
+                                           &data_handles[sent]))
+        {
+            break;
+        }
+
+        siz = spinel_datatype_pack(&entries[entries_len],
+                                   sizeof(entries) - entries_len,
+                                   SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW_ENTRY,
+                                   NRF_802154_TX_QUEUE_METADATA_ENCODE(p_entries[sent].metadata),
+                                   NRF_802154_HDATA_ENCODE(data_handles[sent], p_data, p_data[0]));
+
+        if ((siz < 0) || ((size_t)siz > sizeof(entries) - entries_len))
+        {
+            // The frame does not fit in this command
+            nrf_802154_buffer_mgr_src_remove_by_buffer_handle(
+                nrf_802154_spinel_src_buffer_mgr_get(),
+                data_handles[sent]);
+            break;
+        }
+
+        NRF_802154_SPINEL_LOG_BUFF(p_data, p_data[0]);
+
+        entries_len += (size_t)siz;
+    }
+
+    SERIALIZATION_ERROR_IF(sent == 0, NRF_802154_SERIALIZATION_ERROR_NO_MEMORY, error, bail);
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_QUEUE_ENQUEUE_RAW);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_QUEUE_ENQUEUE_RAW,
+        SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW,
+        sent,
+        entries,
+        entries_len);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_uint8_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                           &enqueue_result);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+    SERIALIZATION_ERROR_IF(enqueue_result > sent,
+                           NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE,
+                           error,
+                           bail);
+
+bail:
+    if (error != NRF_802154_SERIALIZATION_ERROR_OK)
+    {
+        enqueue_result = 0;
+    }
+
+    // Rejected frames are not going to be notified, so their handles are released here
+    for (uint8_t i = enqueue_result; i < sent; i++)
+    {
+        nrf_802154_buffer_mgr_src_remove_by_buffer_handle(nrf_802154_spinel_src_buffer_mgr_get(),
+                                                          data_handles[i]);
+    }
+
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    *p_sent = sent;
+
+    return enqueue_result;
+}
+
+uint8_t nrf_802154_tx_queue_enqueue_raw(const nrf_802154_tx_queue_entry_t * p_entries,
+                                        uint8_t                             count)
+{
+    uint8_t enqueued = 0;
+
+    // Frames are packed in as few commands as possible. A command that is not accepted in whole
+    // ends the request, because the remote driver does not add the frames after a rejected one.
+    while (enqueued < count)
+    {
+        uint8_t sent;
+        uint8_t added = tx_queue_entries_enqueue(&p_entries[enqueued], count - enqueued, &sent);
+
+        enqueued += added;
+
+        if ((added == 0) || (added < sent))
+        {
+            break;
+        }
+    }
+
+    return enqueued;
+}
+
+bool nrf_802154_tx_queue_cancel(const uint8_t * p_data)
+{
+    nrf_802154_ser_err_t res;
+    uint32_t             data_handle = (uintptr_t)p_data;
+    void               * p_buffer;
+    bool                 cancel_result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+
+    if (!nrf_802154_buffer_mgr_src_search_by_buffer_handle(nrf_802154_spinel_src_buffer_mgr_get(),
+                                                           data_handle,
+                                                           &p_buffer))
+    {
+        // The frame was not passed to the remote driver or its result has already been notified
+        return false;
+    }
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_QUEUE_CANCEL);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_QUEUE_CANCEL,
+        SPINEL_DATATYPE_NRF_802154_TX_QUEUE_CANCEL,
+        data_handle);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                          &cancel_result);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    if (cancel_result)
+    {
+        // The result of a canceled frame is not notified, so the handle is not released otherwise
+        nrf_802154_buffer_mgr_src_remove_by_buffer_handle(nrf_802154_spinel_src_buffer_mgr_get(),
+                                                          data_handle);
+    }
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return cancel_result;
+}
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
+#if NRF_802154_RETRANSMISSION_ENABLED
+bool nrf_802154_retransmission_config_set(const nrf_802154_retransmission_config_t * p_config)
+{
+    nrf_802154_ser_err_t res;
+    bool                 result = false;
+
+    SERIALIZATION_ERROR_INIT(error);
+
+    NRF_802154_SPINEL_LOG_BANNER_CALLING();
+    NRF_802154_SPINEL_LOG_VAR("%u", p_config->max_frame_retries);
+
+    nrf_802154_spinel_response_notifier_lock_before_request(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RETRANSMISSION_CONFIG_SET);
+
+    res = nrf_802154_spinel_send_cmd_prop_value_set(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RETRANSMISSION_CONFIG_SET,
+        SPINEL_DATATYPE_NRF_802154_RETRANSMISSION_CONFIG_SET,
+        p_config->max_frame_retries,
+        p_config->csma_ca_restart,
+        p_config->frame_pending);
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+    res = net_generic_bool_response_await(CONFIG_NRF_802154_SER_DEFAULT_RESPONSE_TIMEOUT,
+                                          &result);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return result;
+}
+
+#endif // NRF_802154_RETRANSMISSION_ENABLED
+
 #if NRF_802154_TEST_MODES_ENABLED
 nrf_802154_test_mode_csmaca_backoff_t nrf_802154_test_mode_csmaca_backoff_get(void)
 {
@@ -1673,10 +2097,25 @@ void nrf_802154_buffer_free_raw(uint8_t * p_data)
 
     nrf_802154_spinel_response_notifier_lock_before_request(SPINEL_PROP_LAST_STATUS);
 
+#if NRF_802154_SPINEL_CODECS_ENABLED
+    uint8_t buff[NRF_802154_SPINEL_PROP_HEADER_MAX_SIZE + sizeof(uint32_t)];
+    size_t  hdr_len = nrf_802154_spinel_prop_header_pack(
+        buff,
+        SPINEL_CMD_PROP_VALUE_SET,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_BUFFER_FREE_RAW);
+
+    res = nrf_802154_spinel_packed_send(
+        buff,
+        hdr_len,
+        nrf_802154_spinel_codec_buffer_free_raw_pack(&buff[hdr_len],
+                                                     sizeof(buff) - hdr_len,
+                                                     data_handle));
+#else
     res = nrf_802154_spinel_send_cmd_prop_value_set(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_BUFFER_FREE_RAW,
         SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW,
         data_handle);
+#endif
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
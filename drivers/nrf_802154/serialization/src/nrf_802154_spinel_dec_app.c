@@ -48,6 +48,11 @@
 #include "nrf_802154_serialization_error.h"
 #include "nrf_802154_buffer_mgr_dst.h"
 #include "nrf_802154_buffer_mgr_src.h"
+#include "nrf_802154_serialization_config.h"
+
+#if NRF_802154_SPINEL_CODECS_ENABLED
+#include "nrf_802154_spinel_codecs.h"
+#endif
 
 #include "nrf_802154.h"
 #include "nrf_802154_config.h"
@@ -133,6 +138,86 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_detected(
     return NRF_802154_SERIALIZATION_ERROR_OK;
 }
 
+#if NRF_802154_ED_SWEEP_ENABLED
+
+/// Result of the energy detection sweep collected from the channels serialized one at a time.
+static nrf_802154_ed_sweep_result_t m_ed_sweep_result;
+
+/**
+ * @brief Decode SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION_SWEEP_CHANNEL.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_detection_sweep_channel(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    nrf_802154_ed_sweep_channel_result_t result = {};
+    uint8_t                              channel;
+    const void                         * p_histogram;
+    unsigned int                         histogram_len;
+    spinel_ssize_t                       siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP_CHANNEL,
+                                 &channel,
+                                 &result.samples,
+                                 &result.max_dbm,
+                                 &result.mean_dbm,
+                                 &result.percentile_dbm,
+                                 &p_histogram,
+                                 &histogram_len);
+
+    if ((siz < 0) ||
+        (histogram_len != sizeof(result.histogram)) ||
+        ((NRF_802154_ED_SWEEP_CHANNEL_MASK & (1UL << (channel & 0x1fU))) == 0U))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    memcpy(result.histogram, p_histogram, histogram_len);
+    m_ed_sweep_result.channels[channel - 11U] = result;
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTED_SWEEP.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_detected_sweep(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    nrf_802154_energy_detected_t result = {};
+
+    spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
+                                                property_data_len,
+                                                SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED_SWEEP,
+                                                &result.ed_dbm,
+                                                &m_ed_sweep_result.channel_mask);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    result.p_sweep = &m_ed_sweep_result;
+
+    nrf_802154_energy_detected(&result);
+
+    // The statistics of the channels that are not measured by the next sweep must not be kept
+    memset(&m_ed_sweep_result, 0, sizeof(m_ed_sweep_result));
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+#endif // NRF_802154_ED_SWEEP_ENABLED
+
 /**
  * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION_FAILED.
  *
@@ -160,6 +245,44 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_detection_faile
     return NRF_802154_SERIALIZATION_ERROR_OK;
 }
 
+/**
+ * @brief Copy a received frame to a local buffer and notify the higher layer about it.
+ *
+ * @param[in]  remote_frame_handle  Handle to the frame buffer on the remote side.
+ * @param[in]  p_frame              Pointer to the frame data.
+ * @param[in]  frame_hdata_len      Length of the frame hdata.
+ * @param[in]  power                RSSI of the received frame.
+ * @param[in]  lqi                  LQI of the received frame.
+ * @param[in]  timestamp            Timestamp of the received frame.
+ */
+static nrf_802154_ser_err_t received_frame_dispatch(uint32_t     remote_frame_handle,
+                                                    const void * p_frame,
+                                                    size_t       frame_hdata_len,
+                                                    int8_t       power,
+                                                    uint8_t      lqi,
+                                                    uint64_t     timestamp)
+{
+    void * p_local_ptr;
+
+    // Associate the remote frame handle with a local pointer
+    // and copy the buffer content there
+    bool frame_added = nrf_802154_buffer_mgr_dst_add(
+        nrf_802154_spinel_dst_buffer_mgr_get(),
+        remote_frame_handle,
+        p_frame,
+        NRF_802154_DATA_LEN_FROM_HDATA_LEN(frame_hdata_len),
+        &p_local_ptr);
+
+    if (!frame_added)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_NO_MEMORY;
+    }
+
+    nrf_802154_received_timestamp_raw(p_local_ptr, power, lqi, timestamp);
+
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
 /**
  * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW.
  *
@@ -170,14 +293,22 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_received_timestamp_raw
     const void * p_property_data,
     size_t       property_data_len)
 {
-    uint32_t remote_frame_handle;
-    void   * p_frame;
-    size_t   frame_hdata_len;
-    int8_t   power;
-    uint8_t  lqi;
-    uint64_t timestamp;
-    void   * p_local_ptr;
-
+    uint32_t     remote_frame_handle;
+    const void * p_frame;
+    size_t       frame_hdata_len;
+    int8_t       power;
+    uint8_t      lqi;
+    uint64_t     timestamp;
+
+#if NRF_802154_SPINEL_CODECS_ENABLED
+    spinel_ssize_t siz = nrf_802154_spinel_codec_received_timestamp_raw_unpack(
+        p_property_data,
+        property_data_len,
+        NRF_802154_HDATA_DECODE(remote_frame_handle, p_frame, frame_hdata_len),
+        &power,
+        &lqi,
+        &timestamp);
+#else
     spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
                                                 property_data_len,
                                                 SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW,
@@ -187,29 +318,112 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_received_timestamp_raw
                                                 &power,
                                                 &lqi,
                                                 &timestamp);
+#endif
 
     if (siz < 0)
     {
         return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
 
-    // Associate the remote frame handle with a local pointer
-    // and copy the buffer content there
-    bool frame_added = nrf_802154_buffer_mgr_dst_add(
-        nrf_802154_spinel_dst_buffer_mgr_get(),
-        remote_frame_handle,
-        p_frame,
-        NRF_802154_DATA_LEN_FROM_HDATA_LEN(frame_hdata_len),
-        &p_local_ptr);
+    return received_frame_dispatch(remote_frame_handle,
+                                   p_frame,
+                                   frame_hdata_len,
+                                   power,
+                                   lqi,
+                                   timestamp);
+}
 
-    if (!frame_added)
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_data buffer.
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_received_timestamp_raw_batch(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    nrf_802154_ser_err_t result = NRF_802154_SERIALIZATION_ERROR_OK;
+    uint8_t              count;
+    const void         * p_batch;
+    size_t               entries_len;
+
+#if NRF_802154_SPINEL_CODECS_ENABLED
+    spinel_ssize_t siz = nrf_802154_spinel_codec_received_timestamp_raw_batch_unpack(
+        p_property_data,
+        property_data_len,
+        &count,
+        &p_batch,
+        &entries_len);
+#else
+    spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
+                                                property_data_len,
+                                                SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH,
+                                                &count,
+                                                &p_batch,
+                                                &entries_len);
+#endif
+
+    if (siz < 0)
     {
-        return NRF_802154_SERIALIZATION_ERROR_NO_MEMORY;
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
     }
 
-    nrf_802154_received_timestamp_raw(p_local_ptr, power, lqi, timestamp);
+    const uint8_t * p_entries = p_batch;
 
-    return NRF_802154_SERIALIZATION_ERROR_OK;
+    for (uint8_t i = 0U; i < count; i++)
+    {
+        uint32_t     remote_frame_handle;
+        const void * p_frame;
+        size_t       frame_hdata_len;
+        int8_t       power;
+        uint8_t      lqi;
+        uint64_t     timestamp;
+
+#if NRF_802154_SPINEL_CODECS_ENABLED
+        siz = nrf_802154_spinel_codec_received_timestamp_raw_batch_entry_unpack(
+            p_entries,
+            entries_len,
+            NRF_802154_HDATA_DECODE(remote_frame_handle, p_frame, frame_hdata_len),
+            &power,
+            &lqi,
+            &timestamp);
+#else
+        siz = spinel_datatype_unpack(p_entries,
+                                     entries_len,
+                                     SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH_ENTRY,
+                                     NRF_802154_HDATA_DECODE(remote_frame_handle,
+                                                             p_frame,
+                                                             frame_hdata_len),
+                                     &power,
+                                     &lqi,
+                                     &timestamp);
+#endif
+
+        if ((siz <= 0) || ((size_t)siz > entries_len))
+        {
+            return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+        }
+
+        p_entries   += siz;
+        entries_len -= (size_t)siz;
+
+        nrf_802154_ser_err_t res = received_frame_dispatch(remote_frame_handle,
+                                                           p_frame,
+                                                           frame_hdata_len,
+                                                           power,
+                                                           lqi,
+                                                           timestamp);
+
+        // A frame that could not be dispatched must not hold back the frames batched after it,
+        // because nothing else would release them. Report the first failure after the batch.
+        if ((res < 0) && (result >= 0))
+        {
+            result = res;
+        }
+    }
+
+    return result;
 }
 
 /**
@@ -225,11 +439,18 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_receive_failed(
     uint8_t  error;
     uint32_t id;
 
+#if NRF_802154_SPINEL_CODECS_ENABLED
+    spinel_ssize_t siz = nrf_802154_spinel_codec_receive_failed_unpack(p_property_data,
+                                                                       property_data_len,
+                                                                       &error,
+                                                                       &id);
+#else
     spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
                                                 property_data_len,
                                                 SPINEL_DATATYPE_NRF_802154_RECEIVE_FAILED,
                                                 &error,
                                                 &id);
+#endif
 
     if (siz < 0)
     {
@@ -551,6 +772,23 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_stat_timestamps_ge
             NRF_802154_SERIALIZATION_ERROR_OK);
 }
 
+nrf_802154_ser_err_t nrf_802154_spinel_decode_prop_nrf_802154_receive_periodic_stats_get_ret(
+    const void                     * p_property_data,
+    size_t                           property_data_len,
+    bool                           * p_result,
+    nrf_802154_periodic_rx_stats_t * p_stats)
+{
+    spinel_ssize_t siz = spinel_datatype_unpack(
+        p_property_data,
+        property_data_len,
+        SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STATS_GET_RET,
+        p_result,
+        NRF_802154_PERIODIC_RX_STATS_DECODE(*p_stats));
+
+    return ((siz) < 0 ? NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE :
+            NRF_802154_SERIALIZATION_ERROR_OK);
+}
+
 nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(
     const void * p_cmd_data,
     size_t       cmd_data_len)
@@ -586,6 +824,12 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(
         // fall through
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_AT_CANCEL:
         // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_START:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_STOP:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_STATS_GET:
+        // fall through
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CCA:
             // fall through
 #if NRF_802154_CARRIER_FUNCTIONS_ENABLED
@@ -640,8 +884,24 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET:
         // fall through
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET:
             // fall through
 #endif // NRF_802154_CSMA_CA_ENABLED
+#if NRF_802154_TX_QUEUE_ENABLED
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_QUEUE_ENQUEUE_RAW:
+        // fall through
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_QUEUE_CANCEL:
+            // fall through
+#endif // NRF_802154_TX_QUEUE_ENABLED
+#if NRF_802154_RETRANSMISSION_ENABLED
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RETRANSMISSION_CONFIG_SET:
+            // fall through
+#endif // NRF_802154_RETRANSMISSION_ENABLED
+#if NRF_802154_ED_SWEEP_ENABLED
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION_SWEEP:
+            // fall through
+#endif // NRF_802154_ED_SWEEP_ENABLED
 #if NRF_802154_TEST_MODES_ENABLED
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_SET:
         // fall through
@@ -676,6 +936,16 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(
             return spinel_decode_prop_nrf_802154_energy_detected(p_property_data,
                                                                  property_data_len);
 
+#if NRF_802154_ED_SWEEP_ENABLED
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION_SWEEP_CHANNEL:
+            return spinel_decode_prop_nrf_802154_energy_detection_sweep_channel(p_property_data,
+                                                                                property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTED_SWEEP:
+            return spinel_decode_prop_nrf_802154_energy_detected_sweep(p_property_data,
+                                                                       property_data_len);
+
+#endif // NRF_802154_ED_SWEEP_ENABLED
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION_FAILED:
             return spinel_decode_prop_nrf_802154_energy_detection_failed(p_property_data,
                                                                          property_data_len);
@@ -684,6 +954,10 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_is(
             return spinel_decode_prop_nrf_802154_received_timestamp_raw(p_property_data,
                                                                         property_data_len);
 
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH:
+            return spinel_decode_prop_nrf_802154_received_timestamp_raw_batch(p_property_data,
+                                                                              property_data_len);
+
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMITTED_RAW:
             return spinel_decode_prop_nrf_802154_transmitted_raw(p_property_data,
                                                                  property_data_len);
@@ -33,6 +33,7 @@
  */
 
 #include <stddef.h>
+#include <string.h>
 
 #include "nrf_802154_const.h"
 
@@ -45,6 +46,11 @@
 #include "nrf_802154_serialization_error_helper.h"
 #include "nrf_802154_buffer_mgr_dst.h"
 #include "nrf_802154_buffer_mgr_src.h"
+#include "nrf_802154_serialization_config.h"
+
+#if NRF_802154_SPINEL_CODECS_ENABLED
+#include "nrf_802154_spinel_codecs.h"
+#endif
 
 #include "nrf_802154.h"
 #include "nrf_802154_config.h"
@@ -191,6 +197,117 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_receive_at_cancel(
         result);
 }
 
+#if NRF_802154_PERIODIC_RX_SCHEDULES > 0
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_START.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_receive_periodic_start(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    nrf_802154_periodic_rx_params_t params;
+    uint8_t                         schedule;
+    const uint8_t                 * p_channels;
+    unsigned int                    channels_len;
+    spinel_ssize_t                  siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_START,
+                                 &schedule,
+                                 &params.rx_time,
+                                 &params.period,
+                                 &params.window,
+                                 &p_channels,
+                                 &channels_len);
+
+    if ((siz < 0) || (channels_len > sizeof(params.channels)))
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    memcpy(params.channels, p_channels, channels_len);
+    params.channels_len = (uint8_t)channels_len;
+
+    bool result = nrf_802154_receive_periodic_start(schedule, &params);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_START,
+        SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_START_RET,
+        result);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_STOP.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_receive_periodic_stop(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint8_t        schedule;
+    spinel_ssize_t siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STOP,
+                                 &schedule);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    bool result = nrf_802154_receive_periodic_stop(schedule);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_STOP,
+        SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STOP_RET,
+        result);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_STATS_GET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_receive_periodic_stats_get(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    nrf_802154_periodic_rx_stats_t stats = {0};
+    uint8_t                        schedule;
+    spinel_ssize_t                 siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STATS_GET,
+                                 &schedule);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    bool result = nrf_802154_receive_periodic_stats_get(schedule, &stats);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_STATS_GET,
+        SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STATS_GET_RET,
+        result,
+        NRF_802154_PERIODIC_RX_STATS_ENCODE(stats));
+}
+
+#endif // NRF_802154_PERIODIC_RX_SCHEDULES > 0
 #endif // NRF_802154_DELAYED_TRX_ENABLED
 
 static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_channel_get(const void * p_property_data,
@@ -559,6 +676,44 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_detection(
         result);
 }
 
+#if NRF_802154_ED_SWEEP_ENABLED
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION_SWEEP.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_energy_detection_sweep(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    nrf_802154_ed_sweep_params_t params;
+    spinel_ssize_t               siz;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP,
+                                 &params.channel_mask,
+                                 &params.dwell_us,
+                                 &params.iterations);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    bool result = nrf_802154_energy_detection_sweep(&params);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION_SWEEP,
+        SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP_RET,
+        result);
+}
+
+#endif // NRF_802154_ED_SWEEP_ENABLED
+
 /**
  * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_AUTO_PENDING_BIT_SET.
  *
@@ -1107,8 +1262,220 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csma_ca_max_backoffs_g
         max_backoffs);
 }
 
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_csma_ca_backoff_policy_set(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    nrf_802154_csma_ca_backoff_policy_id_t policy;
+    spinel_ssize_t                         siz;
+    bool                                   result;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET,
+                                 &policy);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    result = nrf_802154_csma_ca_backoff_policy_set(policy);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET,
+        SPINEL_DATATYPE_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET_RET,
+        result);
+}
+
 #endif // NRF_802154_CSMA_CA_ENABLED
 
+#if NRF_802154_TX_QUEUE_ENABLED
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_QUEUE_ENQUEUE_RAW.
+ *
+ * The frames of the command are added to the transmit queue together. The frames that are not
+ * added, including the ones following a frame that could not be decoded, are released and the
+ * number of frames added is returned.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_tx_queue_enqueue_raw(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    nrf_802154_tx_queue_entry_t entries[NRF_802154_TX_QUEUE_SIZE];
+    uint8_t                     count;
+    const void                * p_batch;
+    size_t                      entries_len;
+    uint8_t                     decoded  = 0;
+    uint8_t                     enqueued = 0;
+
+    spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
+                                                property_data_len,
+                                                SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW,
+                                                &count,
+                                                &p_batch,
+                                                &entries_len);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    const uint8_t * p_entries = p_batch;
+
+    // Frames that exceed the capacity of the queue would be rejected anyway
+    count = (count < NRF_802154_TX_QUEUE_SIZE) ? count : NRF_802154_TX_QUEUE_SIZE;
+
+    for (; decoded < count; decoded++)
+    {
+        uint32_t     remote_frame_handle;
+        const void * p_frame;
+        size_t       frame_hdata_len;
+        void       * p_local_frame_ptr;
+
+        siz = spinel_datatype_unpack(p_entries,
+                                     entries_len,
+                                     SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW_ENTRY,
+                                     NRF_802154_TX_QUEUE_METADATA_DECODE(entries[decoded].metadata),
+                                     NRF_802154_HDATA_DECODE(remote_frame_handle,
+                                                             p_frame,
+                                                             frame_hdata_len));
+
+        if ((siz <= 0) || ((size_t)siz > entries_len))
+        {
+            break;
+        }
+
+        p_entries   += siz;
+        entries_len -= (size_t)siz;
+
+        // Map the remote handle to locally accessible pointer and copy the buffer content there
+        if (!nrf_802154_buffer_mgr_dst_add(nrf_802154_spinel_dst_buffer_mgr_get(),
+                                           remote_frame_handle,
+                                           p_frame,
+                                           NRF_802154_DATA_LEN_FROM_HDATA_LEN(frame_hdata_len),
+                                           &p_local_frame_ptr))
+        {
+            break;
+        }
+
+        entries[decoded].p_data = p_local_frame_ptr;
+    }
+
+    if (decoded != 0)
+    {
+        enqueued = nrf_802154_tx_queue_enqueue_raw(entries, decoded);
+    }
+
+    for (uint8_t i = enqueued; i < decoded; i++)
+    {
+        nrf_802154_buffer_mgr_dst_remove_by_local_pointer(nrf_802154_spinel_dst_buffer_mgr_get(),
+                                                          entries[i].p_data);
+    }
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_QUEUE_ENQUEUE_RAW,
+        SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW_RET,
+        enqueued);
+}
+
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_QUEUE_CANCEL.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_tx_queue_cancel(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    uint32_t remote_frame_handle;
+    void   * p_local_frame_ptr;
+    bool     result = false;
+
+    spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
+                                                property_data_len,
+                                                SPINEL_DATATYPE_NRF_802154_TX_QUEUE_CANCEL,
+                                                &remote_frame_handle);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    if (nrf_802154_buffer_mgr_dst_search_by_buffer_handle(nrf_802154_spinel_dst_buffer_mgr_get(),
+                                                          remote_frame_handle,
+                                                          &p_local_frame_ptr))
+    {
+        result = nrf_802154_tx_queue_cancel(p_local_frame_ptr);
+    }
+
+    if (result)
+    {
+        // The result of a canceled frame is not notified, so the buffer is not released otherwise
+        nrf_802154_buffer_mgr_dst_remove_by_local_pointer(nrf_802154_spinel_dst_buffer_mgr_get(),
+                                                          p_local_frame_ptr);
+    }
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_QUEUE_CANCEL,
+        SPINEL_DATATYPE_NRF_802154_TX_QUEUE_CANCEL_RET,
+        result);
+}
+
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
+#if NRF_802154_RETRANSMISSION_ENABLED
+/**
+ * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RETRANSMISSION_CONFIG_SET.
+ *
+ * @param[in]  p_property_data    Pointer to a buffer that contains data to be decoded.
+ * @param[in]  property_data_len  Size of the @ref p_property_data buffer.
+ *
+ */
+static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_retransmission_config_set(
+    const void * p_property_data,
+    size_t       property_data_len)
+{
+    nrf_802154_retransmission_config_t config;
+    spinel_ssize_t                     siz;
+    bool                               result;
+
+    siz = spinel_datatype_unpack(p_property_data,
+                                 property_data_len,
+                                 SPINEL_DATATYPE_NRF_802154_RETRANSMISSION_CONFIG_SET,
+                                 &config.max_frame_retries,
+                                 &config.csma_ca_restart,
+                                 &config.frame_pending);
+
+    if (siz < 0)
+    {
+        return NRF_802154_SERIALIZATION_ERROR_DECODING_FAILURE;
+    }
+
+    result = nrf_802154_retransmission_config_set(&config);
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RETRANSMISSION_CONFIG_SET,
+        SPINEL_DATATYPE_NRF_802154_RETRANSMISSION_CONFIG_SET_RET,
+        result);
+}
+
+#endif // NRF_802154_RETRANSMISSION_ENABLED
+
 #if NRF_802154_TEST_MODES_ENABLED
 /**
  * @brief Decode and dispatch SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_SET.
@@ -1509,10 +1876,16 @@ static nrf_802154_ser_err_t spinel_decode_prop_nrf_802154_buffer_free_raw(
     uint32_t local_frame_handle;
     void   * p_local_ptr;
 
+#if NRF_802154_SPINEL_CODECS_ENABLED
+    spinel_ssize_t siz = nrf_802154_spinel_codec_buffer_free_raw_unpack(p_property_data,
+                                                                        property_data_len,
+                                                                        &local_frame_handle);
+#else
     spinel_ssize_t siz = spinel_datatype_unpack(p_property_data,
                                                 property_data_len,
                                                 SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW,
                                                 &local_frame_handle);
+#endif
 
     if (siz < 0)
     {
@@ -1939,6 +2312,20 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_set(const void * p_
             return spinel_decode_prop_nrf_802154_receive_at_cancel(p_property_data,
                                                                    property_data_len);
 
+#if NRF_802154_PERIODIC_RX_SCHEDULES > 0
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_START:
+            return spinel_decode_prop_nrf_802154_receive_periodic_start(p_property_data,
+                                                                        property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_STOP:
+            return spinel_decode_prop_nrf_802154_receive_periodic_stop(p_property_data,
+                                                                       property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_PERIODIC_STATS_GET:
+            return spinel_decode_prop_nrf_802154_receive_periodic_stats_get(p_property_data,
+                                                                            property_data_len);
+
+#endif // NRF_802154_PERIODIC_RX_SCHEDULES > 0
 #endif // NRF_802154_DELAYED_TRX_ENABLED
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CHANNEL_GET:
             return spinel_decode_prop_nrf_802154_channel_get(p_property_data, property_data_len);
@@ -2013,6 +2400,12 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_set(const void * p_
             return spinel_decode_prop_nrf_802154_energy_detection(p_property_data,
                                                                   property_data_len);
 
+#if NRF_802154_ED_SWEEP_ENABLED
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION_SWEEP:
+            return spinel_decode_prop_nrf_802154_energy_detection_sweep(p_property_data,
+                                                                        property_data_len);
+#endif // NRF_802154_ED_SWEEP_ENABLED
+
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_POWER_SET:
             return spinel_decode_prop_nrf_802154_tx_power_set(p_property_data, property_data_len);
 
@@ -2047,8 +2440,28 @@ nrf_802154_ser_err_t nrf_802154_spinel_decode_cmd_prop_value_set(const void * p_
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET:
             return spinel_decode_prop_nrf_802154_csma_ca_max_backoffs_get(p_property_data,
                                                                           property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET:
+            return spinel_decode_prop_nrf_802154_csma_ca_backoff_policy_set(p_property_data,
+                                                                            property_data_len);
 #endif // NRF_802154_CSMA_CA_ENABLED
 
+#if NRF_802154_TX_QUEUE_ENABLED
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_QUEUE_ENQUEUE_RAW:
+            return spinel_decode_prop_nrf_802154_tx_queue_enqueue_raw(p_property_data,
+                                                                      property_data_len);
+
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TX_QUEUE_CANCEL:
+            return spinel_decode_prop_nrf_802154_tx_queue_cancel(p_property_data,
+                                                                 property_data_len);
+#endif // NRF_802154_TX_QUEUE_ENABLED
+
+#if NRF_802154_RETRANSMISSION_ENABLED
+        case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RETRANSMISSION_CONFIG_SET:
+            return spinel_decode_prop_nrf_802154_retransmission_config_set(p_property_data,
+                                                                           property_data_len);
+#endif // NRF_802154_RETRANSMISSION_ENABLED
+
 #if NRF_802154_TEST_MODES_ENABLED
         case SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TEST_MODE_CSMACA_BACKOFF_SET:
             return spinel_decode_prop_nrf_802154_test_mode_csmaca_backoff_set(p_property_data,
@@ -44,7 +44,9 @@
  * causing calling of corresponding callouts in the application core.
  */
 
+#include <stdbool.h>
 #include <stdint.h>
+#include <string.h>
 
 #include "../spinel_base/spinel.h"
 #include "nrf_802154_spinel.h"
@@ -56,12 +58,56 @@
 #include "nrf_802154_serialization_error_helper.h"
 #include "nrf_802154_buffer_mgr_dst.h"
 #include "nrf_802154_buffer_mgr_src.h"
+#include "nrf_802154_serialization.h"
+#include "nrf_802154_serialization_config.h"
+#include "nrf_802154_serialization_crit_sect.h"
+
+#if NRF_802154_SPINEL_CODECS_ENABLED
+#include "nrf_802154_spinel_codecs.h"
+#endif
 
 #include "nrf_802154.h"
 
+#if NRF_802154_SPINEL_RX_BATCH_ENABLED
+#include "nrf_802154_sl_timer.h"
+#endif
+
 /**@brief A pointer to the last transmitted ACK frame. */
 static const uint8_t * volatile mp_last_tx_ack;
 
+#if NRF_802154_SPINEL_RX_BATCH_ENABLED
+/**@brief Received frames waiting to be sent in a single batch. */
+static struct
+{
+    uint8_t               data[NRF_802154_SPINEL_RX_BATCH_MAX_SIZE];       ///< Packed batch entries.
+    size_t                len;                                             ///< Length of packed batch entries.
+    uint8_t             * p_frames[NRF_802154_SPINEL_RX_BATCH_MAX_FRAMES]; ///< Local pointers of batched frames.
+    uint32_t              handles[NRF_802154_SPINEL_RX_BATCH_MAX_FRAMES];  ///< Handles of batched frames.
+    uint8_t               count;                                           ///< Number of batched frames.
+    uint64_t              first_added_time;                                ///< Time at which the oldest batched frame was added.
+    uint64_t              added_time_sum;                                  ///< Sum of times at which the batched frames were added.
+    nrf_802154_sl_timer_t timer;                                           ///< Timer that sends the batch when its latency budget expires.
+    bool                  timer_initialized;                               ///< Flag indicating if @c timer was initialized.
+    bool                  sending;                                         ///< Flag indicating if a batch is being sent.
+    bool                  send_pending;                                    ///< Flag indicating if the batch was to be sent while another one was being sent.
+} m_rx_batch;
+
+/**@brief Batch being sent, taken over from @ref m_rx_batch. */
+static struct
+{
+    uint8_t   data[NRF_802154_SPINEL_RX_BATCH_MAX_SIZE];       ///< Packed batch entries.
+    size_t    len;                                             ///< Length of packed batch entries.
+    uint8_t * p_frames[NRF_802154_SPINEL_RX_BATCH_MAX_FRAMES]; ///< Local pointers of batched frames.
+    uint32_t  handles[NRF_802154_SPINEL_RX_BATCH_MAX_FRAMES];  ///< Handles of batched frames.
+    uint8_t   count;                                           ///< Number of batched frames.
+    uint64_t  first_added_time;                                ///< Time at which the oldest batched frame was added.
+    uint64_t  added_time_sum;                                  ///< Sum of times at which the batched frames were added.
+} m_rx_batch_sent;
+#endif
+
+/**@brief Statistics of received frame batching. */
+static nrf_802154_serialization_rx_batch_stats_t m_rx_batch_stats;
+
 static void local_transmitted_frame_ptr_free(void * p_frame)
 {
     SERIALIZATION_ERROR_INIT(error);
@@ -81,12 +127,320 @@ bail:
     return;
 }
 
+static void local_received_frame_drop(uint8_t * p_data, uint32_t local_data_handle)
+{
+    nrf_802154_buffer_mgr_src_remove_by_buffer_handle(nrf_802154_spinel_src_buffer_mgr_get(),
+                                                      local_data_handle);
+
+    nrf_802154_buffer_free_raw(p_data);
+}
+
+#if NRF_802154_SPINEL_RX_BATCH_ENABLED
+
+/**
+ * @brief Sends the batched frames.
+ *
+ * The batch is taken over inside the serialization critical section and sent outside of it, so
+ * the Spinel backend is not called with the critical section held. Only one batch is sent at
+ * a time. If a batch is to be sent while another one is being sent by a preempted context,
+ * the preempted context sends it once the previous batch is sent, so the batches keep their order.
+ * The frames of a batch that could not be sent are dropped.
+ */
+static nrf_802154_ser_err_t rx_batch_send(void)
+{
+    nrf_802154_ser_err_t res = NRF_802154_SERIALIZATION_ERROR_OK;
+    uint32_t             crit_sect;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    if (m_rx_batch.sending)
+    {
+        m_rx_batch.send_pending = (m_rx_batch.count > 0U);
+        nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+        return res;
+    }
+
+    while (m_rx_batch.count > 0U)
+    {
+        (void)nrf_802154_sl_timer_remove(&m_rx_batch.timer);
+
+        memcpy(m_rx_batch_sent.data, m_rx_batch.data, m_rx_batch.len);
+        memcpy(m_rx_batch_sent.p_frames,
+               m_rx_batch.p_frames,
+               m_rx_batch.count * sizeof(m_rx_batch_sent.p_frames[0]));
+        memcpy(m_rx_batch_sent.handles,
+               m_rx_batch.handles,
+               m_rx_batch.count * sizeof(m_rx_batch_sent.handles[0]));
+        m_rx_batch_sent.len              = m_rx_batch.len;
+        m_rx_batch_sent.count            = m_rx_batch.count;
+        m_rx_batch_sent.first_added_time = m_rx_batch.first_added_time;
+        m_rx_batch_sent.added_time_sum   = m_rx_batch.added_time_sum;
+
+        m_rx_batch.count          = 0U;
+        m_rx_batch.len            = 0U;
+        m_rx_batch.added_time_sum = 0U;
+        m_rx_batch.sending        = true;
+        m_rx_batch.send_pending   = false;
+
+        nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+        NRF_802154_SPINEL_LOG_BANNER_CALLING();
+        NRF_802154_SPINEL_LOG_VAR("%u", m_rx_batch_sent.count);
+
+        res = nrf_802154_spinel_send_cmd_prop_value_is(
+            SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH,
+            SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH,
+            m_rx_batch_sent.count,
+            m_rx_batch_sent.data,
+            m_rx_batch_sent.len);
+
+        if (res < 0)
+        {
+            for (uint8_t i = 0U; i < m_rx_batch_sent.count; i++)
+            {
+                local_received_frame_drop(m_rx_batch_sent.p_frames[i],
+                                          m_rx_batch_sent.handles[i]);
+            }
+        }
+
+        nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+        if (res >= 0)
+        {
+            uint64_t now       = nrf_802154_sl_timer_current_time_get();
+            uint32_t max_delay = (uint32_t)(now - m_rx_batch_sent.first_added_time);
+
+            m_rx_batch_stats.batches++;
+            m_rx_batch_stats.frames         += m_rx_batch_sent.count;
+            m_rx_batch_stats.total_delay_us +=
+                (now * m_rx_batch_sent.count) - m_rx_batch_sent.added_time_sum;
+
+            if (m_rx_batch_sent.count > m_rx_batch_stats.max_frames_per_batch)
+            {
+                m_rx_batch_stats.max_frames_per_batch = m_rx_batch_sent.count;
+            }
+
+            if (max_delay > m_rx_batch_stats.max_delay_us)
+            {
+                m_rx_batch_stats.max_delay_us = max_delay;
+            }
+        }
+
+        m_rx_batch.sending = false;
+
+        if ((res < 0) || !m_rx_batch.send_pending)
+        {
+            break;
+        }
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    return res;
+}
+
+/**
+ * @brief Callback of the timer that sends the batch when its oldest frame exceeds
+ *        @ref NRF_802154_SPINEL_RX_BATCH_MAX_LATENCY_US.
+ */
+static void rx_batch_timeout(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+
+    nrf_802154_serialization_rx_batch_flush();
+}
+
+/**
+ * @brief Packs a received frame as a batch entry.
+ *
+ * @returns Number of bytes written to @p p_out, a value greater than @p out_len if the entry
+ *          does not fit in @p p_out or -1 if the entry could not be packed.
+ */
+static spinel_ssize_t rx_batch_entry_pack(uint8_t       * p_out,
+                                          size_t          out_len,
+                                          const uint8_t * p_data,
+                                          uint32_t        local_data_handle,
+                                          int8_t          power,
+                                          uint8_t         lqi,
+                                          uint64_t        time)
+{
+#if NRF_802154_SPINEL_CODECS_ENABLED
+    spinel_ssize_t siz = nrf_802154_spinel_codec_received_timestamp_raw_batch_entry_pack(
+        p_out,
+        out_len,
+        NRF_802154_HDATA_ENCODE(local_data_handle, p_data, p_data[0]),
+        power,
+        lqi,
+        time);
+
+    // The codec does not report the required size of an entry that does not fit
+    return (siz < 0) ? (spinel_ssize_t)(out_len + 1U) : siz;
+#else
+    return spinel_datatype_pack(p_out,
+                                out_len,
+                                SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH_ENTRY,
+                                NRF_802154_HDATA_ENCODE(local_data_handle, p_data, p_data[0]),
+                                power,
+                                lqi,
+                                time);
+#endif
+}
+
+/**
+ * @brief Adds a received frame to the batch and sends the batch if it reached its budget.
+ *
+ * The flush timer is started when the first frame is added to an empty batch, so that the batch
+ * is sent when its oldest frame exceeds @ref NRF_802154_SPINEL_RX_BATCH_MAX_LATENCY_US even if no
+ * other notification follows. The frame is dropped on failure, so the caller must not release it
+ * again. The frame is also dropped if it does not fit in the batch while a preempted context is
+ * sending the previous batch.
+ */
+static nrf_802154_ser_err_t rx_batch_add(uint8_t * p_data,
+                                         uint32_t  local_data_handle,
+                                         int8_t    power,
+                                         uint8_t   lqi,
+                                         uint64_t  time)
+{
+    nrf_802154_ser_err_t res      = NRF_802154_SERIALIZATION_ERROR_OK;
+    bool                 send_due = false;
+    bool                 added    = false;
+    bool                 full     = false;
+    uint32_t             crit_sect;
+    size_t               space;
+    spinel_ssize_t       siz;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+    space = sizeof(m_rx_batch.data) - m_rx_batch.len;
+    siz   = rx_batch_entry_pack(&m_rx_batch.data[m_rx_batch.len],
+                                space,
+                                p_data,
+                                local_data_handle,
+                                power,
+                                lqi,
+                                time);
+
+    if ((siz >= 0) &&
+        (((size_t)siz > space) || (m_rx_batch.count >= NRF_802154_SPINEL_RX_BATCH_MAX_FRAMES)) &&
+        (m_rx_batch.count > 0U))
+    {
+        // The frame does not fit in the current batch. Send the batch and start a new one
+        nrf_802154_serialization_crit_sect_exit(crit_sect);
+        res = rx_batch_send();
+        nrf_802154_serialization_crit_sect_enter(&crit_sect);
+
+        space = sizeof(m_rx_batch.data) - m_rx_batch.len;
+        siz   = rx_batch_entry_pack(&m_rx_batch.data[m_rx_batch.len],
+                                    space,
+                                    p_data,
+                                    local_data_handle,
+                                    power,
+                                    lqi,
+                                    time);
+    }
+
+    if ((res >= 0) && (siz >= 0) && ((size_t)siz <= space) &&
+        (m_rx_batch.count < NRF_802154_SPINEL_RX_BATCH_MAX_FRAMES))
+    {
+        uint64_t now = nrf_802154_sl_timer_current_time_get();
+
+        if (m_rx_batch.count == 0U)
+        {
+            if (!m_rx_batch.timer_initialized)
+            {
+                nrf_802154_sl_timer_init(&m_rx_batch.timer);
+                m_rx_batch.timer.action_type              = NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK;
+                m_rx_batch.timer.action.callback.callback = rx_batch_timeout;
+                m_rx_batch.timer_initialized              = true;
+            }
+
+            m_rx_batch.first_added_time   = now;
+            m_rx_batch.timer.trigger_time = now + NRF_802154_SPINEL_RX_BATCH_MAX_LATENCY_US;
+
+            (void)nrf_802154_sl_timer_add(&m_rx_batch.timer);
+        }
+
+        m_rx_batch.p_frames[m_rx_batch.count] = p_data;
+        m_rx_batch.handles[m_rx_batch.count]  = local_data_handle;
+        m_rx_batch.count++;
+        m_rx_batch.len            += (size_t)siz;
+        m_rx_batch.added_time_sum += now;
+
+        send_due = (m_rx_batch.count >= NRF_802154_SPINEL_RX_BATCH_MAX_FRAMES) ||
+                   ((now - m_rx_batch.first_added_time) >= NRF_802154_SPINEL_RX_BATCH_MAX_LATENCY_US);
+        added = true;
+    }
+    else
+    {
+        full = (siz >= 0) && (m_rx_batch.count > 0U);
+    }
+
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+
+    if (!added)
+    {
+        local_received_frame_drop(p_data, local_data_handle);
+
+        if (res < 0)
+        {
+            return res;
+        }
+
+        // A full batch cannot be sent while a preempted context is sending the previous one
+        return full ? NRF_802154_SERIALIZATION_ERROR_NO_MEMORY :
+               NRF_802154_SERIALIZATION_ERROR_ENCODING_FAILURE;
+    }
+
+    if (send_due)
+    {
+        res = rx_batch_send();
+    }
+
+    return res;
+}
+
+#else // NRF_802154_SPINEL_RX_BATCH_ENABLED
+
+static inline nrf_802154_ser_err_t rx_batch_send(void)
+{
+    return NRF_802154_SERIALIZATION_ERROR_OK;
+}
+
+#endif // NRF_802154_SPINEL_RX_BATCH_ENABLED
+
+void nrf_802154_serialization_rx_batch_flush(void)
+{
+    SERIALIZATION_ERROR_INIT(error);
+
+    nrf_802154_ser_err_t res = rx_batch_send();
+
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
+bail:
+    SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
+
+    return;
+}
+
+void nrf_802154_serialization_rx_batch_stats_get(nrf_802154_serialization_rx_batch_stats_t * p_stats)
+{
+    uint32_t crit_sect;
+
+    nrf_802154_serialization_crit_sect_enter(&crit_sect);
+    *p_stats = m_rx_batch_stats;
+    nrf_802154_serialization_crit_sect_exit(crit_sect);
+}
+
 void nrf_802154_cca_done(bool channel_free)
 {
     nrf_802154_ser_err_t res;
 
     SERIALIZATION_ERROR_INIT(error);
 
+    res = rx_batch_send();
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR_NAMED("%s", channel_free ? "true" : "false", "channel_free");
 
@@ -109,6 +463,9 @@ void nrf_802154_cca_failed(nrf_802154_cca_error_t err)
 
     SERIALIZATION_ERROR_INIT(error);
 
+    res = rx_batch_send();
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR("%u", err);
 
@@ -125,19 +482,81 @@ bail:
     return;
 }
 
+#if NRF_802154_ED_SWEEP_ENABLED
+
+/**
+ * @brief Serializes the result of the energy detection sweep.
+ *
+ * The statistics of the measured channels are sent one channel at a time, so that a single
+ * message does not exceed the size of a Spinel frame, followed by the end of the sweep.
+ */
+static nrf_802154_ser_err_t energy_detected_sweep_send(
+    const nrf_802154_energy_detected_t * p_result)
+{
+    const nrf_802154_ed_sweep_result_t * p_sweep = p_result->p_sweep;
+    nrf_802154_ser_err_t                 res;
+
+    for (uint8_t i = 0U; i < NRF_802154_ED_SWEEP_CHANNELS_NUM; i++)
+    {
+        const nrf_802154_ed_sweep_channel_result_t * p_channel = &p_sweep->channels[i];
+        uint8_t                                      channel   = i + 11U;
+
+        if ((p_sweep->channel_mask & (1UL << channel)) == 0U)
+        {
+            continue;
+        }
+
+        res = nrf_802154_spinel_send_cmd_prop_value_is(
+            SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTION_SWEEP_CHANNEL,
+            SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP_CHANNEL,
+            channel,
+            p_channel->samples,
+            p_channel->max_dbm,
+            p_channel->mean_dbm,
+            p_channel->percentile_dbm,
+            p_channel->histogram,
+            (uint32_t)sizeof(p_channel->histogram));
+
+        if (res < 0)
+        {
+            return res;
+        }
+    }
+
+    return nrf_802154_spinel_send_cmd_prop_value_is(
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTED_SWEEP,
+        SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED_SWEEP,
+        p_result->ed_dbm,
+        p_sweep->channel_mask);
+}
+
+#endif // NRF_802154_ED_SWEEP_ENABLED
+
 void nrf_802154_energy_detected(const nrf_802154_energy_detected_t * p_result)
 {
     nrf_802154_ser_err_t res;
 
     SERIALIZATION_ERROR_INIT(error);
 
+    res = rx_batch_send();
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR("%u", p_result->ed_dbm);
 
-    res = nrf_802154_spinel_send_cmd_prop_value_is(
-        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTED,
-        SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED,
-        p_result->ed_dbm);
+#if NRF_802154_ED_SWEEP_ENABLED
+    if (p_result->p_sweep != NULL)
+    {
+        res = energy_detected_sweep_send(p_result);
+    }
+    else
+#endif
+    {
+        res = nrf_802154_spinel_send_cmd_prop_value_is(
+            SPINEL_PROP_VENDOR_NORDIC_NRF_802154_ENERGY_DETECTED,
+            SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED,
+            p_result->ed_dbm);
+    }
 
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
@@ -153,6 +572,9 @@ void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t err)
 
     SERIALIZATION_ERROR_INIT(error);
 
+    res = rx_batch_send();
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_VAR("%u", err);
 
@@ -209,6 +631,13 @@ void nrf_802154_received_timestamp_raw(uint8_t * p_data,
 
     SERIALIZATION_ERROR_INIT(error);
 
+    if (mp_last_tx_ack != NULL)
+    {
+        // Batched frames were received before the ACK was transmitted
+        res = rx_batch_send();
+        SERIALIZATION_ERROR_CHECK(res, error, bail);
+    }
+
     res = last_tx_ack_started_send();
     SERIALIZATION_ERROR_CHECK(res, error, bail);
 
@@ -227,7 +656,30 @@ void nrf_802154_received_timestamp_raw(uint8_t * p_data,
         SERIALIZATION_ERROR(NRF_802154_SERIALIZATION_ERROR_NO_MEMORY, error, bail);
     }
 
+#if NRF_802154_SPINEL_RX_BATCH_ENABLED
+    // Add the frame to the batch. The frame is dropped by the batch if that fails
+    res = rx_batch_add(p_data, local_data_handle, power, lqi, time);
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+#else
     // Serialize the call
+#if NRF_802154_SPINEL_CODECS_ENABLED
+    uint8_t buff[NRF_802154_SPINEL_FRAME_BUFFER_SIZE];
+    size_t  hdr_len = nrf_802154_spinel_prop_header_pack(
+        buff,
+        SPINEL_CMD_PROP_VALUE_IS,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW);
+
+    res = nrf_802154_spinel_packed_send(
+        buff,
+        hdr_len,
+        nrf_802154_spinel_codec_received_timestamp_raw_pack(
+            &buff[hdr_len],
+            sizeof(buff) - hdr_len,
+            NRF_802154_HDATA_ENCODE(local_data_handle, p_data, p_data[0]),
+            power,
+            lqi,
+            time));
+#else
     res = nrf_802154_spinel_send_cmd_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVED_TIMESTAMP_RAW,
         SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW,
@@ -235,17 +687,16 @@ void nrf_802154_received_timestamp_raw(uint8_t * p_data,
         power,
         lqi,
         time);
+#endif
 
     if (res < 0)
     {
         // Serialization failed. Drop the frame, clean up and throw an error
-        nrf_802154_buffer_mgr_src_remove_by_buffer_handle(nrf_802154_spinel_src_buffer_mgr_get(),
-                                                          local_data_handle);
-
-        nrf_802154_buffer_free_raw(p_data);
+        local_received_frame_drop(p_data, local_data_handle);
 
         SERIALIZATION_ERROR(res, error, bail);
     }
+#endif // NRF_802154_SPINEL_RX_BATCH_ENABLED
 
 bail:
     SERIALIZATION_ERROR_RAISE_IF_FAILED(error);
@@ -259,6 +710,9 @@ void nrf_802154_receive_failed(nrf_802154_rx_error_t error, uint32_t id)
 
     SERIALIZATION_ERROR_INIT(ser_error);
 
+    res = rx_batch_send();
+    SERIALIZATION_ERROR_CHECK(res, ser_error, bail);
+
     res = last_tx_ack_started_send();
     SERIALIZATION_ERROR_CHECK(res, ser_error, bail);
 
@@ -266,11 +720,27 @@ void nrf_802154_receive_failed(nrf_802154_rx_error_t error, uint32_t id)
     NRF_802154_SPINEL_LOG_VAR("%u", error);
 
     // Serialize the call
+#if NRF_802154_SPINEL_CODECS_ENABLED
+    uint8_t buff[NRF_802154_SPINEL_PROP_HEADER_MAX_SIZE + sizeof(uint8_t) + sizeof(uint32_t)];
+    size_t  hdr_len = nrf_802154_spinel_prop_header_pack(
+        buff,
+        SPINEL_CMD_PROP_VALUE_IS,
+        SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_FAILED);
+
+    res = nrf_802154_spinel_packed_send(
+        buff,
+        hdr_len,
+        nrf_802154_spinel_codec_receive_failed_pack(&buff[hdr_len],
+                                                    sizeof(buff) - hdr_len,
+                                                    error,
+                                                    id));
+#else
     res = nrf_802154_spinel_send_cmd_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_RECEIVE_FAILED,
         SPINEL_DATATYPE_NRF_802154_RECEIVE_FAILED,
         error,
         id);
+#endif
 
     SERIALIZATION_ERROR_CHECK(res, ser_error, bail);
 
@@ -281,12 +751,16 @@ bail:
 void nrf_802154_transmitted_raw(uint8_t                                   * p_frame,
                                 const nrf_802154_transmit_done_metadata_t * p_metadata)
 {
-    uint32_t  remote_frame_handle;
-    uint32_t  ack_handle = 0;
-    uint8_t * p_ack      = p_metadata->data.transmitted.p_ack;
+    nrf_802154_ser_err_t res;
+    uint32_t             remote_frame_handle;
+    uint32_t             ack_handle = 0;
+    uint8_t            * p_ack      = p_metadata->data.transmitted.p_ack;
 
     SERIALIZATION_ERROR_INIT(error);
 
+    res = rx_batch_send();
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_BUFF(p_frame, p_frame[0]);
 
@@ -319,7 +793,7 @@ void nrf_802154_transmitted_raw(uint8_t                                   * p_fr
     }
 
     // Serialize the call
-    nrf_802154_ser_err_t res = nrf_802154_spinel_send_cmd_prop_value_is(
+    res = nrf_802154_spinel_send_cmd_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMITTED_RAW,
         SPINEL_DATATYPE_NRF_802154_TRANSMITTED_RAW,
         NRF_802154_TRANSMITTED_RAW_ENCODE(remote_frame_handle, p_frame, *p_metadata, ack_handle));
@@ -340,10 +814,14 @@ void nrf_802154_transmit_failed(uint8_t                                   * p_fr
                                 nrf_802154_tx_error_t                       tx_error,
                                 const nrf_802154_transmit_done_metadata_t * p_metadata)
 {
-    uint32_t remote_frame_handle;
+    nrf_802154_ser_err_t res;
+    uint32_t             remote_frame_handle;
 
     SERIALIZATION_ERROR_INIT(error);
 
+    res = rx_batch_send();
+    SERIALIZATION_ERROR_CHECK(res, error, bail);
+
     NRF_802154_SPINEL_LOG_BANNER_CALLING();
     NRF_802154_SPINEL_LOG_BUFF(p_frame, p_frame[0]);
 
@@ -360,7 +838,7 @@ void nrf_802154_transmit_failed(uint8_t                                   * p_fr
                            bail);
 
     // Serialize the call
-    nrf_802154_ser_err_t res = nrf_802154_spinel_send_cmd_prop_value_is(
+    res = nrf_802154_spinel_send_cmd_prop_value_is(
         SPINEL_PROP_VENDOR_NORDIC_NRF_802154_TRANSMIT_FAILED,
         SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED,
         NRF_802154_TRANSMIT_FAILED_ENCODE(remote_frame_handle, p_frame, tx_error, *p_metadata));
@@ -382,6 +860,10 @@ bail:
 void nrf_802154_spinel_net_module_reset(void)
 {
     mp_last_tx_ack = NULL;
+#if NRF_802154_SPINEL_RX_BATCH_ENABLED
+    memset(&m_rx_batch, 0, sizeof(m_rx_batch));
+#endif
+    memset(&m_rx_batch_stats, 0, sizeof(m_rx_batch_stats));
 }
 
 #endif
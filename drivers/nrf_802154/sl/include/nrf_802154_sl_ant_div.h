@@ -78,7 +78,7 @@ typedef uint8_t nrf_802154_sl_ant_div_mode_t;
 
 #define NRF_802154_SL_ANT_DIV_MODE_DISABLED 0x00 // !< Antenna diversity is disabled - Antenna will not be controlled by sl_ant_div module. While in this mode, current antenna is unspecified.
 #define NRF_802154_SL_ANT_DIV_MODE_MANUAL   0x01 // !< Antenna is selected manually
-#define NRF_802154_SL_ANT_DIV_MODE_AUTO     0x02 // !< Antenna is selected automatically based on RSSI - not supported for transmission.
+#define NRF_802154_SL_ANT_DIV_MODE_AUTO     0x02 // !< Antenna is selected automatically based on RSSI - supported for transmission only if NRF_802154_ANT_DIV_PEER_ANTENNA_ENABLED is set.
 
 /**
  * @brief Available antennas
@@ -350,6 +350,38 @@ void nrf_802154_sl_ant_div_rx_frame_received_notify(void);
  */
 void nrf_802154_sl_ant_div_rx_preamble_timeout_notify(void);
 
+/**
+ * @brief Notification to be called with the source address of a frame received successfully.
+ *
+ * Called after @ref nrf_802154_sl_ant_div_rx_frame_received_notify if
+ * @ref NRF_802154_ANT_DIV_PEER_ANTENNA_ENABLED is set.
+ *
+ * @param[in] p_src_addr     Pointer to the source address of the frame, NULL if there is none.
+ * @param[in] src_addr_size  Size of the source address: 2 or 8 bytes.
+ */
+void nrf_802154_sl_ant_div_rx_frame_source_notify(const uint8_t * p_src_addr,
+                                                  uint8_t         src_addr_size);
+
+/**
+ * @brief Notification to be called with the destination address of a frame to be transmitted.
+ *
+ * In @ref NRF_802154_SL_ANT_DIV_MODE_AUTO mode, selects the antenna preferred for
+ * the destination. Called if @ref NRF_802154_ANT_DIV_PEER_ANTENNA_ENABLED is set.
+ *
+ * @param[in] p_dst_addr     Pointer to the destination address of the frame, NULL if there is none.
+ * @param[in] dst_addr_size  Size of the destination address: 2 or 8 bytes.
+ */
+void nrf_802154_sl_ant_div_tx_frame_notify(const uint8_t * p_dst_addr, uint8_t dst_addr_size);
+
+/**
+ * @brief Notification to be called when radio tx is started in
+ *        @ref NRF_802154_SL_ANT_DIV_MODE_AUTO mode.
+ *
+ * Switches to the antenna selected by @ref nrf_802154_sl_ant_div_tx_frame_notify.
+ * Called if @ref NRF_802154_ANT_DIV_PEER_ANTENNA_ENABLED is set.
+ */
+void nrf_802154_sl_ant_div_tx_started_notify(void);
+
 /**
  * @brief Notification to be called when energy detection procedure is requested.
  *
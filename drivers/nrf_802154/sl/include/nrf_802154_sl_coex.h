@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @brief 802.15.4 Wi-Fi coexistence module.
+ */
+
+#ifndef NRF_802154_SL_COEX_H
+#define NRF_802154_SL_COEX_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_sl_coex Wi-Fi coexistence notifications
+ * @{
+ * @ingroup nrf_802154_coex
+ */
+
+/**
+ * @brief Radio operations distinguished by the coexistence arbiter.
+ *
+ * Possible values:
+ * - @ref NRF_802154_SL_COEX_OP_RX,
+ * - @ref NRF_802154_SL_COEX_OP_TX,
+ * - @ref NRF_802154_SL_COEX_OP_ACK,
+ * - @ref NRF_802154_SL_COEX_OP_CCA,
+ * - @ref NRF_802154_SL_COEX_OP_NONE
+ */
+typedef uint8_t nrf_802154_sl_coex_op_t;
+
+#define NRF_802154_SL_COEX_OP_RX   0x00 // !< Reception of a frame.
+#define NRF_802154_SL_COEX_OP_TX   0x01 // !< Transmission of a frame, including its CCA and the reception of its ACK.
+#define NRF_802154_SL_COEX_OP_ACK  0x02 // !< Transmission of an ACK.
+#define NRF_802154_SL_COEX_OP_CCA  0x03 // !< Standalone CCA and energy detection.
+#define NRF_802154_SL_COEX_OP_NONE 0xFF // !< The radio is not used.
+
+/**@brief Number of radio operations distinguished by the coexistence arbiter. */
+#define NRF_802154_SL_COEX_OPS_NUM 4U
+
+/**
+ * @brief Notifies the coexistence module of the radio operation the driver is about to perform.
+ *
+ * Priority levels requested from the radio scheduler after this call are issued on behalf of
+ * @p op, so that the coexistence arbiter can signal the priority configured for the operation.
+ *
+ * @note This notification is called only if @ref NRF_802154_COEX_OPERATION_NOTIFY_ENABLED is set.
+ *
+ * @param[in]  op  Radio operation.
+ */
+void nrf_802154_sl_coex_operation_set(nrf_802154_sl_coex_op_t op);
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_802154_SL_COEX_H
@@ -81,4 +81,59 @@
 #endif
 #endif
 
+/**
+ * @def NRF_802154_SL_ANT_DIV_PEERS_NUM
+ *
+ * Number of peers for which the open-source antenna diversity module learns the preferred
+ * antenna. When the table is full, the least recently heard peer is replaced.
+ */
+#ifndef NRF_802154_SL_ANT_DIV_PEERS_NUM
+#define NRF_802154_SL_ANT_DIV_PEERS_NUM 8
+#endif
+
+/**
+ * @def NRF_802154_SL_ANT_DIV_HYSTERESIS_DB
+ *
+ * Margin in dB by which the averaged RSSI of the other antenna must exceed the averaged RSSI
+ * of the preferred antenna before the open-source antenna diversity module changes
+ * the preference.
+ */
+#ifndef NRF_802154_SL_ANT_DIV_HYSTERESIS_DB
+#define NRF_802154_SL_ANT_DIV_HYSTERESIS_DB 3
+#endif
+
+/**
+ * @def NRF_802154_SL_ANT_DIV_EWMA_SHIFT
+ *
+ * Weight of a new sample in the RSSI averaged per antenna by the open-source antenna diversity
+ * module, which is 1 / 2^NRF_802154_SL_ANT_DIV_EWMA_SHIFT.
+ */
+#ifndef NRF_802154_SL_ANT_DIV_EWMA_SHIFT
+#define NRF_802154_SL_ANT_DIV_EWMA_SHIFT 2
+#endif
+
+/**
+ * @def NRF_802154_SL_COEX_PTA_TRACE_SIZE
+ *
+ * Number of the most recent coexistence arbiter requests traced by the open-source coexistence
+ * module.
+ */
+#ifndef NRF_802154_SL_COEX_PTA_TRACE_SIZE
+#define NRF_802154_SL_COEX_PTA_TRACE_SIZE 16
+#endif
+
+/**
+ * @def NRF_802154_SL_RSCH_PREC_RAMP_UP_US
+ *
+ * Time in microseconds needed by the open-source radio scheduler to ramp up the preconditions
+ * of a precise delayed timeslot.
+ *
+ * Preconditions of a timeslot of type @ref RSCH_DLY_TS_TYPE_PRECISE are requested this long
+ * before its trigger time. If the preconditions are not granted when the request is made,
+ * the trigger time must be at least this far in the future for the request to be accepted.
+ */
+#ifndef NRF_802154_SL_RSCH_PREC_RAMP_UP_US
+#define NRF_802154_SL_RSCH_PREC_RAMP_UP_US 400
+#endif
+
 #endif // NRF_802154_SL_CONFIG_H__
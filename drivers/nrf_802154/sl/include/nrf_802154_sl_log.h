@@ -86,6 +86,19 @@
 #define NRF_802154_SL_DEBUG_LOG_BLOCKS_INTERRUPTS 0
 #endif
 
+/**@def NRF_802154_SL_DEBUG_LOG_STREAM_ENABLED
+ * @brief Configures if the log buffer can be streamed out while logging is in progress.
+ *
+ * Setting this macro to 1 makes the log count how many times the log buffer wrapped around,
+ * which allows a drain to detect entries that were overwritten before being read.
+ *
+ * @note This option is supported only by the open-source implementation of the SL.
+ *       See @c nrf_802154_sl_log_stream.h.
+ */
+#ifndef NRF_802154_SL_DEBUG_LOG_STREAM_ENABLED
+#define NRF_802154_SL_DEBUG_LOG_STREAM_ENABLED 0
+#endif
+
 /**@def NRF_802154_SL_LOG_VERBOSITY
  * @brief Defines the verbosity level of generated logs.
  *
@@ -141,6 +154,31 @@
 extern volatile uint32_t g_nrf_802154_sl_log_buffer[NRF_802154_SL_DEBUG_LOG_BUFFER_LEN];
 extern volatile uint32_t gp_nrf_802154_sl_log_ptr;
 
+#if (NRF_802154_SL_DEBUG_LOG_STREAM_ENABLED)
+
+extern volatile uint32_t g_nrf_802154_sl_log_wraps;
+
+/**@brief Counts wrap-arounds of the debug log buffer. */
+#define nrf_802154_sl_debug_log_wrap_count(ptr) \
+    do                                          \
+    {                                           \
+        if ((ptr) == 0U)                        \
+        {                                       \
+            g_nrf_802154_sl_log_wraps++;        \
+        }                                       \
+    }                                           \
+    while (0)
+
+#else
+
+#define nrf_802154_sl_debug_log_wrap_count(ptr) \
+    do                                          \
+    {                                           \
+    }                                           \
+    while (0)
+
+#endif
+
 /**@brief Writes one word into debug log buffer. */
 #define nrf_802154_sl_debug_log_write_raw(value)                                                \
     do                                                                                          \
@@ -157,6 +195,7 @@ extern volatile uint32_t gp_nrf_802154_sl_log_ptr;
         nrf_802154_sl_debug_log_write_raw_ptr += 1U;                                            \
         nrf_802154_sl_debug_log_write_raw_ptr &= (NRF_802154_SL_DEBUG_LOG_BUFFER_LEN - 1U);     \
         gp_nrf_802154_sl_log_ptr               = nrf_802154_sl_debug_log_write_raw_ptr;         \
+        nrf_802154_sl_debug_log_wrap_count(nrf_802154_sl_debug_log_write_raw_ptr);              \
                                                                                                 \
         nrf_802154_sl_debug_log_restore_interrupts(nrf_802154_sl_debug_log_wr_raw_sv);          \
     }                                                                                           \
@@ -184,6 +223,8 @@ extern volatile uint32_t gp_nrf_802154_sl_log_ptr;
 #define NRF_802154_LOG_TYPE_FUNCTION_EXIT  2U
 #define NRF_802154_LOG_TYPE_LOCAL_EVENT    3U
 #define NRF_802154_LOG_TYPE_GLOBAL_EVENT   4U
+#define NRF_802154_LOG_TYPE_TIMESTAMP      5U ///< Inserted into the log stream only. See @c nrf_802154_sl_log_stream.h.
+#define NRF_802154_LOG_TYPE_LOST           6U ///< Inserted into the log stream only. See @c nrf_802154_sl_log_stream.h.
 /**
  *@}
  **/
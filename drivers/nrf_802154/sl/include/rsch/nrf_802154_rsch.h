@@ -85,10 +85,10 @@ extern "C" {
 /**
  * @brief Number of available slots for all delayed timeslots.
  */
-#define NRF_802154_RSCH_DLY_TS_SLOTS      \
-    NRF_802154_RSCH_DLY_TS_OP_DTX_SLOTS + \
-    NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS + \
-    NRF_802154_RSCH_DLY_TS_OP_CSMACA_SLOTS
+#define NRF_802154_RSCH_DLY_TS_SLOTS        \
+    (NRF_802154_RSCH_DLY_TS_OP_DTX_SLOTS + \
+     NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS + \
+     NRF_802154_RSCH_DLY_TS_OP_CSMACA_SLOTS)
 
 /**
  * @brief List of the preconditions that have to be met before any radio activity.
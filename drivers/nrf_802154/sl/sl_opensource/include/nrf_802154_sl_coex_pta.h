@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file declares the interface of the Packet Traffic Arbitration (PTA) coexistence
+ *   arbiter client implemented in the open-source service layer.
+ *
+ */
+
+#ifndef NRF_802154_SL_COEX_PTA_H__
+#define NRF_802154_SL_COEX_PTA_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nrf_802154_sl_coex.h"
+#include "rsch/nrf_802154_rsch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_sl_coex_pta Packet Traffic Arbitration in the open-source service layer
+ * @{
+ * @ingroup nrf_802154_coex
+ * @brief Signalling of radio activity to an external coexistence arbiter.
+ *
+ * The driver shares the 2.4 GHz band with a co-located radio, for example a Wi-Fi chip, whose
+ * Packet Traffic Arbitration (PTA) arbiter decides which of the radios is allowed to transmit.
+ * Two interfaces are supported:
+ * - 3-wire: the driver drives the REQUEST and PRIORITY outputs and samples the GRANT input.
+ * - 1-wire: the driver only samples the GRANT input, driven by the arbiter whenever
+ *   the driver is allowed to transmit.
+ *
+ * The arbiter is requested when the driver requests at least @ref RSCH_PRIO_RX from the radio
+ * scheduler, that is while it receives a frame, detects energy or transmits. The priority
+ * signalled for the request is taken from the table configured per radio operation, see
+ * @ref nrf_802154_sl_coex_op_t. An operation that has been denied the configured number of times
+ * in a row is signalled with high priority until it is granted.
+ *
+ * GRANT is sampled @c grant_delay_us after REQUEST or PRIORITY changes, which is the response
+ * time of the arbiter, and whenever @ref nrf_802154_sl_coex_pta_grant_irq_handler is called.
+ * Until the request is granted, or while it is denied, the radio scheduler approves priorities up
+ * to @ref RSCH_PRIO_RX only, so that reception continues, but transmissions are not started or
+ * are aborted.
+ *
+ * @note The response time of the arbiter is measured with a timer of the SL, so the context that
+ *       requests the radio scheduler priority is not blocked. The grant is reported later through
+ *       @ref nrf_802154_sl_coex_pta_approved_prio_changed. The response time is limited to
+ *       @ref NRF_802154_SL_COEX_PTA_GRANT_DELAY_MAX_US.
+ */
+
+/**
+ * @brief Recommended time in microseconds between asserting REQUEST and sampling GRANT.
+ */
+#define NRF_802154_SL_COEX_PTA_DEFAULT_GRANT_DELAY_US 5U
+
+/**
+ * @brief Longest allowed time in microseconds between asserting REQUEST and sampling GRANT.
+ */
+#define NRF_802154_SL_COEX_PTA_GRANT_DELAY_MAX_US     20U
+
+/**
+ * @brief Interfaces to the coexistence arbiter.
+ *
+ * Possible values:
+ * - @ref NRF_802154_SL_COEX_PTA_INTERFACE_NONE,
+ * - @ref NRF_802154_SL_COEX_PTA_INTERFACE_1WIRE,
+ * - @ref NRF_802154_SL_COEX_PTA_INTERFACE_3WIRE
+ */
+typedef uint8_t nrf_802154_sl_coex_pta_interface_t;
+
+#define NRF_802154_SL_COEX_PTA_INTERFACE_NONE  0x00 // !< Coexistence is disabled.
+#define NRF_802154_SL_COEX_PTA_INTERFACE_1WIRE 0x01 // !< GRANT input only.
+#define NRF_802154_SL_COEX_PTA_INTERFACE_3WIRE 0x02 // !< REQUEST and PRIORITY outputs, GRANT input.
+
+/**
+ * @brief Arbitration parameters of a radio operation.
+ */
+typedef struct
+{
+    bool    request;              ///< If the arbiter is requested for the operation. The operation is never blocked otherwise.
+    bool    high_priority;        ///< If the operation is always signalled with high priority.
+    uint8_t escalation_threshold; ///< Number of consecutive denied requests after which the operation is signalled with high priority, 0 to never escalate.
+} nrf_802154_sl_coex_pta_op_cfg_t;
+
+/**
+ * @brief Configuration of the coexistence arbiter interface.
+ */
+typedef struct
+{
+    nrf_802154_sl_coex_pta_interface_t interface;                       ///< Interface to the arbiter.
+    uint8_t                            request_pin;                     ///< REQUEST output pin, used by the 3-wire interface.
+    uint8_t                            priority_pin;                    ///< PRIORITY output pin, used by the 3-wire interface.
+    uint8_t                            grant_pin;                       ///< GRANT input pin.
+    bool                               request_active_high;             ///< If REQUEST is active when the pin is high.
+    bool                               priority_active_high;            ///< If PRIORITY is active when the pin is high.
+    bool                               grant_active_high;               ///< If GRANT is active when the pin is high.
+    uint16_t                           grant_delay_us;                  ///< Time between changing REQUEST or PRIORITY and sampling GRANT.
+    nrf_802154_sl_coex_pta_op_cfg_t    ops[NRF_802154_SL_COEX_OPS_NUM]; ///< Arbitration parameters indexed by @ref nrf_802154_sl_coex_op_t.
+} nrf_802154_sl_coex_pta_cfg_t;
+
+/**
+ * @brief Statistics of the coexistence arbiter requests.
+ *
+ * All arrays are indexed by @ref nrf_802154_sl_coex_op_t.
+ */
+typedef struct
+{
+    uint32_t requests[NRF_802154_SL_COEX_OPS_NUM];    ///< Number of requests.
+    uint32_t granted[NRF_802154_SL_COEX_OPS_NUM];     ///< Number of requests granted at least once.
+    uint32_t denied[NRF_802154_SL_COEX_OPS_NUM];      ///< Number of requests denied at least once.
+    uint32_t escalations[NRF_802154_SL_COEX_OPS_NUM]; ///< Number of requests escalated to high priority.
+    uint32_t unsolicited_grants;                      ///< Number of GRANT activations while not requested.
+} nrf_802154_sl_coex_pta_stats_t;
+
+/**
+ * @brief Trace of a single coexistence arbiter request.
+ */
+typedef struct
+{
+    uint64_t                request_time;     ///< Time in microseconds at which the request was issued.
+    uint32_t                duration_us;      ///< Time for which the request was held.
+    uint32_t                grant_latency_us; ///< Time between the request and the first grant, UINT32_MAX if not granted.
+    nrf_802154_sl_coex_op_t op;               ///< Radio operation of the request.
+    bool                    high_priority;    ///< If the request was signalled with high priority.
+    bool                    denied;           ///< If the request was denied at least once.
+} nrf_802154_sl_coex_pta_trace_t;
+
+/**
+ * @brief Configures the coexistence arbiter interface.
+ *
+ * The configuration takes effect for the next request. Pins of the previous configuration are
+ * released.
+ *
+ * @param[in]  p_cfg  Interface configuration.
+ *
+ * @retval true   The configuration was applied.
+ * @retval false  The configuration is invalid.
+ */
+bool nrf_802154_sl_coex_pta_cfg_set(const nrf_802154_sl_coex_pta_cfg_t * p_cfg);
+
+/**
+ * @brief Gets the coexistence arbiter interface configuration.
+ *
+ * @param[out] p_cfg  Interface configuration.
+ *
+ * @retval true   The configuration was retrieved.
+ * @retval false  The interface has not been configured.
+ */
+bool nrf_802154_sl_coex_pta_cfg_get(nrf_802154_sl_coex_pta_cfg_t * p_cfg);
+
+/**
+ * @brief Gets the statistics of the coexistence arbiter requests.
+ *
+ * @param[out] p_stats  Statistics.
+ */
+void nrf_802154_sl_coex_pta_stats_get(nrf_802154_sl_coex_pta_stats_t * p_stats);
+
+/**
+ * @brief Resets the statistics of the coexistence arbiter requests.
+ */
+void nrf_802154_sl_coex_pta_stats_reset(void);
+
+/**
+ * @brief Gets the traces of the most recent completed requests.
+ *
+ * Up to @ref NRF_802154_SL_COEX_PTA_TRACE_SIZE requests are kept.
+ *
+ * @param[out] p_traces    Buffer to be filled with the traces, the oldest first.
+ * @param[in]  traces_max  Capacity of @p p_traces.
+ *
+ * @return Number of traces written to @p p_traces.
+ */
+uint32_t nrf_802154_sl_coex_pta_trace_get(nrf_802154_sl_coex_pta_trace_t * p_traces,
+                                          uint32_t                         traces_max);
+
+/**
+ * @brief Handles a change of the GRANT input.
+ *
+ * This function should be called whenever the level of the GRANT pin changes, for example
+ * from the handler of a GPIOTE IN event configured for the pin by the application.
+ */
+void nrf_802154_sl_coex_pta_grant_irq_handler(void);
+
+/**
+ * @brief Initializes the coexistence arbiter client.
+ *
+ * @note This function is called by the open-source radio scheduler.
+ */
+void nrf_802154_sl_coex_pta_init(void);
+
+/**
+ * @brief Deinitializes the coexistence arbiter client and releases the arbiter.
+ *
+ * @note This function is called by the open-source radio scheduler.
+ */
+void nrf_802154_sl_coex_pta_uninit(void);
+
+/**
+ * @brief Updates the priority level the driver requests from the radio scheduler.
+ *
+ * @note This function is called by the open-source radio scheduler. @ref RSCH_PRIO_IDLE
+ *       indicates that the driver does not use the radio.
+ *
+ * @param[in]  prio  Requested priority level.
+ */
+void nrf_802154_sl_coex_pta_prio_request(rsch_prio_t prio);
+
+/**
+ * @brief Gets the highest priority level the coexistence arbiter allows to be approved.
+ *
+ * @retval RSCH_PRIO_MAX  The arbiter is not requested or the request is granted.
+ * @retval RSCH_PRIO_RX   The request is denied.
+ */
+rsch_prio_t nrf_802154_sl_coex_pta_approved_prio_get(void);
+
+/**
+ * @brief Notifies the radio scheduler that the priority allowed by the arbiter has changed.
+ *
+ * @note This function is implemented by the open-source radio scheduler and is called outside
+ *       of @ref nrf_802154_sl_coex_pta_prio_request.
+ */
+extern void nrf_802154_sl_coex_pta_approved_prio_changed(void);
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_802154_SL_COEX_PTA_H__
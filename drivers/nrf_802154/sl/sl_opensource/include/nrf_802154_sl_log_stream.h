@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file declares the interface used to stream the debug log out of the device.
+ *
+ */
+
+#ifndef NRF_802154_SL_LOG_STREAM_H__
+#define NRF_802154_SL_LOG_STREAM_H__
+
+#include <stdint.h>
+
+#include "nrf_802154_sl_log.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_sl_log_stream Debug log streaming
+ * @{
+ * @ingroup nrf_802154_sl_debug_logging
+ * @brief Draining of the debug log buffer while logging is in progress.
+ *
+ * The debug log buffer keeps only the most recent @ref NRF_802154_SL_DEBUG_LOG_BUFFER_LEN
+ * entries. To capture a longer trace, the application periodically drains new entries and
+ * sends them over a transport of its choice, for example UART or RTT. The drained words
+ * are sent as they are, in little endian byte order, and can be decoded with
+ * @c utils/nrf_802154_log_decoder.py.
+ *
+ * Each drained chunk consists of:
+ * - an optional @ref NRF_802154_LOG_TYPE_LOST word with the number of entries that were
+ *   overwritten before being drained, saturated to 28 bits,
+ * - the log entries, oldest first,
+ * - a @ref NRF_802154_LOG_TYPE_TIMESTAMP word with the 28 least significant bits of the time
+ *   of the drain, in microseconds. All entries preceding it were recorded before that time.
+ *
+ * @note Detection of lost entries requires @ref NRF_802154_SL_DEBUG_LOG_STREAM_ENABLED.
+ *       Without it, the application must drain the log often enough to not lose entries.
+ * @note The drain must not preempt code that records logs, unless
+ *       @ref NRF_802154_SL_DEBUG_LOG_BLOCKS_INTERRUPTS is set. It is intended to be called
+ *       from the thread context or from the lowest priority interrupt.
+ */
+
+/**@brief Minimal number of words that must fit in the buffer passed to the drain. */
+#define NRF_802154_SL_LOG_STREAM_DRAIN_WORDS_MIN 3U
+
+/**
+ * @brief Drains entries recorded since the previous drain.
+ *
+ * If the buffer is too small to fit all the new entries, the oldest ones are drained and
+ * the remaining ones are left for the next call.
+ *
+ * @param[in]  timestamp  Current time in microseconds.
+ * @param[out] p_words    Buffer to be filled with the drained chunk.
+ * @param[in]  words_max  Capacity of @p p_words in words. Must be at least
+ *                        @ref NRF_802154_SL_LOG_STREAM_DRAIN_WORDS_MIN.
+ *
+ * @return Number of words written to @p p_words.
+ */
+uint32_t nrf_802154_sl_log_stream_drain(uint64_t   timestamp,
+                                        uint32_t * p_words,
+                                        uint32_t   words_max);
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_802154_SL_LOG_STREAM_H__
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   This file declares the interface used to model other radio users in the open-source
+ *   radio scheduler.
+ *
+ */
+
+#ifndef NRF_802154_SL_RSCH_EXTERNAL_H__
+#define NRF_802154_SL_RSCH_EXTERNAL_H__
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "rsch/nrf_802154_rsch.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/**
+ * @defgroup nrf_802154_sl_rsch_external Other radio users of the open-source radio scheduler
+ * @{
+ * @ingroup nrf_802154_rsch
+ * @brief Arbitration between the 802.15.4 driver and another user of the radio.
+ *
+ * The open-source radio scheduler arbitrates the radio between the 802.15.4 driver and a single
+ * external user, for example another protocol stack sharing the RADIO peripheral. The external
+ * user requests the radio with a priority expressed in the same levels as the driver requests.
+ *
+ * Once the external request starts, the external user takes the radio from the driver if its
+ * priority is equal to or higher than the priority currently requested by the driver, but not
+ * before the end of the timeslot the driver was granted through
+ * @ref nrf_802154_rsch_timeslot_request. A driver request with a higher priority than the
+ * external one takes the radio back immediately.
+ */
+
+/**
+ * @brief Requests the radio on behalf of the external user.
+ *
+ * A subsequent call replaces the previous request.
+ *
+ * @param[in]  prio        Priority of the external activity. @ref RSCH_PRIO_IDLE is equivalent
+ *                         to @ref nrf_802154_sl_rsch_external_release.
+ * @param[in]  start_time  Time in microseconds at which the external activity starts. The time
+ *                         base is the same as the one used by the SL Timer module. The time
+ *                         can be in the past.
+ */
+void nrf_802154_sl_rsch_external_request(rsch_prio_t prio, uint64_t start_time);
+
+/**
+ * @brief Releases the radio on behalf of the external user.
+ */
+void nrf_802154_sl_rsch_external_release(void);
+
+/**
+ * @brief Checks if the external user currently holds the radio.
+ *
+ * @retval true   The external user holds the radio and the driver is denied.
+ * @retval false  The external user does not hold the radio.
+ */
+bool nrf_802154_sl_rsch_external_is_granted(void);
+
+/**
+ *@}
+ **/
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif // NRF_802154_SL_RSCH_EXTERNAL_H__
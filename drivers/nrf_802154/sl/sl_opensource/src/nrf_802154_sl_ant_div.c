@@ -31,131 +31,585 @@
  * POSSIBILITY OF SUCH DAMAGE.
  *
  */
-
 /**
- * @brief 802.15.4 antenna diversity module.
+ * @file
+ *   This file implements the open-source antenna diversity module.
+ *
+ * The antenna is selected with a single GPIO pin. Instead of toggling the antenna while
+ * searching for a preamble, the receiver listens on the antenna that received stronger frames
+ * on average. When a preamble is detected, RSSI is measured on both antennas and the frame is
+ * received with the stronger one. The measurements of frames received successfully are averaged
+ * per antenna, both for all frames and per source address of the frame. A frame is transmitted
+ * with the antenna preferred for its destination. The preferred antenna changes only when
+ * the other antenna is stronger by @ref NRF_802154_SL_ANT_DIV_HYSTERESIS_DB.
+ *
+ * The timer, PPI and GPIOTE resources of @ref nrf_802154_sl_ant_div_cfg_t are not used.
+ *
  */
 
 #include "nrf_802154_sl_ant_div.h"
 
+#include <stddef.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_sl_config.h"
+#include "hal/nrf_gpio.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+#define ANTENNAS_NUM      2U   ///< Number of antennas.
+#define OPS_NUM           2U   ///< Number of operation types.
+#define AVG_FRACTION_BITS 4U   ///< Number of fractional bits of averaged RSSI.
+#define ADDR_MAX_SIZE     8U   ///< Size of an extended address.
+#define ED_MIN_TIME_US    128U ///< Shortest energy detection procedure performed by the driver.
+
+/** @brief Hysteresis of the preferred antenna, with @ref AVG_FRACTION_BITS fractional bits. */
+#define HYSTERESIS (NRF_802154_SL_ANT_DIV_HYSTERESIS_DB * (1 << AVG_FRACTION_BITS))
+
+/** @brief RSSI statistics of the antennas. */
+typedef struct
+{
+    int16_t                         rssi_avg[ANTENNAS_NUM]; ///< Averaged RSSI with @ref AVG_FRACTION_BITS fractional bits.
+    bool                            valid;                  ///< If any measurement has been averaged.
+    nrf_802154_sl_ant_div_antenna_t preferred;              ///< Antenna preferred according to the averages.
+} ant_stats_t;
+
+/** @brief Antenna statistics of a peer. */
+typedef struct
+{
+    uint8_t     addr[ADDR_MAX_SIZE]; ///< Address of the peer.
+    uint8_t     addr_len;            ///< Length of @c addr, 0 if the entry is unused.
+    uint32_t    last_used;           ///< Value of the use counter when the peer was last heard.
+    ant_stats_t stats;               ///< Antenna statistics of frames from the peer.
+} peer_t;
+
+/** @brief RSSI measured on both antennas during a preamble. */
+typedef struct
+{
+    int8_t                          rssi[ANTENNAS_NUM]; ///< RSSI measured on each antenna.
+    nrf_802154_sl_ant_div_antenna_t selected;           ///< Antenna selected for the frame.
+    bool                            valid;              ///< If the measurement has finished.
+} measurement_t;
+
+/** @brief States of the energy detection procedure on both antennas. */
+typedef enum
+{
+    ED_STATE_IDLE,           ///< Energy detection on both antennas is not ongoing.
+    ED_STATE_FIRST,          ///< Energy detection on the first antenna is ongoing.
+    ED_STATE_SECOND_PENDING, ///< Energy detection on the second antenna is to be requested.
+    ED_STATE_SECOND,         ///< Energy detection on the second antenna is ongoing.
+} ed_state_t;
+
+static nrf_802154_sl_ant_div_cfg_t     m_cfg;                                  ///< Interface configuration.
+static bool                            m_cfg_set;                              ///< If @ref m_cfg has been set.
+static bool                            m_initialized;                          ///< If the antenna pin is configured.
+static nrf_802154_sl_ant_div_mode_t    m_mode[OPS_NUM];                        ///< Mode per operation type.
+static nrf_802154_sl_ant_div_antenna_t m_manual_antenna[OPS_NUM];              ///< Manual antenna per operation type.
+static nrf_802154_sl_ant_div_antenna_t m_antenna;                              ///< Currently selected antenna.
+static nrf_802154_sl_ant_div_antenna_t m_last_rx_best;                         ///< Antenna of the last frame received.
+static nrf_802154_sl_ant_div_antenna_t m_tx_antenna;                           ///< Antenna selected for transmission.
+static ant_stats_t                     m_rx_stats;                             ///< Statistics of all frames received.
+static peer_t                          m_peers[NRF_802154_SL_ANT_DIV_PEERS_NUM]; ///< Statistics per peer.
+static uint32_t                        m_use_counter;                          ///< Counter of peer updates.
+static measurement_t                   m_meas;                                 ///< Measurement of the current frame.
+static measurement_t                   m_last_frame_meas;                      ///< Measurement of the last frame received.
+static ed_state_t                      m_ed_state;                             ///< State of the energy detection.
+static uint32_t                        m_ed_second_time;                       ///< Energy detection time left for the second antenna.
+
+static bool op_is_valid(nrf_802154_sl_ant_div_op_t op)
+{
+    return (op == NRF_802154_SL_ANT_DIV_OP_RX) || (op == NRF_802154_SL_ANT_DIV_OP_TX);
+}
+
+static bool antenna_is_valid(nrf_802154_sl_ant_div_antenna_t antenna)
+{
+    return (antenna == NRF_802154_SL_ANT_DIV_ANTENNA_1) ||
+           (antenna == NRF_802154_SL_ANT_DIV_ANTENNA_2);
+}
+
+static nrf_802154_sl_ant_div_antenna_t antenna_other_get(nrf_802154_sl_ant_div_antenna_t antenna)
+{
+    return (antenna == NRF_802154_SL_ANT_DIV_ANTENNA_1) ? NRF_802154_SL_ANT_DIV_ANTENNA_2 :
+           NRF_802154_SL_ANT_DIV_ANTENNA_1;
+}
+
+static bool rx_auto_mode_is_set(void)
+{
+    return m_mode[NRF_802154_SL_ANT_DIV_OP_RX] == NRF_802154_SL_ANT_DIV_MODE_AUTO;
+}
+
+/** @brief Drives the antenna selection pin. */
+static void antenna_switch(nrf_802154_sl_ant_div_antenna_t antenna)
+{
+    if (m_antenna != antenna)
+    {
+        nrf_gpio_pin_write(m_cfg.ant_sel_pin, (antenna == NRF_802154_SL_ANT_DIV_ANTENNA_2) ? 1 : 0);
+        m_antenna = antenna;
+    }
+}
+
+/***************************************************************************************************
+ * Antenna statistics
+ **************************************************************************************************/
+
+static int16_t avg_update(int16_t avg, int8_t sample)
+{
+    int32_t value = (int32_t)sample * (1 << AVG_FRACTION_BITS);
+
+    return (int16_t)(avg + (value - avg) / (1 << NRF_802154_SL_ANT_DIV_EWMA_SHIFT));
+}
+
+/**
+ * @brief Averages RSSI measured on both antennas and updates the preferred antenna.
+ *
+ * The first measurement selects the stronger antenna. Later the preference changes only if
+ * the average of the other antenna exceeds the average of the preferred one by
+ * @ref HYSTERESIS.
+ */
+static void stats_update(ant_stats_t * p_stats, const measurement_t * p_meas)
+{
+    nrf_802154_sl_ant_div_antenna_t other;
+    int32_t                         margin = HYSTERESIS;
+
+    if (!p_stats->valid)
+    {
+        for (uint32_t i = 0; i < ANTENNAS_NUM; i++)
+        {
+            p_stats->rssi_avg[i] = (int16_t)(p_meas->rssi[i] * (1 << AVG_FRACTION_BITS));
+        }
+
+        p_stats->valid     = true;
+        p_stats->preferred = NRF_802154_SL_ANT_DIV_ANTENNA_1;
+        margin             = 0;
+    }
+    else
+    {
+        for (uint32_t i = 0; i < ANTENNAS_NUM; i++)
+        {
+            p_stats->rssi_avg[i] = avg_update(p_stats->rssi_avg[i], p_meas->rssi[i]);
+        }
+    }
+
+    other = antenna_other_get(p_stats->preferred);
+
+    if (p_stats->rssi_avg[other] > p_stats->rssi_avg[p_stats->preferred] + margin)
+    {
+        p_stats->preferred = other;
+    }
+}
+
+/** @brief Gets the antenna on which the receiver listens for a preamble. */
+static nrf_802154_sl_ant_div_antenna_t rx_listen_antenna_get(void)
+{
+    return m_rx_stats.valid ? m_rx_stats.preferred : NRF_802154_SL_ANT_DIV_ANTENNA_1;
+}
+
+/** @brief Finds the entry of the given peer, NULL if there is none. */
+static peer_t * peer_find(const uint8_t * p_addr, uint8_t addr_len)
+{
+    for (uint32_t i = 0; i < NRF_802154_SL_ANT_DIV_PEERS_NUM; i++)
+    {
+        peer_t * p_peer = &m_peers[i];
+
+        if ((p_peer->addr_len == addr_len) && (memcmp(p_peer->addr, p_addr, addr_len) == 0))
+        {
+            return p_peer;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Gets the entry of the given peer.
+ *
+ * If the peer is not in the table, a free entry is used. If there is no free entry, the least
+ * recently heard peer is replaced.
+ */
+static peer_t * peer_get(const uint8_t * p_addr, uint8_t addr_len)
+{
+    peer_t * p_peer = peer_find(p_addr, addr_len);
+
+    if (p_peer == NULL)
+    {
+        p_peer = &m_peers[0];
+
+        for (uint32_t i = 0; i < NRF_802154_SL_ANT_DIV_PEERS_NUM; i++)
+        {
+            if (m_peers[i].addr_len == 0U)
+            {
+                p_peer = &m_peers[i];
+                break;
+            }
+
+            if ((int32_t)(m_peers[i].last_used - p_peer->last_used) < 0)
+            {
+                p_peer = &m_peers[i];
+            }
+        }
+
+        memset(p_peer, 0, sizeof(peer_t));
+        memcpy(p_peer->addr, p_addr, addr_len);
+        p_peer->addr_len = addr_len;
+    }
+
+    p_peer->last_used = ++m_use_counter;
+
+    return p_peer;
+}
+
+/***************************************************************************************************
+ * Configuration
+ **************************************************************************************************/
+
 void nrf_802154_sl_ant_div_cfg_set(const nrf_802154_sl_ant_div_cfg_t * p_cfg)
 {
+#if NRF_802154_SL_ANT_DIV_ENABLED
+    m_cfg     = *p_cfg;
+    m_cfg_set = true;
+#else
     (void)p_cfg;
+#endif
 }
 
 bool nrf_802154_sl_ant_div_cfg_get(nrf_802154_sl_ant_div_cfg_t * p_cfg)
 {
-    (void)p_cfg;
+    if (m_cfg_set)
+    {
+        *p_cfg = m_cfg;
+    }
 
-    return false;
+    return m_cfg_set;
 }
 
 bool nrf_802154_sl_ant_div_cfg_mode_set(nrf_802154_sl_ant_div_op_t   op,
                                         nrf_802154_sl_ant_div_mode_t mode)
 {
-    (void)op;
-    (void)mode;
+    if (!m_cfg_set || !op_is_valid(op))
+    {
+        return false;
+    }
 
-    return false;
+    switch (mode)
+    {
+        case NRF_802154_SL_ANT_DIV_MODE_DISABLED:
+        case NRF_802154_SL_ANT_DIV_MODE_MANUAL:
+            break;
+
+        case NRF_802154_SL_ANT_DIV_MODE_AUTO:
+#if !NRF_802154_ANT_DIV_PEER_ANTENNA_ENABLED
+            if (op == NRF_802154_SL_ANT_DIV_OP_TX)
+            {
+                return false;
+            }
+#endif
+            break;
+
+        default:
+            return false;
+    }
+
+    if ((op == NRF_802154_SL_ANT_DIV_OP_RX) && (m_mode[op] != mode))
+    {
+        if (mode == NRF_802154_SL_ANT_DIV_MODE_AUTO)
+        {
+            nrf_802154_sl_ant_div_rx_auto_mode_enable_notify();
+        }
+        else if (m_mode[op] == NRF_802154_SL_ANT_DIV_MODE_AUTO)
+        {
+            nrf_802154_sl_ant_div_rx_auto_mode_disable_notify();
+        }
+    }
+
+    m_mode[op] = mode;
+
+    return true;
 }
 
 nrf_802154_sl_ant_div_mode_t nrf_802154_sl_ant_div_cfg_mode_get(nrf_802154_sl_ant_div_op_t op)
 {
-    (void)op;
-
-    return NRF_802154_SL_ANT_DIV_MODE_DISABLED;
+    return op_is_valid(op) ? m_mode[op] : NRF_802154_SL_ANT_DIV_MODE_DISABLED;
 }
 
 bool nrf_802154_sl_ant_div_cfg_antenna_set(nrf_802154_sl_ant_div_op_t      op,
                                            nrf_802154_sl_ant_div_antenna_t antenna)
 {
-    (void)op;
-    (void)antenna;
+    if (!op_is_valid(op) || !antenna_is_valid(antenna))
+    {
+        return false;
+    }
 
-    return false;
+    m_manual_antenna[op] = antenna;
+
+    return true;
 }
 
 nrf_802154_sl_ant_div_antenna_t nrf_802154_sl_ant_div_cfg_antenna_get(nrf_802154_sl_ant_div_op_t op)
 {
-    (void)op;
-
-    return NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+    return op_is_valid(op) ? m_manual_antenna[op] : NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
 }
 
+/***************************************************************************************************
+ * API
+ **************************************************************************************************/
+
 bool nrf_802154_sl_ant_div_init(void)
 {
-    return false;
+    if (!m_cfg_set)
+    {
+        return false;
+    }
+
+    nrf_gpio_pin_clear(m_cfg.ant_sel_pin);
+    nrf_gpio_cfg_output(m_cfg.ant_sel_pin);
+
+    m_antenna        = NRF_802154_SL_ANT_DIV_ANTENNA_1;
+    m_last_rx_best   = NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+    m_tx_antenna     = NRF_802154_SL_ANT_DIV_ANTENNA_1;
+    m_use_counter    = 0;
+    m_ed_state       = ED_STATE_IDLE;
+    m_meas.valid     = false;
+    m_rx_stats.valid = false;
+
+    m_last_frame_meas.valid = false;
+
+    memset(m_peers, 0, sizeof(m_peers));
+
+    m_initialized = true;
+
+    return true;
 }
 
 bool nrf_802154_sl_ant_div_antenna_set(nrf_802154_sl_ant_div_antenna_t antenna)
 {
-    (void)antenna;
+    if (!m_initialized || !antenna_is_valid(antenna))
+    {
+        return false;
+    }
 
-    return false;
+    antenna_switch(antenna);
+
+    return true;
 }
 
 nrf_802154_sl_ant_div_antenna_t nrf_802154_sl_ant_div_antenna_get(void)
 {
-    return NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+    return m_initialized ? m_antenna : NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
 }
 
 nrf_802154_sl_ant_div_antenna_t nrf_802154_sl_ant_div_last_rx_best_antenna_get(void)
 {
-    return NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+    return m_last_rx_best;
 }
 
-bool nrf_802154_sl_ant_div_rx_frame_started_notify(void)
+void nrf_802154_sl_ant_div_timer_irq_handle(void)
 {
-    return false;
+    // Intentionally empty: the timer is not used.
 }
 
-void nrf_802154_sl_ant_div_rx_frame_received_notify(void)
+/***************************************************************************************************
+ * Notifications
+ **************************************************************************************************/
+
+void nrf_802154_sl_ant_div_rx_auto_mode_enable_notify(void)
+{
+    m_meas.valid = false;
+}
+
+void nrf_802154_sl_ant_div_rx_auto_mode_disable_notify(void)
+{
+    m_meas.valid   = false;
+    m_ed_state     = ED_STATE_IDLE;
+    m_last_rx_best = NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+}
+
+void nrf_802154_sl_ant_div_rx_started_notify(void)
 {
-    // Intenionally empty
+    if (!m_initialized || !rx_auto_mode_is_set())
+    {
+        return;
+    }
+
+    m_meas.valid = false;
+    antenna_switch(rx_listen_antenna_get());
 }
 
 void nrf_802154_sl_ant_div_rx_aborted_notify(void)
 {
-    // Intentionally empty
+    m_meas.valid = false;
+}
+
+void nrf_802154_sl_ant_div_rx_preamble_detected_notify(void)
+{
+    if (!m_initialized || !rx_auto_mode_is_set())
+    {
+        return;
+    }
+
+    nrf_802154_sl_ant_div_antenna_t first  = m_antenna;
+    nrf_802154_sl_ant_div_antenna_t second = antenna_other_get(first);
+
+    m_meas.valid       = false;
+    m_meas.rssi[first] = nrf_802154_sl_ant_div_rssi_measure_get();
+
+    if (m_meas.rssi[first] == NRF_802154_SL_ANT_DIV_RSSI_INVALID)
+    {
+        return;
+    }
+
+    antenna_switch(second);
+    m_meas.rssi[second] = nrf_802154_sl_ant_div_rssi_measure_get();
+
+    if (m_meas.rssi[second] == NRF_802154_SL_ANT_DIV_RSSI_INVALID)
+    {
+        antenna_switch(first);
+        return;
+    }
+
+    // Stay on the second antenna only if it is stronger, saving a switch otherwise.
+    m_meas.selected = (m_meas.rssi[second] > m_meas.rssi[first]) ? second : first;
+    m_meas.valid    = true;
+
+    antenna_switch(m_meas.selected);
 }
 
 void nrf_802154_sl_ant_div_rx_preamble_timeout_notify(void)
 {
-    // Intentionally empty
+    if (!m_initialized || !rx_auto_mode_is_set())
+    {
+        return;
+    }
+
+    // No frame followed the preamble. Listen on the preferred antenna again.
+    m_meas.valid = false;
+    antenna_switch(rx_listen_antenna_get());
 }
 
-void nrf_802154_sl_ant_div_rx_preamble_detected_notify(void)
+bool nrf_802154_sl_ant_div_rx_frame_started_notify(void)
 {
-    // Intentionally empty
+    return m_meas.valid;
 }
 
-void nrf_802154_sl_ant_div_energy_detection_requested_notify(uint32_t * p_ed_time)
+void nrf_802154_sl_ant_div_rx_frame_received_notify(void)
 {
-    (void)p_ed_time;
+    if (!m_meas.valid)
+    {
+        m_last_rx_best          = NRF_802154_SL_ANT_DIV_ANTENNA_NONE;
+        m_last_frame_meas.valid = false;
+        return;
+    }
+
+    m_last_rx_best    = m_meas.selected;
+    m_last_frame_meas = m_meas;
+    m_meas.valid      = false;
+
+    stats_update(&m_rx_stats, &m_last_frame_meas);
 }
 
-void nrf_802154_sl_ant_div_energy_detection_aborted_notify(void)
+void nrf_802154_sl_ant_div_rx_frame_source_notify(const uint8_t * p_src_addr,
+                                                  uint8_t         src_addr_size)
 {
-    // Intentionally empty
+    if (!m_last_frame_meas.valid)
+    {
+        return;
+    }
+
+    m_last_frame_meas.valid = false;
+
+    if ((p_src_addr == NULL) || (src_addr_size == 0U) || (src_addr_size > ADDR_MAX_SIZE))
+    {
+        return;
+    }
+
+    stats_update(&peer_get(p_src_addr, src_addr_size)->stats, &m_last_frame_meas);
 }
 
-bool nrf_802154_sl_ant_div_energy_detection_finished_notify(void)
+void nrf_802154_sl_ant_div_tx_frame_notify(const uint8_t * p_dst_addr, uint8_t dst_addr_size)
 {
-    return false;
+    const peer_t * p_peer = NULL;
+
+    if ((p_dst_addr != NULL) && (dst_addr_size != 0U) && (dst_addr_size <= ADDR_MAX_SIZE))
+    {
+        p_peer = peer_find(p_dst_addr, dst_addr_size);
+    }
+
+    // Frames to unknown peers and broadcast frames use the antenna preferred by all peers.
+    m_tx_antenna = (p_peer != NULL) ? p_peer->stats.preferred : rx_listen_antenna_get();
 }
 
-void nrf_802154_sl_ant_div_rx_started_notify(void)
+void nrf_802154_sl_ant_div_tx_started_notify(void)
 {
-    // Intentionally empty
+    if (m_initialized)
+    {
+        antenna_switch(m_tx_antenna);
+    }
 }
 
 void nrf_802154_sl_ant_div_txack_notify(void)
 {
-    // Intentionally empty
+    // Intentionally empty: the Ack is transmitted with the antenna the frame was received with.
+}
+
+void nrf_802154_sl_ant_div_energy_detection_requested_notify(uint32_t * p_ed_time)
+{
+    if (!m_initialized || !rx_auto_mode_is_set())
+    {
+        m_ed_state = ED_STATE_IDLE;
+        return;
+    }
+
+    switch (m_ed_state)
+    {
+        case ED_STATE_IDLE:
+            // Split the procedure between both antennas.
+            m_ed_second_time = *p_ed_time / 2U;
+            *p_ed_time      -= m_ed_second_time;
+
+            if (m_ed_second_time < ED_MIN_TIME_US)
+            {
+                m_ed_second_time = ED_MIN_TIME_US;
+            }
+
+            if (*p_ed_time < ED_MIN_TIME_US)
+            {
+                *p_ed_time = ED_MIN_TIME_US;
+            }
+
+            m_ed_state = ED_STATE_FIRST;
+            antenna_switch(NRF_802154_SL_ANT_DIV_ANTENNA_1);
+            break;
+
+        case ED_STATE_SECOND_PENDING:
+            *p_ed_time = m_ed_second_time;
+            m_ed_state = ED_STATE_SECOND;
+            antenna_switch(NRF_802154_SL_ANT_DIV_ANTENNA_2);
+            break;
+
+        default:
+            // The procedure is resumed in a new timeslot with the same antenna.
+            break;
+    }
+}
+
+bool nrf_802154_sl_ant_div_energy_detection_finished_notify(void)
+{
+    if (m_ed_state == ED_STATE_FIRST)
+    {
+        m_ed_state = ED_STATE_SECOND_PENDING;
+        return true;
+    }
+
+    m_ed_state = ED_STATE_IDLE;
+
+    return false;
+}
+
+void nrf_802154_sl_ant_div_energy_detection_aborted_notify(void)
+{
+    m_ed_state = ED_STATE_IDLE;
 }
 
 #ifdef __cplusplus
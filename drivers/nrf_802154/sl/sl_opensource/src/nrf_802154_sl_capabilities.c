@@ -33,8 +33,9 @@
  */
 
 #include "nrf_802154_sl_capabilities.h"
+#include "nrf_802154_sl_config.h"
 
 nrf_802154_sl_capabilities_t nrf_802154_sl_capabilities_get(void)
 {
-    return 0;
+    return NRF_802154_SL_ANT_DIV_ENABLED ? NRF_802154_SL_CAPABILITY_ANT_DIVERSITY : 0;
 }
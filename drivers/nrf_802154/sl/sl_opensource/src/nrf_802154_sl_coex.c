@@ -32,15 +32,573 @@
  *
  */
 
+/**
+ * @file
+ *   This file implements the open-source Packet Traffic Arbitration client.
+ *
+ * The arbiter is requested whenever the radio scheduler is requested at least @ref RSCH_PRIO_RX.
+ * The operation of the request is the one last notified by the driver core or, without such
+ * a notification, the one implied by the requested priority. A change of the operation while
+ * the arbiter is requested updates PRIORITY without releasing REQUEST and is traced as a new
+ * request. Every change of the signals is followed by the response time of the arbiter, after
+ * which GRANT is sampled. The response time is measured with a timer, so that requesting
+ * the arbiter does not block. Until it elapses, a new request is not granted and a request that
+ * changes the operation keeps the grant of the previous one. Changes of GRANT reported by
+ * @ref nrf_802154_sl_coex_pta_grant_irq_handler in the meantime are followed, but do not deny
+ * the request. A request is counted as granted or denied at most once, and escalation to high
+ * priority is based on the number of consecutive requests of an operation that were denied at
+ * least once.
+ *
+ */
+
+#include "nrf_802154_sl_coex_pta.h"
+
+#include <stddef.h>
+#include <string.h>
+
 #include "nrf_802154.h"
+#include "nrf_802154_sl_config.h"
+#include "nrf_802154_sl_timer.h"
+#include "nrf_802154_sl_utils.h"
+#include "hal/nrf_gpio.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+/** @brief Request issued to the arbiter. */
+typedef struct
+{
+    nrf_802154_sl_coex_op_t op;            ///< Operation of the request, @ref NRF_802154_SL_COEX_OP_NONE if not requested.
+    bool                    high_priority; ///< If the request is signalled with high priority.
+    bool                    granted;       ///< Last sampled GRANT.
+    bool                    was_granted;   ///< If the request has been granted at least once.
+    bool                    denied;        ///< If the request has been denied at least once.
+    bool                    responding;    ///< If the response time of the arbiter has not elapsed.
+    uint64_t                request_time;  ///< Time of the request.
+    uint64_t                grant_time;    ///< Time of the first grant.
+    uint64_t                response_time; ///< End of the response time of the arbiter.
+} request_t;
+
+static nrf_802154_sl_coex_pta_cfg_t   m_cfg;                                     ///< Interface configuration.
+static bool                           m_cfg_set;                                 ///< If @ref m_cfg has been set.
+static bool                           m_initialized;                             ///< If the pins are configured.
+static nrf_802154_sl_coex_op_t        m_op;                                      ///< Operation notified by the driver core.
+static rsch_prio_t                    m_prio;                                    ///< Priority requested from the radio scheduler.
+static request_t                      m_req;                                     ///< Current request.
+static uint8_t                        m_denials[NRF_802154_SL_COEX_OPS_NUM];     ///< Consecutive denied requests per operation.
+static nrf_802154_sl_coex_pta_stats_t m_stats;                                   ///< Request statistics.
+static nrf_802154_sl_coex_pta_trace_t m_traces[NRF_802154_SL_COEX_PTA_TRACE_SIZE]; ///< Traces of completed requests.
+static uint32_t                       m_traces_num;                              ///< Number of traces recorded.
+static nrf_802154_sl_timer_t          m_response_timer;                          ///< Timer of the response time of the arbiter.
+
+static bool interface_is(nrf_802154_sl_coex_pta_interface_t interface)
+{
+    return m_cfg_set && (m_cfg.interface == interface);
+}
+
+static void pin_write(uint8_t pin, bool active_high, bool active)
+{
+    nrf_gpio_pin_write(pin, (active == active_high) ? 1U : 0U);
+}
+
+static bool grant_read(void)
+{
+    return (nrf_gpio_pin_read(m_cfg.grant_pin) != 0U) == m_cfg.grant_active_high;
+}
+
+static void pins_configure(void)
+{
+    if (interface_is(NRF_802154_SL_COEX_PTA_INTERFACE_3WIRE))
+    {
+        pin_write(m_cfg.request_pin, m_cfg.request_active_high, false);
+        pin_write(m_cfg.priority_pin, m_cfg.priority_active_high, false);
+        nrf_gpio_cfg_output(m_cfg.request_pin);
+        nrf_gpio_cfg_output(m_cfg.priority_pin);
+    }
+
+    if (nrf_802154_wifi_coex_is_enabled())
+    {
+        nrf_gpio_cfg_input(m_cfg.grant_pin, NRF_GPIO_PIN_NOPULL);
+    }
+}
+
+static void pins_release(void)
+{
+    if (interface_is(NRF_802154_SL_COEX_PTA_INTERFACE_3WIRE))
+    {
+        nrf_gpio_cfg_default(m_cfg.request_pin);
+        nrf_gpio_cfg_default(m_cfg.priority_pin);
+    }
+
+    if (nrf_802154_wifi_coex_is_enabled())
+    {
+        nrf_gpio_cfg_default(m_cfg.grant_pin);
+    }
+}
+
+/** @brief Returns the operation the arbiter is to be requested for. */
+static nrf_802154_sl_coex_op_t requested_op_get(void)
+{
+    nrf_802154_sl_coex_op_t op;
+
+    if (!m_initialized || !nrf_802154_wifi_coex_is_enabled() || (m_prio < RSCH_PRIO_RX))
+    {
+        return NRF_802154_SL_COEX_OP_NONE;
+    }
+
+    if (m_op != NRF_802154_SL_COEX_OP_NONE)
+    {
+        op = m_op;
+    }
+    else if (m_prio == RSCH_PRIO_DETECT)
+    {
+        op = NRF_802154_SL_COEX_OP_CCA;
+    }
+    else if (m_prio == RSCH_PRIO_TX)
+    {
+        op = NRF_802154_SL_COEX_OP_TX;
+    }
+    else
+    {
+        op = NRF_802154_SL_COEX_OP_RX;
+    }
+
+    return m_cfg.ops[op].request ? op : NRF_802154_SL_COEX_OP_NONE;
+}
+
+/**
+ * @brief Samples GRANT and accounts the result to the current request.
+ *
+ * @note This function must be called from inside of the MCU critical section.
+ */
+static void grant_sample(uint64_t now)
+{
+    nrf_802154_sl_coex_op_t op = m_req.op;
+
+    m_req.granted = grant_read();
+
+    if (m_req.granted && !m_req.was_granted)
+    {
+        m_req.was_granted = true;
+        m_req.grant_time  = now;
+        m_stats.granted[op]++;
+    }
+    else if (!m_req.granted && !m_req.denied && !m_req.responding)
+    {
+        m_req.denied = true;
+        m_stats.denied[op]++;
+
+        if (m_denials[op] < UINT8_MAX)
+        {
+            m_denials[op]++;
+        }
+    }
+    else
+    {
+        // Intentionally empty
+    }
+}
+
+/**
+ * @brief Records the trace of the current request and forgets it.
+ *
+ * @note This function must be called from inside of the MCU critical section.
+ */
+static void request_end(uint64_t now)
+{
+    nrf_802154_sl_coex_pta_trace_t * p_trace;
+    nrf_802154_sl_coex_op_t          op = m_req.op;
+
+    if (!m_req.denied)
+    {
+        m_denials[op] = 0;
+    }
+
+    p_trace = &m_traces[m_traces_num % NRF_802154_SL_COEX_PTA_TRACE_SIZE];
+    m_traces_num++;
+
+    p_trace->request_time     = m_req.request_time;
+    p_trace->duration_us      = (uint32_t)(now - m_req.request_time);
+    p_trace->grant_latency_us = m_req.was_granted ?
+                                (uint32_t)(m_req.grant_time - m_req.request_time) : UINT32_MAX;
+    p_trace->op               = op;
+    p_trace->high_priority    = m_req.high_priority;
+    p_trace->denied           = m_req.denied;
+
+    m_req.op = NRF_802154_SL_COEX_OP_NONE;
+}
+
+/**
+ * @brief Starts a request for the given operation.
+ *
+ * @note This function must be called from inside of the MCU critical section.
+ */
+static void request_start(nrf_802154_sl_coex_op_t op, uint64_t now)
+{
+    const nrf_802154_sl_coex_pta_op_cfg_t * p_op_cfg = &m_cfg.ops[op];
+
+    bool escalated = (p_op_cfg->escalation_threshold != 0U) &&
+                     (m_denials[op] >= p_op_cfg->escalation_threshold);
+
+    m_stats.requests[op]++;
+
+    if (escalated && !p_op_cfg->high_priority)
+    {
+        m_stats.escalations[op]++;
+    }
+
+    m_req.op            = op;
+    m_req.high_priority = p_op_cfg->high_priority || escalated;
+    m_req.granted       = false;
+    m_req.was_granted   = false;
+    m_req.denied        = false;
+    m_req.request_time  = now;
+}
+
+static void response_timer_fired(nrf_802154_sl_timer_t * p_timer);
+
+/**
+ * @brief Starts the response time of the arbiter, at the end of which GRANT is sampled.
+ *
+ * @note This function must be called from inside of the MCU critical section.
+ *
+ * @retval true   The timer is started.
+ * @retval false  The timer could not be started.
+ */
+static bool response_timer_start(uint64_t now)
+{
+    m_req.responding    = true;
+    m_req.response_time = now + m_cfg.grant_delay_us;
+
+    m_response_timer.trigger_time             = m_req.response_time;
+    m_response_timer.action_type              = NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK;
+    m_response_timer.action.callback.callback = response_timer_fired;
+
+    if (nrf_802154_sl_timer_add(&m_response_timer) != NRF_802154_SL_TIMER_RET_SUCCESS)
+    {
+        m_req.responding = false;
+    }
+
+    return m_req.responding;
+}
+
+/**
+ * @brief Drives REQUEST and PRIORITY according to the current request and samples GRANT if
+ *        the arbiter does not need time to respond.
+ *
+ * @note This function must be called from inside of the MCU critical section.
+ */
+static void request_signal(void)
+{
+    bool     requested = (m_req.op != NRF_802154_SL_COEX_OP_NONE);
+    uint64_t now       = nrf_802154_sl_timer_current_time_get();
+
+    (void)nrf_802154_sl_timer_remove(&m_response_timer);
+    m_req.responding = false;
+
+    if (interface_is(NRF_802154_SL_COEX_PTA_INTERFACE_3WIRE))
+    {
+        // PRIORITY must be valid when REQUEST is asserted.
+        pin_write(m_cfg.priority_pin,
+                  m_cfg.priority_active_high,
+                  requested && m_req.high_priority);
+        pin_write(m_cfg.request_pin, m_cfg.request_active_high, requested);
+
+        if (requested && (m_cfg.grant_delay_us != 0U) && response_timer_start(now))
+        {
+            return;
+        }
+    }
+
+    if (requested)
+    {
+        grant_sample(now);
+    }
+}
+
+/**
+ * @brief Updates the request to match the priority requested from the radio scheduler.
+ *
+ * @note This function must be called from inside of the MCU critical section.
+ */
+static void request_update(void)
+{
+    nrf_802154_sl_coex_op_t op      = requested_op_get();
+    uint64_t                now     = nrf_802154_sl_timer_current_time_get();
+    bool                    granted = m_req.granted;
+
+    if (op == m_req.op)
+    {
+        return;
+    }
+
+    if (m_req.op != NRF_802154_SL_COEX_OP_NONE)
+    {
+        request_end(now);
+    }
+    else
+    {
+        granted = false;
+    }
+
+    if (op != NRF_802154_SL_COEX_OP_NONE)
+    {
+        request_start(op, now);
+
+        // REQUEST stays asserted, so the grant holds until the arbiter responds to PRIORITY.
+        m_req.granted = granted;
+    }
+
+    request_signal();
+}
+
+/** @brief Returns the priority the arbiter allows to be approved. */
+static rsch_prio_t allowed_prio_get(void)
+{
+    if ((m_req.op == NRF_802154_SL_COEX_OP_NONE) || m_req.granted)
+    {
+        return RSCH_PRIO_MAX;
+    }
+
+    return RSCH_PRIO_RX;
+}
+
+static void runtime_reset(void)
+{
+    m_op     = NRF_802154_SL_COEX_OP_NONE;
+    m_prio   = RSCH_PRIO_IDLE;
+    m_req.op = NRF_802154_SL_COEX_OP_NONE;
+
+    memset(m_denials, 0, sizeof(m_denials));
+}
+
 bool nrf_802154_wifi_coex_is_enabled(void)
 {
-    return false;
+    return m_cfg_set && (m_cfg.interface != NRF_802154_SL_COEX_PTA_INTERFACE_NONE);
+}
+
+bool nrf_802154_sl_coex_pta_cfg_set(const nrf_802154_sl_coex_pta_cfg_t * p_cfg)
+{
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+
+    if ((p_cfg == NULL) ||
+        (p_cfg->interface > NRF_802154_SL_COEX_PTA_INTERFACE_3WIRE) ||
+        (p_cfg->grant_delay_us > NRF_802154_SL_COEX_PTA_GRANT_DELAY_MAX_US))
+    {
+        return false;
+    }
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    if (m_req.op != NRF_802154_SL_COEX_OP_NONE)
+    {
+        request_end(nrf_802154_sl_timer_current_time_get());
+        request_signal();
+    }
+
+    if (m_initialized)
+    {
+        pins_release();
+    }
+
+    m_cfg     = *p_cfg;
+    m_cfg_set = true;
+
+    memset(m_denials, 0, sizeof(m_denials));
+
+    if (m_initialized)
+    {
+        pins_configure();
+        request_update();
+    }
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+    return true;
+}
+
+bool nrf_802154_sl_coex_pta_cfg_get(nrf_802154_sl_coex_pta_cfg_t * p_cfg)
+{
+    if (!m_cfg_set)
+    {
+        return false;
+    }
+
+    *p_cfg = m_cfg;
+
+    return true;
+}
+
+void nrf_802154_sl_coex_pta_stats_get(nrf_802154_sl_coex_pta_stats_t * p_stats)
+{
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+    *p_stats = m_stats;
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_sl_coex_pta_stats_reset(void)
+{
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+    memset(&m_stats, 0, sizeof(m_stats));
+    m_traces_num = 0;
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+}
+
+uint32_t nrf_802154_sl_coex_pta_trace_get(nrf_802154_sl_coex_pta_trace_t * p_traces,
+                                          uint32_t                         traces_max)
+{
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+    uint32_t                           first;
+    uint32_t                           num;
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    num   = (m_traces_num < NRF_802154_SL_COEX_PTA_TRACE_SIZE) ?
+            m_traces_num : NRF_802154_SL_COEX_PTA_TRACE_SIZE;
+    num   = (num < traces_max) ? num : traces_max;
+    first = m_traces_num - num;
+
+    for (uint32_t i = 0; i < num; i++)
+    {
+        p_traces[i] = m_traces[(first + i) % NRF_802154_SL_COEX_PTA_TRACE_SIZE];
+    }
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+    return num;
+}
+
+/**
+ * @brief Samples GRANT after it changes or after the response time of the arbiter, and notifies
+ *        the radio scheduler if the allowed priority changes.
+ *
+ * @param[in]  response_elapsed  If the sample is due to the end of the response time.
+ */
+static void grant_update(bool response_elapsed)
+{
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+    rsch_prio_t                        prev_prio;
+    rsch_prio_t                        prio;
+    uint64_t                           now;
+
+    if (!m_initialized || !nrf_802154_wifi_coex_is_enabled())
+    {
+        return;
+    }
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    prev_prio = allowed_prio_get();
+    now       = nrf_802154_sl_timer_current_time_get();
+
+    if (response_elapsed)
+    {
+        // The timer may have fired for a response time that has been restarted since.
+        if (m_req.responding && !nrf_802154_sl_time64_is_in_future(now, m_req.response_time))
+        {
+            m_req.responding = false;
+            grant_sample(now);
+        }
+    }
+    else if (m_req.op != NRF_802154_SL_COEX_OP_NONE)
+    {
+        grant_sample(now);
+    }
+    else if (interface_is(NRF_802154_SL_COEX_PTA_INTERFACE_3WIRE) && grant_read())
+    {
+        m_stats.unsolicited_grants++;
+    }
+    else
+    {
+        // Intentionally empty
+    }
+
+    prio = allowed_prio_get();
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+    if (prio != prev_prio)
+    {
+        nrf_802154_sl_coex_pta_approved_prio_changed();
+    }
+}
+
+static void response_timer_fired(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+
+    grant_update(true);
+}
+
+void nrf_802154_sl_coex_pta_grant_irq_handler(void)
+{
+    grant_update(false);
+}
+
+void nrf_802154_sl_coex_operation_set(nrf_802154_sl_coex_op_t op)
+{
+    // The operation takes effect with the priority requested for it, which always follows.
+    m_op = (op < NRF_802154_SL_COEX_OPS_NUM) ? op : NRF_802154_SL_COEX_OP_NONE;
+}
+
+void nrf_802154_sl_coex_pta_init(void)
+{
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    runtime_reset();
+    nrf_802154_sl_timer_init(&m_response_timer);
+    pins_configure();
+    m_initialized = true;
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_sl_coex_pta_uninit(void)
+{
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    if (m_req.op != NRF_802154_SL_COEX_OP_NONE)
+    {
+        request_end(nrf_802154_sl_timer_current_time_get());
+        request_signal();
+    }
+
+    if (m_initialized)
+    {
+        pins_release();
+        nrf_802154_sl_timer_deinit(&m_response_timer);
+    }
+
+    runtime_reset();
+    m_initialized = false;
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+}
+
+void nrf_802154_sl_coex_pta_prio_request(rsch_prio_t prio)
+{
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    m_prio = prio;
+    request_update();
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+}
+
+rsch_prio_t nrf_802154_sl_coex_pta_approved_prio_get(void)
+{
+    return allowed_prio_get();
 }
 
 #ifdef __cplusplus
@@ -33,6 +33,12 @@
  */
 
 #include "nrf_802154_sl_log.h"
+#include "nrf_802154_sl_log_stream.h"
+
+#include <string.h>
+
+#define LOG_WORD_PAYLOAD_MASK ((1UL << NRF_802154_SL_DEBUG_LOG_TYPE_BITPOS) - 1UL)
+#define LOG_BUFFER_IDX_MASK   (NRF_802154_SL_DEBUG_LOG_BUFFER_LEN - 1U)
 
 /**
  * @brief Buffer used to store debug log messages.
@@ -44,7 +50,123 @@ volatile uint32_t g_nrf_802154_sl_log_buffer[NRF_802154_SL_DEBUG_LOG_BUFFER_LEN]
  */
 volatile uint32_t gp_nrf_802154_sl_log_ptr = 0;
 
+#if (NRF_802154_SL_DEBUG_LOG_STREAM_ENABLED)
+
+/**
+ * @brief Number of times the log buffer wrapped around.
+ */
+volatile uint32_t g_nrf_802154_sl_log_wraps = 0;
+
+#endif
+
+/**
+ * @brief Number of log entries drained so far, including the lost ones.
+ */
+static uint32_t m_drained;
+
 void nrf_802154_sl_log_init(void)
 {
     /* intentionally empty */
 }
+
+/**
+ * @brief Gets the number of log entries recorded so far.
+ *
+ * Without the wrap counter, the number of entries recorded since the previous drain cannot
+ * exceed the buffer capacity.
+ */
+static uint32_t written_get(void)
+{
+#if (NRF_802154_SL_DEBUG_LOG_STREAM_ENABLED)
+    uint32_t wraps;
+    uint32_t ptr;
+
+    do
+    {
+        wraps = g_nrf_802154_sl_log_wraps;
+        ptr   = gp_nrf_802154_sl_log_ptr;
+    }
+    while (wraps != g_nrf_802154_sl_log_wraps);
+
+    return (wraps * NRF_802154_SL_DEBUG_LOG_BUFFER_LEN) + ptr;
+#else
+    return m_drained + ((gp_nrf_802154_sl_log_ptr - m_drained) & LOG_BUFFER_IDX_MASK);
+#endif
+}
+
+/**
+ * @brief Gets the number of entries recorded and not drained yet, including the overwritten ones.
+ */
+static uint32_t pending_get(uint32_t written)
+{
+    // The writer may be caught between updating the pointer and the wrap counter,
+    // in which case the recorded entries appear to go back.
+    return ((int32_t)(written - m_drained) < 0) ? 0U : (written - m_drained);
+}
+
+uint32_t nrf_802154_sl_log_stream_drain(uint64_t   timestamp,
+                                        uint32_t * p_words,
+                                        uint32_t   words_max)
+{
+    uint32_t * p_entries = &p_words[1];
+    uint32_t   pending;
+    uint32_t   count;
+    uint32_t   lost = 0U;
+    uint32_t   n    = 0U;
+
+    if (words_max < NRF_802154_SL_LOG_STREAM_DRAIN_WORDS_MIN)
+    {
+        return 0U;
+    }
+
+    pending = pending_get(written_get());
+
+    if (pending > NRF_802154_SL_DEBUG_LOG_BUFFER_LEN)
+    {
+        lost       = pending - NRF_802154_SL_DEBUG_LOG_BUFFER_LEN;
+        m_drained += lost;
+        pending    = NRF_802154_SL_DEBUG_LOG_BUFFER_LEN;
+    }
+
+    // Reserve space for the LOST and TIMESTAMP words.
+    count = (pending < (words_max - 2U)) ? pending : (words_max - 2U);
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        p_entries[i] = g_nrf_802154_sl_log_buffer[(m_drained + i) & LOG_BUFFER_IDX_MASK];
+    }
+
+    // Entries overwritten while being copied cannot be trusted.
+    pending = pending_get(written_get());
+
+    if (pending > NRF_802154_SL_DEBUG_LOG_BUFFER_LEN)
+    {
+        uint32_t overwritten = pending - NRF_802154_SL_DEBUG_LOG_BUFFER_LEN;
+
+        if (overwritten > count)
+        {
+            overwritten = count;
+        }
+
+        p_entries  = &p_entries[overwritten];
+        count     -= overwritten;
+        lost      += overwritten;
+        m_drained += overwritten;
+    }
+
+    m_drained += count;
+
+    if (lost != 0U)
+    {
+        p_words[n++] = (NRF_802154_LOG_TYPE_LOST << NRF_802154_SL_DEBUG_LOG_TYPE_BITPOS) |
+                       ((lost < LOG_WORD_PAYLOAD_MASK) ? lost : LOG_WORD_PAYLOAD_MASK);
+    }
+
+    memmove(&p_words[n], p_entries, count * sizeof(uint32_t));
+    n += count;
+
+    p_words[n++] = (NRF_802154_LOG_TYPE_TIMESTAMP << NRF_802154_SL_DEBUG_LOG_TYPE_BITPOS) |
+                   ((uint32_t)timestamp & LOG_WORD_PAYLOAD_MASK);
+
+    return n;
+}
@@ -32,6 +32,29 @@
  *
  */
 
+/**
+ * @file
+ *   This file implements the open-source radio scheduler.
+ *
+ * The scheduler arbitrates the radio between the critical section requests of the core, delayed
+ * timeslots requested by the MAC features and an optional external radio user. The priority
+ * requested from the scheduler is the highest of the core priority and priorities of delayed
+ * timeslots whose preconditions are requested. The core is approved as long as the high frequency
+ * clock is running and the external user does not take the radio. While the coexistence arbiter
+ * denies the request of the driver, priorities above @ref RSCH_PRIO_RX are not approved.
+ *
+ * Delayed timeslots are indexed, so that no operation scans all of them:
+ * - free timeslots are kept in a stack,
+ * - identifiers are mapped to timeslots with an open addressing hash map,
+ * - scheduled timeslots are kept in a min-heap ordered by the time of requesting preconditions,
+ * - requested timeslots that are not due yet are kept in a min-heap ordered by trigger time,
+ * - due timeslots are kept in a heap ordered by decreasing priority and then by trigger time,
+ * - requested and started timeslots are counted per priority level.
+ *
+ * All the indexes are modified from inside of the MCU critical section.
+ *
+ */
+
 #include "nrf_802154_sl_rsch.h"
 
 #include "nrf_802154_assert.h"
@@ -39,11 +62,93 @@
 #include <string.h>
 #include <nrfx.h>
 
+#include "nrf_802154_sl_coex_pta.h"
+#include "nrf_802154_sl_config.h"
+#include "nrf_802154_sl_crit_sect_if.h"
+#include "nrf_802154_sl_rsch_external.h"
+#include "nrf_802154_sl_timer.h"
+#include "nrf_802154_sl_utils.h"
 #include "rsch/nrf_802154_rsch.h"
 #include "platform/nrf_802154_clock.h"
 
-static rsch_prio_t m_prev_prio;
-static bool        m_ready;
+/** @brief States of a delayed timeslot. */
+typedef enum
+{
+    DLY_TS_STATE_FREE,      ///< Slot is not used.
+    DLY_TS_STATE_SCHEDULED, ///< Slot waits until its preconditions are requested.
+    DLY_TS_STATE_REQUESTED, ///< Preconditions of the slot are requested, slot waits for its trigger time.
+    DLY_TS_STATE_STARTED,   ///< Slot has started and holds its priority until it is cancelled.
+} dly_ts_state_t;
+
+#define DLY_TS_NONE        UINT16_MAX                               ///< Marks an empty ID map entry.
+#define DLY_TS_ID_MAP_SIZE (2 * NRF_802154_RSCH_DLY_TS_SLOTS + 1) ///< Number of ID map entries. Kept at most half full.
+#define DLY_TS_OP_NUM      (RSCH_DLY_TS_OP_CSMACA + 1)              ///< Number of delayed timeslot operation types.
+
+#if NRF_802154_RSCH_DLY_TS_SLOTS >= 0xFFFF
+#error "Too many delayed timeslots to be indexed"
+#endif
+
+struct dly_ts_heap_s;
+
+/** @brief Delayed timeslot. */
+typedef struct
+{
+    rsch_dly_ts_param_t     param;     ///< Parameters of the delayed timeslot.
+    uint64_t                prec_time; ///< Time at which preconditions of the timeslot are requested.
+    volatile dly_ts_state_t state;     ///< State of the delayed timeslot.
+    struct dly_ts_heap_s  * p_heap;    ///< Heap holding the timeslot, NULL if none.
+    uint16_t                heap_idx;  ///< Position of the timeslot in @ref p_heap.
+} dly_ts_t;
+
+/** @brief Heap of delayed timeslots. */
+typedef struct dly_ts_heap_s
+{
+    uint16_t slots[NRF_802154_RSCH_DLY_TS_SLOTS];                    ///< Indexes of the timeslots in heap order.
+    uint16_t cnt;                                                    ///< Number of timeslots in the heap.
+    bool  (* is_before)(const dly_ts_t * p_a, const dly_ts_t * p_b); ///< Order of the heap.
+} dly_ts_heap_t;
+
+/** @brief Request of the external radio user. */
+typedef struct
+{
+    bool        requested;  ///< If the external user requested the radio.
+    rsch_prio_t prio;       ///< Priority of the external request.
+    uint64_t    start_time; ///< Time at which the external request starts.
+} ext_request_t;
+
+static dly_ts_t              m_dly_ts[NRF_802154_RSCH_DLY_TS_SLOTS]; ///< Delayed timeslots.
+static ext_request_t         m_ext;                                  ///< External radio user request.
+static nrf_802154_sl_timer_t m_timer;                                ///< Timer driving the delayed timeslots and the external request.
+static bool                  m_timer_armed;                          ///< If @ref m_timer is running.
+
+static uint16_t          m_dly_ts_free[NRF_802154_RSCH_DLY_TS_SLOTS]; ///< Stack of indexes of free timeslots.
+static uint16_t          m_dly_ts_free_cnt;                           ///< Number of entries in @ref m_dly_ts_free.
+static uint16_t          m_dly_ts_id_map[DLY_TS_ID_MAP_SIZE];         ///< Map from identifier to index of a timeslot.
+static uint16_t          m_dly_ts_op_cnt[DLY_TS_OP_NUM];              ///< Number of used timeslots per operation.
+static volatile uint16_t m_dly_ts_prio_cnt[RSCH_PRIO_MAX + 1];        ///< Number of requested and started timeslots per priority.
+
+static bool dly_ts_prec_is_before(const dly_ts_t * p_a, const dly_ts_t * p_b);
+static bool dly_ts_trigger_is_before(const dly_ts_t * p_a, const dly_ts_t * p_b);
+static bool dly_ts_due_is_before(const dly_ts_t * p_a, const dly_ts_t * p_b);
+
+/** @brief Scheduled timeslots, ordered by the time of requesting preconditions. */
+static dly_ts_heap_t m_prec_heap = {.is_before = dly_ts_prec_is_before};
+
+/** @brief Requested timeslots that are not due yet, ordered by trigger time. */
+static dly_ts_heap_t m_trigger_heap = {.is_before = dly_ts_trigger_is_before};
+
+/** @brief Requested timeslots that are due, ordered by decreasing priority and trigger time. */
+static dly_ts_heap_t m_due_heap = {.is_before = dly_ts_due_is_before};
+
+static volatile rsch_prio_t m_crit_sect_prio;   ///< Priority requested by the core.
+static volatile rsch_prio_t m_approved_prio;    ///< Priority last notified to the core.
+static volatile bool        m_approved_pending; ///< If the approved priority is to be notified to the core.
+static volatile uint64_t    m_ts_end_time;      ///< End of the timeslot granted by @ref nrf_802154_rsch_timeslot_request.
+static volatile bool        m_hfclk_on;         ///< If the high frequency clock is requested.
+static volatile bool        m_ready;            ///< If the high frequency clock is running.
+
+static volatile bool m_process_lock;    ///< If the scheduler is being processed.
+static volatile bool m_process_pending; ///< If the scheduler is to be processed again.
 
 /**
  * @brief Notifies the core that the approved RSCH priority has changed.
@@ -55,19 +160,737 @@ static bool        m_ready;
  */
 extern void nrf_802154_rsch_crit_sect_prio_changed(rsch_prio_t prio);
 
+/***************************************************************************************************
+ * Arbitration
+ **************************************************************************************************/
+
+/** @brief Returns the highest priority requested by the core and the delayed timeslots. */
+static rsch_prio_t requested_prio_get(void)
+{
+    rsch_prio_t prio = m_crit_sect_prio;
+
+    for (uint32_t i = RSCH_PRIO_MAX; i > (uint32_t)prio; i--)
+    {
+        if (m_dly_ts_prio_cnt[i] != 0)
+        {
+            return (rsch_prio_t)i;
+        }
+    }
+
+    return prio;
+}
+
+/** @brief Checks if the external user competes for the radio with the driver. */
+static bool ext_contends(rsch_prio_t requested)
+{
+    return m_ext.requested && (m_ext.prio >= requested);
+}
+
+/**
+ * @brief Returns time at which the external user takes the radio from the driver.
+ *
+ * @note The external user must compete for the radio, see @ref ext_contends.
+ */
+static uint64_t ext_takeover_time_get(void)
+{
+    uint64_t ts_end_time = m_ts_end_time;
+
+    return (m_ext.start_time > ts_end_time) ? m_ext.start_time : ts_end_time;
+}
+
+/** @brief Checks if the external user holds the radio at the given time. */
+static bool ext_wins(rsch_prio_t requested, uint64_t now)
+{
+    return ext_contends(requested) && (now >= ext_takeover_time_get());
+}
+
+/** @brief Returns the priority that can be approved for the core at the given time. */
+static rsch_prio_t approved_prio_get(uint64_t now)
+{
+    rsch_prio_t requested = requested_prio_get();
+
+    if ((requested == RSCH_PRIO_IDLE) || !m_ready || ext_wins(requested, now))
+    {
+        return RSCH_PRIO_IDLE;
+    }
+
+    return nrf_802154_sl_coex_pta_approved_prio_get();
+}
+
+/**
+ * @brief Notifies the core about the change of the approved priority.
+ *
+ * @note This function must be called from inside of the driver critical section.
+ */
+static void approved_prio_notify(void)
+{
+    rsch_prio_t prio;
+
+    m_approved_pending = false;
+
+    prio = approved_prio_get(nrf_802154_sl_timer_current_time_get());
+
+    if (prio != m_approved_prio)
+    {
+        m_approved_prio = prio;
+
+        if (prio == RSCH_PRIO_IDLE)
+        {
+            // Losing the radio releases the granted timeslot.
+            m_ts_end_time = 0;
+        }
+
+        nrf_802154_rsch_crit_sect_prio_changed(prio);
+    }
+}
+
+/**
+ * @brief Updates the approved priority.
+ *
+ * The core is notified immediately if the driver critical section can be entered. Otherwise the
+ * notification is processed when the critical section is exited.
+ */
+static void approved_prio_update(void)
+{
+    if (!m_approved_pending &&
+        (approved_prio_get(nrf_802154_sl_timer_current_time_get()) == m_approved_prio))
+    {
+        return;
+    }
+
+    m_approved_pending = true;
+
+    if (nrf_802154_sl_crit_sect_enter())
+    {
+        approved_prio_notify();
+        nrf_802154_sl_crit_sect_exit();
+    }
+}
+
+/** @brief Requests or releases the high frequency clock, depending on the requested priority. */
+static void hfclk_update(void)
+{
+    rsch_prio_t requested = requested_prio_get();
+
+    if ((requested != RSCH_PRIO_IDLE) && !m_hfclk_on)
+    {
+        m_hfclk_on = true;
+        nrf_802154_clock_hfclk_start();
+    }
+    else if ((requested == RSCH_PRIO_IDLE) && m_hfclk_on)
+    {
+        m_hfclk_on = false;
+        m_ready    = false;
+        nrf_802154_clock_hfclk_stop();
+    }
+    else
+    {
+        // Intentionally empty
+    }
+}
+
+/** @brief Passes the priority requested by the driver to the coexistence arbiter client. */
+static void coex_update(void)
+{
+    rsch_prio_t requested = requested_prio_get();
+
+    if (!m_ready || ext_wins(requested, nrf_802154_sl_timer_current_time_get()))
+    {
+        // The driver does not use the radio until it is approved.
+        requested = RSCH_PRIO_IDLE;
+    }
+
+    nrf_802154_sl_coex_pta_prio_request(requested);
+}
+
+/***************************************************************************************************
+ * Scheduling
+ **************************************************************************************************/
+
+/** @brief Returns the number of delayed timeslots available for the given operation. */
+static uint32_t dly_ts_op_slots_get(rsch_dly_ts_op_t op)
+{
+    switch (op)
+    {
+        case RSCH_DLY_TS_OP_DTX:
+            return NRF_802154_RSCH_DLY_TS_OP_DTX_SLOTS;
+
+        case RSCH_DLY_TS_OP_DRX:
+            return NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS;
+
+        case RSCH_DLY_TS_OP_CSMACA:
+            return NRF_802154_RSCH_DLY_TS_OP_CSMACA_SLOTS;
+
+        default:
+            return 0;
+    }
+}
+
+static uint16_t dly_ts_idx_get(const dly_ts_t * p_dly_ts)
+{
+    return (uint16_t)(p_dly_ts - m_dly_ts);
+}
+
+static uint32_t dly_ts_id_map_home_get(rsch_dly_ts_id_t id)
+{
+    return (uint32_t)(((uint64_t)id * 2654435761UL) % DLY_TS_ID_MAP_SIZE);
+}
+
+/**
+ * @brief Finds position of the identifier in the ID map.
+ *
+ * @return Position of the identifier or DLY_TS_ID_MAP_SIZE if the identifier is not mapped.
+ */
+static uint32_t dly_ts_id_map_find(rsch_dly_ts_id_t id)
+{
+    uint32_t pos = dly_ts_id_map_home_get(id);
+
+    while (m_dly_ts_id_map[pos] != DLY_TS_NONE)
+    {
+        if (m_dly_ts[m_dly_ts_id_map[pos]].param.id == id)
+        {
+            return pos;
+        }
+
+        pos = (pos + 1) % DLY_TS_ID_MAP_SIZE;
+    }
+
+    return DLY_TS_ID_MAP_SIZE;
+}
+
+/** @brief Maps the identifier of the timeslot to the timeslot. */
+static void dly_ts_id_map_insert(const dly_ts_t * p_dly_ts)
+{
+    uint32_t pos = dly_ts_id_map_home_get(p_dly_ts->param.id);
+
+    while (m_dly_ts_id_map[pos] != DLY_TS_NONE)
+    {
+        pos = (pos + 1) % DLY_TS_ID_MAP_SIZE;
+    }
+
+    m_dly_ts_id_map[pos] = dly_ts_idx_get(p_dly_ts);
+}
+
+/**
+ * @brief Removes the entry at the given position of the ID map.
+ *
+ * Entries following the removed one are shifted back so that no lookup chain gets broken.
+ */
+static void dly_ts_id_map_remove(uint32_t pos)
+{
+    uint32_t next = pos;
+
+    while (true)
+    {
+        next = (next + 1) % DLY_TS_ID_MAP_SIZE;
+
+        if (m_dly_ts_id_map[next] == DLY_TS_NONE)
+        {
+            break;
+        }
+
+        uint32_t home = dly_ts_id_map_home_get(m_dly_ts[m_dly_ts_id_map[next]].param.id);
+
+        // Move the entry unless its home lies cyclically in (pos, next].
+        bool home_in_range = (pos <= next) ? ((home > pos) && (home <= next)) :
+                             ((home > pos) || (home <= next));
+
+        if (!home_in_range)
+        {
+            m_dly_ts_id_map[pos] = m_dly_ts_id_map[next];
+            pos                  = next;
+        }
+    }
+
+    m_dly_ts_id_map[pos] = DLY_TS_NONE;
+}
+
+static bool dly_ts_prec_is_before(const dly_ts_t * p_a, const dly_ts_t * p_b)
+{
+    return p_a->prec_time < p_b->prec_time;
+}
+
+static bool dly_ts_trigger_is_before(const dly_ts_t * p_a, const dly_ts_t * p_b)
+{
+    return p_a->param.trigger_time < p_b->param.trigger_time;
+}
+
+static bool dly_ts_due_is_before(const dly_ts_t * p_a, const dly_ts_t * p_b)
+{
+    return (p_a->param.prio > p_b->param.prio) ||
+           ((p_a->param.prio == p_b->param.prio) &&
+            (p_a->param.trigger_time < p_b->param.trigger_time));
+}
+
+static void dly_ts_heap_entry_set(dly_ts_heap_t * p_heap, uint16_t heap_idx, uint16_t slot_idx)
+{
+    p_heap->slots[heap_idx]     = slot_idx;
+    m_dly_ts[slot_idx].heap_idx = heap_idx;
+}
+
+static void dly_ts_heap_sift_up(dly_ts_heap_t * p_heap, uint16_t heap_idx)
+{
+    uint16_t slot_idx = p_heap->slots[heap_idx];
+
+    while (heap_idx > 0)
+    {
+        uint16_t parent = (heap_idx - 1) / 2;
+
+        if (!p_heap->is_before(&m_dly_ts[slot_idx], &m_dly_ts[p_heap->slots[parent]]))
+        {
+            break;
+        }
+
+        dly_ts_heap_entry_set(p_heap, heap_idx, p_heap->slots[parent]);
+        heap_idx = parent;
+    }
+
+    dly_ts_heap_entry_set(p_heap, heap_idx, slot_idx);
+}
+
+static void dly_ts_heap_sift_down(dly_ts_heap_t * p_heap, uint16_t heap_idx)
+{
+    uint16_t slot_idx = p_heap->slots[heap_idx];
+
+    while (true)
+    {
+        uint32_t child = 2 * (uint32_t)heap_idx + 1;
+
+        if (child >= p_heap->cnt)
+        {
+            break;
+        }
+
+        if ((child + 1 < p_heap->cnt) &&
+            p_heap->is_before(&m_dly_ts[p_heap->slots[child + 1]],
+                              &m_dly_ts[p_heap->slots[child]]))
+        {
+            child++;
+        }
+
+        if (!p_heap->is_before(&m_dly_ts[p_heap->slots[child]], &m_dly_ts[slot_idx]))
+        {
+            break;
+        }
+
+        dly_ts_heap_entry_set(p_heap, heap_idx, p_heap->slots[child]);
+        heap_idx = (uint16_t)child;
+    }
+
+    dly_ts_heap_entry_set(p_heap, heap_idx, slot_idx);
+}
+
+static void dly_ts_heap_push(dly_ts_heap_t * p_heap, dly_ts_t * p_dly_ts)
+{
+    uint16_t heap_idx = p_heap->cnt++;
+
+    p_dly_ts->p_heap = p_heap;
+    dly_ts_heap_entry_set(p_heap, heap_idx, dly_ts_idx_get(p_dly_ts));
+    dly_ts_heap_sift_up(p_heap, heap_idx);
+}
+
+/** @brief Returns the first timeslot of the heap or NULL if the heap is empty. */
+static dly_ts_t * dly_ts_heap_top_get(const dly_ts_heap_t * p_heap)
+{
+    return (p_heap->cnt > 0) ? &m_dly_ts[p_heap->slots[0]] : NULL;
+}
+
+/** @brief Removes the timeslot from the heap holding it, if any. */
+static void dly_ts_heap_remove(dly_ts_t * p_dly_ts)
+{
+    dly_ts_heap_t * p_heap   = p_dly_ts->p_heap;
+    uint16_t        heap_idx = p_dly_ts->heap_idx;
+
+    if (p_heap == NULL)
+    {
+        return;
+    }
+
+    p_dly_ts->p_heap = NULL;
+    p_heap->cnt--;
+
+    if (heap_idx != p_heap->cnt)
+    {
+        // Fill the gap with the last entry and restore the heap order around it.
+        uint16_t slot_idx = p_heap->slots[p_heap->cnt];
+
+        dly_ts_heap_entry_set(p_heap, heap_idx, slot_idx);
+        dly_ts_heap_sift_up(p_heap, heap_idx);
+        dly_ts_heap_sift_down(p_heap, m_dly_ts[slot_idx].heap_idx);
+    }
+}
+
+/** @brief Checks if the timeslot contributes its priority to the requested priority. */
+static bool dly_ts_holds_prio(const dly_ts_t * p_dly_ts)
+{
+    return (p_dly_ts->state == DLY_TS_STATE_REQUESTED) ||
+           (p_dly_ts->state == DLY_TS_STATE_STARTED);
+}
+
+/**
+ * @brief Finds the delayed timeslot with the given identifier.
+ *
+ * @note This function must be called from inside of the MCU critical section.
+ */
+static dly_ts_t * dly_ts_find(rsch_dly_ts_id_t id)
+{
+    uint32_t pos = dly_ts_id_map_find(id);
+
+    return (pos == DLY_TS_ID_MAP_SIZE) ? NULL : &m_dly_ts[m_dly_ts_id_map[pos]];
+}
+
+/**
+ * @brief Allocates a delayed timeslot for the given request.
+ *
+ * @note This function must be called from inside of the MCU critical section.
+ *
+ * @return Pointer to the allocated timeslot or NULL if the operation has no free timeslots left
+ *         or the identifier is already in use.
+ */
+static dly_ts_t * dly_ts_alloc(const rsch_dly_ts_param_t * p_dly_ts_param)
+{
+    rsch_dly_ts_op_t op = p_dly_ts_param->op;
+    dly_ts_t       * p_dly_ts;
+
+    if ((dly_ts_op_slots_get(op) == 0) ||
+        (m_dly_ts_op_cnt[op] >= dly_ts_op_slots_get(op)) ||
+        (m_dly_ts_free_cnt == 0) ||
+        (dly_ts_find(p_dly_ts_param->id) != NULL))
+    {
+        return NULL;
+    }
+
+    p_dly_ts        = &m_dly_ts[m_dly_ts_free[--m_dly_ts_free_cnt]];
+    p_dly_ts->param = *p_dly_ts_param;
+
+    dly_ts_id_map_insert(p_dly_ts);
+    m_dly_ts_op_cnt[op]++;
+
+    return p_dly_ts;
+}
+
+/**
+ * @brief Releases the delayed timeslot and removes it from all the indexes.
+ *
+ * @note This function must be called from inside of the MCU critical section.
+ */
+static void dly_ts_free(dly_ts_t * p_dly_ts)
+{
+    dly_ts_heap_remove(p_dly_ts);
+
+    if (dly_ts_holds_prio(p_dly_ts))
+    {
+        m_dly_ts_prio_cnt[p_dly_ts->param.prio]--;
+    }
+
+    m_dly_ts_op_cnt[p_dly_ts->param.op]--;
+    dly_ts_id_map_remove(dly_ts_id_map_find(p_dly_ts->param.id));
+
+    p_dly_ts->state                    = DLY_TS_STATE_FREE;
+    m_dly_ts_free[m_dly_ts_free_cnt++] = dly_ts_idx_get(p_dly_ts);
+}
+
+/**
+ * @brief Checks if a delayed timeslot can be requested with the given parameters.
+ *
+ * A precise timeslot cannot start in the past. If its preconditions are not granted yet, it must
+ * also leave enough time to ramp them up.
+ */
+static bool dly_ts_param_is_valid(const rsch_dly_ts_param_t * p_dly_ts_param, uint64_t now)
+{
+    if ((p_dly_ts_param == NULL) || (p_dly_ts_param->started_callback == NULL))
+    {
+        return false;
+    }
+
+    if (p_dly_ts_param->type == RSCH_DLY_TS_TYPE_PRECISE)
+    {
+        uint64_t lead = m_ready ? 0 : NRF_802154_SL_RSCH_PREC_RAMP_UP_US;
+
+        return p_dly_ts_param->trigger_time > now + lead;
+    }
+
+    return true;
+}
+
+/**
+ * @brief Requests preconditions of delayed timeslots that are about to start.
+ *
+ * @note This function must be called from inside of the MCU critical section.
+ */
+static void dly_ts_prec_update(uint64_t now)
+{
+    dly_ts_t * p_dly_ts;
+
+    while (((p_dly_ts = dly_ts_heap_top_get(&m_prec_heap)) != NULL) &&
+           (p_dly_ts->prec_time <= now))
+    {
+        dly_ts_heap_remove(p_dly_ts);
+
+        p_dly_ts->state = DLY_TS_STATE_REQUESTED;
+        m_dly_ts_prio_cnt[p_dly_ts->param.prio]++;
+
+        dly_ts_heap_push(&m_trigger_heap, p_dly_ts);
+    }
+}
+
+/**
+ * @brief Picks the delayed timeslot to be started now.
+ *
+ * Timeslots due at the same time are started in the order of decreasing priority.
+ *
+ * @note This function must be called from inside of the MCU critical section.
+ *
+ * @return Pointer to the timeslot to be started or NULL if none is due.
+ */
+static dly_ts_t * dly_ts_due_get(uint64_t now)
+{
+    dly_ts_t * p_dly_ts;
+
+    dly_ts_prec_update(now);
+
+    while (((p_dly_ts = dly_ts_heap_top_get(&m_trigger_heap)) != NULL) &&
+           (p_dly_ts->param.trigger_time <= now))
+    {
+        dly_ts_heap_remove(p_dly_ts);
+        dly_ts_heap_push(&m_due_heap, p_dly_ts);
+    }
+
+    return dly_ts_heap_top_get(&m_due_heap);
+}
+
+/**
+ * @brief Returns the time of the next scheduler event.
+ *
+ * @note This function must be called from inside of the MCU critical section.
+ */
+static uint64_t next_event_time_get(uint64_t now)
+{
+    uint64_t   next = UINT64_MAX;
+    dly_ts_t * p_dly_ts;
+
+    if ((p_dly_ts = dly_ts_heap_top_get(&m_prec_heap)) != NULL)
+    {
+        next = p_dly_ts->prec_time;
+    }
+
+    if (((p_dly_ts = dly_ts_heap_top_get(&m_trigger_heap)) != NULL) &&
+        (p_dly_ts->param.trigger_time < next))
+    {
+        next = p_dly_ts->param.trigger_time;
+    }
+
+    if ((p_dly_ts = dly_ts_heap_top_get(&m_due_heap)) != NULL)
+    {
+        // Due timeslots are started as soon as possible.
+        next = (now < next) ? now : next;
+    }
+
+    if (ext_contends(requested_prio_get()))
+    {
+        uint64_t takeover_time = ext_takeover_time_get();
+
+        if ((takeover_time > now) && (takeover_time < next))
+        {
+            next = takeover_time;
+        }
+    }
+
+    return next;
+}
+
+/** @brief Handles the scheduler timer. */
+static void timer_handler(nrf_802154_sl_timer_t * p_timer);
+
+/** @brief Arms the scheduler timer for the next event. */
+static void timer_update(uint64_t next)
+{
+    if (m_timer_armed && (m_timer.trigger_time == next))
+    {
+        return;
+    }
+
+    if (m_timer_armed)
+    {
+        (void)nrf_802154_sl_timer_remove(&m_timer);
+        m_timer_armed = false;
+    }
+
+    if (next != UINT64_MAX)
+    {
+        nrf_802154_sl_timer_ret_t ret;
+
+        m_timer.trigger_time             = next;
+        m_timer.action_type              = NRF_802154_SL_TIMER_ACTION_TYPE_CALLBACK;
+        m_timer.action.callback.callback = timer_handler;
+
+        ret = nrf_802154_sl_timer_add(&m_timer);
+        NRF_802154_ASSERT(ret == NRF_802154_SL_TIMER_RET_SUCCESS);
+        (void)ret;
+
+        m_timer_armed = true;
+    }
+}
+
+/**
+ * @brief Processes the scheduler.
+ *
+ * Requests preconditions of upcoming delayed timeslots, updates the approved priority and arms
+ * the timer for the next event. Delayed timeslots are started only from the timer handler, so
+ * that the started callbacks are never called from inside of the API functions.
+ */
+static void schedule_process(void)
+{
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+    uint64_t                           next;
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+    dly_ts_prec_update(nrf_802154_sl_timer_current_time_get());
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+    hfclk_update();
+    coex_update();
+    approved_prio_update();
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+    next = next_event_time_get(nrf_802154_sl_timer_current_time_get());
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+    timer_update(next);
+}
+
+/** @brief Tries to take the exclusive right to process the scheduler. */
+static bool process_lock_acquire(void)
+{
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+    bool                               result;
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    result         = !m_process_lock;
+    m_process_lock = true;
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+    return result;
+}
+
+/**
+ * @brief Requests processing of the scheduler.
+ *
+ * If the scheduler is already being processed by a preempted context or by the caller itself,
+ * the processing is repeated by that context once it is done.
+ */
+static void schedule_update(void)
+{
+    m_process_pending = true;
+
+    while (m_process_pending && process_lock_acquire())
+    {
+        m_process_pending = false;
+        schedule_process();
+        m_process_lock = false;
+    }
+}
+
+static void timer_handler(nrf_802154_sl_timer_t * p_timer)
+{
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+    dly_ts_t                         * p_due;
+
+    (void)p_timer;
+
+    m_timer_armed = false;
+
+    do
+    {
+        rsch_dly_ts_id_t               id       = 0;
+        rsch_dly_ts_started_callback_t callback = NULL;
+
+        nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+        p_due = dly_ts_due_get(nrf_802154_sl_timer_current_time_get());
+
+        if (p_due != NULL)
+        {
+            dly_ts_heap_remove(p_due);
+            p_due->state = DLY_TS_STATE_STARTED;
+            id           = p_due->param.id;
+            callback     = p_due->param.started_callback;
+        }
+
+        nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+        // Raise the approved priority before the owner of the timeslot takes any action.
+        schedule_update();
+
+        if (callback != NULL)
+        {
+            // The owner is expected to cancel the timeslot once it is done with it.
+            callback(id);
+        }
+    }
+    while (p_due != NULL);
+}
+
 /***************************************************************************************************
  * Public API
  **************************************************************************************************/
 
 void nrf_802154_rsch_init(void)
 {
-    m_ready     = false;
-    m_prev_prio = RSCH_PRIO_IDLE;
+    memset(m_dly_ts, 0, sizeof(m_dly_ts));
+    memset(m_dly_ts_op_cnt, 0, sizeof(m_dly_ts_op_cnt));
+    memset((void *)m_dly_ts_prio_cnt, 0, sizeof(m_dly_ts_prio_cnt));
+    memset(&m_ext, 0, sizeof(m_ext));
+
+    for (uint32_t i = 0; i < DLY_TS_ID_MAP_SIZE; i++)
+    {
+        m_dly_ts_id_map[i] = DLY_TS_NONE;
+    }
+
+    // Hand out the timeslots starting from the first one.
+    for (uint32_t i = 0; i < NRF_802154_RSCH_DLY_TS_SLOTS; i++)
+    {
+        m_dly_ts_free[i] = (uint16_t)(NRF_802154_RSCH_DLY_TS_SLOTS - 1 - i);
+    }
+
+    m_dly_ts_free_cnt  = NRF_802154_RSCH_DLY_TS_SLOTS;
+    m_prec_heap.cnt    = 0;
+    m_trigger_heap.cnt = 0;
+    m_due_heap.cnt     = 0;
+
+    nrf_802154_sl_timer_init(&m_timer);
+    nrf_802154_sl_coex_pta_init();
+
+    m_timer_armed      = false;
+    m_crit_sect_prio   = RSCH_PRIO_IDLE;
+    m_approved_prio    = RSCH_PRIO_IDLE;
+    m_approved_pending = false;
+    m_ts_end_time      = 0;
+    m_hfclk_on         = false;
+    m_ready            = false;
+    m_process_lock     = false;
+    m_process_pending  = false;
 }
 
 void nrf_802154_rsch_uninit(void)
 {
-    // Intenionally empty
+    if (m_timer_armed)
+    {
+        (void)nrf_802154_sl_timer_remove(&m_timer);
+        m_timer_armed = false;
+    }
+
+    nrf_802154_sl_timer_deinit(&m_timer);
+    nrf_802154_sl_coex_pta_uninit();
+
+    if (m_hfclk_on)
+    {
+        m_hfclk_on = false;
+        m_ready    = false;
+        nrf_802154_clock_hfclk_stop();
+    }
 }
 
 void nrf_802154_rsch_continuous_ended(void)
@@ -77,58 +900,97 @@ void nrf_802154_rsch_continuous_ended(void)
 
 bool nrf_802154_rsch_timeslot_request(uint32_t length_us)
 {
-    (void)length_us;
+    uint64_t now    = nrf_802154_sl_timer_current_time_get();
+    bool     result = false;
+
+    if ((m_approved_prio != RSCH_PRIO_IDLE) &&
+        (nrf_802154_rsch_timeslot_us_left_get() >= length_us))
+    {
+        // Requesting a timeslot before the previous one ends extends it.
+        if (now + length_us > m_ts_end_time)
+        {
+            m_ts_end_time = now + length_us;
+        }
 
-    NRF_802154_ASSERT(m_ready);
+        result = true;
+    }
 
-    return true;
+    return result;
 }
 
 bool nrf_802154_rsch_timeslot_is_requested(void)
 {
+    for (uint32_t i = 0; i <= RSCH_PRIO_MAX; i++)
+    {
+        if (m_dly_ts_prio_cnt[i] != 0)
+        {
+            return true;
+        }
+    }
+
     return false;
 }
 
 bool nrf_802154_rsch_prec_is_approved(rsch_prec_t prec, rsch_prio_t prio)
 {
-    return prio == RSCH_PRIO_IDLE ? true : m_ready;
+    if (prio == RSCH_PRIO_IDLE)
+    {
+        return true;
+    }
+
+    switch (prec)
+    {
+        case RSCH_PREC_HFCLK:
+            return m_ready;
+
+        case RSCH_PREC_COEX:
+            return nrf_802154_sl_coex_pta_approved_prio_get() >= prio;
+
+        default:
+            return m_approved_prio >= prio;
+    }
 }
 
 uint32_t nrf_802154_rsch_timeslot_us_left_get(void)
 {
-    return UINT32_MAX;
+    uint64_t now = nrf_802154_sl_timer_current_time_get();
+    uint64_t takeover_time;
+
+    if (m_approved_prio == RSCH_PRIO_IDLE)
+    {
+        return 0;
+    }
+
+    if (!ext_contends(requested_prio_get()))
+    {
+        return UINT32_MAX;
+    }
+
+    takeover_time = ext_takeover_time_get();
+
+    if (takeover_time <= now)
+    {
+        return 0;
+    }
+
+    return (takeover_time - now > UINT32_MAX) ? UINT32_MAX : (uint32_t)(takeover_time - now);
 }
 
 void nrf_802154_clock_hfclk_ready(void)
 {
-    m_ready = true;
-    nrf_802154_rsch_crit_sect_prio_changed(RSCH_PRIO_MAX);
+    if (m_hfclk_on)
+    {
+        m_ready = true;
+        schedule_update();
+    }
 }
 
 void nrf_802154_rsch_crit_sect_prio_request(rsch_prio_t prio)
 {
-    if (m_prev_prio != prio)
+    if (m_crit_sect_prio != prio)
     {
-        if (prio == RSCH_PRIO_IDLE)
-        {
-            nrf_802154_clock_hfclk_stop();
-
-            m_ready = false;
-
-            nrf_802154_rsch_crit_sect_prio_changed(RSCH_PRIO_IDLE);
-        }
-        else if (m_prev_prio == RSCH_PRIO_IDLE)
-        {
-            NRF_802154_ASSERT(!m_ready);
-
-            nrf_802154_clock_hfclk_start();
-        }
-        else
-        {
-            // Intentionally empty
-        }
-
-        m_prev_prio = prio;
+        m_crit_sect_prio = prio;
+        schedule_update();
     }
 }
 
@@ -149,45 +1011,191 @@ void nrf_802154_critical_section_rsch_exit(void)
 
 bool nrf_802154_critical_section_rsch_event_is_pending(void)
 {
-    return false;
+    return m_approved_pending;
 }
 
 void nrf_802154_critical_section_rsch_process_pending(void)
 {
-    // Intentionally empty
+    approved_prio_notify();
 }
 
 bool nrf_802154_rsch_delayed_timeslot_request(const rsch_dly_ts_param_t * p_dly_ts_param)
 {
-    (void)p_dly_ts_param;
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+    dly_ts_t                         * p_dly_ts = NULL;
+    uint64_t                           now;
 
-    return false;
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    now = nrf_802154_sl_timer_current_time_get();
+
+    if (dly_ts_param_is_valid(p_dly_ts_param, now))
+    {
+        p_dly_ts = dly_ts_alloc(p_dly_ts_param);
+    }
+
+    if (p_dly_ts != NULL)
+    {
+        uint64_t trigger_time = p_dly_ts_param->trigger_time;
+
+        p_dly_ts->param = *p_dly_ts_param;
+
+        if ((p_dly_ts_param->type == RSCH_DLY_TS_TYPE_RELAXED) ||
+            (trigger_time < NRF_802154_SL_RSCH_PREC_RAMP_UP_US))
+        {
+            p_dly_ts->prec_time = 0;
+        }
+        else
+        {
+            p_dly_ts->prec_time = trigger_time - NRF_802154_SL_RSCH_PREC_RAMP_UP_US;
+        }
+
+        p_dly_ts->state = DLY_TS_STATE_SCHEDULED;
+        dly_ts_heap_push(&m_prec_heap, p_dly_ts);
+    }
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+    if (p_dly_ts != NULL)
+    {
+        schedule_update();
+    }
+
+    return p_dly_ts != NULL;
 }
 
 bool nrf_802154_rsch_delayed_timeslot_cancel(rsch_dly_ts_id_t dly_ts_id, bool handler)
 {
-    (void)dly_ts_id;
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+    dly_ts_t                         * p_dly_ts;
+
     (void)handler;
 
-    return false;
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    p_dly_ts = dly_ts_find(dly_ts_id);
+
+    if (p_dly_ts != NULL)
+    {
+        dly_ts_free(p_dly_ts);
+    }
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+    if (p_dly_ts != NULL)
+    {
+        schedule_update();
+    }
+
+    return p_dly_ts != NULL;
 }
 
 bool nrf_802154_rsch_delayed_timeslot_priority_update(rsch_dly_ts_id_t dly_ts_id,
                                                       rsch_prio_t      dly_ts_prio)
 {
-    (void)dly_ts_id;
-    (void)dly_ts_prio;
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+    dly_ts_t                         * p_dly_ts;
 
-    return false;
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    p_dly_ts = dly_ts_find(dly_ts_id);
+
+    if (p_dly_ts != NULL)
+    {
+        if (dly_ts_holds_prio(p_dly_ts))
+        {
+            m_dly_ts_prio_cnt[p_dly_ts->param.prio]--;
+            m_dly_ts_prio_cnt[dly_ts_prio]++;
+        }
+
+        p_dly_ts->param.prio = dly_ts_prio;
+
+        if (p_dly_ts->p_heap == &m_due_heap)
+        {
+            // Only the order of due timeslots depends on the priority.
+            dly_ts_heap_sift_up(&m_due_heap, p_dly_ts->heap_idx);
+            dly_ts_heap_sift_down(&m_due_heap, p_dly_ts->heap_idx);
+        }
+    }
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+    if (p_dly_ts != NULL)
+    {
+        schedule_update();
+    }
+
+    return p_dly_ts != NULL;
+}
+
+bool nrf_802154_rsch_delayed_timeslot_time_to_start_get(rsch_dly_ts_id_t dly_ts_id,
+                                                        uint64_t       * p_time_to_start)
+{
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+    dly_ts_t                         * p_dly_ts;
+    bool                               result = false;
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    p_dly_ts = dly_ts_find(dly_ts_id);
+
+    if ((p_dly_ts != NULL) && (p_dly_ts->state != DLY_TS_STATE_STARTED))
+    {
+        uint64_t now = nrf_802154_sl_timer_current_time_get();
+
+        *p_time_to_start = (p_dly_ts->param.trigger_time > now) ?
+                           (p_dly_ts->param.trigger_time - now) : 0;
+        result = true;
+    }
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+    return result;
 }
 
 bool nrf_802154_rsch_delayed_timeslot_ppi_update(uint32_t ppi_channel)
 {
     (void)ppi_channel;
 
+    // Hardware triggering of delayed timeslots is not supported.
     return false;
 }
 
+void nrf_802154_sl_rsch_external_request(rsch_prio_t prio, uint64_t start_time)
+{
+    nrf_802154_sl_mcu_critical_state_t mcu_cs;
+
+    nrf_802154_sl_mcu_critical_enter(mcu_cs);
+
+    m_ext.requested  = (prio != RSCH_PRIO_IDLE);
+    m_ext.prio       = prio;
+    m_ext.start_time = start_time;
+
+    nrf_802154_sl_mcu_critical_exit(mcu_cs);
+
+    schedule_update();
+}
+
+void nrf_802154_sl_rsch_external_release(void)
+{
+    nrf_802154_sl_rsch_external_request(RSCH_PRIO_IDLE, 0);
+}
+
+void nrf_802154_sl_coex_pta_approved_prio_changed(void)
+{
+    schedule_update();
+}
+
+bool nrf_802154_sl_rsch_external_is_granted(void)
+{
+    rsch_prio_t requested = requested_prio_get();
+    uint64_t    now       = nrf_802154_sl_timer_current_time_get();
+
+    return m_ext.requested &&
+           (now >= m_ext.start_time) &&
+           ((requested == RSCH_PRIO_IDLE) || ext_wins(requested, now));
+}
+
 #if defined(CONFIG_SOC_SERIES_BSIM_NRFXX)
 uint32_t nrf_802154_rsch_delayed_timeslot_time_to_hw_trigger_get(void)
 {
@@ -0,0 +1,1004 @@
+"""
+Utility script to generate specialized spinel encoders and decoders for the
+nRF 802.15.4 serialization from SPINEL_DATATYPE_* format string macros.
+
+Every selected data type is expanded to its spinel pack-format string and
+translated into a pair of static inline functions which pack and unpack the
+data type with offsets resolved at generation time, instead of interpreting
+the format string character by character on every call.
+
+The data types are given explicitly with --datatype or collected from the sources
+with --used-in, which selects every SPINEL_DATATYPE_NRF_802154_* data type referenced
+by the C files in the given directory. With --test-output, a host test is generated
+as well. The test checks every codec byte for byte against spinel_datatype_pack and
+spinel_datatype_unpack on random input and compares their speed.
+
+Usage:
+
+    python gen_spinel_codecs.py \
+        --header <spinel_datatypes_header> [--header <header> ...] \
+        --output <output_file> \
+        --guard <header_guard> \
+        [--datatype <datatype_name> ...] \
+        [--used-in <source_directory> ...] \
+        [--test-output <test_file>]
+
+Copyright (c) 2025 Nordic Semiconductor ASA
+SPDX-License-Identifier: BSD-3-Clause
+"""
+
+import argparse
+from datetime import datetime
+from pathlib import Path
+import re
+import sys
+
+
+HEADER = """/*
+ * Copyright (c) {} Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* autogenerated using Nordic HAL utils/gen_spinel_codecs.py script */
+"""
+
+PREAMBLE = """
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "../spinel_base/spinel.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH 32767
+
+static inline void nrf_802154_spinel_codec_uint16_put(uint8_t * p_out, uint16_t value)
+{
+    p_out[0] = (uint8_t)(value >> 0);
+    p_out[1] = (uint8_t)(value >> 8);
+}
+
+static inline void nrf_802154_spinel_codec_uint32_put(uint8_t * p_out, uint32_t value)
+{
+    p_out[0] = (uint8_t)(value >> 0);
+    p_out[1] = (uint8_t)(value >> 8);
+    p_out[2] = (uint8_t)(value >> 16);
+    p_out[3] = (uint8_t)(value >> 24);
+}
+
+static inline void nrf_802154_spinel_codec_uint64_put(uint8_t * p_out, uint64_t value)
+{
+    nrf_802154_spinel_codec_uint32_put(&p_out[0], (uint32_t)value);
+    nrf_802154_spinel_codec_uint32_put(&p_out[4], (uint32_t)(value >> 32));
+}
+
+static inline uint16_t nrf_802154_spinel_codec_uint16_get(const uint8_t * p_in)
+{
+    return (uint16_t)(((uint16_t)p_in[1] << 8) | p_in[0]);
+}
+
+static inline uint32_t nrf_802154_spinel_codec_uint32_get(const uint8_t * p_in)
+{
+    return ((uint32_t)p_in[3] << 24) | ((uint32_t)p_in[2] << 16) |
+           ((uint32_t)p_in[1] << 8) | p_in[0];
+}
+
+static inline uint64_t nrf_802154_spinel_codec_uint64_get(const uint8_t * p_in)
+{
+    return ((uint64_t)nrf_802154_spinel_codec_uint32_get(&p_in[4]) << 32) |
+           nrf_802154_spinel_codec_uint32_get(&p_in[0]);
+}
+"""
+
+EPILOGUE = """
+#ifdef __cplusplus
+}
+#endif
+"""
+
+# Fixed-size scalars: format character -> (C type, size, put/get helper width)
+SCALARS = {
+    "b": ("bool", 1, None),
+    "C": ("uint8_t", 1, None),
+    "c": ("int8_t", 1, None),
+    "S": ("uint16_t", 2, 16),
+    "s": ("int16_t", 2, 16),
+    "L": ("uint32_t", 4, 32),
+    "l": ("int32_t", 4, 32),
+    "X": ("uint64_t", 8, 64),
+    "x": ("int64_t", 8, 64),
+}
+
+TOKEN_RE = re.compile(r'"(?:[^"\\]|\\.)*"|[A-Za-z_]\w*|\S')
+
+
+def parse_defines(headers):
+    defines = {}
+
+    for header in headers:
+        text = header.read_text()
+        text = re.sub(r"/\*.*?\*/", " ", text, flags=re.S)
+        text = re.sub(r"//[^\n]*", " ", text)
+        text = text.replace("\\\n", " ")
+
+        for line in text.splitlines():
+            match = re.match(r"\s*#\s*define\s+(\w+)(\(([^)]*)\))?\s*(.*)", line)
+            if not match:
+                continue
+            params = None
+            if match.group(2) is not None:
+                params = [p.strip() for p in match.group(3).split(",") if p.strip()]
+            defines[match.group(1)] = (params, TOKEN_RE.findall(match.group(4)))
+
+    return defines
+
+
+def expand(tokens, defines, depth=0):
+    if depth > 32:
+        sys.exit("Macro expansion too deep")
+
+    result = []
+    i = 0
+    while i < len(tokens):
+        token = tokens[i]
+        if token not in defines:
+            result.append(token)
+            i += 1
+            continue
+
+        params, body = defines[token]
+        i += 1
+        if params is not None:
+            if i >= len(tokens) or tokens[i] != "(":
+                sys.exit(f"Function-like macro {token} used without arguments")
+            args = [[]]
+            level = 0
+            i += 1
+            while True:
+                tok = tokens[i]
+                i += 1
+                if tok == "(":
+                    level += 1
+                elif tok == ")":
+                    if level == 0:
+                        break
+                    level -= 1
+                elif tok == "," and level == 0:
+                    args.append([])
+                    continue
+                args[-1].append(tok)
+            mapping = dict(zip(params, args))
+            body = [t for tok in body for t in mapping.get(tok, [tok])]
+        result.extend(expand(body, defines, depth + 1))
+
+    return result
+
+
+def format_string(name, defines):
+    if name not in defines:
+        sys.exit(f"Unknown data type {name}")
+
+    tokens = expand([name], defines)
+    if not all(t.startswith('"') for t in tokens):
+        sys.exit(f"{name} does not expand to a string literal: {' '.join(tokens)}")
+
+    return "".join(t[1:-1] for t in tokens)
+
+
+def parse_format(fmt, pos=0, nested=False):
+    nodes = []
+    while pos < len(fmt):
+        char = fmt[pos]
+        if char == ")":
+            if not nested:
+                sys.exit(f"Unbalanced ')' in {fmt}")
+            return nodes, pos + 1
+        if char == "t":
+            if fmt[pos + 1:pos + 2] != "(":
+                sys.exit(f"Struct without '(' in {fmt}")
+            children, pos = parse_format(fmt, pos + 2, True)
+            nodes.append(("t", children))
+            continue
+        if char == ".":
+            pos += 1
+            continue
+        if char not in SCALARS and char not in "idD":
+            sys.exit(f"Unsupported spinel data type '{char}' in {fmt}")
+        nodes.append((char, None))
+        pos += 1
+
+    if nested:
+        sys.exit(f"Unterminated struct in {fmt}")
+
+    return nodes, pos
+
+
+def is_prefixed(nodes, index):
+    kind = nodes[index][0]
+    return kind in "dt" or index != len(nodes) - 1
+
+
+class Size:
+    def __init__(self, const=0, terms=None):
+        self.const = const
+        self.terms = list(terms or [])
+
+    def __add__(self, other):
+        if isinstance(other, int):
+            return Size(self.const + other, self.terms)
+        return Size(self.const + other.const, self.terms + other.terms)
+
+    def __str__(self):
+        parts = self.terms + ([str(self.const)] if self.const or not self.terms else [])
+        return " + ".join(parts)
+
+
+class Codec:
+    def __init__(self, name, fmt):
+        self.name = name
+        self.fmt = fmt
+        self.nodes, _ = parse_format(fmt)
+        self.args = []
+        self._number(self.nodes)
+
+    def _number(self, nodes):
+        for index, (kind, children) in enumerate(nodes):
+            if kind == "t":
+                self._number(children)
+            else:
+                self.args.append((kind, f"arg{len(self.args)}"))
+
+    @property
+    def func(self):
+        return "nrf_802154_spinel_codec_" + self.name.lower()
+
+    def _size(self, nodes, args):
+        size = Size()
+        for index, (kind, children) in enumerate(nodes):
+            if kind == "t":
+                size += 2
+                size += self._size(children, args)
+                continue
+            _, arg = args.pop(0)
+            if kind in SCALARS:
+                size += SCALARS[kind][1]
+            elif kind == "i":
+                size += Size(0, [f"{arg}_size"])
+            else:
+                if is_prefixed(nodes, index):
+                    size += 2
+                size += Size(0, [f"{arg}_len"])
+        return size
+
+    def _pack_body(self, nodes, args, offset, out):
+        for index, (kind, children) in enumerate(nodes):
+            if kind == "t":
+                inner = self._size(children, list(args))
+                out.append(f"    nrf_802154_spinel_codec_uint16_put(&p_out[{offset}], "
+                           f"(uint16_t)({inner}));")
+                offset = self._pack_body(children, args, offset + 2, out)
+                continue
+
+            _, arg = args.pop(0)
+            if kind in SCALARS:
+                ctype, size, width = SCALARS[kind]
+                if kind == "b":
+                    out.append(f"    p_out[{offset}] = {arg} ? 1U : 0U;")
+                elif width is None:
+                    cast = "" if ctype.startswith("u") else "(uint8_t)"
+                    out.append(f"    p_out[{offset}] = {cast}{arg};")
+                else:
+                    cast = "" if ctype.startswith("u") else f"(uint{width}_t)"
+                    out.append(f"    nrf_802154_spinel_codec_uint{width}_put(&p_out[{offset}], "
+                               f"{cast}{arg});")
+                offset += size
+            elif kind == "i":
+                out.append(f"    (void)spinel_packed_uint_encode(&p_out[{offset}], {arg}_size, {arg});")
+                offset += Size(0, [f"{arg}_size"])
+            else:
+                if is_prefixed(nodes, index):
+                    out.append(f"    nrf_802154_spinel_codec_uint16_put(&p_out[{offset}], "
+                               f"(uint16_t){arg}_len);")
+                    offset += 2
+                out.append(f"    if (p_{arg} != NULL)")
+                out.append("    {")
+                out.append(f"        memcpy(&p_out[{offset}], p_{arg}, {arg}_len);")
+                out.append("    }")
+                offset += Size(0, [f"{arg}_len"])
+        return offset
+
+    def pack(self):
+        params = [("uint8_t *", "p_out"), ("size_t", "out_len")]
+        for kind, arg in self.args:
+            if kind in SCALARS:
+                params.append((SCALARS[kind][0], arg))
+            elif kind == "i":
+                params.append(("uint32_t", arg))
+            else:
+                params.append(("const void *", f"p_{arg}"))
+                params.append(("size_t", f"{arg}_len"))
+
+        out = []
+        out.append("/**")
+        out.append(f" * @brief Packs @ref SPINEL_DATATYPE_NRF_802154_{self.name} (\"{self.fmt}\").")
+        out.append(" *")
+        out.append(" * @returns Number of bytes written to @p p_out or -1 if the data does not fit.")
+        out.append(" */")
+        out.append(f"static inline spinel_ssize_t {self.func}_pack(")
+        out.extend(format_params(params))
+        out.append("{")
+
+        for kind, arg in self.args:
+            if kind == "i":
+                out.append(f"    if ({arg} >= SPINEL_MAX_UINT_PACKED)")
+                out.append("    {")
+                out.append("        return -1;")
+                out.append("    }")
+                out.append("")
+                out.append(f"    size_t {arg}_size = (size_t)spinel_packed_uint_size({arg});")
+                out.append("")
+
+        if not self.args:
+            out.append("    (void)p_out;")
+            out.append("")
+
+        size = self._size(self.nodes, list(self.args))
+        out.append(f"    size_t len = {size};")
+        out.append("")
+        out.append("    if ((out_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH) || (out_len < len))")
+        out.append("    {")
+        out.append("        return -1;")
+        out.append("    }")
+        out.append("")
+        self._pack_body(self.nodes, list(self.args), Size(), out)
+        out.append("")
+        out.append("    return (spinel_ssize_t)len;")
+        out.append("}")
+        return out
+
+    def _unpack_body(self, nodes, args, end, out, scope):
+        index = 0
+        while index < len(nodes):
+            kind, children = nodes[index]
+
+            if kind in SCALARS:
+                run = []
+                while index < len(nodes) and nodes[index][0] in SCALARS:
+                    run.append((nodes[index][0], args.pop(0)[1]))
+                    index += 1
+                run_size = sum(SCALARS[k][1] for k, _ in run)
+                out.append(f"    if (({end} - off) < {run_size}U)")
+                out.append("    {")
+                out.append("        return -1;")
+                out.append("    }")
+                out.append("")
+                offset = 0
+                for k, arg in run:
+                    ctype, size, width = SCALARS[k]
+                    at = "off" if offset == 0 else f"off + {offset}"
+                    if k == "b":
+                        out.append(f"    *p_{arg} = (p_in[{at}] != 0U);")
+                    elif width is None:
+                        cast = "" if ctype.startswith("u") else f"({ctype})"
+                        out.append(f"    *p_{arg} = {cast}p_in[{at}];")
+                    else:
+                        cast = "" if ctype.startswith("u") else f"({ctype})"
+                        out.append(f"    *p_{arg} = {cast}nrf_802154_spinel_codec_uint{width}_get("
+                                   f"&p_in[{at}]);")
+                    offset += size
+                out.append(f"    off += {run_size}U;")
+                out.append("")
+                continue
+
+            if kind == "t":
+                struct_end = f"struct{scope[0]}_end"
+                scope[0] += 1
+                out.append(f"    if (({end} - off) < 2U)")
+                out.append("    {")
+                out.append("        return -1;")
+                out.append("    }")
+                out.append("")
+                out.append(f"    size_t {struct_end} = nrf_802154_spinel_codec_uint16_get(&p_in[off]);")
+                out.append("")
+                out.append(f"    if (({struct_end} >= SPINEL_FRAME_MAX_SIZE) || "
+                           f"(({end} - off - 2U) < {struct_end}))")
+                out.append("    {")
+                out.append("        return -1;")
+                out.append("    }")
+                out.append("")
+                out.extend(align([(struct_end, "+= off + 2U;"), ("off", "+= 2U;")]))
+                out.append("")
+                if not self._unpack_body(children, args, struct_end, out, scope):
+                    out.append(f"    off = {struct_end};")
+                    out.append("")
+                index += 1
+                continue
+
+            _, arg = args.pop(0)
+            if kind == "i":
+                out.append(f"    spinel_ssize_t {arg}_size = spinel_packed_uint_decode(&p_in[off], "
+                           f"{end} - off, p_{arg});")
+                out.append("")
+                out.append(f"    if (({arg}_size <= 0) || (*p_{arg} >= SPINEL_MAX_UINT_PACKED))")
+                out.append("    {")
+                out.append("        return -1;")
+                out.append("    }")
+                out.append("")
+                out.append(f"    off += (size_t){arg}_size;")
+                out.append("")
+            elif is_prefixed(nodes, index):
+                out.append(f"    if (({end} - off) < 2U)")
+                out.append("    {")
+                out.append("        return -1;")
+                out.append("    }")
+                out.append("")
+                out.append(f"    *p_{arg}_len = nrf_802154_spinel_codec_uint16_get(&p_in[off]);")
+                out.append("")
+                out.append(f"    if ((*p_{arg}_len >= SPINEL_FRAME_MAX_SIZE) || "
+                           f"(({end} - off - 2U) < *p_{arg}_len))")
+                out.append("    {")
+                out.append("        return -1;")
+                out.append("    }")
+                out.append("")
+                out.extend(align([(f"*pp_{arg}", "= &p_in[off + 2U];"),
+                                  ("off", f"+= 2U + *p_{arg}_len;")]))
+                out.append("")
+            else:
+                out.extend(align([(f"*pp_{arg}", "= &p_in[off];"),
+                                  (f"*p_{arg}_len", f"= {end} - off;"),
+                                  ("off", f"= {end};")]))
+                out.append("")
+                return True
+            index += 1
+
+        return False
+
+    def unpack(self):
+        params = [("const uint8_t *", "p_in"), ("size_t", "in_len")]
+        for kind, arg in self.args:
+            if kind in SCALARS:
+                params.append((SCALARS[kind][0] + " *", f"p_{arg}"))
+            elif kind == "i":
+                params.append(("unsigned int *", f"p_{arg}"))
+            else:
+                params.append(("const void **", f"pp_{arg}"))
+                params.append(("size_t *", f"p_{arg}_len"))
+
+        out = []
+        out.append("/**")
+        out.append(f" * @brief Unpacks @ref SPINEL_DATATYPE_NRF_802154_{self.name} (\"{self.fmt}\").")
+        out.append(" *")
+        out.append(" * @returns Number of bytes consumed from @p p_in or -1 if the data is malformed.")
+        out.append(" */")
+        out.append(f"static inline spinel_ssize_t {self.func}_unpack(")
+        out.extend(format_params(params))
+        out.append("{")
+        out.append("    size_t off = 0U;")
+        out.append("")
+        if not self.args:
+            out.append("    (void)p_in;")
+            out.append("")
+        out.append("    if (in_len > NRF_802154_SPINEL_CODEC_MAX_PACK_LENGTH)")
+        out.append("    {")
+        out.append("        return -1;")
+        out.append("    }")
+        out.append("")
+        self._unpack_body(self.nodes, list(self.args), "in_len", out, [0])
+        out.append("    return (spinel_ssize_t)off;")
+        out.append("}")
+        return out
+
+    def _data_args(self):
+        return [arg for kind, arg in self.args if kind not in SCALARS and kind != "i"]
+
+    def _pack_args(self, codec):
+        args = []
+        for kind, arg in self.args:
+            if kind in SCALARS or kind == "i":
+                args.append(arg)
+            elif codec:
+                args += [f"{arg}_data", f"{arg}_len"]
+            else:
+                args += [f"{arg}_data", f"(unsigned int){arg}_len"]
+        return args
+
+    def _unpack_args(self, codec):
+        suffix = "codec" if codec else "interpreter"
+        args = []
+        for kind, arg in self.args:
+            if kind in SCALARS or kind == "i":
+                args.append(f"&{arg}_{suffix}")
+            else:
+                args += [f"&p_{arg}_{suffix}", f"&{arg}_len_{suffix}"]
+        return args
+
+    def _call(self, lhs, func, args, indent):
+        prefix = " " * indent + (f"{lhs} " if lhs else "") + f"{func}("
+        pad = " " * len(prefix)
+        lines = []
+        for i, arg in enumerate(args):
+            lines.append(f"{prefix if i == 0 else pad}{arg}{');' if i == len(args) - 1 else ','}")
+        return lines
+
+    def test(self):
+        name = self.name.lower()
+        fmt = f"SPINEL_DATATYPE_NRF_802154_{self.name}"
+        pack = f"{self.func}_pack"
+        unpack = f"{self.func}_unpack"
+
+        if not self.args:
+            # Nothing is packed, so there is nothing to compare beyond the length
+            return [f"static void {name}_test(uint32_t runs)",
+                    "{",
+                    "    uint32_t run = 0U;",
+                    "",
+                    "    (void)runs;",
+                    "",
+                    f"    CHECK(\"{self.name} pack\",",
+                    f"          ({pack}(m_packed, sizeof(m_packed)) == 0) &&",
+                    "          (spinel_datatype_pack(m_expected,",
+                    "                                sizeof(m_expected),",
+                    f"                                {fmt}) == 0));",
+                    f"    CHECK(\"{self.name} unpack\", {unpack}(m_expected, 0U) == 0);",
+                    "}"]
+
+        decls = []
+        for kind, arg in self.args:
+            if kind == "b":
+                decls.append(("bool", arg, "(rand_get() & 1U) != 0U"))
+            elif kind in SCALARS:
+                ctype = SCALARS[kind][0]
+                value = "rand64_get()" if SCALARS[kind][1] == 8 else "rand_get()"
+                decls.append((ctype, arg, f"({ctype}){value}"))
+            elif kind == "i":
+                decls.append(("uint32_t", arg, "rand_get() % SPINEL_MAX_UINT_PACKED"))
+            else:
+                decls.append(("size_t", f"{arg}_len", "rand_get() % (TEST_DATA_MAX_LEN + 1U)"))
+        for arg in self._data_args():
+            decls.append(("uint8_t", f"{arg}_data[TEST_DATA_MAX_LEN]", None))
+        for kind, arg in self.args:
+            if kind in SCALARS:
+                ctype = SCALARS[kind][0]
+                zero = "false" if kind == "b" else "0"
+                decls += [(ctype, f"{arg}_interpreter", zero), (ctype, f"{arg}_codec", zero)]
+            elif kind == "i":
+                decls += [("unsigned int", f"{arg}_interpreter", "0U"),
+                          ("unsigned int", f"{arg}_codec", "0U")]
+            else:
+                decls += [("const uint8_t *", f"p_{arg}_interpreter", "NULL"),
+                          ("const void *", f"p_{arg}_codec", "NULL"),
+                          ("unsigned int", f"{arg}_len_interpreter", "0U"),
+                          ("size_t", f"{arg}_len_codec", "0U")]
+        decls += [("spinel_ssize_t", "len", None), ("spinel_ssize_t", "codec_len", None)]
+
+        width = max(len(ctype) if ctype[-1] != "*" else len(ctype.rstrip("* ")) + 2
+                    for ctype, _, _ in decls)
+        name_width = max(len(arg) for _, arg, value in decls if value is not None)
+
+        out = []
+        out.append(f"static void {name}_test(uint32_t runs)")
+        out.append("{")
+        out.append("    for (uint32_t run = 0U; run < runs; run++)")
+        out.append("    {")
+        for ctype, arg, value in decls:
+            base = ctype.rstrip("* ")
+            if base != ctype:
+                decl = f"{base.ljust(width - 2)} * {arg.ljust(name_width)} = {value}"
+            elif value is not None:
+                decl = f"{ctype.ljust(width)} {arg.ljust(name_width)} = {value}"
+            else:
+                decl = f"{ctype.ljust(width)} {arg}"
+            out.append(f"        {decl};")
+        out.append("")
+        for arg in self._data_args():
+            out.append(f"        data_fill({arg}_data, {arg}_len);")
+        if self._data_args():
+            out.append("")
+
+        out.extend(self._call("len =", "spinel_datatype_pack",
+                              ["m_expected", "sizeof(m_expected)", fmt] + self._pack_args(False), 8))
+        out.extend(self._call("codec_len =", pack,
+                              ["m_packed", "sizeof(m_packed)"] + self._pack_args(True), 8))
+        out.append("")
+        out.append(f"        CHECK(\"{self.name} pack\",")
+        out.append("              (len >= 0) && (codec_len == len) &&")
+        out.append("              (memcmp(m_expected, m_packed, (size_t)len) == 0));")
+        out.append("")
+        out.append("        if (len > 0)")
+        out.append("        {")
+        out.extend(self._call("codec_len =", pack,
+                              ["m_packed", "(size_t)len - 1U"] + self._pack_args(True), 12))
+        out.append("")
+        out.append(f"            CHECK(\"{self.name} pack to a short buffer\", codec_len < 0);")
+        out.append("        }")
+        out.append("")
+
+        out.append("        for (size_t cut = 0U; cut <= (size_t)len; cut++)")
+        out.append("        {")
+        out.extend(self._call("spinel_ssize_t interpreter_len =", "spinel_datatype_unpack",
+                              ["m_expected", "(spinel_size_t)cut", fmt] +
+                              self._unpack_args(False), 12))
+        out.extend(self._call("codec_len =", unpack,
+                              ["m_expected", "cut"] + self._unpack_args(True), 12))
+        out.append("")
+        if self.nodes[-1][0] == "D":
+            out.append("            // The last data field is not prefixed, so it can be cut short")
+            out.append("            if ((cut < (size_t)len) && (codec_len < 0))")
+        else:
+            out.append("            if (cut < (size_t)len)")
+        out.append("            {")
+        out.append(f"                CHECK(\"{self.name} unpack of truncated data\", codec_len < 0);")
+        out.append("                continue;")
+        out.append("            }")
+        out.append("")
+        conds = ["(codec_len == (spinel_ssize_t)cut)", "(interpreter_len == codec_len)"]
+        for kind, arg in self.args:
+            if kind in SCALARS or kind == "i":
+                conds.append(f"({arg}_codec == {arg}_interpreter)")
+                conds.append(f"({arg}_codec == {arg})")
+            else:
+                conds.append(f"((const void *)p_{arg}_interpreter == p_{arg}_codec)")
+                conds.append(f"({arg}_len_interpreter == {arg}_len_codec)")
+        out.append(f"            CHECK(\"{self.name} unpack\",")
+        for i, cond in enumerate(conds):
+            out.append(f"                  {cond}{');' if i == len(conds) - 1 else ' &&'}")
+        out.append("        }")
+        out.append("")
+
+        # The data fields are compared once the whole frame is unpacked
+        for arg in self._data_args():
+            out.append(f"        CHECK(\"{self.name} unpacked data\",")
+            out.append(f"              ({arg}_len_codec == {arg}_len) &&")
+            out.append(f"              (memcmp(p_{arg}_codec, {arg}_data, {arg}_len) == 0));")
+        if self._data_args():
+            out.append("")
+
+        out.append("        uint64_t start = time_get();")
+        out.append("")
+        out.append("        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)")
+        out.append("        {")
+        out.extend(self._call("m_sink +=", "spinel_datatype_pack",
+                              ["m_expected", "sizeof(m_expected)", fmt] + self._pack_args(False), 12))
+        out.append("        }")
+        out.append("")
+        out.append("        uint64_t pack_interpreter = time_get();")
+        out.append("")
+        out.append("        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)")
+        out.append("        {")
+        out.extend(self._call("m_sink +=", pack,
+                              ["m_packed", "sizeof(m_packed)"] + self._pack_args(True), 12))
+        out.append("        }")
+        out.append("")
+        out.append("        uint64_t pack_codec = time_get();")
+        out.append("")
+        out.append("        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)")
+        out.append("        {")
+        out.extend(self._call("m_sink +=", "spinel_datatype_unpack",
+                              ["m_expected", "(spinel_size_t)len", fmt] +
+                              self._unpack_args(False), 12))
+        out.append("        }")
+        out.append("")
+        out.append("        uint64_t unpack_interpreter = time_get();")
+        out.append("")
+        out.append("        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)")
+        out.append("        {")
+        out.extend(self._call("m_sink +=", unpack,
+                              ["m_expected", "(size_t)len"] + self._unpack_args(True), 12))
+        out.append("        }")
+        out.append("")
+        out.append("        m_times.pack_interpreter   += pack_interpreter - start;")
+        out.append("        m_times.pack_codec         += pack_codec - pack_interpreter;")
+        out.append("        m_times.unpack_interpreter += unpack_interpreter - pack_codec;")
+        out.append("        m_times.unpack_codec       += time_get() - unpack_interpreter;")
+        out.append("    }")
+        out.append("}")
+        return out
+TEST_PREAMBLE = r"""
+/**
+ * @file
+ *   Host test of the precompiled spinel codecs.
+ *
+ * Every codec from {header} is run on random input and checked byte for byte against
+ * spinel_datatype_pack and spinel_datatype_unpack, which interpret the spinel format string of
+ * the data type. The unpacking codecs are also run on every truncation of the packed data and
+ * must reject it, unless the data type ends with a data field without a length prefix. The time
+ * spent by both implementations is measured on the same input and reported per data type.
+ * The program exits with a failure if any check fails.
+ *
+ * Build from the drivers/nrf_802154/serialization directory:
+ *
+ *     gcc -O2 -o spinel_codecs_test ../../../utils/nrf_802154_spinel_codecs_test.c \
+ *         spinel_base/spinel.c -Isrc -Isrc/include
+ *
+ * Usage:
+ *
+ *     spinel_codecs_test [-r <runs per data type>] [-s <seed>] [-v]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "nrf_802154_spinel_datatypes.h"
+#include "{header}"
+
+#define TEST_BUFFER_SIZE  1024U ///< Large enough for any data type with data fields of the maximal length.
+#define TEST_DATA_MAX_LEN 64U   ///< Maximal length of a random data field.
+#define TEST_BENCH_REPEAT 16U   ///< Calls measured together, to hide the cost of reading the clock.
+
+#define CHECK(p_what, condition)                                  \
+    do                                                            \
+    {{                                                             \
+        if (!(condition))                                         \
+        {{                                                         \
+            printf("error: %s, run %u\n", p_what, (unsigned)run); \
+            m_violations++;                                       \
+        }}                                                         \
+    }}                                                             \
+    while (0)
+
+typedef struct
+{{
+    uint64_t pack_interpreter;
+    uint64_t pack_codec;
+    uint64_t unpack_interpreter;
+    uint64_t unpack_codec;
+}} test_times_t;
+
+typedef struct
+{{
+    const char * p_name;
+    void (* test)(uint32_t runs);
+}} test_t;
+
+static uint32_t       m_rng;
+static uint64_t       m_violations;
+static test_times_t   m_times;
+static uint8_t        m_expected[TEST_BUFFER_SIZE];
+static uint8_t        m_packed[TEST_BUFFER_SIZE];
+static volatile long  m_sink;
+
+static uint32_t rand_get(void)
+{{
+    uint32_t x = m_rng;
+
+    x     ^= x << 13;
+    x     ^= x >> 17;
+    x     ^= x << 5;
+    m_rng  = x;
+
+    return x;
+}}
+
+static uint64_t rand64_get(void)
+{{
+    return ((uint64_t)rand_get() << 32) | rand_get();
+}}
+
+static void data_fill(uint8_t * p_data, size_t len)
+{{
+    for (size_t i = 0U; i < len; i++)
+    {{
+        p_data[i] = (uint8_t)rand_get();
+    }}
+}}
+
+static uint64_t time_get(void)
+{{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000000U + (uint64_t)now.tv_nsec;
+}}
+"""
+
+TEST_MAIN = r"""
+static double ns_per_call(uint64_t time, uint32_t runs)
+{
+    return (double)time / ((double)runs * TEST_BENCH_REPEAT);
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t     runs    = 2000U;
+    uint32_t     seed    = 0x2545f491U;
+    bool         verbose = false;
+    test_times_t total   = {0};
+    int          opt     = 1;
+
+    while (opt < argc)
+    {
+        if (strcmp(argv[opt], "-v") == 0)
+        {
+            verbose = true;
+            opt++;
+            continue;
+        }
+
+        if (opt + 1 >= argc)
+        {
+            break;
+        }
+
+        unsigned long value = strtoul(argv[opt + 1], NULL, 0);
+
+        if (strcmp(argv[opt], "-r") == 0)
+        {
+            runs = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-s") == 0)
+        {
+            seed = (uint32_t)value;
+        }
+        else
+        {
+            break;
+        }
+
+        opt += 2;
+    }
+
+    if ((opt != argc) || (runs == 0U) || (seed == 0U))
+    {
+        fprintf(stderr, "Usage: %s [-r <runs per data type>] [-s <seed>] [-v]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    m_rng = seed;
+
+    if (verbose)
+    {
+        printf("%-40s %19s %19s\n", "data type", "pack [ns]", "unpack [ns]");
+    }
+
+    uint32_t timed_runs = 0U;
+
+    for (size_t i = 0U; i < sizeof(m_tests) / sizeof(m_tests[0]); i++)
+    {
+        memset(&m_times, 0, sizeof(m_times));
+
+        m_tests[i].test(runs);
+
+        if (verbose)
+        {
+            printf("%-40s %9.1f -> %6.1f %9.1f -> %6.1f\n", m_tests[i].p_name,
+                   ns_per_call(m_times.pack_interpreter, runs),
+                   ns_per_call(m_times.pack_codec, runs),
+                   ns_per_call(m_times.unpack_interpreter, runs),
+                   ns_per_call(m_times.unpack_codec, runs));
+        }
+
+        // Data types without fields are not measured
+        timed_runs += (m_times.pack_interpreter != 0U) ? runs : 0U;
+
+        total.pack_interpreter   += m_times.pack_interpreter;
+        total.pack_codec         += m_times.pack_codec;
+        total.unpack_interpreter += m_times.unpack_interpreter;
+        total.unpack_codec       += m_times.unpack_codec;
+    }
+
+    printf("%u data types, %u runs each\n",
+           (unsigned)(sizeof(m_tests) / sizeof(m_tests[0])), (unsigned)runs);
+    printf("pack:   %6.1f ns interpreted, %6.1f ns precompiled per call\n",
+           ns_per_call(total.pack_interpreter, timed_runs),
+           ns_per_call(total.pack_codec, timed_runs));
+    printf("unpack: %6.1f ns interpreted, %6.1f ns precompiled per call\n",
+           ns_per_call(total.unpack_interpreter, timed_runs),
+           ns_per_call(total.unpack_codec, timed_runs));
+
+    if (m_violations != 0U)
+    {
+        printf("\n%llu checks failed\n", (unsigned long long)m_violations);
+        return EXIT_FAILURE;
+    }
+
+    printf("\nAll checks passed\n");
+
+    return EXIT_SUCCESS;
+}
+"""
+
+
+def format_params(params):
+    width = max(len(ctype) for ctype, _ in params)
+    last = len(params) - 1
+    lines = []
+    for i, (ctype, name) in enumerate(params):
+        base = ctype.rstrip("* ")
+        stars = ctype[len(base):].strip()
+        if stars:
+            decl = f"{base.ljust(width - len(stars))}{stars} {name}"
+        else:
+            decl = f"{ctype.ljust(width)} {name}"
+        lines.append(f"    {decl}{')' if i == last else ','}")
+    return lines
+
+
+def align(lines):
+    width = max(len(lhs) for lhs, _ in lines)
+    return [f"    {lhs.ljust(width)} {rhs}" for lhs, rhs in lines]
+
+
+def used_datatypes(directories, defines):
+    used = set()
+
+    for directory in directories:
+        for source in sorted(directory.glob("*.c")):
+            used.update(re.findall(r"\bSPINEL_DATATYPE_NRF_802154_\w+", source.read_text()))
+
+    # Only complete data types are selected, not the macros used to build them
+    return sorted(name for name in used if name in defines and defines[name][0] is None)
+
+
+def gen_test(output, header, codecs):
+    with open(output, "w") as f:
+        f.write(HEADER.format(datetime.now().year))
+        f.write(TEST_PREAMBLE.format(header=header))
+
+        for codec in codecs:
+            f.write("\n" + "\n".join(codec.test()) + "\n")
+
+        f.write("\nstatic const test_t m_tests[] =\n{\n")
+        width = max(len(codec.name) for codec in codecs) + 3
+        for codec in codecs:
+            f.write(f"    {{{(chr(34) + codec.name + chr(34) + ',').ljust(width)} "
+                    f"{codec.name.lower()}_test}},\n")
+        f.write("};\n")
+        f.write(TEST_MAIN)
+
+
+def gen_spinel_codecs(headers, output, guard, datatypes, used_in, test_output):
+    defines = parse_defines(headers)
+    codecs = []
+
+    for datatype in sorted(set(datatypes) | set(used_datatypes(used_in, defines))):
+        prefix = "SPINEL_DATATYPE_NRF_802154_"
+        if not datatype.startswith(prefix):
+            sys.exit(f"{datatype} is not an nRF 802.15.4 spinel data type")
+        codecs.append(Codec(datatype[len(prefix):], format_string(datatype, defines)))
+
+    if not codecs:
+        sys.exit("No data types selected")
+
+    with open(output, "w") as f:
+        f.write(HEADER.format(datetime.now().year))
+        f.write(f"\n#ifndef {guard}\n")
+        f.write(f"#define {guard}\n")
+        f.write(PREAMBLE)
+
+        for codec in codecs:
+            f.write("\n" + "\n".join(codec.pack()) + "\n")
+            f.write("\n" + "\n".join(codec.unpack()) + "\n")
+
+        f.write(EPILOGUE)
+        f.write(f"\n#endif /* {guard} */\n")
+
+    if test_output is not None:
+        gen_test(test_output, output.name, codecs)
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(allow_abbrev=False)
+    parser.add_argument("--header", type=Path, action="append", required=True,
+                        help="Header defining the spinel data types (can be repeated)")
+    parser.add_argument("--output", type=Path, required=True, help="Output file")
+    parser.add_argument("--guard", type=str, required=True, help="Header guard")
+    parser.add_argument("--datatype", type=str, action="append", default=[],
+                        help="SPINEL_DATATYPE_NRF_802154_* data type to generate (can be repeated)")
+    parser.add_argument("--used-in", type=Path, action="append", default=[],
+                        help="Directory whose C files select the data types to generate "
+                             "(can be repeated)")
+    parser.add_argument("--test-output", type=Path,
+                        help="Output file of the host test of the generated codecs")
+    args = parser.parse_args()
+
+    gen_spinel_codecs(args.header, args.output, args.guard, args.datatype, args.used_in,
+                      args.test_output)
@@ -14,3 +14,12 @@ python ${SCRIPT_DIR}/gen_offsets.py \
     --peripheral GLOBAL_FICR_NS \
     --guard ZEPHYR_INCLUDE_DT_BINDINGS_MISC_NORDIC_NRF_FICR_NRF54H20_ENG0_H_ \
     --prefix NRF_FICR_
+
+# Precompiled spinel codecs for nRF 802.15.4 serialization hot paths
+python ${SCRIPT_DIR}/gen_spinel_codecs.py \
+    --header "${SCRIPT_DIR}/../drivers/nrf_802154/serialization/spinel_base/spinel.h" \
+    --header "${SCRIPT_DIR}/../drivers/nrf_802154/serialization/src/include/nrf_802154_spinel_datatypes.h" \
+    --output "${SCRIPT_DIR}/../drivers/nrf_802154/serialization/src/include/nrf_802154_spinel_codecs.h" \
+    --guard NRF_802154_SPINEL_CODECS_H_ \
+    --used-in "${SCRIPT_DIR}/../drivers/nrf_802154/serialization/src" \
+    --test-output "${SCRIPT_DIR}/nrf_802154_spinel_codecs_test.c"
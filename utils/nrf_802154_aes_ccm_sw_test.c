@@ -0,0 +1,605 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run test and benchmark of the software AES-CCM* backend.
+ *
+ * The test links nrf_802154_aes_sw.c and nrf_802154_aes_ccm_sw.c unchanged and replaces the TX
+ * work buffer with a single static buffer. It checks:
+ *
+ * - the AES-128 cipher against the FIPS-197 Appendix C.1 example,
+ * - the CCM* transformation against IEEE 802.15.4-2015 Annex C.2.1, C.2.2 and C.2.3 and against
+ *   RFC 3610 packet vector #1,
+ * - the CCM* transformation of random frames of every MIC level, with and without
+ *   the plain text, against a straightforward reference implementation of RFC 3610 built on
+ *   the same block cipher, both with the key expanded by the backend and with a key context
+ *   expanded in advance.
+ *
+ * It then measures the throughput of the transformation of a 127-octet ENC-MIC-128 frame,
+ * including nrf_802154_aes_ccm_transform_prepare. The program exits with a failure if any check
+ * fails.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -DNRF_802154_ENCRYPTION_ACCELERATOR_SW=1 \
+ *         -o aes_ccm_sw_test ../../utils/nrf_802154_aes_ccm_sw_test.c \
+ *         driver/src/nrf_802154_aes_sw.c driver/src/nrf_802154_aes_ccm_sw.c \
+ *         -Icommon/include -Idriver/include -Idriver/src \
+ *         -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis>
+ *
+ * Add -maes on x86 hosts to test the AES-NI variant of the cipher.
+ *
+ * Usage:
+ *
+ *     aes_ccm_sw_test [-f <random frames>] [-b <benchmark frames>] [-s <seed>]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "nrf_802154_aes_ccm.h"
+#include "nrf_802154_aes_sw.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_tx_work_buffer.h"
+
+#define TEST_BLOCK_SIZE NRF_802154_AES_SW_BLOCK_SIZE
+#define TEST_NONCE_SIZE NRF_802154_AES_CCM_NONCE_SIZE
+#define TEST_L_VALUE    2U ///< Size of the length field of CCM*, in octets.
+
+#define CHECK(cond)                                                         \
+    do                                                                      \
+    {                                                                       \
+        if (!(cond))                                                        \
+        {                                                                   \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            m_failures++;                                                   \
+        }                                                                   \
+    }                                                                       \
+    while (0)
+
+/**
+ * @brief Known answer of the CCM* transformation.
+ */
+typedef struct
+{
+    const char * p_name;
+    const char * p_key;        ///< Key, in hex.
+    const char * p_nonce;      ///< Nonce, in hex.
+    const char * p_auth_data;  ///< Data that are authenticated only, in hex.
+    const char * p_plain_text; ///< Data that are authenticated and encrypted, in hex.
+    uint8_t      mic_level;    ///< MIC level, 0 to 3.
+    const char * p_expected;   ///< Cipher text followed by the encrypted MIC, in hex.
+} test_vector_t;
+
+static const test_vector_t m_vectors[] =
+{
+    {
+        "802.15.4 C.2.1 beacon, MIC-64",
+        "C0 C1 C2 C3 C4 C5 C6 C7 C8 C9 CA CB CC CD CE CF",
+        "AC DE 48 00 00 00 00 01 00 00 00 05 02",
+        "08 D0 84 21 43 01 00 00 00 00 48 DE AC 02 05 00 00 00 55 CF 00 00 51 52 53 54",
+        "",
+        2U,
+        "22 3B C1 EC 84 1A B5 53",
+    },
+    {
+        "802.15.4 C.2.2 data, ENC",
+        "C0 C1 C2 C3 C4 C5 C6 C7 C8 C9 CA CB CC CD CE CF",
+        "AC DE 48 00 00 00 00 01 00 00 00 05 04",
+        "69 DC 84 21 43 02 00 00 00 00 48 DE AC 01 00 00 00 00 48 DE AC 04 05 00 00 00",
+        "61 62 63 64",
+        0U,
+        "D4 3E 02 2B",
+    },
+    {
+        "802.15.4 C.2.3 command, ENC-MIC-64",
+        "C0 C1 C2 C3 C4 C5 C6 C7 C8 C9 CA CB CC CD CE CF",
+        "AC DE 48 00 00 00 00 01 00 00 00 05 06",
+        "2B DC 84 21 43 02 00 00 00 00 48 DE AC FF FF 01 00 00 00 00 48 DE AC 06 05 00 00 00 01",
+        "CE",
+        2U,
+        "D8 4F DE 52 90 61 F9 C6 F1",
+    },
+    {
+        "RFC 3610 packet vector #1, MIC-64",
+        "C0 C1 C2 C3 C4 C5 C6 C7 C8 C9 CA CB CC CD CE CF",
+        "00 00 00 03 02 01 00 A0 A1 A2 A3 A4 A5",
+        "00 01 02 03 04 05 06 07",
+        "08 09 0A 0B 0C 0D 0E 0F 10 11 12 13 14 15 16 17 18 19 1A 1B 1C 1D 1E",
+        2U,
+        "58 8C 97 9A 61 C6 63 D2 F0 66 D0 C2 C0 F9 89 80 6D 5F 6B 61 DA C3 84 17 E8 D1 2C FD F9 26 E0",
+    },
+};
+
+static const uint8_t m_mic_size[] = { 0U, MIC_32_SIZE, MIC_64_SIZE, MIC_128_SIZE };
+
+static uint8_t  m_work_buffer[MAX_PACKET_SIZE + PHR_SIZE]; ///< The only TX work buffer.
+static bool     m_secured;                                 ///< If the work buffer was marked as secured.
+static uint32_t m_rand_state;                              ///< State of the pseudo-random generator.
+static uint32_t m_failures;                                ///< Number of failed checks.
+
+uint8_t * nrf_802154_tx_work_buffer_enable_for(uint8_t * p_original_frame)
+{
+    (void)p_original_frame;
+
+    return m_work_buffer;
+}
+
+void nrf_802154_tx_work_buffer_plain_text_offset_set(const uint8_t * p_original_frame,
+                                                     uint8_t         offset)
+{
+    (void)p_original_frame;
+    (void)offset;
+}
+
+void nrf_802154_tx_work_buffer_is_secured_set(const uint8_t * p_original_frame)
+{
+    (void)p_original_frame;
+
+    m_secured = true;
+}
+
+void nrf_802154_assert_handler(const char * p_file, uint32_t line)
+{
+    printf("%s:%u: assertion failed\n", p_file, (unsigned)line);
+    exit(EXIT_FAILURE);
+}
+
+static uint32_t rand_get(void)
+{
+    m_rand_state ^= m_rand_state << 13;
+    m_rand_state ^= m_rand_state >> 17;
+    m_rand_state ^= m_rand_state << 5;
+
+    return m_rand_state;
+}
+
+static size_t hex_parse(const char * p_hex, uint8_t * p_out)
+{
+    size_t       len = 0U;
+    unsigned int octet;
+    int          used;
+
+    while (sscanf(p_hex, " %2x%n", &octet, &used) == 1)
+    {
+        p_out[len++] = (uint8_t)octet;
+        p_hex       += used;
+    }
+
+    return len;
+}
+
+/**
+ * @brief Computes CCM* of the given data as described by RFC 3610, one block at a time.
+ *
+ * @param[out] p_out  Cipher text followed by the encrypted MIC.
+ */
+static void reference_ccm(const uint8_t * p_key,
+                          const uint8_t * p_nonce,
+                          const uint8_t * p_auth_data,
+                          size_t          auth_data_len,
+                          const uint8_t * p_plain_text,
+                          size_t          plain_text_len,
+                          uint8_t         mic_size,
+                          uint8_t       * p_out)
+{
+    nrf_802154_aes_sw_ctx_t ctx;
+    uint8_t                 block[TEST_BLOCK_SIZE];
+    uint8_t                 x[TEST_BLOCK_SIZE];
+    uint8_t                 s[TEST_BLOCK_SIZE];
+    uint8_t                 stream[2U + MAX_PACKET_SIZE + TEST_BLOCK_SIZE];
+    size_t                  stream_len = 0U;
+
+    nrf_802154_aes_sw_key_expand(&ctx, p_key);
+
+    // Authentication: CBC-MAC over B0, the encoded length of a, a, and m, each padded with zeros
+    memset(block, 0, sizeof(block));
+    block[0] = (uint8_t)(TEST_L_VALUE - 1U);
+
+    if (mic_size != 0U)
+    {
+        block[0] |= (uint8_t)(((mic_size - 2U) / 2U) << 3);
+    }
+
+    if (auth_data_len != 0U)
+    {
+        block[0] |= 0x40U;
+    }
+
+    memcpy(&block[1], p_nonce, TEST_NONCE_SIZE);
+    block[14] = (uint8_t)(plain_text_len >> 8);
+    block[15] = (uint8_t)plain_text_len;
+
+    if (auth_data_len != 0U)
+    {
+        stream[stream_len++] = (uint8_t)(auth_data_len >> 8);
+        stream[stream_len++] = (uint8_t)auth_data_len;
+        memcpy(&stream[stream_len], p_auth_data, auth_data_len);
+        stream_len += auth_data_len;
+
+        while ((stream_len % TEST_BLOCK_SIZE) != 0U)
+        {
+            stream[stream_len++] = 0U;
+        }
+    }
+
+    memcpy(&stream[stream_len], p_plain_text, plain_text_len);
+    stream_len += plain_text_len;
+
+    while ((stream_len % TEST_BLOCK_SIZE) != 0U)
+    {
+        stream[stream_len++] = 0U;
+    }
+
+    nrf_802154_aes_sw_block_encrypt(&ctx, block, x);
+
+    for (size_t i = 0U; i < stream_len; i += TEST_BLOCK_SIZE)
+    {
+        for (size_t j = 0U; j < TEST_BLOCK_SIZE; j++)
+        {
+            x[j] ^= stream[i + j];
+        }
+
+        nrf_802154_aes_sw_block_encrypt(&ctx, x, x);
+    }
+
+    // Encryption: m XOR S1, S2, ... followed by T XOR S0
+    memset(block, 0, sizeof(block));
+    block[0] = (uint8_t)(TEST_L_VALUE - 1U);
+    memcpy(&block[1], p_nonce, TEST_NONCE_SIZE);
+
+    for (size_t i = 0U; i < plain_text_len; i++)
+    {
+        if ((i % TEST_BLOCK_SIZE) == 0U)
+        {
+            uint16_t counter = (uint16_t)(i / TEST_BLOCK_SIZE + 1U);
+
+            block[14] = (uint8_t)(counter >> 8);
+            block[15] = (uint8_t)counter;
+            nrf_802154_aes_sw_block_encrypt(&ctx, block, s);
+        }
+
+        p_out[i] = p_plain_text[i] ^ s[i % TEST_BLOCK_SIZE];
+    }
+
+    block[14] = 0U;
+    block[15] = 0U;
+    nrf_802154_aes_sw_block_encrypt(&ctx, block, s);
+
+    for (size_t i = 0U; i < mic_size; i++)
+    {
+        p_out[plain_text_len + i] = x[i] ^ s[i];
+    }
+}
+
+/**
+ * @brief Builds a frame of the given parts and transforms it with the backend.
+ *
+ * @returns Pointer to the transformed frame or NULL if the transformation was rejected.
+ */
+static const uint8_t * backend_ccm(uint8_t                       * p_frame,
+                                   const uint8_t                 * p_key,
+                                   const nrf_802154_aes_sw_ctx_t * p_key_ctx,
+                                   const uint8_t                 * p_nonce,
+                                   const uint8_t                 * p_auth_data,
+                                   size_t                          auth_data_len,
+                                   const uint8_t                 * p_plain_text,
+                                   size_t                          plain_text_len,
+                                   uint8_t                         mic_level)
+{
+    nrf_802154_aes_ccm_data_t data;
+    uint8_t                   mic_size = m_mic_size[mic_level];
+
+    p_frame[PHR_OFFSET] = (uint8_t)(auth_data_len + plain_text_len + mic_size + FCS_SIZE);
+    memcpy(&p_frame[PHR_SIZE], p_auth_data, auth_data_len);
+    memcpy(&p_frame[PHR_SIZE + auth_data_len], p_plain_text, plain_text_len);
+
+    memset(&data, 0, sizeof(data));
+    memcpy(data.key, p_key, sizeof(data.key));
+    memcpy(data.nonce, p_nonce, sizeof(data.nonce));
+    data.auth_data           = (auth_data_len != 0U) ? &p_frame[PHR_SIZE] : NULL;
+    data.auth_data_len       = auth_data_len;
+    data.plain_text_data     = (plain_text_len != 0U) ? &p_frame[PHR_SIZE + auth_data_len] : NULL;
+    data.plain_text_data_len = (uint8_t)plain_text_len;
+    data.mic_level           = mic_level;
+    data.raw_frame           = p_frame;
+    data.p_key_ctx           = p_key_ctx;
+
+    m_secured = false;
+
+    if (!nrf_802154_aes_ccm_transform_prepare(&data))
+    {
+        return NULL;
+    }
+
+    nrf_802154_aes_ccm_transform_start(p_frame);
+
+    return m_secured ? m_work_buffer : NULL;
+}
+
+static void cipher_test(void)
+{
+    nrf_802154_aes_sw_ctx_t ctx;
+    uint8_t                 key[TEST_BLOCK_SIZE];
+    uint8_t                 plain_text[TEST_BLOCK_SIZE];
+    uint8_t                 expected[TEST_BLOCK_SIZE];
+    uint8_t                 cipher_text[TEST_BLOCK_SIZE];
+
+    hex_parse("00 01 02 03 04 05 06 07 08 09 0A 0B 0C 0D 0E 0F", key);
+    hex_parse("00 11 22 33 44 55 66 77 88 99 AA BB CC DD EE FF", plain_text);
+    hex_parse("69 C4 E0 D8 6A 7B 04 30 D8 CD B7 80 70 B4 C5 5A", expected);
+
+    nrf_802154_aes_sw_key_expand(&ctx, key);
+    nrf_802154_aes_sw_block_encrypt(&ctx, plain_text, cipher_text);
+    CHECK(memcmp(cipher_text, expected, sizeof(expected)) == 0);
+
+    // In-place encryption
+    nrf_802154_aes_sw_block_encrypt(&ctx, plain_text, plain_text);
+    CHECK(memcmp(plain_text, expected, sizeof(expected)) == 0);
+
+    printf("FIPS-197 C.1: %s\n", (m_failures == 0U) ? "ok" : "FAILED");
+}
+
+static void vectors_test(void)
+{
+    for (size_t i = 0U; i < sizeof(m_vectors) / sizeof(m_vectors[0]); i++)
+    {
+        const test_vector_t * p_vector = &m_vectors[i];
+        uint32_t              failures = m_failures;
+        uint8_t               key[TEST_BLOCK_SIZE];
+        uint8_t               nonce[TEST_NONCE_SIZE];
+        uint8_t               auth_data[MAX_PACKET_SIZE];
+        uint8_t               plain_text[MAX_PACKET_SIZE];
+        uint8_t               expected[MAX_PACKET_SIZE];
+        uint8_t               reference[MAX_PACKET_SIZE];
+        uint8_t               frame[MAX_PACKET_SIZE + PHR_SIZE];
+        size_t                auth_data_len;
+        size_t                plain_text_len;
+        size_t                expected_len;
+        const uint8_t       * p_out;
+
+        CHECK(hex_parse(p_vector->p_key, key) == sizeof(key));
+        CHECK(hex_parse(p_vector->p_nonce, nonce) == sizeof(nonce));
+        auth_data_len  = hex_parse(p_vector->p_auth_data, auth_data);
+        plain_text_len = hex_parse(p_vector->p_plain_text, plain_text);
+        expected_len   = hex_parse(p_vector->p_expected, expected);
+        CHECK(expected_len == plain_text_len + m_mic_size[p_vector->mic_level]);
+
+        reference_ccm(key, nonce, auth_data, auth_data_len, plain_text, plain_text_len,
+                      m_mic_size[p_vector->mic_level], reference);
+        CHECK(memcmp(reference, expected, expected_len) == 0);
+
+        p_out = backend_ccm(frame, key, NULL, nonce, auth_data, auth_data_len, plain_text,
+                            plain_text_len, p_vector->mic_level);
+        CHECK(p_out != NULL);
+
+        if (p_out != NULL)
+        {
+            CHECK(p_out[PHR_OFFSET] == frame[PHR_OFFSET]);
+            CHECK(memcmp(&p_out[PHR_SIZE], auth_data, auth_data_len) == 0);
+            CHECK(memcmp(&p_out[PHR_SIZE + auth_data_len], expected, expected_len) == 0);
+        }
+
+        printf("%s: %s\n", p_vector->p_name, (m_failures == failures) ? "ok" : "FAILED");
+    }
+}
+
+static void random_test(uint32_t frames)
+{
+    uint32_t failures = m_failures;
+
+    for (uint32_t n = 0U; n < frames; n++)
+    {
+        uint8_t                 key[TEST_BLOCK_SIZE];
+        uint8_t                 nonce[TEST_NONCE_SIZE];
+        uint8_t                 payload[MAX_PACKET_SIZE];
+        uint8_t                 reference[MAX_PACKET_SIZE];
+        uint8_t                 frame[MAX_PACKET_SIZE + PHR_SIZE];
+        nrf_802154_aes_sw_ctx_t ctx;
+        uint8_t                 mic_level = (uint8_t)(rand_get() % 4U);
+        uint8_t                 mic_size  = m_mic_size[mic_level];
+        size_t                  room      = MAX_PACKET_SIZE - FCS_SIZE - mic_size;
+        size_t                  total     = rand_get() % (room + 1U);
+        size_t                  auth_data_len;
+        size_t                  plain_text_len;
+        const uint8_t         * p_out;
+
+        auth_data_len  = (total != 0U) ? (rand_get() % (total + 1U)) : 0U;
+        plain_text_len = ((rand_get() % 4U) == 0U) ? 0U : (total - auth_data_len);
+
+        for (size_t i = 0U; i < sizeof(key); i++)
+        {
+            key[i] = (uint8_t)rand_get();
+        }
+
+        for (size_t i = 0U; i < sizeof(nonce); i++)
+        {
+            nonce[i] = (uint8_t)rand_get();
+        }
+
+        for (size_t i = 0U; i < auth_data_len + plain_text_len; i++)
+        {
+            payload[i] = (uint8_t)rand_get();
+        }
+
+        reference_ccm(key, nonce, payload, auth_data_len, &payload[auth_data_len], plain_text_len,
+                      mic_size, reference);
+
+        // Every other frame uses a key context expanded in advance
+        if ((n & 1U) != 0U)
+        {
+            nrf_802154_aes_sw_key_expand(&ctx, key);
+        }
+
+        p_out = backend_ccm(frame, key, ((n & 1U) != 0U) ? &ctx : NULL, nonce, payload,
+                            auth_data_len, &payload[auth_data_len], plain_text_len, mic_level);
+        CHECK(p_out != NULL);
+
+        if ((p_out != NULL) &&
+            (memcmp(&p_out[PHR_SIZE + auth_data_len], reference, plain_text_len + mic_size) != 0))
+        {
+            CHECK(false);
+            printf("  mismatch: MIC level %u, a %u, m %u\n",
+                   (unsigned)mic_level, (unsigned)auth_data_len, (unsigned)plain_text_len);
+        }
+
+        if (m_failures - failures > 8U)
+        {
+            break;
+        }
+    }
+
+    printf("%u random frames: %s\n", (unsigned)frames, (m_failures == failures) ? "ok" : "FAILED");
+}
+
+static double time_get(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec / 1e9;
+}
+
+static void benchmark(uint32_t frames)
+{
+    static const size_t auth_data_len  = 23U;
+    static const size_t plain_text_len = MAX_PACKET_SIZE - 23U - MIC_128_SIZE - FCS_SIZE;
+
+    uint8_t                 key[TEST_BLOCK_SIZE];
+    uint8_t                 nonce[TEST_NONCE_SIZE];
+    uint8_t                 payload[MAX_PACKET_SIZE];
+    uint8_t                 frame[MAX_PACKET_SIZE + PHR_SIZE];
+    nrf_802154_aes_sw_ctx_t ctx;
+
+    for (size_t i = 0U; i < sizeof(key); i++)
+    {
+        key[i] = (uint8_t)rand_get();
+    }
+
+    for (size_t i = 0U; i < sizeof(nonce); i++)
+    {
+        nonce[i] = (uint8_t)rand_get();
+    }
+
+    for (size_t i = 0U; i < sizeof(payload); i++)
+    {
+        payload[i] = (uint8_t)rand_get();
+    }
+
+    nrf_802154_aes_sw_key_expand(&ctx, key);
+
+    for (int with_ctx = 0; with_ctx < 2; with_ctx++)
+    {
+        double start = time_get();
+
+        for (uint32_t n = 0U; n < frames; n++)
+        {
+            payload[auth_data_len] = (uint8_t)n;
+
+            CHECK(backend_ccm(frame, key, with_ctx ? &ctx : NULL, nonce, payload, auth_data_len,
+                              &payload[auth_data_len], plain_text_len, 3U) != NULL);
+        }
+
+        double elapsed = time_get() - start;
+
+        printf("ENC-MIC-128, 127-octet PSDU, %s: %.0f frames/s, %.2f us/frame\n",
+               with_ctx ? "key expanded in advance" : "key expanded per frame",
+               frames / elapsed,
+               elapsed * 1e6 / frames);
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t frames       = 200000U;
+    uint32_t bench_frames = 1000000U;
+    uint32_t seed         = 0x2545f491U;
+    int      opt          = 1;
+
+    while (opt + 1 < argc)
+    {
+        unsigned long value = strtoul(argv[opt + 1], NULL, 0);
+
+        if (strcmp(argv[opt], "-f") == 0)
+        {
+            frames = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-b") == 0)
+        {
+            bench_frames = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-s") == 0)
+        {
+            seed = (uint32_t)value;
+        }
+        else
+        {
+            break;
+        }
+
+        opt += 2;
+    }
+
+    if ((opt != argc) || (seed == 0U))
+    {
+        fprintf(stderr, "Usage: %s [-f <random frames>] [-b <benchmark frames>] [-s <seed>]\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    m_rand_state = seed;
+
+    cipher_test();
+    vectors_test();
+    random_test(frames);
+
+    if (bench_frames != 0U)
+    {
+        benchmark(bench_frames);
+    }
+
+    if (m_failures != 0U)
+    {
+        printf("%u checks failed\n", (unsigned)m_failures);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
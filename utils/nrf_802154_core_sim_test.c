@@ -0,0 +1,885 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run state machine test of the driver core on the simulated radio.
+ *
+ * The test links the driver unchanged, together with the open-source Service Layer, and replaces
+ * the radio with the trx simulator (nrf_802154_trx_sim.c) and the platform with the platform
+ * simulator (nrf_802154_platform_sim.c). Requests and notifications are direct, so every request
+ * is processed before it returns and every notification is called from the simulated ISR which
+ * produces it. A virtual peer on the simulated medium observes the frames transmitted by
+ * the driver and acknowledges the frames addressed to it.
+ *
+ * The scripted scenarios check the state machine of the core through the public API:
+ *
+ * - reception of a frame addressed to the driver, its timestamp and the ACK sent in response,
+ *   and, with NRF_802154_NEIGHBOR_TABLE_ENABLED, the neighbor table entry of the sender,
+ * - rejection of frames addressed to another node and of frames with an invalid FCS,
+ * - transmission acknowledged by the peer, transmission without an ACK and transmission on
+ *   a busy channel,
+ * - CSMA-CA transmission after busy CCAs, driven by the simulated timers,
+ * - sleep, during which no frame is received and the high-frequency clock is released,
+ * - with NRF_802154_TX_QUEUE_ENABLED, secured frames chained by the transmit queue: every frame
+ *   reaches the peer as it is reported back in the original buffer, with increasing frame
+ *   counters, also when a frame is cancelled and added again while the previous one is on air.
+ *   The host time from the end of a frame to its result is printed, because it includes the
+ *   setup of the next frame unless NRF_802154_TX_PIPELINE_DEPTH lets the core do it earlier.
+ *
+ * Delayed operations are not covered, because the open-source Service Layer does not trigger
+ * delayed timeslots through (D)PPI.
+ *
+ * The random scenario then drives the core with a stream of transmissions, receptions and sleep
+ * periods and checks that every request is notified exactly once with the expected result and
+ * that the driver returns to the expected state. The program exits with a failure if any check
+ * fails.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -DNRF_802154_USE_RAW_API=1 -DNRF_802154_TRX_SIM_ENABLED=1 \
+ *         -DNRF_802154_ENCRYPTION_ACCELERATOR_SW=1 -DNRF_802154_ENCRYPTION_ACCELERATOR_ECB=0 \
+ *         -DNRF_802154_REQUEST_IMPL=NRF_802154_REQUEST_IMPL_DIRECT \
+ *         -DNRF_802154_NOTIFICATION_IMPL=NRF_802154_NOTIFICATION_IMPL_DIRECT \
+ *         -o core_sim_test ../../utils/nrf_802154_core_sim_test.c \
+ *         $(find common/src driver/src sl/sl_opensource/src -name '*.c' | \
+ *           grep -v 'swi.c$\|debug_gpio.c\|bsim_utils.c\|sl_timer.c') \
+ *         -Icommon/include -Idriver/include -Idriver/src -Idriver/src/mac_features \
+ *         -Isl/include -Isl/sl_opensource/include \
+ *         -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis>
+ *
+ * Usage:
+ *
+ *     core_sim_test [-n <random operations>] [-s <seed>]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_platform_sim.h"
+#include "nrf_802154_procedures_duration.h"
+#include "nrf_802154_trx_sim.h"
+#include "platform/nrf_802154_clock.h"
+
+#define TEST_CHANNEL      15U     ///< Channel used by the driver and the peer.
+#define TEST_PAN_ID       0xabcdU ///< PAN ID of the driver and the peer.
+#define TEST_SHORT_ADDR   0x1234U ///< Short address of the driver.
+#define TEST_PEER_ADDR    0x5678U ///< Short address of the peer.
+#define TEST_OTHER_ADDR   0x9abcU ///< Short address of a node that is not the driver.
+#define TEST_PSDU_LENGTH  24U     ///< Length of the data frames, including FCS.
+#define TEST_START_TIME   1000U   ///< Time given to the driver to start an operation [us].
+#define TEST_TIMEOUT      20000U  ///< Time after which a pending notification is considered lost [us].
+#define TEST_FRAME_GAP    500U    ///< Gap between a frame and the next one injected by the peer [us].
+#define TEST_KEY_INDEX    1U      ///< Key Index of the key securing the queued frames.
+#define TEST_QUEUE_FRAMES 8U      ///< Number of frames added to the transmit queue at once.
+#define TEST_QUEUE_ROUNDS 256U    ///< Number of times the transmit queue is filled and emptied.
+#define TEST_QUEUE_DSN    0x80U   ///< DSN of the first queued frame.
+
+#define TEST_SEC_CTRL_OFFSET    10U                                         ///< Offset of the Security Control field.
+#define TEST_SEC_FC_OFFSET      (TEST_SEC_CTRL_OFFSET + SECURITY_CONTROL_SIZE) ///< Offset of the Frame Counter field.
+#define TEST_SEC_KEY_IDX_OFFSET (TEST_SEC_FC_OFFSET + FRAME_COUNTER_SIZE)     ///< Offset of the Key Index field.
+#define TEST_SEC_PSDU_LENGTH    100U                                        ///< Length of the secured frames, including MIC and FCS.
+
+#define CHECK(cond)                                                         \
+    do                                                                      \
+    {                                                                       \
+        if (!(cond))                                                        \
+        {                                                                   \
+            printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #cond); \
+            m_failures++;                                                   \
+        }                                                                   \
+    }                                                                       \
+    while (0)
+
+/**
+ * @brief Notifications of the driver and frames seen by the peer since the last reset of the log.
+ */
+typedef struct
+{
+    uint32_t              received;        ///< Number of received frames.
+    uint8_t               rx_dsn;          ///< DSN of the last received frame.
+    uint64_t              rx_time;         ///< Timestamp of the last received frame [us].
+    uint32_t              rx_failed;       ///< Number of failed receptions.
+    nrf_802154_rx_error_t rx_error;        ///< Error of the last failed reception.
+    uint32_t              transmitted;     ///< Number of successful transmissions.
+    bool                  tx_ack;          ///< If the last successful transmission received an ACK.
+    uint8_t               tx_ack_dsn;      ///< DSN of the ACK of the last successful transmission.
+    uint32_t              tx_failed;       ///< Number of failed transmissions.
+    nrf_802154_tx_error_t tx_error;        ///< Error of the last failed transmission.
+    uint32_t              peer_frames;     ///< Number of frames other than ACKs seen by the peer.
+    uint64_t              peer_frame_time; ///< Time of SHR of the last frame seen by the peer [us].
+    uint8_t               peer_channel;    ///< Channel of the last frame seen by the peer.
+    uint32_t              peer_acks;       ///< Number of ACKs seen by the peer.
+    uint8_t               peer_ack_dsn;    ///< DSN of the last ACK seen by the peer.
+    uint64_t              peer_ack_time;   ///< Time of SHR of the last ACK seen by the peer [us].
+} test_log_t;
+
+static uint32_t   m_failures;          ///< Number of failed checks.
+static uint32_t   m_rand_state;        ///< State of the pseudo-random generator.
+static test_log_t m_log;               ///< Notifications and frames observed by the test.
+static bool       m_peer_acks;         ///< If the peer acknowledges frames requesting an ACK.
+static uint8_t    m_tx_frame[MAX_PACKET_SIZE + PHR_SIZE]; ///< Frame transmitted by the driver.
+
+#if NRF_802154_TX_QUEUE_ENABLED
+static uint8_t  m_queue_frames[TEST_QUEUE_FRAMES][MAX_PACKET_SIZE + PHR_SIZE]; ///< Frames added to the transmit queue.
+static uint8_t  m_queue_air[TEST_QUEUE_FRAMES][MAX_PACKET_SIZE + PHR_SIZE];    ///< Queued frames as seen by the peer.
+static uint32_t m_queue_done;                                                  ///< Number of queued frames transmitted.
+static bool     m_queue_fc_valid;                                              ///< If @ref m_queue_fc holds a frame counter.
+static uint32_t m_queue_fc;                                                    ///< Frame counter of the last queued frame seen by the peer.
+static uint64_t m_queue_end_ns;                                                ///< Host time of the end of the last queued frame [ns].
+static uint64_t m_queue_result_ns;                                             ///< Host time from frame ends to their results [ns].
+#endif
+
+static uint32_t rand_get(void)
+{
+    // xorshift32
+    m_rand_state ^= m_rand_state << 13;
+    m_rand_state ^= m_rand_state >> 17;
+    m_rand_state ^= m_rand_state << 5;
+
+    return m_rand_state;
+}
+
+static uint64_t now(void)
+{
+    return nrf_802154_trx_sim_time_get();
+}
+
+static void run_for(uint64_t duration)
+{
+    nrf_802154_platform_sim_run_until(now() + duration);
+}
+
+static uint64_t host_time_ns(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000U) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Builds a data frame with short addresses and a compressed PAN ID.
+ */
+static void data_frame_build(uint8_t * p_frame, uint8_t dsn, uint16_t dst, bool ack_request)
+{
+    memset(p_frame, 0, TEST_PSDU_LENGTH + PHR_SIZE);
+
+    p_frame[PHR_OFFSET]        = TEST_PSDU_LENGTH;
+    p_frame[FRAME_TYPE_OFFSET] = FRAME_TYPE_DATA | PAN_ID_COMPR_MASK |
+                                 (ack_request ? ACK_REQUEST_BIT : 0U);
+    p_frame[2]         = DEST_ADDR_TYPE_SHORT | SRC_ADDR_TYPE_SHORT;
+    p_frame[DSN_OFFSET] = dsn;
+    p_frame[4]         = (uint8_t)TEST_PAN_ID;
+    p_frame[5]         = (uint8_t)(TEST_PAN_ID >> 8);
+    p_frame[6]         = (uint8_t)dst;
+    p_frame[7]         = (uint8_t)(dst >> 8);
+    p_frame[8]         = (uint8_t)TEST_PEER_ADDR;
+    p_frame[9]         = (uint8_t)(TEST_PEER_ADDR >> 8);
+
+    for (uint8_t i = 10U; i <= TEST_PSDU_LENGTH - FCS_SIZE; i++)
+    {
+        p_frame[i] = (uint8_t)(dsn + i);
+    }
+}
+
+static uint64_t frame_end_get(const uint8_t * p_frame, uint64_t shr_time)
+{
+    return shr_time + nrf_802154_frame_duration_get(p_frame[PHR_OFFSET], true, true);
+}
+
+/**
+ * @brief Injects a data frame sent by the peer and returns the time of its last symbol.
+ */
+static uint64_t peer_frame_send(uint8_t dsn, uint16_t dst, bool crc_ok)
+{
+    uint8_t  frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint64_t time = now() + TEST_FRAME_GAP;
+
+    data_frame_build(frame, dsn, dst, true);
+    CHECK(nrf_802154_trx_sim_frame_inject(TEST_CHANNEL, frame, time, crc_ok));
+
+    return frame_end_get(frame, time);
+}
+
+/**
+ * @brief Observes the frames transmitted by the driver and acknowledges them as the peer.
+ */
+static void peer_tx_observe(uint8_t channel, const uint8_t * p_psdu, uint64_t timestamp)
+{
+    if ((p_psdu[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) == FRAME_TYPE_ACK)
+    {
+        m_log.peer_acks++;
+        m_log.peer_ack_dsn  = p_psdu[DSN_OFFSET];
+        m_log.peer_ack_time = timestamp;
+        return;
+    }
+
+    m_log.peer_frames++;
+    m_log.peer_frame_time = timestamp;
+    m_log.peer_channel    = channel;
+
+#if NRF_802154_TX_QUEUE_ENABLED
+    uint8_t idx = p_psdu[DSN_OFFSET] - TEST_QUEUE_DSN;
+
+    if (((p_psdu[SECURITY_ENABLED_OFFSET] & SECURITY_ENABLED_BIT) != 0U) &&
+        (idx < TEST_QUEUE_FRAMES))
+    {
+        const uint8_t * p_fc = &p_psdu[TEST_SEC_FC_OFFSET];
+        uint32_t        fc   = p_fc[0] | (p_fc[1] << 8) | (p_fc[2] << 16) | ((uint32_t)p_fc[3] << 24);
+
+        CHECK(!m_queue_fc_valid || (fc > m_queue_fc));
+
+        memcpy(m_queue_air[idx], p_psdu, p_psdu[PHR_OFFSET] + PHR_SIZE);
+        m_queue_fc_valid = true;
+        m_queue_fc       = fc;
+        m_queue_end_ns   = host_time_ns();
+    }
+#endif
+
+    if (m_peer_acks && ((p_psdu[ACK_REQUEST_OFFSET] & ACK_REQUEST_BIT) != 0U))
+    {
+        uint8_t ack[IMM_ACK_LENGTH + PHR_SIZE] = {IMM_ACK_LENGTH, FRAME_TYPE_ACK, 0U,
+                                                  p_psdu[DSN_OFFSET]};
+
+        CHECK(nrf_802154_trx_sim_frame_inject(channel,
+                                              ack,
+                                              frame_end_get(p_psdu, timestamp) + TURNAROUND_TIME,
+                                              true));
+    }
+}
+
+void nrf_802154_received_timestamp_raw(uint8_t * p_data, int8_t power, uint8_t lqi, uint64_t time)
+{
+    (void)power;
+    (void)lqi;
+
+    m_log.received++;
+    m_log.rx_dsn  = p_data[DSN_OFFSET];
+    m_log.rx_time = time;
+
+    nrf_802154_buffer_free_raw(p_data);
+}
+
+void nrf_802154_receive_failed(nrf_802154_rx_error_t error, uint32_t id)
+{
+    (void)id;
+
+    m_log.rx_failed++;
+    m_log.rx_error = error;
+}
+
+void nrf_802154_transmitted_raw(uint8_t                                   * p_frame,
+                                const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    uint8_t * p_ack = p_metadata->data.transmitted.p_ack;
+
+#if NRF_802154_TX_QUEUE_ENABLED
+    if (p_frame != m_tx_frame)
+    {
+        uint8_t idx = p_frame[DSN_OFFSET] - TEST_QUEUE_DSN;
+
+        m_queue_result_ns += host_time_ns() - m_queue_end_ns;
+
+        // The original buffer is updated from the work buffer the frame was transmitted from
+        CHECK((idx < TEST_QUEUE_FRAMES) && (p_frame == m_queue_frames[idx]));
+        CHECK(memcmp(p_frame, m_queue_air[idx], p_frame[PHR_OFFSET] + PHR_SIZE) == 0);
+        CHECK(p_metadata->frame_props.is_secured);
+        CHECK(p_metadata->frame_props.dynamic_data_is_set);
+
+        m_queue_done++;
+    }
+#else
+    CHECK(p_frame == m_tx_frame);
+#endif
+
+    m_log.transmitted++;
+    m_log.tx_ack = (p_ack != NULL);
+
+    if (p_ack != NULL)
+    {
+        m_log.tx_ack_dsn = p_ack[DSN_OFFSET];
+        nrf_802154_buffer_free_raw(p_ack);
+    }
+}
+
+void nrf_802154_transmit_failed(uint8_t                                   * p_frame,
+                                nrf_802154_tx_error_t                       error,
+                                const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    (void)p_metadata;
+
+    CHECK(p_frame == m_tx_frame);
+
+    m_log.tx_failed++;
+    m_log.tx_error = error;
+}
+
+static void setup(void)
+{
+    uint8_t pan_id[PAN_ID_SIZE]        = {(uint8_t)TEST_PAN_ID, (uint8_t)(TEST_PAN_ID >> 8)};
+    uint8_t short_addr[SHORT_ADDRESS_SIZE] = {(uint8_t)TEST_SHORT_ADDR,
+                                              (uint8_t)(TEST_SHORT_ADDR >> 8)};
+
+    nrf_802154_platform_sim_reset();
+    nrf_802154_init();
+
+    nrf_802154_channel_set(TEST_CHANNEL);
+    nrf_802154_pan_id_set(pan_id);
+    nrf_802154_short_address_set(short_addr);
+
+    nrf_802154_trx_sim_tx_callback_set(peer_tx_observe);
+
+    memset(&m_log, 0, sizeof(m_log));
+    m_peer_acks = true;
+}
+
+static void teardown(void)
+{
+    if (nrf_802154_state_get() != NRF_802154_STATE_SLEEP)
+    {
+        CHECK(nrf_802154_sleep());
+        run_for(TEST_START_TIME);
+    }
+
+    nrf_802154_deinit();
+}
+
+static bool transmit(uint8_t dsn, bool ack_request, bool cca)
+{
+    nrf_802154_transmit_metadata_t metadata = {
+        .frame_props = NRF_802154_TRANSMITTED_FRAME_PROPS_DEFAULT_INIT,
+        .cca         = cca,
+    };
+
+    data_frame_build(m_tx_frame, dsn, TEST_PEER_ADDR, ack_request);
+
+    return nrf_802154_transmit_raw(m_tx_frame, &metadata);
+}
+
+static void receive_test(void)
+{
+    uint32_t failures = m_failures;
+    uint64_t frame_end;
+
+    setup();
+
+    CHECK(nrf_802154_receive());
+    CHECK(nrf_802154_state_get() == NRF_802154_STATE_RECEIVE);
+    run_for(TEST_START_TIME);
+    CHECK(nrf_802154_clock_hfclk_is_running());
+
+    // Frame addressed to the driver is received, timestamped and acknowledged.
+    frame_end = peer_frame_send(0x11U, TEST_SHORT_ADDR, true);
+    run_for(TEST_FRAME_GAP + TEST_TIMEOUT);
+
+    CHECK(m_log.received == 1U);
+    CHECK(m_log.rx_dsn == 0x11U);
+    CHECK(m_log.rx_time == frame_end);
+    CHECK(m_log.peer_acks == 1U);
+    CHECK(m_log.peer_ack_dsn == 0x11U);
+    CHECK(m_log.peer_ack_time == frame_end + TURNAROUND_TIME);
+    CHECK(nrf_802154_state_get() == NRF_802154_STATE_RECEIVE);
+
+    // Frames addressed to another node or with an invalid FCS are neither received nor acknowledged.
+    (void)peer_frame_send(0x12U, TEST_OTHER_ADDR, true);
+    run_for(TEST_FRAME_GAP + TEST_TIMEOUT);
+    (void)peer_frame_send(0x13U, TEST_SHORT_ADDR, false);
+    run_for(TEST_FRAME_GAP + TEST_TIMEOUT);
+
+    CHECK(m_log.received == 1U);
+    CHECK(m_log.peer_acks == 1U);
+    CHECK(nrf_802154_state_get() == NRF_802154_STATE_RECEIVE);
+
+    // The receiver keeps working afterwards.
+    (void)peer_frame_send(0x14U, TEST_SHORT_ADDR, true);
+    run_for(TEST_FRAME_GAP + TEST_TIMEOUT);
+
+    CHECK(m_log.received == 2U);
+    CHECK(m_log.rx_dsn == 0x14U);
+    CHECK(m_log.peer_acks == 2U);
+
+#if NRF_802154_NEIGHBOR_TABLE_ENABLED
+    // Both received frames are recorded for the peer, after the receiver was restarted.
+    uint8_t               peer_addr[SHORT_ADDRESS_SIZE] = {(uint8_t)TEST_PEER_ADDR,
+                                                           (uint8_t)(TEST_PEER_ADDR >> 8)};
+    nrf_802154_neighbor_t neighbor;
+
+    CHECK(nrf_802154_neighbor_get(peer_addr, false, &neighbor));
+    CHECK(neighbor.rx_frames == 2U);
+#endif
+
+    teardown();
+
+    printf("receive: %s\n", (m_failures == failures) ? "ok" : "FAILED");
+}
+
+static void transmit_test(void)
+{
+    uint32_t failures = m_failures;
+
+    setup();
+
+    CHECK(nrf_802154_receive());
+    run_for(TEST_START_TIME);
+
+    // Acknowledged transmission.
+    CHECK(transmit(0x21U, true, true));
+    run_for(TEST_TIMEOUT);
+
+    CHECK(m_log.peer_frames == 1U);
+    CHECK(m_log.peer_channel == TEST_CHANNEL);
+    CHECK(m_log.transmitted == 1U);
+    CHECK(m_log.tx_ack);
+    CHECK(m_log.tx_ack_dsn == 0x21U);
+    CHECK(m_log.tx_failed == 0U);
+    CHECK(nrf_802154_state_get() == NRF_802154_STATE_RECEIVE);
+
+    // Transmission without an ACK request ends right after the frame.
+    CHECK(transmit(0x22U, false, true));
+    run_for(TEST_TIMEOUT);
+
+    CHECK(m_log.peer_frames == 2U);
+    CHECK(m_log.transmitted == 2U);
+    CHECK(!m_log.tx_ack);
+
+    // The peer does not acknowledge.
+    m_peer_acks = false;
+    CHECK(transmit(0x23U, true, true));
+    run_for(TEST_TIMEOUT);
+
+    CHECK(m_log.peer_frames == 3U);
+    CHECK(m_log.transmitted == 2U);
+    CHECK(m_log.tx_failed == 1U);
+    CHECK(m_log.tx_error == NRF_802154_TX_ERROR_NO_ACK);
+    CHECK(nrf_802154_state_get() == NRF_802154_STATE_RECEIVE);
+
+    // The channel is busy.
+    m_peer_acks = true;
+    nrf_802154_trx_sim_cca_busy_pattern_set(UINT32_MAX);
+    CHECK(transmit(0x24U, true, true));
+    run_for(TEST_TIMEOUT);
+
+    CHECK(m_log.peer_frames == 3U);
+    CHECK(m_log.tx_failed == 2U);
+    CHECK(m_log.tx_error == NRF_802154_TX_ERROR_BUSY_CHANNEL);
+    CHECK(nrf_802154_state_get() == NRF_802154_STATE_RECEIVE);
+
+    // Without CCA the busy channel does not matter.
+    CHECK(transmit(0x25U, true, false));
+    run_for(TEST_TIMEOUT);
+
+    CHECK(m_log.peer_frames == 4U);
+    CHECK(m_log.transmitted == 3U);
+    CHECK(m_log.tx_ack_dsn == 0x25U);
+
+    nrf_802154_trx_sim_cca_busy_pattern_set(0U);
+
+    teardown();
+
+    printf("transmit: %s\n", (m_failures == failures) ? "ok" : "FAILED");
+}
+
+static void csma_ca_test(void)
+{
+#if NRF_802154_CSMA_CA_ENABLED
+    uint32_t                               failures = m_failures;
+    nrf_802154_transmit_csma_ca_metadata_t metadata = {
+        .frame_props = NRF_802154_TRANSMITTED_FRAME_PROPS_DEFAULT_INIT,
+    };
+
+    setup();
+
+    CHECK(nrf_802154_receive());
+    run_for(TEST_START_TIME);
+
+    // Two busy CCAs delay the transmission by two backoffs.
+    nrf_802154_trx_sim_cca_busy_pattern_set(0x3U);
+    data_frame_build(m_tx_frame, 0x31U, TEST_PEER_ADDR, true);
+    CHECK(nrf_802154_transmit_csma_ca_raw(m_tx_frame, &metadata));
+    run_for(TEST_TIMEOUT);
+
+    CHECK(m_log.peer_frames == 1U);
+    CHECK(m_log.transmitted == 1U);
+    CHECK(m_log.tx_ack_dsn == 0x31U);
+    CHECK(nrf_802154_state_get() == NRF_802154_STATE_RECEIVE);
+
+    // The channel stays busy for all the backoffs.
+    nrf_802154_trx_sim_cca_busy_pattern_set(UINT32_MAX);
+    data_frame_build(m_tx_frame, 0x32U, TEST_PEER_ADDR, true);
+    CHECK(nrf_802154_transmit_csma_ca_raw(m_tx_frame, &metadata));
+    run_for(TEST_TIMEOUT);
+
+    CHECK(m_log.peer_frames == 1U);
+    CHECK(m_log.tx_failed == 1U);
+    CHECK(m_log.tx_error == NRF_802154_TX_ERROR_BUSY_CHANNEL);
+    CHECK(nrf_802154_state_get() == NRF_802154_STATE_RECEIVE);
+
+    nrf_802154_trx_sim_cca_busy_pattern_set(0U);
+
+    teardown();
+
+    printf("csma-ca: %s\n", (m_failures == failures) ? "ok" : "FAILED");
+#endif
+}
+
+static void sleep_test(void)
+{
+    uint32_t failures = m_failures;
+
+    setup();
+
+    CHECK(nrf_802154_state_get() == NRF_802154_STATE_SLEEP);
+
+    CHECK(nrf_802154_receive());
+    run_for(TEST_START_TIME);
+    CHECK(nrf_802154_sleep());
+    run_for(TEST_START_TIME);
+
+    CHECK(nrf_802154_state_get() == NRF_802154_STATE_SLEEP);
+    CHECK(!nrf_802154_clock_hfclk_is_running());
+
+    // No frame is received during sleep.
+    (void)peer_frame_send(0x51U, TEST_SHORT_ADDR, true);
+    run_for(TEST_FRAME_GAP + TEST_TIMEOUT);
+
+    CHECK(m_log.received == 0U);
+    CHECK(m_log.peer_acks == 0U);
+
+    // The driver wakes up and receives again.
+    CHECK(nrf_802154_receive());
+    run_for(TEST_START_TIME);
+    (void)peer_frame_send(0x52U, TEST_SHORT_ADDR, true);
+    run_for(TEST_FRAME_GAP + TEST_TIMEOUT);
+
+    CHECK(m_log.received == 1U);
+    CHECK(m_log.rx_dsn == 0x52U);
+
+    teardown();
+
+    printf("sleep: %s\n", (m_failures == failures) ? "ok" : "FAILED");
+}
+
+#if NRF_802154_TX_QUEUE_ENABLED
+/**
+ * @brief Builds a data frame secured with ENC-MIC-32 and Key Identifier mode 1.
+ */
+static void secured_frame_build(uint8_t * p_frame, uint8_t dsn, bool ack_request)
+{
+    data_frame_build(p_frame, dsn, TEST_PEER_ADDR, ack_request);
+
+    p_frame[PHR_OFFSET]               = TEST_SEC_PSDU_LENGTH;
+    p_frame[SECURITY_ENABLED_OFFSET] |= SECURITY_ENABLED_BIT;
+    p_frame[FRAME_VERSION_OFFSET]    |= FRAME_VERSION_1;
+    p_frame[TEST_SEC_CTRL_OFFSET]     = SECURITY_LEVEL_ENC_MIC_32 | KEY_ID_MODE_1_MASK;
+    memset(&p_frame[TEST_SEC_FC_OFFSET], 0, FRAME_COUNTER_SIZE);
+    p_frame[TEST_SEC_KEY_IDX_OFFSET] = TEST_KEY_INDEX;
+
+    for (uint8_t i = TEST_SEC_KEY_IDX_OFFSET + 1U; i <= TEST_SEC_PSDU_LENGTH; i++)
+    {
+        p_frame[i] = (i <= TEST_SEC_PSDU_LENGTH - MIC_32_SIZE - FCS_SIZE) ? (uint8_t)(dsn + i) : 0U;
+    }
+}
+
+static void queue_frames_enqueue(uint8_t first, uint8_t count, bool ack_request)
+{
+    nrf_802154_tx_queue_entry_t entries[TEST_QUEUE_FRAMES];
+
+    memset(entries, 0, sizeof(entries));
+
+    for (uint8_t i = 0U; i < count; i++)
+    {
+        secured_frame_build(m_queue_frames[first + i], TEST_QUEUE_DSN + first + i, ack_request);
+
+        entries[i].p_data               = m_queue_frames[first + i];
+        entries[i].metadata.frame_props = NRF_802154_TRANSMITTED_FRAME_PROPS_DEFAULT_INIT;
+        entries[i].metadata.cca         = true;
+    }
+
+    CHECK(nrf_802154_tx_queue_enqueue_raw(entries, count) == count);
+}
+
+static void tx_queue_test(void)
+{
+    uint32_t         failures          = m_failures;
+    uint8_t          key_index         = TEST_KEY_INDEX;
+    uint8_t          key_value[16]     = {0xc0, 0xc1, 0xc2, 0xc3, 0xc4, 0xc5, 0xc6, 0xc7,
+                                          0xc8, 0xc9, 0xca, 0xcb, 0xcc, 0xcd, 0xce, 0xcf};
+    uint8_t          ext_addr[8]       = {0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17};
+    nrf_802154_key_t key               =
+    {
+        .value.p_cleartext_key    = key_value,
+        .id.mode                  = KEY_ID_MODE_1,
+        .id.p_key_id              = &key_index,
+        .type                     = NRF_802154_KEY_CLEARTEXT,
+        .use_global_frame_counter = true,
+    };
+
+    setup();
+
+    nrf_802154_extended_address_set(ext_addr);
+    CHECK(nrf_802154_security_key_store(&key) == NRF_802154_SECURITY_ERROR_NONE);
+    CHECK(nrf_802154_receive());
+    run_for(TEST_START_TIME);
+
+    m_queue_fc_valid = false;
+
+    // Frames without an ACK request are chained from the end of the previous frame. The fastest
+    // round is reported, as the others include the noise of the host.
+    uint64_t result_ns = UINT64_MAX;
+
+    for (uint32_t round = 0U; round < TEST_QUEUE_ROUNDS; round++)
+    {
+        m_queue_done      = 0U;
+        m_queue_result_ns = 0U;
+
+        queue_frames_enqueue(0U, TEST_QUEUE_FRAMES, false);
+        run_for(TEST_QUEUE_FRAMES * TEST_TIMEOUT);
+
+        CHECK(m_queue_done == TEST_QUEUE_FRAMES);
+        CHECK(nrf_802154_tx_queue_length_get() == 0U);
+
+        if (m_queue_result_ns / TEST_QUEUE_FRAMES < result_ns)
+        {
+            result_ns = m_queue_result_ns / TEST_QUEUE_FRAMES;
+        }
+    }
+
+    // The second frame is cancelled while the first one is on air, after it was possibly set up
+    // ahead, and added again rebuilt. Its new contents must be set up again, so that its frame
+    // counter is injected in the new contents.
+    m_queue_done = 0U;
+    queue_frames_enqueue(0U, 2U, true);
+    run_for(TEST_START_TIME);
+
+    CHECK(nrf_802154_tx_queue_cancel(m_queue_frames[1]));
+    queue_frames_enqueue(1U, 1U, true);
+    run_for(4U * TEST_TIMEOUT);
+
+    CHECK(m_queue_done == 2U);
+    CHECK(m_log.tx_ack_dsn == TEST_QUEUE_DSN + 1U);
+    CHECK(nrf_802154_tx_queue_length_get() == 0U);
+    CHECK(nrf_802154_state_get() == NRF_802154_STATE_RECEIVE);
+
+    teardown();
+
+    printf("tx queue: %u secured frames, %llu ns from frame end to result: %s\n",
+           (unsigned)(TEST_QUEUE_FRAMES * TEST_QUEUE_ROUNDS),
+           (unsigned long long)result_ns,
+           (m_failures == failures) ? "ok" : "FAILED");
+}
+
+#endif
+
+static void random_test(uint32_t operations)
+{
+    uint32_t failures  = m_failures;
+    uint32_t counts[4] = {0};
+    uint8_t  dsn       = 0U;
+    bool     sleeping  = false;
+
+    setup();
+
+    CHECK(nrf_802154_receive());
+    run_for(TEST_START_TIME);
+
+    for (uint32_t i = 0U; (i < operations) && (m_failures - failures < 8U); i++)
+    {
+        test_log_t expected = m_log;
+        uint32_t   r        = rand_get();
+        uint32_t   op       = r % 4U;
+
+        dsn++;
+        counts[op]++;
+
+        switch (op)
+        {
+            case 0:
+            {
+                // Transmission, acknowledged or not by the peer and preceded by a free or busy CCA.
+                bool ack_request = ((r >> 2) & 1U) != 0U;
+                bool busy        = ((r >> 3) & 7U) == 0U;
+
+                m_peer_acks = ((r >> 6) & 3U) != 0U;
+                nrf_802154_trx_sim_cca_busy_pattern_set(busy ? 1U : 0U);
+
+                CHECK(transmit(dsn, ack_request, true));
+                run_for(TEST_TIMEOUT);
+
+                if (busy)
+                {
+                    expected.tx_failed++;
+                    expected.tx_error = NRF_802154_TX_ERROR_BUSY_CHANNEL;
+                }
+                else if (ack_request && !m_peer_acks)
+                {
+                    expected.peer_frames++;
+                    expected.tx_failed++;
+                    expected.tx_error = NRF_802154_TX_ERROR_NO_ACK;
+                }
+                else
+                {
+                    expected.peer_frames++;
+                    expected.transmitted++;
+
+                    CHECK(m_log.tx_ack == ack_request);
+                    CHECK(!ack_request || (m_log.tx_ack_dsn == dsn));
+                }
+
+                CHECK(m_log.peer_frames == expected.peer_frames);
+                CHECK(m_log.transmitted == expected.transmitted);
+                CHECK(m_log.tx_failed == expected.tx_failed);
+                CHECK(m_log.tx_error == expected.tx_error);
+
+                // A transmission wakes the driver up and leaves it receiving.
+                sleeping = false;
+                break;
+            }
+
+            case 1:
+            case 2:
+            {
+                // Frame sent by the peer to the driver, to another node or corrupted.
+                bool     for_driver = (op == 1U);
+                bool     crc_ok     = ((r >> 2) & 7U) != 0U;
+                uint64_t frame_end  = peer_frame_send(dsn,
+                                                      for_driver ? TEST_SHORT_ADDR : TEST_OTHER_ADDR,
+                                                      crc_ok);
+
+                run_for(TEST_FRAME_GAP + TEST_TIMEOUT);
+
+                if (for_driver && crc_ok && !sleeping)
+                {
+                    expected.received++;
+                    expected.peer_acks++;
+
+                    CHECK(m_log.rx_dsn == dsn);
+                    CHECK(m_log.rx_time == frame_end);
+                    CHECK(m_log.peer_ack_dsn == dsn);
+                }
+
+                CHECK(m_log.received == expected.received);
+                CHECK(m_log.peer_acks == expected.peer_acks);
+                break;
+            }
+
+            default:
+                // Toggle sleep.
+                if (sleeping)
+                {
+                    CHECK(nrf_802154_receive());
+                }
+                else
+                {
+                    CHECK(nrf_802154_sleep());
+                }
+
+                sleeping = !sleeping;
+                run_for(TEST_START_TIME);
+                break;
+        }
+
+        CHECK(nrf_802154_state_get() ==
+              (sleeping ? NRF_802154_STATE_SLEEP : NRF_802154_STATE_RECEIVE));
+    }
+
+    nrf_802154_trx_sim_cca_busy_pattern_set(0U);
+
+    teardown();
+
+    printf("random: %u transmissions, %u frames, %u sleep toggles: %s\n",
+           (unsigned)counts[0],
+           (unsigned)(counts[1] + counts[2]),
+           (unsigned)counts[3],
+           (m_failures == failures) ? "ok" : "FAILED");
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t operations = 20000U;
+    uint32_t seed       = 0x2545f491U;
+    int      opt        = 1;
+
+    while (opt + 1 < argc)
+    {
+        unsigned long value = strtoul(argv[opt + 1], NULL, 0);
+
+        if (strcmp(argv[opt], "-n") == 0)
+        {
+            operations = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-s") == 0)
+        {
+            seed = (uint32_t)value;
+        }
+        else
+        {
+            break;
+        }
+
+        opt += 2;
+    }
+
+    if ((opt != argc) || (seed == 0U))
+    {
+        fprintf(stderr, "Usage: %s [-n <random operations>] [-s <seed>]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    m_rand_state = seed;
+
+    receive_test();
+    transmit_test();
+    csma_ca_test();
+    sleep_test();
+#if NRF_802154_TX_QUEUE_ENABLED
+    tx_queue_test();
+#endif
+    random_test(operations);
+
+    if (m_failures != 0U)
+    {
+        printf("%u checks failed\n", (unsigned)m_failures);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,693 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run contention simulator for the CSMA-CA backoff policies.
+ *
+ * The simulator models N nodes sharing a single collision domain. Every node runs the unslotted
+ * CSMA-CA procedure with its own copy of a backoff policy from nrf_802154_csma_ca_backoff.c,
+ * so the policy code under test is the one built into the driver. Frames arrive at each node as
+ * a Poisson process. A frame is lost when its transmission or its Ack overlaps with another
+ * transmission, or when CSMA-CA declares a channel access failure. There are no retransmissions.
+ *
+ * Timing follows the 2.4 GHz O-QPSK PHY: aCcaTime is 128 us, aTurnaroundTime is 192 us,
+ * aUnitBackoffPeriod is 320 us and one octet lasts 32 us. Traffic and backoff draws come from
+ * separate generators seeded with the same value, so every policy faces identical traffic and
+ * a run is reproducible.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -o csma_ca_sim ../../utils/nrf_802154_csma_ca_sim.c \
+ *         driver/src/mac_features/nrf_802154_csma_ca_backoff.c \
+ *         driver/src/mac_features/nrf_802154_frame_parser.c \
+ *         -Icommon/include -Idriver/include -Idriver/src -Idriver/src/mac_features \
+ *         -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis> -lm
+ *
+ * Usage:
+ *
+ *     csma_ca_sim [-n <nodes>[,<nodes>...]] [-r <frames per second per node>] [-l <psdu length>]
+ *                 [-t <seconds>] [-s <seed>] [-p ieee|adaptive|priority|destination|all]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <math.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_csma_ca_backoff.h"
+
+#define SIM_MAX_NODES        256U                                   ///< Maximum number of simulated nodes.
+#define SIM_QUEUE_SIZE       16U                                    ///< Number of frames a node can hold before dropping new ones.
+#define SIM_DESTINATIONS_NUM 4U                                     ///< Number of unicast destinations each node sends to.
+#define SIM_OCTET_TIME       (PHY_SYMBOLS_PER_OCTET * PHY_US_PER_SYMBOL) ///< Duration of one octet, in microseconds.
+#define SIM_SHR_PHR_TIME     ((PHY_SHR_SYMBOLS * PHY_US_PER_SYMBOL) + SIM_OCTET_TIME)
+#define SIM_ACK_TIME         (SIM_SHR_PHR_TIME + IMM_ACK_LENGTH * SIM_OCTET_TIME)
+#define SIM_TIME_NEVER       UINT64_MAX
+
+/**
+ * @brief Kinds of frames generated by the simulated nodes.
+ */
+typedef enum
+{
+    SIM_FRAME_DATA_ACK,   ///< Unicast data frame requesting an Ack.
+    SIM_FRAME_BROADCAST,  ///< Broadcast data frame, without an Ack.
+    SIM_FRAME_COMMAND,    ///< Unicast MAC command frame requesting an Ack.
+} sim_frame_kind_t;
+
+/**
+ * @brief Steps of the CSMA-CA procedure of a node.
+ */
+typedef enum
+{
+    SIM_NODE_IDLE,    ///< No frame is being processed.
+    SIM_NODE_BACKOFF, ///< Waiting for the end of the backoff and the CCA.
+    SIM_NODE_TX,      ///< Waiting for the start of the transmission after the turnaround.
+    SIM_NODE_WAIT,    ///< Waiting for the end of the transmission and the Ack.
+} sim_node_step_t;
+
+typedef struct
+{
+    uint64_t arrival;                    ///< Time when the frame was queued.
+    uint8_t  psdu[MAX_PACKET_SIZE + 1U]; ///< Frame with the PHR.
+} sim_frame_t;
+
+typedef struct
+{
+    uint64_t start;    ///< Start of the transmission.
+    uint64_t end;      ///< End of the transmission.
+    uint32_t owner;    ///< Identifier of the transmission, shared by a frame and its Ack.
+} sim_interval_t;
+
+typedef struct
+{
+    nrf_802154_csma_ca_backoff_policy_t          policy;          ///< Private copy of the policy.
+    nrf_802154_csma_ca_backoff_adaptive_ctx_t    adaptive_ctx;    ///< Context of the adaptive policy.
+    nrf_802154_csma_ca_backoff_destination_ctx_t destination_ctx; ///< Context of the per-destination policy.
+    nrf_802154_csma_ca_backoff_state_t           state;           ///< State of the CSMA-CA procedure.
+
+    sim_frame_t     queue[SIM_QUEUE_SIZE]; ///< Queued frames; the head is being processed.
+    uint32_t        queue_head;
+    uint32_t        queue_len;
+    sim_node_step_t step;
+    uint64_t        next_event;            ///< Time of the next CSMA-CA step.
+    uint64_t        next_arrival;          ///< Time of the next frame arrival.
+    uint32_t        owner;                 ///< Identifier of the current transmission.
+    uint64_t        tx_start;              ///< Start of the current transmission.
+    uint16_t        short_addr;
+    uint16_t        destinations[SIM_DESTINATIONS_NUM];
+} sim_node_t;
+
+typedef struct
+{
+    uint64_t  offered;    ///< Frames that arrived.
+    uint64_t  overflows;  ///< Frames dropped because the queue was full.
+    uint64_t  delivered;  ///< Frames sent without collision.
+    uint64_t  collided;   ///< Frames whose transmission or Ack collided.
+    uint64_t  cafs;       ///< Frames dropped due to channel access failure.
+    uint64_t  ccas;       ///< CCA attempts.
+    uint64_t  ccas_busy;  ///< CCA attempts that found the channel busy.
+    uint64_t  bytes;      ///< PSDU octets of the delivered frames.
+    uint32_t *p_latency;  ///< Latencies of the delivered frames, in microseconds.
+    size_t    latency_cap;
+} sim_result_t;
+
+typedef struct
+{
+    const char                           * p_name;
+    nrf_802154_csma_ca_backoff_policy_id_t id;
+} sim_policy_name_t;
+
+static const sim_policy_name_t m_policy_names[] =
+{
+    {"ieee",        NRF_802154_CSMA_CA_BACKOFF_POLICY_IEEE       },
+    {"adaptive",    NRF_802154_CSMA_CA_BACKOFF_POLICY_ADAPTIVE   },
+    {"priority",    NRF_802154_CSMA_CA_BACKOFF_POLICY_PRIORITY   },
+    {"destination", NRF_802154_CSMA_CA_BACKOFF_POLICY_DESTINATION},
+};
+
+static uint32_t         m_backoff_rng; ///< State of the generator behind nrf_802154_random_get.
+static uint32_t         m_traffic_rng; ///< State of the generator of the traffic.
+static sim_node_t       m_nodes[SIM_MAX_NODES];
+static sim_interval_t * mp_intervals;
+static size_t           m_intervals_len;
+static size_t           m_intervals_cap;
+static uint32_t         m_next_owner;
+
+static uint32_t xorshift32(uint32_t * p_state)
+{
+    uint32_t x = *p_state;
+
+    x        ^= x << 13;
+    x        ^= x >> 17;
+    x        ^= x << 5;
+    *p_state  = x;
+
+    return x;
+}
+
+uint32_t nrf_802154_random_get(void)
+{
+    return xorshift32(&m_backoff_rng);
+}
+
+static void * sim_realloc(void * p_ptr, size_t size)
+{
+    void * p_new = realloc(p_ptr, size);
+
+    if (p_new == NULL)
+    {
+        fprintf(stderr, "Out of memory\n");
+        exit(EXIT_FAILURE);
+    }
+
+    return p_new;
+}
+
+static uint64_t exponential_draw(double mean_us)
+{
+    double u = ((double)xorshift32(&m_traffic_rng) + 1.0) / 4294967296.0;
+
+    return (uint64_t)(-log(u) * mean_us) + 1U;
+}
+
+static uint64_t frame_time(const uint8_t * p_psdu)
+{
+    return SIM_SHR_PHR_TIME + (uint64_t)p_psdu[PHR_OFFSET] * SIM_OCTET_TIME;
+}
+
+static bool frame_ack_requested(const uint8_t * p_psdu)
+{
+    return (p_psdu[ACK_REQUEST_OFFSET] & ACK_REQUEST_BIT) != 0U;
+}
+
+/**
+ * @brief Builds a frame with short addressing and a compressed PAN ID.
+ */
+static void frame_build(sim_node_t * p_node, sim_frame_t * p_frame, uint8_t length)
+{
+    uint32_t         draw = xorshift32(&m_traffic_rng) % 100U;
+    sim_frame_kind_t kind;
+    uint16_t         dst;
+    uint8_t        * p  = p_frame->psdu;
+
+    kind = (draw < 5U) ? SIM_FRAME_COMMAND : (draw < 25U) ? SIM_FRAME_BROADCAST : SIM_FRAME_DATA_ACK;
+    dst  = (kind == SIM_FRAME_BROADCAST) ? 0xffffU :
+           p_node->destinations[xorshift32(&m_traffic_rng) % SIM_DESTINATIONS_NUM];
+
+    memset(p, 0, sizeof(p_frame->psdu));
+    p[PHR_OFFSET] = length;
+    p[1]          = ((kind == SIM_FRAME_COMMAND) ? FRAME_TYPE_COMMAND : FRAME_TYPE_DATA) |
+                    PAN_ID_COMPR_MASK;
+    p[1]         |= (kind == SIM_FRAME_BROADCAST) ? 0U : ACK_REQUEST_BIT;
+    p[2]          = DEST_ADDR_TYPE_SHORT | FRAME_VERSION_1 | SRC_ADDR_TYPE_SHORT;
+    p[3]          = (uint8_t)xorshift32(&m_traffic_rng);
+    p[4]          = 0xcdU;
+    p[5]          = 0xabU;
+    p[6]          = (uint8_t)dst;
+    p[7]          = (uint8_t)(dst >> 8);
+    p[8]          = (uint8_t)p_node->short_addr;
+    p[9]          = (uint8_t)(p_node->short_addr >> 8);
+}
+
+static void interval_add(uint64_t start, uint64_t end, uint32_t owner)
+{
+    if (m_intervals_len == m_intervals_cap)
+    {
+        m_intervals_cap = (m_intervals_cap == 0U) ? 1024U : (2U * m_intervals_cap);
+        mp_intervals    = sim_realloc(mp_intervals, m_intervals_cap * sizeof(*mp_intervals));
+    }
+
+    mp_intervals[m_intervals_len++] = (sim_interval_t){start, end, owner};
+}
+
+/**
+ * @brief Checks if any transmission other than the ones of @p owner overlaps [start, end).
+ */
+static bool interval_overlaps(uint64_t start, uint64_t end, uint32_t owner)
+{
+    for (size_t i = m_intervals_len; i > 0U; i--)
+    {
+        const sim_interval_t * p_interval = &mp_intervals[i - 1U];
+
+        if ((p_interval->owner != owner) && (p_interval->start < end) && (p_interval->end > start))
+        {
+            return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Drops intervals that cannot overlap with anything at or after @p now.
+ */
+static void intervals_prune(uint64_t now)
+{
+    size_t kept = 0U;
+
+    for (size_t i = 0U; i < m_intervals_len; i++)
+    {
+        if (mp_intervals[i].end + (2U * MAX_PACKET_SIZE * SIM_OCTET_TIME) > now)
+        {
+            mp_intervals[kept++] = mp_intervals[i];
+        }
+    }
+
+    m_intervals_len = kept;
+}
+
+static void latency_record(sim_result_t * p_result, uint64_t latency)
+{
+    if (p_result->delivered > p_result->latency_cap)
+    {
+        p_result->latency_cap = (p_result->latency_cap == 0U) ? 4096U :
+                                (2U * p_result->latency_cap);
+        p_result->p_latency = sim_realloc(p_result->p_latency,
+                                          p_result->latency_cap * sizeof(*p_result->p_latency));
+    }
+
+    p_result->p_latency[p_result->delivered - 1U] =
+        (latency > UINT32_MAX) ? UINT32_MAX : (uint32_t)latency;
+}
+
+static void backoff_schedule(sim_node_t * p_node, uint64_t now)
+{
+    uint16_t periods = p_node->policy.periods_get(p_node->policy.p_context, &p_node->state);
+
+    p_node->step       = SIM_NODE_BACKOFF;
+    p_node->next_event = now + (uint64_t)periods * UNIT_BACKOFF_PERIOD + CCA_TIME;
+}
+
+static void csma_ca_start(sim_node_t * p_node, uint64_t now)
+{
+    if (p_node->queue_len == 0U)
+    {
+        p_node->step       = SIM_NODE_IDLE;
+        p_node->next_event = SIM_TIME_NEVER;
+        return;
+    }
+
+    p_node->state.p_frame      = p_node->queue[p_node->queue_head].psdu;
+    p_node->state.min_be       = NRF_802154_CSMA_CA_MIN_BE_DEFAULT;
+    p_node->state.max_be       = NRF_802154_CSMA_CA_MAX_BE_DEFAULT;
+    p_node->state.max_backoffs = NRF_802154_CSMA_CA_MAX_CSMA_BACKOFFS_DEFAULT;
+    p_node->state.nb           = 0U;
+    p_node->state.be           = 0U;
+    p_node->owner              = ++m_next_owner;
+
+    p_node->policy.start(p_node->policy.p_context, &p_node->state);
+    backoff_schedule(p_node, now);
+}
+
+static void frame_finish(sim_node_t * p_node, uint64_t now)
+{
+    p_node->queue_head = (p_node->queue_head + 1U) % SIM_QUEUE_SIZE;
+    p_node->queue_len--;
+
+    csma_ca_start(p_node, now);
+}
+
+static void policy_finished(sim_node_t * p_node, bool channel_idle)
+{
+    if (p_node->policy.finished != NULL)
+    {
+        p_node->policy.finished(p_node->policy.p_context, &p_node->state, channel_idle);
+    }
+}
+
+static void node_step(sim_node_t * p_node, uint64_t now, sim_result_t * p_result)
+{
+    const uint8_t * p_psdu = p_node->queue[p_node->queue_head].psdu;
+
+    switch (p_node->step)
+    {
+        case SIM_NODE_BACKOFF:
+            p_result->ccas++;
+
+            if (!interval_overlaps(now - CCA_TIME, now, 0U))
+            {
+                policy_finished(p_node, true);
+                p_node->step       = SIM_NODE_TX;
+                p_node->next_event = now + TURNAROUND_TIME;
+                break;
+            }
+
+            p_result->ccas_busy++;
+            p_node->state.nb++;
+
+            if (p_node->state.nb > p_node->state.max_backoffs)
+            {
+                policy_finished(p_node, false);
+                p_result->cafs++;
+                frame_finish(p_node, now);
+            }
+            else
+            {
+                p_node->policy.busy(p_node->policy.p_context, &p_node->state);
+                backoff_schedule(p_node, now);
+            }
+            break;
+
+        case SIM_NODE_TX:
+        {
+            uint64_t end = now + frame_time(p_psdu);
+
+            p_node->tx_start = now;
+            interval_add(now, end, p_node->owner);
+
+            if (frame_ack_requested(p_psdu))
+            {
+                // The Ack is on air after the turnaround even if the receiver could not decode
+                // the frame, which keeps the model independent of the order of collisions.
+                interval_add(end + TURNAROUND_TIME, end + TURNAROUND_TIME + SIM_ACK_TIME,
+                             p_node->owner);
+                end += TURNAROUND_TIME + SIM_ACK_TIME;
+            }
+
+            p_node->step       = SIM_NODE_WAIT;
+            p_node->next_event = end;
+            break;
+        }
+
+        case SIM_NODE_WAIT:
+        {
+            uint64_t tx_end    = p_node->tx_start + frame_time(p_psdu);
+            bool     collision = interval_overlaps(p_node->tx_start, tx_end, p_node->owner);
+
+            if (frame_ack_requested(p_psdu))
+            {
+                collision |= interval_overlaps(now - SIM_ACK_TIME, now, p_node->owner);
+            }
+
+            if (collision)
+            {
+                p_result->collided++;
+            }
+            else
+            {
+                p_result->delivered++;
+                p_result->bytes += p_psdu[PHR_OFFSET];
+                latency_record(p_result, now - p_node->queue[p_node->queue_head].arrival);
+            }
+
+            frame_finish(p_node, now);
+            break;
+        }
+
+        default:
+            break;
+    }
+}
+
+static void node_arrival(sim_node_t * p_node, uint64_t now, double mean_us, uint8_t length,
+                         sim_result_t * p_result)
+{
+    p_result->offered++;
+    p_node->next_arrival = now + exponential_draw(mean_us);
+
+    if (p_node->queue_len == SIM_QUEUE_SIZE)
+    {
+        p_result->overflows++;
+        return;
+    }
+
+    sim_frame_t * p_frame =
+        &p_node->queue[(p_node->queue_head + p_node->queue_len) % SIM_QUEUE_SIZE];
+
+    frame_build(p_node, p_frame, length);
+    p_frame->arrival = now;
+    p_node->queue_len++;
+
+    if (p_node->step == SIM_NODE_IDLE)
+    {
+        csma_ca_start(p_node, now);
+    }
+}
+
+static void node_init(sim_node_t                           * p_node,
+                      uint32_t                               index,
+                      uint32_t                               nodes,
+                      nrf_802154_csma_ca_backoff_policy_id_t policy,
+                      double                                 mean_us)
+{
+    memset(p_node, 0, sizeof(*p_node));
+
+    // Each node gets a private copy of the policy so that its history is its own.
+    p_node->policy = *nrf_802154_csma_ca_backoff_policy_builtin_get(policy);
+
+    if (policy == NRF_802154_CSMA_CA_BACKOFF_POLICY_ADAPTIVE)
+    {
+        p_node->policy.p_context = &p_node->adaptive_ctx;
+    }
+    else if (policy == NRF_802154_CSMA_CA_BACKOFF_POLICY_DESTINATION)
+    {
+        p_node->policy.p_context        = &p_node->destination_ctx;
+        p_node->destination_ctx.current = -1;
+    }
+
+    p_node->short_addr = (uint16_t)(0x0100U + index);
+
+    for (uint32_t i = 0U; i < SIM_DESTINATIONS_NUM; i++)
+    {
+        p_node->destinations[i] =
+            (uint16_t)(0x0100U + ((index + 1U + xorshift32(&m_traffic_rng) % (nodes - 1U)) % nodes));
+    }
+
+    p_node->step         = SIM_NODE_IDLE;
+    p_node->next_event   = SIM_TIME_NEVER;
+    p_node->next_arrival = exponential_draw(mean_us);
+}
+
+static void simulate(nrf_802154_csma_ca_backoff_policy_id_t policy,
+                     uint32_t                               nodes,
+                     double                                 rate,
+                     uint8_t                                length,
+                     uint64_t                               duration_us,
+                     uint32_t                               seed,
+                     sim_result_t                         * p_result)
+{
+    double   mean_us    = 1e6 / rate;
+    uint64_t next_prune = 1000000U;
+
+    m_backoff_rng   = seed;
+    m_traffic_rng   = seed;
+    m_intervals_len = 0U;
+    m_next_owner    = 0U;
+
+    for (uint32_t n = 0U; n < nodes; n++)
+    {
+        node_init(&m_nodes[n], n, nodes, policy, mean_us);
+    }
+
+    while (true)
+    {
+        sim_node_t * p_next  = NULL;
+        uint64_t     now     = SIM_TIME_NEVER;
+        bool         arrival = false;
+
+        // Steps of the CSMA-CA procedure go before arrivals at the same time, and lower node
+        // indices go first, so that the order of events is fully deterministic.
+        for (uint32_t n = 0U; n < nodes; n++)
+        {
+            if (m_nodes[n].next_event < now)
+            {
+                now     = m_nodes[n].next_event;
+                p_next  = &m_nodes[n];
+                arrival = false;
+            }
+        }
+
+        for (uint32_t n = 0U; n < nodes; n++)
+        {
+            if (m_nodes[n].next_arrival < now)
+            {
+                now     = m_nodes[n].next_arrival;
+                p_next  = &m_nodes[n];
+                arrival = true;
+            }
+        }
+
+        if (now >= duration_us)
+        {
+            break;
+        }
+
+        if (now >= next_prune)
+        {
+            intervals_prune(now);
+            next_prune = now + 1000000U;
+        }
+
+        if (arrival)
+        {
+            node_arrival(p_next, now, mean_us, length, p_result);
+        }
+        else
+        {
+            node_step(p_next, now, p_result);
+        }
+    }
+}
+
+static int latency_compare(const void * p_a, const void * p_b)
+{
+    uint32_t a = *(const uint32_t *)p_a;
+    uint32_t b = *(const uint32_t *)p_b;
+
+    return (a > b) - (a < b);
+}
+
+static double latency_percentile(const sim_result_t * p_result, uint32_t percent)
+{
+    if (p_result->delivered == 0U)
+    {
+        return 0.0;
+    }
+
+    size_t index = (size_t)((p_result->delivered * percent + 99U) / 100U);
+
+    return p_result->p_latency[(index > 0U) ? (index - 1U) : 0U] / 1000.0;
+}
+
+static void result_print(const char         * p_name,
+                         uint32_t             nodes,
+                         uint64_t             duration_us,
+                         const sim_result_t * p_result)
+{
+    uint64_t attempted  = p_result->delivered + p_result->collided;
+    uint64_t processed  = attempted + p_result->cafs;
+    double   throughput = (double)p_result->bytes * 8.0 * 1000.0 / (double)duration_us;
+
+    qsort(p_result->p_latency, p_result->delivered, sizeof(*p_result->p_latency),
+          latency_compare);
+
+    printf("%-12s %5u %9llu %10.2f %7.2f%% %7.2f%% %7.2f%% %8.2f %8.2f %8.2f\n",
+           p_name,
+           nodes,
+           (unsigned long long)p_result->offered,
+           throughput,
+           (attempted == 0U) ? 0.0 : 100.0 * p_result->collided / attempted,
+           (processed == 0U) ? 0.0 : 100.0 * p_result->cafs / processed,
+           (p_result->ccas == 0U) ? 0.0 : 100.0 * p_result->ccas_busy / p_result->ccas,
+           latency_percentile(p_result, 50U),
+           latency_percentile(p_result, 90U),
+           latency_percentile(p_result, 99U));
+}
+
+static void usage(const char * p_program)
+{
+    fprintf(stderr,
+            "Usage: %s [-n <nodes>[,<nodes>...]] [-r <frames/s per node>] [-l <psdu length>]\n"
+            "       [-t <seconds>] [-s <seed>] [-p ieee|adaptive|priority|destination|all]\n",
+            p_program);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char ** argv)
+{
+    const char * p_nodes  = "2,5,10,20,40";
+    const char * p_policy = "all";
+    double       rate     = 10.0;
+    double       seconds  = 60.0;
+    uint32_t     seed     = 1U;
+    unsigned     length   = 60U;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((i + 1 >= argc) || (argv[i][0] != '-'))
+        {
+            usage(argv[0]);
+        }
+
+        switch (argv[i][1])
+        {
+            case 'n': p_nodes  = argv[++i];                              break;
+            case 'r': rate     = strtod(argv[++i], NULL);                break;
+            case 'l': length   = (unsigned)strtoul(argv[++i], NULL, 0);  break;
+            case 't': seconds  = strtod(argv[++i], NULL);                break;
+            case 's': seed     = (uint32_t)strtoul(argv[++i], NULL, 0);  break;
+            case 'p': p_policy = argv[++i];                              break;
+            default:  usage(argv[0]);
+        }
+    }
+
+    if ((rate <= 0.0) || (seconds <= 0.0) || (seed == 0U) ||
+        (length < 12U) || (length > MAX_PACKET_SIZE))
+    {
+        fprintf(stderr, "Invalid arguments: rate and time must be positive, seed non-zero, "
+                        "length between 12 and %u\n", MAX_PACKET_SIZE);
+        return EXIT_FAILURE;
+    }
+
+    printf("%-12s %5s %9s %10s %8s %8s %8s %8s %8s %8s\n",
+           "policy", "nodes", "offered", "kbit/s", "coll", "caf", "busy",
+           "p50[ms]", "p90[ms]", "p99[ms]");
+
+    for (size_t p = 0U; p < sizeof(m_policy_names) / sizeof(m_policy_names[0]); p++)
+    {
+        if ((strcmp(p_policy, "all") != 0) && (strcmp(p_policy, m_policy_names[p].p_name) != 0))
+        {
+            continue;
+        }
+
+        for (const char * p_list = p_nodes; *p_list != '\0'; )
+        {
+            char        * p_end;
+            unsigned long nodes       = strtoul(p_list, &p_end, 0);
+            sim_result_t  result      = {0};
+            uint64_t      duration_us = (uint64_t)(seconds * 1e6);
+
+            if ((p_end == p_list) || (nodes < 2U) || (nodes > SIM_MAX_NODES))
+            {
+                fprintf(stderr, "Invalid number of nodes, allowed 2 to %u\n", SIM_MAX_NODES);
+                return EXIT_FAILURE;
+            }
+
+            simulate(m_policy_names[p].id, (uint32_t)nodes, rate, (uint8_t)length, duration_us,
+                     seed, &result);
+            result_print(m_policy_names[p].p_name, (uint32_t)nodes, duration_us, &result);
+            free(result.p_latency);
+
+            p_list = (*p_end == ',') ? (p_end + 1) : p_end;
+        }
+    }
+
+    free(mp_intervals);
+
+    return EXIT_SUCCESS;
+}
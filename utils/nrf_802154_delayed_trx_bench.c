@@ -0,0 +1,582 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run scaling benchmark and model test of the delayed RX slots.
+ *
+ * The program links nrf_802154_delayed_trx.c and nrf_802154_queue.c unchanged and replaces
+ * the radio scheduler, the timer and the request and notification modules with stubs that accept
+ * every request. It runs in two parts:
+ *
+ * - benchmark: schedules all @ref NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS reception windows, looks up
+ *              the nearest window a few times and cancels the windows in a random order,
+ * - model:     performs random schedule, cancel, start and abort operations on a small set of
+ *              identifiers and compares every result with a reference model, including
+ *              the nearest window reported by the module.
+ *
+ * Build it several times with different numbers of slots, including more than 255, to see how
+ * the cost of one schedule-and-cancel pair scales.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -DNRF_802154_USE_RAW_API=1 -DNRF_802154_DELAYED_TRX_ENABLED=1 \
+ *         -DNRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS=<slots> \
+ *         -o delayed_trx_bench ../../utils/nrf_802154_delayed_trx_bench.c \
+ *         driver/src/mac_features/nrf_802154_delayed_trx.c driver/src/nrf_802154_queue.c \
+ *         -Icommon/include -Idriver/include -Idriver/src -Idriver/src/mac_features \
+ *         -Isl/include -Isl/sl_opensource/include \
+ *         -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis>
+ *
+ * Usage:
+ *
+ *     delayed_trx_bench [-r <benchmark rounds>] [-n <model operations>] [-s <seed>]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_notification.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_tx_power.h"
+#include "nrf_802154_types_internal.h"
+#include "mac_features/nrf_802154_delayed_trx.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/nrf_802154_periodic_rx.h"
+#include "rsch/nrf_802154_rsch.h"
+#include "nrf_802154_sl_timer.h"
+
+#define BENCH_SLOTS       NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS
+#define BENCH_TS_IDS      (1UL << 20) ///< Number of timeslot identifiers tracked by the scheduler stub.
+#define BENCH_TIMERS      8192U       ///< Capacity of the timer stub.
+#define BENCH_MODEL_IDS   64U         ///< Reception window identifiers used by the model test are 1..63.
+#define BENCH_CHANNEL     11U
+#define BENCH_START_TIME  1000000U
+
+#define CHECK(cond)                                                         \
+    do                                                                      \
+    {                                                                       \
+        if (!(cond))                                                        \
+        {                                                                   \
+            printf("  check failed at line %d: %s\n", __LINE__, #cond); \
+            m_failures++;                                                   \
+        }                                                                   \
+    }                                                                       \
+    while (0)
+
+/**
+ * @brief States of a reception window in the reference model.
+ */
+typedef enum
+{
+    MODEL_IDLE,    ///< The window is not scheduled.
+    MODEL_PENDING, ///< The window is scheduled and has not started.
+    MODEL_ONGOING, ///< The window has started.
+} model_state_t;
+
+static uint32_t m_failures;                       ///< Number of failed checks.
+static uint64_t m_now;                            ///< Current time, in microseconds.
+
+static bool                           m_ts_on[BENCH_TS_IDS];
+static uint64_t                       m_ts_time[BENCH_TS_IDS];
+static rsch_dly_ts_started_callback_t m_ts_callback[BENCH_TS_IDS];
+
+static nrf_802154_sl_timer_t * mp_timers[BENCH_TIMERS];
+static uint32_t                m_timers_num;
+
+static model_state_t m_model_state[BENCH_MODEL_IDS];
+static uint64_t      m_model_time[BENCH_MODEL_IDS];
+static uint32_t      m_model_timeout[BENCH_MODEL_IDS];
+
+static uint32_t xorshift32(uint32_t * p_state)
+{
+    uint32_t x = *p_state;
+
+    x        ^= x << 13;
+    x        ^= x >> 17;
+    x        ^= x << 5;
+    *p_state  = x;
+
+    return x;
+}
+
+static double seconds_get(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (double)ts.tv_sec + (double)ts.tv_nsec * 1e-9;
+}
+
+/***************************************************************************************************
+ * @section Stubs of the modules around delayed operations
+ **************************************************************************************************/
+
+bool nrf_802154_rsch_delayed_timeslot_request(const rsch_dly_ts_param_t * p_dly_ts_param)
+{
+    if ((p_dly_ts_param->id >= BENCH_TS_IDS) || m_ts_on[p_dly_ts_param->id])
+    {
+        return false;
+    }
+
+    m_ts_on[p_dly_ts_param->id]       = true;
+    m_ts_time[p_dly_ts_param->id]     = p_dly_ts_param->trigger_time;
+    m_ts_callback[p_dly_ts_param->id] = p_dly_ts_param->started_callback;
+
+    return true;
+}
+
+bool nrf_802154_rsch_delayed_timeslot_cancel(rsch_dly_ts_id_t dly_ts_id, bool handler)
+{
+    (void)handler;
+
+    if ((dly_ts_id >= BENCH_TS_IDS) || !m_ts_on[dly_ts_id])
+    {
+        return false;
+    }
+
+    m_ts_on[dly_ts_id] = false;
+
+    return true;
+}
+
+bool nrf_802154_rsch_delayed_timeslot_time_to_start_get(rsch_dly_ts_id_t dly_ts_id,
+                                                        uint64_t       * p_time_to_start)
+{
+    if ((dly_ts_id >= BENCH_TS_IDS) || !m_ts_on[dly_ts_id])
+    {
+        return false;
+    }
+
+    *p_time_to_start = m_ts_time[dly_ts_id] - m_now;
+
+    return true;
+}
+
+static int32_t timer_find(const nrf_802154_sl_timer_t * p_timer)
+{
+    for (uint32_t i = 0U; i < m_timers_num; i++)
+    {
+        if (mp_timers[i] == p_timer)
+        {
+            return (int32_t)i;
+        }
+    }
+
+    return -1;
+}
+
+void nrf_802154_sl_timer_init(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+}
+
+void nrf_802154_sl_timer_deinit(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+}
+
+nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_add(nrf_802154_sl_timer_t * p_timer)
+{
+    if ((timer_find(p_timer) < 0) && (m_timers_num < BENCH_TIMERS))
+    {
+        mp_timers[m_timers_num++] = p_timer;
+    }
+
+    return NRF_802154_SL_TIMER_RET_SUCCESS;
+}
+
+nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_remove(nrf_802154_sl_timer_t * p_timer)
+{
+    int32_t idx = timer_find(p_timer);
+
+    if (idx < 0)
+    {
+        return NRF_802154_SL_TIMER_RET_INACTIVE;
+    }
+
+    mp_timers[idx] = mp_timers[--m_timers_num];
+
+    return NRF_802154_SL_TIMER_RET_SUCCESS;
+}
+
+uint64_t nrf_802154_sl_timer_current_time_get(void)
+{
+    return m_now;
+}
+
+bool nrf_802154_notify_receive_failed(nrf_802154_rx_error_t error,
+                                      uint32_t              id,
+                                      bool                  allow_drop)
+{
+    (void)error;
+    (void)id;
+    (void)allow_drop;
+
+    return true;
+}
+
+void nrf_802154_notify_transmit_failed(uint8_t                                   * p_frame,
+                                       nrf_802154_tx_error_t                       error,
+                                       const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    (void)p_frame;
+    (void)error;
+    (void)p_metadata;
+}
+
+bool nrf_802154_request_receive(nrf_802154_term_t              term_lvl,
+                                req_originator_t               req_orig,
+                                nrf_802154_notification_func_t notify_function,
+                                bool                           notify_abort,
+                                uint32_t                       id)
+{
+    (void)term_lvl;
+    (void)req_orig;
+    (void)notify_abort;
+    (void)id;
+
+    notify_function(true);
+
+    return true;
+}
+
+bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
+                                 req_originator_t               req_orig,
+                                 uint8_t                      * p_data,
+                                 nrf_802154_transmit_params_t * p_params,
+                                 nrf_802154_notification_func_t notify_function)
+{
+    (void)term_lvl;
+    (void)req_orig;
+    (void)p_data;
+    (void)p_params;
+    (void)notify_function;
+
+    return true;
+}
+
+bool nrf_802154_request_sleep(nrf_802154_term_t term_lvl)
+{
+    (void)term_lvl;
+
+    return true;
+}
+
+bool nrf_802154_request_channel_update(req_originator_t req_orig)
+{
+    (void)req_orig;
+
+    return true;
+}
+
+bool nrf_802154_periodic_rx_window_ended(uint32_t id, nrf_802154_rx_error_t error)
+{
+    (void)id;
+    (void)error;
+
+    return false;
+}
+
+uint8_t nrf_802154_pib_channel_get(void)
+{
+    return BENCH_CHANNEL;
+}
+
+void nrf_802154_pib_channel_set(uint8_t channel)
+{
+    (void)channel;
+}
+
+bool nrf_802154_pib_rx_on_when_idle_get(void)
+{
+    return false;
+}
+
+bool nrf_802154_frame_parser_data_init(const uint8_t                  * p_frame,
+                                       uint8_t                          valid_data_len,
+                                       nrf_802154_frame_parser_level_t  requested_parse_level,
+                                       nrf_802154_frame_parser_data_t * p_parser_data)
+{
+    (void)p_frame;
+    (void)valid_data_len;
+    (void)requested_parse_level;
+    (void)p_parser_data;
+
+    return false;
+}
+
+int8_t nrf_802154_tx_power_convert_metadata_to_tx_power_split(
+    uint8_t                                 channel,
+    nrf_802154_tx_power_metadata_t          tx_power,
+    nrf_802154_fal_tx_power_split_t * const p_tx_power_split)
+{
+    (void)channel;
+    (void)tx_power;
+    (void)p_tx_power_split;
+
+    return 0;
+}
+
+void nrf_802154_assert_handler(void)
+{
+    printf("  driver assertion failed\n");
+    abort();
+}
+
+/***************************************************************************************************
+ * @section Benchmark and model test
+ **************************************************************************************************/
+
+static void benchmark(uint32_t rounds, uint32_t seed)
+{
+    static uint32_t ids[BENCH_SLOTS];
+    uint32_t        rng      = seed;
+    uint64_t        checksum = 0U;
+    double          start    = seconds_get();
+
+    for (uint32_t r = 0U; r < rounds; r++)
+    {
+        for (uint32_t i = 0U; i < BENCH_SLOTS; i++)
+        {
+            ids[i] = 1U + ((r * BENCH_SLOTS + i) % (BENCH_TS_IDS - 1U));
+            CHECK(nrf_802154_delayed_trx_receive(m_now + 10000U + (xorshift32(&rng) % 1000000U),
+                                                 1000U,
+                                                 BENCH_CHANNEL,
+                                                 ids[i]));
+        }
+
+        for (uint32_t i = 0U; i < 16U; i++)
+        {
+            uint32_t midpoint;
+
+            if (nrf_802154_delayed_trx_nearest_drx_time_to_midpoint_get(&midpoint))
+            {
+                checksum += midpoint;
+            }
+        }
+
+        for (uint32_t i = BENCH_SLOTS - 1U; i > 0U; i--)
+        {
+            uint32_t j   = xorshift32(&rng) % (i + 1U);
+            uint32_t tmp = ids[i];
+
+            ids[i] = ids[j];
+            ids[j] = tmp;
+        }
+
+        for (uint32_t i = 0U; i < BENCH_SLOTS; i++)
+        {
+            CHECK(nrf_802154_delayed_trx_receive_cancel(ids[i]));
+        }
+    }
+
+    double elapsed = seconds_get() - start;
+
+    printf("benchmark: %u slots, %.1f ns per schedule and cancel (checksum %llu)\n",
+           (unsigned)BENCH_SLOTS,
+           elapsed * 1e9 / ((double)rounds * BENCH_SLOTS),
+           (unsigned long long)checksum);
+}
+
+static int32_t model_nearest_get(void)
+{
+    int32_t best = -1;
+
+    for (uint32_t i = 0U; i < BENCH_MODEL_IDS; i++)
+    {
+        if ((m_model_state[i] == MODEL_PENDING) &&
+            ((best < 0) || (m_model_time[i] < m_model_time[best])))
+        {
+            best = (int32_t)i;
+        }
+    }
+
+    return best;
+}
+
+static void model_ongoing_clear(void)
+{
+    for (uint32_t i = 0U; i < BENCH_MODEL_IDS; i++)
+    {
+        if (m_model_state[i] == MODEL_ONGOING)
+        {
+            m_model_state[i] = MODEL_IDLE;
+        }
+    }
+}
+
+static void model_test(uint32_t operations, uint32_t seed)
+{
+    uint32_t rng      = seed;
+    uint32_t failures = m_failures;
+
+    for (uint32_t n = 0U; (n < operations) && (m_failures == failures); n++)
+    {
+        uint32_t id      = 1U + (xorshift32(&rng) % (BENCH_MODEL_IDS - 1U));
+        uint32_t op      = xorshift32(&rng) % 10U;
+        uint32_t used    = 0U;
+        int32_t  nearest = model_nearest_get();
+
+        for (uint32_t i = 0U; i < BENCH_MODEL_IDS; i++)
+        {
+            used += (m_model_state[i] != MODEL_IDLE) ? 1U : 0U;
+        }
+
+        if (op < 5U)
+        {
+            uint64_t time     = m_now + 1000U + (xorshift32(&rng) % 100000U);
+            uint32_t timeout  = xorshift32(&rng) % 5000U;
+            bool     expected = (m_model_state[id] == MODEL_IDLE) && (used < BENCH_SLOTS);
+
+            CHECK(nrf_802154_delayed_trx_receive(time, timeout, BENCH_CHANNEL, id) == expected);
+
+            if (expected)
+            {
+                m_model_state[id]   = MODEL_PENDING;
+                m_model_time[id]    = time;
+                m_model_timeout[id] = timeout;
+            }
+        }
+        else if (op < 7U)
+        {
+            CHECK(nrf_802154_delayed_trx_receive_cancel(id) == (m_model_state[id] != MODEL_IDLE));
+            m_model_state[id] = MODEL_IDLE;
+        }
+        else if (op < 9U)
+        {
+            if (nearest >= 0)
+            {
+                m_ts_callback[nearest]((rsch_dly_ts_id_t)nearest);
+                model_ongoing_clear();
+                m_model_state[nearest] = MODEL_ONGOING;
+            }
+        }
+        else
+        {
+            nrf_802154_delayed_trx_abort(NRF_802154_TERM_802154, REQ_ORIG_HIGHER_LAYER);
+            model_ongoing_clear();
+        }
+
+        uint32_t midpoint;
+        bool     found = nrf_802154_delayed_trx_nearest_drx_time_to_midpoint_get(&midpoint);
+
+        nearest = model_nearest_get();
+        CHECK(found == (nearest >= 0));
+
+        if (found && (nearest >= 0))
+        {
+            bool matched = false;
+
+            // Windows starting at the same time may be reported in any order.
+            for (uint32_t i = 0U; i < BENCH_MODEL_IDS; i++)
+            {
+                if ((m_model_state[i] == MODEL_PENDING) &&
+                    (m_model_time[i] == m_model_time[nearest]) &&
+                    ((uint32_t)(m_model_time[i] - m_now) + m_model_timeout[i] / 2U == midpoint))
+                {
+                    matched = true;
+                }
+            }
+
+            CHECK(matched);
+        }
+    }
+
+    printf("model: %u operations %s\n", (unsigned)operations, (m_failures == failures) ? "ok" : "FAILED");
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t rounds     = 2000U;
+    uint32_t operations = 2000000U;
+    uint32_t seed       = 0x2545f491U;
+    int      opt        = 1;
+
+    while (opt + 1 < argc)
+    {
+        unsigned long value = strtoul(argv[opt + 1], NULL, 0);
+
+        if (strcmp(argv[opt], "-r") == 0)
+        {
+            rounds = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-n") == 0)
+        {
+            operations = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-s") == 0)
+        {
+            seed = (uint32_t)value;
+        }
+        else
+        {
+            break;
+        }
+
+        opt += 2;
+    }
+
+    if ((opt != argc) || (seed == 0U))
+    {
+        fprintf(stderr,
+                "Usage: %s [-r <benchmark rounds>] [-n <model operations>] [-s <seed>]\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    m_now = BENCH_START_TIME;
+    nrf_802154_delayed_trx_init();
+
+    benchmark(rounds, seed);
+    model_test(operations, seed);
+
+    nrf_802154_delayed_trx_deinit();
+
+    if (m_failures != 0U)
+    {
+        printf("\n%u checks failed\n", (unsigned)m_failures);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
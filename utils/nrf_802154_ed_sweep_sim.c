@@ -0,0 +1,861 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run interference simulator for the energy detection sweep.
+ *
+ * The simulator links nrf_802154_ed_sweep.c unchanged and replaces the rest of the driver with
+ * a model of the energy detection loop of the core: every call of the radio measures up to
+ * @ref NRF_802154_ED_SWEEP_SAMPLE_TIME_US, split into iterations of 128 us, and returns the peak of
+ * its iterations. A call takes the ramp-up time unless the receiver was left enabled on the same
+ * channel, which the sweep does between its samples. The timeslot is assumed never to end. Two
+ * ways of surveying the channels are compared:
+ *
+ * - sweep:    the higher layer requests a single energy detection sweep and receives the statistics
+ *             of all the channels,
+ * - baseline: the higher layer sets each channel and requests an energy detection for the dwell
+ *             time, once per channel and iteration of the sweep, and averages the reported peaks.
+ *
+ * The higher layer reacts to a notification after the notification latency and its request
+ * reaches the driver after the request latency. Setting the channel is a request that waits for
+ * its response. The local profile models a higher layer on the radio core, the serialized profile
+ * models a higher layer on the application core. There, the single call of
+ * nrf_802154_energy_detected that ends the sweep is serialized into one message per measured
+ * channel followed by a message closing the sweep, so a sweep of all the 16 channels takes
+ * 17 messages. The messages column counts the messages received by the higher layer.
+ *
+ * The interference is synthetic and is drawn from a seeded hash of time, so both ways of surveying
+ * face the same interference at the same time:
+ *
+ * - two Wi-Fi access points sending bursts on channels 11-14 and 16-19, stronger in the middle of
+ *   their bands,
+ * - a microwave oven on channels 20-23, on for 10 ms every 20 ms,
+ * - Bluetooth LE slots of 625 us hitting a random channel,
+ * - a strong beacon on channel 15 once every 100 ms.
+ *
+ * The power of every iteration is the sum of the sources weighted by their overlap with
+ * the iteration, over a noise floor. The channels are ranked by the time they are busy over
+ * the whole survey, and then by their mean power, which neither way of surveying can observe
+ * directly. The rank of the channel picked from the sweep must not exceed @ref SIM_RANK_MAX: only
+ * channels 15 and 24-26 are free of Wi-Fi and the microwave oven, and they differ by less than
+ * a single survey can tell apart.
+ *
+ * Besides the statistics, every run checks the result of the sweep against the samples passed to
+ * the module: the number of samples, the histogram, the maximum, the mean and the percentile,
+ * which must be the upper edge of the bin holding the exact percentile or the maximum if lower.
+ * The channels outside the mask must be left empty. The limits of the sweep parameters are checked
+ * too. The program exits with a failure if any check fails.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -DNRF_802154_ED_SWEEP_ENABLED=1 -DNRF_802154_USE_RAW_API=1 \
+ *         -o ed_sweep_sim ../../utils/nrf_802154_ed_sweep_sim.c \
+ *         driver/src/mac_features/nrf_802154_ed_sweep.c \
+ *         -Icommon/include -Idriver/include -Idriver/src -Idriver/src/mac_features \
+ *         -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis> -lm
+ *
+ * Usage:
+ *
+ *     ed_sweep_sim [-d <dwell time [us]>] [-i <iterations>] [-m <channel mask>] [-s <seed>]
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_types.h"
+#include "mac_features/nrf_802154_ed_sweep.h"
+
+#define SIM_CHANNEL_MIN    11U
+#define SIM_CHANNEL_MAX    26U
+#define SIM_ITER_DURATION  128U ///< Duration of a single energy detection iteration, in microseconds.
+#define SIM_SAMPLE_ITERS   ((NRF_802154_ED_SWEEP_SAMPLE_TIME_US < SIM_ITER_DURATION) ? 1U : \
+                            (NRF_802154_ED_SWEEP_SAMPLE_TIME_US / SIM_ITER_DURATION))
+#define SIM_RAMP_UP_TIME   40U  ///< Radio ramp-up time, in microseconds.
+#define SIM_ED_MIN_DBM     (-92)
+#define SIM_ED_MAX_DBM     (-29)
+#define SIM_NOISE_DBM      (-96.0)
+#define SIM_SAMPLES_MAX    UINT16_MAX
+#define SIM_BUSY_DBM       (-75.0) ///< Power above which a channel is busy.
+#define SIM_RANK_MAX       4U      ///< Worst rank accepted for the channel picked from the sweep.
+#define SIM_SOURCE_WIFI_LO 1U
+#define SIM_SOURCE_WIFI_HI 2U
+#define SIM_SOURCE_BLE     3U
+
+/**
+ * @brief Latencies between the driver and the higher layer.
+ */
+typedef struct
+{
+    const char * p_name;
+    uint32_t     notify_us;  ///< From a notification in the driver to the higher layer acting on it.
+    uint32_t     request_us; ///< From a request of the higher layer to the driver acting on it.
+    bool         serialized; ///< If the result of the sweep is serialized into Spinel messages.
+} sim_profile_t;
+
+/**
+ * @brief Outcome of a survey of the channels.
+ */
+typedef struct
+{
+    uint64_t duration;   ///< From the first request to the higher layer having all the results, in microseconds.
+    uint32_t messages;   ///< Notifications and responses received by the higher layer.
+    uint32_t ramp_ups;   ///< Ramp-ups of the radio.
+    uint8_t  channel;    ///< Channel picked by the higher layer.
+    uint64_t violations; ///< Failed checks.
+} sim_result_t;
+
+static const sim_profile_t m_profiles[] =
+{
+    {"local",      20U,  15U,  false},
+    {"serialized", 180U, 250U, true },
+};
+
+static uint32_t m_seed;
+static uint32_t m_rng; ///< State of the generator behind nrf_802154_random_get.
+static uint64_t m_now;
+static uint32_t m_ramp_ups;
+static int8_t * mp_samples[NRF_802154_ED_SWEEP_CHANNELS_NUM]; ///< Samples passed to the module.
+static uint32_t m_samples_len[NRF_802154_ED_SWEEP_CHANNELS_NUM];
+
+uint32_t nrf_802154_random_get(void)
+{
+    m_rng ^= m_rng << 13;
+    m_rng ^= m_rng >> 17;
+    m_rng ^= m_rng << 5;
+
+    return m_rng;
+}
+
+static uint32_t hash32(uint32_t source, uint64_t slot)
+{
+    uint32_t x = m_seed ^ (source * 0x9e3779b9U) ^ (uint32_t)slot ^ (uint32_t)(slot >> 32);
+
+    x ^= x >> 16;
+    x *= 0x7feb352dU;
+    x ^= x >> 15;
+    x *= 0x846ca68bU;
+    x ^= x >> 16;
+
+    return x;
+}
+
+/**
+ * @brief Returns the time a periodic source is on during the given window.
+ *
+ * The source is on for @p on_us at the start of every @p period_us slot in which it is active.
+ * A source with a non-zero @p source number is active in a slot with the probability
+ * @p active_pct, drawn from the hash of the slot.
+ */
+static uint32_t overlap_get(uint64_t start,
+                            uint32_t length,
+                            uint32_t period_us,
+                            uint32_t on_us,
+                            uint32_t source,
+                            uint32_t active_pct)
+{
+    uint32_t overlap = 0U;
+
+    for (uint64_t slot = start / period_us; slot * period_us < start + length; slot++)
+    {
+        uint64_t on_start = slot * period_us;
+        uint64_t on_end   = on_start + on_us;
+        uint64_t from     = (on_start > start) ? on_start : start;
+        uint64_t to       = (on_end < start + length) ? on_end : start + length;
+
+        if ((to <= from) || ((source != 0U) && ((hash32(source, slot) % 100U) >= active_pct)))
+        {
+            continue;
+        }
+
+        overlap += (uint32_t)(to - from);
+    }
+
+    return overlap;
+}
+
+/**
+ * @brief Returns the mean power on a channel during the given window, in milliwatts.
+ */
+static double power_get(uint8_t channel, uint64_t start, uint32_t length)
+{
+    double power = pow(10.0, SIM_NOISE_DBM / 10.0) * length;
+
+    if ((channel >= 11U) && (channel <= 14U))
+    {
+        double dbm = ((channel == 12U) || (channel == 13U)) ? -62.0 : -72.0;
+
+        power += pow(10.0, dbm / 10.0) *
+                 overlap_get(start, length, 250U, 250U, SIM_SOURCE_WIFI_LO, 15U);
+    }
+
+    if ((channel >= 16U) && (channel <= 19U))
+    {
+        double dbm = ((channel == 17U) || (channel == 18U)) ? -58.0 : -68.0;
+
+        power += pow(10.0, dbm / 10.0) *
+                 overlap_get(start, length, 250U, 250U, SIM_SOURCE_WIFI_HI, 40U);
+    }
+
+    if ((channel >= 20U) && (channel <= 23U))
+    {
+        power += pow(10.0, -66.0 / 10.0) * overlap_get(start, length, 20000U, 10000U, 0U, 100U);
+    }
+
+    if (channel == 15U)
+    {
+        power += pow(10.0, -48.0 / 10.0) * overlap_get(start, length, 100000U, 400U, 0U, 100U);
+    }
+
+    // Bluetooth LE hops, so a slot hits the channel only if it is the one drawn for the slot
+    for (uint64_t slot = start / 625U; slot * 625U < start + length; slot++)
+    {
+        uint32_t draw = hash32(SIM_SOURCE_BLE, slot);
+
+        if (((draw % 100U) < 50U) && (SIM_CHANNEL_MIN + (draw >> 8) % 16U == channel))
+        {
+            uint64_t from = (slot * 625U > start) ? slot * 625U : start;
+            uint64_t to   = ((slot + 1U) * 625U < start + length) ? (slot + 1U) * 625U :
+                            start + length;
+
+            power += pow(10.0, -72.0 / 10.0) * (double)(to - from);
+        }
+    }
+
+    return power / length;
+}
+
+/**
+ * @brief Returns the energy measured by the radio during a single iteration, in dBm.
+ */
+static int8_t iteration_measure(uint8_t channel, uint64_t start)
+{
+    double dbm = floor(10.0 * log10(power_get(channel, start, SIM_ITER_DURATION)) + 0.5);
+
+    if (dbm < SIM_ED_MIN_DBM)
+    {
+        dbm = SIM_ED_MIN_DBM;
+    }
+    else if (dbm > SIM_ED_MAX_DBM)
+    {
+        dbm = SIM_ED_MAX_DBM;
+    }
+
+    return (int8_t)dbm;
+}
+
+/**
+ * @brief Models a single energy detection of the radio.
+ *
+ * @param[in]  channel  Channel to measure.
+ * @param[in]  iters    Number of iterations to measure.
+ * @param[in]  ramp_up  If the receiver has to ramp up before the measurement.
+ *
+ * @returns  Peak of the measured iterations, in dBm.
+ */
+static int8_t radio_energy_detection(uint8_t channel, uint32_t iters, bool ramp_up)
+{
+    int8_t peak = SIM_ED_MIN_DBM;
+
+    if (ramp_up)
+    {
+        m_now += SIM_RAMP_UP_TIME;
+        m_ramp_ups++;
+    }
+
+    for (uint32_t i = 0U; i < iters; i++)
+    {
+        int8_t dbm = iteration_measure(channel, m_now);
+
+        peak   = (dbm > peak) ? dbm : peak;
+        m_now += SIM_ITER_DURATION;
+    }
+
+    return peak;
+}
+
+/**
+ * @brief Splits the energy detection time left, as done by the core.
+ *
+ * @returns  Number of iterations of the next energy detection of the radio.
+ */
+static uint32_t iters_next(uint32_t * p_time_left, bool sweep)
+{
+    uint32_t requested_iters = *p_time_left / SIM_ITER_DURATION;
+    uint32_t iters_max       = sweep ? SIM_SAMPLE_ITERS : UINT32_MAX;
+
+    if (requested_iters < iters_max)
+    {
+        *p_time_left = 0U;
+    }
+    else
+    {
+        *p_time_left   -= iters_max * SIM_ITER_DURATION;
+        requested_iters = iters_max;
+    }
+
+    return requested_iters;
+}
+
+/**
+ * @brief Models the energy detection sweep of the core.
+ *
+ * The receiver stays enabled between the samples and ramps up again only when the sweep moves to
+ * another channel.
+ */
+static const nrf_802154_ed_sweep_result_t * sweep_run(const nrf_802154_ed_sweep_params_t * p_params)
+{
+    nrf_802154_ed_sweep_start(p_params);
+
+    uint32_t time_left  = nrf_802154_ed_sweep_dwell_get();
+    bool     running    = true;
+    uint8_t  rx_channel = 0U;
+
+    while (running)
+    {
+        uint8_t channel = nrf_802154_ed_sweep_channel_get();
+        size_t  idx     = channel - SIM_CHANNEL_MIN;
+        int8_t  sample  = radio_energy_detection(channel,
+                                                 iters_next(&time_left, true),
+                                                 channel != rx_channel);
+
+        rx_channel = channel;
+
+        nrf_802154_ed_sweep_sample_add(sample);
+
+        if (m_samples_len[idx] < SIM_SAMPLES_MAX)
+        {
+            mp_samples[idx][m_samples_len[idx]++] = sample;
+        }
+
+        if (time_left < SIM_ITER_DURATION)
+        {
+            running   = nrf_802154_ed_sweep_channel_next();
+            time_left = nrf_802154_ed_sweep_dwell_get();
+        }
+    }
+
+    return nrf_802154_ed_sweep_result_get();
+}
+
+static int compare_int8(const void * p_a, const void * p_b)
+{
+    return *(const int8_t *)p_a - *(const int8_t *)p_b;
+}
+
+static int32_t bin_get(int8_t dbm)
+{
+    int32_t bin = ((int32_t)dbm - NRF_802154_ED_SWEEP_HISTOGRAM_MIN_DBM) /
+                  NRF_802154_ED_SWEEP_HISTOGRAM_BIN_WIDTH_DBM;
+
+    if (dbm < NRF_802154_ED_SWEEP_HISTOGRAM_MIN_DBM)
+    {
+        bin = 0;
+    }
+    else if (bin >= NRF_802154_ED_SWEEP_HISTOGRAM_BINS)
+    {
+        bin = NRF_802154_ED_SWEEP_HISTOGRAM_BINS - 1;
+    }
+
+    return bin;
+}
+
+/**
+ * @brief Checks the result of the sweep against the samples passed to the module.
+ *
+ * @returns  Number of failed checks.
+ */
+static uint64_t result_check(const nrf_802154_ed_sweep_params_t * p_params,
+                             const nrf_802154_ed_sweep_result_t * p_result)
+{
+    uint64_t violations = 0U;
+    uint32_t iters      = (p_params->dwell_us > SIM_ITER_DURATION) ?
+                          (p_params->dwell_us / SIM_ITER_DURATION) : 1U;
+    uint32_t expected   = ((iters + SIM_SAMPLE_ITERS - 1U) / SIM_SAMPLE_ITERS) *
+                          p_params->iterations;
+
+    if (p_result->channel_mask != p_params->channel_mask)
+    {
+        printf("  error: the result has channel mask 0x%08lx\n",
+               (unsigned long)p_result->channel_mask);
+        violations++;
+    }
+
+    for (uint8_t channel = SIM_CHANNEL_MIN; channel <= SIM_CHANNEL_MAX; channel++)
+    {
+        size_t                                       idx       = channel - SIM_CHANNEL_MIN;
+        const nrf_802154_ed_sweep_channel_result_t * p_channel = &p_result->channels[idx];
+        uint32_t                                     n         = m_samples_len[idx];
+        uint16_t                                     histogram[NRF_802154_ED_SWEEP_HISTOGRAM_BINS] =
+        {0};
+        int64_t                                      sum = 0;
+
+        if ((p_params->channel_mask & (1UL << channel)) == 0U)
+        {
+            static const nrf_802154_ed_sweep_channel_result_t empty;
+
+            if ((n != 0U) || (memcmp(p_channel, &empty, sizeof(empty)) != 0))
+            {
+                printf("  error: channel %u is outside the mask but has samples\n",
+                       (unsigned)channel);
+                violations++;
+            }
+
+            continue;
+        }
+
+        if ((n != expected) || (p_channel->samples != n))
+        {
+            printf("  error: channel %u has %u samples, %u passed, %u expected\n",
+                   (unsigned)channel, (unsigned)p_channel->samples, (unsigned)n,
+                   (unsigned)expected);
+            violations++;
+            continue;
+        }
+
+        for (uint32_t i = 0U; i < n; i++)
+        {
+            histogram[bin_get(mp_samples[idx][i])]++;
+            sum += mp_samples[idx][i];
+        }
+
+        qsort(mp_samples[idx], n, sizeof(int8_t), compare_int8);
+
+        int8_t   max        = mp_samples[idx][n - 1U];
+        int64_t  mean       = (2 * sum + ((sum < 0) ? -(int64_t)n : (int64_t)n)) / (2 * (int64_t)n);
+        uint32_t rank       = (n * NRF_802154_ED_SWEEP_PERCENTILE + 99U) / 100U;
+        int8_t   exact      = mp_samples[idx][rank - 1U];
+        int32_t  bin        = bin_get(exact);
+        int32_t  edge       = NRF_802154_ED_SWEEP_HISTOGRAM_MIN_DBM +
+                              (bin + 1) * NRF_802154_ED_SWEEP_HISTOGRAM_BIN_WIDTH_DBM - 1;
+        int8_t   percentile = ((bin < NRF_802154_ED_SWEEP_HISTOGRAM_BINS - 1) && (edge < max)) ?
+                             (int8_t)edge : max;
+
+        if (memcmp(histogram, p_channel->histogram, sizeof(histogram)) != 0)
+        {
+            printf("  error: channel %u has a wrong histogram\n", (unsigned)channel);
+            violations++;
+        }
+
+        if ((p_channel->max_dbm != max) || (p_channel->mean_dbm != mean) ||
+            (p_channel->percentile_dbm != percentile))
+        {
+            printf("  error: channel %u has max %d, mean %d, percentile %d instead of %d, %d, %d\n",
+                   (unsigned)channel, p_channel->max_dbm, p_channel->mean_dbm,
+                   p_channel->percentile_dbm, max, (int)mean, percentile);
+            violations++;
+        }
+
+        if ((percentile < exact) ||
+            ((bin < NRF_802154_ED_SWEEP_HISTOGRAM_BINS - 1) &&
+             (percentile - exact >= NRF_802154_ED_SWEEP_HISTOGRAM_BIN_WIDTH_DBM)))
+        {
+            printf("  error: channel %u reports percentile %d for exact %d\n",
+                   (unsigned)channel, percentile, exact);
+            violations++;
+        }
+    }
+
+    return violations;
+}
+
+/**
+ * @brief Picks the channel with the lowest percentile, then the lowest mean.
+ */
+static uint8_t sweep_channel_pick(const nrf_802154_ed_sweep_result_t * p_result)
+{
+    uint8_t best = 0U;
+
+    for (uint8_t channel = SIM_CHANNEL_MIN; channel <= SIM_CHANNEL_MAX; channel++)
+    {
+        const nrf_802154_ed_sweep_channel_result_t * p_channel =
+            &p_result->channels[channel - SIM_CHANNEL_MIN];
+        const nrf_802154_ed_sweep_channel_result_t * p_best    =
+            &p_result->channels[best - SIM_CHANNEL_MIN];
+
+        if ((p_result->channel_mask & (1UL << channel)) == 0U)
+        {
+            continue;
+        }
+
+        if ((best == 0U) || (p_channel->percentile_dbm < p_best->percentile_dbm) ||
+            ((p_channel->percentile_dbm == p_best->percentile_dbm) &&
+             (p_channel->mean_dbm < p_best->mean_dbm)))
+        {
+            best = channel;
+        }
+    }
+
+    return best;
+}
+
+static sim_result_t sweep_simulate(const sim_profile_t                * p_profile,
+                                   const nrf_802154_ed_sweep_params_t * p_params)
+{
+    sim_result_t result = {0};
+    uint64_t     start  = m_now;
+    uint32_t     ramps  = m_ramp_ups;
+
+    memset(m_samples_len, 0, sizeof(m_samples_len));
+
+    if (!nrf_802154_ed_sweep_params_check(p_params))
+    {
+        printf("  error: the sweep parameters are rejected\n");
+        result.violations++;
+        return result;
+    }
+
+    m_now += p_profile->request_us;
+
+    const nrf_802154_ed_sweep_result_t * p_result = sweep_run(p_params);
+
+    // The end of the sweep, preceded by the statistics of every channel when serialized
+    result.messages = 1U;
+
+    if (p_profile->serialized)
+    {
+        for (uint8_t channel = SIM_CHANNEL_MIN; channel <= SIM_CHANNEL_MAX; channel++)
+        {
+            result.messages += ((p_params->channel_mask & (1UL << channel)) != 0U) ? 1U : 0U;
+        }
+    }
+
+    m_now += p_profile->notify_us;
+
+    result.duration   = m_now - start;
+    result.ramp_ups   = m_ramp_ups - ramps;
+    result.channel    = sweep_channel_pick(p_result);
+    result.violations = result_check(p_params, p_result);
+
+    return result;
+}
+
+static sim_result_t baseline_simulate(const sim_profile_t                * p_profile,
+                                      const nrf_802154_ed_sweep_params_t * p_params)
+{
+    sim_result_t result = {0};
+    uint64_t     start  = m_now;
+    uint32_t     ramps  = m_ramp_ups;
+    int32_t      sums[NRF_802154_ED_SWEEP_CHANNELS_NUM] = {0};
+    uint32_t     dwell  = (p_params->dwell_us > SIM_ITER_DURATION) ? p_params->dwell_us :
+                          SIM_ITER_DURATION;
+
+    for (uint16_t i = 0U; i < p_params->iterations; i++)
+    {
+        for (uint8_t channel = SIM_CHANNEL_MIN; channel <= SIM_CHANNEL_MAX; channel++)
+        {
+            if ((p_params->channel_mask & (1UL << channel)) == 0U)
+            {
+                continue;
+            }
+
+            // The channel is set by a request that waits for its response
+            m_now += p_profile->request_us + p_profile->notify_us;
+            m_now += p_profile->request_us;
+
+            uint32_t time_left = dwell;
+            int8_t   peak      = SIM_ED_MIN_DBM;
+
+            while (time_left >= SIM_ITER_DURATION)
+            {
+                int8_t dbm = radio_energy_detection(channel, iters_next(&time_left, false), true);
+
+                peak = (dbm > peak) ? dbm : peak;
+            }
+
+            m_now                           += p_profile->notify_us;
+            sums[channel - SIM_CHANNEL_MIN] += peak;
+            result.messages                 += 2U;
+        }
+    }
+
+    for (uint8_t channel = SIM_CHANNEL_MIN; channel <= SIM_CHANNEL_MAX; channel++)
+    {
+        if (((p_params->channel_mask & (1UL << channel)) != 0U) &&
+            ((result.channel == 0U) ||
+             (sums[channel - SIM_CHANNEL_MIN] < sums[result.channel - SIM_CHANNEL_MIN])))
+        {
+            result.channel = channel;
+        }
+    }
+
+    result.duration = m_now - start;
+    result.ramp_ups = m_ramp_ups - ramps;
+
+    return result;
+}
+
+/**
+ * @brief Returns the rank of a channel during the given window, 1 being the best.
+ *
+ * The channels are ranked by the time they are busy, that is the number of iterations with
+ * the power above @ref SIM_BUSY_DBM, and then by their mean power.
+ */
+static uint32_t channel_rank_get(uint8_t channel, uint32_t mask, uint64_t start, uint64_t end)
+{
+    uint32_t busy[NRF_802154_ED_SWEEP_CHANNELS_NUM];
+    double   powers[NRF_802154_ED_SWEEP_CHANNELS_NUM];
+    uint32_t rank = 1U;
+    size_t   idx  = channel - SIM_CHANNEL_MIN;
+
+    for (uint8_t ch = SIM_CHANNEL_MIN; ch <= SIM_CHANNEL_MAX; ch++)
+    {
+        busy[ch - SIM_CHANNEL_MIN]   = 0U;
+        powers[ch - SIM_CHANNEL_MIN] = 0.0;
+
+        for (uint64_t t = start; t < end; t += SIM_ITER_DURATION)
+        {
+            double power = power_get(ch, t, SIM_ITER_DURATION);
+
+            busy[ch - SIM_CHANNEL_MIN]   += (power > pow(10.0, SIM_BUSY_DBM / 10.0)) ? 1U : 0U;
+            powers[ch - SIM_CHANNEL_MIN] += power;
+        }
+    }
+
+    for (uint8_t ch = SIM_CHANNEL_MIN; ch <= SIM_CHANNEL_MAX; ch++)
+    {
+        size_t i = ch - SIM_CHANNEL_MIN;
+
+        if (((mask & (1UL << ch)) != 0U) &&
+            ((busy[i] < busy[idx]) || ((busy[i] == busy[idx]) && (powers[i] < powers[idx]))))
+        {
+            rank++;
+        }
+    }
+
+    return rank;
+}
+
+static void result_print(const char * p_mode, const sim_result_t * p_result, uint32_t rank)
+{
+    printf("  %-9s %13.2f %9u %9u %8u %5u\n",
+           p_mode, (double)p_result->duration / 1000.0, (unsigned)p_result->messages,
+           (unsigned)p_result->ramp_ups, (unsigned)p_result->channel, (unsigned)rank);
+}
+
+static void channels_print(const nrf_802154_ed_sweep_result_t * p_result)
+{
+    printf("  %-7s %7s %9s %10s    P%-2u [dBm]\n", "channel", "samples", "max [dBm]",
+           "mean [dBm]", (unsigned)NRF_802154_ED_SWEEP_PERCENTILE);
+
+    for (uint8_t channel = SIM_CHANNEL_MIN; channel <= SIM_CHANNEL_MAX; channel++)
+    {
+        const nrf_802154_ed_sweep_channel_result_t * p_channel =
+            &p_result->channels[channel - SIM_CHANNEL_MIN];
+
+        if ((p_result->channel_mask & (1UL << channel)) != 0U)
+        {
+            printf("  %-7u %7u %9d %10d %11d\n", (unsigned)channel, (unsigned)p_channel->samples,
+                   p_channel->max_dbm, p_channel->mean_dbm, p_channel->percentile_dbm);
+        }
+    }
+}
+
+/**
+ * @brief Checks that the sweep parameters are accepted exactly within their limits.
+ *
+ * @returns  Number of failed checks.
+ */
+static uint64_t params_limits_check(void)
+{
+    // A dwell time of 257 samples allows at most 255 iterations with 16-bit sample counters
+    static const struct
+    {
+        nrf_802154_ed_sweep_params_t params;
+        bool                         valid;
+    } cases[] =
+    {
+        {{NRF_802154_ED_SWEEP_CHANNEL_MASK, 0U, 1U},                                    true },
+        {{1UL << 11, 128U * SIM_SAMPLE_ITERS * 257U, 255U},                             true },
+        {{1UL << 11, 128U * SIM_SAMPLE_ITERS * 257U, 256U},                             false},
+        {{1UL << 11, 128U * SIM_SAMPLE_ITERS * 257U + 128U, 255U},                      false},
+        {{1UL << 26, 128U * SIM_SAMPLE_ITERS, UINT16_MAX},                              true },
+        {{0U, 1000U, 1U},                                                               false},
+        {{1UL << 10, 1000U, 1U},                                                        false},
+        {{1UL << 27, 1000U, 1U},                                                        false},
+        {{NRF_802154_ED_SWEEP_CHANNEL_MASK, 1000U, 0U},                                 false},
+    };
+
+    uint64_t violations = 0U;
+
+    for (size_t i = 0U; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        if (nrf_802154_ed_sweep_params_check(&cases[i].params) != cases[i].valid)
+        {
+            printf("error: mask 0x%08lx, dwell %lu us, %u iterations are %s\n",
+                   (unsigned long)cases[i].params.channel_mask,
+                   (unsigned long)cases[i].params.dwell_us,
+                   (unsigned)cases[i].params.iterations,
+                   cases[i].valid ? "rejected" : "accepted");
+            violations++;
+        }
+    }
+
+    return violations;
+}
+
+int main(int argc, char ** argv)
+{
+    nrf_802154_ed_sweep_params_t params     =
+    {
+        .channel_mask = NRF_802154_ED_SWEEP_CHANNEL_MASK,
+        .dwell_us     = 5000U,
+        .iterations   = 8U,
+    };
+    uint32_t                     seed       = 0x2545f491U;
+    uint64_t                     violations = 0U;
+    int                          opt        = 1;
+
+    while (opt + 1 < argc)
+    {
+        unsigned long value = strtoul(argv[opt + 1], NULL, 0);
+
+        if (strcmp(argv[opt], "-d") == 0)
+        {
+            params.dwell_us = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-i") == 0)
+        {
+            params.iterations = (uint16_t)value;
+        }
+        else if (strcmp(argv[opt], "-m") == 0)
+        {
+            params.channel_mask = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-s") == 0)
+        {
+            seed = (uint32_t)value;
+        }
+        else
+        {
+            break;
+        }
+
+        opt += 2;
+    }
+
+    if ((opt != argc) || !nrf_802154_ed_sweep_params_check(&params))
+    {
+        fprintf(stderr,
+                "Usage: %s [-d <dwell time [us]>] [-i <iterations>] [-m <channel mask>] "
+                "[-s <seed>]\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    for (size_t i = 0U; i < NRF_802154_ED_SWEEP_CHANNELS_NUM; i++)
+    {
+        mp_samples[i] = malloc(SIM_SAMPLES_MAX);
+
+        if (mp_samples[i] == NULL)
+        {
+            return EXIT_FAILURE;
+        }
+    }
+
+    violations += params_limits_check();
+
+    printf("dwell time %lu us, %u iterations, channel mask 0x%08lx, sample %u us, P%u\n\n",
+           (unsigned long)params.dwell_us, (unsigned)params.iterations,
+           (unsigned long)params.channel_mask, (unsigned)(SIM_SAMPLE_ITERS * SIM_ITER_DURATION),
+           (unsigned)NRF_802154_ED_SWEEP_PERCENTILE);
+
+    for (size_t p = 0U; p < sizeof(m_profiles) / sizeof(m_profiles[0]); p++)
+    {
+        m_seed = seed;
+        m_rng  = seed | 1U;
+        m_now  = 0U;
+
+        sim_result_t sweep      = sweep_simulate(&m_profiles[p], &params);
+        uint32_t     sweep_rank = channel_rank_get(sweep.channel, params.channel_mask, 0U, m_now);
+
+        if (p == 0U)
+        {
+            channels_print(nrf_802154_ed_sweep_result_get());
+            printf("\n");
+        }
+
+        // The baseline faces the same interference as the sweep, shifted by its start
+        uint64_t     start         = m_now;
+        sim_result_t baseline      = baseline_simulate(&m_profiles[p], &params);
+        uint32_t     baseline_rank = channel_rank_get(baseline.channel, params.channel_mask,
+                                                      start, m_now);
+
+        printf("%s higher layer\n", m_profiles[p].p_name);
+        printf("  %-9s %13s %9s %9s %8s %5s\n",
+               "mode", "duration [ms]", "messages", "ramp-ups", "channel", "rank");
+        result_print("sweep", &sweep, sweep_rank);
+        result_print("baseline", &baseline, baseline_rank);
+        printf("\n");
+
+        if (sweep_rank > SIM_RANK_MAX)
+        {
+            printf("  error: the sweep picks channel %u of rank %u\n\n",
+                   (unsigned)sweep.channel, (unsigned)sweep_rank);
+            violations++;
+        }
+
+        violations += sweep.violations + baseline.violations;
+    }
+
+    // A sweep of a few channels must leave the others empty. The dwell time ends with a short sample.
+    nrf_802154_ed_sweep_params_t partial = params;
+
+    partial.channel_mask = (1UL << 11) | (1UL << 15) | (1UL << 25) | (1UL << 26);
+    partial.dwell_us     = 128U * (2U * SIM_SAMPLE_ITERS + 1U) + 100U;
+
+    sim_result_t partial_result = sweep_simulate(&m_profiles[0], &partial);
+
+    violations += partial_result.violations;
+
+    for (size_t i = 0U; i < NRF_802154_ED_SWEEP_CHANNELS_NUM; i++)
+    {
+        free(mp_samples[i]);
+    }
+
+    if (violations != 0U)
+    {
+        printf("%llu checks failed\n", (unsigned long long)violations);
+        return EXIT_FAILURE;
+    }
+
+    printf("All checks passed\n");
+
+    return EXIT_SUCCESS;
+}
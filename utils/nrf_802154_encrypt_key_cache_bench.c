@@ -0,0 +1,451 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run test and benchmark of the key cache of the encryption module.
+ *
+ * The program includes nrf_802154_encrypt.c, so that the test can inspect the key cache, and links
+ * the frame parser, the RAM security PIB and the software AES-CCM* backend unchanged. The PIB,
+ * the filter and the TX work buffer are replaced with stubs. It runs in two parts:
+ *
+ * - test:      prepares the encryption of secured Enh-Acks with keys chosen at random from a few
+ *              stored keys and checks that the key and the nonce match the ones built without
+ *              the cache. Keys are rotated from time to time, the way the higher layer does it,
+ *              with the removed Key Index stored again with a new value. After each removal,
+ *              the test checks that no copy of the removed key is left in the cache and that
+ *              the frames secured with it are rejected. It also checks the removal of all keys.
+ * - benchmark: reports the time of nrf_802154_encrypt_ack_prepare for a secured Enh-Ack, which
+ *              the core calls between the end of the received frame and the start of the Ack.
+ *
+ * Build it with NRF_802154_ENCRYPT_KEY_CACHE_SIZE set to 0 to get the timings without the cache.
+ * The program exits with a failure if any check fails.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -DNRF_802154_ENCRYPTION_ACCELERATOR_SW=1 \
+ *         -o encrypt_key_cache_bench ../../utils/nrf_802154_encrypt_key_cache_bench.c \
+ *         driver/src/mac_features/nrf_802154_frame_parser.c \
+ *         driver/src/mac_features/nrf_802154_security_pib_ram.c \
+ *         driver/src/nrf_802154_aes_sw.c driver/src/nrf_802154_aes_ccm_sw.c \
+ *         -Icommon/include -Idriver/include -Idriver/src -Idriver/src/mac_features \
+ *         -Isl/include -Isl/sl_opensource/include \
+ *         -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis>
+ *
+ * Usage:
+ *
+ *     encrypt_key_cache_bench [-n <test frames>] [-b <benchmark Acks>] [-s <seed>]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "nrf_802154_encrypt.c"
+
+#define TEST_KEYS     3U  ///< Number of stored keys, as the previous, current and next Thread key.
+#define TEST_ROTATION 64U ///< Number of frames between key rotations.
+#define TEST_ROUNDS   5U  ///< Benchmark rounds, the best is reported.
+#define TEST_ACKS     64U ///< Number of different Acks of the benchmark.
+
+#define TEST_ACK_SEC_CTRL_OFFSET (PHR_SIZE + FCF_SIZE + DSN_SIZE + PAN_ID_SIZE + \
+                                  EXTENDED_ADDRESS_SIZE) ///< Offset of the Security Control field.
+#define TEST_ACK_FC_OFFSET       (TEST_ACK_SEC_CTRL_OFFSET + SECURITY_CONTROL_SIZE)
+#define TEST_ACK_KEY_IDX_OFFSET  (TEST_ACK_FC_OFFSET + FRAME_COUNTER_SIZE)
+#define TEST_ACK_LEN             (TEST_ACK_KEY_IDX_OFFSET + KEY_ID_MODE_1_SIZE + MIC_32_SIZE + \
+                                  FCS_SIZE) ///< Length of the Ack, including the PHR.
+
+#define CHECK(cond)                                                     \
+    do                                                                  \
+    {                                                                   \
+        if (!(cond))                                                    \
+        {                                                               \
+            printf("  check failed at line %d: %s\n", __LINE__, #cond); \
+            m_failures++;                                               \
+        }                                                               \
+    }                                                                   \
+    while (0)
+
+static uint32_t m_failures; ///< Number of failed checks.
+
+static const uint8_t m_ext_addr[EXTENDED_ADDRESS_SIZE] =
+{
+    0x01, 0x23, 0x45, 0x67, 0x89, 0xab, 0xcd, 0xef
+};
+
+static uint8_t  m_key_index[TEST_KEYS];                   ///< Key Indexes of the stored keys.
+static uint8_t  m_key_value[TEST_KEYS][AES_CCM_KEY_SIZE]; ///< Values of the stored keys.
+static uint8_t  m_work_buffer[MAX_PACKET_SIZE + PHR_SIZE];
+static uint8_t  m_acks[TEST_ACKS][TEST_ACK_LEN];
+static uint32_t m_next_key_index = 1U; ///< Key Index of the next stored key.
+
+/***************************************************************************************************
+ * @section Stubs
+ **************************************************************************************************/
+
+const uint8_t * nrf_802154_pib_extended_address_get(void)
+{
+    return m_ext_addr;
+}
+
+const nrf_802154_identity_t * nrf_802154_pib_identity_get(uint8_t index)
+{
+    (void)index;
+
+    return NULL;
+}
+
+uint8_t nrf_802154_filter_frame_identity_get(void)
+{
+    return 0U;
+}
+
+uint8_t * nrf_802154_tx_work_buffer_enable_for(uint8_t * p_original_frame)
+{
+    (void)p_original_frame;
+
+    return m_work_buffer;
+}
+
+void nrf_802154_tx_work_buffer_plain_text_offset_set(const uint8_t * p_original_frame,
+                                                     uint8_t         offset)
+{
+    (void)p_original_frame;
+    (void)offset;
+}
+
+void nrf_802154_tx_work_buffer_is_secured_set(const uint8_t * p_original_frame)
+{
+    (void)p_original_frame;
+}
+
+/***************************************************************************************************
+ * @section Helpers
+ **************************************************************************************************/
+
+static uint32_t xorshift32(uint32_t * p_state)
+{
+    uint32_t x = *p_state;
+
+    x        ^= x << 13;
+    x        ^= x >> 17;
+    x        ^= x << 5;
+    *p_state  = x;
+
+    return x;
+}
+
+static uint64_t nanoseconds_get(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Stores key @p i with the next unused Key Index and a random value.
+ */
+static void key_store(uint32_t i, uint32_t * p_seed)
+{
+    nrf_802154_key_t key;
+
+    m_key_index[i] = (uint8_t)m_next_key_index++;
+
+    for (uint32_t j = 0; j < AES_CCM_KEY_SIZE; j++)
+    {
+        m_key_value[i][j] = (uint8_t)xorshift32(p_seed);
+    }
+
+    key.value.p_cleartext_key    = m_key_value[i];
+    key.id.mode                  = KEY_ID_MODE_1;
+    key.id.p_key_id              = &m_key_index[i];
+    key.type                     = NRF_802154_KEY_CLEARTEXT;
+    key.frame_counter            = 0U;
+    key.use_global_frame_counter = true;
+
+    CHECK(nrf_802154_security_pib_key_store(&key) == NRF_802154_SECURITY_ERROR_NONE);
+}
+
+/**
+ * @brief Removes key @p i the way nrf_802154_security_key_remove does.
+ */
+static void key_remove(uint32_t i)
+{
+    nrf_802154_key_id_t id = {.mode = KEY_ID_MODE_1, .p_key_id = &m_key_index[i]};
+
+    CHECK(nrf_802154_security_pib_key_remove(&id) == NRF_802154_SECURITY_ERROR_NONE);
+    nrf_802154_encrypt_key_cache_purge();
+}
+
+/**
+ * @brief Checks if a copy of a key value is left anywhere in the key cache.
+ */
+static bool key_is_cached(const uint8_t * p_value)
+{
+#if NRF_802154_ENCRYPT_KEY_CACHE_SIZE > 0
+    const uint8_t * p_cache = (const uint8_t *)m_key_cache;
+
+    for (size_t i = 0; i + AES_CCM_KEY_SIZE <= sizeof(m_key_cache); i++)
+    {
+        if (memcmp(&p_cache[i], p_value, AES_CCM_KEY_SIZE) == 0)
+        {
+            return true;
+        }
+    }
+#else
+    (void)p_value;
+#endif
+
+    return false;
+}
+
+/**
+ * @brief Builds a 2015 Enh-Ack secured with ENC-MIC-32 and Key Identifier mode 1.
+ */
+static void ack_build(uint8_t                        * p_ack,
+                      uint8_t                          key_index,
+                      uint32_t                         frame_counter,
+                      nrf_802154_frame_parser_data_t * p_data)
+{
+    static const uint8_t header[] =
+    {
+        TEST_ACK_LEN - PHR_SIZE,
+        FRAME_TYPE_ACK | SECURITY_ENABLED_BIT,
+        DEST_ADDR_TYPE_EXTENDED | FRAME_VERSION_2,
+        0x42, 0xcd, 0xab, 0x10, 0x11, 0x12, 0x13, 0x14, 0x15, 0x16, 0x17,
+    };
+
+    memset(p_ack, 0, TEST_ACK_LEN);
+    memcpy(p_ack, header, sizeof(header));
+
+    p_ack[TEST_ACK_SEC_CTRL_OFFSET] = SECURITY_LEVEL_ENC_MIC_32 | KEY_ID_MODE_1_MASK;
+    p_ack[TEST_ACK_FC_OFFSET]       = (uint8_t)frame_counter;
+    p_ack[TEST_ACK_FC_OFFSET + 1U]  = (uint8_t)(frame_counter >> 8);
+    p_ack[TEST_ACK_FC_OFFSET + 2U]  = (uint8_t)(frame_counter >> 16);
+    p_ack[TEST_ACK_FC_OFFSET + 3U]  = (uint8_t)(frame_counter >> 24);
+    p_ack[TEST_ACK_KEY_IDX_OFFSET]  = key_index;
+
+    CHECK(nrf_802154_frame_parser_data_init(p_ack, TEST_ACK_LEN, PARSE_LEVEL_FULL, p_data));
+}
+
+/***************************************************************************************************
+ * @section Test
+ **************************************************************************************************/
+
+/**
+ * @brief Checks the key and the nonce prepared for an Ack against the ones built without the cache.
+ *
+ * @retval true   The key was found.
+ * @retval false  The key was not found.
+ */
+static bool ack_check(const nrf_802154_frame_parser_data_t * p_data)
+{
+    nrf_802154_aes_ccm_data_t data;
+    nrf_802154_aes_ccm_data_t ref;
+    bool                      found = aes_ccm_data_content_prepare(p_data, m_ext_addr, &data);
+
+    CHECK(found == aes_ccm_data_key_prepare(p_data, &ref));
+
+    if (found)
+    {
+        CHECK(aes_ccm_nonce_generate(p_data, m_ext_addr, ref.nonce));
+        CHECK(memcmp(data.key, ref.key, AES_CCM_KEY_SIZE) == 0);
+        CHECK(memcmp(data.nonce, ref.nonce, NRF_802154_AES_CCM_NONCE_SIZE) == 0);
+    }
+
+    CHECK(nrf_802154_encrypt_ack_prepare(p_data) == found);
+
+    return found;
+}
+
+static void key_cache_test(uint32_t frames, uint32_t seed)
+{
+    nrf_802154_frame_parser_data_t data;
+    uint8_t                        removed[AES_CCM_KEY_SIZE];
+    uint8_t                        removed_index;
+
+    printf("test: %u frames, %u keys, %u cache entries\n",
+           (unsigned)frames, (unsigned)TEST_KEYS, (unsigned)NRF_802154_ENCRYPT_KEY_CACHE_SIZE);
+
+    nrf_802154_security_pib_init();
+
+    for (uint32_t i = 0; i < TEST_KEYS; i++)
+    {
+        key_store(i, &seed);
+    }
+
+    for (uint32_t f = 0; f < frames; f++)
+    {
+        uint32_t i = xorshift32(&seed) % TEST_KEYS;
+
+        ack_build(m_acks[0], m_key_index[i], f, &data);
+        CHECK(ack_check(&data));
+
+        if ((f % TEST_ROTATION) == TEST_ROTATION - 1U)
+        {
+            // The removed key must not be used nor kept, even if its Key Index is stored again.
+            memcpy(removed, m_key_value[i], AES_CCM_KEY_SIZE);
+            removed_index = m_key_index[i];
+
+            key_remove(i);
+            CHECK(!key_is_cached(removed));
+
+            ack_build(m_acks[0], removed_index, f, &data);
+            CHECK(!ack_check(&data));
+            CHECK(!key_is_cached(removed));
+
+            m_next_key_index = removed_index;
+            key_store(i, &seed);
+            m_next_key_index = removed_index + TEST_KEYS + 1U;
+
+            ack_build(m_acks[0], m_key_index[i], f, &data);
+            CHECK(ack_check(&data));
+            CHECK(!key_is_cached(removed));
+        }
+    }
+
+    nrf_802154_security_pib_key_remove_all();
+    nrf_802154_encrypt_key_cache_purge();
+
+    for (uint32_t i = 0; i < TEST_KEYS; i++)
+    {
+        CHECK(!key_is_cached(m_key_value[i]));
+
+        ack_build(m_acks[0], m_key_index[i], 0U, &data);
+        CHECK(!ack_check(&data));
+    }
+
+    printf("  keys: %s\n", (m_failures == 0U) ? "ok" : "FAILED");
+}
+
+/***************************************************************************************************
+ * @section Benchmark
+ **************************************************************************************************/
+
+static void ack_prepare_benchmark(uint32_t acks, uint32_t seed)
+{
+    static nrf_802154_frame_parser_data_t data[TEST_ACKS];
+
+    uint64_t best = UINT64_MAX;
+
+    printf("benchmark: %u Acks, best of %u rounds\n", (unsigned)acks, (unsigned)TEST_ROUNDS);
+
+    nrf_802154_security_pib_init();
+
+    for (uint32_t i = 0; i < TEST_KEYS; i++)
+    {
+        key_store(i, &seed);
+    }
+
+    // The Acks are parsed by the core before they are prepared, so the parsing is not measured.
+    for (uint32_t a = 0; a < TEST_ACKS; a++)
+    {
+        ack_build(m_acks[a], m_key_index[xorshift32(&seed) % TEST_KEYS], a, &data[a]);
+    }
+
+    for (uint32_t r = 0; r < TEST_ROUNDS; r++)
+    {
+        uint64_t start = nanoseconds_get();
+        uint64_t time;
+        uint32_t ok = 0U;
+
+        for (uint32_t a = 0; a < acks; a++)
+        {
+            ok += nrf_802154_encrypt_ack_prepare(&data[a % TEST_ACKS]) ? 1U : 0U;
+        }
+
+        time = nanoseconds_get() - start;
+        best = (time < best) ? time : best;
+
+        CHECK(ok == acks);
+    }
+
+    printf("  ack prepare: %6.1f ns\n", (double)best / acks);
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t frames = 10000U;
+    uint32_t acks   = 200000U;
+    uint32_t seed   = 1U;
+    int      opt    = 1;
+
+    while (opt + 1 < argc)
+    {
+        unsigned long value = strtoul(argv[opt + 1], NULL, 0);
+
+        if (strcmp(argv[opt], "-n") == 0)
+        {
+            frames = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-b") == 0)
+        {
+            acks = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-s") == 0)
+        {
+            seed = (uint32_t)value;
+        }
+        else
+        {
+            break;
+        }
+
+        opt += 2;
+    }
+
+    if ((opt != argc) || (seed == 0U) || (acks == 0U))
+    {
+        fprintf(stderr,
+                "Usage: %s [-n <test frames>] [-b <benchmark Acks>] [-s <seed>]\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    key_cache_test(frames, seed);
+    ack_prepare_benchmark(acks, seed);
+
+    if (m_failures != 0U)
+    {
+        printf("\n%u checks failed\n", (unsigned)m_failures);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,549 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run test and benchmark of the Enh-Ack generation.
+ *
+ * The program links the Enh-Ack generator, the Ack data module, the IE writer and the frame
+ * parser unchanged and replaces the rest of the driver with stubs. Every Ack is generated the way
+ * the core does it, in three steps: when the addressing fields of the frame are received, when its
+ * Auxiliary Security Header is received and when the whole frame is received. It is then completed
+ * by the TX Ack started hooks, in the order the core calls them.
+ *
+ * The program runs in two parts:
+ *
+ * - test:      generates Acks for a random mix of frames from three peers with different IE data
+ *              and security levels, and changes the IE data of the peers from time to time. Every
+ *              Ack, built from a template when possible, is compared byte by byte with the Ack built
+ *              from scratch for the same frame. Acks to other addresses evict all templates before
+ *              the latter is built.
+ * - benchmark: generates Acks for a secured frame from a peer with CSL and Link Metrics IEs and
+ *              reports the time from the end of the addressing fields to the Ack ready, both
+ *              from scratch and from a template.
+ *
+ * Build it with NRF_802154_ENH_ACK_TEMPLATES_NUM set to 0 to get the timings without templates.
+ * The program exits with a failure if any check fails.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -DNRF_802154_ENCRYPTION_ENABLED=1 -DNRF_802154_IE_WRITER_ENABLED=1 \
+ *         -DNRF_802154_DELAYED_TRX_ENABLED=1 \
+ *         -o enh_ack_bench ../../utils/nrf_802154_enh_ack_bench.c \
+ *         driver/src/mac_features/ack_generator/nrf_802154_enh_ack_generator.c \
+ *         driver/src/mac_features/ack_generator/nrf_802154_ack_data.c \
+ *         driver/src/mac_features/nrf_802154_ie_writer.c \
+ *         driver/src/mac_features/nrf_802154_frame_parser.c \
+ *         -Icommon/include -Idriver/include -Idriver/src -Idriver/src/mac_features \
+ *         -Isl/include -Isl/sl_opensource/include \
+ *         -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis>
+ *
+ * Usage:
+ *
+ *     enh_ack_bench [-n <test frames>] [-b <benchmark Acks>] [-r <benchmark rounds>] [-s <seed>]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_types.h"
+#include "mac_features/nrf_802154_filter.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/nrf_802154_ie_writer.h"
+#include "mac_features/nrf_802154_security_pib.h"
+#include "mac_features/ack_generator/nrf_802154_ack_data.h"
+#include "mac_features/ack_generator/nrf_802154_enh_ack_generator.h"
+
+#define BENCH_PEERS            3U    ///< Number of peers sending frames.
+#define BENCH_PAYLOAD_LEN      20U   ///< Length of the MAC payload of the frames.
+#define BENCH_ADDR_END         22U   ///< Length of the PHR and MHR up to the end of the addressing fields.
+#define BENCH_AUX_SEC_HDR_END  28U   ///< Length up to the end of the Auxiliary Security Header.
+#define BENCH_NO_SECURITY      (-1)  ///< Security level of a frame without security.
+#define BENCH_CSL_PERIOD       1000U ///< CSL period written by the IE writer.
+#define BENCH_IE_CHANGE_FRAMES 97U   ///< Average number of test frames between changes of IE data.
+
+#define CHECK(cond)                                                     \
+    do                                                                  \
+    {                                                                   \
+        if (!(cond))                                                    \
+        {                                                               \
+            printf("  check failed at line %d: %s\n", __LINE__, #cond); \
+            m_failures++;                                               \
+        }                                                               \
+    }                                                                   \
+    while (0)
+
+static uint32_t m_failures;      ///< Number of failed checks.
+static uint32_t m_frame_counter; ///< Frame counter returned to the Ack generator.
+
+static const uint8_t m_pan_id[PAN_ID_SIZE] = {0xcd, 0xab};
+
+/**@brief Extended addresses of the peers. */
+static const uint8_t m_peers[BENCH_PEERS][EXTENDED_ADDRESS_SIZE] =
+{
+    {0x01, 0x02, 0x03, 0x04, 0x05, 0x06, 0x07, 0x08},
+    {0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09, 0x09},
+    {0x21, 0x22, 0x23, 0x24, 0x25, 0x26, 0x27, 0x28},
+};
+
+/**@brief CSL IE with the phase and period filled by the IE writer. */
+static const uint8_t m_csl_ie[] = {0x04, 0x0d, 0x00, 0x00, 0x00, 0x00};
+
+/**@brief Thread vendor IE for Enh-Ack based Link Metrics probing, with RSSI and LQI. */
+static const uint8_t m_link_metrics_ie[] =
+{
+    0x06, 0x00, 0x9b, 0xb8, 0xea, 0x00, IE_VENDOR_THREAD_RSSI_TOKEN, IE_VENDOR_THREAD_LQI_TOKEN
+};
+
+/**@brief Vendor IE not modified by the IE writer, with the last byte changed by the test. */
+static uint8_t m_vendor_ie[] = {0x04, 0x00, 0x01, 0x02, 0x03, 0x00};
+
+static uint32_t xorshift32(uint32_t * p_state)
+{
+    uint32_t x = *p_state;
+
+    x        ^= x << 13;
+    x        ^= x >> 17;
+    x        ^= x << 5;
+    *p_state  = x;
+
+    return x;
+}
+
+static uint64_t nanoseconds_get(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/***************************************************************************************************
+ * @section Stubs of the modules around the Ack generator
+ **************************************************************************************************/
+
+nrf_802154_security_error_t nrf_802154_security_pib_frame_counter_get_next(
+    uint32_t            * p_frame_counter,
+    nrf_802154_key_id_t * p_id)
+{
+    (void)p_id;
+
+    *p_frame_counter = m_frame_counter;
+
+    return NRF_802154_SECURITY_ERROR_NONE;
+}
+
+void nrf_802154_encrypt_ack_reset(void)
+{
+}
+
+bool nrf_802154_encrypt_ack_prepare(const nrf_802154_frame_parser_data_t * p_ack_data)
+{
+    (void)p_ack_data;
+
+    return true;
+}
+
+const uint8_t * nrf_802154_pib_pan_id_get(void)
+{
+    return m_pan_id;
+}
+
+const nrf_802154_identity_t * nrf_802154_pib_identity_get(uint8_t index)
+{
+    (void)index;
+
+    return NULL;
+}
+
+uint8_t nrf_802154_filter_frame_identity_get(void)
+{
+    return 0U;
+}
+
+int8_t nrf_802154_core_last_frame_rssi_get(void)
+{
+    return -50;
+}
+
+uint8_t nrf_802154_core_last_frame_lqi_get(void)
+{
+    return 200;
+}
+
+uint64_t nrf_802154_sl_timer_current_time_get(void)
+{
+    return 123456U;
+}
+
+bool nrf_802154_delayed_trx_nearest_drx_time_to_midpoint_get(uint32_t * p_drx_time_to_midpoint)
+{
+    *p_drx_time_to_midpoint = 5000U;
+
+    return true;
+}
+
+void nrf_802154_tx_work_buffer_is_dynamic_data_updated_set(const uint8_t * p_original_frame)
+{
+    (void)p_original_frame;
+}
+
+/***************************************************************************************************
+ * @section Ack generation
+ **************************************************************************************************/
+
+/**
+ * @brief Builds a 2015 data frame with the Ack Request bit set and extended addresses.
+ *
+ * @param[out] p_frame   Buffer for the PHR and PSDU of the frame.
+ * @param[in]  dsn       Sequence number of the frame.
+ * @param[in]  p_src     Source address of the frame.
+ * @param[in]  sec_lvl   Security level, or @ref BENCH_NO_SECURITY to send the frame unsecured.
+ *
+ * @return Length of the PHR and PSDU of the frame.
+ */
+static uint8_t frame_build(uint8_t * p_frame, uint8_t dsn, const uint8_t * p_src, int sec_lvl)
+{
+    uint8_t i = PHR_SIZE;
+
+    // With both addresses extended, a 2015 frame carries only the destination PAN ID when
+    // the PAN ID Compression bit is cleared.
+    p_frame[i++] = FRAME_TYPE_DATA | ACK_REQUEST_BIT |
+                   ((sec_lvl != BENCH_NO_SECURITY) ? SECURITY_ENABLED_BIT : 0U);
+    p_frame[i++] = DEST_ADDR_TYPE_EXTENDED | FRAME_VERSION_2 | SRC_ADDR_TYPE_EXTENDED;
+    p_frame[i++] = dsn;
+    memcpy(&p_frame[i], m_pan_id, PAN_ID_SIZE);
+    i += PAN_ID_SIZE;
+
+    for (uint8_t k = 0; k < EXTENDED_ADDRESS_SIZE; k++)
+    {
+        p_frame[i++] = 0x10U + k;
+    }
+
+    memcpy(&p_frame[i], p_src, EXTENDED_ADDRESS_SIZE);
+    i += EXTENDED_ADDRESS_SIZE;
+
+    if (sec_lvl != BENCH_NO_SECURITY)
+    {
+        p_frame[i++] = (uint8_t)sec_lvl | KEY_ID_MODE_1;
+        p_frame[i++] = dsn;
+        p_frame[i++] = 0U;
+        p_frame[i++] = 0U;
+        p_frame[i++] = 0U;
+        p_frame[i++] = 0x05U + (dsn & 1U);
+    }
+
+    for (uint8_t k = 0; k < BENCH_PAYLOAD_LEN; k++)
+    {
+        p_frame[i++] = k;
+    }
+
+    i         += ((sec_lvl > 0) ? MIC_32_SIZE : 0U) + FCS_SIZE;
+    p_frame[0] = i - PHR_SIZE;
+
+    return i;
+}
+
+/**
+ * @brief Generates the Ack of a frame as the core does and runs the TX Ack started hooks.
+ *
+ * @param[in]  p_frame    PHR and PSDU of the frame.
+ * @param[in]  len        Length of the PHR and PSDU of the frame.
+ * @param[out] p_time_ns  Time spent in the Ack generator, from the end of the addressing fields
+ *                        to the Ack ready, in nanoseconds. May be NULL.
+ *
+ * @return The Ack, or NULL if none was generated.
+ */
+static uint8_t * ack_generate(const uint8_t * p_frame, uint8_t len, uint64_t * p_time_ns)
+{
+    nrf_802154_frame_parser_data_t frame_data;
+    uint8_t                      * p_ack;
+    uint64_t                       time_ns = 0U;
+    uint64_t                       start;
+
+    nrf_802154_enh_ack_generator_reset();
+    (void)nrf_802154_frame_parser_data_init(p_frame, BENCH_ADDR_END, PARSE_LEVEL_ADDRESSING_END,
+                                            &frame_data);
+
+    start    = nanoseconds_get();
+    p_ack    = nrf_802154_enh_ack_generator_create(&frame_data);
+    time_ns += nanoseconds_get() - start;
+
+    if (frame_data.parse_level < PARSE_LEVEL_AUX_SEC_HDR_END)
+    {
+        (void)nrf_802154_frame_parser_valid_data_extend(&frame_data,
+                                                        BENCH_AUX_SEC_HDR_END,
+                                                        PARSE_LEVEL_AUX_SEC_HDR_END);
+
+        start    = nanoseconds_get();
+        p_ack    = nrf_802154_enh_ack_generator_create(&frame_data);
+        time_ns += nanoseconds_get() - start;
+    }
+
+    (void)nrf_802154_frame_parser_valid_data_extend(&frame_data, len, PARSE_LEVEL_FULL);
+
+    start    = nanoseconds_get();
+    p_ack    = nrf_802154_enh_ack_generator_create(&frame_data);
+    time_ns += nanoseconds_get() - start;
+
+    if (p_time_ns != NULL)
+    {
+        *p_time_ns = time_ns;
+    }
+
+    if (p_ack != NULL)
+    {
+        nrf_802154_ie_writer_tx_ack_started_hook(p_ack);
+#if NRF_802154_ENH_ACK_TEMPLATES_NUM > 0
+        nrf_802154_enh_ack_generator_tx_ack_started_hook(p_ack);
+#endif
+    }
+
+    nrf_802154_ie_writer_reset();
+
+    return p_ack;
+}
+
+/**
+ * @brief Makes the next Ack to be built from scratch by sending Acks to other addresses.
+ */
+static void templates_evict(void)
+{
+#if NRF_802154_ENH_ACK_TEMPLATES_NUM > 0
+    uint8_t frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint8_t src[EXTENDED_ADDRESS_SIZE] = {0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0, 0xe0};
+
+    for (uint32_t i = 0; i < NRF_802154_ENH_ACK_TEMPLATES_NUM; i++)
+    {
+        src[0] = 0xe0U + (uint8_t)i;
+        (void)ack_generate(frame, frame_build(frame, 0U, src, BENCH_NO_SECURITY), NULL);
+    }
+#endif
+}
+
+/**
+ * @brief Sets the IE data of the peers: CSL and Link Metrics for the first one, CSL and vendor IE
+ *        for the second one, none for the third one.
+ */
+static void peers_setup(void)
+{
+    nrf_802154_ack_data_init();
+    nrf_802154_enh_ack_generator_init();
+    nrf_802154_ie_writer_csl_period_set(BENCH_CSL_PERIOD);
+
+    for (uint32_t i = 0; i < 2U; i++)
+    {
+        (void)nrf_802154_ack_data_for_addr_set(m_peers[i], true, NRF_802154_ACK_DATA_IE,
+                                               m_csl_ie, sizeof(m_csl_ie));
+    }
+
+    (void)nrf_802154_ack_data_for_addr_set(m_peers[0], true, NRF_802154_ACK_DATA_IE,
+                                           m_link_metrics_ie, sizeof(m_link_metrics_ie));
+    (void)nrf_802154_ack_data_for_addr_set(m_peers[1], true, NRF_802154_ACK_DATA_IE,
+                                           m_vendor_ie, sizeof(m_vendor_ie));
+}
+
+/***************************************************************************************************
+ * @section Test and benchmark
+ **************************************************************************************************/
+
+static void ack_test(uint32_t frames, uint32_t seed)
+{
+    static const int sec_lvls[] = {5, 5, 5, 0, BENCH_NO_SECURITY};
+
+    uint8_t  frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint8_t  ack[MAX_PACKET_SIZE + PHR_SIZE];
+    uint8_t  ack_len;
+    uint32_t peer = 0U;
+
+    printf("test: %u frames\n", (unsigned)frames);
+
+    peers_setup();
+
+    for (uint32_t i = 0; i < frames; i++)
+    {
+        int       sec_lvl;
+        uint8_t   len;
+        uint8_t * p_ack;
+
+        if ((xorshift32(&seed) % BENCH_IE_CHANGE_FRAMES) == 0U)
+        {
+            // The IE is replaced with one of the same size and different content.
+            m_vendor_ie[sizeof(m_vendor_ie) - 1U] = (uint8_t)xorshift32(&seed);
+            (void)nrf_802154_ack_data_for_addr_set(m_peers[1], true, NRF_802154_ACK_DATA_IE,
+                                                   m_vendor_ie, sizeof(m_vendor_ie));
+        }
+
+        // Frames often come from the same peer in a row, so that their Acks use the templates.
+        if ((xorshift32(&seed) & 1U) != 0U)
+        {
+            peer = xorshift32(&seed) % BENCH_PEERS;
+        }
+
+        sec_lvl         = sec_lvls[xorshift32(&seed) % (sizeof(sec_lvls) / sizeof(sec_lvls[0]))];
+        len             = frame_build(frame, (uint8_t)i, m_peers[peer], sec_lvl);
+        m_frame_counter = 1000U + i;
+
+        p_ack = ack_generate(frame, len, NULL);
+        CHECK(p_ack != NULL);
+
+        if (p_ack == NULL)
+        {
+            continue;
+        }
+
+        ack_len = p_ack[0] + PHR_SIZE;
+        memcpy(ack, p_ack, ack_len);
+
+        CHECK((ack[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) == FRAME_TYPE_ACK);
+        CHECK((ack[FRAME_VERSION_OFFSET] & FRAME_VERSION_MASK) == FRAME_VERSION_2);
+        CHECK(ack[DSN_OFFSET] == (uint8_t)i);
+
+        templates_evict();
+        p_ack = ack_generate(frame, len, NULL);
+
+        CHECK((p_ack != NULL) && (p_ack[0] + PHR_SIZE == ack_len) &&
+              (memcmp(p_ack, ack, ack_len) == 0));
+    }
+}
+
+static void ack_benchmark(uint32_t acks, uint32_t rounds)
+{
+    uint8_t frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint8_t len = frame_build(frame, 7U, m_peers[0], 5);
+
+    printf("benchmark: %u Acks, best of %u rounds, %u templates\n",
+           (unsigned)acks, (unsigned)rounds, (unsigned)NRF_802154_ENH_ACK_TEMPLATES_NUM);
+
+    peers_setup();
+    m_frame_counter = 1000U;
+
+    for (uint32_t cold = 0; cold < 2U; cold++)
+    {
+        uint64_t best_total = UINT64_MAX;
+        uint64_t best_worst = UINT64_MAX;
+
+        for (uint32_t r = 0; r < rounds; r++)
+        {
+            uint64_t total = 0U;
+            uint64_t worst = 0U;
+
+            for (uint32_t i = 0; i < acks; i++)
+            {
+                uint64_t time_ns;
+
+                if (cold)
+                {
+                    templates_evict();
+                }
+
+                CHECK(ack_generate(frame, len, &time_ns) != NULL);
+
+                total += time_ns;
+                worst  = (time_ns > worst) ? time_ns : worst;
+            }
+
+            best_total = (total < best_total) ? total : best_total;
+            best_worst = (worst < best_worst) ? worst : best_worst;
+        }
+
+        printf("  %-13s %7.1f ns mean, %7llu ns worst\n",
+               cold ? "from scratch:" : "repeated:",
+               (double)best_total / acks, (unsigned long long)best_worst);
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t frames = 20000U;
+    uint32_t acks   = 100000U;
+    uint32_t rounds = 5U;
+    uint32_t seed   = 7U;
+    int      opt    = 1;
+
+    while (opt + 1 < argc)
+    {
+        unsigned long value = strtoul(argv[opt + 1], NULL, 0);
+
+        if (strcmp(argv[opt], "-n") == 0)
+        {
+            frames = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-b") == 0)
+        {
+            acks = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-r") == 0)
+        {
+            rounds = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-s") == 0)
+        {
+            seed = (uint32_t)value;
+        }
+        else
+        {
+            break;
+        }
+
+        opt += 2;
+    }
+
+    if ((opt != argc) || (seed == 0U) || (acks == 0U) || (rounds == 0U))
+    {
+        fprintf(stderr,
+                "Usage: %s [-n <test frames>] [-b <benchmark Acks>] [-r <benchmark rounds>] "
+                "[-s <seed>]\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    ack_test(frames, seed);
+    ack_benchmark(acks, rounds);
+
+    if (m_failures != 0U)
+    {
+        printf("\n%u checks failed\n", (unsigned)m_failures);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
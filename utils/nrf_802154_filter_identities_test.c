@@ -0,0 +1,430 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run test of the receive filter with multiple identities.
+ *
+ * The test links nrf_802154_pib.c, nrf_802154_filter.c and the frame parser unchanged, configures
+ * three identities and filters frames the way the core does: parsed up to the addressing fields
+ * and filtered in the NRF_802154_FILTER_MODE_ALL mode. Multipurpose frames, which the frame
+ * parser does not handle, are filtered as the whole frame. It checks the verdict and the index of
+ * the matched identity of:
+ *
+ * - 2006 and 2015 frames with short, extended and broadcast destinations, for every identity,
+ *   and for addresses of one identity combined with the PAN ID of another one,
+ * - 2015 frames with both extended addresses, with and without the destination PAN ID,
+ * - beacons and frames without a destination address, with and without the PAN coordinator role,
+ * - Multipurpose frames with the short and the long Frame Control, including malformed ones,
+ * - frames addressed to an identity after it is cleared.
+ *
+ * The program exits with a failure if any check fails.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -DNRF_802154_IDENTITIES_NUM=3 \
+ *         -o filter_identities_test ../../utils/nrf_802154_filter_identities_test.c \
+ *         driver/src/nrf_802154_pib.c driver/src/mac_features/nrf_802154_filter.c \
+ *         driver/src/mac_features/nrf_802154_frame_parser.c \
+ *         driver/src/mac_features/nrf_802154_csma_ca_backoff.c \
+ *         -Icommon/include -Idriver/include -Idriver/src -Idriver/src/mac_features \
+ *         -Isl/include -Isl/sl_opensource/include \
+ *         -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis>
+ *
+ * Usage:
+ *
+ *     filter_identities_test
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_pib.h"
+#include "mac_features/nrf_802154_filter.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+#if NRF_802154_IDENTITIES_NUM < 3
+#error "The test requires NRF_802154_IDENTITIES_NUM=3 or more"
+#endif
+
+#define TEST_DSN     0x11U ///< Sequence number of the frames.
+#define TEST_PAYLOAD 0xaaU ///< Payload of the frames.
+#define TEST_MHR_MAX 16U   ///< Maximum length of the MHR of a raw frame.
+
+#define FCF_DATA       FRAME_TYPE_DATA                       ///< Data frame.
+#define FCF_DATA_COMPR (FRAME_TYPE_DATA | PAN_ID_COMPR_MASK) ///< Data frame, PAN ID compression.
+
+/** Second octet of the Frame Control of a 2006 frame with a short destination address. */
+#define FCF_2006_SHORT (DEST_ADDR_TYPE_SHORT | FRAME_VERSION_1 | SRC_ADDR_TYPE_EXTENDED)
+/** Second octet of the Frame Control of a 2006 frame with an extended destination address. */
+#define FCF_2006_EXT   (DEST_ADDR_TYPE_EXTENDED | FRAME_VERSION_1 | SRC_ADDR_TYPE_EXTENDED)
+/** Second octet of the Frame Control of a 2015 frame with a short destination address. */
+#define FCF_2015_SHORT (DEST_ADDR_TYPE_SHORT | FRAME_VERSION_2 | SRC_ADDR_TYPE_EXTENDED)
+/** Second octet of the Frame Control of a 2015 frame with an extended destination address. */
+#define FCF_2015_EXT   (DEST_ADDR_TYPE_EXTENDED | FRAME_VERSION_2 | SRC_ADDR_TYPE_EXTENDED)
+/** Second octet of the Frame Control of a 2006 frame without a destination address. */
+#define FCF_2006_NONE  (DEST_ADDR_TYPE_NONE | FRAME_VERSION_1 | SRC_ADDR_TYPE_SHORT)
+/** Second octet of the Frame Control of a 2003 frame without a destination address. */
+#define FCF_2003_NONE  (DEST_ADDR_TYPE_NONE | FRAME_VERSION_0 | SRC_ADDR_TYPE_SHORT)
+
+/** First octet of the short Multipurpose Frame Control with a short destination address. */
+#define MP_SHORT       (FRAME_TYPE_MULTIPURPOSE | MP_DEST_ADDR_TYPE_SHORT)
+/** First octet of the short Multipurpose Frame Control with an extended destination address. */
+#define MP_EXT         (FRAME_TYPE_MULTIPURPOSE | MP_DEST_ADDR_TYPE_EXTENDED)
+/** First octet of the long Multipurpose Frame Control with a short destination address. */
+#define MP_LONG_SHORT  (FRAME_TYPE_MULTIPURPOSE | MP_LONG_FRAME_CONTROL_BIT | MP_DEST_ADDR_TYPE_SHORT)
+
+#define CHECK(cond)                                                     \
+    do                                                                  \
+    {                                                                   \
+        if (!(cond))                                                    \
+        {                                                               \
+            printf("  check failed at line %d: %s\n", __LINE__, #cond); \
+            m_failures++;                                               \
+        }                                                               \
+    }                                                                   \
+    while (0)
+
+/**
+ * @brief Frame built from its addressing fields.
+ */
+typedef struct
+{
+    const char    * p_name;       ///< Name of the case.
+    uint8_t         fcf[2];       ///< Frame Control.
+    const uint8_t * p_dst_pan;    ///< Destination PAN ID or NULL if absent.
+    const uint8_t * p_dst_addr;   ///< Destination address or NULL if absent.
+    uint8_t         dst_addr_len; ///< Length of the destination address.
+    const uint8_t * p_src_pan;    ///< Source PAN ID or NULL if absent.
+    const uint8_t * p_src_addr;   ///< Source address or NULL if absent.
+    uint8_t         src_addr_len; ///< Length of the source address.
+    bool            accepted;     ///< If the frame is expected to be accepted.
+    uint8_t         identity;     ///< Identity expected to match an accepted frame.
+} frame_case_t;
+
+/**
+ * @brief Frame given by its MHR.
+ */
+typedef struct
+{
+    const char * p_name;            ///< Name of the case.
+    uint8_t      mhr[TEST_MHR_MAX]; ///< MHR of the frame.
+    uint8_t      mhr_len;           ///< Length of the MHR.
+    bool         accepted;          ///< If the frame is expected to be accepted.
+    uint8_t      identity;          ///< Identity expected to match an accepted frame.
+} raw_case_t;
+
+static const uint8_t m_pan0[PAN_ID_SIZE]            = {0x34, 0x12};
+static const uint8_t m_short0[SHORT_ADDRESS_SIZE]   = {0x01, 0x00};
+static const uint8_t m_ext0[EXTENDED_ADDRESS_SIZE]  = {1, 1, 1, 1, 1, 1, 1, 1};
+static const uint8_t m_pan1[PAN_ID_SIZE]            = {0xcd, 0xab};
+static const uint8_t m_short1[SHORT_ADDRESS_SIZE]   = {0x02, 0x00};
+static const uint8_t m_ext1[EXTENDED_ADDRESS_SIZE]  = {2, 2, 2, 2, 2, 2, 2, 2};
+static const uint8_t m_pan2[PAN_ID_SIZE]            = {0x34, 0x12}; // Shared with identity 0.
+static const uint8_t m_short2[SHORT_ADDRESS_SIZE]   = {0x03, 0x00};
+static const uint8_t m_ext2[EXTENDED_ADDRESS_SIZE]  = {3, 3, 3, 3, 3, 3, 3, 3};
+static const uint8_t m_pan_x[PAN_ID_SIZE]           = {0x99, 0x99};
+static const uint8_t m_short_x[SHORT_ADDRESS_SIZE]  = {0x77, 0x00};
+static const uint8_t m_ext_x[EXTENDED_ADDRESS_SIZE] = {9, 9, 9, 9, 9, 9, 9, 9};
+static const uint8_t m_bcast[SHORT_ADDRESS_SIZE]    = {0xff, 0xff};
+static const uint8_t m_src[EXTENDED_ADDRESS_SIZE]   = {5, 5, 5, 5, 5, 5, 5, 5};
+
+/**@brief Frames filtered with identities 0, 1 and 2 configured. */
+static const frame_case_t m_frame_cases[] =
+{
+    {"2006 short id0", {FCF_DATA_COMPR, FCF_2006_SHORT}, m_pan0, m_short0, 2, NULL, m_src, 8,
+     true, 0},
+    {"2006 short id1", {FCF_DATA_COMPR, FCF_2006_SHORT}, m_pan1, m_short1, 2, NULL, m_src, 8,
+     true, 1},
+    {"2006 short id2", {FCF_DATA_COMPR, FCF_2006_SHORT}, m_pan2, m_short2, 2, NULL, m_src, 8,
+     true, 2},
+    {"2006 short id0 in PAN of id1", {FCF_DATA_COMPR, FCF_2006_SHORT}, m_pan1, m_short0, 2, NULL,
+     m_src, 8, false, 0},
+    {"2006 short id1 in foreign PAN", {FCF_DATA_COMPR, FCF_2006_SHORT}, m_pan_x, m_short1, 2, NULL,
+     m_src, 8, false, 0},
+    {"2006 short foreign", {FCF_DATA_COMPR, FCF_2006_SHORT}, m_pan0, m_short_x, 2, NULL, m_src, 8,
+     false, 0},
+    {"2006 broadcast in PAN of id1", {FCF_DATA_COMPR, FCF_2006_SHORT}, m_pan1, m_bcast, 2, NULL,
+     m_src, 8, true, 1},
+    {"2006 broadcast in broadcast PAN", {FCF_DATA_COMPR, FCF_2006_SHORT}, m_bcast, m_bcast, 2,
+     NULL, m_src, 8, true, 0},
+    {"2006 short id2 in broadcast PAN", {FCF_DATA_COMPR, FCF_2006_SHORT}, m_bcast, m_short2, 2,
+     NULL, m_src, 8, true, 2},
+    {"2006 extended id0", {FCF_DATA_COMPR, FCF_2006_EXT}, m_pan0, m_ext0, 8, NULL, m_src, 8,
+     true, 0},
+    {"2006 extended id1", {FCF_DATA_COMPR, FCF_2006_EXT}, m_pan1, m_ext1, 8, NULL, m_src, 8,
+     true, 1},
+    {"2006 extended id2, PAN of id0", {FCF_DATA_COMPR, FCF_2006_EXT}, m_pan0, m_ext2, 8, NULL,
+     m_src, 8, true, 2},
+    {"2006 extended id1 in PAN of id0", {FCF_DATA_COMPR, FCF_2006_EXT}, m_pan0, m_ext1, 8, NULL,
+     m_src, 8, false, 0},
+    {"2006 extended foreign", {FCF_DATA_COMPR, FCF_2006_EXT}, m_pan0, m_ext_x, 8, NULL, m_src, 8,
+     false, 0},
+    {"2015 short id1", {FCF_DATA_COMPR, FCF_2015_SHORT}, m_pan1, m_short1, 2, NULL, m_src, 8,
+     true, 1},
+    {"2015 extended/extended, PAN of id2", {FCF_DATA, FCF_2015_EXT}, m_pan2, m_ext2, 8, NULL,
+     m_src, 8, true, 2},
+    {"2015 extended/extended id2 in foreign PAN", {FCF_DATA, FCF_2015_EXT}, m_pan_x, m_ext2, 8,
+     NULL, m_src, 8, false, 0},
+    {"2015 extended/extended without PAN ID, id1", {FCF_DATA_COMPR, FCF_2015_EXT}, NULL, m_ext1,
+     8, NULL, m_src, 8, true, 1},
+    {"beacon without destination", {FRAME_TYPE_BEACON, FCF_2003_NONE}, NULL, NULL, 0, m_pan_x,
+     m_short_x, 2, true, 0},
+    {"data without destination, not coordinator", {FCF_DATA, FCF_2006_NONE}, NULL, NULL, 0,
+     m_pan1, m_short_x, 2, false, 0},
+};
+
+/**@brief Multipurpose frames filtered with identities 0, 1 and 2 configured. */
+static const raw_case_t m_mp_cases[] =
+{
+    {"MP short FCF, short id1", {MP_SHORT, TEST_DSN, 0x02, 0x00, TEST_PAYLOAD}, 5, true, 1},
+    {"MP short FCF, short foreign", {MP_SHORT, TEST_DSN, 0x77, 0x00, TEST_PAYLOAD}, 5, false, 0},
+    {"MP short FCF, extended id2", {MP_EXT, TEST_DSN, 3, 3, 3, 3, 3, 3, 3, 3}, 10, true, 2},
+    {"MP long FCF, PAN and short id2, no DSN",
+     {MP_LONG_SHORT, MP_PAN_ID_PRESENT_BIT | MP_DSN_SUPPRESS_BIT, 0x34, 0x12, 0x03, 0x00}, 6,
+     true, 2},
+    {"MP long FCF, short id2 in PAN of id1",
+     {MP_LONG_SHORT, MP_PAN_ID_PRESENT_BIT, TEST_DSN, 0xcd, 0xab, 0x03, 0x00}, 7, false, 0},
+    {"MP long FCF, version 1",
+     {MP_LONG_SHORT, MP_PAN_ID_PRESENT_BIT | FRAME_VERSION_1, TEST_DSN, 0xcd, 0xab, 0x02, 0x00},
+     7, false, 0},
+    {"MP reserved destination mode", {FRAME_TYPE_MULTIPURPOSE | 0x10, TEST_DSN, 0, 0, 0}, 5,
+     false, 0},
+    {"MP truncated extended destination", {MP_EXT, TEST_DSN, 3, 3, 3}, 5, false, 0},
+    {"MP without destination, not coordinator", {FRAME_TYPE_MULTIPURPOSE, TEST_DSN, 0, 0}, 4,
+     false, 0},
+};
+
+static uint32_t m_failures;                          ///< Number of failed checks.
+static uint8_t  m_frame[MAX_PACKET_SIZE + PHR_SIZE]; ///< Frame being filtered, with its PHR.
+
+/**
+ * @brief Builds a frame from its addressing fields, followed by a payload octet and the FCS.
+ */
+static void frame_build(const frame_case_t * p_case)
+{
+    uint8_t i = PHR_SIZE;
+
+    m_frame[i++] = p_case->fcf[0];
+    m_frame[i++] = p_case->fcf[1];
+    m_frame[i++] = TEST_DSN;
+
+    if (p_case->p_dst_pan != NULL)
+    {
+        memcpy(&m_frame[i], p_case->p_dst_pan, PAN_ID_SIZE);
+        i += PAN_ID_SIZE;
+    }
+
+    if (p_case->p_dst_addr != NULL)
+    {
+        memcpy(&m_frame[i], p_case->p_dst_addr, p_case->dst_addr_len);
+        i += p_case->dst_addr_len;
+    }
+
+    if (p_case->p_src_pan != NULL)
+    {
+        memcpy(&m_frame[i], p_case->p_src_pan, PAN_ID_SIZE);
+        i += PAN_ID_SIZE;
+    }
+
+    if (p_case->p_src_addr != NULL)
+    {
+        memcpy(&m_frame[i], p_case->p_src_addr, p_case->src_addr_len);
+        i += p_case->src_addr_len;
+    }
+
+    m_frame[i++]        = TEST_PAYLOAD;
+    m_frame[PHR_OFFSET] = i - PHR_SIZE + FCS_SIZE;
+}
+
+/**
+ * @brief Builds a frame from its MHR, followed by the FCS.
+ */
+static void raw_frame_build(const raw_case_t * p_case)
+{
+    memcpy(&m_frame[PHR_SIZE], p_case->mhr, p_case->mhr_len);
+    m_frame[PHR_OFFSET] = p_case->mhr_len + FCS_SIZE;
+}
+
+/**
+ * @brief Filters the frame the way the core does and checks the verdict and the identity.
+ */
+static void frame_check(const char * p_name, bool accepted, uint8_t identity)
+{
+    nrf_802154_frame_parser_data_t frame_data;
+    nrf_802154_rx_error_t          error = NRF_802154_RX_ERROR_INVALID_FRAME;
+    bool                           multipurpose;
+    bool                           parsed;
+
+    multipurpose = (m_frame[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) == FRAME_TYPE_MULTIPURPOSE;
+    parsed       = nrf_802154_frame_parser_data_init(m_frame,
+                                                     m_frame[PHR_OFFSET] + PHR_SIZE,
+                                                     PARSE_LEVEL_FULL,
+                                                     &frame_data);
+
+    // The frame parser does not handle Multipurpose frames, the filter locates their fields.
+    if (parsed || multipurpose)
+    {
+        error = nrf_802154_filter_frame_part(&frame_data, NRF_802154_FILTER_MODE_ALL);
+    }
+
+    if ((error == NRF_802154_RX_ERROR_NONE) != accepted)
+    {
+        printf("  %s: %s, error %d\n", p_name, accepted ? "rejected" : "accepted", (int)error);
+        m_failures++;
+    }
+    else if (accepted && (nrf_802154_filter_frame_identity_get() != identity))
+    {
+        printf("  %s: identity %u instead of %u\n",
+               p_name,
+               (unsigned)nrf_802154_filter_frame_identity_get(),
+               (unsigned)identity);
+        m_failures++;
+    }
+}
+
+uint32_t nrf_802154_random_get(void)
+{
+    return 0U;
+}
+
+void nrf_802154_assert_handler(void)
+{
+    printf("  driver assertion failed\n");
+    abort();
+}
+
+/**
+ * @brief Configures identity 0 with the PIB setters and identities 1 and 2.
+ */
+static void identities_test(void)
+{
+    nrf_802154_identity_t identity1;
+    nrf_802154_identity_t identity2;
+
+    memcpy(identity1.pan_id, m_pan1, PAN_ID_SIZE);
+    memcpy(identity1.short_addr, m_short1, SHORT_ADDRESS_SIZE);
+    memcpy(identity1.extended_addr, m_ext1, EXTENDED_ADDRESS_SIZE);
+    identity1.src_addr_match = NRF_802154_SRC_ADDR_MATCH_ZIGBEE;
+
+    memcpy(identity2.pan_id, m_pan2, PAN_ID_SIZE);
+    memcpy(identity2.short_addr, m_short2, SHORT_ADDRESS_SIZE);
+    memcpy(identity2.extended_addr, m_ext2, EXTENDED_ADDRESS_SIZE);
+    identity2.src_addr_match = NRF_802154_SRC_ADDR_MATCH_THREAD;
+
+    nrf_802154_pib_init();
+    nrf_802154_pib_pan_id_set(m_pan0);
+    nrf_802154_pib_short_address_set(m_short0);
+    nrf_802154_pib_extended_address_set(m_ext0);
+
+    CHECK(!nrf_802154_pib_identity_set(0U, &identity1));
+    CHECK(!nrf_802154_pib_identity_set(NRF_802154_IDENTITIES_NUM, &identity1));
+    CHECK(nrf_802154_pib_identity_set(1U, &identity1));
+    CHECK(nrf_802154_pib_identity_set(2U, &identity2));
+}
+
+static void frames_test(void)
+{
+    for (size_t i = 0U; i < sizeof(m_frame_cases) / sizeof(m_frame_cases[0]); i++)
+    {
+        frame_build(&m_frame_cases[i]);
+        frame_check(m_frame_cases[i].p_name, m_frame_cases[i].accepted, m_frame_cases[i].identity);
+    }
+
+    for (size_t i = 0U; i < sizeof(m_mp_cases) / sizeof(m_mp_cases[0]); i++)
+    {
+        raw_frame_build(&m_mp_cases[i]);
+        frame_check(m_mp_cases[i].p_name, m_mp_cases[i].accepted, m_mp_cases[i].identity);
+    }
+}
+
+/**
+ * @brief Checks that a PAN coordinator accepts data frames without a destination address.
+ */
+static void coordinator_test(void)
+{
+    static const frame_case_t no_dst =
+    {
+        "data without destination, coordinator", {FCF_DATA, FCF_2006_NONE}, NULL, NULL, 0,
+        m_pan1, m_short_x, 2, true, 0
+    };
+
+    nrf_802154_pib_pan_coord_set(true);
+    frame_build(&no_dst);
+    frame_check(no_dst.p_name, no_dst.accepted, no_dst.identity);
+    nrf_802154_pib_pan_coord_set(false);
+}
+
+/**
+ * @brief Checks that the frames of a cleared identity are rejected and the others are not.
+ */
+static void clear_test(void)
+{
+    static const frame_case_t cases[] =
+    {
+        {"2006 short id1 after clear", {FCF_DATA_COMPR, FCF_2006_SHORT}, m_pan1, m_short1, 2, NULL,
+         m_src, 8, false, 0},
+        {"2006 short id2 after clear of id1", {FCF_DATA_COMPR, FCF_2006_SHORT}, m_pan2, m_short2,
+         2, NULL, m_src, 8, true, 2},
+    };
+
+    CHECK(nrf_802154_pib_identity_clear(1U));
+    CHECK(nrf_802154_pib_identity_get(1U) == NULL);
+
+    for (size_t i = 0U; i < sizeof(cases) / sizeof(cases[0]); i++)
+    {
+        frame_build(&cases[i]);
+        frame_check(cases[i].p_name, cases[i].accepted, cases[i].identity);
+    }
+}
+
+int main(void)
+{
+    identities_test();
+    frames_test();
+    coordinator_test();
+    clear_test();
+
+    if (m_failures != 0U)
+    {
+        printf("\n%u checks failed\n", (unsigned)m_failures);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,779 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run differential fuzzer and benchmark of the receive filter rules.
+ *
+ * The fuzzer links nrf_802154_filter_rules.c and the frame parser unchanged. Random frames are
+ * evaluated against random rule tables the way the core does: the frame is parsed at every
+ * bit-counter match, up to the FCF, the destination addressing fields, the Security Control field
+ * and the Auxiliary Security Header, the rules are evaluated after each step until they drop
+ * the frame, and the evaluation is finished on the whole frame. Multipurpose frames are evaluated
+ * on the whole frame only. The verdict must equal the one of a reference evaluation, which matches
+ * every rule field by field on the whole frame, and the hit counters of the rules must equal
+ * the reference ones when the table is replaced. The rule tables and frames are drawn from small
+ * pools of PAN IDs and addresses, so that the rules match. The fuzzer also checks that invalid
+ * rules are rejected.
+ *
+ * The benchmark then measures the cost of all evaluation calls of a frame for a table typical
+ * for a gateway, with an increasing number of rules. The program exits with a failure if any
+ * check fails.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -DNRF_802154_FILTER_RULES_ENABLED=1 \
+ *         -DNRF_802154_FILTER_RULES_NUM=16 \
+ *         -o filter_rules_fuzz ../../utils/nrf_802154_filter_rules_fuzz.c \
+ *         driver/src/mac_features/nrf_802154_filter_rules.c \
+ *         driver/src/mac_features/nrf_802154_frame_parser.c \
+ *         -Icommon/include -Idriver/include -Idriver/src -Idriver/src/mac_features \
+ *         -Isl/include -Isl/sl_opensource/include \
+ *         -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis>
+ *
+ * Usage:
+ *
+ *     filter_rules_fuzz [-n <frames>] [-t <frames per table>] [-b <benchmark frames>] [-s <seed>]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "mac_features/nrf_802154_filter_rules.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+
+#if !NRF_802154_FILTER_RULES_ENABLED
+#error "The fuzzer requires NRF_802154_FILTER_RULES_ENABLED=1"
+#endif
+
+#define FUZZ_RULES        NRF_802154_FILTER_RULES_NUM ///< Number of rules of a table.
+#define FUZZ_STAGES       4U                          ///< Bit-counter matches of a frame.
+#define FUZZ_MIN_LENGTH   5U                          ///< Minimum PSDU length of a random frame.
+#define FUZZ_MAX_LENGTH   64U                         ///< Maximum PSDU length of a random frame.
+#define FUZZ_FIELDS_MASK  0x1fU                       ///< All fields of a rule.
+#define FUZZ_REPORTED     10U                         ///< Mismatching frames reported.
+#define BENCH_FRAMES      4U                          ///< Frames of the benchmark stream.
+#define BENCH_ROUNDS      15U                         ///< Benchmark rounds, the best is reported.
+
+#define CHECK(cond)                                                     \
+    do                                                                  \
+    {                                                                   \
+        if (!(cond))                                                    \
+        {                                                               \
+            printf("  check failed at line %d: %s\n", __LINE__, #cond); \
+            m_failures++;                                               \
+        }                                                               \
+    }                                                                   \
+    while (0)
+
+/**@brief PAN IDs the random rules and frames are drawn from. */
+static const uint8_t m_pan_ids[][PAN_ID_SIZE] =
+{
+    {0x34, 0x12}, {0xcd, 0xab}, {0xff, 0xff},
+};
+
+/**@brief Extended addresses the random rules and frames are drawn from. The last two octets of
+ *        each one are used as a short address. */
+static const uint8_t m_addrs[][EXTENDED_ADDRESS_SIZE] =
+{
+    {1, 2, 3, 4, 5, 6, 0x00, 0xf4}, {9, 9, 9, 9, 9, 9, 0x10, 0xf4}, {7, 7, 7, 7, 7, 7, 7, 0x77},
+};
+
+/**@brief Parse levels of the bit-counter matches of the core. */
+static const nrf_802154_frame_parser_level_t m_stage_levels[FUZZ_STAGES] =
+{
+    PARSE_LEVEL_FCF_OFFSETS,
+    PARSE_LEVEL_DST_ADDRESSING_END,
+    PARSE_LEVEL_SEC_CTRL_OFFSETS,
+    PARSE_LEVEL_AUX_SEC_HDR_END,
+};
+
+static uint32_t                 m_failures;             ///< Number of failed checks.
+static uint32_t                 m_rand_state;           ///< State of the pseudo-random generator.
+static nrf_802154_filter_rule_t m_rules[FUZZ_RULES];    ///< Rules of the current table.
+static bool                     m_used[FUZZ_RULES];     ///< If a rule of the table is set.
+static uint32_t                 m_ref_hits[FUZZ_RULES]; ///< Reference hit counters.
+
+/**@brief Frames of the benchmark and their parser data at every evaluation call. */
+static uint8_t                        m_bench_frames[BENCH_FRAMES][MAX_PACKET_SIZE + PHR_SIZE];
+static nrf_802154_frame_parser_data_t m_bench_stages[BENCH_FRAMES][FUZZ_STAGES];
+static uint8_t                        m_bench_stages_num[BENCH_FRAMES];
+
+static uint32_t xorshift32(uint32_t * p_state)
+{
+    uint32_t x = *p_state;
+
+    x        ^= x << 13;
+    x        ^= x >> 17;
+    x        ^= x << 5;
+    *p_state  = x;
+
+    return x;
+}
+
+static uint32_t rand_get(void)
+{
+    return xorshift32(&m_rand_state);
+}
+
+static uint64_t nanoseconds_get(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+void nrf_802154_assert_handler(void)
+{
+    printf("  driver assertion failed\n");
+    abort();
+}
+
+/***************************************************************************************************
+ * @section Reference evaluation
+ **************************************************************************************************/
+
+/**
+ * @brief Matches a rule against the whole frame, field by field.
+ */
+static bool ref_rule_match(const nrf_802154_filter_rule_t       * p_rule,
+                           const nrf_802154_frame_parser_data_t * p_data)
+{
+    uint8_t frame_type = p_data->p_frame[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK;
+    uint8_t level      = nrf_802154_frame_parser_parse_level_get(p_data);
+
+    if ((p_rule->fields & NRF_802154_FILTER_RULE_FIELD_FRAME_TYPE) &&
+        (((p_rule->frame_types >> frame_type) & 1U) == 0U))
+    {
+        return false;
+    }
+
+    if ((p_rule->fields & ~NRF_802154_FILTER_RULE_FIELD_FRAME_TYPE) == 0U)
+    {
+        return true;
+    }
+
+    if ((frame_type == FRAME_TYPE_MULTIPURPOSE) || (level < PARSE_LEVEL_FCF_OFFSETS))
+    {
+        return false;
+    }
+
+    if ((p_rule->fields & NRF_802154_FILTER_RULE_FIELD_SECURITY) &&
+        (((p_data->p_frame[SECURITY_ENABLED_OFFSET] & SECURITY_ENABLED_BIT) != 0U) !=
+         p_rule->security_enabled))
+    {
+        return false;
+    }
+
+    if ((p_rule->fields & NRF_802154_FILTER_RULE_FIELD_IE_PRESENT) &&
+        (((p_data->p_frame[IE_PRESENT_OFFSET] & IE_PRESENT_BIT) != 0U) != p_rule->ie_present))
+    {
+        return false;
+    }
+
+    if ((p_rule->fields &
+         (NRF_802154_FILTER_RULE_FIELD_SRC_PAN_ID | NRF_802154_FILTER_RULE_FIELD_SRC_ADDR)) == 0U)
+    {
+        return true;
+    }
+
+    if (level < PARSE_LEVEL_ADDRESSING_END)
+    {
+        return false;
+    }
+
+    if (p_rule->fields & NRF_802154_FILTER_RULE_FIELD_SRC_PAN_ID)
+    {
+        const uint8_t * p_pan_id = nrf_802154_frame_parser_src_panid_get(p_data);
+
+        if (p_pan_id == NULL)
+        {
+            p_pan_id = nrf_802154_frame_parser_dst_panid_get(p_data);
+        }
+
+        if ((p_pan_id == NULL) || (memcmp(p_pan_id, p_rule->src_pan_id, PAN_ID_SIZE) != 0))
+        {
+            return false;
+        }
+    }
+
+    if (p_rule->fields & NRF_802154_FILTER_RULE_FIELD_SRC_ADDR)
+    {
+        const uint8_t * p_addr = nrf_802154_frame_parser_src_addr_get(p_data);
+        uint8_t         size   = p_rule->src_addr_extended ? EXTENDED_ADDRESS_SIZE :
+                                 SHORT_ADDRESS_SIZE;
+
+        if ((p_addr == NULL) || (nrf_802154_frame_parser_src_addr_size_get(p_data) != size))
+        {
+            return false;
+        }
+
+        // The prefix starts at the most significant bit of the little-endian address.
+        for (uint8_t bit = 0U; bit < p_rule->src_addr_prefix_len; bit++)
+        {
+            uint8_t octet = size - 1U - bit / 8U;
+            uint8_t shift = 7U - bit % 8U;
+
+            if (((p_addr[octet] >> shift) & 1U) != ((p_rule->src_addr[octet] >> shift) & 1U))
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Evaluates the rule table on the whole frame and counts the reference hits.
+ */
+static nrf_802154_filter_rules_verdict_t ref_evaluate(const nrf_802154_frame_parser_data_t * p_data)
+{
+    for (uint8_t i = 0U; i < FUZZ_RULES; i++)
+    {
+        if (!m_used[i] || !ref_rule_match(&m_rules[i], p_data))
+        {
+            continue;
+        }
+
+        m_ref_hits[i]++;
+
+        if (m_rules[i].action == NRF_802154_FILTER_RULE_ACTION_ACCEPT)
+        {
+            return NRF_802154_FILTER_RULES_VERDICT_ACCEPT;
+        }
+
+        if (m_rules[i].action == NRF_802154_FILTER_RULE_ACTION_DROP)
+        {
+            return NRF_802154_FILTER_RULES_VERDICT_DROP;
+        }
+    }
+
+    return NRF_802154_FILTER_RULES_VERDICT_ACCEPT;
+}
+
+/***************************************************************************************************
+ * @section Fuzzer
+ **************************************************************************************************/
+
+static void rule_random_fill(nrf_802154_filter_rule_t * p_rule)
+{
+    memset(p_rule, 0, sizeof(*p_rule));
+
+    p_rule->fields            = rand_get() & FUZZ_FIELDS_MASK;
+    p_rule->action            = rand_get() % 3U;
+    p_rule->frame_types       = rand_get() & 0xffU;
+    p_rule->security_enabled  = (rand_get() & 1U) != 0U;
+    p_rule->ie_present        = (rand_get() & 1U) != 0U;
+    p_rule->src_addr_extended = (rand_get() & 1U) != 0U;
+
+    memcpy(p_rule->src_pan_id, m_pan_ids[rand_get() % 3U], PAN_ID_SIZE);
+    memcpy(p_rule->src_addr, m_addrs[rand_get() % 3U], EXTENDED_ADDRESS_SIZE);
+
+    if (!p_rule->src_addr_extended)
+    {
+        p_rule->src_addr[0] = m_addrs[rand_get() % 3U][6];
+        p_rule->src_addr[1] = m_addrs[rand_get() % 3U][7];
+    }
+
+    p_rule->src_addr_prefix_len =
+        rand_get() % ((p_rule->src_addr_extended ? 64U : 16U) + 1U);
+}
+
+/**
+ * @brief Replaces the rule table, after checking the hit counters of the previous one.
+ */
+static void table_replace(void)
+{
+    for (uint8_t i = 0U; i < FUZZ_RULES; i++)
+    {
+        if (m_used[i])
+        {
+            CHECK(nrf_802154_filter_rules_hits_get(i) == m_ref_hits[i]);
+        }
+    }
+
+    for (uint8_t i = 0U; i < FUZZ_RULES; i++)
+    {
+        m_used[i]     = (rand_get() % 4U) != 0U;
+        m_ref_hits[i] = 0U;
+        rule_random_fill(&m_rules[i]);
+
+        if (m_used[i])
+        {
+            CHECK(nrf_802154_filter_rules_set(i, &m_rules[i]));
+        }
+        else
+        {
+            CHECK(nrf_802154_filter_rules_clear(i));
+        }
+    }
+}
+
+/**
+ * @brief Fills a random frame with mostly valid frame versions and the PAN IDs and addresses
+ *        of the pools at random offsets of the addressing fields.
+ */
+static void frame_random_fill(uint8_t * p_frame)
+{
+    uint8_t length = FUZZ_MIN_LENGTH + rand_get() % (FUZZ_MAX_LENGTH - FUZZ_MIN_LENGTH + 1U);
+    uint8_t offset = PHR_SIZE + FCF_SIZE + DSN_SIZE;
+
+    for (uint8_t i = PHR_SIZE; i <= length; i++)
+    {
+        p_frame[i] = (uint8_t)rand_get();
+    }
+
+    if ((rand_get() % 4U) != 0U)
+    {
+        // Frame version 0, 1 or 2.
+        p_frame[FRAME_VERSION_OFFSET] &= ~0x20U | (rand_get() & 0x20U);
+    }
+
+    for (uint8_t k = 0U; (k < 4U) && (offset + EXTENDED_ADDRESS_SIZE < length); k++)
+    {
+        if ((rand_get() & 1U) != 0U)
+        {
+            memcpy(&p_frame[offset], m_pan_ids[rand_get() % 3U], PAN_ID_SIZE);
+        }
+        else if ((rand_get() & 1U) != 0U)
+        {
+            memcpy(&p_frame[offset], &m_addrs[rand_get() % 3U][6], SHORT_ADDRESS_SIZE);
+        }
+        else
+        {
+            memcpy(&p_frame[offset], m_addrs[rand_get() % 3U], EXTENDED_ADDRESS_SIZE);
+        }
+
+        offset += 2U + (rand_get() % 3U) * 3U;
+    }
+
+    p_frame[PHR_OFFSET] = length;
+}
+
+/**
+ * @brief Evaluates the rules the way the core does while the frame is being received.
+ *
+ * @param[in]  p_frame   Pointer to the frame.
+ * @param[out] p_stage   Bit-counter match at which the frame was dropped, or FUZZ_STAGES if
+ *                       the verdict was given on the whole frame.
+ */
+static nrf_802154_filter_rules_verdict_t incremental_evaluate(const uint8_t * p_frame,
+                                                              uint8_t       * p_stage)
+{
+    nrf_802154_frame_parser_data_t    data;
+    nrf_802154_filter_rules_verdict_t verdict;
+    uint8_t                           bcc = PHR_SIZE + FCF_SIZE;
+
+    nrf_802154_filter_rules_frame_reset();
+    (void)nrf_802154_frame_parser_data_init(p_frame, 0U, PARSE_LEVEL_NONE, &data);
+
+    *p_stage = FUZZ_STAGES;
+
+    for (uint8_t stage = 0U; (stage < FUZZ_STAGES) && (bcc <= p_frame[PHR_OFFSET] + PHR_SIZE);
+         stage++)
+    {
+        if (!nrf_802154_frame_parser_valid_data_extend(&data, bcc, m_stage_levels[stage]))
+        {
+            break;
+        }
+
+        if ((p_frame[FRAME_TYPE_OFFSET] & FRAME_TYPE_MASK) == FRAME_TYPE_MULTIPURPOSE)
+        {
+            break;
+        }
+
+        verdict = nrf_802154_filter_rules_evaluate(&data, false);
+
+        if (verdict == NRF_802154_FILTER_RULES_VERDICT_DROP)
+        {
+            *p_stage = stage;
+            return verdict;
+        }
+
+        switch (m_stage_levels[stage])
+        {
+            case PARSE_LEVEL_FCF_OFFSETS:
+                bcc = PHR_SIZE + nrf_802154_frame_parser_dst_addressing_end_offset_get(&data);
+                break;
+
+            case PARSE_LEVEL_DST_ADDRESSING_END:
+                bcc = PHR_SIZE + nrf_802154_frame_parser_addressing_end_offset_get(&data) +
+                      SECURITY_CONTROL_SIZE;
+                break;
+
+            case PARSE_LEVEL_SEC_CTRL_OFFSETS:
+                bcc = PHR_SIZE + nrf_802154_frame_parser_aux_sec_hdr_end_offset_get(&data);
+                break;
+
+            default:
+                bcc = UINT8_MAX;
+                break;
+        }
+    }
+
+    (void)nrf_802154_frame_parser_valid_data_extend(&data,
+                                                    p_frame[PHR_OFFSET] + PHR_SIZE,
+                                                    PARSE_LEVEL_FULL);
+
+    return nrf_802154_filter_rules_evaluate(&data, true);
+}
+
+/**
+ * @brief Checks that invalid rules are rejected.
+ */
+static void invalid_rules_test(void)
+{
+    nrf_802154_filter_rule_t rule;
+
+    memset(&rule, 0, sizeof(rule));
+    rule.fields              = NRF_802154_FILTER_RULE_FIELD_SRC_ADDR;
+    rule.src_addr_prefix_len = 17U;
+    CHECK(!nrf_802154_filter_rules_set(0U, &rule));
+
+    rule.src_addr_prefix_len = 16U;
+    rule.action              = (nrf_802154_filter_rule_action_t)3;
+    CHECK(!nrf_802154_filter_rules_set(0U, &rule));
+
+    rule.action = NRF_802154_FILTER_RULE_ACTION_COUNT;
+    CHECK(nrf_802154_filter_rules_set(0U, &rule));
+    CHECK(!nrf_802154_filter_rules_set(FUZZ_RULES, &rule));
+    CHECK(!nrf_802154_filter_rules_clear(FUZZ_RULES));
+}
+
+static void fuzz(uint32_t frames, uint32_t table_frames)
+{
+    uint8_t  frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint32_t drops                     = 0U;
+    uint32_t stage_drops[FUZZ_STAGES + 1U] = {0};
+    uint32_t mismatches                = 0U;
+
+    nrf_802154_filter_rules_init();
+
+    for (uint32_t i = 0U; i < frames; i++)
+    {
+        nrf_802154_frame_parser_data_t    data;
+        nrf_802154_filter_rules_verdict_t verdict;
+        nrf_802154_filter_rules_verdict_t ref_verdict;
+        uint8_t                           stage;
+
+        if ((i % table_frames) == 0U)
+        {
+            table_replace();
+        }
+
+        frame_random_fill(frame);
+        verdict = incremental_evaluate(frame, &stage);
+
+        (void)nrf_802154_frame_parser_data_init(frame,
+                                                frame[PHR_OFFSET] + PHR_SIZE,
+                                                PARSE_LEVEL_FULL,
+                                                &data);
+        ref_verdict = ref_evaluate(&data);
+
+        if (verdict != ref_verdict)
+        {
+            if (mismatches < FUZZ_REPORTED)
+            {
+                printf("  frame %u: verdict %d instead of %d\n",
+                       (unsigned)i, (int)verdict, (int)ref_verdict);
+            }
+
+            mismatches++;
+        }
+
+        if (verdict == NRF_802154_FILTER_RULES_VERDICT_DROP)
+        {
+            drops++;
+            stage_drops[stage]++;
+        }
+    }
+
+    table_replace();
+    invalid_rules_test();
+
+    m_failures += mismatches;
+
+    printf("fuzz: %u frames, %u dropped (at FCF %u, destination %u, Security Control %u, "
+           "Auxiliary Security Header %u, frame end %u), %u mismatches\n",
+           (unsigned)frames, (unsigned)drops, (unsigned)stage_drops[0], (unsigned)stage_drops[1],
+           (unsigned)stage_drops[2], (unsigned)stage_drops[3], (unsigned)stage_drops[4],
+           (unsigned)mismatches);
+}
+
+/***************************************************************************************************
+ * @section Benchmark
+ **************************************************************************************************/
+
+/**
+ * @brief Builds a benchmark frame with a broadcast destination and an extended source address,
+ *        and records its parser data at the bit-counter matches and at the end of the frame.
+ */
+static void bench_frame_build(uint8_t index, uint8_t fcf0, uint8_t fcf1, uint8_t payload_len)
+{
+    static const nrf_802154_frame_parser_level_t levels[] =
+    {
+        PARSE_LEVEL_FCF_OFFSETS, PARSE_LEVEL_DST_ADDRESSING_END, PARSE_LEVEL_SEC_CTRL_OFFSETS,
+    };
+
+    uint8_t                      * p_frame = m_bench_frames[index];
+    nrf_802154_frame_parser_data_t data;
+    uint8_t                        i   = PHR_SIZE;
+    uint8_t                        bcc = PHR_SIZE + FCF_SIZE;
+
+    p_frame[i++] = fcf0;
+    p_frame[i++] = fcf1;
+    p_frame[i++] = 1U;
+    p_frame[i++] = 0x34;
+    p_frame[i++] = 0x12;
+    p_frame[i++] = 0xff;
+    p_frame[i++] = 0xff;
+
+    for (uint8_t k = 0U; k < EXTENDED_ADDRESS_SIZE; k++)
+    {
+        p_frame[i++] = (k == EXTENDED_ADDRESS_SIZE - 1U) ? 0xf4 : k;
+    }
+
+    p_frame[PHR_OFFSET] = i - PHR_SIZE + payload_len + FCS_SIZE;
+
+    (void)nrf_802154_frame_parser_data_init(p_frame, 0U, PARSE_LEVEL_NONE, &data);
+
+    for (uint8_t stage = 0U; stage < sizeof(levels) / sizeof(levels[0]); stage++)
+    {
+        (void)nrf_802154_frame_parser_valid_data_extend(&data, bcc, levels[stage]);
+        m_bench_stages[index][m_bench_stages_num[index]++] = data;
+
+        bcc = (stage == 0U) ?
+              PHR_SIZE + nrf_802154_frame_parser_dst_addressing_end_offset_get(&data) :
+              PHR_SIZE + nrf_802154_frame_parser_addressing_end_offset_get(&data) +
+              SECURITY_CONTROL_SIZE;
+    }
+
+    (void)nrf_802154_frame_parser_valid_data_extend(&data,
+                                                    p_frame[PHR_OFFSET] + PHR_SIZE,
+                                                    PARSE_LEVEL_FULL);
+    m_bench_stages[index][m_bench_stages_num[index]++] = data;
+}
+
+/**
+ * @brief Sets a gateway table: count the data frames, drop the beacons, count the frames with
+ *        IEs and count the frames of the PAN by source address prefix, dropping the last prefix.
+ */
+static void bench_table_set(uint8_t rules)
+{
+    nrf_802154_filter_rules_init();
+
+    for (uint8_t i = 0U; i < rules; i++)
+    {
+        nrf_802154_filter_rule_t rule;
+
+        memset(&rule, 0, sizeof(rule));
+
+        switch (i)
+        {
+            case 0U:
+                rule.fields      = NRF_802154_FILTER_RULE_FIELD_FRAME_TYPE;
+                rule.frame_types = 1U << FRAME_TYPE_DATA;
+                rule.action      = NRF_802154_FILTER_RULE_ACTION_COUNT;
+                break;
+
+            case 1U:
+                rule.fields      = NRF_802154_FILTER_RULE_FIELD_FRAME_TYPE;
+                rule.frame_types = 1U << FRAME_TYPE_BEACON;
+                rule.action      = NRF_802154_FILTER_RULE_ACTION_DROP;
+                break;
+
+            case 2U:
+                rule.fields     = NRF_802154_FILTER_RULE_FIELD_IE_PRESENT;
+                rule.ie_present = true;
+                rule.action     = NRF_802154_FILTER_RULE_ACTION_COUNT;
+                break;
+
+            default:
+                rule.fields = NRF_802154_FILTER_RULE_FIELD_SRC_ADDR |
+                              NRF_802154_FILTER_RULE_FIELD_SRC_PAN_ID;
+                rule.src_pan_id[0]       = 0x34;
+                rule.src_pan_id[1]       = 0x12;
+                rule.src_addr_extended   = true;
+                rule.src_addr[7]         = 0xf0 + i;
+                rule.src_addr_prefix_len = 8U;
+                rule.action              = (i == rules - 1U) ?
+                                           NRF_802154_FILTER_RULE_ACTION_DROP :
+                                           NRF_802154_FILTER_RULE_ACTION_COUNT;
+                break;
+        }
+
+        CHECK(nrf_802154_filter_rules_set(i, &rule));
+    }
+}
+
+/**
+ * @brief Measures the mean time of all evaluation calls of a frame [ns].
+ */
+static double bench_run(uint32_t frames)
+{
+    volatile uint32_t sink = 0U;
+    uint64_t          best = UINT64_MAX;
+
+    for (uint32_t round = 0U; round < BENCH_ROUNDS; round++)
+    {
+        uint64_t start = nanoseconds_get();
+
+        for (uint32_t i = 0U; i < frames; i++)
+        {
+            uint8_t                           k       = i % BENCH_FRAMES;
+            nrf_802154_filter_rules_verdict_t verdict = NRF_802154_FILTER_RULES_VERDICT_PENDING;
+
+            nrf_802154_filter_rules_frame_reset();
+
+            for (uint8_t s = 0U;
+                 (s < m_bench_stages_num[k]) && (verdict == NRF_802154_FILTER_RULES_VERDICT_PENDING);
+                 s++)
+            {
+                verdict = nrf_802154_filter_rules_evaluate(&m_bench_stages[k][s],
+                                                           s == m_bench_stages_num[k] - 1U);
+            }
+
+            sink += verdict;
+        }
+
+        uint64_t time = nanoseconds_get() - start;
+
+        if (time < best)
+        {
+            best = time;
+        }
+    }
+
+    (void)sink;
+
+    return (double)best / frames;
+}
+
+static void benchmark(uint32_t frames)
+{
+    static const uint8_t rules[] = {0U, 4U, 8U, 16U};
+
+    // Data frame, beacon, data frame with IEs and MAC command.
+    bench_frame_build(0U, FRAME_TYPE_DATA | PAN_ID_COMPR_MASK,
+                      DEST_ADDR_TYPE_SHORT | FRAME_VERSION_1 | SRC_ADDR_TYPE_EXTENDED, 40U);
+    bench_frame_build(1U, FRAME_TYPE_BEACON,
+                      DEST_ADDR_TYPE_NONE | FRAME_VERSION_0 | SRC_ADDR_TYPE_EXTENDED, 20U);
+    bench_frame_build(2U, FRAME_TYPE_DATA | PAN_ID_COMPR_MASK,
+                      DEST_ADDR_TYPE_SHORT | FRAME_VERSION_2 | SRC_ADDR_TYPE_EXTENDED |
+                      IE_PRESENT_BIT, 30U);
+    bench_frame_build(3U, FRAME_TYPE_COMMAND | PAN_ID_COMPR_MASK,
+                      DEST_ADDR_TYPE_SHORT | FRAME_VERSION_1 | SRC_ADDR_TYPE_EXTENDED, 10U);
+
+    printf("\nbenchmark: all evaluation calls of a frame, best of %u rounds\n",
+           (unsigned)BENCH_ROUNDS);
+
+    for (size_t i = 0U; i < sizeof(rules) / sizeof(rules[0]); i++)
+    {
+        if (rules[i] > FUZZ_RULES)
+        {
+            break;
+        }
+
+        bench_table_set(rules[i]);
+        printf("  %2u rules: %6.1f ns/frame\n", (unsigned)rules[i], bench_run(frames));
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t frames       = 300000U;
+    uint32_t table_frames = 1000U;
+    uint32_t bench_frames = 200000U;
+    uint32_t seed         = 12345U;
+    int      opt          = 1;
+
+    while (opt + 1 < argc)
+    {
+        unsigned long value = strtoul(argv[opt + 1], NULL, 0);
+
+        if (strcmp(argv[opt], "-n") == 0)
+        {
+            frames = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-t") == 0)
+        {
+            table_frames = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-b") == 0)
+        {
+            bench_frames = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-s") == 0)
+        {
+            seed = (uint32_t)value;
+        }
+        else
+        {
+            break;
+        }
+
+        opt += 2;
+    }
+
+    if ((opt != argc) || (seed == 0U) || (table_frames == 0U) || (bench_frames == 0U))
+    {
+        fprintf(stderr,
+                "Usage: %s [-n <frames>] [-t <frames per table>] [-b <benchmark frames>] "
+                "[-s <seed>]\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    m_rand_state = seed;
+
+    fuzz(frames, table_frames);
+    benchmark(bench_frames);
+
+    if (m_failures != 0U)
+    {
+        printf("\n%u checks failed\n", (unsigned)m_failures);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
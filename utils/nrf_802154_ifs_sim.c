@@ -0,0 +1,424 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run simulation of the interframe spacing with a saturated transmit queue.
+ *
+ * The simulation links nrf_802154_ifs.c, the frame parser and the statistics unchanged. The higher
+ * layer transmits frames back to back to one or more peers, in round-robin or random order, with
+ * a fixed software latency between the end of a frame and the request of the next one. Requests
+ * delayed by the IFS module are released when its timer fires.
+ *
+ * Every frame must be released exactly when the interframe space it requires ends: in the matching
+ * addresses mode the one of the last frame sent to its destination, and in the always mode the
+ * latest one of all peers. In particular, no peer may receive a frame before the interframe space
+ * after its previous frame has elapsed, and the delay reported by the statistics must equal
+ * the delay added. The simulation prints the throughput and the mean added delay per frame for
+ * both modes. The program exits with a failure if any check fails.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -DNRF_802154_IFS_ENABLED=1 \
+ *         -o ifs_sim ../../utils/nrf_802154_ifs_sim.c \
+ *         driver/src/mac_features/nrf_802154_ifs.c \
+ *         driver/src/mac_features/nrf_802154_frame_parser.c driver/src/nrf_802154_stats.c \
+ *         -Icommon/include -Idriver/include -Idriver/src -Idriver/src/mac_features \
+ *         -Isl/include -Isl/sl_opensource/include \
+ *         -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis>
+ *
+ * Usage:
+ *
+ *     ifs_sim [-n <frames>] [-d <maximum number of peers>] [-s <seed>]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_notification.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_stats.h"
+#include "nrf_802154_sl_timer.h"
+#include "mac_features/nrf_802154_ifs.h"
+
+#if !NRF_802154_IFS_ENABLED
+#error "The simulation requires NRF_802154_IFS_ENABLED=1"
+#endif
+
+#define SIM_MAX_PEERS     16U  ///< Maximum number of peers.
+#define SIM_SIFS_US       192U ///< macSifsPeriod [us].
+#define SIM_LIFS_US       640U ///< macLifsPeriod [us].
+#define SIM_SHR_PHR_US    160U ///< Duration of the synchronization header and the PHR [us].
+#define SIM_OCTET_US      32U  ///< Duration of one octet [us].
+#define SIM_RAMP_UP_US    40U  ///< Transmitter ramp-up time [us].
+#define SIM_LATENCY_US    20U  ///< Software latency until the next frame is requested [us].
+#define SIM_LONG_LENGTH   60U  ///< PSDU length of a long frame.
+#define SIM_SHORT_LENGTH  12U  ///< PSDU length of a short frame.
+#define SIM_MIXED_SHORT   9U   ///< PSDU length of a short frame of the mixed traffic.
+
+#define CHECK(cond)                                                     \
+    do                                                                  \
+    {                                                                   \
+        if (!(cond))                                                    \
+        {                                                               \
+            printf("  check failed at line %d: %s\n", __LINE__, #cond); \
+            m_failures++;                                               \
+        }                                                               \
+    }                                                                   \
+    while (0)
+
+/**@brief Lengths of the transmitted frames. */
+typedef enum
+{
+    SIM_LENGTHS_LONG,  ///< Only long frames, which require the LIFS.
+    SIM_LENGTHS_SHORT, ///< Only short frames, which require the SIFS.
+    SIM_LENGTHS_MIXED, ///< Long and short frames at random.
+    SIM_LENGTHS_NUM,
+} sim_lengths_t;
+
+/**@brief Result of a run. */
+typedef struct
+{
+    double   frames_per_second; ///< Throughput.
+    uint32_t delayed;           ///< Number of delayed frames reported by the statistics.
+    double   delay_us;          ///< Mean delay per frame reported by the statistics [us].
+} sim_result_t;
+
+/**@brief Last frame received by a peer. */
+typedef struct
+{
+    bool     used;   ///< If the peer has received a frame.
+    uint64_t end;    ///< End of the frame [us].
+    uint8_t  length; ///< PSDU length of the frame.
+} sim_peer_t;
+
+static uint32_t                m_failures;             ///< Number of failed checks.
+static uint32_t                m_rand_state;           ///< State of the pseudo-random generator.
+static uint64_t                m_now;                  ///< Current time [us].
+static nrf_802154_ifs_mode_t   m_mode;                 ///< IFS mode of the PIB.
+static nrf_802154_sl_timer_t * mp_timer;               ///< Timer added by the IFS module.
+static bool                    m_released;             ///< If the frame was requested from the core.
+static sim_peer_t              m_peers[SIM_MAX_PEERS]; ///< Peers of the current run.
+
+static const char * const m_lengths_names[SIM_LENGTHS_NUM] = {"long", "short", "mixed"};
+
+static uint32_t xorshift32(uint32_t * p_state)
+{
+    uint32_t x = *p_state;
+
+    x        ^= x << 13;
+    x        ^= x >> 17;
+    x        ^= x << 5;
+    *p_state  = x;
+
+    return x;
+}
+
+void nrf_802154_assert_handler(void)
+{
+    printf("  driver assertion failed\n");
+    abort();
+}
+
+/***************************************************************************************************
+ * @section Driver environment
+ **************************************************************************************************/
+
+nrf_802154_ifs_mode_t nrf_802154_pib_ifs_mode_get(void)
+{
+    return m_mode;
+}
+
+uint16_t nrf_802154_pib_ifs_min_sifs_period_get(void)
+{
+    return SIM_SIFS_US;
+}
+
+uint16_t nrf_802154_pib_ifs_min_lifs_period_get(void)
+{
+    return SIM_LIFS_US;
+}
+
+uint64_t nrf_802154_sl_timer_current_time_get(void)
+{
+    return m_now;
+}
+
+void nrf_802154_sl_timer_init(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+}
+
+void nrf_802154_sl_timer_deinit(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+}
+
+nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_add(nrf_802154_sl_timer_t * p_timer)
+{
+    CHECK(mp_timer == NULL);
+    mp_timer = p_timer;
+
+    return NRF_802154_SL_TIMER_RET_SUCCESS;
+}
+
+bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
+                                 req_originator_t               req_orig,
+                                 uint8_t                      * p_data,
+                                 nrf_802154_transmit_params_t * p_params,
+                                 nrf_802154_notification_func_t notify_function)
+{
+    (void)term_lvl;
+    (void)p_data;
+    (void)notify_function;
+
+    CHECK(req_orig == REQ_ORIG_IFS);
+    CHECK(p_params->immediate);
+    m_released = true;
+
+    return true;
+}
+
+void nrf_802154_notify_transmit_failed(uint8_t                                   * p_frame,
+                                       nrf_802154_tx_error_t                       error,
+                                       const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    (void)p_frame;
+    (void)error;
+    (void)p_metadata;
+
+    CHECK(false);
+}
+
+/***************************************************************************************************
+ * @section Simulation
+ **************************************************************************************************/
+
+static void frame_build(uint8_t * p_frame, uint8_t peer, uint8_t length)
+{
+    memset(p_frame, 0, MAX_PACKET_SIZE + PHR_SIZE);
+
+    p_frame[PHR_OFFSET]   = length;
+    p_frame[PHR_SIZE]    = FRAME_TYPE_DATA | PAN_ID_COMPR_MASK;
+    p_frame[PHR_SIZE + 1] = DEST_ADDR_TYPE_SHORT | SRC_ADDR_TYPE_SHORT | FRAME_VERSION_0;
+    p_frame[PHR_SIZE + 2] = 1U;
+    p_frame[PHR_SIZE + 3] = 0xcd;
+    p_frame[PHR_SIZE + 4] = 0xab;
+    p_frame[PHR_SIZE + 5] = 0x10 + peer;
+    p_frame[PHR_SIZE + 7] = 0x01;
+}
+
+static uint64_t peer_ifs_end(const sim_peer_t * p_peer)
+{
+    return p_peer->end + ((p_peer->length > MAX_SIFS_FRAME_SIZE) ? SIM_LIFS_US : SIM_SIFS_US);
+}
+
+/**
+ * @brief Gets the earliest time a frame to the given peer may be transmitted.
+ */
+static uint64_t release_time_get(uint8_t peer, uint8_t peers)
+{
+    uint64_t release = m_now;
+
+    for (uint8_t i = 0U; i < peers; i++)
+    {
+        bool relevant = (m_mode == NRF_802154_IFS_MODE_ALWAYS) || (i == peer);
+
+        if (relevant && m_peers[i].used && (peer_ifs_end(&m_peers[i]) > release))
+        {
+            release = peer_ifs_end(&m_peers[i]);
+        }
+    }
+
+    return release;
+}
+
+static void run(uint8_t        peers,
+                bool           random_order,
+                sim_lengths_t  lengths,
+                uint32_t       frames,
+                sim_result_t * p_result)
+{
+    uint8_t                    frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint64_t                   delay_us = 0U;
+    nrf_802154_stat_counters_t counters;
+
+    m_now = 0U;
+    memset(m_peers, 0, sizeof(m_peers));
+    nrf_802154_stat_counters_reset();
+    nrf_802154_ifs_init();
+
+    for (uint32_t i = 0U; i < frames; i++)
+    {
+        nrf_802154_transmit_params_t params = {0};
+        uint8_t                      peer   = random_order ? xorshift32(&m_rand_state) % peers :
+                                              i % peers;
+        uint8_t                      length;
+        uint64_t                     release;
+
+        switch (lengths)
+        {
+            case SIM_LENGTHS_LONG:
+                length = SIM_LONG_LENGTH;
+                break;
+
+            case SIM_LENGTHS_SHORT:
+                length = SIM_SHORT_LENGTH;
+                break;
+
+            default:
+                length = (xorshift32(&m_rand_state) & 1U) ? SIM_LONG_LENGTH : SIM_MIXED_SHORT;
+                break;
+        }
+
+        frame_build(frame, peer, length);
+        release    = release_time_get(peer, peers);
+        m_released = false;
+        mp_timer   = NULL;
+
+        if (nrf_802154_ifs_pretransmission(frame, &params, NULL))
+        {
+            m_released = true;
+        }
+        else if (mp_timer != NULL)
+        {
+            delay_us += mp_timer->trigger_time - m_now;
+            m_now     = mp_timer->trigger_time;
+            mp_timer->action.callback.callback(mp_timer);
+        }
+
+        CHECK(m_released);
+        CHECK(m_now == release);
+
+        m_now += SIM_RAMP_UP_US + SIM_SHR_PHR_US + length * SIM_OCTET_US;
+        nrf_802154_ifs_transmitted_hook(frame);
+
+        m_peers[peer].used   = true;
+        m_peers[peer].end    = m_now;
+        m_peers[peer].length = length;
+
+        m_now += SIM_LATENCY_US;
+    }
+
+    nrf_802154_ifs_deinit();
+    nrf_802154_stat_counters_get(&counters);
+
+    CHECK(counters.ifs_delay_us == delay_us);
+
+    p_result->frames_per_second = frames * 1e6 / m_now;
+    p_result->delayed           = counters.ifs_delayed_transmissions;
+    p_result->delay_us          = (double)counters.ifs_delay_us / frames;
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t frames    = 10000U;
+    uint32_t max_peers = 4U;
+    uint32_t seed      = 1U;
+    int      opt       = 1;
+
+    while (opt + 1 < argc)
+    {
+        unsigned long value = strtoul(argv[opt + 1], NULL, 0);
+
+        if (strcmp(argv[opt], "-n") == 0)
+        {
+            frames = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-d") == 0)
+        {
+            max_peers = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-s") == 0)
+        {
+            seed = (uint32_t)value;
+        }
+        else
+        {
+            break;
+        }
+
+        opt += 2;
+    }
+
+    if ((opt != argc) || (frames == 0U) || (max_peers == 0U) || (max_peers > SIM_MAX_PEERS) ||
+        (seed == 0U))
+    {
+        fprintf(stderr, "Usage: %s [-n <frames>] [-d <maximum number of peers>] [-s <seed>]\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    printf("peers  order   lengths   frames/s matching  frames/s always  gain    "
+           "delayed  delay [us/frame]\n");
+
+    for (uint32_t order = 0U; order < 2U; order++)
+    {
+        for (uint32_t lengths = 0U; lengths < SIM_LENGTHS_NUM; lengths++)
+        {
+            for (uint8_t peers = 1U; peers <= max_peers; peers++)
+            {
+                sim_result_t matching;
+                sim_result_t always;
+
+                m_rand_state = seed;
+                m_mode       = NRF_802154_IFS_MODE_MATCHING_ADDRESSES;
+                run(peers, order != 0U, (sim_lengths_t)lengths, frames, &matching);
+
+                m_rand_state = seed;
+                m_mode       = NRF_802154_IFS_MODE_ALWAYS;
+                run(peers, order != 0U, (sim_lengths_t)lengths, frames, &always);
+
+                printf("%5u  %-6s  %-7s  %17.1f  %15.1f  %+5.1f%%  %7u  %16.1f\n",
+                       (unsigned)peers, order ? "random" : "rr", m_lengths_names[lengths],
+                       matching.frames_per_second, always.frames_per_second,
+                       100.0 * (matching.frames_per_second / always.frames_per_second - 1.0),
+                       (unsigned)matching.delayed, matching.delay_us);
+            }
+        }
+    }
+
+    if (m_failures != 0U)
+    {
+        printf("\n%u checks failed\n", (unsigned)m_failures);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,415 @@
+"""
+Utility script to decode the nRF 802.15.4 Radio Driver debug log into a timeline.
+
+The debug log consists of 32-bit words recorded by the nrf_802154_sl_log_* macros.
+Module, event and parameter names are taken from the enums in the given headers
+(nrf_802154_debug_log_codes.h and the headers defining event parameter enums).
+Function names are read from the ELF file of the application, because the log
+holds only the 20 least significant bits of the address of __func__.
+
+Two kinds of input are supported:
+
+- dump: a memory dump of g_nrf_802154_sl_log_buffer. The log holds no time, so
+  consecutive entries are placed 1 us apart. Pass --write-index with the value of
+  gp_nrf_802154_sl_log_ptr to order the entries of a buffer that wrapped around.
+- stream: words drained with nrf_802154_sl_log_stream_drain(). Entries are placed
+  in time between the TIMESTAMP words of consecutive drains. The input may be a
+  pipe, in which case the output is produced as the words arrive.
+
+The output is a Chrome trace in the JSON array format, which can be opened in
+Perfetto or chrome://tracing, or a plain text timeline.
+
+Usage:
+
+    python nrf_802154_log_decoder.py \
+        --codes <header> [--codes <header> ...] \
+        [--elf <elf_file>] \
+        [--format dump|stream] \
+        [--write-index <index>] \
+        [--text] \
+        [--output <output_file>] \
+        <input_file | ->
+
+Copyright (c) 2025 Nordic Semiconductor ASA
+SPDX-License-Identifier: Apache-2.0
+"""
+
+import argparse
+import json
+from pathlib import Path
+import re
+import struct
+import sys
+
+
+LOG_TYPE_FUNCTION_ENTER = 1
+LOG_TYPE_FUNCTION_EXIT = 2
+LOG_TYPE_LOCAL_EVENT = 3
+LOG_TYPE_GLOBAL_EVENT = 4
+LOG_TYPE_TIMESTAMP = 5
+LOG_TYPE_LOST = 6
+
+LOG_TYPE_BITPOS = 28
+LOG_MODULE_ID_BITPOS = 22
+LOG_EVENT_ID_BITPOS = 16
+LOG_PAYLOAD_MASK = (1 << LOG_TYPE_BITPOS) - 1
+LOG_FUNC_MASK = 0x000FFFFF
+
+MODULE_ID_PREFIXES = ("NRF_802154_DRV_MODULE_ID_", "NRF_802154_MPSL_MODULE_ID_",
+                      "NRF_802154_SL_MODULE_ID_")
+GLOBAL_EVENT_PREFIX = "NRF_802154_LOG_GLOBAL_EVENT_ID_"
+LOCAL_EVENT_DEFINE_RE = re.compile(
+    r"NRF_802154_LOG_L_EVENT_DEFINE\s*\(\s*(\w+)\s*,\s*(\w+)\s*,\s*(\w+)\s*,\s*(\w+)\s*\)")
+LOCAL_EVENT_RE = re.compile(r"NRF_802154_LOG_LOCAL_EVENT_ID_(\w+?)__(\w+)")
+ENUM_RE = re.compile(r"typedef\s+enum\s*\w*\s*\{(.*?)\}\s*(\w+)\s*;", re.S)
+
+
+class Codes:
+    """Names of modules, events and event parameters parsed from C headers."""
+
+    def __init__(self):
+        self.modules = {}
+        self.global_events = {}
+        self.local_events = {}
+        self.enums = {}
+
+    def load(self, path):
+        text = Path(path).read_text()
+        text = re.sub(r"/\*.*?\*/", " ", text, flags=re.S)
+        text = re.sub(r"//[^\n]*", " ", text)
+        text = re.sub(r"^\s*#[^\n]*", " ", text, flags=re.M)
+
+        for module, event, event_id, param_enum in LOCAL_EVENT_DEFINE_RE.findall(text):
+            self.local_events[(module, int(event_id, 0))] = (event, param_enum)
+        text = LOCAL_EVENT_DEFINE_RE.sub(" ", text)
+
+        for body, name in ENUM_RE.findall(text):
+            values = parse_enum(body)
+            self.enums[name] = values
+            for value, label in values.items():
+                self._classify(label, value)
+
+    def _classify(self, label, value):
+        for prefix in MODULE_ID_PREFIXES:
+            if label.startswith(prefix):
+                self.modules[value] = label[len(prefix):]
+                return
+        if label.startswith(GLOBAL_EVENT_PREFIX):
+            self.global_events[value] = label[len(GLOBAL_EVENT_PREFIX):]
+            return
+        match = LOCAL_EVENT_RE.fullmatch(label)
+        if match:
+            self.local_events.setdefault((match.group(1), value), (match.group(2), None))
+
+    def module_name(self, module_id):
+        return self.modules.get(module_id, f"MODULE_{module_id}")
+
+    def local_event(self, module_id, event_id, param):
+        event, param_enum = self.local_events.get((self.module_name(module_id), event_id),
+                                                  (f"EVENT_{event_id}", None))
+        return event, self.enums.get(param_enum, {}).get(param, param)
+
+    def global_event(self, event_id):
+        return self.global_events.get(event_id, f"GLOBAL_EVENT_{event_id}")
+
+
+def parse_enum(body):
+    values = {}
+    known = {}
+    next_value = 0
+
+    for item in body.split(","):
+        item = item.strip()
+        if not item:
+            continue
+        name, _, expr = item.partition("=")
+        name = name.strip()
+        if expr.strip():
+            next_value = eval_int(expr, known)
+        known[name] = next_value
+        # Keep the first name of values with aliases, e.g. *_ALLOWED_MSK defined last.
+        values.setdefault(next_value, name)
+        next_value += 1
+
+    return values
+
+
+def eval_int(expr, known):
+    expr = re.sub(r"\b(0[xX][0-9a-fA-F]+|\d+)[uUlL]*\b", r"\1", expr)
+    expr = re.sub(r"\b[A-Za-z_]\w*\b", lambda m: str(known.get(m.group(0), 0)), expr)
+    if not re.fullmatch(r"[\s\d xXa-fA-F()+\-*/<>|&~^]*", expr):
+        sys.exit(f"Unsupported enum value expression: {expr}")
+    return int(eval(expr.replace("/", "//"), {"__builtins__": {}}))
+
+
+class ElfStrings:
+    """Reads strings from the loadable sections of an ELF file."""
+
+    def __init__(self, path):
+        data = Path(path).read_bytes()
+        if data[:4] != b"\x7fELF":
+            sys.exit(f"{path} is not an ELF file")
+
+        is_64 = data[4] == 2
+        endian = "<" if data[5] == 1 else ">"
+        if is_64:
+            shoff, = struct.unpack_from(endian + "Q", data, 0x28)
+            shentsize, shnum = struct.unpack_from(endian + "HH", data, 0x3A)
+            sh_format = endian + "IIQQQQ"
+        else:
+            shoff, = struct.unpack_from(endian + "I", data, 0x20)
+            shentsize, shnum = struct.unpack_from(endian + "HH", data, 0x2E)
+            sh_format = endian + "IIIIII"
+
+        self.sections = []
+        for i in range(shnum):
+            _, sh_type, flags, addr, offset, size = struct.unpack_from(
+                sh_format, data, shoff + i * shentsize)
+            # SHT_PROGBITS sections occupying memory during execution.
+            if sh_type == 1 and (flags & 0x2) and size:
+                self.sections.append((addr, data[offset:offset + size]))
+
+        self.cache = {}
+
+    def lookup(self, func_id):
+        if func_id not in self.cache:
+            self.cache[func_id] = self._find(func_id)
+        return self.cache[func_id]
+
+    def _find(self, func_id):
+        for addr, content in self.sections:
+            candidate = (addr & ~LOG_FUNC_MASK) | func_id
+            if candidate < addr:
+                candidate += LOG_FUNC_MASK + 1
+            offset = candidate - addr
+            if offset >= len(content):
+                continue
+            end = content.find(b"\0", offset)
+            name = content[offset:end if end >= 0 else None]
+            if re.fullmatch(rb"[A-Za-z_]\w*", name):
+                return name.decode()
+        return None
+
+
+def dump_words(data, write_index=None):
+    """Orders the words of a log buffer dump from the oldest to the newest."""
+    count = len(data) // 4
+    words = list(struct.unpack(f"<{count}I", data[:count * 4]))
+    if write_index is not None:
+        write_index %= max(count, 1)
+        words = words[write_index:] + words[:write_index]
+    # Type 0 is reserved for empty entries of a buffer that did not wrap around yet.
+    return [word for word in words if word >> LOG_TYPE_BITPOS]
+
+
+def stream_words(stream):
+    """Yields words of a log stream as they arrive."""
+    pending = b""
+    while True:
+        chunk = stream.read1(4096) if hasattr(stream, "read1") else stream.read(4096)
+        if not chunk:
+            break
+        pending += chunk
+        count = len(pending) // 4
+        yield from struct.unpack(f"<{count}I", pending[:count * 4])
+        pending = pending[count * 4:]
+
+
+class Decoder:
+    """Turns log words into a sequence of timeline events.
+
+    Function enter and exit entries are matched with a stack. Entries can be lost when
+    the buffer wraps around or when a log write is preempted, so an exit that does not
+    match the innermost open function closes all functions opened after the matching one.
+    An exit without a matching enter becomes an instant event.
+    """
+
+    def __init__(self, codes, elf, sink):
+        self.codes = codes
+        self.elf = elf
+        self.sink = sink
+        self.stack = []
+        self.pending = []
+        self.time = None
+        self.time_raw = None
+        self.last_ts = 0.0
+
+    def function_name(self, module_id, func_id):
+        name = self.elf.lookup(func_id) if self.elf else None
+        return name or f"{self.codes.module_name(module_id)}:0x{func_id:05x}"
+
+    def feed(self, word, timed):
+        log_type = word >> LOG_TYPE_BITPOS
+        payload = word & LOG_PAYLOAD_MASK
+
+        if log_type == LOG_TYPE_TIMESTAMP:
+            self._timestamp(payload)
+        elif log_type == LOG_TYPE_LOST:
+            self.pending.append(("lost", payload))
+        else:
+            self.pending.append(("entry", word))
+            if not timed:
+                self._flush(self.last_ts + 1)
+
+    def _timestamp(self, raw):
+        if self.time is None:
+            # Entries drained before the first timestamp have no lower time bound.
+            self.time = float(raw)
+            start = self.time - len(self.pending)
+            self.last_ts = start
+        else:
+            self.time += (raw - self.time_raw) & LOG_PAYLOAD_MASK
+        self.time_raw = raw
+        self._flush(self.time)
+
+    def _flush(self, end):
+        if not self.pending:
+            return
+        step = (end - self.last_ts) / len(self.pending)
+        for i, (kind, value) in enumerate(self.pending):
+            ts = self.last_ts + step * (i + 1)
+            if kind == "lost":
+                self.sink.instant(ts, "LOST", "log", {"entries": value})
+            else:
+                self._entry(ts, value)
+        self.pending = []
+        self.last_ts = end
+
+    def _entry(self, ts, word):
+        log_type = word >> LOG_TYPE_BITPOS
+        module_id = (word >> LOG_MODULE_ID_BITPOS) & 0x3F
+        module = self.codes.module_name(module_id)
+
+        if log_type == LOG_TYPE_FUNCTION_ENTER:
+            name = self.function_name(module_id, word & LOG_FUNC_MASK)
+            self.stack.append(name)
+            self.sink.begin(ts, name, module, len(self.stack))
+        elif log_type == LOG_TYPE_FUNCTION_EXIT:
+            name = self.function_name(module_id, word & LOG_FUNC_MASK)
+            if name in self.stack:
+                while self.stack:
+                    top = self.stack.pop()
+                    self.sink.end(ts, top, module, len(self.stack) + 1, top != name)
+                    if top == name:
+                        break
+            else:
+                self.sink.instant(ts, f"{name} (exit)", module, {})
+        elif log_type in (LOG_TYPE_LOCAL_EVENT, LOG_TYPE_GLOBAL_EVENT):
+            event_id = (word >> LOG_EVENT_ID_BITPOS) & 0x3F
+            param = word & 0xFFFF
+            if log_type == LOG_TYPE_LOCAL_EVENT:
+                event, param = self.codes.local_event(module_id, event_id, param)
+            else:
+                event = self.codes.global_event(event_id)
+            self.sink.instant(ts, event, module, {"param": param})
+        else:
+            self.sink.instant(ts, f"UNKNOWN 0x{word:08x}", "log", {})
+
+    def finish(self):
+        self._flush(self.last_ts + len(self.pending))
+        while self.stack:
+            name = self.stack.pop()
+            self.sink.end(self.last_ts, name, "", len(self.stack) + 1, True)
+        self.sink.close()
+
+
+class ChromeTraceSink:
+    """Writes events in the Chrome trace JSON array format.
+
+    The closing bracket is optional in this format, so the trace stays usable even if
+    a streaming capture is interrupted.
+    """
+
+    def __init__(self, out):
+        self.out = out
+        self.first = True
+        self.out.write("[\n")
+
+    def _write(self, event):
+        event.update(pid=1, tid=1)
+        self.out.write(("" if self.first else ",\n") + json.dumps(event))
+        self.first = False
+
+    def begin(self, ts, name, module, depth):
+        self._write({"name": name, "cat": module, "ph": "B", "ts": ts})
+
+    def end(self, ts, name, module, depth, truncated):
+        event = {"name": name, "ph": "E", "ts": ts}
+        if truncated:
+            event["args"] = {"truncated": True}
+        self._write(event)
+
+    def instant(self, ts, name, module, args):
+        self._write({"name": name, "cat": module, "ph": "i", "s": "t", "ts": ts, "args": args})
+        self.out.flush()
+
+    def close(self):
+        self.out.write("\n]\n")
+        self.out.flush()
+
+
+class TextSink:
+    """Writes events as an indented plain text timeline."""
+
+    def __init__(self, out):
+        self.out = out
+        self.depth = 0
+
+    def _write(self, ts, text):
+        self.out.write(f"{ts:14.3f}  {'  ' * self.depth}{text}\n")
+
+    def begin(self, ts, name, module, depth):
+        self.depth = depth - 1
+        self._write(ts, f"> {name} [{module}]")
+        self.depth = depth
+
+    def end(self, ts, name, module, depth, truncated):
+        self.depth = depth - 1
+        self._write(ts, f"< {name}" + (" (truncated)" if truncated else ""))
+
+    def instant(self, ts, name, module, args):
+        details = " ".join(f"{key}={value}" for key, value in args.items())
+        self._write(ts, f"* {name} [{module}] {details}".rstrip())
+        self.out.flush()
+
+    def close(self):
+        self.out.flush()
+
+
+def decode(words, codes, elf, sink, timed):
+    decoder = Decoder(codes, elf, sink)
+    for word in words:
+        decoder.feed(word, timed)
+    decoder.finish()
+
+
+if __name__ == "__main__":
+    parser = argparse.ArgumentParser(allow_abbrev=False)
+    parser.add_argument("--codes", type=Path, action="append", required=True,
+                        help="Header defining log module, event or parameter enums "
+                             "(can be repeated)")
+    parser.add_argument("--elf", type=Path, help="ELF file of the application")
+    parser.add_argument("--format", choices=("dump", "stream"), default="dump",
+                        help="Format of the input")
+    parser.add_argument("--write-index", type=lambda value: int(value, 0),
+                        help="Value of gp_nrf_802154_sl_log_ptr when the dump was taken")
+    parser.add_argument("--text", action="store_true",
+                        help="Produce a plain text timeline instead of a Chrome trace")
+    parser.add_argument("--output", type=Path, help="Output file, standard output by default")
+    parser.add_argument("input", help="Input file, '-' for standard input")
+    args = parser.parse_args()
+
+    codes = Codes()
+    for header in args.codes:
+        codes.load(header)
+    elf = ElfStrings(args.elf) if args.elf else None
+
+    in_file = sys.stdin.buffer if args.input == "-" else open(args.input, "rb")
+    out_file = open(args.output, "w") if args.output else sys.stdout
+    sink = TextSink(out_file) if args.text else ChromeTraceSink(out_file)
+
+    with in_file, out_file:
+        if args.format == "dump":
+            decode(dump_words(in_file.read(), args.write_index), codes, elf, sink, False)
+        else:
+            decode(stream_words(in_file), codes, elf, sink, True)
@@ -0,0 +1,305 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run test of the neighbor table.
+ *
+ * The test links nrf_802154_neighbor_table.c and the frame parser unchanged and feeds the table
+ * with frames the way the core does: received frames parsed up to the addressing fields, and
+ * transmitted frames through the transmitted and TX failed hooks. It checks:
+ *
+ * - averaging of the RSSI and LQI of the received frames, the received frame count and the time
+ *   of the last received frame,
+ * - the Link Metrics average of a frame being acknowledged, which leaves the table unchanged,
+ * - counting of the transmitted frames with the Ack Request bit set and of their Acks,
+ * - replacement of the least recently active neighbor when the table is full,
+ * - bulk and single queries, and clearing of the table.
+ *
+ * The program exits with a failure if any check fails.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -DNRF_802154_NEIGHBOR_TABLE_ENABLED=1 \
+ *         -o neighbor_table_test ../../utils/nrf_802154_neighbor_table_test.c \
+ *         driver/src/mac_features/nrf_802154_neighbor_table.c \
+ *         driver/src/mac_features/nrf_802154_frame_parser.c \
+ *         -Icommon/include -Idriver/include -Idriver/src -Idriver/src/mac_features \
+ *         -Isl/include -Isl/sl_opensource/include \
+ *         -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis>
+ *
+ * Usage:
+ *
+ *     neighbor_table_test
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nrf_802154_const.h"
+#include "nrf_802154_types.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/nrf_802154_neighbor_table.h"
+
+#define TEST_PAN_ID 0x1234U ///< PAN ID of the frames.
+
+#define CHECK(cond)                                                     \
+    do                                                                  \
+    {                                                                   \
+        if (!(cond))                                                    \
+        {                                                               \
+            printf("  check failed at line %d: %s\n", __LINE__, #cond); \
+            m_failures++;                                               \
+        }                                                               \
+    }                                                                   \
+    while (0)
+
+static uint32_t m_failures; ///< Number of failed checks.
+static uint64_t m_now;      ///< Current time returned to the neighbor table [us].
+
+/***************************************************************************************************
+ * @section Stubs of the driver
+ **************************************************************************************************/
+
+uint64_t nrf_802154_sl_timer_current_time_get(void)
+{
+    return m_now;
+}
+
+/***************************************************************************************************
+ * @section Frames
+ **************************************************************************************************/
+
+/**
+ * @brief Builds a 2006 data frame with PAN ID compression and a short source address.
+ *
+ * @param[out]  p_frame      Buffer for the PHR and PSDU of the frame.
+ * @param[in]   src          Short address of the source, the destination address is derived
+ *                           from it.
+ * @param[in]   ack_request  If the Ack Request bit is set.
+ * @param[in]   ext_dst      If the destination address is extended.
+ */
+static void frame_build(uint8_t * p_frame, uint8_t src, bool ack_request, bool ext_dst)
+{
+    uint8_t i = PHR_SIZE;
+
+    p_frame[i++] = FRAME_TYPE_DATA | PAN_ID_COMPR_MASK | (ack_request ? ACK_REQUEST_BIT : 0U);
+    p_frame[i++] = (ext_dst ? DEST_ADDR_TYPE_EXTENDED : DEST_ADDR_TYPE_SHORT) |
+                   FRAME_VERSION_1 | SRC_ADDR_TYPE_SHORT;
+    p_frame[i++] = 1U;
+    p_frame[i++] = (uint8_t)TEST_PAN_ID;
+    p_frame[i++] = (uint8_t)(TEST_PAN_ID >> 8);
+
+    if (ext_dst)
+    {
+        for (uint8_t k = 0; k < EXTENDED_ADDRESS_SIZE; k++)
+        {
+            p_frame[i++] = src + k;
+        }
+    }
+    else
+    {
+        p_frame[i++] = src;
+        p_frame[i++] = 0U;
+    }
+
+    p_frame[i++] = src;
+    p_frame[i++] = 0U;
+    p_frame[i++] = 0xaaU;
+
+    i         += FCS_SIZE;
+    p_frame[0] = i - PHR_SIZE;
+}
+
+/**
+ * @brief Records a frame received from a short address the way the core does.
+ */
+static void frame_receive(uint8_t src, int8_t rssi, uint8_t lqi)
+{
+    uint8_t                        frame[MAX_PACKET_SIZE + PHR_SIZE];
+    nrf_802154_frame_parser_data_t frame_data;
+
+    frame_build(frame, src, false, false);
+    CHECK(nrf_802154_frame_parser_data_init(frame,
+                                            frame[PHR_OFFSET] + PHR_SIZE,
+                                            PARSE_LEVEL_ADDRESSING_END,
+                                            &frame_data));
+    nrf_802154_neighbor_table_rx_record(&frame_data, rssi, lqi);
+}
+
+/***************************************************************************************************
+ * @section Tests
+ **************************************************************************************************/
+
+static void average_test(void)
+{
+    uint32_t              failures = m_failures;
+    uint8_t               addr[SHORT_ADDRESS_SIZE]    = {1U, 0U};
+    uint8_t               unknown[SHORT_ADDRESS_SIZE] = {9U, 9U};
+    nrf_802154_neighbor_t neighbor;
+    int8_t                rssi;
+    uint8_t               lqi;
+
+    nrf_802154_neighbor_table_init();
+
+    // The first frame sets the averages, the following ones converge to their values.
+    m_now = 100U;
+    frame_receive(1U, -60, 200U);
+
+    for (uint32_t i = 0; i < 100U; i++)
+    {
+        m_now++;
+        frame_receive(1U, -80, 100U);
+    }
+
+    CHECK(nrf_802154_neighbor_table_entry_copy(addr, false, &neighbor));
+    CHECK((neighbor.rssi >= -80) && (neighbor.rssi <= -79));
+    CHECK((neighbor.lqi >= 100U) && (neighbor.lqi <= 101U));
+    CHECK(neighbor.rx_frames == 101U);
+    CHECK(neighbor.last_rx_time == 200U);
+
+    // The frame being acknowledged is averaged with the neighbor, which stays unchanged.
+    rssi = -40;
+    lqi  = 255U;
+    nrf_802154_neighbor_table_link_metrics_get(addr, SHORT_ADDRESS_SIZE, &rssi, &lqi);
+    CHECK(rssi == -75);
+    CHECK(lqi == 120U);
+    CHECK(nrf_802154_neighbor_table_entry_copy(addr, false, &neighbor));
+    CHECK(neighbor.rx_frames == 101U);
+
+    // An unknown source leaves the values of the frame.
+    rssi = -40;
+    lqi  = 255U;
+    nrf_802154_neighbor_table_link_metrics_get(unknown, SHORT_ADDRESS_SIZE, &rssi, &lqi);
+    CHECK(rssi == -40);
+    CHECK(lqi == 255U);
+    CHECK(!nrf_802154_neighbor_table_entry_copy(unknown, false, &neighbor));
+
+    printf("average: %s\n", (m_failures == failures) ? "ok" : "FAILED");
+}
+
+static void transmit_test(void)
+{
+    uint32_t              failures = m_failures;
+    uint8_t               frame[MAX_PACKET_SIZE + PHR_SIZE];
+    uint8_t               addr[SHORT_ADDRESS_SIZE] = {1U, 0U};
+    uint8_t               ext_addr[EXTENDED_ADDRESS_SIZE];
+    nrf_802154_neighbor_t neighbor;
+
+    nrf_802154_neighbor_table_init();
+
+    // Frames with the Ack Request bit set count, failures other than a missing Ack do not.
+    frame_build(frame, 1U, true, false);
+    nrf_802154_neighbor_table_transmitted_hook(frame);
+    CHECK(nrf_802154_neighbor_table_tx_failed_hook(frame, NRF_802154_TX_ERROR_NO_ACK));
+    CHECK(nrf_802154_neighbor_table_tx_failed_hook(frame, NRF_802154_TX_ERROR_BUSY_CHANNEL));
+
+    frame_build(frame, 1U, false, false);
+    nrf_802154_neighbor_table_transmitted_hook(frame);
+
+    CHECK(nrf_802154_neighbor_table_entry_copy(addr, false, &neighbor));
+    CHECK(neighbor.tx_frames == 2U);
+    CHECK(neighbor.tx_acked == 1U);
+    CHECK(neighbor.rx_frames == 0U);
+
+    // A transmission to an extended address adds the neighbor.
+    frame_build(frame, 0x30U, true, true);
+    CHECK(nrf_802154_neighbor_table_tx_failed_hook(frame, NRF_802154_TX_ERROR_NO_ACK));
+
+    for (uint8_t k = 0; k < EXTENDED_ADDRESS_SIZE; k++)
+    {
+        ext_addr[k] = 0x30U + k;
+    }
+
+    CHECK(nrf_802154_neighbor_table_entry_copy(ext_addr, true, &neighbor));
+    CHECK(neighbor.tx_frames == 1U);
+    CHECK(neighbor.tx_acked == 0U);
+    CHECK(neighbor.rx_frames == 0U);
+
+    printf("transmit: %s\n", (m_failures == failures) ? "ok" : "FAILED");
+}
+
+static void replacement_test(void)
+{
+    uint32_t              failures = m_failures;
+    uint8_t               first[SHORT_ADDRESS_SIZE]  = {1U, 0U};
+    uint8_t               oldest[SHORT_ADDRESS_SIZE] = {2U, 0U};
+    nrf_802154_neighbor_t neighbors[NRF_802154_NEIGHBOR_TABLE_SIZE + 1U];
+    nrf_802154_neighbor_t neighbor;
+
+    nrf_802154_neighbor_table_init();
+    frame_receive(1U, -50, 50U);
+
+    // One neighbor more than the table holds. The first one stays active in the meantime.
+    for (uint8_t src = 2U; src < 2U + NRF_802154_NEIGHBOR_TABLE_SIZE; src++)
+    {
+        frame_receive(src, -50, 50U);
+
+        if (src == 5U)
+        {
+            frame_receive(1U, -50, 50U);
+        }
+    }
+
+    CHECK(nrf_802154_neighbor_table_copy(neighbors, NRF_802154_NEIGHBOR_TABLE_SIZE + 1U) ==
+          NRF_802154_NEIGHBOR_TABLE_SIZE);
+    CHECK(!nrf_802154_neighbor_table_entry_copy(oldest, false, &neighbor));
+    CHECK(nrf_802154_neighbor_table_entry_copy(first, false, &neighbor));
+    CHECK(neighbor.rx_frames == 2U);
+    CHECK(nrf_802154_neighbor_table_copy(neighbors, 3U) == 3U);
+
+    nrf_802154_neighbor_table_clear();
+    CHECK(nrf_802154_neighbor_table_copy(neighbors, NRF_802154_NEIGHBOR_TABLE_SIZE) == 0U);
+    CHECK(!nrf_802154_neighbor_table_entry_copy(first, false, &neighbor));
+
+    printf("replacement: %s\n", (m_failures == failures) ? "ok" : "FAILED");
+}
+
+int main(void)
+{
+    average_test();
+    transmit_test();
+    replacement_test();
+
+    if (m_failures != 0U)
+    {
+        printf("\n%u checks failed\n", (unsigned)m_failures);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,746 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run long-term simulation of the periodic receive window schedules.
+ *
+ * The simulator links nrf_802154_periodic_rx.c, nrf_802154_delayed_trx.c and
+ * nrf_802154_queue.c unchanged and replaces the radio scheduler, the timer and the request and
+ * notification modules with an event-driven model. Time advances from one timer or timeslot
+ * to the next, so millions of periods take seconds. The scenarios are:
+ *
+ * - params: invalid schedule parameters are rejected,
+ * - clean:  a CSL-like schedule hopping over five channels, where every window must complete,
+ * - faulty: a TSCH-like schedule hopping over all channels with timeslot denials, rejected
+ *           reception requests and random interrupt latency,
+ * - shared: two schedules with different periods competing for the delayed reception slots,
+ *           one of them restarted with a new phase in the middle of the run.
+ *
+ * Each scenario checks the statistics of the schedules against the number of windows whose
+ * deadline passed, and that every injected fault is counted as a missed window. Every window
+ * armed by the module is checked for its start time, duration, channel and lead time, and
+ * the higher layer must never be notified about the periodic windows. The program exits with
+ * a failure if any check fails.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -DNRF_802154_USE_RAW_API=1 -DNRF_802154_DELAYED_TRX_ENABLED=1 \
+ *         -DNRF_802154_PERIODIC_RX_SCHEDULES=2 -o periodic_rx_sim ../../utils/nrf_802154_periodic_rx_sim.c \
+ *         driver/src/mac_features/nrf_802154_periodic_rx.c \
+ *         driver/src/mac_features/nrf_802154_delayed_trx.c driver/src/nrf_802154_queue.c \
+ *         -Icommon/include -Idriver/include -Idriver/src -Idriver/src/mac_features \
+ *         -Isl/include -Isl/sl_opensource/include \
+ *         -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis>
+ *
+ * Usage:
+ *
+ *     periodic_rx_sim [-p <periods>] [-s <seed>]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_notification.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_tx_power.h"
+#include "nrf_802154_types_internal.h"
+#include "mac_features/nrf_802154_delayed_trx.h"
+#include "mac_features/nrf_802154_frame_parser.h"
+#include "mac_features/nrf_802154_periodic_rx.h"
+#include "rsch/nrf_802154_rsch.h"
+#include "nrf_802154_sl_timer.h"
+
+#if NRF_802154_PERIODIC_RX_SCHEDULES < 2
+#error "The shared scenario needs NRF_802154_PERIODIC_RX_SCHEDULES of at least 2"
+#endif
+
+#define SIM_TIMESLOTS_MAX 8U                               ///< Capacity of the timeslot list.
+#define SIM_TIMERS_MAX    16U                              ///< Capacity of the timer list.
+#define SIM_PPM(x)        ((uint32_t)(x))                  ///< Probability of an event, in 1/1000000.
+#define SIM_SETTLE_TIME   100000U                          ///< Time to let pending events end, in microseconds.
+#define SIM_TIME_NEVER    UINT64_MAX
+
+#define CHECK(cond)                                                         \
+    do                                                                      \
+    {                                                                       \
+        if (!(cond))                                                        \
+        {                                                                   \
+            printf("  check failed at line %d: %s\n", __LINE__, #cond); \
+            m_failures++;                                                   \
+        }                                                                   \
+    }                                                                       \
+    while (0)
+
+/**
+ * @brief Delayed timeslot granted by the scheduler model.
+ */
+typedef struct
+{
+    bool                           used;     ///< If the entry holds a timeslot.
+    bool                           started;  ///< If the started callback was called.
+    rsch_dly_ts_id_t               id;       ///< Identifier of the timeslot.
+    uint64_t                       time;     ///< Start time, in microseconds.
+    rsch_dly_ts_started_callback_t callback; ///< Callback called when the timeslot starts.
+} sim_timeslot_t;
+
+/**
+ * @brief Faults injected by the simulator, in 1/1000000.
+ */
+typedef struct
+{
+    uint32_t deny;        ///< Probability that the core denies a reception.
+    uint32_t reject;      ///< Probability that the scheduler rejects a timeslot request.
+    uint32_t latency;     ///< Probability that an event is handled late.
+    uint32_t max_latency; ///< Maximum latency of a late event, in microseconds.
+} sim_faults_t;
+
+static uint32_t     m_failures;            ///< Number of failed checks.
+static uint64_t     m_now;                 ///< Current time, in microseconds.
+static uint32_t     m_rng;                 ///< State of the fault generator.
+static sim_faults_t m_faults;
+static uint64_t     m_injected;            ///< Number of injected denials and rejections.
+static uint64_t     m_notified;            ///< Failed periodic windows notified to the higher layer.
+static uint64_t     m_bad_windows;         ///< Windows armed with wrong parameters.
+static uint8_t      m_channel = 11U;
+
+static sim_timeslot_t          m_timeslots[SIM_TIMESLOTS_MAX];
+static nrf_802154_sl_timer_t * mp_timers[SIM_TIMERS_MAX];
+static uint32_t                m_timers_num;
+
+static nrf_802154_periodic_rx_params_t m_params[NRF_802154_PERIODIC_RX_SCHEDULES];
+
+static uint32_t xorshift32(uint32_t * p_state)
+{
+    uint32_t x = *p_state;
+
+    x        ^= x << 13;
+    x        ^= x >> 17;
+    x        ^= x << 5;
+    *p_state  = x;
+
+    return x;
+}
+
+static bool draw(uint32_t probability)
+{
+    return (xorshift32(&m_rng) % 1000000U) < probability;
+}
+
+/***************************************************************************************************
+ * @section Models of the modules around periodic reception
+ **************************************************************************************************/
+
+bool nrf_802154_rsch_delayed_timeslot_request(const rsch_dly_ts_param_t * p_dly_ts_param)
+{
+    if (p_dly_ts_param->trigger_time <= m_now)
+    {
+        return false;
+    }
+
+    if (draw(m_faults.reject))
+    {
+        m_injected++;
+        return false;
+    }
+
+    for (uint32_t i = 0U; i < SIM_TIMESLOTS_MAX; i++)
+    {
+        if (m_timeslots[i].used && (m_timeslots[i].id == p_dly_ts_param->id))
+        {
+            return false;
+        }
+    }
+
+    for (uint32_t i = 0U; i < SIM_TIMESLOTS_MAX; i++)
+    {
+        if (!m_timeslots[i].used)
+        {
+            m_timeslots[i] = (sim_timeslot_t){
+                .used     = true,
+                .started  = false,
+                .id       = p_dly_ts_param->id,
+                .time     = p_dly_ts_param->trigger_time,
+                .callback = p_dly_ts_param->started_callback,
+            };
+
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool nrf_802154_rsch_delayed_timeslot_cancel(rsch_dly_ts_id_t dly_ts_id, bool handler)
+{
+    (void)handler;
+
+    for (uint32_t i = 0U; i < SIM_TIMESLOTS_MAX; i++)
+    {
+        if (m_timeslots[i].used && (m_timeslots[i].id == dly_ts_id))
+        {
+            m_timeslots[i].used = false;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool nrf_802154_rsch_delayed_timeslot_time_to_start_get(rsch_dly_ts_id_t dly_ts_id,
+                                                        uint64_t       * p_time_to_start)
+{
+    for (uint32_t i = 0U; i < SIM_TIMESLOTS_MAX; i++)
+    {
+        if (m_timeslots[i].used && (m_timeslots[i].id == dly_ts_id))
+        {
+            *p_time_to_start = m_timeslots[i].time - m_now;
+            return true;
+        }
+    }
+
+    return false;
+}
+
+static int32_t timer_find(const nrf_802154_sl_timer_t * p_timer)
+{
+    for (uint32_t i = 0U; i < m_timers_num; i++)
+    {
+        if (mp_timers[i] == p_timer)
+        {
+            return (int32_t)i;
+        }
+    }
+
+    return -1;
+}
+
+void nrf_802154_sl_timer_init(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+}
+
+void nrf_802154_sl_timer_deinit(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+}
+
+nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_add(nrf_802154_sl_timer_t * p_timer)
+{
+    if (timer_find(p_timer) < 0)
+    {
+        if (m_timers_num == SIM_TIMERS_MAX)
+        {
+            printf("  timer list overflow\n");
+            abort();
+        }
+
+        mp_timers[m_timers_num++] = p_timer;
+    }
+
+    return NRF_802154_SL_TIMER_RET_SUCCESS;
+}
+
+nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_remove(nrf_802154_sl_timer_t * p_timer)
+{
+    int32_t idx = timer_find(p_timer);
+
+    if (idx < 0)
+    {
+        return NRF_802154_SL_TIMER_RET_INACTIVE;
+    }
+
+    mp_timers[idx] = mp_timers[--m_timers_num];
+
+    return NRF_802154_SL_TIMER_RET_SUCCESS;
+}
+
+uint64_t nrf_802154_sl_timer_current_time_get(void)
+{
+    return m_now;
+}
+
+bool nrf_802154_notify_receive_failed(nrf_802154_rx_error_t error,
+                                      uint32_t              id,
+                                      bool                  allow_drop)
+{
+    (void)error;
+    (void)allow_drop;
+
+    if (id > NRF_802154_RESERVED_DRX_ID_UPPER_BOUND)
+    {
+        m_notified++;
+    }
+
+    return true;
+}
+
+void nrf_802154_notify_transmit_failed(uint8_t                                   * p_frame,
+                                       nrf_802154_tx_error_t                       error,
+                                       const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    (void)p_frame;
+    (void)error;
+    (void)p_metadata;
+}
+
+bool nrf_802154_request_receive(nrf_802154_term_t              term_lvl,
+                                req_originator_t               req_orig,
+                                nrf_802154_notification_func_t notify_function,
+                                bool                           notify_abort,
+                                uint32_t                       id)
+{
+    (void)term_lvl;
+    (void)req_orig;
+    (void)notify_abort;
+    (void)id;
+
+    bool result = !draw(m_faults.deny);
+
+    m_injected += result ? 0U : 1U;
+    notify_function(result);
+
+    return result;
+}
+
+bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
+                                 req_originator_t               req_orig,
+                                 uint8_t                      * p_data,
+                                 nrf_802154_transmit_params_t * p_params,
+                                 nrf_802154_notification_func_t notify_function)
+{
+    (void)term_lvl;
+    (void)req_orig;
+    (void)p_data;
+    (void)p_params;
+    (void)notify_function;
+
+    return true;
+}
+
+bool nrf_802154_request_sleep(nrf_802154_term_t term_lvl)
+{
+    (void)term_lvl;
+
+    return true;
+}
+
+bool nrf_802154_request_channel_update(req_originator_t req_orig)
+{
+    (void)req_orig;
+
+    return true;
+}
+
+bool nrf_802154_request_receive_at(uint64_t rx_time,
+                                   uint32_t timeout,
+                                   uint8_t  channel,
+                                   uint32_t id)
+{
+    uint32_t schedule = NRF_802154_RESERVED_PERIODIC_RX_ID(0) - id;
+
+    if (schedule < NRF_802154_PERIODIC_RX_SCHEDULES)
+    {
+        const nrf_802154_periodic_rx_params_t * p_params = &m_params[schedule];
+        uint64_t                                offset   = rx_time - p_params->rx_time;
+        uint64_t                                window   = offset / p_params->period;
+
+        if (((offset % p_params->period) != 0U) ||
+            (timeout != p_params->window) ||
+            (channel != p_params->channels[window % p_params->channels_len]) ||
+            (rx_time < m_now + nrf_802154_delayed_trx_rx_lead_time_get()))
+        {
+            m_bad_windows++;
+        }
+    }
+
+    return nrf_802154_delayed_trx_receive(rx_time, timeout, channel, id);
+}
+
+bool nrf_802154_request_receive_at_cancel(uint32_t id)
+{
+    return nrf_802154_delayed_trx_receive_cancel(id);
+}
+
+uint8_t nrf_802154_pib_channel_get(void)
+{
+    return m_channel;
+}
+
+void nrf_802154_pib_channel_set(uint8_t channel)
+{
+    m_channel = channel;
+}
+
+bool nrf_802154_pib_rx_on_when_idle_get(void)
+{
+    return false;
+}
+
+bool nrf_802154_frame_parser_data_init(const uint8_t                  * p_frame,
+                                       uint8_t                          valid_data_len,
+                                       nrf_802154_frame_parser_level_t  requested_parse_level,
+                                       nrf_802154_frame_parser_data_t * p_parser_data)
+{
+    (void)p_frame;
+    (void)valid_data_len;
+    (void)requested_parse_level;
+    (void)p_parser_data;
+
+    return false;
+}
+
+int8_t nrf_802154_tx_power_convert_metadata_to_tx_power_split(
+    uint8_t                                 channel,
+    nrf_802154_tx_power_metadata_t          tx_power,
+    nrf_802154_fal_tx_power_split_t * const p_tx_power_split)
+{
+    (void)channel;
+    (void)tx_power;
+    (void)p_tx_power_split;
+
+    return 0;
+}
+
+void nrf_802154_assert_handler(void)
+{
+    printf("  driver assertion failed\n");
+    abort();
+}
+
+/***************************************************************************************************
+ * @section Event loop
+ **************************************************************************************************/
+
+/** @brief Handles the earliest timer or timeslot if it is not later than @p end. */
+static bool step(uint64_t end)
+{
+    uint64_t best     = SIM_TIME_NEVER;
+    int32_t  timer    = -1;
+    int32_t  timeslot = -1;
+
+    for (uint32_t i = 0U; i < m_timers_num; i++)
+    {
+        if (mp_timers[i]->trigger_time < best)
+        {
+            best  = mp_timers[i]->trigger_time;
+            timer = (int32_t)i;
+        }
+    }
+
+    for (uint32_t i = 0U; i < SIM_TIMESLOTS_MAX; i++)
+    {
+        if (m_timeslots[i].used && !m_timeslots[i].started && (m_timeslots[i].time < best))
+        {
+            best     = m_timeslots[i].time;
+            timeslot = (int32_t)i;
+            timer    = -1;
+        }
+    }
+
+    if (best > end)
+    {
+        m_now = (m_now < end) ? end : m_now;
+        return false;
+    }
+
+    m_now = (best > m_now) ? best : m_now;
+
+    if (draw(m_faults.latency))
+    {
+        m_now += xorshift32(&m_rng) % m_faults.max_latency;
+    }
+
+    if (timer >= 0)
+    {
+        nrf_802154_sl_timer_t * p_timer = mp_timers[timer];
+
+        mp_timers[timer] = mp_timers[--m_timers_num];
+        p_timer->action.callback.callback(p_timer);
+    }
+    else
+    {
+        sim_timeslot_t * p_timeslot = &m_timeslots[timeslot];
+        rsch_dly_ts_id_t id         = p_timeslot->id;
+
+        p_timeslot->started = true;
+        p_timeslot->callback(id);
+
+        // The started timeslot must be released or replaced by its callback.
+        if (p_timeslot->used && p_timeslot->started && (p_timeslot->id == id))
+        {
+            printf("  timeslot %lu not released\n", (unsigned long)id);
+            m_failures++;
+            p_timeslot->used = false;
+        }
+    }
+
+    return true;
+}
+
+static void run_until(uint64_t end)
+{
+    while (step(end))
+    {
+        // Intentionally empty: all the work is done by step().
+    }
+}
+
+/** @brief Returns the number of windows of a schedule whose deadline has passed. */
+static uint64_t windows_passed(uint8_t schedule)
+{
+    const nrf_802154_periodic_rx_params_t * p_params = &m_params[schedule];
+    uint64_t                                lead     = nrf_802154_delayed_trx_rx_lead_time_get();
+
+    if (m_now + lead < p_params->rx_time)
+    {
+        return 0U;
+    }
+
+    return (m_now + lead - p_params->rx_time) / p_params->period + 1U;
+}
+
+static void stats_check(const char * p_name, uint8_t schedule, uint64_t passed)
+{
+    nrf_802154_periodic_rx_stats_t stats;
+    uint64_t                       ended;
+
+    CHECK(nrf_802154_periodic_rx_stats_get(schedule, &stats));
+    ended = (uint64_t)stats.completed + stats.missed + stats.late;
+
+    printf("%-8s armed %9u, completed %9u, missed %7u, late %7u (passed %llu)\n",
+           p_name, (unsigned)stats.armed, (unsigned)stats.completed, (unsigned)stats.missed,
+           (unsigned)stats.late, (unsigned long long)passed);
+
+    // The window armed when the schedule stopped may have been cancelled before its deadline.
+    CHECK((ended <= passed) && (ended + 1U >= passed));
+}
+
+/***************************************************************************************************
+ * @section Scenarios
+ **************************************************************************************************/
+
+static void params_test(void)
+{
+    nrf_802154_periodic_rx_params_t params =
+    {
+        .rx_time      = 10000U,
+        .period       = 1000U,
+        .window       = 500U,
+        .channels     = {11U},
+        .channels_len = 1U,
+    };
+
+    CHECK(!nrf_802154_periodic_rx_start(0U, &params));
+
+    params.period       = 10000U;
+    params.channels_len = 0U;
+    CHECK(!nrf_802154_periodic_rx_start(0U, &params));
+
+    params.channels_len = 1U;
+    CHECK(!nrf_802154_periodic_rx_start(NRF_802154_PERIODIC_RX_SCHEDULES, &params));
+
+    printf("params:  ok\n");
+}
+
+static void clean_test(uint64_t periods)
+{
+    nrf_802154_periodic_rx_stats_t stats;
+
+    m_params[0] = (nrf_802154_periodic_rx_params_t){
+        .rx_time      = m_now + 5000U,
+        .period       = 10000U,
+        .window       = 1500U,
+        .channels     = {11U, 15U, 20U, 25U, 26U},
+        .channels_len = 5U,
+    };
+
+    CHECK(nrf_802154_periodic_rx_start(0U, &m_params[0]));
+    CHECK(!nrf_802154_periodic_rx_start(0U, &m_params[0]));
+    run_until(m_params[0].rx_time + periods * m_params[0].period - 1U);
+    CHECK(nrf_802154_periodic_rx_stop(0U));
+    CHECK(!nrf_802154_periodic_rx_stop(0U));
+    run_until(m_now + SIM_SETTLE_TIME);
+
+    stats_check("clean:", 0U, periods);
+    CHECK(nrf_802154_periodic_rx_stats_get(0U, &stats));
+
+    // The window armed before the stop has been cancelled.
+    CHECK(stats.completed == periods);
+    CHECK(stats.armed == periods + 1U);
+    CHECK((stats.missed == 0U) && (stats.late == 0U));
+}
+
+static void faulty_test(uint64_t periods)
+{
+    nrf_802154_periodic_rx_stats_t stats;
+    uint64_t                       passed;
+
+    m_faults   = (sim_faults_t){
+        .deny        = SIM_PPM(2000),
+        .reject      = SIM_PPM(1000),
+        .latency     = SIM_PPM(3000),
+        .max_latency = 25000U,
+    };
+    m_injected = 0U;
+
+    m_params[0] = (nrf_802154_periodic_rx_params_t){
+        .rx_time      = m_now + 100000U,
+        .period       = 10000U,
+        .window       = 2200U,
+        .channels     = {11U, 12U, 13U, 14U, 15U, 16U, 17U, 18U,
+                         19U, 20U, 21U, 22U, 23U, 24U, 25U, 26U},
+        .channels_len = 16U,
+    };
+
+    CHECK(nrf_802154_periodic_rx_start(0U, &m_params[0]));
+    run_until(m_params[0].rx_time + periods * m_params[0].period - 1U);
+    passed = windows_passed(0U);
+    CHECK(nrf_802154_periodic_rx_stop(0U));
+    run_until(m_now + SIM_SETTLE_TIME);
+
+    stats_check("faulty:", 0U, passed);
+    CHECK(nrf_802154_periodic_rx_stats_get(0U, &stats));
+    CHECK(stats.missed == m_injected);
+    CHECK(stats.late > 0U);
+}
+
+static void shared_test(uint64_t periods)
+{
+    uint64_t end;
+    uint64_t passed[2];
+
+    m_params[0] = (nrf_802154_periodic_rx_params_t){
+        .rx_time      = m_now + 100000U,
+        .period       = 3000U,
+        .window       = 1800U,
+        .channels     = {11U, 12U, 13U},
+        .channels_len = 3U,
+    };
+    m_params[1] = (nrf_802154_periodic_rx_params_t){
+        .rx_time      = m_now + 101234U,
+        .period       = 7777U,
+        .window       = 900U,
+        .channels     = {26U},
+        .channels_len = 1U,
+    };
+
+    CHECK(nrf_802154_periodic_rx_start(0U, &m_params[0]));
+    CHECK(nrf_802154_periodic_rx_start(1U, &m_params[1]));
+    end = m_params[0].rx_time + periods * m_params[0].period;
+
+    // Restart the second schedule with a new phase in the middle of the run.
+    run_until(m_params[0].rx_time + periods / 2U * m_params[0].period);
+    CHECK(nrf_802154_periodic_rx_stop(1U));
+    run_until(m_now + 20000U);
+    m_params[1].rx_time = m_now + 50000U;
+    CHECK(nrf_802154_periodic_rx_start(1U, &m_params[1]));
+
+    run_until(end);
+    passed[0] = windows_passed(0U);
+    passed[1] = windows_passed(1U);
+    CHECK(nrf_802154_periodic_rx_stop(0U));
+    CHECK(nrf_802154_periodic_rx_stop(1U));
+    run_until(m_now + SIM_SETTLE_TIME);
+
+    stats_check("shared0:", 0U, passed[0]);
+    stats_check("shared1:", 1U, passed[1]);
+
+    for (uint32_t i = 0U; i < SIM_TIMESLOTS_MAX; i++)
+    {
+        CHECK(!m_timeslots[i].used);
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    uint64_t periods = 1000000U;
+    uint32_t seed    = 12345U;
+    int      opt     = 1;
+
+    while (opt + 1 < argc)
+    {
+        unsigned long long value = strtoull(argv[opt + 1], NULL, 0);
+
+        if (strcmp(argv[opt], "-p") == 0)
+        {
+            periods = value;
+        }
+        else if (strcmp(argv[opt], "-s") == 0)
+        {
+            seed = (uint32_t)value;
+        }
+        else
+        {
+            break;
+        }
+
+        opt += 2;
+    }
+
+    if ((opt != argc) || (periods < 2U) || (seed == 0U))
+    {
+        fprintf(stderr, "Usage: %s [-p <periods>] [-s <seed>]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    m_rng = seed;
+    nrf_802154_delayed_trx_init();
+    nrf_802154_periodic_rx_init();
+
+    params_test();
+    clean_test(periods);
+    faulty_test(periods);
+    shared_test(periods);
+
+    CHECK(m_notified == 0U);
+    CHECK(m_bad_windows == 0U);
+
+    nrf_802154_periodic_rx_deinit();
+    nrf_802154_delayed_trx_deinit();
+
+    if (m_failures != 0U)
+    {
+        printf("\n%u checks failed\n", (unsigned)m_failures);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,1099 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run simulator of the SWI request queues.
+ *
+ * The simulator compiles nrf_802154_request_swi.c unchanged into this file, with the EGU instance
+ * of the driver replaced by an emulated one, and links nrf_802154_queue.c. The core and the delayed
+ * operations are replaced by stubs which log the requests they process. Three execution priorities
+ * are emulated: thread mode, the request SWI and a higher priority interrupt. The SWI runs when its
+ * EGU event is set, the emulated PRIMASK is cleared and the running context has a lower priority.
+ * The higher priority interrupt is run by the test at chosen points: from thread mode, before
+ * a pending SWI, in the middle of the processing of an asynchronous request and from completion
+ * functions.
+ *
+ * The scripted scenarios check that:
+ *
+ * - a burst of asynchronous requests queued with interrupts masked is processed by one SWI run,
+ *   in order, and that a request exceeding the queue is rejected,
+ * - a synchronous request issued from the higher priority interrupt processes the pending
+ *   asynchronous requests first,
+ * - a synchronous request issued while an asynchronous request is processed is processed
+ *   immediately, and the pending requests are processed once, after it,
+ * - a second free of a receive buffer, asynchronous or synchronous from any priority, does not free
+ *   the buffer again and fails.
+ *
+ * The random scenario issues a stream of synchronous and asynchronous requests from all contexts,
+ * including completion functions, and checks every request against a model of the queue: the
+ * requests are processed in order and exactly once, every accepted asynchronous request is
+ * completed exactly once with its result and a request is rejected only if the queue is full.
+ * The benchmark then compares the cost of synchronous and asynchronous requests issued from thread
+ * mode. The program exits with a failure if any check fails.
+ *
+ * <cmsis> must provide a host version of the CMSIS core header whose __get_PRIMASK(),
+ * __set_PRIMASK() and __disable_irq() call sim_primask_get(), sim_primask_set() and
+ * sim_irq_disable(), defined by this file.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -DNRF_802154_DELAYED_TRX_ENABLED=1 \
+ *         -o request_async_sim ../../utils/nrf_802154_request_async_sim.c \
+ *         driver/src/nrf_802154_queue.c \
+ *         -Icommon/include -Idriver/include -Idriver/src -Idriver/src/mac_features \
+ *         -Isl/include -Isl/sl_opensource/include \
+ *         -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis>
+ *
+ * Usage:
+ *
+ *     request_async_sim [-n <random operations>] [-b <benchmark requests>] [-s <seed>]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include <nrfx.h>
+#include "nrf_802154_peripherals.h"
+
+static NRF_EGU_Type m_egu; ///< Emulated EGU instance of the driver.
+
+#undef NRF_802154_EGU_INSTANCE
+#define NRF_802154_EGU_INSTANCE (&m_egu)
+
+#include "nrf_802154_request_swi.c"
+
+#if !NRF_802154_DELAYED_TRX_ENABLED
+#error "The simulator requires NRF_802154_DELAYED_TRX_ENABLED=1"
+#endif
+
+#define SIM_PRIO_HIGH     1U                                   ///< Higher priority interrupt.
+#define SIM_PRIO_SWI      2U                                   ///< Request SWI.
+#define SIM_PRIO_THREAD   255U                                 ///< Thread mode.
+#define SIM_QUEUE_SIZE    NRF_802154_REQUEST_ASYNC_QUEUE_SIZE  ///< Asynchronous queue capacity.
+#define SIM_PENDING_SIZE  (SIM_QUEUE_SIZE + 1U)                ///< Model queue, with a spare item.
+#define SIM_LOG_SIZE      64U                                  ///< Capacity of the request log.
+#define SIM_SEQ_PER_OP    64U                                  ///< Request budget per random op.
+#define SIM_BENCH_ROUNDS  5U                                   ///< Benchmark rounds.
+#define SIM_RX_BUFFERS    2U                                   ///< Receive buffers of the test.
+
+#define CHECK(cond)                                                     \
+    do                                                                  \
+    {                                                                   \
+        if (!(cond))                                                    \
+        {                                                               \
+            printf("  check failed at line %d: %s\n", __LINE__, #cond); \
+            m_failures++;                                               \
+        }                                                               \
+    }                                                                   \
+    while (0)
+
+/**
+ * @brief States of a request in the model.
+ */
+typedef enum
+{
+    SIM_REQ_NONE,      ///< Not issued or rejected.
+    SIM_REQ_QUEUED,    ///< Accepted asynchronous request waiting for processing.
+    SIM_REQ_PROCESSED, ///< Asynchronous request processed, not completed yet.
+    SIM_REQ_COMPLETED, ///< Asynchronous request completed.
+} sim_req_state_t;
+
+static uint32_t          m_failures;                   ///< Number of failed checks.
+static volatile uint32_t m_prio = SIM_PRIO_THREAD;     ///< Priority of the running context.
+static volatile uint32_t m_primask;                    ///< Emulated PRIMASK.
+static uint32_t          m_swi_runs;                   ///< Number of SWI runs.
+static uint32_t          m_rand;                       ///< State of the random generator.
+static bool              m_random;                     ///< If the stubs issue random requests.
+
+static uint32_t          m_log[SIM_LOG_SIZE];          ///< Requests in the order of processing.
+static uint32_t          m_log_len;                    ///< Number of requests processed.
+static uint32_t          m_done_log[SIM_LOG_SIZE];     ///< Requests in the order of completion.
+static bool              m_done_results[SIM_LOG_SIZE]; ///< Results of the completed requests.
+static uint32_t          m_done_len;                   ///< Number of requests completed.
+
+static uint8_t         * mp_states;                    ///< Model state of every request.
+static uint32_t          m_seq_max;                    ///< Number of entries of @ref mp_states.
+static uint32_t          m_next_seq = 1U;              ///< Sequence number of the next request.
+static uint32_t          m_pending[SIM_PENDING_SIZE];  ///< Model of the asynchronous queue.
+static uint32_t          m_pending_rd;                 ///< Reads from @ref m_pending.
+static uint32_t          m_pending_wr;                 ///< Writes to @ref m_pending.
+static uint32_t          m_async_depth;                ///< Asynchronous requests being processed.
+static uint32_t          m_last_sync;                  ///< Last synchronous request processed.
+static uint32_t          m_buffer_frees;               ///< Buffers freed by the core.
+
+static rx_buffer_t m_rx_buffers[SIM_RX_BUFFERS];       ///< Receive buffers of the test.
+
+static void (* mp_core_hook)(void);                    ///< Run by the next asynchronous request.
+
+static void async_done(bool result, void * p_context);
+
+static uint32_t xorshift32(uint32_t * p_state)
+{
+    uint32_t x = *p_state;
+
+    x        ^= x << 13;
+    x        ^= x >> 17;
+    x        ^= x << 5;
+    *p_state  = x;
+
+    return x;
+}
+
+static uint64_t nanoseconds_get(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/***************************************************************************************************
+ * @section Emulated interrupts
+ **************************************************************************************************/
+
+/**
+ * @brief Runs the request SWI if it is pending and not blocked.
+ */
+static void swi_poll(void)
+{
+    uint32_t channel = NRF_802154_EGU_REQUEST_CHANNEL_NO;
+
+    if (m_egu.TASKS_TRIGGER[channel] != 0U)
+    {
+        m_egu.TASKS_TRIGGER[channel]    = 0U;
+        m_egu.EVENTS_TRIGGERED[channel] = 1U;
+    }
+
+    while ((m_egu.EVENTS_TRIGGERED[channel] != 0U) && (m_primask == 0U) &&
+           (m_prio > SIM_PRIO_SWI))
+    {
+        uint32_t prio = m_prio;
+
+        m_prio = SIM_PRIO_SWI;
+        m_swi_runs++;
+        nrf_802154_request_swi_irq_handler();
+        m_prio = prio;
+
+        if (m_egu.TASKS_TRIGGER[channel] != 0U)
+        {
+            m_egu.TASKS_TRIGGER[channel]    = 0U;
+            m_egu.EVENTS_TRIGGERED[channel] = 1U;
+        }
+    }
+}
+
+uint32_t sim_primask_get(void)
+{
+    return m_primask;
+}
+
+void sim_irq_disable(void)
+{
+    m_primask = 1U;
+}
+
+void sim_primask_set(uint32_t primask)
+{
+    m_primask = primask;
+
+    if (primask == 0U)
+    {
+        swi_poll();
+    }
+}
+
+uint32_t nrf_802154_critical_section_active_vector_priority_get(void)
+{
+    return m_prio;
+}
+
+uint32_t nrf_802154_irq_priority_get(uint32_t irqn)
+{
+    (void)irqn;
+
+    return SIM_PRIO_SWI;
+}
+
+bool nrf_802154_irq_is_enabled(uint32_t irqn)
+{
+    (void)irqn;
+
+    return true;
+}
+
+void nrf_802154_swi_init(void)
+{
+    // Intentionally empty.
+}
+
+void nrf_802154_assert_handler(void)
+{
+    printf("  driver assertion failed\n");
+    abort();
+}
+
+/***************************************************************************************************
+ * @section Model
+ **************************************************************************************************/
+
+/**
+ * @brief Gets the result the core returns for a request.
+ */
+static bool expected_result(uint32_t seq)
+{
+    return (seq % 5U) != 0U;
+}
+
+/**
+ * @brief Gets the number of occupied slots of the asynchronous queue.
+ *
+ * The slot of a request being processed is released after the core returns.
+ */
+static uint32_t pending_slots(void)
+{
+    return m_pending_wr - m_pending_rd + m_async_depth;
+}
+
+static void log_add(uint32_t seq)
+{
+    if (m_log_len < SIM_LOG_SIZE)
+    {
+        m_log[m_log_len] = seq;
+    }
+
+    m_log_len++;
+}
+
+/**
+ * @brief Issues an asynchronous request from the running context.
+ *
+ * @return Sequence number of the request or 0 if it was rejected.
+ */
+static uint32_t async_issue(void)
+{
+    uint32_t seq  = m_next_seq++;
+    bool     full = pending_slots() >= SIM_QUEUE_SIZE;
+    bool     result;
+
+    // The request may be processed before the call returns.
+    mp_states[seq]                              = SIM_REQ_QUEUED;
+    m_pending[m_pending_wr++ % SIM_PENDING_SIZE] = seq;
+
+    result = nrf_802154_request_receive_at_async(0U, 0U, 11U, seq, async_done,
+                                                 (void *)(uintptr_t)seq);
+
+    CHECK(result == !full);
+
+    if (!result)
+    {
+        m_pending_wr--;
+        mp_states[seq] = SIM_REQ_NONE;
+        return 0U;
+    }
+
+    return seq;
+}
+
+/**
+ * @brief Issues a synchronous request from the running context.
+ */
+static uint32_t sync_issue(void)
+{
+    uint32_t seq = m_next_seq++;
+    bool     result;
+
+    result = nrf_802154_request_receive(NRF_802154_TERM_NONE,
+                                        REQ_ORIG_HIGHER_LAYER,
+                                        NULL,
+                                        false,
+                                        seq);
+
+    CHECK(m_last_sync == seq);
+    CHECK(result == expected_result(seq));
+
+    return seq;
+}
+
+/**
+ * @brief Issues a random request or a short burst of requests.
+ */
+static void random_requests_issue(void)
+{
+    uint32_t count = 1U + xorshift32(&m_rand) % 3U;
+
+    for (uint32_t i = 0U; i < count; i++)
+    {
+        if ((xorshift32(&m_rand) % 2U) == 0U)
+        {
+            (void)async_issue();
+        }
+        else
+        {
+            (void)sync_issue();
+        }
+    }
+}
+
+/**
+ * @brief Runs the higher priority interrupt, which issues random requests.
+ */
+static void high_irq_run(void)
+{
+    uint32_t prio = m_prio;
+
+    m_prio = SIM_PRIO_HIGH;
+    random_requests_issue();
+    m_prio = prio;
+
+    swi_poll();
+}
+
+/**
+ * @brief Runs the higher priority interrupt at random if it can preempt the running context.
+ */
+static void high_irq_maybe_run(uint32_t one_in)
+{
+    if (m_random && (m_primask == 0U) && (m_prio > SIM_PRIO_HIGH) &&
+        ((xorshift32(&m_rand) % one_in) == 0U))
+    {
+        high_irq_run();
+    }
+}
+
+static void async_done(bool result, void * p_context)
+{
+    uint32_t seq = (uint32_t)(uintptr_t)p_context;
+
+    CHECK(m_prio <= SIM_PRIO_SWI);
+    CHECK(mp_states[seq] == SIM_REQ_PROCESSED);
+    CHECK(result == expected_result(seq));
+    mp_states[seq] = SIM_REQ_COMPLETED;
+
+    if (m_done_len < SIM_LOG_SIZE)
+    {
+        m_done_log[m_done_len]     = seq;
+        m_done_results[m_done_len] = result;
+    }
+
+    m_done_len++;
+
+    if (m_random)
+    {
+        switch (xorshift32(&m_rand) % 8U)
+        {
+            case 0U:
+            case 1U:
+                (void)async_issue();
+                break;
+
+            case 2U:
+                (void)sync_issue();
+                break;
+
+            case 3U:
+                high_irq_maybe_run(1U);
+                break;
+
+            default:
+                break;
+        }
+    }
+}
+
+/**
+ * @brief Completion function of a buffer free, which records the context as the request.
+ */
+static void async_buffer_done(bool result, void * p_context)
+{
+    if (m_done_len < SIM_LOG_SIZE)
+    {
+        m_done_log[m_done_len]     = (uint32_t)(uintptr_t)p_context;
+        m_done_results[m_done_len] = result;
+    }
+
+    m_done_len++;
+}
+
+/***************************************************************************************************
+ * @section Core stubs
+ **************************************************************************************************/
+
+/**
+ * @brief Processes an asynchronous request in the core.
+ */
+static bool core_async_process(uint32_t seq)
+{
+    CHECK(m_prio <= SIM_PRIO_SWI);
+    CHECK(m_pending_rd != m_pending_wr);
+    CHECK(m_pending[m_pending_rd % SIM_PENDING_SIZE] == seq);
+    CHECK(mp_states[seq] == SIM_REQ_QUEUED);
+
+    m_pending_rd++;
+    mp_states[seq] = SIM_REQ_PROCESSED;
+    log_add(seq);
+
+    // A request issued from here is processed in the middle of this one.
+    m_async_depth++;
+
+    if (mp_core_hook != NULL)
+    {
+        void (* p_hook)(void) = mp_core_hook;
+
+        mp_core_hook = NULL;
+        p_hook();
+    }
+
+    high_irq_maybe_run(4U);
+    m_async_depth--;
+
+    return expected_result(seq);
+}
+
+/**
+ * @brief Processes a synchronous request in the core.
+ */
+static bool core_sync_process(uint32_t seq)
+{
+    CHECK(m_prio <= SIM_PRIO_SWI);
+
+    // The asynchronous requests issued before were processed first, unless this request
+    // interrupts the processing of one of them.
+    CHECK((m_async_depth > 0U) || (m_pending_rd == m_pending_wr));
+
+    m_last_sync = seq;
+    log_add(seq);
+
+    return expected_result(seq);
+}
+
+bool nrf_802154_core_receive(nrf_802154_term_t              term_lvl,
+                             req_originator_t               req_orig,
+                             nrf_802154_notification_func_t notify_function,
+                             bool                           notify_abort,
+                             uint32_t                       id)
+{
+    (void)term_lvl;
+    (void)req_orig;
+    (void)notify_function;
+    (void)notify_abort;
+
+    return core_sync_process(id);
+}
+
+bool nrf_802154_delayed_trx_receive(uint64_t rx_time,
+                                    uint32_t timeout,
+                                    uint8_t  channel,
+                                    uint32_t id)
+{
+    (void)rx_time;
+    (void)timeout;
+    (void)channel;
+
+    return core_async_process(id);
+}
+
+bool nrf_802154_core_notify_buffer_free(uint8_t * p_data)
+{
+    CHECK(m_prio <= SIM_PRIO_SWI);
+
+    // As the core, which does not free a buffer again
+    if (((rx_buffer_t *)p_data)->free)
+    {
+        return false;
+    }
+
+    ((rx_buffer_t *)p_data)->free = true;
+    m_buffer_frees++;
+
+    return true;
+}
+
+bool nrf_802154_core_sleep(nrf_802154_term_t term_lvl)
+{
+    (void)term_lvl;
+
+    return true;
+}
+
+bool nrf_802154_core_transmit(nrf_802154_term_t              term_lvl,
+                              req_originator_t               req_orig,
+                              uint8_t                      * p_data,
+                              nrf_802154_transmit_params_t * p_params,
+                              nrf_802154_notification_func_t notify_function)
+{
+    (void)term_lvl;
+    (void)req_orig;
+    (void)p_data;
+    (void)p_params;
+    (void)notify_function;
+
+    return true;
+}
+
+bool nrf_802154_core_ack_timeout_handle(const nrf_802154_ack_timeout_handle_params_t * p_param)
+{
+    (void)p_param;
+
+    return true;
+}
+
+bool nrf_802154_core_energy_detection(nrf_802154_term_t term_lvl, uint32_t time_us)
+{
+    (void)term_lvl;
+    (void)time_us;
+
+    return true;
+}
+
+bool nrf_802154_core_cca(nrf_802154_term_t term_lvl)
+{
+    (void)term_lvl;
+
+    return true;
+}
+
+bool nrf_802154_core_continuous_carrier(nrf_802154_term_t term_lvl)
+{
+    (void)term_lvl;
+
+    return true;
+}
+
+bool nrf_802154_core_modulated_carrier(nrf_802154_term_t term_lvl, const uint8_t * p_data)
+{
+    (void)term_lvl;
+    (void)p_data;
+
+    return true;
+}
+
+bool nrf_802154_core_channel_update(req_originator_t req_orig)
+{
+    (void)req_orig;
+
+    return true;
+}
+
+bool nrf_802154_core_cca_cfg_update(void)
+{
+    return true;
+}
+
+bool nrf_802154_core_rssi_measure(void)
+{
+    return true;
+}
+
+bool nrf_802154_core_last_rssi_measurement_get(int8_t * p_rssi)
+{
+    *p_rssi = 0;
+
+    return true;
+}
+
+bool nrf_802154_core_antenna_update(void)
+{
+    return true;
+}
+
+bool nrf_802154_delayed_trx_transmit(uint8_t                                 * p_data,
+                                     uint64_t                                  tx_time,
+                                     const nrf_802154_transmit_at_metadata_t * p_metadata)
+{
+    (void)p_data;
+    (void)tx_time;
+    (void)p_metadata;
+
+    return true;
+}
+
+bool nrf_802154_delayed_trx_transmit_cancel(void)
+{
+    return true;
+}
+
+bool nrf_802154_delayed_trx_receive_cancel(uint32_t id)
+{
+    (void)id;
+
+    return true;
+}
+
+bool nrf_802154_csma_ca_start(uint8_t                                      * p_data,
+                              const nrf_802154_transmit_csma_ca_metadata_t * p_metadata)
+{
+    (void)p_data;
+    (void)p_metadata;
+
+    return true;
+}
+
+/***************************************************************************************************
+ * @section Scripted scenarios
+ **************************************************************************************************/
+
+static void logs_reset(void)
+{
+    m_log_len  = 0U;
+    m_done_len = 0U;
+}
+
+/**
+ * @brief Checks a burst of asynchronous requests queued with interrupts masked.
+ */
+static void burst_test(void)
+{
+    uint32_t seqs[SIM_QUEUE_SIZE];
+    uint32_t runs;
+
+    logs_reset();
+    runs = m_swi_runs;
+
+    sim_irq_disable();
+
+    for (uint32_t i = 0U; i < SIM_QUEUE_SIZE; i++)
+    {
+        seqs[i] = async_issue();
+        CHECK(seqs[i] != 0U);
+    }
+
+    CHECK(async_issue() == 0U);
+    CHECK(m_log_len == 0U);
+
+    sim_primask_set(0U);
+
+    CHECK(m_swi_runs == runs + 1U);
+    CHECK(m_log_len == SIM_QUEUE_SIZE);
+    CHECK(m_done_len == SIM_QUEUE_SIZE);
+
+    for (uint32_t i = 0U; i < SIM_QUEUE_SIZE; i++)
+    {
+        CHECK(m_log[i] == seqs[i]);
+        CHECK(m_done_log[i] == seqs[i]);
+        CHECK(m_done_results[i] == expected_result(seqs[i]));
+    }
+}
+
+/**
+ * @brief Checks that a synchronous request of the higher priority interrupt, which preempts
+ *        a pending SWI, processes the pending asynchronous requests first.
+ */
+static void high_priority_test(void)
+{
+    uint32_t first;
+    uint32_t second;
+    uint32_t sync;
+    uint32_t later;
+    uint32_t runs;
+
+    logs_reset();
+    runs = m_swi_runs;
+
+    sim_irq_disable();
+    first  = async_issue();
+    second = async_issue();
+
+    // The interrupt is taken before the pending SWI when the thread unmasks interrupts.
+    m_primask = 0U;
+    m_prio    = SIM_PRIO_HIGH;
+    sync      = sync_issue();
+    later     = async_issue();
+
+    CHECK(m_log_len == 3U);
+    CHECK((m_log[0] == first) && (m_log[1] == second) && (m_log[2] == sync));
+    CHECK(m_done_len == 2U);
+
+    m_prio = SIM_PRIO_THREAD;
+    swi_poll();
+
+    CHECK(m_log_len == 4U);
+    CHECK(m_log[3] == later);
+    CHECK(m_done_len == 3U);
+    CHECK(m_swi_runs == runs + 1U);
+}
+
+/**
+ * @brief Hook of @ref nested_test, run by the core while it processes the first request.
+ *
+ * Emulates the higher priority interrupt. A notification called by the request would issue
+ * its requests in the same way.
+ */
+static void nested_hook(void)
+{
+    uint32_t prio = m_prio;
+
+    m_prio = SIM_PRIO_HIGH;
+    (void)sync_issue();
+    m_prio = prio;
+}
+
+/**
+ * @brief Checks a synchronous request issued while an asynchronous request is processed.
+ */
+static void nested_test(void)
+{
+    uint32_t first;
+    uint32_t second;
+
+    logs_reset();
+    mp_core_hook = nested_hook;
+
+    sim_irq_disable();
+    first  = async_issue();
+    second = async_issue();
+    sim_primask_set(0U);
+
+    CHECK(m_log_len == 3U);
+    CHECK((m_log[0] == first) && (m_log[1] == m_last_sync) && (m_log[2] == second));
+    CHECK(m_done_len == 2U);
+    CHECK((m_done_log[0] == first) && (m_done_log[1] == second));
+}
+
+/**
+ * @brief Checks two asynchronous frees of the same receive buffer, and a synchronous free of
+ *        a buffer freed by a pending asynchronous request from thread mode and from the higher
+ *        priority interrupt.
+ */
+static void buffer_free_test(void)
+{
+    uint8_t * p_data = (uint8_t *)&m_rx_buffers[0];
+
+    logs_reset();
+    m_buffer_frees       = 0U;
+    m_rx_buffers[0].free = false;
+
+    sim_irq_disable();
+    CHECK(nrf_802154_request_buffer_free_async(p_data, async_buffer_done, (void *)1));
+    CHECK(nrf_802154_request_buffer_free_async(p_data, async_buffer_done, (void *)2));
+    sim_primask_set(0U);
+
+    CHECK(m_buffer_frees == 1U);
+    CHECK(m_rx_buffers[0].free);
+    CHECK(m_done_len == 2U);
+    CHECK((m_done_log[0] == 1U) && m_done_results[0]);
+    CHECK((m_done_log[1] == 2U) && !m_done_results[1]);
+
+    static const uint32_t prios[] = {SIM_PRIO_THREAD, SIM_PRIO_HIGH};
+
+    for (size_t i = 0U; i < sizeof(prios) / sizeof(prios[0]); i++)
+    {
+        logs_reset();
+        m_buffer_frees       = 0U;
+        m_rx_buffers[0].free = false;
+
+        sim_irq_disable();
+        CHECK(nrf_802154_request_buffer_free_async(p_data, async_buffer_done, (void *)3));
+        m_primask = 0U;
+        m_prio    = prios[i];
+        CHECK(!nrf_802154_request_buffer_free(p_data));
+        m_prio = SIM_PRIO_THREAD;
+        swi_poll();
+
+        CHECK(m_buffer_frees == 1U);
+        CHECK(m_done_len == 1U);
+        CHECK((m_done_log[0] == 3U) && m_done_results[0]);
+    }
+}
+
+/***************************************************************************************************
+ * @section Random scenario
+ **************************************************************************************************/
+
+/**
+ * @brief Unmasks interrupts. Sometimes the higher priority interrupt is taken before the SWI.
+ */
+static void irq_unmask(void)
+{
+    if ((xorshift32(&m_rand) % 2U) == 0U)
+    {
+        m_primask = 0U;
+        high_irq_run();
+    }
+    else
+    {
+        sim_primask_set(0U);
+    }
+}
+
+static void random_test(uint32_t ops)
+{
+    uint32_t issued;
+    uint32_t accepted = 0U;
+    uint32_t completed = 0U;
+
+    m_random = true;
+
+    for (uint32_t op = 0U; op < ops; op++)
+    {
+        uint32_t r = xorshift32(&m_rand) % 100U;
+
+        if (r < 35U)
+        {
+            (void)async_issue();
+        }
+        else if (r < 50U)
+        {
+            if (m_primask != 0U)
+            {
+                irq_unmask();
+            }
+            else
+            {
+                sim_irq_disable();
+            }
+        }
+        else if (r < 65U)
+        {
+            // A synchronous request from thread mode waits for the SWI.
+            if (m_primask == 0U)
+            {
+                (void)sync_issue();
+            }
+        }
+        else if (r < 80U)
+        {
+            high_irq_maybe_run(1U);
+        }
+        else
+        {
+            uint32_t count = 1U + xorshift32(&m_rand) % (SIM_QUEUE_SIZE + 1U);
+
+            sim_irq_disable();
+
+            for (uint32_t i = 0U; i < count; i++)
+            {
+                (void)async_issue();
+            }
+
+            irq_unmask();
+        }
+
+        if (m_next_seq + SIM_SEQ_PER_OP >= m_seq_max)
+        {
+            break;
+        }
+    }
+
+    if (m_primask != 0U)
+    {
+        sim_primask_set(0U);
+    }
+
+    m_random = false;
+    issued   = m_next_seq;
+
+    for (uint32_t seq = 1U; seq < issued; seq++)
+    {
+        if (mp_states[seq] != SIM_REQ_NONE)
+        {
+            accepted++;
+        }
+
+        if (mp_states[seq] == SIM_REQ_COMPLETED)
+        {
+            completed++;
+        }
+    }
+
+    CHECK(accepted == completed);
+    CHECK(m_pending_rd == m_pending_wr);
+
+    printf("random: %u requests, %u asynchronous accepted, %u SWI runs\n",
+           (unsigned)(issued - 1U), (unsigned)accepted, (unsigned)m_swi_runs);
+}
+
+/***************************************************************************************************
+ * @section Benchmark
+ **************************************************************************************************/
+
+static void bench_done(bool result, void * p_context)
+{
+    (void)result;
+    (void)p_context;
+}
+
+/**
+ * @brief Measures the mean time of a request issued from thread mode [ns].
+ *
+ * @param[in]  requests  Number of requests.
+ * @param[in]  burst     Number of asynchronous requests queued with interrupts masked or 0 for
+ *                       synchronous requests.
+ * @param[out] p_runs    SWI runs per request.
+ */
+static double request_time_get(uint32_t requests, uint32_t burst, double * p_runs)
+{
+    uint64_t best = UINT64_MAX;
+    uint32_t runs = 0U;
+
+    for (uint32_t round = 0U; round < SIM_BENCH_ROUNDS; round++)
+    {
+        uint32_t runs_start = m_swi_runs;
+        uint64_t start      = nanoseconds_get();
+
+        if (burst == 0U)
+        {
+            for (uint32_t i = 0U; i < requests; i++)
+            {
+                (void)nrf_802154_request_sleep(NRF_802154_TERM_NONE);
+            }
+        }
+        else
+        {
+            for (uint32_t i = 0U; i < requests; i += burst)
+            {
+                sim_irq_disable();
+
+                for (uint32_t k = 0U; k < burst; k++)
+                {
+                    (void)nrf_802154_request_sleep_async(NRF_802154_TERM_NONE, bench_done, NULL);
+                }
+
+                sim_primask_set(0U);
+            }
+        }
+
+        uint64_t time = nanoseconds_get() - start;
+
+        if (time < best)
+        {
+            best = time;
+            runs = m_swi_runs - runs_start;
+        }
+    }
+
+    *p_runs = (double)runs / requests;
+
+    return (double)best / requests;
+}
+
+static void request_benchmark(uint32_t requests)
+{
+    static const uint32_t bursts[] = {0U, 1U, SIM_QUEUE_SIZE};
+
+    printf("\nbenchmark: %u requests from thread mode\n", (unsigned)requests);
+
+    for (size_t i = 0U; i < sizeof(bursts) / sizeof(bursts[0]); i++)
+    {
+        double runs;
+        double time = request_time_get(requests, bursts[i], &runs);
+
+        if (bursts[i] == 0U)
+        {
+            printf("  synchronous:               %6.1f ns/request, %.3f SWI runs/request\n",
+                   time, runs);
+        }
+        else
+        {
+            printf("  asynchronous, bursts of %u: %6.1f ns/request, %.3f SWI runs/request\n",
+                   (unsigned)bursts[i], time, runs);
+        }
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t ops      = 200000U;
+    uint32_t requests = 1000000U;
+    uint32_t seed     = 1U;
+    int      opt      = 1;
+
+    while (opt + 1 < argc)
+    {
+        unsigned long value = strtoul(argv[opt + 1], NULL, 0);
+
+        if (strcmp(argv[opt], "-n") == 0)
+        {
+            ops = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-b") == 0)
+        {
+            requests = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-s") == 0)
+        {
+            seed = (uint32_t)value;
+        }
+        else
+        {
+            break;
+        }
+
+        opt += 2;
+    }
+
+    if ((opt != argc) || (seed == 0U) || (requests == 0U) || (ops > UINT32_MAX / SIM_SEQ_PER_OP))
+    {
+        fprintf(stderr,
+                "Usage: %s [-n <random operations>] [-b <benchmark requests>] [-s <seed>]\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    m_rand    = seed;
+    m_seq_max = (ops + 64U) * SIM_SEQ_PER_OP;
+    mp_states = calloc(m_seq_max, sizeof(mp_states[0]));
+
+    if (mp_states == NULL)
+    {
+        fprintf(stderr, "Out of memory\n");
+        return EXIT_FAILURE;
+    }
+
+    nrf_802154_request_init();
+
+    burst_test();
+    high_priority_test();
+    nested_test();
+    buffer_free_test();
+    printf("scripted: %s\n", (m_failures == 0U) ? "ok" : "failed");
+
+    random_test(ops);
+    request_benchmark(requests);
+
+    free(mp_states);
+
+    if (m_failures != 0U)
+    {
+        printf("\n%u checks failed\n", (unsigned)m_failures);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,1037 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run lossy channel simulator for the driver-side retransmissions.
+ *
+ * The simulator links nrf_802154_retransmission.c, nrf_802154_csma_ca.c,
+ * nrf_802154_csma_ca_backoff.c, nrf_802154_co.c and nrf_802154_pib.c unchanged and replaces
+ * the rest of the driver with a model of a single transmitter. The higher layer sends a stream of
+ * frames, one at a time, in two modes:
+ *
+ * - mac:    the driver does not retransmit, the higher layer requests a retransmission after each
+ *           failure notified by the driver,
+ * - driver: the driver retransmits the frames and notifies only the final result.
+ *
+ * Both modes use the same retransmission rules, so the same channel draws lead to the same
+ * outcome of every attempt. Only the time spent between the attempts differs. The higher layer
+ * reacts to a notification after the notification latency and its request reaches the driver
+ * after the request latency. The local profile models a higher layer on the radio core,
+ * the serialized profile models a higher layer on the application core.
+ *
+ * The channel is a Gilbert-Elliott model: a frame or its Ack is lost with a probability that
+ * depends on the state of the channel, and the state changes after every attempt. A CCA finds
+ * the channel busy with a fixed probability. Every attempt takes the radio ramp-up time, the CCA,
+ * the frame itself and the Ack or the Ack timeout.
+ *
+ * Besides the statistics, every run checks that each frame is notified exactly once, that
+ * the retransmission statistics of the notifications add up, that retransmissions reuse the frame
+ * properties returned by the failed attempt, and that both modes see the same attempts. Some
+ * scenarios check the expected outcome of every frame too. In the scenarios marked "rej", every
+ * attempt is overlapped by a transmit request for another frame, which the driver rejects. Such
+ * a request must not affect the retransmissions of the frame being transmitted. The program exits
+ * with a failure if any check fails.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -DNRF_802154_RETRANSMISSION_ENABLED=1 -DNRF_802154_USE_RAW_API=1 \
+ *         -o retransmission_sim ../../utils/nrf_802154_retransmission_sim.c \
+ *         driver/src/mac_features/nrf_802154_retransmission.c \
+ *         driver/src/mac_features/nrf_802154_csma_ca.c \
+ *         driver/src/mac_features/nrf_802154_csma_ca_backoff.c \
+ *         driver/src/mac_features/nrf_802154_frame_parser.c \
+ *         driver/src/nrf_802154_co.c driver/src/nrf_802154_pib.c \
+ *         -Icommon/include -Idriver/include -Idriver/src -Idriver/src/mac_features \
+ *         -Isl/include -Isl/sl_opensource/include \
+ *         -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis>
+ *
+ * Usage:
+ *
+ *     retransmission_sim [-f <frames>] [-l <psdu length>] [-r <max frame retries>] [-s <seed>]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_co.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_config.h"
+#include "nrf_802154_notification.h"
+#include "nrf_802154_pib.h"
+#include "nrf_802154_request.h"
+#include "nrf_802154_stats.h"
+#include "nrf_802154_tx_power.h"
+#include "mac_features/nrf_802154_csma_ca.h"
+#include "mac_features/nrf_802154_retransmission.h"
+#include "platform/nrf_802154_random.h"
+#include "rsch/nrf_802154_rsch.h"
+#include "nrf_802154_sl_timer.h"
+
+#define SIM_OCTET_TIME   (PHY_SYMBOLS_PER_OCTET * PHY_US_PER_SYMBOL) ///< Duration of one octet, in microseconds.
+#define SIM_SHR_PHR_TIME ((PHY_SHR_SYMBOLS * PHY_US_PER_SYMBOL) + SIM_OCTET_TIME)
+#define SIM_ACK_TIME     (SIM_SHR_PHR_TIME + IMM_ACK_LENGTH * SIM_OCTET_TIME)
+#define SIM_RAMP_UP_TIME 40U                                         ///< Radio ramp-up time, in microseconds.
+#define SIM_CCA_TIME     128U                                        ///< CCA time, in microseconds.
+#define SIM_NO_ACK_TIME  NRF_802154_PRECISE_ACK_TIMEOUT_DEFAULT_TIMEOUT
+#define SIM_EVENTS_MAX   8U                                          ///< Capacity of the event list.
+#define SIM_BUFFERS_NUM  2U                                          ///< Number of frame buffers, used in turns.
+#define SIM_ALWAYS       65536U                                      ///< Probability of a certain event, in 1/65536.
+#define SIM_PERCENT(x)   ((uint32_t)((x) * 65536U / 100U))
+#define SIM_TIME_NEVER   UINT64_MAX
+
+/**
+ * @brief Ways of retransmitting frames compared by the simulator.
+ */
+typedef enum
+{
+    SIM_MODE_MAC,    ///< The higher layer retransmits the frames.
+    SIM_MODE_DRIVER, ///< The driver retransmits the frames.
+} sim_mode_t;
+
+/**
+ * @brief Outcomes expected for every frame of a scenario.
+ */
+typedef enum
+{
+    SIM_EXPECT_ANY,           ///< No expectation.
+    SIM_EXPECT_FIRST_ATTEMPT, ///< Every frame ends after its first attempt.
+    SIM_EXPECT_ALL_NO_ACK,    ///< Every frame fails after all retries, all of them without an Ack.
+    SIM_EXPECT_ALL_BUSY,      ///< Every frame fails after all retries, all of them on a busy channel.
+} sim_expect_t;
+
+/**
+ * @brief Channel conditions and retransmission settings of a scenario.
+ */
+typedef struct
+{
+    const char                                * p_name;
+    bool                                        csma_ca;     ///< If the frames are transmitted with CSMA-CA.
+    nrf_802154_retransmission_csma_ca_restart_t restart;     ///< CSMA-CA restart policy.
+    uint32_t                                    busy;        ///< Probability of a busy CCA, in 1/65536.
+    uint32_t                                    loss_good;   ///< Probability of losing the frame or its Ack in the good state, in 1/65536.
+    uint32_t                                    loss_bad;    ///< Probability of losing the frame or its Ack in the bad state, in 1/65536.
+    uint32_t                                    good_to_bad; ///< Probability of entering the bad state after an attempt, in 1/65536.
+    uint32_t                                    bad_to_good; ///< Probability of leaving the bad state after an attempt, in 1/65536.
+    sim_expect_t                                expect;
+    bool                                        rejected;    ///< If every attempt is overlapped by a rejected request for another frame.
+} sim_scenario_t;
+
+/**
+ * @brief Latencies between the driver and the higher layer.
+ */
+typedef struct
+{
+    const char * p_name;
+    uint32_t     notify_us;  ///< From a notification in the driver to the higher layer acting on it.
+    uint32_t     request_us; ///< From a request of the higher layer to the driver acting on it.
+} sim_profile_t;
+
+/**
+ * @brief Kinds of events of the simulation.
+ */
+typedef enum
+{
+    SIM_EVENT_NOTIFIED, ///< The higher layer handles a notified result.
+    SIM_EVENT_REQUEST,  ///< A transmit request reaches the driver.
+    SIM_EVENT_TIMESLOT, ///< A delayed timeslot starts.
+} sim_event_kind_t;
+
+typedef struct
+{
+    uint64_t                       time;
+    sim_event_kind_t               kind;
+    uint8_t                      * p_frame;  ///< Frame concerned by the event.
+    nrf_802154_tx_error_t          error;    ///< Notified result.
+    rsch_dly_ts_id_t               id;       ///< Identifier of the delayed timeslot.
+    rsch_dly_ts_started_callback_t callback; ///< Callback of the delayed timeslot.
+} sim_event_t;
+
+typedef struct
+{
+    uint64_t delivered;    ///< Frames acknowledged by the receiver.
+    uint64_t failed;       ///< Frames dropped after all retries.
+    uint64_t attempts;     ///< Transmission attempts ended by a result.
+    uint64_t busy_channel; ///< Attempts that ended on a busy channel.
+    uint64_t no_ack;       ///< Attempts that ended without an Ack.
+    uint64_t latency_us;   ///< Sum of the times from the first request to the handled result.
+    uint64_t wakeups;      ///< Notification callouts called.
+    uint64_t end;          ///< Time when the last result was handled.
+    uint64_t violations;   ///< Failed checks.
+} sim_result_t;
+
+typedef struct
+{
+    uint8_t                              psdu[MAX_PACKET_SIZE + 1U]; ///< Frame with the PHR.
+    nrf_802154_transmitted_frame_props_t props;                      ///< Frame properties for the next request.
+    uint64_t                             first_request;              ///< Time when the first request reached the driver.
+    uint8_t                              attempts;                   ///< Attempts counted by the higher layer.
+    bool                                 result_pending;             ///< If the final result has not been notified yet.
+    bool                                 returned;                   ///< If a failed attempt has returned the frame properties.
+} sim_frame_t;
+
+static const sim_profile_t m_profiles[] =
+{
+    {"local",      20U,  15U },
+    {"serialized", 180U, 250U},
+};
+
+static const sim_scenario_t m_scenarios[] =
+{
+    {"clean",        true,  NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ACK_FAILURE, 0U,
+     0U,                 0U,                 0U,                0U,                SIM_EXPECT_FIRST_ATTEMPT},
+    {"loss-10",      true,  NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ACK_FAILURE, 0U,
+     SIM_PERCENT(10U),   0U,                 0U,                0U,                SIM_EXPECT_ANY          },
+    {"loss-30",      true,  NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ACK_FAILURE, 0U,
+     SIM_PERCENT(30U),   0U,                 0U,                0U,                SIM_EXPECT_ANY          },
+    {"bursty",       true,  NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ACK_FAILURE, 0U,
+     SIM_PERCENT(1U),    SIM_PERCENT(60U),   SIM_PERCENT(5U),   SIM_PERCENT(25U),  SIM_EXPECT_ANY          },
+    {"busy-always",  true,  NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ALWAYS,      SIM_PERCENT(40U),
+     SIM_PERCENT(10U),   0U,                 0U,                0U,                SIM_EXPECT_ANY          },
+    {"loss-30-cca",  true,  NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_NEVER,       SIM_PERCENT(10U),
+     SIM_PERCENT(30U),   0U,                 0U,                0U,                SIM_EXPECT_ANY          },
+    {"loss-30-nocs", false, NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ACK_FAILURE, 0U,
+     SIM_PERCENT(30U),   0U,                 0U,                0U,                SIM_EXPECT_ANY          },
+    {"loss-30-rej",  true,  NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ACK_FAILURE, 0U,
+     SIM_PERCENT(30U),   0U,                 0U,                0U,                SIM_EXPECT_ANY,
+     true},
+    {"dead-link-rej", true, NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ACK_FAILURE, 0U,
+     SIM_ALWAYS,         0U,                 0U,                0U,                SIM_EXPECT_ALL_NO_ACK,
+     true},
+    {"dead-link",    true,  NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ACK_FAILURE, 0U,
+     SIM_ALWAYS,         0U,                 0U,                0U,                SIM_EXPECT_ALL_NO_ACK   },
+    {"jammed",       true,  NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ACK_FAILURE, SIM_ALWAYS,
+     0U,                 0U,                 0U,                0U,                SIM_EXPECT_FIRST_ATTEMPT},
+    {"jammed-always", true, NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ALWAYS,      SIM_ALWAYS,
+     0U,                 0U,                 0U,                0U,                SIM_EXPECT_ALL_BUSY     },
+};
+
+volatile nrf_802154_stat_timestamps_t g_nrf_802154_stat_timestamps;
+
+static uint32_t    m_channel_rng; ///< Generator of the channel draws.
+static uint32_t    m_backoff_rng; ///< Generator of the CSMA-CA backoffs.
+static uint64_t    m_now;
+static sim_event_t m_events[SIM_EVENTS_MAX];
+static size_t      m_events_len;
+static bool        m_channel_bad;
+
+static sim_frame_t            m_frames[SIM_BUFFERS_NUM];
+static uint8_t                m_ack[IMM_ACK_LENGTH + 1U];
+static uint8_t                m_psdu_length;
+static uint8_t                m_max_retries;
+static uint32_t               m_next_frame;
+static uint32_t               m_frames_left;  ///< Frames not requested yet.
+static uint32_t               m_results_left; ///< Frames whose final result has not been handled yet.
+static uint32_t               m_csma_ca_starts;
+static const sim_scenario_t * mp_scenario;
+static const sim_profile_t  * mp_profile;
+static sim_mode_t             m_mode;
+static sim_result_t           m_result;
+
+static uint8_t                            * mp_radio_frame; ///< Frame being transmitted, NULL if the radio is idle.
+static nrf_802154_transmitted_frame_props_t m_radio_props;
+static bool                                 m_radio_cca;    ///< If the radio is performing the CCA.
+static bool                                 m_radio_acked;
+static uint64_t                             m_radio_done;
+
+static uint32_t xorshift32(uint32_t * p_state)
+{
+    uint32_t x = *p_state;
+
+    x        ^= x << 13;
+    x        ^= x >> 17;
+    x        ^= x << 5;
+    *p_state  = x;
+
+    return x;
+}
+
+static bool draw(uint32_t probability)
+{
+    return (xorshift32(&m_channel_rng) & 0xffffU) < probability;
+}
+
+static sim_frame_t * frame_get(const uint8_t * p_data)
+{
+    return (sim_frame_t *)(p_data - offsetof(sim_frame_t, psdu));
+}
+
+static void violation(const char * p_what)
+{
+    if (m_result.violations++ == 0U)
+    {
+        fprintf(stderr, "%s/%s/%s: %s\n",
+                mp_scenario->p_name,
+                mp_profile->p_name,
+                (m_mode == SIM_MODE_MAC) ? "mac" : "driver",
+                p_what);
+    }
+}
+
+static void event_add(sim_event_t event)
+{
+    size_t idx = m_events_len;
+
+    if (m_events_len >= SIM_EVENTS_MAX)
+    {
+        fprintf(stderr, "Event list overflow\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Keep the list sorted by time, events at the same time are handled in order of addition
+    while ((idx > 0U) && (m_events[idx - 1U].time > event.time))
+    {
+        m_events[idx] = m_events[idx - 1U];
+        idx--;
+    }
+
+    m_events[idx] = event;
+    m_events_len++;
+}
+
+static bool retransmission_required(const sim_frame_t * p_frame, nrf_802154_tx_error_t error)
+{
+    if (p_frame->attempts > m_max_retries)
+    {
+        return false;
+    }
+
+    switch (error)
+    {
+        case NRF_802154_TX_ERROR_NO_ACK:
+        case NRF_802154_TX_ERROR_INVALID_ACK:
+            return true;
+
+        case NRF_802154_TX_ERROR_BUSY_CHANNEL:
+            return mp_scenario->csma_ca &&
+                   (mp_scenario->restart == NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_ALWAYS);
+
+        default:
+            return false;
+    }
+}
+
+/**
+ * @brief Requests a transmission the way nrf_802154_transmit_raw and
+ *        nrf_802154_transmit_csma_ca_raw do.
+ */
+static bool frame_request(sim_frame_t * p_frame, bool csma_ca)
+{
+    p_frame->attempts++;
+
+    if (csma_ca)
+    {
+        nrf_802154_transmit_csma_ca_metadata_t metadata = {.frame_props = p_frame->props};
+
+        if (!nrf_802154_retransmission_csma_ca_register(p_frame->psdu, &metadata))
+        {
+            return false;
+        }
+
+        return nrf_802154_request_csma_ca_start(p_frame->psdu, &metadata);
+    }
+
+    nrf_802154_transmit_params_t params =
+    {
+        .frame_props = p_frame->props,
+        .channel     = nrf_802154_pib_channel_get(),
+        .cca         = true,
+    };
+
+    if (!nrf_802154_retransmission_transmit_register(p_frame->psdu, &params))
+    {
+        return false;
+    }
+
+    return nrf_802154_request_transmit(NRF_802154_TERM_NONE,
+                                       REQ_ORIG_HIGHER_LAYER,
+                                       p_frame->psdu,
+                                       &params,
+                                       NULL);
+}
+
+static sim_frame_t * frame_build(void)
+{
+    sim_frame_t * p_frame = &m_frames[m_next_frame];
+
+    m_next_frame = (m_next_frame + 1U) % SIM_BUFFERS_NUM;
+
+    memset(p_frame, 0, sizeof(*p_frame));
+    p_frame->psdu[PHR_OFFSET]        = m_psdu_length;
+    p_frame->psdu[FRAME_TYPE_OFFSET] = FRAME_TYPE_DATA | ACK_REQUEST_BIT | SECURITY_ENABLED_BIT;
+    p_frame->props                   = (nrf_802154_transmitted_frame_props_t)
+    {
+        .is_secured          = true,
+        .dynamic_data_is_set = false,
+    };
+
+    return p_frame;
+}
+
+/**
+ * @brief Requests the transmission of the idle buffer while the radio is busy, the way
+ *        nrf_802154_transmit_raw does, and checks that the request is rejected.
+ */
+static void request_rejected(void)
+{
+    uint8_t                    * p_data = m_frames[m_next_frame].psdu;
+    nrf_802154_transmit_params_t params =
+    {
+        .frame_props = NRF_802154_TRANSMITTED_FRAME_PROPS_DEFAULT_INIT,
+        .channel     = nrf_802154_pib_channel_get(),
+        .cca         = true,
+    };
+
+    if (!nrf_802154_retransmission_transmit_register(p_data, &params))
+    {
+        violation("idle frame not registered");
+        return;
+    }
+
+    if (nrf_802154_request_transmit(NRF_802154_TERM_NONE,
+                                    REQ_ORIG_HIGHER_LAYER,
+                                    p_data,
+                                    &params,
+                                    NULL))
+    {
+        violation("request accepted while the radio is busy");
+    }
+
+    nrf_802154_retransmission_unregister(p_data);
+}
+
+static void radio_tx_start(void)
+{
+    uint64_t air = SIM_SHR_PHR_TIME + (uint64_t)mp_radio_frame[PHR_OFFSET] * SIM_OCTET_TIME;
+
+    (void)nrf_802154_csma_ca_tx_started_hook(mp_radio_frame);
+
+    m_radio_cca   = false;
+    m_radio_acked = !draw(m_channel_bad ? mp_scenario->loss_bad : mp_scenario->loss_good);
+    m_radio_done  = m_now + air + ACK_IFS + (m_radio_acked ? SIM_ACK_TIME : SIM_NO_ACK_TIME);
+
+    if (mp_scenario->rejected)
+    {
+        request_rejected();
+    }
+
+    // The state of the channel changes after every attempt
+    if (draw(m_channel_bad ? mp_scenario->bad_to_good : mp_scenario->good_to_bad))
+    {
+        m_channel_bad = !m_channel_bad;
+    }
+}
+
+/**
+ * @brief Ends the current step of the radio, as the core does at the end of the CCA or
+ *        of the Ack reception.
+ */
+static void radio_done(void)
+{
+    uint8_t                           * p_data   = mp_radio_frame;
+    nrf_802154_transmit_done_metadata_t metadata = {};
+
+    m_now = m_radio_done;
+
+    // The core secures the frame in the first attempt and returns the updated properties
+    metadata.frame_props                     = m_radio_props;
+    metadata.frame_props.dynamic_data_is_set = true;
+
+    if (m_radio_cca)
+    {
+        if (!draw(mp_scenario->busy))
+        {
+            radio_tx_start();
+            return;
+        }
+
+        mp_radio_frame = NULL;
+
+        if (nrf_802154_csma_ca_tx_failed_hook(p_data, NRF_802154_TX_ERROR_BUSY_CHANNEL))
+        {
+            frame_get(p_data)->returned = true;
+            nrf_802154_notify_transmit_failed(p_data, NRF_802154_TX_ERROR_BUSY_CHANNEL, &metadata);
+        }
+
+        return;
+    }
+
+    mp_radio_frame             = NULL;
+    frame_get(p_data)->returned = true;
+
+    if (m_radio_acked)
+    {
+        metadata.data.transmitted.p_ack = m_ack;
+        nrf_802154_co_transmitted_raw(p_data, &metadata);
+    }
+    else
+    {
+        // Same as the precise Ack timeout, which notifies the failure directly
+        nrf_802154_notify_transmit_failed(p_data, NRF_802154_TX_ERROR_NO_ACK, &metadata);
+    }
+}
+
+bool nrf_802154_request_transmit(nrf_802154_term_t              term_lvl,
+                                 req_originator_t               req_orig,
+                                 uint8_t                      * p_data,
+                                 nrf_802154_transmit_params_t * p_params,
+                                 nrf_802154_notification_func_t notify_function)
+{
+    bool result = (mp_radio_frame == NULL);
+
+    (void)term_lvl;
+    (void)req_orig;
+
+    if (result)
+    {
+        if (frame_get(p_data)->returned && !p_params->frame_props.dynamic_data_is_set)
+        {
+            violation("retransmission secures the frame again");
+        }
+
+        mp_radio_frame = p_data;
+        m_radio_props  = p_params->frame_props;
+
+        if (p_params->cca)
+        {
+            m_radio_cca  = true;
+            m_radio_done = m_now + SIM_RAMP_UP_TIME + SIM_CCA_TIME;
+        }
+        else
+        {
+            m_now += SIM_RAMP_UP_TIME;
+            radio_tx_start();
+        }
+    }
+
+    if (notify_function != NULL)
+    {
+        notify_function(result);
+    }
+
+    return result;
+}
+
+bool nrf_802154_request_csma_ca_start(uint8_t                                      * p_data,
+                                      const nrf_802154_transmit_csma_ca_metadata_t * p_metadata)
+{
+    if (frame_get(p_data)->returned && !p_metadata->frame_props.dynamic_data_is_set)
+    {
+        violation("retransmission secures the frame again");
+    }
+
+    m_csma_ca_starts++;
+
+    return nrf_802154_csma_ca_start(p_data, p_metadata);
+}
+
+void nrf_802154_notify_transmit_failed(uint8_t                                   * p_frame,
+                                       nrf_802154_tx_error_t                       error,
+                                       const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    nrf_802154_co_transmit_failed(p_frame, error, p_metadata);
+}
+
+bool nrf_802154_rsch_delayed_timeslot_request(const rsch_dly_ts_param_t * p_dly_ts_param)
+{
+    event_add((sim_event_t)
+    {
+        .time     = p_dly_ts_param->trigger_time,
+        .kind     = SIM_EVENT_TIMESLOT,
+        .id       = p_dly_ts_param->id,
+        .callback = p_dly_ts_param->started_callback,
+    });
+
+    return true;
+}
+
+bool nrf_802154_rsch_delayed_timeslot_cancel(rsch_dly_ts_id_t dly_ts_id, bool handler)
+{
+    (void)handler;
+
+    for (size_t i = 0U; i < m_events_len; i++)
+    {
+        if ((m_events[i].kind == SIM_EVENT_TIMESLOT) && (m_events[i].id == dly_ts_id))
+        {
+            m_events_len--;
+            memmove(&m_events[i], &m_events[i + 1U], (m_events_len - i) * sizeof(m_events[0]));
+            return true;
+        }
+    }
+
+    return false;
+}
+
+bool nrf_802154_rsch_delayed_timeslot_priority_update(rsch_dly_ts_id_t dly_ts_id,
+                                                      rsch_prio_t      dly_ts_prio)
+{
+    (void)dly_ts_id;
+    (void)dly_ts_prio;
+
+    return true;
+}
+
+uint64_t nrf_802154_sl_timer_current_time_get(void)
+{
+    return m_now;
+}
+
+uint32_t nrf_802154_random_get(void)
+{
+    return xorshift32(&m_backoff_rng);
+}
+
+int8_t nrf_802154_tx_power_convert_metadata_to_tx_power_split(
+    uint8_t                                 channel,
+    nrf_802154_tx_power_metadata_t          tx_power,
+    nrf_802154_fal_tx_power_split_t * const p_tx_power_split)
+{
+    (void)channel;
+    (void)tx_power;
+
+    memset(p_tx_power_split, 0, sizeof(*p_tx_power_split));
+
+    return 0;
+}
+
+static void result_notify(uint8_t                                   * p_frame,
+                          nrf_802154_tx_error_t                       error,
+                          const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    sim_frame_t                         * p_sim_frame = frame_get(p_frame);
+    const nrf_802154_transmit_retries_t * p_retries   = &p_metadata->retries;
+
+    if (!p_sim_frame->result_pending)
+    {
+        violation("result notified twice");
+    }
+
+    m_result.wakeups++;
+    p_sim_frame->props = p_metadata->frame_props;
+
+    if (m_mode == SIM_MODE_DRIVER)
+    {
+        p_sim_frame->result_pending = false;
+
+        if ((p_retries->attempts == 0U) ||
+            (p_retries->attempts > (uint16_t)m_max_retries + 1U) ||
+            (p_retries->attempts != p_retries->busy_channel + p_retries->no_ack +
+             ((error == NRF_802154_TX_ERROR_NONE) ? 1U : 0U)))
+        {
+            violation("retransmission statistics do not add up");
+        }
+
+        // The higher layer requested the frame once, the driver reports all the attempts
+        p_sim_frame->attempts  = p_retries->attempts;
+        m_result.attempts     += p_retries->attempts;
+        m_result.busy_channel += p_retries->busy_channel;
+        m_result.no_ack       += p_retries->no_ack;
+    }
+    else
+    {
+        m_result.attempts++;
+        m_result.busy_channel += (error == NRF_802154_TX_ERROR_BUSY_CHANNEL) ? 1U : 0U;
+        m_result.no_ack       += ((error == NRF_802154_TX_ERROR_NO_ACK) ||
+                                  (error == NRF_802154_TX_ERROR_INVALID_ACK)) ? 1U : 0U;
+    }
+
+    event_add((sim_event_t)
+    {
+        .time    = m_now + mp_profile->notify_us,
+        .kind    = SIM_EVENT_NOTIFIED,
+        .p_frame = p_frame,
+        .error   = error,
+    });
+}
+
+void nrf_802154_transmitted_raw(uint8_t                                   * p_frame,
+                                const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    result_notify(p_frame, NRF_802154_TX_ERROR_NONE, p_metadata);
+}
+
+void nrf_802154_transmit_failed(uint8_t                                   * p_frame,
+                                nrf_802154_tx_error_t                       error,
+                                const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    result_notify(p_frame, error, p_metadata);
+}
+
+// Notifications of the other operations are not used by the simulator
+void nrf_802154_tx_started(const uint8_t * p_frame)
+{
+    (void)p_frame;
+}
+
+void nrf_802154_tx_ack_started(const uint8_t * p_data)
+{
+    (void)p_data;
+}
+
+void nrf_802154_received_raw(uint8_t * p_data, int8_t power, uint8_t lqi)
+{
+    (void)p_data;
+    (void)power;
+    (void)lqi;
+}
+
+void nrf_802154_receive_failed(nrf_802154_rx_error_t error, uint32_t id)
+{
+    (void)error;
+    (void)id;
+}
+
+void nrf_802154_cca_done(bool channel_free)
+{
+    (void)channel_free;
+}
+
+void nrf_802154_cca_failed(nrf_802154_cca_error_t error)
+{
+    (void)error;
+}
+
+void nrf_802154_energy_detected(const nrf_802154_energy_detected_t * p_result)
+{
+    (void)p_result;
+}
+
+void nrf_802154_energy_detection_failed(nrf_802154_ed_error_t error)
+{
+    (void)error;
+}
+
+static void request_handle(uint8_t * p_data)
+{
+    sim_frame_t * p_frame = (p_data != NULL) ? frame_get(p_data) : frame_build();
+    bool          csma_ca = mp_scenario->csma_ca;
+
+    if (p_data == NULL)
+    {
+        p_frame->first_request  = m_now;
+        p_frame->result_pending = true;
+    }
+    else if (mp_scenario->restart == NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_NEVER)
+    {
+        // Retransmission after a single CCA, as the driver does with this policy
+        csma_ca = false;
+    }
+
+    if (!frame_request(p_frame, csma_ca))
+    {
+        fprintf(stderr, "Transmit request refused\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void expectation_check(const sim_frame_t * p_frame, nrf_802154_tx_error_t error)
+{
+    uint8_t all = m_max_retries + 1U;
+
+    switch (mp_scenario->expect)
+    {
+        case SIM_EXPECT_FIRST_ATTEMPT:
+            if (p_frame->attempts != 1U)
+            {
+                violation("frame retransmitted");
+            }
+            break;
+
+        case SIM_EXPECT_ALL_NO_ACK:
+            if ((error != NRF_802154_TX_ERROR_NO_ACK) || (p_frame->attempts != all))
+            {
+                violation("frame not retransmitted until the retries ran out");
+            }
+            break;
+
+        case SIM_EXPECT_ALL_BUSY:
+            if ((error != NRF_802154_TX_ERROR_BUSY_CHANNEL) || (p_frame->attempts != all))
+            {
+                violation("channel access failure not retransmitted until the retries ran out");
+            }
+            break;
+
+        default:
+            break;
+    }
+}
+
+static void notified_handle(uint8_t * p_data, nrf_802154_tx_error_t error)
+{
+    sim_frame_t * p_frame = frame_get(p_data);
+
+    if ((m_mode == SIM_MODE_MAC) && (error != NRF_802154_TX_ERROR_NONE) &&
+        retransmission_required(p_frame, error))
+    {
+        event_add((sim_event_t)
+        {
+            .time    = m_now + mp_profile->request_us,
+            .kind    = SIM_EVENT_REQUEST,
+            .p_frame = p_data,
+        });
+        return;
+    }
+
+    expectation_check(p_frame, error);
+    p_frame->result_pending = false;
+
+    if (error == NRF_802154_TX_ERROR_NONE)
+    {
+        m_result.delivered++;
+    }
+    else
+    {
+        m_result.failed++;
+    }
+
+    m_result.latency_us += m_now - p_frame->first_request;
+    m_result.end         = m_now;
+    m_results_left--;
+
+    if (m_frames_left > 0U)
+    {
+        m_frames_left--;
+        event_add((sim_event_t)
+        {
+            .time = m_now + mp_profile->request_us,
+            .kind = SIM_EVENT_REQUEST,
+        });
+    }
+}
+
+static void event_handle(const sim_event_t * p_event)
+{
+    switch (p_event->kind)
+    {
+        case SIM_EVENT_NOTIFIED:
+            notified_handle(p_event->p_frame, p_event->error);
+            break;
+
+        case SIM_EVENT_REQUEST:
+            request_handle(p_event->p_frame);
+            break;
+
+        case SIM_EVENT_TIMESLOT:
+            p_event->callback(p_event->id);
+            break;
+    }
+}
+
+static sim_result_t run(const sim_scenario_t * p_scenario,
+                        const sim_profile_t  * p_profile,
+                        sim_mode_t             mode,
+                        uint32_t               frames,
+                        uint32_t               seed)
+{
+    nrf_802154_retransmission_config_t config =
+    {
+        .max_frame_retries = (mode == SIM_MODE_DRIVER) ? m_max_retries : 0U,
+        .csma_ca_restart   = p_scenario->restart,
+        .frame_pending     = NRF_802154_RETRANSMISSION_FRAME_PENDING_DATA_REQ,
+    };
+
+    mp_scenario     = p_scenario;
+    mp_profile      = p_profile;
+    m_mode          = mode;
+    m_channel_rng   = seed;
+    m_backoff_rng   = seed ^ 0x5bd1e995U;
+    m_now           = 0U;
+    m_events_len    = 0U;
+    m_channel_bad   = false;
+    m_next_frame    = 0U;
+    m_frames_left   = frames - 1U;
+    m_results_left  = frames;
+    m_csma_ca_starts = 0U;
+    mp_radio_frame  = NULL;
+    memset(&m_result, 0, sizeof(m_result));
+
+    nrf_802154_pib_init();
+    nrf_802154_retransmission_init();
+
+    if (!nrf_802154_pib_retransmission_config_set(&config))
+    {
+        fprintf(stderr, "Invalid retransmission configuration\n");
+        exit(EXIT_FAILURE);
+    }
+
+    event_add((sim_event_t){.time = 0U, .kind = SIM_EVENT_REQUEST});
+
+    while ((m_events_len > 0U) || (mp_radio_frame != NULL))
+    {
+        if ((mp_radio_frame != NULL) && ((m_events_len == 0U) || (m_radio_done <= m_events[0].time)))
+        {
+            radio_done();
+            continue;
+        }
+
+        sim_event_t event = m_events[0];
+
+        m_events_len--;
+        memmove(&m_events[0], &m_events[1], m_events_len * sizeof(m_events[0]));
+
+        m_now = event.time;
+        event_handle(&event);
+    }
+
+    if (m_results_left != 0U)
+    {
+        violation("frame lost by the driver");
+    }
+
+    if ((m_result.delivered + m_result.failed) != frames)
+    {
+        violation("frame counts do not add up");
+    }
+
+    if ((m_result.attempts != m_result.busy_channel + m_result.no_ack + m_result.delivered))
+    {
+        violation("attempt counts do not add up");
+    }
+
+    if ((p_scenario->restart == NRF_802154_RETRANSMISSION_CSMA_CA_RESTART_NEVER) &&
+        (m_csma_ca_starts != frames))
+    {
+        violation("CSMA-CA restarted in spite of the policy");
+    }
+
+    return m_result;
+}
+
+static void result_print(const char         * p_mode,
+                         const sim_result_t * p_result,
+                         uint32_t             frames)
+{
+    double seconds = (double)p_result->end / 1000000.0;
+
+    printf("  %-7s %9.2f%% %10.3f %12.1f %10.1f %10.3f\n",
+           p_mode,
+           100.0 * (double)p_result->delivered / frames,
+           (double)p_result->attempts / frames,
+           (double)p_result->latency_us / frames,
+           (seconds > 0.0) ? (double)frames / seconds : 0.0,
+           (double)p_result->wakeups / frames);
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t frames     = 20000U;
+    uint32_t seed       = 0x2545f491U;
+    uint64_t violations = 0U;
+    int      opt        = 1;
+
+    m_psdu_length = 60U;
+    m_max_retries = 3U;
+
+    while (opt + 1 < argc)
+    {
+        unsigned long value = strtoul(argv[opt + 1], NULL, 0);
+
+        if (strcmp(argv[opt], "-f") == 0)
+        {
+            frames = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-l") == 0)
+        {
+            m_psdu_length = (uint8_t)value;
+        }
+        else if (strcmp(argv[opt], "-r") == 0)
+        {
+            m_max_retries = (uint8_t)value;
+        }
+        else if (strcmp(argv[opt], "-s") == 0)
+        {
+            seed = (uint32_t)value;
+        }
+        else
+        {
+            break;
+        }
+
+        opt += 2;
+    }
+
+    if ((opt != argc) || (frames == 0U) || (seed == 0U) || (m_max_retries == UINT8_MAX) ||
+        (m_psdu_length < IMM_ACK_LENGTH) || (m_psdu_length > MAX_PACKET_SIZE))
+    {
+        fprintf(stderr,
+                "Usage: %s [-f <frames>] [-l <psdu length>] [-r <max frame retries>] [-s <seed>]\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    m_ack[PHR_OFFSET]        = IMM_ACK_LENGTH;
+    m_ack[FRAME_TYPE_OFFSET] = FRAME_TYPE_ACK;
+
+    printf("%u frames of %u octets, up to %u retries\n\n",
+           (unsigned)frames, (unsigned)m_psdu_length, (unsigned)m_max_retries);
+
+    for (size_t s = 0U; s < sizeof(m_scenarios) / sizeof(m_scenarios[0]); s++)
+    {
+        for (size_t p = 0U; p < sizeof(m_profiles) / sizeof(m_profiles[0]); p++)
+        {
+            sim_result_t mac    = run(&m_scenarios[s], &m_profiles[p], SIM_MODE_MAC, frames, seed);
+            sim_result_t driver = run(&m_scenarios[s], &m_profiles[p], SIM_MODE_DRIVER, frames,
+                                      seed);
+
+            printf("%s, %s higher layer\n", m_scenarios[s].p_name, m_profiles[p].p_name);
+            printf("  %-7s %10s %10s %12s %10s %10s\n",
+                   "mode", "delivered", "attempts", "latency [us]", "frames/s", "wakeups");
+            result_print("mac", &mac, frames);
+            result_print("driver", &driver, frames);
+
+            violations += mac.violations + driver.violations;
+
+            if ((mac.delivered != driver.delivered) || (mac.attempts != driver.attempts) ||
+                (mac.busy_channel != driver.busy_channel) || (mac.no_ack != driver.no_ack))
+            {
+                printf("  error: the modes see different attempts\n");
+                violations++;
+            }
+        }
+    }
+
+    if (violations != 0U)
+    {
+        printf("\n%llu checks failed\n", (unsigned long long)violations);
+        return EXIT_FAILURE;
+    }
+
+    printf("\nAll checks passed\n");
+
+    return EXIT_SUCCESS;
+}
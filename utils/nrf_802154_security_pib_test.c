@@ -0,0 +1,481 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run test and benchmark of the RAM security PIB.
+ *
+ * The program links nrf_802154_security_pib_ram.c unchanged. It runs in two parts:
+ *
+ * - test:      stores keys up to the capacity of the storage, with Key Identifier modes 1 and 2
+ *              sharing Key Indexes, and checks the lookups, the errors, the key handles and
+ *              the removal of all keys. It then rotates the keys the way the higher layer does,
+ *              removing a key and storing another one, and checks after each rotation that every
+ *              stored key is found. It finally checks that the global frame counter never goes
+ *              back while the higher layer sets it, that per-key frame counters are independent,
+ *              and that the counters overflow.
+ * - benchmark: reports the time of a key lookup and frame counter reservation for a random stored
+ *              key, as done for each secured frame, and the time of a lookup of a key that is not
+ *              stored, as done for frames secured with an unknown key. Both are measured before
+ *              and after the key rotations, which leave tombstones in the key index.
+ *
+ * Build it with different NRF_802154_SECURITY_KEY_STORAGE_SIZE values to cover different index
+ * sizes. The program exits with a failure if any check fails.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -DNRF_802154_SECURITY_KEY_STORAGE_SIZE=64 \
+ *         -o security_pib_test ../../utils/nrf_802154_security_pib_test.c \
+ *         driver/src/mac_features/nrf_802154_security_pib_ram.c \
+ *         -Icommon/include -Idriver/include -Idriver/src -Idriver/src/mac_features \
+ *         -Isl/include -Isl/sl_opensource/include \
+ *         -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis>
+ *
+ * Usage:
+ *
+ *     security_pib_test [-r <rotations>] [-b <benchmark lookups>] [-s <seed>]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "nrf_802154_config.h"
+#include "nrf_802154_const.h"
+#include "mac_features/nrf_802154_security_pib.h"
+
+#define TEST_KEYS   NRF_802154_SECURITY_KEY_STORAGE_SIZE ///< Number of keys stored.
+#define TEST_FC     100U                                 ///< Initial frame counter of the keys.
+#define TEST_ROUNDS 5U                                   ///< Benchmark rounds, the best is reported.
+
+#define CHECK(cond)                                                     \
+    do                                                                  \
+    {                                                                   \
+        if (!(cond))                                                    \
+        {                                                               \
+            printf("  check failed at line %d: %s\n", __LINE__, #cond); \
+            m_failures++;                                               \
+        }                                                               \
+    }                                                                   \
+    while (0)
+
+static uint32_t m_failures; ///< Number of failed checks.
+
+static uint8_t             m_ids[TEST_KEYS + 1U][KEY_ID_MODE_3_SIZE]; ///< Key Identifiers.
+static nrf_802154_key_id_t m_key_ids[TEST_KEYS + 1U];                 ///< Key IDs, one spare.
+
+static uint32_t xorshift32(uint32_t * p_state)
+{
+    uint32_t x = *p_state;
+
+    x        ^= x << 13;
+    x        ^= x >> 17;
+    x        ^= x << 5;
+    *p_state  = x;
+
+    return x;
+}
+
+static uint64_t nanoseconds_get(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return (uint64_t)ts.tv_sec * 1000000000ULL + (uint64_t)ts.tv_nsec;
+}
+
+/***************************************************************************************************
+ * @section Keys
+ **************************************************************************************************/
+
+/**
+ * @brief Sets the ID of a key. Every fourth key uses mode 2, the others mode 1, so that keys
+ *        of both modes share Key Indexes.
+ */
+static void key_id_set(uint32_t i, uint8_t key_index)
+{
+    nrf_802154_key_id_mode_t mode = ((i % 4U) == 3U) ? KEY_ID_MODE_2 : KEY_ID_MODE_1;
+
+    memset(m_ids[i], 0, sizeof(m_ids[i]));
+
+    if (mode == KEY_ID_MODE_2)
+    {
+        memset(m_ids[i], 0xff, KEY_ID_MODE_2_SIZE - 1U);
+        m_ids[i][KEY_ID_MODE_2_SIZE - 1U] = key_index;
+    }
+    else
+    {
+        m_ids[i][0] = key_index;
+    }
+
+    m_key_ids[i].mode     = mode;
+    m_key_ids[i].p_key_id = m_ids[i];
+}
+
+/**
+ * @brief Gets the Key Index of a key.
+ */
+static uint8_t key_index_get(uint32_t i)
+{
+    return (m_key_ids[i].mode == KEY_ID_MODE_2) ? m_ids[i][KEY_ID_MODE_2_SIZE - 1U] : m_ids[i][0];
+}
+
+/**
+ * @brief Stores a key whose value starts with its number.
+ */
+static nrf_802154_security_error_t key_store(uint32_t i, bool global, uint32_t frame_counter)
+{
+    uint8_t          value[AES_CCM_KEY_SIZE] = {(uint8_t)i};
+    nrf_802154_key_t key;
+
+    key.value.p_cleartext_key    = value;
+    key.id                       = m_key_ids[i];
+    key.type                     = NRF_802154_KEY_CLEARTEXT;
+    key.frame_counter            = frame_counter;
+    key.use_global_frame_counter = global;
+
+    return nrf_802154_security_pib_key_store(&key);
+}
+
+/**
+ * @brief Checks that a key is stored with its value.
+ */
+static bool key_is_stored(uint32_t i)
+{
+    uint8_t value[AES_CCM_KEY_SIZE];
+
+    return (nrf_802154_security_pib_key_use(&m_key_ids[i], value) ==
+            NRF_802154_SECURITY_ERROR_NONE) && (value[0] == (uint8_t)i);
+}
+
+static void keys_store_all(void)
+{
+    nrf_802154_security_pib_init();
+
+    for (uint32_t i = 0; i < TEST_KEYS; i++)
+    {
+        key_id_set(i, (uint8_t)(i + 1U));
+        CHECK(key_store(i, (i % 2U) == 0U, TEST_FC) == NRF_802154_SECURITY_ERROR_NONE);
+    }
+}
+
+/**
+ * @brief Replaces a random key with one of the same mode and a random Key Index not in use.
+ *
+ * @returns Number of the replaced key.
+ */
+static uint32_t key_rotate(uint32_t * p_seed)
+{
+    uint32_t                    i = xorshift32(p_seed) % TEST_KEYS;
+    nrf_802154_security_error_t result;
+
+    CHECK(nrf_802154_security_pib_key_remove(&m_key_ids[i]) == NRF_802154_SECURITY_ERROR_NONE);
+    CHECK(!key_is_stored(i));
+
+    key_id_set(i, (uint8_t)xorshift32(p_seed));
+
+    // The Key Index may be used by another key of the same mode, then the next one is tried.
+    while ((result = key_store(i, true, 0U)) == NRF_802154_SECURITY_ERROR_ALREADY_PRESENT)
+    {
+        key_id_set(i, key_index_get(i) + 1U);
+    }
+
+    CHECK(result == NRF_802154_SECURITY_ERROR_NONE);
+
+    return i;
+}
+
+/***************************************************************************************************
+ * @section Test
+ **************************************************************************************************/
+
+static void keys_test(uint32_t rotations, uint32_t seed)
+{
+    uint32_t                             failures = m_failures;
+    uint8_t                              value[AES_CCM_KEY_SIZE];
+    nrf_802154_security_pib_key_handle_t handles[2];
+    bool                                 rotated = false;
+
+    printf("test: %u keys, %u rotations\n", (unsigned)TEST_KEYS, (unsigned)rotations);
+
+    keys_store_all();
+
+    for (uint32_t i = 0; i < TEST_KEYS; i++)
+    {
+        CHECK(key_is_stored(i));
+    }
+
+    CHECK(key_store(0U, true, 0U) == NRF_802154_SECURITY_ERROR_ALREADY_PRESENT);
+
+    key_id_set(TEST_KEYS, 0xeeU);
+    CHECK(key_store(TEST_KEYS, true, 0U) == NRF_802154_SECURITY_ERROR_STORAGE_FULL);
+    CHECK(nrf_802154_security_pib_key_use(&m_key_ids[TEST_KEYS], value) ==
+          NRF_802154_SECURITY_ERROR_KEY_NOT_FOUND);
+
+    // A handle is invalidated by the removal of its key, even if the same ID is stored again.
+    for (uint32_t i = 0; i < 2U; i++)
+    {
+        CHECK(nrf_802154_security_pib_key_handle_get(&m_key_ids[i], &handles[i]) ==
+              NRF_802154_SECURITY_ERROR_NONE);
+        CHECK(nrf_802154_security_pib_key_handle_is_valid(&handles[i]));
+    }
+
+    CHECK(nrf_802154_security_pib_key_remove(&m_key_ids[0]) == NRF_802154_SECURITY_ERROR_NONE);
+    CHECK(!nrf_802154_security_pib_key_handle_is_valid(&handles[0]));
+    CHECK(nrf_802154_security_pib_key_handle_is_valid(&handles[1]));
+    CHECK(!key_is_stored(0U));
+    CHECK(key_store(0U, true, 0U) == NRF_802154_SECURITY_ERROR_NONE);
+    CHECK(!nrf_802154_security_pib_key_handle_is_valid(&handles[0]));
+
+    // The rotations leave tombstones in the key index, which is rebuilt from time to time.
+    // A handle stays valid until its key is rotated.
+    for (uint32_t r = 0; r < rotations; r++)
+    {
+        rotated = rotated || (key_rotate(&seed) == 1U);
+
+        for (uint32_t i = 0; i < TEST_KEYS; i++)
+        {
+            CHECK(key_is_stored(i));
+        }
+
+        CHECK(nrf_802154_security_pib_key_handle_is_valid(&handles[1]) == !rotated);
+    }
+
+    nrf_802154_security_pib_key_remove_all();
+
+    for (uint32_t i = 0; i < TEST_KEYS; i++)
+    {
+        CHECK(!key_is_stored(i));
+    }
+
+    CHECK(!nrf_802154_security_pib_key_handle_is_valid(&handles[1]));
+
+    printf("  keys: %s\n", (m_failures == failures) ? "ok" : "FAILED");
+}
+
+static void frame_counters_test(uint32_t operations, uint32_t seed)
+{
+    uint32_t failures = m_failures;
+    uint32_t last     = 9U;
+    uint32_t key_fc   = TEST_FC;
+    uint32_t fc;
+
+    keys_store_all();
+    nrf_802154_security_pib_global_frame_counter_set(last + 1U);
+
+    for (uint32_t r = 0; r < operations; r++)
+    {
+        uint32_t op = xorshift32(&seed) % 100U;
+
+        if (op == 0U)
+        {
+            // The higher layer sets the counter, which discards the reserved block.
+            uint32_t value = last + 1U + xorshift32(&seed) % 50U;
+
+            nrf_802154_security_pib_global_frame_counter_set(value);
+            last = value - 1U;
+        }
+        else if (op < 10U)
+        {
+            // The higher layer reports the counter of a transmitted frame.
+            nrf_802154_security_pib_global_frame_counter_set_if_larger(last + 1U);
+        }
+        else if (op < 12U)
+        {
+            uint32_t value = last + xorshift32(&seed) % 40U;
+
+            nrf_802154_security_pib_global_frame_counter_set_if_larger(value);
+            last = (value > last + 1U) ? (value - 1U) : last;
+        }
+
+        CHECK(nrf_802154_security_pib_frame_counter_get_next(&fc, &m_key_ids[0]) ==
+              NRF_802154_SECURITY_ERROR_NONE);
+        CHECK((fc > last) && (fc <= last + NRF_802154_SECURITY_FRAME_COUNTER_BLOCK_SIZE));
+        last = fc;
+
+        CHECK(nrf_802154_security_pib_frame_counter_get_next(&fc, &m_key_ids[1]) ==
+              NRF_802154_SECURITY_ERROR_NONE);
+        CHECK(fc == key_fc++);
+    }
+
+    nrf_802154_security_pib_global_frame_counter_set(UINT32_MAX - 3U);
+
+    for (uint32_t i = 0; i < 3U; i++)
+    {
+        CHECK(nrf_802154_security_pib_frame_counter_get_next(&fc, &m_key_ids[0]) ==
+              NRF_802154_SECURITY_ERROR_NONE);
+        CHECK(fc == UINT32_MAX - 3U + i);
+    }
+
+    CHECK(nrf_802154_security_pib_frame_counter_get_next(&fc, &m_key_ids[0]) ==
+          NRF_802154_SECURITY_ERROR_FRAME_COUNTER_OVERFLOW);
+
+    nrf_802154_security_pib_global_frame_counter_set(5U);
+    CHECK(nrf_802154_security_pib_frame_counter_get_next(&fc, &m_key_ids[0]) ==
+          NRF_802154_SECURITY_ERROR_NONE);
+    CHECK(fc == 5U);
+
+    printf("  frame counters: %s\n", (m_failures == failures) ? "ok" : "FAILED");
+}
+
+/***************************************************************************************************
+ * @section Benchmark
+ **************************************************************************************************/
+
+/**
+ * @brief Measures the mean time of the operations done for a secured frame [ns].
+ *
+ * @param[in]  lookups  Number of frames.
+ * @param[in]  stored   If the frames use stored keys, otherwise they use unknown keys.
+ * @param[in]  seed     Seed of the key choice.
+ */
+static double lookup_time_get(uint32_t lookups, bool stored, uint32_t seed)
+{
+    uint8_t           value[AES_CCM_KEY_SIZE];
+    uint8_t           unknown_id[KEY_ID_MODE_3_SIZE] = {0};
+    uint64_t          best                           = UINT64_MAX;
+    volatile uint32_t sink                           = 0U;
+
+    for (uint32_t r = 0; r < TEST_ROUNDS; r++)
+    {
+        uint32_t state = seed;
+        uint64_t start = nanoseconds_get();
+        uint64_t time;
+
+        for (uint32_t i = 0; i < lookups; i++)
+        {
+            uint32_t fc = 0U;
+
+            if (stored)
+            {
+                nrf_802154_key_id_t * p_id = &m_key_ids[xorshift32(&state) % TEST_KEYS];
+
+                (void)nrf_802154_security_pib_key_use(p_id, value);
+                (void)nrf_802154_security_pib_frame_counter_get_next(&fc, p_id);
+            }
+            else
+            {
+                // Mode 3 keys are never stored by the test.
+                nrf_802154_key_id_t id = {.mode = KEY_ID_MODE_3, .p_key_id = unknown_id};
+
+                unknown_id[0] = (uint8_t)xorshift32(&state);
+                (void)nrf_802154_security_pib_key_use(&id, value);
+            }
+
+            sink += fc + value[0];
+        }
+
+        time = nanoseconds_get() - start;
+        best = (time < best) ? time : best;
+    }
+
+    (void)sink;
+
+    return (double)best / lookups;
+}
+
+static void lookup_benchmark(uint32_t lookups, uint32_t rotations, uint32_t seed)
+{
+    printf("benchmark: %u lookups, best of %u rounds\n", (unsigned)lookups, (unsigned)TEST_ROUNDS);
+
+    keys_store_all();
+    nrf_802154_security_pib_global_frame_counter_set(0U);
+
+    printf("  fresh:          %6.1f ns stored key, %6.1f ns unknown key\n",
+           lookup_time_get(lookups, true, seed), lookup_time_get(lookups, false, seed));
+
+    for (uint32_t r = 0; r < rotations; r++)
+    {
+        (void)key_rotate(&seed);
+    }
+
+    printf("  after rotation: %6.1f ns stored key, %6.1f ns unknown key\n",
+           lookup_time_get(lookups, true, seed), lookup_time_get(lookups, false, seed));
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t rotations = 20000U;
+    uint32_t lookups   = 1000000U;
+    uint32_t seed      = 1U;
+    int      opt       = 1;
+
+    while (opt + 1 < argc)
+    {
+        unsigned long value = strtoul(argv[opt + 1], NULL, 0);
+
+        if (strcmp(argv[opt], "-r") == 0)
+        {
+            rotations = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-b") == 0)
+        {
+            lookups = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-s") == 0)
+        {
+            seed = (uint32_t)value;
+        }
+        else
+        {
+            break;
+        }
+
+        opt += 2;
+    }
+
+    if ((opt != argc) || (seed == 0U) || (lookups == 0U))
+    {
+        fprintf(stderr,
+                "Usage: %s [-r <rotations>] [-b <benchmark lookups>] [-s <seed>]\n",
+                argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    keys_test(rotations, seed);
+    frame_counters_test(100000U, seed);
+    lookup_benchmark(lookups, rotations, seed);
+
+    if (m_failures != 0U)
+    {
+        printf("\n%u checks failed\n", (unsigned)m_failures);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
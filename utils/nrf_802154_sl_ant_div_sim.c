@@ -0,0 +1,579 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run fading channel simulation of the open-source antenna diversity module.
+ *
+ * The simulation includes nrf_802154_sl_ant_div.c unchanged, with the GPIO port replaced by
+ * a register block in memory, and follows the antenna selection pin. It calls the notifications
+ * in the order the core and trx modules do.
+ *
+ * The first part checks the learning rules on a channel without fading or measurement noise:
+ * the frame is received with the stronger antenna, the receiver listens on the antenna preferred
+ * by all peers, every peer gets its own antenna for transmission, and a preference changes only
+ * when the other antenna is stronger by more than the hysteresis.
+ *
+ * The second part reports the packet error rate of a fixed antenna, of the automatic selection
+ * and of an oracle choosing the stronger antenna for every frame, over Rayleigh fading channels
+ * with increasing speed. Peers have random mean levels and antenna imbalances, and the channel is
+ * reciprocal. A frame is lost if its preamble is not detected on the antenna the receiver listens
+ * on, or at random according to the error rate at the level of the antenna used. The automatic
+ * selection must beat the fixed antenna. The program exits with a failure if any check fails.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -DNRF_802154_SL_ANT_DIV_ENABLED=1 \
+ *         -DNRF_802154_ANT_DIV_PEER_ANTENNA_ENABLED=1 \
+ *         -o sl_ant_div_sim ../../utils/nrf_802154_sl_ant_div_sim.c \
+ *         -Icommon/include -Isl/include -Isl/sl_opensource/src \
+ *         -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis> -lm
+ *
+ * Usage:
+ *
+ *     sl_ant_div_sim [-n <frames>] [-s <seed>]
+ */
+
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nrf.h"
+#include "nrf_802154_const.h"
+
+static NRF_GPIO_Type m_gpio; ///< GPIO port of the antenna selection pin.
+
+#undef NRF_P0
+#define NRF_P0 (&m_gpio)
+
+#include "nrf_802154_sl_ant_div.c"
+
+#if !NRF_802154_SL_ANT_DIV_ENABLED || !NRF_802154_ANT_DIV_PEER_ANTENNA_ENABLED
+#error "The simulation requires antenna diversity with the antenna selected per peer"
+#endif
+
+#define SIM_ANT_SEL_PIN     3U     ///< Antenna selection pin.
+#define SIM_PEERS           6U     ///< Number of peers of the fading channel.
+#define SIM_NOISE_DB        1.5    ///< Standard deviation of the RSSI measurement noise [dB].
+#define SIM_PREAMBLE_GAIN   3.0    ///< Margin of the preamble detection over the frame [dB].
+#define SIM_SENSITIVITY     -97.0  ///< Level at which half of the frames are lost [dBm].
+#define SIM_PER_SLOPE       0.8    ///< Width of the transition of the error rate curve [dB].
+#define SIM_RSSI_MIN        -100   ///< Lowest level the RSSI measurement reports [dBm].
+#define SIM_FADINGS         4U     ///< Number of fading speeds.
+#define SIM_LEARNING_FRAMES 64U    ///< Frames received in every step of the learning test.
+
+#define CHECK(cond)                                                     \
+    do                                                                  \
+    {                                                                   \
+        if (!(cond))                                                    \
+        {                                                               \
+            printf("  check failed at line %d: %s\n", __LINE__, #cond); \
+            m_failures++;                                               \
+        }                                                               \
+    }                                                                   \
+    while (0)
+
+/**@brief Antenna selection policies compared by the benchmark. */
+typedef enum
+{
+    SIM_POLICY_FIXED,  ///< Antenna 1 for every frame, in manual mode.
+    SIM_POLICY_AUTO,   ///< Automatic selection of the module.
+    SIM_POLICY_ORACLE, ///< Stronger antenna for every frame.
+    SIM_POLICY_NUM,
+} sim_policy_t;
+
+/**@brief Channel between the device and a peer. */
+typedef struct
+{
+    double mean;                    ///< Mean level [dBm].
+    double offset[ANTENNAS_NUM];    ///< Level offset of each antenna [dB].
+    double re[ANTENNAS_NUM];        ///< Real part of the fading gain of each antenna.
+    double im[ANTENNAS_NUM];        ///< Imaginary part of the fading gain of each antenna.
+} sim_channel_t;
+
+/**@brief Result of a run. */
+typedef struct
+{
+    double rx_per;   ///< Packet error rate of received frames [%].
+    double tx_per;   ///< Packet error rate of transmitted frames [%].
+    double switches; ///< Antenna switches per frame.
+} sim_result_t;
+
+static uint32_t      m_failures;              ///< Number of failed checks.
+static uint32_t      m_rand_state;            ///< State of the pseudo-random generator.
+static uint8_t       m_pin_antenna;           ///< Antenna selected by the pin.
+static uint32_t      m_switches;              ///< Number of changes of the pin.
+static double        m_rssi[ANTENNAS_NUM];    ///< Level of the current frame on each antenna [dBm].
+static double        m_noise_db;              ///< Standard deviation of the measurement noise [dB].
+static sim_channel_t m_channels[SIM_PEERS];   ///< Channels of the peers.
+static double        m_rho;                   ///< Correlation of the fading between frames.
+
+static uint32_t xorshift32(uint32_t * p_state)
+{
+    uint32_t x = *p_state;
+
+    x        ^= x << 13;
+    x        ^= x >> 17;
+    x        ^= x << 5;
+    *p_state  = x;
+
+    return x;
+}
+
+static double uniform_draw(void)
+{
+    return (xorshift32(&m_rand_state) + 0.5) / 4294967296.0;
+}
+
+static double gauss_draw(void)
+{
+    return sqrt(-2.0 * log(uniform_draw())) * cos(2.0 * M_PI * uniform_draw());
+}
+
+void nrf_802154_assert_handler(void)
+{
+    printf("  driver assertion failed\n");
+    abort();
+}
+
+/***************************************************************************************************
+ * @section Radio environment
+ **************************************************************************************************/
+
+/**
+ * @brief Follows the writes of the module to the antenna selection pin.
+ *
+ * Called after every call to the module and before every measurement, so that the pin is written
+ * at most once in between.
+ */
+static void antenna_pin_sync(void)
+{
+    uint32_t mask    = 1UL << SIM_ANT_SEL_PIN;
+    uint8_t  antenna = m_pin_antenna;
+
+    CHECK(((m_gpio.OUTSET & mask) == 0U) || ((m_gpio.OUTCLR & mask) == 0U));
+    CHECK(((m_gpio.OUTSET | m_gpio.OUTCLR) & ~mask) == 0U);
+
+    if (m_gpio.OUTSET & mask)
+    {
+        antenna = NRF_802154_SL_ANT_DIV_ANTENNA_2;
+    }
+
+    if (m_gpio.OUTCLR & mask)
+    {
+        antenna = NRF_802154_SL_ANT_DIV_ANTENNA_1;
+    }
+
+    m_gpio.OUTSET = 0U;
+    m_gpio.OUTCLR = 0U;
+
+    if (antenna != m_pin_antenna)
+    {
+        m_pin_antenna = antenna;
+        m_switches++;
+    }
+
+    CHECK(nrf_802154_sl_ant_div_antenna_get() == m_pin_antenna);
+}
+
+int8_t nrf_802154_sl_ant_div_rssi_measure_get(void)
+{
+    long rssi;
+
+    antenna_pin_sync();
+
+    rssi = lrint(m_rssi[m_pin_antenna] + gauss_draw() * m_noise_db);
+
+    return (int8_t)((rssi < SIM_RSSI_MIN) ? SIM_RSSI_MIN : rssi);
+}
+
+/**@brief Gets the packet error rate of a frame received at the given level. */
+static double per_get(double rssi)
+{
+    return 1.0 / (1.0 + exp((rssi - SIM_SENSITIVITY) / SIM_PER_SLOPE));
+}
+
+static bool frame_lost(double rssi)
+{
+    return per_get(rssi) > uniform_draw();
+}
+
+static void module_init(sim_policy_t policy)
+{
+    nrf_802154_sl_ant_div_cfg_t  cfg  = {.ant_sel_pin = SIM_ANT_SEL_PIN};
+    nrf_802154_sl_ant_div_mode_t mode = (policy == SIM_POLICY_AUTO) ?
+                                        NRF_802154_SL_ANT_DIV_MODE_AUTO :
+                                        NRF_802154_SL_ANT_DIV_MODE_MANUAL;
+
+    memset(&m_gpio, 0, sizeof(m_gpio));
+    m_pin_antenna  = NRF_802154_SL_ANT_DIV_ANTENNA_1;
+    m_switches = 0U;
+
+    nrf_802154_sl_ant_div_cfg_set(&cfg);
+    CHECK(nrf_802154_sl_ant_div_cfg_mode_set(NRF_802154_SL_ANT_DIV_OP_RX, mode));
+    CHECK(nrf_802154_sl_ant_div_cfg_mode_set(NRF_802154_SL_ANT_DIV_OP_TX, mode));
+    CHECK(nrf_802154_sl_ant_div_cfg_antenna_set(NRF_802154_SL_ANT_DIV_OP_RX,
+                                                NRF_802154_SL_ANT_DIV_ANTENNA_1));
+    CHECK(nrf_802154_sl_ant_div_cfg_antenna_set(NRF_802154_SL_ANT_DIV_OP_TX,
+                                                NRF_802154_SL_ANT_DIV_ANTENNA_1));
+    CHECK(nrf_802154_sl_ant_div_init());
+    CHECK((m_gpio.PIN_CNF[SIM_ANT_SEL_PIN] & GPIO_PIN_CNF_DIR_Msk) != 0U);
+
+    if (policy != SIM_POLICY_AUTO)
+    {
+        CHECK(nrf_802154_sl_ant_div_antenna_set(NRF_802154_SL_ANT_DIV_ANTENNA_1));
+    }
+
+    antenna_pin_sync();
+}
+
+/**
+ * @brief Receives a frame from a peer in automatic mode.
+ *
+ * @retval true   The frame was received.
+ * @retval false  The frame was lost.
+ */
+static bool frame_auto_receive(const uint8_t * p_src_addr, bool lossy)
+{
+    nrf_802154_sl_ant_div_rx_started_notify();
+    antenna_pin_sync();
+
+    if (lossy && frame_lost(m_rssi[m_pin_antenna] + SIM_PREAMBLE_GAIN))
+    {
+        return false;
+    }
+
+    nrf_802154_sl_ant_div_rx_preamble_detected_notify();
+    antenna_pin_sync();
+    CHECK(nrf_802154_sl_ant_div_rx_frame_started_notify());
+
+    if (lossy && frame_lost(m_rssi[m_pin_antenna]))
+    {
+        nrf_802154_sl_ant_div_rx_aborted_notify();
+        return false;
+    }
+
+    nrf_802154_sl_ant_div_rx_frame_received_notify();
+    nrf_802154_sl_ant_div_rx_frame_source_notify(p_src_addr, SHORT_ADDRESS_SIZE);
+    antenna_pin_sync();
+    CHECK(nrf_802154_sl_ant_div_last_rx_best_antenna_get() == m_pin_antenna);
+
+    return true;
+}
+
+/**
+ * @brief Selects the antenna for a frame to a peer in automatic mode.
+ */
+static void frame_auto_transmit(const uint8_t * p_dst_addr)
+{
+    nrf_802154_sl_ant_div_tx_frame_notify(p_dst_addr, SHORT_ADDRESS_SIZE);
+    nrf_802154_sl_ant_div_tx_started_notify();
+    antenna_pin_sync();
+}
+
+/***************************************************************************************************
+ * @section Learning test
+ **************************************************************************************************/
+
+/**
+ * @brief Receives frames from a peer with the given levels, without losses or noise.
+ */
+static void frames_receive(uint8_t peer, double rssi_1, double rssi_2, uint32_t frames)
+{
+    uint8_t addr[SHORT_ADDRESS_SIZE] = {peer, 0x10};
+
+    m_rssi[NRF_802154_SL_ANT_DIV_ANTENNA_1] = rssi_1;
+    m_rssi[NRF_802154_SL_ANT_DIV_ANTENNA_2] = rssi_2;
+
+    for (uint32_t i = 0U; i < frames; i++)
+    {
+        CHECK(frame_auto_receive(addr, false));
+        CHECK(m_pin_antenna == ((rssi_2 > rssi_1) ? NRF_802154_SL_ANT_DIV_ANTENNA_2 :
+                            NRF_802154_SL_ANT_DIV_ANTENNA_1));
+    }
+}
+
+static uint8_t tx_antenna_get(uint8_t peer)
+{
+    uint8_t addr[SHORT_ADDRESS_SIZE] = {peer, 0x10};
+
+    frame_auto_transmit(addr);
+
+    return m_pin_antenna;
+}
+
+static uint8_t rx_listen_antenna_check(void)
+{
+    nrf_802154_sl_ant_div_rx_started_notify();
+    antenna_pin_sync();
+    nrf_802154_sl_ant_div_rx_aborted_notify();
+
+    return m_pin_antenna;
+}
+
+static void learning_test(void)
+{
+    double hysteresis = NRF_802154_SL_ANT_DIV_HYSTERESIS_DB;
+
+    m_noise_db = 0.0;
+    module_init(SIM_POLICY_AUTO);
+
+    // Peer 1 is heard best on antenna 1, peer 0 on antenna 2.
+    frames_receive(1U, -75.0, -85.0, SIM_LEARNING_FRAMES);
+    CHECK(rx_listen_antenna_check() == NRF_802154_SL_ANT_DIV_ANTENNA_1);
+    frames_receive(0U, -80.0, -70.0, SIM_LEARNING_FRAMES);
+    CHECK(tx_antenna_get(0U) == NRF_802154_SL_ANT_DIV_ANTENNA_2);
+    CHECK(tx_antenna_get(1U) == NRF_802154_SL_ANT_DIV_ANTENNA_1);
+
+    // The average over all frames follows the recent ones, stronger on antenna 2: the receiver
+    // listens on it, and frames to unknown peers are transmitted with it.
+    CHECK(rx_listen_antenna_check() == NRF_802154_SL_ANT_DIV_ANTENNA_2);
+    CHECK(tx_antenna_get(2U) == NRF_802154_SL_ANT_DIV_ANTENNA_2);
+
+    // A difference within the hysteresis does not change the preference.
+    frames_receive(2U, -70.0, -75.0, SIM_LEARNING_FRAMES);
+    CHECK(tx_antenna_get(2U) == NRF_802154_SL_ANT_DIV_ANTENNA_1);
+    frames_receive(2U, -72.0, -72.0 + hysteresis - 1.0, SIM_LEARNING_FRAMES);
+    CHECK(tx_antenna_get(2U) == NRF_802154_SL_ANT_DIV_ANTENNA_1);
+    frames_receive(2U, -72.0, -72.0 + hysteresis + 1.0, SIM_LEARNING_FRAMES);
+    CHECK(tx_antenna_get(2U) == NRF_802154_SL_ANT_DIV_ANTENNA_2);
+
+    // The other peers kept their preferences.
+    CHECK(tx_antenna_get(0U) == NRF_802154_SL_ANT_DIV_ANTENNA_2);
+    CHECK(tx_antenna_get(1U) == NRF_802154_SL_ANT_DIV_ANTENNA_1);
+
+    // Reinitialization forgets everything.
+    module_init(SIM_POLICY_AUTO);
+    m_noise_db = SIM_NOISE_DB;
+    CHECK(rx_listen_antenna_check() == NRF_802154_SL_ANT_DIV_ANTENNA_1);
+    CHECK(tx_antenna_get(0U) == NRF_802154_SL_ANT_DIV_ANTENNA_1);
+
+    printf("learning: %s\n", (m_failures == 0U) ? "ok" : "failed");
+}
+
+/***************************************************************************************************
+ * @section Fading benchmark
+ **************************************************************************************************/
+
+static void channels_init(uint32_t seed)
+{
+    m_rand_state = seed;
+
+    for (uint32_t p = 0U; p < SIM_PEERS; p++)
+    {
+        // Antenna pattern and orientation make one antenna better for each peer.
+        double imbalance = (uniform_draw() * 2.0 - 1.0) * 6.0;
+
+        m_channels[p].mean      = -84.0 - 8.0 * uniform_draw();
+        m_channels[p].offset[0] = imbalance / 2.0;
+        m_channels[p].offset[1] = -imbalance / 2.0;
+
+        for (uint32_t a = 0U; a < ANTENNAS_NUM; a++)
+        {
+            m_channels[p].re[a] = gauss_draw() / sqrt(2.0);
+            m_channels[p].im[a] = gauss_draw() / sqrt(2.0);
+        }
+    }
+}
+
+/**
+ * @brief Advances the Rayleigh fading of all peers, as a first order autoregressive process of
+ *        the complex gains with unit mean power.
+ */
+static void channels_step(void)
+{
+    double sigma = sqrt((1.0 - m_rho * m_rho) / 2.0);
+
+    for (uint32_t p = 0U; p < SIM_PEERS; p++)
+    {
+        for (uint32_t a = 0U; a < ANTENNAS_NUM; a++)
+        {
+            m_channels[p].re[a] = m_rho * m_channels[p].re[a] + sigma * gauss_draw();
+            m_channels[p].im[a] = m_rho * m_channels[p].im[a] + sigma * gauss_draw();
+        }
+    }
+}
+
+static double channel_rssi_get(const sim_channel_t * p_channel, uint32_t antenna)
+{
+    double power = p_channel->re[antenna] * p_channel->re[antenna] +
+                   p_channel->im[antenna] * p_channel->im[antenna];
+
+    return p_channel->mean + p_channel->offset[antenna] + 10.0 * log10(power + 1e-12);
+}
+
+static void run(sim_policy_t policy, uint32_t frames, uint32_t seed, sim_result_t * p_result)
+{
+    uint32_t rx_frames = 0U;
+    uint32_t rx_lost   = 0U;
+    uint32_t tx_frames = 0U;
+    uint32_t tx_lost   = 0U;
+
+    channels_init(seed);
+    module_init(policy);
+
+    for (uint32_t i = 0U; i < frames; i++)
+    {
+        uint8_t peer                     = xorshift32(&m_rand_state) % SIM_PEERS;
+        uint8_t addr[SHORT_ADDRESS_SIZE] = {peer, 0x10};
+        uint8_t antenna                  = NRF_802154_SL_ANT_DIV_ANTENNA_1;
+        bool    rx                       = (xorshift32(&m_rand_state) & 1U) != 0U;
+
+        channels_step();
+        m_rssi[0] = channel_rssi_get(&m_channels[peer], 0U);
+        m_rssi[1] = channel_rssi_get(&m_channels[peer], 1U);
+
+        if (policy == SIM_POLICY_ORACLE)
+        {
+            antenna = (m_rssi[1] > m_rssi[0]) ? NRF_802154_SL_ANT_DIV_ANTENNA_2 :
+                      NRF_802154_SL_ANT_DIV_ANTENNA_1;
+        }
+
+        if (rx)
+        {
+            rx_frames++;
+
+            if (policy == SIM_POLICY_AUTO)
+            {
+                rx_lost += frame_auto_receive(addr, true) ? 0U : 1U;
+            }
+            else
+            {
+                rx_lost += (frame_lost(m_rssi[antenna] + SIM_PREAMBLE_GAIN) ||
+                            frame_lost(m_rssi[antenna])) ? 1U : 0U;
+            }
+        }
+        else
+        {
+            tx_frames++;
+
+            if (policy == SIM_POLICY_AUTO)
+            {
+                frame_auto_transmit(addr);
+                antenna = m_pin_antenna;
+            }
+
+            // The channel is reciprocal.
+            tx_lost += frame_lost(m_rssi[antenna]) ? 1U : 0U;
+        }
+    }
+
+    p_result->rx_per   = 100.0 * rx_lost / rx_frames;
+    p_result->tx_per   = 100.0 * tx_lost / tx_frames;
+    p_result->switches = (double)m_switches / frames;
+}
+
+static void benchmark(uint32_t frames, uint32_t seed)
+{
+    static const double       rhos[SIM_FADINGS]  = {0.999, 0.99, 0.9, 0.0};
+    static const char * const names[SIM_FADINGS] =
+    {
+        "static (rho 0.999)", "slow (rho 0.99)", "moderate (rho 0.9)", "fast (rho 0)",
+    };
+
+    printf("\n%-20s | %-14s | %-26s | %s\n",
+           "fading", "fixed antenna", "auto (switches per frame)", "oracle");
+    printf("%-20s | %6s %7s | %6s %7s             | %6s %7s\n",
+           "", "RX PER", "TX PER", "RX PER", "TX PER", "RX PER", "TX PER");
+
+    for (uint32_t f = 0U; f < SIM_FADINGS; f++)
+    {
+        sim_result_t results[SIM_POLICY_NUM];
+
+        m_rho = rhos[f];
+
+        for (uint32_t policy = 0U; policy < SIM_POLICY_NUM; policy++)
+        {
+            run((sim_policy_t)policy, frames, seed, &results[policy]);
+        }
+
+        printf("%-20s | %5.2f%% %6.2f%% | %5.2f%% %6.2f%%  (%.2f)     | %5.2f%% %6.2f%%\n",
+               names[f],
+               results[SIM_POLICY_FIXED].rx_per, results[SIM_POLICY_FIXED].tx_per,
+               results[SIM_POLICY_AUTO].rx_per, results[SIM_POLICY_AUTO].tx_per,
+               results[SIM_POLICY_AUTO].switches,
+               results[SIM_POLICY_ORACLE].rx_per, results[SIM_POLICY_ORACLE].tx_per);
+
+        CHECK(results[SIM_POLICY_AUTO].rx_per < results[SIM_POLICY_FIXED].rx_per);
+        CHECK(results[SIM_POLICY_AUTO].tx_per < results[SIM_POLICY_FIXED].tx_per);
+        CHECK(results[SIM_POLICY_FIXED].switches == 0.0);
+    }
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t frames = 400000U;
+    uint32_t seed   = 7U;
+    int      opt    = 1;
+
+    while (opt + 1 < argc)
+    {
+        unsigned long value = strtoul(argv[opt + 1], NULL, 0);
+
+        if (strcmp(argv[opt], "-n") == 0)
+        {
+            frames = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-s") == 0)
+        {
+            seed = (uint32_t)value;
+        }
+        else
+        {
+            break;
+        }
+
+        opt += 2;
+    }
+
+    if ((opt != argc) || (frames == 0U) || (seed == 0U))
+    {
+        fprintf(stderr, "Usage: %s [-n <frames>] [-s <seed>]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    learning_test();
+    benchmark(frames, seed);
+
+    if (m_failures != 0U)
+    {
+        printf("\n%u checks failed\n", (unsigned)m_failures);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
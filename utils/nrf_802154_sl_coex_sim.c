@@ -0,0 +1,721 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run simulation of the open-source Packet Traffic Arbitration client.
+ *
+ * The simulation includes nrf_802154_sl_coex.c unchanged, with the GPIO functions it uses
+ * redirected to a model of the pins, and replaces the SL timer with an event-driven model.
+ * A model of the arbiter drives GRANT, active low, according to REQUEST, PRIORITY and the state of
+ * the Wi-Fi radio, and responds some time after its inputs change. Every change of GRANT calls
+ * the GRANT interrupt handler, as a GPIOTE event configured by the application would.
+ *
+ * The first part checks the behavior of the client:
+ *
+ * - requesting the arbiter returns at once and the grant is reported when the arbiter responds,
+ * - a denial is counted only once the response time has elapsed,
+ * - a change of the operation keeps the grant while PRIORITY changes,
+ * - repeatedly denied requests are escalated to high priority,
+ * - a response timer that fired for a restarted response time is ignored,
+ * - the 1-wire interface samples GRANT at once,
+ * - deinitialization releases the pins and the timer.
+ *
+ * The second part reports how 802.15.4 transmissions requested every 2 ms share the air with
+ * Wi-Fi traffic of increasing load, of which 10% cannot be preempted, with and without escalation.
+ * The program exits with a failure if any check fails.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -o sl_coex_sim ../../utils/nrf_802154_sl_coex_sim.c \
+ *         -Icommon/include -Idriver/include -Idriver/src -Isl/include \
+ *         -Isl/sl_opensource/include -Isl/sl_opensource/src \
+ *         -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis>
+ *
+ * Usage:
+ *
+ *     sl_coex_sim [-n <transmission slots>] [-s <seed>]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nrf.h"
+#include "hal/nrf_gpio.h"
+
+static void     sim_gpio_pin_write(uint32_t pin, uint32_t value);
+static uint32_t sim_gpio_pin_read(uint32_t pin);
+static void     sim_gpio_cfg_output(uint32_t pin);
+static void     sim_gpio_cfg_input(uint32_t pin, nrf_gpio_pin_pull_t pull);
+static void     sim_gpio_cfg_default(uint32_t pin);
+
+#define nrf_gpio_pin_write   sim_gpio_pin_write
+#define nrf_gpio_pin_read    sim_gpio_pin_read
+#define nrf_gpio_cfg_output  sim_gpio_cfg_output
+#define nrf_gpio_cfg_input   sim_gpio_cfg_input
+#define nrf_gpio_cfg_default sim_gpio_cfg_default
+
+#include "nrf_802154_sl_coex.c"
+
+#define SIM_REQUEST_PIN      3U               ///< REQUEST pin.
+#define SIM_PRIORITY_PIN     4U               ///< PRIORITY pin.
+#define SIM_GRANT_PIN        5U               ///< GRANT pin.
+#define SIM_PINS             8U               ///< Number of modelled pins.
+#define SIM_ARBITER_DELAY_US 3U               ///< Response time of the arbiter.
+#define SIM_GRANT_DELAY_US   NRF_802154_SL_COEX_PTA_DEFAULT_GRANT_DELAY_US
+#define SIM_SLOT_US          2000U            ///< Interval between transmissions.
+#define SIM_ESCALATION       2U               ///< Escalation threshold of the functional test.
+#define SIM_TIME_NEVER       UINT64_MAX
+
+#define CHECK(cond)                                                     \
+    do                                                                  \
+    {                                                                   \
+        if (!(cond))                                                    \
+        {                                                               \
+            printf("  check failed at line %d: %s\n", __LINE__, #cond); \
+            m_failures++;                                               \
+        }                                                               \
+    }                                                                   \
+    while (0)
+
+/**@brief Configuration of a modelled pin. */
+typedef enum
+{
+    SIM_PIN_DEFAULT, ///< Disconnected.
+    SIM_PIN_OUTPUT,  ///< Output.
+    SIM_PIN_INPUT,   ///< Input.
+} sim_pin_mode_t;
+
+static uint32_t                m_failures;                ///< Number of failed checks.
+static uint32_t                m_rand_state;              ///< State of the pseudo-random generator.
+static uint64_t                m_now;                     ///< Current time [us].
+static uint8_t                 m_pin_levels[SIM_PINS];    ///< Output levels of the pins.
+static sim_pin_mode_t          m_pin_modes[SIM_PINS];     ///< Configuration of the pins.
+static bool                    m_one_wire;                ///< If the arbiter has the 1-wire interface.
+static bool                    m_wifi_busy;               ///< If Wi-Fi uses the air.
+static bool                    m_wifi_high;               ///< If Wi-Fi cannot be preempted.
+static bool                    m_granted;                 ///< Output of the arbiter.
+static uint64_t                m_arbiter_time;            ///< Time of the next response of the arbiter.
+static nrf_802154_sl_timer_t * mp_timer;                  ///< Armed timer, NULL if there is none.
+static uint32_t                m_timer_starts;            ///< Number of timers armed.
+static rsch_prio_t             m_allowed;                 ///< Allowed priority last notified.
+static uint32_t                m_allowed_changes;         ///< Number of notifications.
+
+static uint32_t xorshift32(uint32_t * p_state)
+{
+    uint32_t x = *p_state;
+
+    x        ^= x << 13;
+    x        ^= x >> 17;
+    x        ^= x << 5;
+    *p_state  = x;
+
+    return x;
+}
+
+void nrf_802154_assert_handler(void)
+{
+    printf("  driver assertion failed\n");
+    abort();
+}
+
+/***************************************************************************************************
+ * @section Pins and arbiter
+ **************************************************************************************************/
+
+static void sim_gpio_pin_write(uint32_t pin, uint32_t value)
+{
+    CHECK(pin < SIM_PINS);
+
+    if (m_pin_levels[pin] != value)
+    {
+        m_pin_levels[pin] = (uint8_t)value;
+        m_arbiter_time    = m_now + SIM_ARBITER_DELAY_US;
+    }
+}
+
+static uint32_t sim_gpio_pin_read(uint32_t pin)
+{
+    CHECK(pin == SIM_GRANT_PIN);
+    CHECK(m_pin_modes[pin] == SIM_PIN_INPUT);
+
+    return m_granted ? 0U : 1U;
+}
+
+static void sim_gpio_cfg_output(uint32_t pin)
+{
+    m_pin_modes[pin] = SIM_PIN_OUTPUT;
+}
+
+static void sim_gpio_cfg_input(uint32_t pin, nrf_gpio_pin_pull_t pull)
+{
+    (void)pull;
+
+    m_pin_modes[pin] = SIM_PIN_INPUT;
+}
+
+static void sim_gpio_cfg_default(uint32_t pin)
+{
+    m_pin_modes[pin] = SIM_PIN_DEFAULT;
+}
+
+static bool request_pin_is_active(void)
+{
+    return (m_pin_modes[SIM_REQUEST_PIN] == SIM_PIN_OUTPUT) && m_pin_levels[SIM_REQUEST_PIN];
+}
+
+static bool priority_pin_is_active(void)
+{
+    return (m_pin_modes[SIM_PRIORITY_PIN] == SIM_PIN_OUTPUT) && m_pin_levels[SIM_PRIORITY_PIN];
+}
+
+/**
+ * @brief Updates GRANT to the decision of the arbiter and signals its change to the client.
+ */
+static void arbiter_respond(void)
+{
+    bool granted;
+
+    if (m_one_wire)
+    {
+        granted = !m_wifi_busy;
+    }
+    else
+    {
+        granted = request_pin_is_active() &&
+                  (!m_wifi_busy || (priority_pin_is_active() && !m_wifi_high));
+    }
+
+    if (granted != m_granted)
+    {
+        m_granted = granted;
+
+        if (m_pin_modes[SIM_GRANT_PIN] == SIM_PIN_INPUT)
+        {
+            nrf_802154_sl_coex_pta_grant_irq_handler();
+        }
+    }
+}
+
+static void wifi_set(bool busy, bool high)
+{
+    m_wifi_busy    = busy;
+    m_wifi_high    = high;
+    m_arbiter_time = m_now + SIM_ARBITER_DELAY_US;
+}
+
+/***************************************************************************************************
+ * @section Driver environment
+ **************************************************************************************************/
+
+void nrf_802154_sl_timer_init(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+}
+
+void nrf_802154_sl_timer_deinit(nrf_802154_sl_timer_t * p_timer)
+{
+    CHECK(mp_timer != p_timer);
+}
+
+uint64_t nrf_802154_sl_timer_current_time_get(void)
+{
+    return m_now;
+}
+
+nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_add(nrf_802154_sl_timer_t * p_timer)
+{
+    CHECK(mp_timer == NULL);
+    CHECK(p_timer->trigger_time > m_now);
+
+    mp_timer = p_timer;
+    m_timer_starts++;
+
+    return NRF_802154_SL_TIMER_RET_SUCCESS;
+}
+
+nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_remove(nrf_802154_sl_timer_t * p_timer)
+{
+    if (mp_timer != p_timer)
+    {
+        return NRF_802154_SL_TIMER_RET_INACTIVE;
+    }
+
+    mp_timer = NULL;
+
+    return NRF_802154_SL_TIMER_RET_SUCCESS;
+}
+
+void nrf_802154_sl_coex_pta_approved_prio_changed(void)
+{
+    rsch_prio_t allowed = nrf_802154_sl_coex_pta_approved_prio_get();
+
+    // The radio scheduler is notified only of actual changes.
+    CHECK(allowed != m_allowed);
+
+    m_allowed = allowed;
+    m_allowed_changes++;
+}
+
+/***************************************************************************************************
+ * @section Event loop
+ **************************************************************************************************/
+
+static void run_until(uint64_t end)
+{
+    while (true)
+    {
+        uint64_t timer_time = (mp_timer != NULL) ? mp_timer->trigger_time : SIM_TIME_NEVER;
+        uint64_t next       = (timer_time < m_arbiter_time) ? timer_time : m_arbiter_time;
+
+        if (next > end)
+        {
+            break;
+        }
+
+        m_now = next;
+
+        if (next == m_arbiter_time)
+        {
+            m_arbiter_time = SIM_TIME_NEVER;
+            arbiter_respond();
+        }
+        else
+        {
+            nrf_802154_sl_timer_t * p_timer = mp_timer;
+
+            mp_timer = NULL;
+            p_timer->action.callback.callback(p_timer);
+        }
+    }
+
+    m_now = end;
+}
+
+static rsch_prio_t allowed_get(void)
+{
+    rsch_prio_t allowed = nrf_802154_sl_coex_pta_approved_prio_get();
+
+    CHECK(allowed == m_allowed);
+
+    return allowed;
+}
+
+/**
+ * @brief Requests a priority on behalf of an operation, as the driver does.
+ */
+static void request(nrf_802154_sl_coex_op_t op, rsch_prio_t prio)
+{
+    nrf_802154_sl_coex_operation_set(op);
+    nrf_802154_sl_coex_pta_prio_request(prio);
+
+    // Changes of the allowed priority while requesting are reported by the return value only.
+    m_allowed = nrf_802154_sl_coex_pta_approved_prio_get();
+}
+
+static void sim_reset(bool one_wire)
+{
+    memset(m_pin_levels, 0, sizeof(m_pin_levels));
+    memset(m_pin_modes, 0, sizeof(m_pin_modes));
+
+    m_one_wire        = one_wire;
+    m_wifi_busy       = false;
+    m_wifi_high       = false;
+    m_granted         = false;
+    m_arbiter_time    = SIM_TIME_NEVER;
+    mp_timer          = NULL;
+    m_timer_starts    = 0U;
+    m_allowed         = RSCH_PRIO_MAX;
+    m_allowed_changes = 0U;
+}
+
+static nrf_802154_sl_coex_pta_cfg_t cfg_get(nrf_802154_sl_coex_pta_interface_t interface,
+                                            uint8_t                            escalation)
+{
+    nrf_802154_sl_coex_pta_cfg_t cfg;
+
+    memset(&cfg, 0, sizeof(cfg));
+
+    cfg.interface            = interface;
+    cfg.request_pin          = SIM_REQUEST_PIN;
+    cfg.priority_pin         = SIM_PRIORITY_PIN;
+    cfg.grant_pin            = SIM_GRANT_PIN;
+    cfg.request_active_high  = true;
+    cfg.priority_active_high = true;
+    cfg.grant_active_high    = false;
+    cfg.grant_delay_us       = SIM_GRANT_DELAY_US;
+
+    for (uint32_t op = 0U; op < NRF_802154_SL_COEX_OPS_NUM; op++)
+    {
+        cfg.ops[op].request = true;
+    }
+
+    cfg.ops[NRF_802154_SL_COEX_OP_ACK].high_priority       = true;
+    cfg.ops[NRF_802154_SL_COEX_OP_TX].escalation_threshold = escalation;
+
+    return cfg;
+}
+
+/***************************************************************************************************
+ * @section Functional test
+ **************************************************************************************************/
+
+static void functional_test(void)
+{
+    nrf_802154_sl_coex_pta_cfg_t   cfg = cfg_get(NRF_802154_SL_COEX_PTA_INTERFACE_3WIRE,
+                                                 SIM_ESCALATION);
+    nrf_802154_sl_coex_pta_stats_t stats;
+    nrf_802154_sl_coex_pta_trace_t traces[NRF_802154_SL_COEX_PTA_TRACE_SIZE];
+    uint32_t                       traces_num;
+    uint32_t                       changes;
+    uint64_t                       start;
+
+    sim_reset(false);
+    m_now = 1000U;
+
+    CHECK(!nrf_802154_wifi_coex_is_enabled());
+    nrf_802154_sl_coex_pta_init();
+    CHECK(nrf_802154_sl_coex_pta_cfg_set(&cfg));
+    CHECK(nrf_802154_wifi_coex_is_enabled());
+    CHECK(m_pin_modes[SIM_REQUEST_PIN] == SIM_PIN_OUTPUT);
+    CHECK(m_pin_modes[SIM_PRIORITY_PIN] == SIM_PIN_OUTPUT);
+    CHECK(m_pin_modes[SIM_GRANT_PIN] == SIM_PIN_INPUT);
+
+    cfg.grant_delay_us = NRF_802154_SL_COEX_PTA_GRANT_DELAY_MAX_US + 1U;
+    CHECK(!nrf_802154_sl_coex_pta_cfg_set(&cfg));
+    cfg.grant_delay_us = SIM_GRANT_DELAY_US;
+
+    // Idle listening does not request the arbiter.
+    request(NRF_802154_SL_COEX_OP_RX, RSCH_PRIO_IDLE_LISTENING);
+    CHECK(!request_pin_is_active());
+    CHECK(allowed_get() == RSCH_PRIO_MAX);
+
+    // The request returns at once. The arbiter responds before the response time elapses and
+    // the grant is reported to the radio scheduler.
+    start   = m_now;
+    changes = m_allowed_changes;
+    request(NRF_802154_SL_COEX_OP_RX, RSCH_PRIO_RX);
+    CHECK(m_now == start);
+    CHECK(request_pin_is_active() && !priority_pin_is_active());
+    CHECK(allowed_get() == RSCH_PRIO_RX);
+    CHECK((mp_timer != NULL) && (mp_timer->trigger_time == start + SIM_GRANT_DELAY_US));
+    run_until(start + SIM_ARBITER_DELAY_US);
+    CHECK(allowed_get() == RSCH_PRIO_MAX);
+    CHECK(m_allowed_changes == changes + 1U);
+    run_until(start + 2U * SIM_GRANT_DELAY_US);
+    CHECK(mp_timer == NULL);
+    CHECK(m_allowed_changes == changes + 1U);
+
+    // The ACK raises PRIORITY without releasing REQUEST and keeps the grant meanwhile.
+    start = m_now;
+    request(NRF_802154_SL_COEX_OP_ACK, RSCH_PRIO_TX);
+    CHECK(request_pin_is_active() && priority_pin_is_active());
+    CHECK(allowed_get() == RSCH_PRIO_MAX);
+    run_until(start + 2U * SIM_GRANT_DELAY_US);
+    CHECK(allowed_get() == RSCH_PRIO_MAX);
+    CHECK(m_allowed_changes == changes + 1U);
+
+    request(NRF_802154_SL_COEX_OP_RX, RSCH_PRIO_IDLE_LISTENING);
+    CHECK(!request_pin_is_active() && !priority_pin_is_active());
+    CHECK(mp_timer == NULL);
+    run_until(m_now + 2U * SIM_GRANT_DELAY_US);
+
+    // GRANT withdrawn by the arbiter during the response time of a change of the operation is
+    // followed, but the request is denied only once the response time elapses.
+    request(NRF_802154_SL_COEX_OP_RX, RSCH_PRIO_RX);
+    run_until(m_now + 2U * SIM_GRANT_DELAY_US);
+    CHECK(allowed_get() == RSCH_PRIO_MAX);
+    start = m_now;
+    wifi_set(true, false);
+    request(NRF_802154_SL_COEX_OP_CCA, RSCH_PRIO_DETECT);
+    CHECK(allowed_get() == RSCH_PRIO_MAX);
+    run_until(start + SIM_GRANT_DELAY_US - 1U);
+    CHECK(allowed_get() == RSCH_PRIO_RX);
+    nrf_802154_sl_coex_pta_stats_get(&stats);
+    CHECK(stats.denied[NRF_802154_SL_COEX_OP_CCA] == 0U);
+    run_until(start + SIM_GRANT_DELAY_US);
+    nrf_802154_sl_coex_pta_stats_get(&stats);
+    CHECK(stats.denied[NRF_802154_SL_COEX_OP_CCA] == 1U);
+    request(NRF_802154_SL_COEX_OP_RX, RSCH_PRIO_IDLE_LISTENING);
+    wifi_set(false, false);
+    run_until(m_now + 2U * SIM_GRANT_DELAY_US);
+
+    // A transmission while Wi-Fi is busy is denied once the response time elapses, and is
+    // granted when Wi-Fi finishes.
+    wifi_set(true, false);
+    run_until(m_now + 2U * SIM_GRANT_DELAY_US);
+    start   = m_now;
+    changes = m_allowed_changes;
+    request(NRF_802154_SL_COEX_OP_TX, RSCH_PRIO_TX);
+    CHECK(allowed_get() == RSCH_PRIO_RX);
+    run_until(start + SIM_GRANT_DELAY_US - 1U);
+    nrf_802154_sl_coex_pta_stats_get(&stats);
+    CHECK(stats.denied[NRF_802154_SL_COEX_OP_TX] == 0U);
+    run_until(start + SIM_GRANT_DELAY_US);
+    nrf_802154_sl_coex_pta_stats_get(&stats);
+    CHECK(stats.denied[NRF_802154_SL_COEX_OP_TX] == 1U);
+    CHECK(allowed_get() == RSCH_PRIO_RX);
+    wifi_set(false, false);
+    run_until(m_now + SIM_ARBITER_DELAY_US);
+    CHECK(allowed_get() == RSCH_PRIO_MAX);
+    CHECK(m_allowed_changes == changes + 1U);
+    request(NRF_802154_SL_COEX_OP_RX, RSCH_PRIO_IDLE_LISTENING);
+    run_until(m_now + 2U * SIM_GRANT_DELAY_US);
+
+    // After two consecutive denied requests, the next one is signalled with high priority.
+    wifi_set(true, false);
+
+    for (uint32_t i = 0U; i < SIM_ESCALATION; i++)
+    {
+        bool escalated = (i == SIM_ESCALATION - 1U);
+
+        start = m_now;
+        request(NRF_802154_SL_COEX_OP_TX, RSCH_PRIO_TX);
+        CHECK(priority_pin_is_active() == escalated);
+        run_until(start + 2U * SIM_GRANT_DELAY_US);
+        CHECK(allowed_get() == (escalated ? RSCH_PRIO_MAX : RSCH_PRIO_RX));
+        request(NRF_802154_SL_COEX_OP_RX, RSCH_PRIO_IDLE_LISTENING);
+        run_until(m_now + 2U * SIM_GRANT_DELAY_US);
+    }
+
+    // The granted escalated request resets the escalation.
+    wifi_set(false, false);
+    request(NRF_802154_SL_COEX_OP_TX, RSCH_PRIO_TX);
+    CHECK(!priority_pin_is_active());
+    run_until(m_now + 2U * SIM_GRANT_DELAY_US);
+    CHECK(allowed_get() == RSCH_PRIO_MAX);
+    request(NRF_802154_SL_COEX_OP_RX, RSCH_PRIO_IDLE_LISTENING);
+
+    // A change of the operation restarts the response time. The timer callback of the previous
+    // response time, if already pending, must not sample GRANT early.
+    wifi_set(true, false);
+    run_until(m_now + 2U * SIM_GRANT_DELAY_US);
+    request(NRF_802154_SL_COEX_OP_RX, RSCH_PRIO_IDLE_LISTENING);
+    start = m_now;
+    request(NRF_802154_SL_COEX_OP_CCA, RSCH_PRIO_DETECT);
+    run_until(start + SIM_GRANT_DELAY_US - 1U);
+    request(NRF_802154_SL_COEX_OP_TX, RSCH_PRIO_TX);
+    run_until(start + SIM_GRANT_DELAY_US);
+    response_timer_fired(&m_response_timer);
+    CHECK(m_req.responding);
+    nrf_802154_sl_coex_pta_stats_get(&stats);
+    CHECK(stats.denied[NRF_802154_SL_COEX_OP_CCA] == 1U);
+    CHECK(stats.denied[NRF_802154_SL_COEX_OP_TX] == 2U);
+    run_until(m_now + SIM_GRANT_DELAY_US);
+    nrf_802154_sl_coex_pta_stats_get(&stats);
+    CHECK(stats.denied[NRF_802154_SL_COEX_OP_TX] == 3U);
+    request(NRF_802154_SL_COEX_OP_RX, RSCH_PRIO_IDLE_LISTENING);
+    wifi_set(false, false);
+    run_until(m_now + 2U * SIM_GRANT_DELAY_US);
+
+    nrf_802154_sl_coex_pta_stats_get(&stats);
+    CHECK(stats.requests[NRF_802154_SL_COEX_OP_TX] == 5U);
+    CHECK(stats.granted[NRF_802154_SL_COEX_OP_TX] == 3U);
+    CHECK(stats.escalations[NRF_802154_SL_COEX_OP_TX] == 1U);
+    CHECK(stats.requests[NRF_802154_SL_COEX_OP_ACK] == 1U);
+    CHECK(stats.granted[NRF_802154_SL_COEX_OP_ACK] == 1U);
+
+    traces_num = nrf_802154_sl_coex_pta_trace_get(traces, NRF_802154_SL_COEX_PTA_TRACE_SIZE);
+    CHECK(traces_num == 10U);
+    CHECK((traces[0].op == NRF_802154_SL_COEX_OP_RX) &&
+          (traces[0].grant_latency_us == SIM_ARBITER_DELAY_US));
+    CHECK((traces[1].op == NRF_802154_SL_COEX_OP_ACK) && traces[1].high_priority &&
+          (traces[1].grant_latency_us == SIM_GRANT_DELAY_US));
+
+    for (uint32_t i = 1U; i < traces_num; i++)
+    {
+        CHECK(traces[i].request_time >= traces[i - 1U].request_time);
+    }
+
+    // Deinitialization in the middle of a request releases the pins and the timer.
+    request(NRF_802154_SL_COEX_OP_TX, RSCH_PRIO_TX);
+    CHECK(mp_timer != NULL);
+    nrf_802154_sl_coex_pta_uninit();
+    CHECK(mp_timer == NULL);
+    CHECK(m_pin_modes[SIM_REQUEST_PIN] == SIM_PIN_DEFAULT);
+    CHECK(m_pin_modes[SIM_GRANT_PIN] == SIM_PIN_DEFAULT);
+    run_until(m_now + 2U * SIM_GRANT_DELAY_US);
+
+    // The 1-wire interface has no outputs and samples GRANT at once.
+    sim_reset(true);
+    cfg = cfg_get(NRF_802154_SL_COEX_PTA_INTERFACE_1WIRE, 0U);
+    wifi_set(true, false);
+    run_until(m_now + SIM_ARBITER_DELAY_US);
+    nrf_802154_sl_coex_pta_init();
+    CHECK(nrf_802154_sl_coex_pta_cfg_set(&cfg));
+    CHECK(m_pin_modes[SIM_REQUEST_PIN] == SIM_PIN_DEFAULT);
+    CHECK(m_pin_modes[SIM_GRANT_PIN] == SIM_PIN_INPUT);
+    request(NRF_802154_SL_COEX_OP_TX, RSCH_PRIO_TX);
+    CHECK(mp_timer == NULL);
+    CHECK(allowed_get() == RSCH_PRIO_RX);
+    wifi_set(false, false);
+    run_until(m_now + SIM_ARBITER_DELAY_US);
+    CHECK(allowed_get() == RSCH_PRIO_MAX);
+    request(NRF_802154_SL_COEX_OP_RX, RSCH_PRIO_IDLE);
+    nrf_802154_sl_coex_pta_uninit();
+
+    printf("functional: %s\n", (m_failures == 0U) ? "ok" : "failed");
+}
+
+/***************************************************************************************************
+ * @section Traffic benchmark
+ **************************************************************************************************/
+
+static void traffic_run(uint8_t escalation, uint32_t load_percent, uint32_t slots, uint32_t seed)
+{
+    nrf_802154_sl_coex_pta_cfg_t   cfg = cfg_get(NRF_802154_SL_COEX_PTA_INTERFACE_3WIRE,
+                                                 escalation);
+    nrf_802154_sl_coex_pta_stats_t stats;
+    uint32_t                       delivered = 0U;
+    uint32_t                       preempted = 0U;
+    uint32_t                       wait      = 0U;
+    uint32_t                       max_wait  = 0U;
+
+    sim_reset(false);
+    m_rand_state = seed;
+
+    nrf_802154_sl_coex_pta_init();
+    CHECK(nrf_802154_sl_coex_pta_cfg_set(&cfg));
+    nrf_802154_sl_coex_pta_stats_reset();
+
+    for (uint32_t slot = 0U; slot < slots; slot++)
+    {
+        bool     busy  = (xorshift32(&m_rand_state) % 100U) < load_percent;
+        uint64_t start = m_now;
+        bool     granted;
+
+        wifi_set(busy, busy && ((xorshift32(&m_rand_state) % 10U) == 0U));
+        run_until(start + SIM_ARBITER_DELAY_US);
+
+        // The transmission starts if the arbiter allows it once the response time elapses.
+        request(NRF_802154_SL_COEX_OP_TX, RSCH_PRIO_TX);
+        CHECK(m_now == start + SIM_ARBITER_DELAY_US);
+        run_until(m_now + SIM_GRANT_DELAY_US);
+        granted = (allowed_get() == RSCH_PRIO_MAX);
+
+        if (granted)
+        {
+            delivered++;
+            preempted += busy ? 1U : 0U;
+            max_wait   = (wait > max_wait) ? wait : max_wait;
+            wait       = 0U;
+        }
+        else
+        {
+            wait++;
+        }
+
+        run_until(start + SIM_SLOT_US);
+        request(NRF_802154_SL_COEX_OP_RX, RSCH_PRIO_IDLE_LISTENING);
+    }
+
+    nrf_802154_sl_coex_pta_stats_get(&stats);
+    CHECK(stats.requests[NRF_802154_SL_COEX_OP_TX] == slots);
+    CHECK(stats.granted[NRF_802154_SL_COEX_OP_TX] >= delivered);
+
+    printf("%7u%%  %10u  %8.1f%%  %10u  %8u  %9u  %14.1f%%  %13u\n",
+           (unsigned)load_percent, (unsigned)escalation, 100.0 * delivered / slots,
+           (unsigned)max_wait, (unsigned)stats.denied[NRF_802154_SL_COEX_OP_TX],
+           (unsigned)stats.escalations[NRF_802154_SL_COEX_OP_TX], 100.0 * preempted / slots,
+           (unsigned)m_timer_starts);
+
+    nrf_802154_sl_coex_pta_uninit();
+}
+
+static void traffic_benchmark(uint32_t slots, uint32_t seed)
+{
+    static const uint32_t loads[]       = {50U, 90U};
+    static const uint8_t  escalations[] = {0U, 2U, 4U};
+
+    printf("\nWi-Fi load  escalation  delivered  worst wait    denied  escalated  Wi-Fi preempted"
+           "  timed waits\n");
+
+    for (size_t l = 0U; l < sizeof(loads) / sizeof(loads[0]); l++)
+    {
+        for (size_t e = 0U; e < sizeof(escalations) / sizeof(escalations[0]); e++)
+        {
+            traffic_run(escalations[e], loads[l], slots, seed);
+        }
+    }
+
+    printf("\nEvery response time of %u us was measured with the timer instead of busy-waiting.\n",
+           (unsigned)SIM_GRANT_DELAY_US);
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t slots = 200000U;
+    uint32_t seed  = 7U;
+    int      opt   = 1;
+
+    while (opt + 1 < argc)
+    {
+        unsigned long value = strtoul(argv[opt + 1], NULL, 0);
+
+        if (strcmp(argv[opt], "-n") == 0)
+        {
+            slots = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-s") == 0)
+        {
+            seed = (uint32_t)value;
+        }
+        else
+        {
+            break;
+        }
+
+        opt += 2;
+    }
+
+    if ((opt != argc) || (slots == 0U) || (seed == 0U))
+    {
+        fprintf(stderr, "Usage: %s [-n <transmission slots>] [-s <seed>]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    functional_test();
+    traffic_benchmark(slots, seed);
+
+    if (m_failures != 0U)
+    {
+        printf("\n%u checks failed\n", (unsigned)m_failures);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,696 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run simulation of the open-source radio scheduler.
+ *
+ * The simulator links nrf_802154_sl_rsch.c and nrf_802154_sl_coex.c unchanged and replaces
+ * the timer, the clock and the driver critical section with an event-driven model. A model of
+ * the core requests priorities and tracks the approved ones, and owners of delayed timeslots
+ * log when their timeslots start. The scenarios are:
+ *
+ * - continuous: the core requests the radio, waits for the clock and releases the radio,
+ * - requests:   deadlines, limits of timeslots per operation and duplicate identifiers,
+ * - precise:    preconditions are requested before the trigger time and granted at it,
+ * - order:      timeslots due at the same time start in the order of decreasing priority,
+ * - external:   an external radio user preempts the driver, is denied and waits for the granted
+ *               timeslot,
+ * - reentrant:  the core requests a new priority from inside of the approval notification,
+ * - random:     random requests, cancellations and external requests; every accepted timeslot
+ *               must start once and not before its trigger time.
+ *
+ * The program exits with a failure if any check fails.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -o sl_rsch_sim ../../utils/nrf_802154_sl_rsch_sim.c \
+ *         sl/sl_opensource/src/nrf_802154_sl_rsch.c sl/sl_opensource/src/nrf_802154_sl_coex.c \
+ *         -Icommon/include -Idriver/include -Idriver/src -Isl/include -Isl/sl_opensource/include \
+ *         -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis>
+ *
+ * Usage:
+ *
+ *     sl_rsch_sim [-n <random operations>] [-s <seed>]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nrf_802154_sl_config.h"
+#include "nrf_802154_sl_crit_sect_if.h"
+#include "nrf_802154_sl_rsch_external.h"
+#include "nrf_802154_sl_timer.h"
+#include "rsch/nrf_802154_rsch.h"
+#include "rsch/nrf_802154_rsch_crit_sect.h"
+
+#define SIM_START_TIME    1000000U ///< Time at which every scenario starts, in microseconds.
+#define SIM_HFCLK_RAMP_UP 300U     ///< Startup time of the high frequency clock, in microseconds.
+#define SIM_LOG_SIZE      64U      ///< Capacity of the log of started timeslots.
+#define SIM_RANDOM_ID     100U     ///< First identifier used by the random scenario.
+#define SIM_RANDOM_IDS    6U       ///< Number of identifiers used by the random scenario.
+#define SIM_TIME_NEVER    UINT64_MAX
+
+#define CHECK(cond)                                                                \
+    do                                                                             \
+    {                                                                              \
+        if (!(cond))                                                               \
+        {                                                                          \
+            printf("  check failed at line %d (time %llu): %s\n",                  \
+                   __LINE__, (unsigned long long)m_now, #cond);                    \
+            m_failures++;                                                          \
+        }                                                                          \
+    }                                                                              \
+    while (0)
+
+extern bool nrf_802154_critical_section_rsch_event_is_pending(void);
+extern void nrf_802154_critical_section_rsch_process_pending(void);
+extern void nrf_802154_clock_hfclk_ready(void);
+
+/**
+ * @brief Start of a delayed timeslot logged by its owner.
+ */
+typedef struct
+{
+    rsch_dly_ts_id_t id;      ///< Identifier of the timeslot.
+    uint64_t         time;    ///< Time at which the timeslot started.
+    bool             granted; ///< If the radio was approved when the timeslot started.
+} sim_log_entry_t;
+
+static uint32_t m_failures;                  ///< Number of failed checks.
+static uint64_t m_now;                       ///< Current time, in microseconds.
+
+static nrf_802154_sl_timer_t * mp_timer;     ///< The only timer of the scheduler, NULL if not armed.
+static uint64_t                m_hfclk_ready_time;
+static uint32_t                m_hfclk_starts;
+static uint32_t                m_hfclk_stops;
+static uint32_t                m_crit_sect_depth;
+
+static rsch_prio_t m_core_prio;              ///< Priority approved for the core.
+static bool        m_core_rerequest;         ///< If the core requests @ref m_core_rerequest_prio once approved.
+static rsch_prio_t m_core_rerequest_prio;
+
+static sim_log_entry_t m_log[SIM_LOG_SIZE];
+static uint32_t        m_log_cnt;
+static bool            m_cancel_when_started; ///< If owners cancel their timeslots once started.
+static bool            m_live[SIM_RANDOM_IDS];
+static uint64_t        m_trigger_time[SIM_RANDOM_IDS];
+
+static uint32_t xorshift32(uint32_t * p_state)
+{
+    uint32_t x = *p_state;
+
+    x        ^= x << 13;
+    x        ^= x >> 17;
+    x        ^= x << 5;
+    *p_state  = x;
+
+    return x;
+}
+
+/***************************************************************************************************
+ * @section Models of the modules around the scheduler
+ **************************************************************************************************/
+
+void nrf_802154_sl_timer_init(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+}
+
+void nrf_802154_sl_timer_deinit(nrf_802154_sl_timer_t * p_timer)
+{
+    (void)p_timer;
+}
+
+uint64_t nrf_802154_sl_timer_current_time_get(void)
+{
+    return m_now;
+}
+
+nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_add(nrf_802154_sl_timer_t * p_timer)
+{
+    mp_timer = p_timer;
+
+    return NRF_802154_SL_TIMER_RET_SUCCESS;
+}
+
+nrf_802154_sl_timer_ret_t nrf_802154_sl_timer_remove(nrf_802154_sl_timer_t * p_timer)
+{
+    if (mp_timer != p_timer)
+    {
+        return NRF_802154_SL_TIMER_RET_INACTIVE;
+    }
+
+    mp_timer = NULL;
+
+    return NRF_802154_SL_TIMER_RET_SUCCESS;
+}
+
+void nrf_802154_clock_hfclk_start(void)
+{
+    m_hfclk_starts++;
+    m_hfclk_ready_time = m_now + SIM_HFCLK_RAMP_UP;
+}
+
+void nrf_802154_clock_hfclk_stop(void)
+{
+    m_hfclk_stops++;
+    m_hfclk_ready_time = SIM_TIME_NEVER;
+}
+
+static bool crit_sect_enter(void)
+{
+    if (m_crit_sect_depth != 0)
+    {
+        return false;
+    }
+
+    m_crit_sect_depth++;
+
+    return true;
+}
+
+static void crit_sect_exit(void)
+{
+    CHECK(m_crit_sect_depth == 1);
+
+    while (nrf_802154_critical_section_rsch_event_is_pending())
+    {
+        nrf_802154_critical_section_rsch_process_pending();
+    }
+
+    m_crit_sect_depth--;
+}
+
+static const nrf_802154_sl_crit_sect_interface_t m_crit_sect_interface =
+{
+    .enter = crit_sect_enter,
+    .exit  = crit_sect_exit,
+};
+
+const nrf_802154_sl_crit_sect_interface_t * gp_nrf_802154_sl_crit_sect_interface =
+    &m_crit_sect_interface;
+
+void nrf_802154_rsch_crit_sect_prio_changed(rsch_prio_t prio)
+{
+    // The core is always notified from inside of the critical section.
+    CHECK(m_crit_sect_depth == 1);
+
+    m_core_prio = prio;
+
+    if (m_core_rerequest)
+    {
+        m_core_rerequest = false;
+        nrf_802154_rsch_crit_sect_prio_request(m_core_rerequest_prio);
+    }
+}
+
+static void core_request(rsch_prio_t prio)
+{
+    CHECK(crit_sect_enter());
+    nrf_802154_rsch_crit_sect_prio_request(prio);
+    crit_sect_exit();
+}
+
+static void started(rsch_dly_ts_id_t id)
+{
+    if ((id >= SIM_RANDOM_ID) && (id < SIM_RANDOM_ID + SIM_RANDOM_IDS))
+    {
+        CHECK(m_live[id - SIM_RANDOM_ID]);
+        CHECK(m_now >= m_trigger_time[id - SIM_RANDOM_ID]);
+        m_live[id - SIM_RANDOM_ID] = false;
+    }
+
+    if (m_log_cnt < SIM_LOG_SIZE)
+    {
+        m_log[m_log_cnt] = (sim_log_entry_t){
+            .id      = id,
+            .time    = m_now,
+            .granted = nrf_802154_rsch_prec_is_approved(RSCH_PREC_RAAL, RSCH_PRIO_MIN_APPROVED),
+        };
+    }
+
+    m_log_cnt++;
+
+    if (m_cancel_when_started)
+    {
+        CHECK(nrf_802154_rsch_delayed_timeslot_cancel(id, true));
+    }
+}
+
+/***************************************************************************************************
+ * @section Event loop
+ **************************************************************************************************/
+
+static void run_until(uint64_t end)
+{
+    while (true)
+    {
+        uint64_t timer_time = SIM_TIME_NEVER;
+        uint64_t next;
+
+        if (mp_timer != NULL)
+        {
+            // A timer armed in the past fires as soon as possible.
+            timer_time = (mp_timer->trigger_time > m_now) ? mp_timer->trigger_time : m_now + 1;
+        }
+
+        next = (timer_time < m_hfclk_ready_time) ? timer_time : m_hfclk_ready_time;
+
+        if (next > end)
+        {
+            break;
+        }
+
+        m_now = next;
+
+        if (next == m_hfclk_ready_time)
+        {
+            m_hfclk_ready_time = SIM_TIME_NEVER;
+            nrf_802154_clock_hfclk_ready();
+        }
+        else
+        {
+            nrf_802154_sl_timer_t * p_timer = mp_timer;
+
+            mp_timer = NULL;
+            p_timer->action.callback.callback(p_timer);
+        }
+    }
+
+    m_now = end;
+}
+
+static rsch_dly_ts_param_t param_get(rsch_dly_ts_id_t   id,
+                                     uint64_t           trigger_time,
+                                     rsch_prio_t        prio,
+                                     rsch_dly_ts_op_t   op,
+                                     rsch_dly_ts_type_t type)
+{
+    rsch_dly_ts_param_t param =
+    {
+        .trigger_time     = trigger_time,
+        .prio             = prio,
+        .op               = op,
+        .type             = type,
+        .started_callback = started,
+        .id               = id,
+    };
+
+    return param;
+}
+
+static bool request(rsch_dly_ts_id_t   id,
+                    uint64_t           trigger_time,
+                    rsch_prio_t        prio,
+                    rsch_dly_ts_op_t   op,
+                    rsch_dly_ts_type_t type)
+{
+    rsch_dly_ts_param_t param = param_get(id, trigger_time, prio, op, type);
+
+    return nrf_802154_rsch_delayed_timeslot_request(&param);
+}
+
+static void reset(void)
+{
+    m_now                 = SIM_START_TIME;
+    mp_timer              = NULL;
+    m_hfclk_ready_time    = SIM_TIME_NEVER;
+    m_hfclk_starts        = 0;
+    m_hfclk_stops         = 0;
+    m_crit_sect_depth     = 0;
+    m_core_prio           = RSCH_PRIO_IDLE;
+    m_core_rerequest      = false;
+    m_log_cnt             = 0;
+    m_cancel_when_started = true;
+    memset(m_live, 0, sizeof(m_live));
+
+    nrf_802154_rsch_init();
+}
+
+/***************************************************************************************************
+ * @section Scenarios
+ **************************************************************************************************/
+
+static void continuous_test(void)
+{
+    reset();
+
+    core_request(RSCH_PRIO_IDLE_LISTENING);
+    CHECK((m_hfclk_starts == 1) && (m_core_prio == RSCH_PRIO_IDLE));
+    CHECK(!nrf_802154_rsch_prec_is_approved(RSCH_PREC_RAAL, RSCH_PRIO_MIN_APPROVED));
+
+    run_until(m_now + SIM_HFCLK_RAMP_UP);
+    CHECK(m_core_prio == RSCH_PRIO_MAX);
+    CHECK(nrf_802154_rsch_prec_is_approved(RSCH_PREC_HFCLK, RSCH_PRIO_TX));
+    CHECK(nrf_802154_rsch_timeslot_us_left_get() == UINT32_MAX);
+    CHECK(nrf_802154_rsch_timeslot_request(5000));
+
+    core_request(RSCH_PRIO_IDLE);
+    CHECK((m_core_prio == RSCH_PRIO_IDLE) && (m_hfclk_stops == 1));
+    CHECK(nrf_802154_rsch_timeslot_us_left_get() == 0);
+    CHECK(!nrf_802154_rsch_timeslot_request(10));
+
+    printf("continuous: done\n");
+}
+
+static void requests_test(void)
+{
+    uint64_t time_to_start;
+
+    reset();
+
+    // Inside of the ramp-up time, in the past and on time.
+    CHECK(!request(1, m_now + 100, RSCH_PRIO_IDLE_LISTENING, RSCH_DLY_TS_OP_DRX,
+                   RSCH_DLY_TS_TYPE_PRECISE));
+    CHECK(!request(1, m_now - 5, RSCH_PRIO_IDLE_LISTENING, RSCH_DLY_TS_OP_DRX,
+                   RSCH_DLY_TS_TYPE_PRECISE));
+    CHECK(request(1, m_now + 2000, RSCH_PRIO_IDLE_LISTENING, RSCH_DLY_TS_OP_DRX,
+                  RSCH_DLY_TS_TYPE_PRECISE));
+
+    // Duplicate identifier and the limit of DRX timeslots.
+    CHECK(!request(1, m_now + 2000, RSCH_PRIO_IDLE_LISTENING, RSCH_DLY_TS_OP_DRX,
+                   RSCH_DLY_TS_TYPE_PRECISE));
+
+    for (uint32_t i = 1; i < NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS; i++)
+    {
+        CHECK(request(1 + i, m_now + 2000, RSCH_PRIO_IDLE_LISTENING, RSCH_DLY_TS_OP_DRX,
+                      RSCH_DLY_TS_TYPE_PRECISE));
+    }
+
+    CHECK(!request(1 + NRF_802154_RSCH_DLY_TS_OP_DRX_SLOTS, m_now + 2000, RSCH_PRIO_IDLE_LISTENING,
+                   RSCH_DLY_TS_OP_DRX, RSCH_DLY_TS_TYPE_PRECISE));
+
+    CHECK(nrf_802154_rsch_delayed_timeslot_time_to_start_get(2, &time_to_start));
+    CHECK(time_to_start == 2000);
+    CHECK(!nrf_802154_rsch_timeslot_is_requested() && (m_hfclk_starts == 0));
+    CHECK(nrf_802154_rsch_delayed_timeslot_cancel(2, false));
+    CHECK(!nrf_802154_rsch_delayed_timeslot_cancel(2, false));
+
+    // A relaxed timeslot may be requested in the past, but never starts synchronously.
+    CHECK(request(1000, m_now - 50, RSCH_PRIO_IDLE_LISTENING, RSCH_DLY_TS_OP_CSMACA,
+                  RSCH_DLY_TS_TYPE_RELAXED));
+    CHECK(m_log_cnt == 0);
+    CHECK(nrf_802154_rsch_timeslot_is_requested() && (m_hfclk_starts == 1));
+
+    // The clock is not ready yet, so the owner sees the radio denied.
+    run_until(m_now + 1);
+    CHECK((m_log_cnt == 1) && (m_log[0].id == 1000) && !m_log[0].granted);
+
+    printf("requests: done\n");
+}
+
+static void precise_test(void)
+{
+    uint64_t trigger_time;
+
+    reset();
+
+    trigger_time = m_now + 5000;
+    CHECK(request(1, trigger_time, RSCH_PRIO_IDLE_LISTENING, RSCH_DLY_TS_OP_DRX,
+                  RSCH_DLY_TS_TYPE_PRECISE));
+
+    run_until(trigger_time - NRF_802154_SL_RSCH_PREC_RAMP_UP_US - 1);
+    CHECK(m_hfclk_starts == 0);
+
+    run_until(trigger_time - NRF_802154_SL_RSCH_PREC_RAMP_UP_US);
+    CHECK((m_hfclk_starts == 1) && nrf_802154_rsch_timeslot_is_requested());
+
+    run_until(trigger_time - 1);
+    CHECK((m_log_cnt == 0) && (m_core_prio == RSCH_PRIO_MAX));
+
+    run_until(trigger_time);
+    CHECK((m_log_cnt == 1) && (m_log[0].time == trigger_time) && m_log[0].granted);
+
+    // Released by the cancellation in the started callback.
+    CHECK((m_core_prio == RSCH_PRIO_IDLE) && (m_hfclk_stops == 1));
+
+    printf("precise: done\n");
+}
+
+static void order_test(void)
+{
+    uint64_t trigger_time;
+
+    reset();
+
+    core_request(RSCH_PRIO_IDLE_LISTENING);
+    run_until(m_now + SIM_HFCLK_RAMP_UP);
+
+    trigger_time = m_now + 3000;
+    CHECK(request(10, trigger_time, RSCH_PRIO_IDLE_LISTENING, RSCH_DLY_TS_OP_DRX,
+                  RSCH_DLY_TS_TYPE_PRECISE));
+    CHECK(request(11, trigger_time, RSCH_PRIO_TX, RSCH_DLY_TS_OP_DTX, RSCH_DLY_TS_TYPE_PRECISE));
+    CHECK(request(12, trigger_time, RSCH_PRIO_DETECT, RSCH_DLY_TS_OP_CSMACA,
+                  RSCH_DLY_TS_TYPE_RELAXED));
+    CHECK(request(13, trigger_time - 10, RSCH_PRIO_IDLE_LISTENING, RSCH_DLY_TS_OP_DRX,
+                  RSCH_DLY_TS_TYPE_PRECISE));
+    CHECK(nrf_802154_rsch_delayed_timeslot_priority_update(10, RSCH_PRIO_RX));
+
+    run_until(trigger_time);
+    CHECK(m_log_cnt == 4);
+    CHECK((m_log[0].id == 13) && (m_log[0].time == trigger_time - 10));
+    CHECK((m_log[1].id == 11) && (m_log[2].id == 12) && (m_log[3].id == 10));
+    CHECK(!nrf_802154_rsch_timeslot_is_requested() && (m_core_prio == RSCH_PRIO_MAX));
+
+    printf("order: done\n");
+}
+
+static void external_test(void)
+{
+    uint64_t trigger_time;
+
+    reset();
+
+    core_request(RSCH_PRIO_IDLE_LISTENING);
+    run_until(m_now + SIM_HFCLK_RAMP_UP);
+
+    // A timeslot can be granted and extended up to the takeover by the external user.
+    nrf_802154_sl_rsch_external_request(RSCH_PRIO_RX, m_now + 1000);
+    CHECK(nrf_802154_rsch_timeslot_us_left_get() == 1000);
+    CHECK(!nrf_802154_rsch_timeslot_request(1500));
+    CHECK(nrf_802154_rsch_timeslot_request(600));
+    run_until(m_now + 400);
+    CHECK(nrf_802154_rsch_timeslot_request(600));
+    CHECK(!nrf_802154_rsch_timeslot_request(601));
+
+    run_until(m_now + 600);
+    CHECK((m_core_prio == RSCH_PRIO_IDLE) && nrf_802154_sl_rsch_external_is_granted());
+    CHECK(!nrf_802154_rsch_prec_is_approved(RSCH_PREC_RAAL, RSCH_PRIO_MIN_APPROVED));
+    CHECK(nrf_802154_rsch_prec_is_approved(RSCH_PREC_HFCLK, RSCH_PRIO_MIN_APPROVED));
+
+    // A delayed transmission with a higher priority takes the radio back at its trigger time.
+    trigger_time          = m_now + 2000;
+    m_cancel_when_started = false;
+    CHECK(request(20, trigger_time, RSCH_PRIO_TX, RSCH_DLY_TS_OP_DTX, RSCH_DLY_TS_TYPE_PRECISE));
+    run_until(trigger_time - NRF_802154_SL_RSCH_PREC_RAMP_UP_US);
+    CHECK((m_core_prio == RSCH_PRIO_MAX) && !nrf_802154_sl_rsch_external_is_granted());
+    run_until(trigger_time);
+    CHECK((m_log_cnt == 1) && m_log[0].granted);
+    CHECK(nrf_802154_rsch_delayed_timeslot_cancel(20, true));
+    CHECK((m_core_prio == RSCH_PRIO_IDLE) && nrf_802154_sl_rsch_external_is_granted());
+
+    // A delayed reception with a lower priority than the external user is denied.
+    trigger_time          = m_now + 2000;
+    m_cancel_when_started = true;
+    CHECK(request(21, trigger_time, RSCH_PRIO_IDLE_LISTENING, RSCH_DLY_TS_OP_DRX,
+                  RSCH_DLY_TS_TYPE_PRECISE));
+    run_until(trigger_time);
+    CHECK((m_log_cnt == 2) && !m_log[1].granted);
+    nrf_802154_sl_rsch_external_release();
+    CHECK((m_core_prio == RSCH_PRIO_MAX) && !nrf_802154_sl_rsch_external_is_granted());
+
+    // A higher priority external request waits for the end of the granted timeslot.
+    CHECK(nrf_802154_rsch_timeslot_request(10000));
+    nrf_802154_sl_rsch_external_request(RSCH_PRIO_TX, m_now);
+    CHECK((m_core_prio == RSCH_PRIO_MAX) && (nrf_802154_rsch_timeslot_us_left_get() == 10000));
+    CHECK(!nrf_802154_rsch_timeslot_request(10001));
+    run_until(m_now + 10000);
+    CHECK(m_core_prio == RSCH_PRIO_IDLE);
+
+    // Out of a granted timeslot, it preempts the driver immediately.
+    nrf_802154_sl_rsch_external_release();
+    CHECK(m_core_prio == RSCH_PRIO_MAX);
+    nrf_802154_sl_rsch_external_request(RSCH_PRIO_TX, m_now);
+    CHECK(m_core_prio == RSCH_PRIO_IDLE);
+    nrf_802154_sl_rsch_external_release();
+
+    // An equal priority external request waits for the granted timeslot too.
+    CHECK((m_core_prio == RSCH_PRIO_MAX) && nrf_802154_rsch_timeslot_request(700));
+    nrf_802154_sl_rsch_external_request(RSCH_PRIO_IDLE_LISTENING, m_now);
+    CHECK((m_core_prio == RSCH_PRIO_MAX) && (nrf_802154_rsch_timeslot_us_left_get() == 700));
+    run_until(m_now + 700);
+    CHECK(m_core_prio == RSCH_PRIO_IDLE);
+    nrf_802154_sl_rsch_external_release();
+
+    printf("external: done\n");
+}
+
+static void reentrant_test(void)
+{
+    reset();
+
+    // The new request is processed once the critical section is exited.
+    m_core_rerequest      = true;
+    m_core_rerequest_prio = RSCH_PRIO_IDLE;
+    core_request(RSCH_PRIO_RX);
+    run_until(m_now + SIM_HFCLK_RAMP_UP);
+    CHECK((m_core_prio == RSCH_PRIO_IDLE) && (m_hfclk_stops == 1) && (m_crit_sect_depth == 0));
+
+    printf("reentrant: done\n");
+}
+
+static void random_test(uint32_t operations, uint32_t seed)
+{
+    uint32_t rng      = seed;
+    uint32_t accepted = 0;
+    uint32_t started  = 0;
+
+    reset();
+    core_request(RSCH_PRIO_IDLE_LISTENING);
+
+    for (uint32_t n = 0; n < operations; n++)
+    {
+        uint32_t           r    = xorshift32(&rng);
+        uint32_t           slot = (r >> 8) % SIM_RANDOM_IDS;
+        rsch_dly_ts_id_t   id   = SIM_RANDOM_ID + slot;
+        uint64_t           time = m_now + (r >> 4) % 3000;
+        rsch_prio_t        prio = (rsch_prio_t)(1 + (r >> 12) % 4);
+        rsch_dly_ts_type_t type = ((r >> 16) & 1) ? RSCH_DLY_TS_TYPE_PRECISE :
+                                  RSCH_DLY_TS_TYPE_RELAXED;
+
+        if (request(id, time, prio, (rsch_dly_ts_op_t)(r % 3), type))
+        {
+            CHECK(!m_live[slot]);
+            m_live[slot]         = true;
+            m_trigger_time[slot] = time;
+            accepted++;
+        }
+
+        if ((r >> 20) % 7 == 0)
+        {
+            bool cancelled = nrf_802154_rsch_delayed_timeslot_cancel(id, false);
+
+            CHECK(cancelled == m_live[slot]);
+
+            if (cancelled)
+            {
+                m_live[slot] = false;
+                accepted--;
+            }
+        }
+
+        if ((r >> 24) % 11 == 0)
+        {
+            nrf_802154_sl_rsch_external_request((rsch_prio_t)((r >> 3) % 5), m_now + (r >> 5) % 500);
+        }
+
+        run_until(m_now + (r >> 9) % 400);
+
+        for (uint32_t i = 0; (i < m_log_cnt) && (i < SIM_LOG_SIZE); i++)
+        {
+            CHECK(m_log[i].time <= m_now);
+        }
+
+        started  += m_log_cnt;
+        m_log_cnt = 0;
+
+        CHECK(m_crit_sect_depth == 0);
+        CHECK((m_core_prio == RSCH_PRIO_IDLE) ||
+              nrf_802154_rsch_prec_is_approved(RSCH_PREC_HFCLK, RSCH_PRIO_TX));
+    }
+
+    // Timeslots accepted near the end of the run may not have started yet.
+    for (uint32_t i = 0; i < SIM_RANDOM_IDS; i++)
+    {
+        accepted -= m_live[i] ? 1 : 0;
+    }
+
+    printf("random: %u timeslots accepted, %u started\n", (unsigned)accepted, (unsigned)started);
+    CHECK(accepted == started);
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t operations = 200000U;
+    uint32_t seed       = 7U;
+    int      opt        = 1;
+
+    while (opt + 1 < argc)
+    {
+        unsigned long value = strtoul(argv[opt + 1], NULL, 0);
+
+        if (strcmp(argv[opt], "-n") == 0)
+        {
+            operations = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-s") == 0)
+        {
+            seed = (uint32_t)value;
+        }
+        else
+        {
+            break;
+        }
+
+        opt += 2;
+    }
+
+    if ((opt != argc) || (seed == 0U))
+    {
+        fprintf(stderr, "Usage: %s [-n <random operations>] [-s <seed>]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    continuous_test();
+    requests_test();
+    precise_test();
+    order_test();
+    external_test();
+    reentrant_test();
+    random_test(operations, seed);
+
+    nrf_802154_rsch_uninit();
+
+    if (m_failures != 0U)
+    {
+        printf("\n%u checks failed\n", (unsigned)m_failures);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
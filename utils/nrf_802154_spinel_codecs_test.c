@@ -0,0 +1,12686 @@
+/*
+ * Copyright (c) 2026 Nordic Semiconductor ASA
+ * SPDX-License-Identifier: BSD-3-Clause
+ */
+
+/* autogenerated using Nordic HAL utils/gen_spinel_codecs.py script */
+
+/**
+ * @file
+ *   Host test of the precompiled spinel codecs.
+ *
+ * Every codec from nrf_802154_spinel_codecs.h is run on random input and checked byte for byte against
+ * spinel_datatype_pack and spinel_datatype_unpack, which interpret the spinel format string of
+ * the data type. The unpacking codecs are also run on every truncation of the packed data and
+ * must reject it, unless the data type ends with a data field without a length prefix. The time
+ * spent by both implementations is measured on the same input and reported per data type.
+ * The program exits with a failure if any check fails.
+ *
+ * Build from the drivers/nrf_802154/serialization directory:
+ *
+ *     gcc -O2 -o spinel_codecs_test ../../../utils/nrf_802154_spinel_codecs_test.c \
+ *         spinel_base/spinel.c -Isrc -Isrc/include
+ *
+ * Usage:
+ *
+ *     spinel_codecs_test [-r <runs per data type>] [-s <seed>] [-v]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "nrf_802154_spinel_datatypes.h"
+#include "nrf_802154_spinel_codecs.h"
+
+#define TEST_BUFFER_SIZE  1024U ///< Large enough for any data type with data fields of the maximal length.
+#define TEST_DATA_MAX_LEN 64U   ///< Maximal length of a random data field.
+#define TEST_BENCH_REPEAT 16U   ///< Calls measured together, to hide the cost of reading the clock.
+
+#define CHECK(p_what, condition)                                  \
+    do                                                            \
+    {                                                             \
+        if (!(condition))                                         \
+        {                                                         \
+            printf("error: %s, run %u\n", p_what, (unsigned)run); \
+            m_violations++;                                       \
+        }                                                         \
+    }                                                             \
+    while (0)
+
+typedef struct
+{
+    uint64_t pack_interpreter;
+    uint64_t pack_codec;
+    uint64_t unpack_interpreter;
+    uint64_t unpack_codec;
+} test_times_t;
+
+typedef struct
+{
+    const char * p_name;
+    void (* test)(uint32_t runs);
+} test_t;
+
+static uint32_t       m_rng;
+static uint64_t       m_violations;
+static test_times_t   m_times;
+static uint8_t        m_expected[TEST_BUFFER_SIZE];
+static uint8_t        m_packed[TEST_BUFFER_SIZE];
+static volatile long  m_sink;
+
+static uint32_t rand_get(void)
+{
+    uint32_t x = m_rng;
+
+    x     ^= x << 13;
+    x     ^= x >> 17;
+    x     ^= x << 5;
+    m_rng  = x;
+
+    return x;
+}
+
+static uint64_t rand64_get(void)
+{
+    return ((uint64_t)rand_get() << 32) | rand_get();
+}
+
+static void data_fill(uint8_t * p_data, size_t len)
+{
+    for (size_t i = 0U; i < len; i++)
+    {
+        p_data[i] = (uint8_t)rand_get();
+    }
+}
+
+static uint64_t time_get(void)
+{
+    struct timespec now;
+
+    clock_gettime(CLOCK_MONOTONIC, &now);
+
+    return (uint64_t)now.tv_sec * 1000000000U + (uint64_t)now.tv_nsec;
+}
+
+static void ack_data_clear_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        size_t          arg0_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg1                 = (uint8_t)rand_get();
+        uint8_t         arg0_data[TEST_DATA_MAX_LEN];
+        const uint8_t * p_arg0_interpreter   = NULL;
+        const void    * p_arg0_codec         = NULL;
+        unsigned int    arg0_len_interpreter = 0U;
+        size_t          arg0_len_codec       = 0U;
+        uint8_t         arg1_interpreter     = 0;
+        uint8_t         arg1_codec           = 0;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg0_data, arg0_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR,
+                                   arg0_data,
+                                   (unsigned int)arg0_len,
+                                   arg1);
+        codec_len = nrf_802154_spinel_codec_ack_data_clear_pack(m_packed,
+                                                                sizeof(m_packed),
+                                                                arg0_data,
+                                                                arg0_len,
+                                                                arg1);
+
+        CHECK("ACK_DATA_CLEAR pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_ack_data_clear_pack(m_packed,
+                                                                    (size_t)len - 1U,
+                                                                    arg0_data,
+                                                                    arg0_len,
+                                                                    arg1);
+
+            CHECK("ACK_DATA_CLEAR pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR,
+                                                                    &p_arg0_interpreter,
+                                                                    &arg0_len_interpreter,
+                                                                    &arg1_interpreter);
+            codec_len = nrf_802154_spinel_codec_ack_data_clear_unpack(m_expected,
+                                                                      cut,
+                                                                      &p_arg0_codec,
+                                                                      &arg0_len_codec,
+                                                                      &arg1_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("ACK_DATA_CLEAR unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("ACK_DATA_CLEAR unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  ((const void *)p_arg0_interpreter == p_arg0_codec) &&
+                  (arg0_len_interpreter == arg0_len_codec) &&
+                  (arg1_codec == arg1_interpreter) &&
+                  (arg1_codec == arg1));
+        }
+
+        CHECK("ACK_DATA_CLEAR unpacked data",
+              (arg0_len_codec == arg0_len) &&
+              (memcmp(p_arg0_codec, arg0_data, arg0_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR,
+                                           arg0_data,
+                                           (unsigned int)arg0_len,
+                                           arg1);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ack_data_clear_pack(m_packed,
+                                                                  sizeof(m_packed),
+                                                                  arg0_data,
+                                                                  arg0_len,
+                                                                  arg1);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR,
+                                             &p_arg0_interpreter,
+                                             &arg0_len_interpreter,
+                                             &arg1_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ack_data_clear_unpack(m_expected,
+                                                                    (size_t)len,
+                                                                    &p_arg0_codec,
+                                                                    &arg0_len_codec,
+                                                                    &arg1_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void ack_data_clear_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_ack_data_clear_ret_pack(m_packed,
+                                                                    sizeof(m_packed),
+                                                                    arg0);
+
+        CHECK("ACK_DATA_CLEAR_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_ack_data_clear_ret_pack(m_packed,
+                                                                        (size_t)len - 1U,
+                                                                        arg0);
+
+            CHECK("ACK_DATA_CLEAR_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_ack_data_clear_ret_unpack(m_expected,
+                                                                          cut,
+                                                                          &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("ACK_DATA_CLEAR_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("ACK_DATA_CLEAR_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ack_data_clear_ret_pack(m_packed,
+                                                                      sizeof(m_packed),
+                                                                      arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_ACK_DATA_CLEAR_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ack_data_clear_ret_unpack(m_expected,
+                                                                        (size_t)len,
+                                                                        &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void ack_data_remove_all_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        uint8_t        arg1             = (uint8_t)rand_get();
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        uint8_t        arg1_interpreter = 0;
+        uint8_t        arg1_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_ACK_DATA_REMOVE_ALL,
+                                   arg0,
+                                   arg1);
+        codec_len = nrf_802154_spinel_codec_ack_data_remove_all_pack(m_packed,
+                                                                     sizeof(m_packed),
+                                                                     arg0,
+                                                                     arg1);
+
+        CHECK("ACK_DATA_REMOVE_ALL pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_ack_data_remove_all_pack(m_packed,
+                                                                         (size_t)len - 1U,
+                                                                         arg0,
+                                                                         arg1);
+
+            CHECK("ACK_DATA_REMOVE_ALL pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_ACK_DATA_REMOVE_ALL,
+                                                                    &arg0_interpreter,
+                                                                    &arg1_interpreter);
+            codec_len = nrf_802154_spinel_codec_ack_data_remove_all_unpack(m_expected,
+                                                                           cut,
+                                                                           &arg0_codec,
+                                                                           &arg1_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("ACK_DATA_REMOVE_ALL unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("ACK_DATA_REMOVE_ALL unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  (arg1_codec == arg1_interpreter) &&
+                  (arg1_codec == arg1));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_ACK_DATA_REMOVE_ALL,
+                                           arg0,
+                                           arg1);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ack_data_remove_all_pack(m_packed,
+                                                                       sizeof(m_packed),
+                                                                       arg0,
+                                                                       arg1);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_ACK_DATA_REMOVE_ALL,
+                                             &arg0_interpreter,
+                                             &arg1_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ack_data_remove_all_unpack(m_expected,
+                                                                         (size_t)len,
+                                                                         &arg0_codec,
+                                                                         &arg1_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void ack_data_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        size_t          arg0_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        size_t          arg1_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg2                 = (uint8_t)rand_get();
+        uint8_t         arg0_data[TEST_DATA_MAX_LEN];
+        uint8_t         arg1_data[TEST_DATA_MAX_LEN];
+        const uint8_t * p_arg0_interpreter   = NULL;
+        const void    * p_arg0_codec         = NULL;
+        unsigned int    arg0_len_interpreter = 0U;
+        size_t          arg0_len_codec       = 0U;
+        const uint8_t * p_arg1_interpreter   = NULL;
+        const void    * p_arg1_codec         = NULL;
+        unsigned int    arg1_len_interpreter = 0U;
+        size_t          arg1_len_codec       = 0U;
+        uint8_t         arg2_interpreter     = 0;
+        uint8_t         arg2_codec           = 0;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg0_data, arg0_len);
+        data_fill(arg1_data, arg1_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET,
+                                   arg0_data,
+                                   (unsigned int)arg0_len,
+                                   arg1_data,
+                                   (unsigned int)arg1_len,
+                                   arg2);
+        codec_len = nrf_802154_spinel_codec_ack_data_set_pack(m_packed,
+                                                              sizeof(m_packed),
+                                                              arg0_data,
+                                                              arg0_len,
+                                                              arg1_data,
+                                                              arg1_len,
+                                                              arg2);
+
+        CHECK("ACK_DATA_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_ack_data_set_pack(m_packed,
+                                                                  (size_t)len - 1U,
+                                                                  arg0_data,
+                                                                  arg0_len,
+                                                                  arg1_data,
+                                                                  arg1_len,
+                                                                  arg2);
+
+            CHECK("ACK_DATA_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET,
+                                                                    &p_arg0_interpreter,
+                                                                    &arg0_len_interpreter,
+                                                                    &p_arg1_interpreter,
+                                                                    &arg1_len_interpreter,
+                                                                    &arg2_interpreter);
+            codec_len = nrf_802154_spinel_codec_ack_data_set_unpack(m_expected,
+                                                                    cut,
+                                                                    &p_arg0_codec,
+                                                                    &arg0_len_codec,
+                                                                    &p_arg1_codec,
+                                                                    &arg1_len_codec,
+                                                                    &arg2_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("ACK_DATA_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("ACK_DATA_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  ((const void *)p_arg0_interpreter == p_arg0_codec) &&
+                  (arg0_len_interpreter == arg0_len_codec) &&
+                  ((const void *)p_arg1_interpreter == p_arg1_codec) &&
+                  (arg1_len_interpreter == arg1_len_codec) &&
+                  (arg2_codec == arg2_interpreter) &&
+                  (arg2_codec == arg2));
+        }
+
+        CHECK("ACK_DATA_SET unpacked data",
+              (arg0_len_codec == arg0_len) &&
+              (memcmp(p_arg0_codec, arg0_data, arg0_len) == 0));
+        CHECK("ACK_DATA_SET unpacked data",
+              (arg1_len_codec == arg1_len) &&
+              (memcmp(p_arg1_codec, arg1_data, arg1_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET,
+                                           arg0_data,
+                                           (unsigned int)arg0_len,
+                                           arg1_data,
+                                           (unsigned int)arg1_len,
+                                           arg2);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ack_data_set_pack(m_packed,
+                                                                sizeof(m_packed),
+                                                                arg0_data,
+                                                                arg0_len,
+                                                                arg1_data,
+                                                                arg1_len,
+                                                                arg2);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET,
+                                             &p_arg0_interpreter,
+                                             &arg0_len_interpreter,
+                                             &p_arg1_interpreter,
+                                             &arg1_len_interpreter,
+                                             &arg2_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ack_data_set_unpack(m_expected,
+                                                                  (size_t)len,
+                                                                  &p_arg0_codec,
+                                                                  &arg0_len_codec,
+                                                                  &p_arg1_codec,
+                                                                  &arg1_len_codec,
+                                                                  &arg2_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void ack_data_set_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_ack_data_set_ret_pack(m_packed,
+                                                                  sizeof(m_packed),
+                                                                  arg0);
+
+        CHECK("ACK_DATA_SET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_ack_data_set_ret_pack(m_packed,
+                                                                      (size_t)len - 1U,
+                                                                      arg0);
+
+            CHECK("ACK_DATA_SET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_ack_data_set_ret_unpack(m_expected,
+                                                                        cut,
+                                                                        &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("ACK_DATA_SET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("ACK_DATA_SET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ack_data_set_ret_pack(m_packed,
+                                                                    sizeof(m_packed),
+                                                                    arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_ACK_DATA_SET_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ack_data_set_ret_unpack(m_expected,
+                                                                      (size_t)len,
+                                                                      &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void auto_pending_bit_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_AUTO_PENDING_BIT_SET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_auto_pending_bit_set_pack(m_packed,
+                                                                      sizeof(m_packed),
+                                                                      arg0);
+
+        CHECK("AUTO_PENDING_BIT_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_auto_pending_bit_set_pack(m_packed,
+                                                                          (size_t)len - 1U,
+                                                                          arg0);
+
+            CHECK("AUTO_PENDING_BIT_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_AUTO_PENDING_BIT_SET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_auto_pending_bit_set_unpack(m_expected,
+                                                                            cut,
+                                                                            &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("AUTO_PENDING_BIT_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("AUTO_PENDING_BIT_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_AUTO_PENDING_BIT_SET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_auto_pending_bit_set_pack(m_packed,
+                                                                        sizeof(m_packed),
+                                                                        arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_AUTO_PENDING_BIT_SET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_auto_pending_bit_set_unpack(m_expected,
+                                                                          (size_t)len,
+                                                                          &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void buffer_free_raw_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint32_t       arg0             = (uint32_t)rand_get();
+        uint32_t       arg0_interpreter = 0;
+        uint32_t       arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_buffer_free_raw_pack(m_packed,
+                                                                 sizeof(m_packed),
+                                                                 arg0);
+
+        CHECK("BUFFER_FREE_RAW pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_buffer_free_raw_pack(m_packed,
+                                                                     (size_t)len - 1U,
+                                                                     arg0);
+
+            CHECK("BUFFER_FREE_RAW pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_buffer_free_raw_unpack(m_expected,
+                                                                       cut,
+                                                                       &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("BUFFER_FREE_RAW unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("BUFFER_FREE_RAW unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_buffer_free_raw_pack(m_packed,
+                                                                   sizeof(m_packed),
+                                                                   arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_BUFFER_FREE_RAW,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_buffer_free_raw_unpack(m_expected,
+                                                                     (size_t)len,
+                                                                     &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void capabilities_get_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("CAPABILITIES_GET pack",
+          (nrf_802154_spinel_codec_capabilities_get_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_CAPABILITIES_GET) == 0));
+    CHECK("CAPABILITIES_GET unpack", nrf_802154_spinel_codec_capabilities_get_unpack(m_expected, 0U) == 0);
+}
+
+static void capabilities_get_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint32_t       arg0             = (uint32_t)rand_get();
+        uint32_t       arg0_interpreter = 0;
+        uint32_t       arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CAPABILITIES_GET_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_capabilities_get_ret_pack(m_packed,
+                                                                      sizeof(m_packed),
+                                                                      arg0);
+
+        CHECK("CAPABILITIES_GET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_capabilities_get_ret_pack(m_packed,
+                                                                          (size_t)len - 1U,
+                                                                          arg0);
+
+            CHECK("CAPABILITIES_GET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CAPABILITIES_GET_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_capabilities_get_ret_unpack(m_expected,
+                                                                            cut,
+                                                                            &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CAPABILITIES_GET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CAPABILITIES_GET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CAPABILITIES_GET_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_capabilities_get_ret_pack(m_packed,
+                                                                        sizeof(m_packed),
+                                                                        arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CAPABILITIES_GET_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_capabilities_get_ret_unpack(m_expected,
+                                                                          (size_t)len,
+                                                                          &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void cca_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("CCA pack",
+          (nrf_802154_spinel_codec_cca_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_CCA) == 0));
+    CHECK("CCA unpack", nrf_802154_spinel_codec_cca_unpack(m_expected, 0U) == 0);
+}
+
+static void cca_cfg_get_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("CCA_CFG_GET pack",
+          (nrf_802154_spinel_codec_cca_cfg_get_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_CCA_CFG_GET) == 0));
+    CHECK("CCA_CFG_GET unpack", nrf_802154_spinel_codec_cca_cfg_get_unpack(m_expected, 0U) == 0);
+}
+
+static void cca_cfg_get_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg1             = (uint8_t)rand_get();
+        uint8_t        arg2             = (uint8_t)rand_get();
+        uint8_t        arg3             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        uint8_t        arg1_interpreter = 0;
+        uint8_t        arg1_codec       = 0;
+        uint8_t        arg2_interpreter = 0;
+        uint8_t        arg2_codec       = 0;
+        uint8_t        arg3_interpreter = 0;
+        uint8_t        arg3_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CCA_CFG_GET_RET,
+                                   arg0,
+                                   arg1,
+                                   arg2,
+                                   arg3);
+        codec_len = nrf_802154_spinel_codec_cca_cfg_get_ret_pack(m_packed,
+                                                                 sizeof(m_packed),
+                                                                 arg0,
+                                                                 arg1,
+                                                                 arg2,
+                                                                 arg3);
+
+        CHECK("CCA_CFG_GET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_cca_cfg_get_ret_pack(m_packed,
+                                                                     (size_t)len - 1U,
+                                                                     arg0,
+                                                                     arg1,
+                                                                     arg2,
+                                                                     arg3);
+
+            CHECK("CCA_CFG_GET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CCA_CFG_GET_RET,
+                                                                    &arg0_interpreter,
+                                                                    &arg1_interpreter,
+                                                                    &arg2_interpreter,
+                                                                    &arg3_interpreter);
+            codec_len = nrf_802154_spinel_codec_cca_cfg_get_ret_unpack(m_expected,
+                                                                       cut,
+                                                                       &arg0_codec,
+                                                                       &arg1_codec,
+                                                                       &arg2_codec,
+                                                                       &arg3_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CCA_CFG_GET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CCA_CFG_GET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  (arg1_codec == arg1_interpreter) &&
+                  (arg1_codec == arg1) &&
+                  (arg2_codec == arg2_interpreter) &&
+                  (arg2_codec == arg2) &&
+                  (arg3_codec == arg3_interpreter) &&
+                  (arg3_codec == arg3));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CCA_CFG_GET_RET,
+                                           arg0,
+                                           arg1,
+                                           arg2,
+                                           arg3);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_cca_cfg_get_ret_pack(m_packed,
+                                                                   sizeof(m_packed),
+                                                                   arg0,
+                                                                   arg1,
+                                                                   arg2,
+                                                                   arg3);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CCA_CFG_GET_RET,
+                                             &arg0_interpreter,
+                                             &arg1_interpreter,
+                                             &arg2_interpreter,
+                                             &arg3_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_cca_cfg_get_ret_unpack(m_expected,
+                                                                     (size_t)len,
+                                                                     &arg0_codec,
+                                                                     &arg1_codec,
+                                                                     &arg2_codec,
+                                                                     &arg3_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void cca_cfg_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg1             = (uint8_t)rand_get();
+        uint8_t        arg2             = (uint8_t)rand_get();
+        uint8_t        arg3             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        uint8_t        arg1_interpreter = 0;
+        uint8_t        arg1_codec       = 0;
+        uint8_t        arg2_interpreter = 0;
+        uint8_t        arg2_codec       = 0;
+        uint8_t        arg3_interpreter = 0;
+        uint8_t        arg3_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CCA_CFG_SET,
+                                   arg0,
+                                   arg1,
+                                   arg2,
+                                   arg3);
+        codec_len = nrf_802154_spinel_codec_cca_cfg_set_pack(m_packed,
+                                                             sizeof(m_packed),
+                                                             arg0,
+                                                             arg1,
+                                                             arg2,
+                                                             arg3);
+
+        CHECK("CCA_CFG_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_cca_cfg_set_pack(m_packed,
+                                                                 (size_t)len - 1U,
+                                                                 arg0,
+                                                                 arg1,
+                                                                 arg2,
+                                                                 arg3);
+
+            CHECK("CCA_CFG_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CCA_CFG_SET,
+                                                                    &arg0_interpreter,
+                                                                    &arg1_interpreter,
+                                                                    &arg2_interpreter,
+                                                                    &arg3_interpreter);
+            codec_len = nrf_802154_spinel_codec_cca_cfg_set_unpack(m_expected,
+                                                                   cut,
+                                                                   &arg0_codec,
+                                                                   &arg1_codec,
+                                                                   &arg2_codec,
+                                                                   &arg3_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CCA_CFG_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CCA_CFG_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  (arg1_codec == arg1_interpreter) &&
+                  (arg1_codec == arg1) &&
+                  (arg2_codec == arg2_interpreter) &&
+                  (arg2_codec == arg2) &&
+                  (arg3_codec == arg3_interpreter) &&
+                  (arg3_codec == arg3));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CCA_CFG_SET,
+                                           arg0,
+                                           arg1,
+                                           arg2,
+                                           arg3);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_cca_cfg_set_pack(m_packed,
+                                                               sizeof(m_packed),
+                                                               arg0,
+                                                               arg1,
+                                                               arg2,
+                                                               arg3);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CCA_CFG_SET,
+                                             &arg0_interpreter,
+                                             &arg1_interpreter,
+                                             &arg2_interpreter,
+                                             &arg3_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_cca_cfg_set_unpack(m_expected,
+                                                                 (size_t)len,
+                                                                 &arg0_codec,
+                                                                 &arg1_codec,
+                                                                 &arg2_codec,
+                                                                 &arg3_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void cca_done_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CCA_DONE,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_cca_done_pack(m_packed,
+                                                          sizeof(m_packed),
+                                                          arg0);
+
+        CHECK("CCA_DONE pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_cca_done_pack(m_packed,
+                                                              (size_t)len - 1U,
+                                                              arg0);
+
+            CHECK("CCA_DONE pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CCA_DONE,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_cca_done_unpack(m_expected,
+                                                                cut,
+                                                                &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CCA_DONE unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CCA_DONE unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CCA_DONE,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_cca_done_pack(m_packed,
+                                                            sizeof(m_packed),
+                                                            arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CCA_DONE,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_cca_done_unpack(m_expected,
+                                                              (size_t)len,
+                                                              &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void cca_failed_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CCA_FAILED,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_cca_failed_pack(m_packed,
+                                                            sizeof(m_packed),
+                                                            arg0);
+
+        CHECK("CCA_FAILED pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_cca_failed_pack(m_packed,
+                                                                (size_t)len - 1U,
+                                                                arg0);
+
+            CHECK("CCA_FAILED pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CCA_FAILED,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_cca_failed_unpack(m_expected,
+                                                                  cut,
+                                                                  &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CCA_FAILED unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CCA_FAILED unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CCA_FAILED,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_cca_failed_pack(m_packed,
+                                                              sizeof(m_packed),
+                                                              arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CCA_FAILED,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_cca_failed_unpack(m_expected,
+                                                                (size_t)len,
+                                                                &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void cca_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CCA_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_cca_ret_pack(m_packed,
+                                                         sizeof(m_packed),
+                                                         arg0);
+
+        CHECK("CCA_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_cca_ret_pack(m_packed,
+                                                             (size_t)len - 1U,
+                                                             arg0);
+
+            CHECK("CCA_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CCA_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_cca_ret_unpack(m_expected,
+                                                               cut,
+                                                               &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CCA_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CCA_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CCA_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_cca_ret_pack(m_packed,
+                                                           sizeof(m_packed),
+                                                           arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CCA_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_cca_ret_unpack(m_expected,
+                                                             (size_t)len,
+                                                             &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void channel_get_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("CHANNEL_GET pack",
+          (nrf_802154_spinel_codec_channel_get_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_CHANNEL_GET) == 0));
+    CHECK("CHANNEL_GET unpack", nrf_802154_spinel_codec_channel_get_unpack(m_expected, 0U) == 0);
+}
+
+static void channel_get_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CHANNEL_GET_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_channel_get_ret_pack(m_packed,
+                                                                 sizeof(m_packed),
+                                                                 arg0);
+
+        CHECK("CHANNEL_GET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_channel_get_ret_pack(m_packed,
+                                                                     (size_t)len - 1U,
+                                                                     arg0);
+
+            CHECK("CHANNEL_GET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CHANNEL_GET_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_channel_get_ret_unpack(m_expected,
+                                                                       cut,
+                                                                       &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CHANNEL_GET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CHANNEL_GET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CHANNEL_GET_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_channel_get_ret_pack(m_packed,
+                                                                   sizeof(m_packed),
+                                                                   arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CHANNEL_GET_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_channel_get_ret_unpack(m_expected,
+                                                                     (size_t)len,
+                                                                     &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void channel_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CHANNEL_SET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_channel_set_pack(m_packed,
+                                                             sizeof(m_packed),
+                                                             arg0);
+
+        CHECK("CHANNEL_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_channel_set_pack(m_packed,
+                                                                 (size_t)len - 1U,
+                                                                 arg0);
+
+            CHECK("CHANNEL_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CHANNEL_SET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_channel_set_unpack(m_expected,
+                                                                   cut,
+                                                                   &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CHANNEL_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CHANNEL_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CHANNEL_SET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_channel_set_pack(m_packed,
+                                                               sizeof(m_packed),
+                                                               arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CHANNEL_SET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_channel_set_unpack(m_expected,
+                                                                 (size_t)len,
+                                                                 &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void continuous_carrier_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("CONTINUOUS_CARRIER pack",
+          (nrf_802154_spinel_codec_continuous_carrier_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_CONTINUOUS_CARRIER) == 0));
+    CHECK("CONTINUOUS_CARRIER unpack", nrf_802154_spinel_codec_continuous_carrier_unpack(m_expected, 0U) == 0);
+}
+
+static void continuous_carrier_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CONTINUOUS_CARRIER_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_continuous_carrier_ret_pack(m_packed,
+                                                                        sizeof(m_packed),
+                                                                        arg0);
+
+        CHECK("CONTINUOUS_CARRIER_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_continuous_carrier_ret_pack(m_packed,
+                                                                            (size_t)len - 1U,
+                                                                            arg0);
+
+            CHECK("CONTINUOUS_CARRIER_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CONTINUOUS_CARRIER_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_continuous_carrier_ret_unpack(m_expected,
+                                                                              cut,
+                                                                              &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CONTINUOUS_CARRIER_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CONTINUOUS_CARRIER_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CONTINUOUS_CARRIER_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_continuous_carrier_ret_pack(m_packed,
+                                                                          sizeof(m_packed),
+                                                                          arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CONTINUOUS_CARRIER_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_continuous_carrier_ret_unpack(m_expected,
+                                                                            (size_t)len,
+                                                                            &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void csl_writer_anchor_time_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint64_t       arg0             = (uint64_t)rand64_get();
+        uint64_t       arg0_interpreter = 0;
+        uint64_t       arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CSL_WRITER_ANCHOR_TIME_SET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_csl_writer_anchor_time_set_pack(m_packed,
+                                                                            sizeof(m_packed),
+                                                                            arg0);
+
+        CHECK("CSL_WRITER_ANCHOR_TIME_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_csl_writer_anchor_time_set_pack(m_packed,
+                                                                                (size_t)len - 1U,
+                                                                                arg0);
+
+            CHECK("CSL_WRITER_ANCHOR_TIME_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CSL_WRITER_ANCHOR_TIME_SET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_csl_writer_anchor_time_set_unpack(m_expected,
+                                                                                  cut,
+                                                                                  &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CSL_WRITER_ANCHOR_TIME_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CSL_WRITER_ANCHOR_TIME_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CSL_WRITER_ANCHOR_TIME_SET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csl_writer_anchor_time_set_pack(m_packed,
+                                                                              sizeof(m_packed),
+                                                                              arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CSL_WRITER_ANCHOR_TIME_SET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csl_writer_anchor_time_set_unpack(m_expected,
+                                                                                (size_t)len,
+                                                                                &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void csl_writer_period_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint16_t       arg0             = (uint16_t)rand_get();
+        uint16_t       arg0_interpreter = 0;
+        uint16_t       arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CSL_WRITER_PERIOD_SET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_csl_writer_period_set_pack(m_packed,
+                                                                       sizeof(m_packed),
+                                                                       arg0);
+
+        CHECK("CSL_WRITER_PERIOD_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_csl_writer_period_set_pack(m_packed,
+                                                                           (size_t)len - 1U,
+                                                                           arg0);
+
+            CHECK("CSL_WRITER_PERIOD_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CSL_WRITER_PERIOD_SET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_csl_writer_period_set_unpack(m_expected,
+                                                                             cut,
+                                                                             &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CSL_WRITER_PERIOD_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CSL_WRITER_PERIOD_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CSL_WRITER_PERIOD_SET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csl_writer_period_set_pack(m_packed,
+                                                                         sizeof(m_packed),
+                                                                         arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CSL_WRITER_PERIOD_SET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csl_writer_period_set_unpack(m_expected,
+                                                                           (size_t)len,
+                                                                           &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void csma_ca_backoff_policy_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_csma_ca_backoff_policy_set_pack(m_packed,
+                                                                            sizeof(m_packed),
+                                                                            arg0);
+
+        CHECK("CSMA_CA_BACKOFF_POLICY_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_csma_ca_backoff_policy_set_pack(m_packed,
+                                                                                (size_t)len - 1U,
+                                                                                arg0);
+
+            CHECK("CSMA_CA_BACKOFF_POLICY_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_csma_ca_backoff_policy_set_unpack(m_expected,
+                                                                                  cut,
+                                                                                  &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CSMA_CA_BACKOFF_POLICY_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CSMA_CA_BACKOFF_POLICY_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_backoff_policy_set_pack(m_packed,
+                                                                              sizeof(m_packed),
+                                                                              arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_backoff_policy_set_unpack(m_expected,
+                                                                                (size_t)len,
+                                                                                &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void csma_ca_backoff_policy_set_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_csma_ca_backoff_policy_set_ret_pack(m_packed,
+                                                                                sizeof(m_packed),
+                                                                                arg0);
+
+        CHECK("CSMA_CA_BACKOFF_POLICY_SET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_csma_ca_backoff_policy_set_ret_pack(m_packed,
+                                                                                    (size_t)len - 1U,
+                                                                                    arg0);
+
+            CHECK("CSMA_CA_BACKOFF_POLICY_SET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_csma_ca_backoff_policy_set_ret_unpack(m_expected,
+                                                                                      cut,
+                                                                                      &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CSMA_CA_BACKOFF_POLICY_SET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CSMA_CA_BACKOFF_POLICY_SET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_backoff_policy_set_ret_pack(m_packed,
+                                                                                  sizeof(m_packed),
+                                                                                  arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CSMA_CA_BACKOFF_POLICY_SET_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_backoff_policy_set_ret_unpack(m_expected,
+                                                                                    (size_t)len,
+                                                                                    &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void csma_ca_max_backoffs_get_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("CSMA_CA_MAX_BACKOFFS_GET pack",
+          (nrf_802154_spinel_codec_csma_ca_max_backoffs_get_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET) == 0));
+    CHECK("CSMA_CA_MAX_BACKOFFS_GET unpack", nrf_802154_spinel_codec_csma_ca_max_backoffs_get_unpack(m_expected, 0U) == 0);
+}
+
+static void csma_ca_max_backoffs_get_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_csma_ca_max_backoffs_get_ret_pack(m_packed,
+                                                                              sizeof(m_packed),
+                                                                              arg0);
+
+        CHECK("CSMA_CA_MAX_BACKOFFS_GET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_csma_ca_max_backoffs_get_ret_pack(m_packed,
+                                                                                  (size_t)len - 1U,
+                                                                                  arg0);
+
+            CHECK("CSMA_CA_MAX_BACKOFFS_GET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_csma_ca_max_backoffs_get_ret_unpack(m_expected,
+                                                                                    cut,
+                                                                                    &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CSMA_CA_MAX_BACKOFFS_GET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CSMA_CA_MAX_BACKOFFS_GET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_max_backoffs_get_ret_pack(m_packed,
+                                                                                sizeof(m_packed),
+                                                                                arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_GET_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_max_backoffs_get_ret_unpack(m_expected,
+                                                                                  (size_t)len,
+                                                                                  &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void csma_ca_max_backoffs_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_csma_ca_max_backoffs_set_pack(m_packed,
+                                                                          sizeof(m_packed),
+                                                                          arg0);
+
+        CHECK("CSMA_CA_MAX_BACKOFFS_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_csma_ca_max_backoffs_set_pack(m_packed,
+                                                                              (size_t)len - 1U,
+                                                                              arg0);
+
+            CHECK("CSMA_CA_MAX_BACKOFFS_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_csma_ca_max_backoffs_set_unpack(m_expected,
+                                                                                cut,
+                                                                                &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CSMA_CA_MAX_BACKOFFS_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CSMA_CA_MAX_BACKOFFS_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_max_backoffs_set_pack(m_packed,
+                                                                            sizeof(m_packed),
+                                                                            arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BACKOFFS_SET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_max_backoffs_set_unpack(m_expected,
+                                                                              (size_t)len,
+                                                                              &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void csma_ca_max_be_get_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("CSMA_CA_MAX_BE_GET pack",
+          (nrf_802154_spinel_codec_csma_ca_max_be_get_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_GET) == 0));
+    CHECK("CSMA_CA_MAX_BE_GET unpack", nrf_802154_spinel_codec_csma_ca_max_be_get_unpack(m_expected, 0U) == 0);
+}
+
+static void csma_ca_max_be_get_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_GET_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_csma_ca_max_be_get_ret_pack(m_packed,
+                                                                        sizeof(m_packed),
+                                                                        arg0);
+
+        CHECK("CSMA_CA_MAX_BE_GET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_csma_ca_max_be_get_ret_pack(m_packed,
+                                                                            (size_t)len - 1U,
+                                                                            arg0);
+
+            CHECK("CSMA_CA_MAX_BE_GET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_GET_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_csma_ca_max_be_get_ret_unpack(m_expected,
+                                                                              cut,
+                                                                              &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CSMA_CA_MAX_BE_GET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CSMA_CA_MAX_BE_GET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_GET_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_max_be_get_ret_pack(m_packed,
+                                                                          sizeof(m_packed),
+                                                                          arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_GET_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_max_be_get_ret_unpack(m_expected,
+                                                                            (size_t)len,
+                                                                            &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void csma_ca_max_be_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_csma_ca_max_be_set_pack(m_packed,
+                                                                    sizeof(m_packed),
+                                                                    arg0);
+
+        CHECK("CSMA_CA_MAX_BE_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_csma_ca_max_be_set_pack(m_packed,
+                                                                        (size_t)len - 1U,
+                                                                        arg0);
+
+            CHECK("CSMA_CA_MAX_BE_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_csma_ca_max_be_set_unpack(m_expected,
+                                                                          cut,
+                                                                          &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CSMA_CA_MAX_BE_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CSMA_CA_MAX_BE_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_max_be_set_pack(m_packed,
+                                                                      sizeof(m_packed),
+                                                                      arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_max_be_set_unpack(m_expected,
+                                                                        (size_t)len,
+                                                                        &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void csma_ca_max_be_set_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_csma_ca_max_be_set_ret_pack(m_packed,
+                                                                        sizeof(m_packed),
+                                                                        arg0);
+
+        CHECK("CSMA_CA_MAX_BE_SET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_csma_ca_max_be_set_ret_pack(m_packed,
+                                                                            (size_t)len - 1U,
+                                                                            arg0);
+
+            CHECK("CSMA_CA_MAX_BE_SET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_csma_ca_max_be_set_ret_unpack(m_expected,
+                                                                              cut,
+                                                                              &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CSMA_CA_MAX_BE_SET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CSMA_CA_MAX_BE_SET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_max_be_set_ret_pack(m_packed,
+                                                                          sizeof(m_packed),
+                                                                          arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CSMA_CA_MAX_BE_SET_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_max_be_set_ret_unpack(m_expected,
+                                                                            (size_t)len,
+                                                                            &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void csma_ca_min_be_get_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("CSMA_CA_MIN_BE_GET pack",
+          (nrf_802154_spinel_codec_csma_ca_min_be_get_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_GET) == 0));
+    CHECK("CSMA_CA_MIN_BE_GET unpack", nrf_802154_spinel_codec_csma_ca_min_be_get_unpack(m_expected, 0U) == 0);
+}
+
+static void csma_ca_min_be_get_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_GET_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_csma_ca_min_be_get_ret_pack(m_packed,
+                                                                        sizeof(m_packed),
+                                                                        arg0);
+
+        CHECK("CSMA_CA_MIN_BE_GET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_csma_ca_min_be_get_ret_pack(m_packed,
+                                                                            (size_t)len - 1U,
+                                                                            arg0);
+
+            CHECK("CSMA_CA_MIN_BE_GET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_GET_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_csma_ca_min_be_get_ret_unpack(m_expected,
+                                                                              cut,
+                                                                              &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CSMA_CA_MIN_BE_GET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CSMA_CA_MIN_BE_GET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_GET_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_min_be_get_ret_pack(m_packed,
+                                                                          sizeof(m_packed),
+                                                                          arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_GET_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_min_be_get_ret_unpack(m_expected,
+                                                                            (size_t)len,
+                                                                            &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void csma_ca_min_be_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_csma_ca_min_be_set_pack(m_packed,
+                                                                    sizeof(m_packed),
+                                                                    arg0);
+
+        CHECK("CSMA_CA_MIN_BE_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_csma_ca_min_be_set_pack(m_packed,
+                                                                        (size_t)len - 1U,
+                                                                        arg0);
+
+            CHECK("CSMA_CA_MIN_BE_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_csma_ca_min_be_set_unpack(m_expected,
+                                                                          cut,
+                                                                          &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CSMA_CA_MIN_BE_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CSMA_CA_MIN_BE_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_min_be_set_pack(m_packed,
+                                                                      sizeof(m_packed),
+                                                                      arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_min_be_set_unpack(m_expected,
+                                                                        (size_t)len,
+                                                                        &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void csma_ca_min_be_set_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_csma_ca_min_be_set_ret_pack(m_packed,
+                                                                        sizeof(m_packed),
+                                                                        arg0);
+
+        CHECK("CSMA_CA_MIN_BE_SET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_csma_ca_min_be_set_ret_pack(m_packed,
+                                                                            (size_t)len - 1U,
+                                                                            arg0);
+
+            CHECK("CSMA_CA_MIN_BE_SET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_csma_ca_min_be_set_ret_unpack(m_expected,
+                                                                              cut,
+                                                                              &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("CSMA_CA_MIN_BE_SET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("CSMA_CA_MIN_BE_SET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_min_be_set_ret_pack(m_packed,
+                                                                          sizeof(m_packed),
+                                                                          arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_CSMA_CA_MIN_BE_SET_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_csma_ca_min_be_set_ret_unpack(m_expected,
+                                                                            (size_t)len,
+                                                                            &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void energy_detected_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        int8_t         arg0             = (int8_t)rand_get();
+        int8_t         arg0_interpreter = 0;
+        int8_t         arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_energy_detected_pack(m_packed,
+                                                                 sizeof(m_packed),
+                                                                 arg0);
+
+        CHECK("ENERGY_DETECTED pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_energy_detected_pack(m_packed,
+                                                                     (size_t)len - 1U,
+                                                                     arg0);
+
+            CHECK("ENERGY_DETECTED pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_energy_detected_unpack(m_expected,
+                                                                       cut,
+                                                                       &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("ENERGY_DETECTED unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("ENERGY_DETECTED unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_energy_detected_pack(m_packed,
+                                                                   sizeof(m_packed),
+                                                                   arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_energy_detected_unpack(m_expected,
+                                                                     (size_t)len,
+                                                                     &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void energy_detected_sweep_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        int8_t         arg0             = (int8_t)rand_get();
+        uint32_t       arg1             = (uint32_t)rand_get();
+        int8_t         arg0_interpreter = 0;
+        int8_t         arg0_codec       = 0;
+        uint32_t       arg1_interpreter = 0;
+        uint32_t       arg1_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED_SWEEP,
+                                   arg0,
+                                   arg1);
+        codec_len = nrf_802154_spinel_codec_energy_detected_sweep_pack(m_packed,
+                                                                       sizeof(m_packed),
+                                                                       arg0,
+                                                                       arg1);
+
+        CHECK("ENERGY_DETECTED_SWEEP pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_energy_detected_sweep_pack(m_packed,
+                                                                           (size_t)len - 1U,
+                                                                           arg0,
+                                                                           arg1);
+
+            CHECK("ENERGY_DETECTED_SWEEP pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED_SWEEP,
+                                                                    &arg0_interpreter,
+                                                                    &arg1_interpreter);
+            codec_len = nrf_802154_spinel_codec_energy_detected_sweep_unpack(m_expected,
+                                                                             cut,
+                                                                             &arg0_codec,
+                                                                             &arg1_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("ENERGY_DETECTED_SWEEP unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("ENERGY_DETECTED_SWEEP unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  (arg1_codec == arg1_interpreter) &&
+                  (arg1_codec == arg1));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED_SWEEP,
+                                           arg0,
+                                           arg1);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_energy_detected_sweep_pack(m_packed,
+                                                                         sizeof(m_packed),
+                                                                         arg0,
+                                                                         arg1);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTED_SWEEP,
+                                             &arg0_interpreter,
+                                             &arg1_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_energy_detected_sweep_unpack(m_expected,
+                                                                           (size_t)len,
+                                                                           &arg0_codec,
+                                                                           &arg1_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void energy_detection_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint32_t       arg0             = (uint32_t)rand_get();
+        uint32_t       arg0_interpreter = 0;
+        uint32_t       arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_energy_detection_pack(m_packed,
+                                                                  sizeof(m_packed),
+                                                                  arg0);
+
+        CHECK("ENERGY_DETECTION pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_energy_detection_pack(m_packed,
+                                                                      (size_t)len - 1U,
+                                                                      arg0);
+
+            CHECK("ENERGY_DETECTION pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_energy_detection_unpack(m_expected,
+                                                                        cut,
+                                                                        &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("ENERGY_DETECTION unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("ENERGY_DETECTION unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_energy_detection_pack(m_packed,
+                                                                    sizeof(m_packed),
+                                                                    arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_energy_detection_unpack(m_expected,
+                                                                      (size_t)len,
+                                                                      &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void energy_detection_failed_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_FAILED,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_energy_detection_failed_pack(m_packed,
+                                                                         sizeof(m_packed),
+                                                                         arg0);
+
+        CHECK("ENERGY_DETECTION_FAILED pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_energy_detection_failed_pack(m_packed,
+                                                                             (size_t)len - 1U,
+                                                                             arg0);
+
+            CHECK("ENERGY_DETECTION_FAILED pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_FAILED,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_energy_detection_failed_unpack(m_expected,
+                                                                               cut,
+                                                                               &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("ENERGY_DETECTION_FAILED unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("ENERGY_DETECTION_FAILED unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_FAILED,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_energy_detection_failed_pack(m_packed,
+                                                                           sizeof(m_packed),
+                                                                           arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_FAILED,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_energy_detection_failed_unpack(m_expected,
+                                                                             (size_t)len,
+                                                                             &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void energy_detection_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_energy_detection_ret_pack(m_packed,
+                                                                      sizeof(m_packed),
+                                                                      arg0);
+
+        CHECK("ENERGY_DETECTION_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_energy_detection_ret_pack(m_packed,
+                                                                          (size_t)len - 1U,
+                                                                          arg0);
+
+            CHECK("ENERGY_DETECTION_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_energy_detection_ret_unpack(m_expected,
+                                                                            cut,
+                                                                            &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("ENERGY_DETECTION_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("ENERGY_DETECTION_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_energy_detection_ret_pack(m_packed,
+                                                                        sizeof(m_packed),
+                                                                        arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_energy_detection_ret_unpack(m_expected,
+                                                                          (size_t)len,
+                                                                          &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void energy_detection_sweep_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint32_t       arg0             = (uint32_t)rand_get();
+        uint32_t       arg1             = (uint32_t)rand_get();
+        uint16_t       arg2             = (uint16_t)rand_get();
+        uint32_t       arg0_interpreter = 0;
+        uint32_t       arg0_codec       = 0;
+        uint32_t       arg1_interpreter = 0;
+        uint32_t       arg1_codec       = 0;
+        uint16_t       arg2_interpreter = 0;
+        uint16_t       arg2_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP,
+                                   arg0,
+                                   arg1,
+                                   arg2);
+        codec_len = nrf_802154_spinel_codec_energy_detection_sweep_pack(m_packed,
+                                                                        sizeof(m_packed),
+                                                                        arg0,
+                                                                        arg1,
+                                                                        arg2);
+
+        CHECK("ENERGY_DETECTION_SWEEP pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_energy_detection_sweep_pack(m_packed,
+                                                                            (size_t)len - 1U,
+                                                                            arg0,
+                                                                            arg1,
+                                                                            arg2);
+
+            CHECK("ENERGY_DETECTION_SWEEP pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP,
+                                                                    &arg0_interpreter,
+                                                                    &arg1_interpreter,
+                                                                    &arg2_interpreter);
+            codec_len = nrf_802154_spinel_codec_energy_detection_sweep_unpack(m_expected,
+                                                                              cut,
+                                                                              &arg0_codec,
+                                                                              &arg1_codec,
+                                                                              &arg2_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("ENERGY_DETECTION_SWEEP unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("ENERGY_DETECTION_SWEEP unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  (arg1_codec == arg1_interpreter) &&
+                  (arg1_codec == arg1) &&
+                  (arg2_codec == arg2_interpreter) &&
+                  (arg2_codec == arg2));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP,
+                                           arg0,
+                                           arg1,
+                                           arg2);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_energy_detection_sweep_pack(m_packed,
+                                                                          sizeof(m_packed),
+                                                                          arg0,
+                                                                          arg1,
+                                                                          arg2);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP,
+                                             &arg0_interpreter,
+                                             &arg1_interpreter,
+                                             &arg2_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_energy_detection_sweep_unpack(m_expected,
+                                                                            (size_t)len,
+                                                                            &arg0_codec,
+                                                                            &arg1_codec,
+                                                                            &arg2_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void energy_detection_sweep_channel_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t         arg0                 = (uint8_t)rand_get();
+        uint16_t        arg1                 = (uint16_t)rand_get();
+        int8_t          arg2                 = (int8_t)rand_get();
+        int8_t          arg3                 = (int8_t)rand_get();
+        int8_t          arg4                 = (int8_t)rand_get();
+        size_t          arg5_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg5_data[TEST_DATA_MAX_LEN];
+        uint8_t         arg0_interpreter     = 0;
+        uint8_t         arg0_codec           = 0;
+        uint16_t        arg1_interpreter     = 0;
+        uint16_t        arg1_codec           = 0;
+        int8_t          arg2_interpreter     = 0;
+        int8_t          arg2_codec           = 0;
+        int8_t          arg3_interpreter     = 0;
+        int8_t          arg3_codec           = 0;
+        int8_t          arg4_interpreter     = 0;
+        int8_t          arg4_codec           = 0;
+        const uint8_t * p_arg5_interpreter   = NULL;
+        const void    * p_arg5_codec         = NULL;
+        unsigned int    arg5_len_interpreter = 0U;
+        size_t          arg5_len_codec       = 0U;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg5_data, arg5_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP_CHANNEL,
+                                   arg0,
+                                   arg1,
+                                   arg2,
+                                   arg3,
+                                   arg4,
+                                   arg5_data,
+                                   (unsigned int)arg5_len);
+        codec_len = nrf_802154_spinel_codec_energy_detection_sweep_channel_pack(m_packed,
+                                                                                sizeof(m_packed),
+                                                                                arg0,
+                                                                                arg1,
+                                                                                arg2,
+                                                                                arg3,
+                                                                                arg4,
+                                                                                arg5_data,
+                                                                                arg5_len);
+
+        CHECK("ENERGY_DETECTION_SWEEP_CHANNEL pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_energy_detection_sweep_channel_pack(m_packed,
+                                                                                    (size_t)len - 1U,
+                                                                                    arg0,
+                                                                                    arg1,
+                                                                                    arg2,
+                                                                                    arg3,
+                                                                                    arg4,
+                                                                                    arg5_data,
+                                                                                    arg5_len);
+
+            CHECK("ENERGY_DETECTION_SWEEP_CHANNEL pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP_CHANNEL,
+                                                                    &arg0_interpreter,
+                                                                    &arg1_interpreter,
+                                                                    &arg2_interpreter,
+                                                                    &arg3_interpreter,
+                                                                    &arg4_interpreter,
+                                                                    &p_arg5_interpreter,
+                                                                    &arg5_len_interpreter);
+            codec_len = nrf_802154_spinel_codec_energy_detection_sweep_channel_unpack(m_expected,
+                                                                                      cut,
+                                                                                      &arg0_codec,
+                                                                                      &arg1_codec,
+                                                                                      &arg2_codec,
+                                                                                      &arg3_codec,
+                                                                                      &arg4_codec,
+                                                                                      &p_arg5_codec,
+                                                                                      &arg5_len_codec);
+
+            // The last data field is not prefixed, so it can be cut short
+            if ((cut < (size_t)len) && (codec_len < 0))
+            {
+                CHECK("ENERGY_DETECTION_SWEEP_CHANNEL unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("ENERGY_DETECTION_SWEEP_CHANNEL unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  (arg1_codec == arg1_interpreter) &&
+                  (arg1_codec == arg1) &&
+                  (arg2_codec == arg2_interpreter) &&
+                  (arg2_codec == arg2) &&
+                  (arg3_codec == arg3_interpreter) &&
+                  (arg3_codec == arg3) &&
+                  (arg4_codec == arg4_interpreter) &&
+                  (arg4_codec == arg4) &&
+                  ((const void *)p_arg5_interpreter == p_arg5_codec) &&
+                  (arg5_len_interpreter == arg5_len_codec));
+        }
+
+        CHECK("ENERGY_DETECTION_SWEEP_CHANNEL unpacked data",
+              (arg5_len_codec == arg5_len) &&
+              (memcmp(p_arg5_codec, arg5_data, arg5_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP_CHANNEL,
+                                           arg0,
+                                           arg1,
+                                           arg2,
+                                           arg3,
+                                           arg4,
+                                           arg5_data,
+                                           (unsigned int)arg5_len);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_energy_detection_sweep_channel_pack(m_packed,
+                                                                                  sizeof(m_packed),
+                                                                                  arg0,
+                                                                                  arg1,
+                                                                                  arg2,
+                                                                                  arg3,
+                                                                                  arg4,
+                                                                                  arg5_data,
+                                                                                  arg5_len);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP_CHANNEL,
+                                             &arg0_interpreter,
+                                             &arg1_interpreter,
+                                             &arg2_interpreter,
+                                             &arg3_interpreter,
+                                             &arg4_interpreter,
+                                             &p_arg5_interpreter,
+                                             &arg5_len_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_energy_detection_sweep_channel_unpack(m_expected,
+                                                                                    (size_t)len,
+                                                                                    &arg0_codec,
+                                                                                    &arg1_codec,
+                                                                                    &arg2_codec,
+                                                                                    &arg3_codec,
+                                                                                    &arg4_codec,
+                                                                                    &p_arg5_codec,
+                                                                                    &arg5_len_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void energy_detection_sweep_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_energy_detection_sweep_ret_pack(m_packed,
+                                                                            sizeof(m_packed),
+                                                                            arg0);
+
+        CHECK("ENERGY_DETECTION_SWEEP_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_energy_detection_sweep_ret_pack(m_packed,
+                                                                                (size_t)len - 1U,
+                                                                                arg0);
+
+            CHECK("ENERGY_DETECTION_SWEEP_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_energy_detection_sweep_ret_unpack(m_expected,
+                                                                                  cut,
+                                                                                  &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("ENERGY_DETECTION_SWEEP_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("ENERGY_DETECTION_SWEEP_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_energy_detection_sweep_ret_pack(m_packed,
+                                                                              sizeof(m_packed),
+                                                                              arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_ENERGY_DETECTION_SWEEP_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_energy_detection_sweep_ret_unpack(m_expected,
+                                                                                (size_t)len,
+                                                                                &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void extended_address_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        size_t          arg0_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg0_data[TEST_DATA_MAX_LEN];
+        const uint8_t * p_arg0_interpreter   = NULL;
+        const void    * p_arg0_codec         = NULL;
+        unsigned int    arg0_len_interpreter = 0U;
+        size_t          arg0_len_codec       = 0U;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg0_data, arg0_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_EXTENDED_ADDRESS_SET,
+                                   arg0_data,
+                                   (unsigned int)arg0_len);
+        codec_len = nrf_802154_spinel_codec_extended_address_set_pack(m_packed,
+                                                                      sizeof(m_packed),
+                                                                      arg0_data,
+                                                                      arg0_len);
+
+        CHECK("EXTENDED_ADDRESS_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_extended_address_set_pack(m_packed,
+                                                                          (size_t)len - 1U,
+                                                                          arg0_data,
+                                                                          arg0_len);
+
+            CHECK("EXTENDED_ADDRESS_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_EXTENDED_ADDRESS_SET,
+                                                                    &p_arg0_interpreter,
+                                                                    &arg0_len_interpreter);
+            codec_len = nrf_802154_spinel_codec_extended_address_set_unpack(m_expected,
+                                                                            cut,
+                                                                            &p_arg0_codec,
+                                                                            &arg0_len_codec);
+
+            // The last data field is not prefixed, so it can be cut short
+            if ((cut < (size_t)len) && (codec_len < 0))
+            {
+                CHECK("EXTENDED_ADDRESS_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("EXTENDED_ADDRESS_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  ((const void *)p_arg0_interpreter == p_arg0_codec) &&
+                  (arg0_len_interpreter == arg0_len_codec));
+        }
+
+        CHECK("EXTENDED_ADDRESS_SET unpacked data",
+              (arg0_len_codec == arg0_len) &&
+              (memcmp(p_arg0_codec, arg0_data, arg0_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_EXTENDED_ADDRESS_SET,
+                                           arg0_data,
+                                           (unsigned int)arg0_len);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_extended_address_set_pack(m_packed,
+                                                                        sizeof(m_packed),
+                                                                        arg0_data,
+                                                                        arg0_len);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_EXTENDED_ADDRESS_SET,
+                                             &p_arg0_interpreter,
+                                             &arg0_len_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_extended_address_set_unpack(m_expected,
+                                                                          (size_t)len,
+                                                                          &p_arg0_codec,
+                                                                          &arg0_len_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void ifs_min_lifs_period_get_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("IFS_MIN_LIFS_PERIOD_GET pack",
+          (nrf_802154_spinel_codec_ifs_min_lifs_period_get_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_GET) == 0));
+    CHECK("IFS_MIN_LIFS_PERIOD_GET unpack", nrf_802154_spinel_codec_ifs_min_lifs_period_get_unpack(m_expected, 0U) == 0);
+}
+
+static void ifs_min_lifs_period_get_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint16_t       arg0             = (uint16_t)rand_get();
+        uint16_t       arg0_interpreter = 0;
+        uint16_t       arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_GET_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_ifs_min_lifs_period_get_ret_pack(m_packed,
+                                                                             sizeof(m_packed),
+                                                                             arg0);
+
+        CHECK("IFS_MIN_LIFS_PERIOD_GET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_ifs_min_lifs_period_get_ret_pack(m_packed,
+                                                                                 (size_t)len - 1U,
+                                                                                 arg0);
+
+            CHECK("IFS_MIN_LIFS_PERIOD_GET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_GET_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_ifs_min_lifs_period_get_ret_unpack(m_expected,
+                                                                                   cut,
+                                                                                   &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("IFS_MIN_LIFS_PERIOD_GET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("IFS_MIN_LIFS_PERIOD_GET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_GET_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ifs_min_lifs_period_get_ret_pack(m_packed,
+                                                                               sizeof(m_packed),
+                                                                               arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_GET_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ifs_min_lifs_period_get_ret_unpack(m_expected,
+                                                                                 (size_t)len,
+                                                                                 &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void ifs_min_lifs_period_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint16_t       arg0             = (uint16_t)rand_get();
+        uint16_t       arg0_interpreter = 0;
+        uint16_t       arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_SET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_ifs_min_lifs_period_set_pack(m_packed,
+                                                                         sizeof(m_packed),
+                                                                         arg0);
+
+        CHECK("IFS_MIN_LIFS_PERIOD_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_ifs_min_lifs_period_set_pack(m_packed,
+                                                                             (size_t)len - 1U,
+                                                                             arg0);
+
+            CHECK("IFS_MIN_LIFS_PERIOD_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_SET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_ifs_min_lifs_period_set_unpack(m_expected,
+                                                                               cut,
+                                                                               &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("IFS_MIN_LIFS_PERIOD_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("IFS_MIN_LIFS_PERIOD_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_SET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ifs_min_lifs_period_set_pack(m_packed,
+                                                                           sizeof(m_packed),
+                                                                           arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_IFS_MIN_LIFS_PERIOD_SET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ifs_min_lifs_period_set_unpack(m_expected,
+                                                                             (size_t)len,
+                                                                             &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void ifs_min_sifs_period_get_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("IFS_MIN_SIFS_PERIOD_GET pack",
+          (nrf_802154_spinel_codec_ifs_min_sifs_period_get_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_GET) == 0));
+    CHECK("IFS_MIN_SIFS_PERIOD_GET unpack", nrf_802154_spinel_codec_ifs_min_sifs_period_get_unpack(m_expected, 0U) == 0);
+}
+
+static void ifs_min_sifs_period_get_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint16_t       arg0             = (uint16_t)rand_get();
+        uint16_t       arg0_interpreter = 0;
+        uint16_t       arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_GET_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_ifs_min_sifs_period_get_ret_pack(m_packed,
+                                                                             sizeof(m_packed),
+                                                                             arg0);
+
+        CHECK("IFS_MIN_SIFS_PERIOD_GET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_ifs_min_sifs_period_get_ret_pack(m_packed,
+                                                                                 (size_t)len - 1U,
+                                                                                 arg0);
+
+            CHECK("IFS_MIN_SIFS_PERIOD_GET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_GET_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_ifs_min_sifs_period_get_ret_unpack(m_expected,
+                                                                                   cut,
+                                                                                   &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("IFS_MIN_SIFS_PERIOD_GET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("IFS_MIN_SIFS_PERIOD_GET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_GET_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ifs_min_sifs_period_get_ret_pack(m_packed,
+                                                                               sizeof(m_packed),
+                                                                               arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_GET_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ifs_min_sifs_period_get_ret_unpack(m_expected,
+                                                                                 (size_t)len,
+                                                                                 &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void ifs_min_sifs_period_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint16_t       arg0             = (uint16_t)rand_get();
+        uint16_t       arg0_interpreter = 0;
+        uint16_t       arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_SET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_ifs_min_sifs_period_set_pack(m_packed,
+                                                                         sizeof(m_packed),
+                                                                         arg0);
+
+        CHECK("IFS_MIN_SIFS_PERIOD_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_ifs_min_sifs_period_set_pack(m_packed,
+                                                                             (size_t)len - 1U,
+                                                                             arg0);
+
+            CHECK("IFS_MIN_SIFS_PERIOD_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_SET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_ifs_min_sifs_period_set_unpack(m_expected,
+                                                                               cut,
+                                                                               &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("IFS_MIN_SIFS_PERIOD_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("IFS_MIN_SIFS_PERIOD_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_SET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ifs_min_sifs_period_set_pack(m_packed,
+                                                                           sizeof(m_packed),
+                                                                           arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_IFS_MIN_SIFS_PERIOD_SET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ifs_min_sifs_period_set_unpack(m_expected,
+                                                                             (size_t)len,
+                                                                             &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void ifs_mode_get_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("IFS_MODE_GET pack",
+          (nrf_802154_spinel_codec_ifs_mode_get_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_IFS_MODE_GET) == 0));
+    CHECK("IFS_MODE_GET unpack", nrf_802154_spinel_codec_ifs_mode_get_unpack(m_expected, 0U) == 0);
+}
+
+static void ifs_mode_get_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_IFS_MODE_GET_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_ifs_mode_get_ret_pack(m_packed,
+                                                                  sizeof(m_packed),
+                                                                  arg0);
+
+        CHECK("IFS_MODE_GET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_ifs_mode_get_ret_pack(m_packed,
+                                                                      (size_t)len - 1U,
+                                                                      arg0);
+
+            CHECK("IFS_MODE_GET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_IFS_MODE_GET_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_ifs_mode_get_ret_unpack(m_expected,
+                                                                        cut,
+                                                                        &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("IFS_MODE_GET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("IFS_MODE_GET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_IFS_MODE_GET_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ifs_mode_get_ret_pack(m_packed,
+                                                                    sizeof(m_packed),
+                                                                    arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_IFS_MODE_GET_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ifs_mode_get_ret_unpack(m_expected,
+                                                                      (size_t)len,
+                                                                      &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void ifs_mode_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_ifs_mode_set_pack(m_packed,
+                                                              sizeof(m_packed),
+                                                              arg0);
+
+        CHECK("IFS_MODE_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_ifs_mode_set_pack(m_packed,
+                                                                  (size_t)len - 1U,
+                                                                  arg0);
+
+            CHECK("IFS_MODE_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_ifs_mode_set_unpack(m_expected,
+                                                                    cut,
+                                                                    &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("IFS_MODE_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("IFS_MODE_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ifs_mode_set_pack(m_packed,
+                                                                sizeof(m_packed),
+                                                                arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ifs_mode_set_unpack(m_expected,
+                                                                  (size_t)len,
+                                                                  &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void ifs_mode_set_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_ifs_mode_set_ret_pack(m_packed,
+                                                                  sizeof(m_packed),
+                                                                  arg0);
+
+        CHECK("IFS_MODE_SET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_ifs_mode_set_ret_pack(m_packed,
+                                                                      (size_t)len - 1U,
+                                                                      arg0);
+
+            CHECK("IFS_MODE_SET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_ifs_mode_set_ret_unpack(m_expected,
+                                                                        cut,
+                                                                        &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("IFS_MODE_SET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("IFS_MODE_SET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ifs_mode_set_ret_pack(m_packed,
+                                                                    sizeof(m_packed),
+                                                                    arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_IFS_MODE_SET_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_ifs_mode_set_ret_unpack(m_expected,
+                                                                      (size_t)len,
+                                                                      &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void modulated_carrier_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        size_t          arg0_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg0_data[TEST_DATA_MAX_LEN];
+        const uint8_t * p_arg0_interpreter   = NULL;
+        const void    * p_arg0_codec         = NULL;
+        unsigned int    arg0_len_interpreter = 0U;
+        size_t          arg0_len_codec       = 0U;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg0_data, arg0_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_MODULATED_CARRIER,
+                                   arg0_data,
+                                   (unsigned int)arg0_len);
+        codec_len = nrf_802154_spinel_codec_modulated_carrier_pack(m_packed,
+                                                                   sizeof(m_packed),
+                                                                   arg0_data,
+                                                                   arg0_len);
+
+        CHECK("MODULATED_CARRIER pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_modulated_carrier_pack(m_packed,
+                                                                       (size_t)len - 1U,
+                                                                       arg0_data,
+                                                                       arg0_len);
+
+            CHECK("MODULATED_CARRIER pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_MODULATED_CARRIER,
+                                                                    &p_arg0_interpreter,
+                                                                    &arg0_len_interpreter);
+            codec_len = nrf_802154_spinel_codec_modulated_carrier_unpack(m_expected,
+                                                                         cut,
+                                                                         &p_arg0_codec,
+                                                                         &arg0_len_codec);
+
+            // The last data field is not prefixed, so it can be cut short
+            if ((cut < (size_t)len) && (codec_len < 0))
+            {
+                CHECK("MODULATED_CARRIER unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("MODULATED_CARRIER unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  ((const void *)p_arg0_interpreter == p_arg0_codec) &&
+                  (arg0_len_interpreter == arg0_len_codec));
+        }
+
+        CHECK("MODULATED_CARRIER unpacked data",
+              (arg0_len_codec == arg0_len) &&
+              (memcmp(p_arg0_codec, arg0_data, arg0_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_MODULATED_CARRIER,
+                                           arg0_data,
+                                           (unsigned int)arg0_len);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_modulated_carrier_pack(m_packed,
+                                                                     sizeof(m_packed),
+                                                                     arg0_data,
+                                                                     arg0_len);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_MODULATED_CARRIER,
+                                             &p_arg0_interpreter,
+                                             &arg0_len_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_modulated_carrier_unpack(m_expected,
+                                                                       (size_t)len,
+                                                                       &p_arg0_codec,
+                                                                       &arg0_len_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void modulated_carrier_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_MODULATED_CARRIER_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_modulated_carrier_ret_pack(m_packed,
+                                                                       sizeof(m_packed),
+                                                                       arg0);
+
+        CHECK("MODULATED_CARRIER_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_modulated_carrier_ret_pack(m_packed,
+                                                                           (size_t)len - 1U,
+                                                                           arg0);
+
+            CHECK("MODULATED_CARRIER_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_MODULATED_CARRIER_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_modulated_carrier_ret_unpack(m_expected,
+                                                                             cut,
+                                                                             &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("MODULATED_CARRIER_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("MODULATED_CARRIER_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_MODULATED_CARRIER_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_modulated_carrier_ret_pack(m_packed,
+                                                                         sizeof(m_packed),
+                                                                         arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_MODULATED_CARRIER_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_modulated_carrier_ret_unpack(m_expected,
+                                                                           (size_t)len,
+                                                                           &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void pan_coord_get_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("PAN_COORD_GET pack",
+          (nrf_802154_spinel_codec_pan_coord_get_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_PAN_COORD_GET) == 0));
+    CHECK("PAN_COORD_GET unpack", nrf_802154_spinel_codec_pan_coord_get_unpack(m_expected, 0U) == 0);
+}
+
+static void pan_coord_get_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_PAN_COORD_GET_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_pan_coord_get_ret_pack(m_packed,
+                                                                   sizeof(m_packed),
+                                                                   arg0);
+
+        CHECK("PAN_COORD_GET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_pan_coord_get_ret_pack(m_packed,
+                                                                       (size_t)len - 1U,
+                                                                       arg0);
+
+            CHECK("PAN_COORD_GET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_PAN_COORD_GET_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_pan_coord_get_ret_unpack(m_expected,
+                                                                         cut,
+                                                                         &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("PAN_COORD_GET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("PAN_COORD_GET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_PAN_COORD_GET_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_pan_coord_get_ret_pack(m_packed,
+                                                                     sizeof(m_packed),
+                                                                     arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_PAN_COORD_GET_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_pan_coord_get_ret_unpack(m_expected,
+                                                                       (size_t)len,
+                                                                       &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void pan_coord_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_PAN_COORD_SET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_pan_coord_set_pack(m_packed,
+                                                               sizeof(m_packed),
+                                                               arg0);
+
+        CHECK("PAN_COORD_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_pan_coord_set_pack(m_packed,
+                                                                   (size_t)len - 1U,
+                                                                   arg0);
+
+            CHECK("PAN_COORD_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_PAN_COORD_SET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_pan_coord_set_unpack(m_expected,
+                                                                     cut,
+                                                                     &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("PAN_COORD_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("PAN_COORD_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_PAN_COORD_SET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_pan_coord_set_pack(m_packed,
+                                                                 sizeof(m_packed),
+                                                                 arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_PAN_COORD_SET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_pan_coord_set_unpack(m_expected,
+                                                                   (size_t)len,
+                                                                   &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void pan_id_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        size_t          arg0_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg0_data[TEST_DATA_MAX_LEN];
+        const uint8_t * p_arg0_interpreter   = NULL;
+        const void    * p_arg0_codec         = NULL;
+        unsigned int    arg0_len_interpreter = 0U;
+        size_t          arg0_len_codec       = 0U;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg0_data, arg0_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_PAN_ID_SET,
+                                   arg0_data,
+                                   (unsigned int)arg0_len);
+        codec_len = nrf_802154_spinel_codec_pan_id_set_pack(m_packed,
+                                                            sizeof(m_packed),
+                                                            arg0_data,
+                                                            arg0_len);
+
+        CHECK("PAN_ID_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_pan_id_set_pack(m_packed,
+                                                                (size_t)len - 1U,
+                                                                arg0_data,
+                                                                arg0_len);
+
+            CHECK("PAN_ID_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_PAN_ID_SET,
+                                                                    &p_arg0_interpreter,
+                                                                    &arg0_len_interpreter);
+            codec_len = nrf_802154_spinel_codec_pan_id_set_unpack(m_expected,
+                                                                  cut,
+                                                                  &p_arg0_codec,
+                                                                  &arg0_len_codec);
+
+            // The last data field is not prefixed, so it can be cut short
+            if ((cut < (size_t)len) && (codec_len < 0))
+            {
+                CHECK("PAN_ID_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("PAN_ID_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  ((const void *)p_arg0_interpreter == p_arg0_codec) &&
+                  (arg0_len_interpreter == arg0_len_codec));
+        }
+
+        CHECK("PAN_ID_SET unpacked data",
+              (arg0_len_codec == arg0_len) &&
+              (memcmp(p_arg0_codec, arg0_data, arg0_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_PAN_ID_SET,
+                                           arg0_data,
+                                           (unsigned int)arg0_len);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_pan_id_set_pack(m_packed,
+                                                              sizeof(m_packed),
+                                                              arg0_data,
+                                                              arg0_len);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_PAN_ID_SET,
+                                             &p_arg0_interpreter,
+                                             &arg0_len_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_pan_id_set_unpack(m_expected,
+                                                                (size_t)len,
+                                                                &p_arg0_codec,
+                                                                &arg0_len_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void pending_bit_for_addr_clear_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        size_t          arg0_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg0_data[TEST_DATA_MAX_LEN];
+        const uint8_t * p_arg0_interpreter   = NULL;
+        const void    * p_arg0_codec         = NULL;
+        unsigned int    arg0_len_interpreter = 0U;
+        size_t          arg0_len_codec       = 0U;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg0_data, arg0_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR,
+                                   arg0_data,
+                                   (unsigned int)arg0_len);
+        codec_len = nrf_802154_spinel_codec_pending_bit_for_addr_clear_pack(m_packed,
+                                                                            sizeof(m_packed),
+                                                                            arg0_data,
+                                                                            arg0_len);
+
+        CHECK("PENDING_BIT_FOR_ADDR_CLEAR pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_pending_bit_for_addr_clear_pack(m_packed,
+                                                                                (size_t)len - 1U,
+                                                                                arg0_data,
+                                                                                arg0_len);
+
+            CHECK("PENDING_BIT_FOR_ADDR_CLEAR pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR,
+                                                                    &p_arg0_interpreter,
+                                                                    &arg0_len_interpreter);
+            codec_len = nrf_802154_spinel_codec_pending_bit_for_addr_clear_unpack(m_expected,
+                                                                                  cut,
+                                                                                  &p_arg0_codec,
+                                                                                  &arg0_len_codec);
+
+            // The last data field is not prefixed, so it can be cut short
+            if ((cut < (size_t)len) && (codec_len < 0))
+            {
+                CHECK("PENDING_BIT_FOR_ADDR_CLEAR unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("PENDING_BIT_FOR_ADDR_CLEAR unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  ((const void *)p_arg0_interpreter == p_arg0_codec) &&
+                  (arg0_len_interpreter == arg0_len_codec));
+        }
+
+        CHECK("PENDING_BIT_FOR_ADDR_CLEAR unpacked data",
+              (arg0_len_codec == arg0_len) &&
+              (memcmp(p_arg0_codec, arg0_data, arg0_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR,
+                                           arg0_data,
+                                           (unsigned int)arg0_len);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_pending_bit_for_addr_clear_pack(m_packed,
+                                                                              sizeof(m_packed),
+                                                                              arg0_data,
+                                                                              arg0_len);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR,
+                                             &p_arg0_interpreter,
+                                             &arg0_len_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_pending_bit_for_addr_clear_unpack(m_expected,
+                                                                                (size_t)len,
+                                                                                &p_arg0_codec,
+                                                                                &arg0_len_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void pending_bit_for_addr_clear_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_pending_bit_for_addr_clear_ret_pack(m_packed,
+                                                                                sizeof(m_packed),
+                                                                                arg0);
+
+        CHECK("PENDING_BIT_FOR_ADDR_CLEAR_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_pending_bit_for_addr_clear_ret_pack(m_packed,
+                                                                                    (size_t)len - 1U,
+                                                                                    arg0);
+
+            CHECK("PENDING_BIT_FOR_ADDR_CLEAR_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_pending_bit_for_addr_clear_ret_unpack(m_expected,
+                                                                                      cut,
+                                                                                      &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("PENDING_BIT_FOR_ADDR_CLEAR_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("PENDING_BIT_FOR_ADDR_CLEAR_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_pending_bit_for_addr_clear_ret_pack(m_packed,
+                                                                                  sizeof(m_packed),
+                                                                                  arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_CLEAR_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_pending_bit_for_addr_clear_ret_unpack(m_expected,
+                                                                                    (size_t)len,
+                                                                                    &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void pending_bit_for_addr_reset_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_RESET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_pending_bit_for_addr_reset_pack(m_packed,
+                                                                            sizeof(m_packed),
+                                                                            arg0);
+
+        CHECK("PENDING_BIT_FOR_ADDR_RESET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_pending_bit_for_addr_reset_pack(m_packed,
+                                                                                (size_t)len - 1U,
+                                                                                arg0);
+
+            CHECK("PENDING_BIT_FOR_ADDR_RESET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_RESET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_pending_bit_for_addr_reset_unpack(m_expected,
+                                                                                  cut,
+                                                                                  &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("PENDING_BIT_FOR_ADDR_RESET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("PENDING_BIT_FOR_ADDR_RESET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_RESET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_pending_bit_for_addr_reset_pack(m_packed,
+                                                                              sizeof(m_packed),
+                                                                              arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_RESET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_pending_bit_for_addr_reset_unpack(m_expected,
+                                                                                (size_t)len,
+                                                                                &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void pending_bit_for_addr_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        size_t          arg0_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg0_data[TEST_DATA_MAX_LEN];
+        const uint8_t * p_arg0_interpreter   = NULL;
+        const void    * p_arg0_codec         = NULL;
+        unsigned int    arg0_len_interpreter = 0U;
+        size_t          arg0_len_codec       = 0U;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg0_data, arg0_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET,
+                                   arg0_data,
+                                   (unsigned int)arg0_len);
+        codec_len = nrf_802154_spinel_codec_pending_bit_for_addr_set_pack(m_packed,
+                                                                          sizeof(m_packed),
+                                                                          arg0_data,
+                                                                          arg0_len);
+
+        CHECK("PENDING_BIT_FOR_ADDR_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_pending_bit_for_addr_set_pack(m_packed,
+                                                                              (size_t)len - 1U,
+                                                                              arg0_data,
+                                                                              arg0_len);
+
+            CHECK("PENDING_BIT_FOR_ADDR_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET,
+                                                                    &p_arg0_interpreter,
+                                                                    &arg0_len_interpreter);
+            codec_len = nrf_802154_spinel_codec_pending_bit_for_addr_set_unpack(m_expected,
+                                                                                cut,
+                                                                                &p_arg0_codec,
+                                                                                &arg0_len_codec);
+
+            // The last data field is not prefixed, so it can be cut short
+            if ((cut < (size_t)len) && (codec_len < 0))
+            {
+                CHECK("PENDING_BIT_FOR_ADDR_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("PENDING_BIT_FOR_ADDR_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  ((const void *)p_arg0_interpreter == p_arg0_codec) &&
+                  (arg0_len_interpreter == arg0_len_codec));
+        }
+
+        CHECK("PENDING_BIT_FOR_ADDR_SET unpacked data",
+              (arg0_len_codec == arg0_len) &&
+              (memcmp(p_arg0_codec, arg0_data, arg0_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET,
+                                           arg0_data,
+                                           (unsigned int)arg0_len);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_pending_bit_for_addr_set_pack(m_packed,
+                                                                            sizeof(m_packed),
+                                                                            arg0_data,
+                                                                            arg0_len);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET,
+                                             &p_arg0_interpreter,
+                                             &arg0_len_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_pending_bit_for_addr_set_unpack(m_expected,
+                                                                              (size_t)len,
+                                                                              &p_arg0_codec,
+                                                                              &arg0_len_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void pending_bit_for_addr_set_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_pending_bit_for_addr_set_ret_pack(m_packed,
+                                                                              sizeof(m_packed),
+                                                                              arg0);
+
+        CHECK("PENDING_BIT_FOR_ADDR_SET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_pending_bit_for_addr_set_ret_pack(m_packed,
+                                                                                  (size_t)len - 1U,
+                                                                                  arg0);
+
+            CHECK("PENDING_BIT_FOR_ADDR_SET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_pending_bit_for_addr_set_ret_unpack(m_expected,
+                                                                                    cut,
+                                                                                    &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("PENDING_BIT_FOR_ADDR_SET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("PENDING_BIT_FOR_ADDR_SET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_pending_bit_for_addr_set_ret_pack(m_packed,
+                                                                                sizeof(m_packed),
+                                                                                arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_PENDING_BIT_FOR_ADDR_SET_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_pending_bit_for_addr_set_ret_unpack(m_expected,
+                                                                                  (size_t)len,
+                                                                                  &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void promiscuous_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_PROMISCUOUS_SET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_promiscuous_set_pack(m_packed,
+                                                                 sizeof(m_packed),
+                                                                 arg0);
+
+        CHECK("PROMISCUOUS_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_promiscuous_set_pack(m_packed,
+                                                                     (size_t)len - 1U,
+                                                                     arg0);
+
+            CHECK("PROMISCUOUS_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_PROMISCUOUS_SET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_promiscuous_set_unpack(m_expected,
+                                                                       cut,
+                                                                       &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("PROMISCUOUS_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("PROMISCUOUS_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_PROMISCUOUS_SET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_promiscuous_set_pack(m_packed,
+                                                                   sizeof(m_packed),
+                                                                   arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_PROMISCUOUS_SET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_promiscuous_set_unpack(m_expected,
+                                                                     (size_t)len,
+                                                                     &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void receive_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("RECEIVE pack",
+          (nrf_802154_spinel_codec_receive_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_RECEIVE) == 0));
+    CHECK("RECEIVE unpack", nrf_802154_spinel_codec_receive_unpack(m_expected, 0U) == 0);
+}
+
+static void received_timestamp_raw_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint32_t        arg0                 = (uint32_t)rand_get();
+        size_t          arg1_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        int8_t          arg2                 = (int8_t)rand_get();
+        uint8_t         arg3                 = (uint8_t)rand_get();
+        uint64_t        arg4                 = (uint64_t)rand64_get();
+        uint8_t         arg1_data[TEST_DATA_MAX_LEN];
+        uint32_t        arg0_interpreter     = 0;
+        uint32_t        arg0_codec           = 0;
+        const uint8_t * p_arg1_interpreter   = NULL;
+        const void    * p_arg1_codec         = NULL;
+        unsigned int    arg1_len_interpreter = 0U;
+        size_t          arg1_len_codec       = 0U;
+        int8_t          arg2_interpreter     = 0;
+        int8_t          arg2_codec           = 0;
+        uint8_t         arg3_interpreter     = 0;
+        uint8_t         arg3_codec           = 0;
+        uint64_t        arg4_interpreter     = 0;
+        uint64_t        arg4_codec           = 0;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg1_data, arg1_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW,
+                                   arg0,
+                                   arg1_data,
+                                   (unsigned int)arg1_len,
+                                   arg2,
+                                   arg3,
+                                   arg4);
+        codec_len = nrf_802154_spinel_codec_received_timestamp_raw_pack(m_packed,
+                                                                        sizeof(m_packed),
+                                                                        arg0,
+                                                                        arg1_data,
+                                                                        arg1_len,
+                                                                        arg2,
+                                                                        arg3,
+                                                                        arg4);
+
+        CHECK("RECEIVED_TIMESTAMP_RAW pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_received_timestamp_raw_pack(m_packed,
+                                                                            (size_t)len - 1U,
+                                                                            arg0,
+                                                                            arg1_data,
+                                                                            arg1_len,
+                                                                            arg2,
+                                                                            arg3,
+                                                                            arg4);
+
+            CHECK("RECEIVED_TIMESTAMP_RAW pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW,
+                                                                    &arg0_interpreter,
+                                                                    &p_arg1_interpreter,
+                                                                    &arg1_len_interpreter,
+                                                                    &arg2_interpreter,
+                                                                    &arg3_interpreter,
+                                                                    &arg4_interpreter);
+            codec_len = nrf_802154_spinel_codec_received_timestamp_raw_unpack(m_expected,
+                                                                              cut,
+                                                                              &arg0_codec,
+                                                                              &p_arg1_codec,
+                                                                              &arg1_len_codec,
+                                                                              &arg2_codec,
+                                                                              &arg3_codec,
+                                                                              &arg4_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("RECEIVED_TIMESTAMP_RAW unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("RECEIVED_TIMESTAMP_RAW unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  ((const void *)p_arg1_interpreter == p_arg1_codec) &&
+                  (arg1_len_interpreter == arg1_len_codec) &&
+                  (arg2_codec == arg2_interpreter) &&
+                  (arg2_codec == arg2) &&
+                  (arg3_codec == arg3_interpreter) &&
+                  (arg3_codec == arg3) &&
+                  (arg4_codec == arg4_interpreter) &&
+                  (arg4_codec == arg4));
+        }
+
+        CHECK("RECEIVED_TIMESTAMP_RAW unpacked data",
+              (arg1_len_codec == arg1_len) &&
+              (memcmp(p_arg1_codec, arg1_data, arg1_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW,
+                                           arg0,
+                                           arg1_data,
+                                           (unsigned int)arg1_len,
+                                           arg2,
+                                           arg3,
+                                           arg4);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_received_timestamp_raw_pack(m_packed,
+                                                                          sizeof(m_packed),
+                                                                          arg0,
+                                                                          arg1_data,
+                                                                          arg1_len,
+                                                                          arg2,
+                                                                          arg3,
+                                                                          arg4);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW,
+                                             &arg0_interpreter,
+                                             &p_arg1_interpreter,
+                                             &arg1_len_interpreter,
+                                             &arg2_interpreter,
+                                             &arg3_interpreter,
+                                             &arg4_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_received_timestamp_raw_unpack(m_expected,
+                                                                            (size_t)len,
+                                                                            &arg0_codec,
+                                                                            &p_arg1_codec,
+                                                                            &arg1_len_codec,
+                                                                            &arg2_codec,
+                                                                            &arg3_codec,
+                                                                            &arg4_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void received_timestamp_raw_batch_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t         arg0                 = (uint8_t)rand_get();
+        size_t          arg1_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg1_data[TEST_DATA_MAX_LEN];
+        uint8_t         arg0_interpreter     = 0;
+        uint8_t         arg0_codec           = 0;
+        const uint8_t * p_arg1_interpreter   = NULL;
+        const void    * p_arg1_codec         = NULL;
+        unsigned int    arg1_len_interpreter = 0U;
+        size_t          arg1_len_codec       = 0U;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg1_data, arg1_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH,
+                                   arg0,
+                                   arg1_data,
+                                   (unsigned int)arg1_len);
+        codec_len = nrf_802154_spinel_codec_received_timestamp_raw_batch_pack(m_packed,
+                                                                              sizeof(m_packed),
+                                                                              arg0,
+                                                                              arg1_data,
+                                                                              arg1_len);
+
+        CHECK("RECEIVED_TIMESTAMP_RAW_BATCH pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_received_timestamp_raw_batch_pack(m_packed,
+                                                                                  (size_t)len - 1U,
+                                                                                  arg0,
+                                                                                  arg1_data,
+                                                                                  arg1_len);
+
+            CHECK("RECEIVED_TIMESTAMP_RAW_BATCH pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH,
+                                                                    &arg0_interpreter,
+                                                                    &p_arg1_interpreter,
+                                                                    &arg1_len_interpreter);
+            codec_len = nrf_802154_spinel_codec_received_timestamp_raw_batch_unpack(m_expected,
+                                                                                    cut,
+                                                                                    &arg0_codec,
+                                                                                    &p_arg1_codec,
+                                                                                    &arg1_len_codec);
+
+            // The last data field is not prefixed, so it can be cut short
+            if ((cut < (size_t)len) && (codec_len < 0))
+            {
+                CHECK("RECEIVED_TIMESTAMP_RAW_BATCH unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("RECEIVED_TIMESTAMP_RAW_BATCH unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  ((const void *)p_arg1_interpreter == p_arg1_codec) &&
+                  (arg1_len_interpreter == arg1_len_codec));
+        }
+
+        CHECK("RECEIVED_TIMESTAMP_RAW_BATCH unpacked data",
+              (arg1_len_codec == arg1_len) &&
+              (memcmp(p_arg1_codec, arg1_data, arg1_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH,
+                                           arg0,
+                                           arg1_data,
+                                           (unsigned int)arg1_len);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_received_timestamp_raw_batch_pack(m_packed,
+                                                                                sizeof(m_packed),
+                                                                                arg0,
+                                                                                arg1_data,
+                                                                                arg1_len);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH,
+                                             &arg0_interpreter,
+                                             &p_arg1_interpreter,
+                                             &arg1_len_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_received_timestamp_raw_batch_unpack(m_expected,
+                                                                                  (size_t)len,
+                                                                                  &arg0_codec,
+                                                                                  &p_arg1_codec,
+                                                                                  &arg1_len_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void received_timestamp_raw_batch_entry_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint32_t        arg0                 = (uint32_t)rand_get();
+        size_t          arg1_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        int8_t          arg2                 = (int8_t)rand_get();
+        uint8_t         arg3                 = (uint8_t)rand_get();
+        uint64_t        arg4                 = (uint64_t)rand64_get();
+        uint8_t         arg1_data[TEST_DATA_MAX_LEN];
+        uint32_t        arg0_interpreter     = 0;
+        uint32_t        arg0_codec           = 0;
+        const uint8_t * p_arg1_interpreter   = NULL;
+        const void    * p_arg1_codec         = NULL;
+        unsigned int    arg1_len_interpreter = 0U;
+        size_t          arg1_len_codec       = 0U;
+        int8_t          arg2_interpreter     = 0;
+        int8_t          arg2_codec           = 0;
+        uint8_t         arg3_interpreter     = 0;
+        uint8_t         arg3_codec           = 0;
+        uint64_t        arg4_interpreter     = 0;
+        uint64_t        arg4_codec           = 0;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg1_data, arg1_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH_ENTRY,
+                                   arg0,
+                                   arg1_data,
+                                   (unsigned int)arg1_len,
+                                   arg2,
+                                   arg3,
+                                   arg4);
+        codec_len = nrf_802154_spinel_codec_received_timestamp_raw_batch_entry_pack(m_packed,
+                                                                                    sizeof(m_packed),
+                                                                                    arg0,
+                                                                                    arg1_data,
+                                                                                    arg1_len,
+                                                                                    arg2,
+                                                                                    arg3,
+                                                                                    arg4);
+
+        CHECK("RECEIVED_TIMESTAMP_RAW_BATCH_ENTRY pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_received_timestamp_raw_batch_entry_pack(m_packed,
+                                                                                        (size_t)len - 1U,
+                                                                                        arg0,
+                                                                                        arg1_data,
+                                                                                        arg1_len,
+                                                                                        arg2,
+                                                                                        arg3,
+                                                                                        arg4);
+
+            CHECK("RECEIVED_TIMESTAMP_RAW_BATCH_ENTRY pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH_ENTRY,
+                                                                    &arg0_interpreter,
+                                                                    &p_arg1_interpreter,
+                                                                    &arg1_len_interpreter,
+                                                                    &arg2_interpreter,
+                                                                    &arg3_interpreter,
+                                                                    &arg4_interpreter);
+            codec_len = nrf_802154_spinel_codec_received_timestamp_raw_batch_entry_unpack(m_expected,
+                                                                                          cut,
+                                                                                          &arg0_codec,
+                                                                                          &p_arg1_codec,
+                                                                                          &arg1_len_codec,
+                                                                                          &arg2_codec,
+                                                                                          &arg3_codec,
+                                                                                          &arg4_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("RECEIVED_TIMESTAMP_RAW_BATCH_ENTRY unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("RECEIVED_TIMESTAMP_RAW_BATCH_ENTRY unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  ((const void *)p_arg1_interpreter == p_arg1_codec) &&
+                  (arg1_len_interpreter == arg1_len_codec) &&
+                  (arg2_codec == arg2_interpreter) &&
+                  (arg2_codec == arg2) &&
+                  (arg3_codec == arg3_interpreter) &&
+                  (arg3_codec == arg3) &&
+                  (arg4_codec == arg4_interpreter) &&
+                  (arg4_codec == arg4));
+        }
+
+        CHECK("RECEIVED_TIMESTAMP_RAW_BATCH_ENTRY unpacked data",
+              (arg1_len_codec == arg1_len) &&
+              (memcmp(p_arg1_codec, arg1_data, arg1_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH_ENTRY,
+                                           arg0,
+                                           arg1_data,
+                                           (unsigned int)arg1_len,
+                                           arg2,
+                                           arg3,
+                                           arg4);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_received_timestamp_raw_batch_entry_pack(m_packed,
+                                                                                      sizeof(m_packed),
+                                                                                      arg0,
+                                                                                      arg1_data,
+                                                                                      arg1_len,
+                                                                                      arg2,
+                                                                                      arg3,
+                                                                                      arg4);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_RECEIVED_TIMESTAMP_RAW_BATCH_ENTRY,
+                                             &arg0_interpreter,
+                                             &p_arg1_interpreter,
+                                             &arg1_len_interpreter,
+                                             &arg2_interpreter,
+                                             &arg3_interpreter,
+                                             &arg4_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_received_timestamp_raw_batch_entry_unpack(m_expected,
+                                                                                        (size_t)len,
+                                                                                        &arg0_codec,
+                                                                                        &p_arg1_codec,
+                                                                                        &arg1_len_codec,
+                                                                                        &arg2_codec,
+                                                                                        &arg3_codec,
+                                                                                        &arg4_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void receive_at_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint64_t       arg0             = (uint64_t)rand64_get();
+        uint32_t       arg1             = (uint32_t)rand_get();
+        uint8_t        arg2             = (uint8_t)rand_get();
+        uint32_t       arg3             = (uint32_t)rand_get();
+        uint64_t       arg0_interpreter = 0;
+        uint64_t       arg0_codec       = 0;
+        uint32_t       arg1_interpreter = 0;
+        uint32_t       arg1_codec       = 0;
+        uint8_t        arg2_interpreter = 0;
+        uint8_t        arg2_codec       = 0;
+        uint32_t       arg3_interpreter = 0;
+        uint32_t       arg3_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_RECEIVE_AT,
+                                   arg0,
+                                   arg1,
+                                   arg2,
+                                   arg3);
+        codec_len = nrf_802154_spinel_codec_receive_at_pack(m_packed,
+                                                            sizeof(m_packed),
+                                                            arg0,
+                                                            arg1,
+                                                            arg2,
+                                                            arg3);
+
+        CHECK("RECEIVE_AT pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_receive_at_pack(m_packed,
+                                                                (size_t)len - 1U,
+                                                                arg0,
+                                                                arg1,
+                                                                arg2,
+                                                                arg3);
+
+            CHECK("RECEIVE_AT pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_RECEIVE_AT,
+                                                                    &arg0_interpreter,
+                                                                    &arg1_interpreter,
+                                                                    &arg2_interpreter,
+                                                                    &arg3_interpreter);
+            codec_len = nrf_802154_spinel_codec_receive_at_unpack(m_expected,
+                                                                  cut,
+                                                                  &arg0_codec,
+                                                                  &arg1_codec,
+                                                                  &arg2_codec,
+                                                                  &arg3_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("RECEIVE_AT unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("RECEIVE_AT unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  (arg1_codec == arg1_interpreter) &&
+                  (arg1_codec == arg1) &&
+                  (arg2_codec == arg2_interpreter) &&
+                  (arg2_codec == arg2) &&
+                  (arg3_codec == arg3_interpreter) &&
+                  (arg3_codec == arg3));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_RECEIVE_AT,
+                                           arg0,
+                                           arg1,
+                                           arg2,
+                                           arg3);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_at_pack(m_packed,
+                                                              sizeof(m_packed),
+                                                              arg0,
+                                                              arg1,
+                                                              arg2,
+                                                              arg3);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_RECEIVE_AT,
+                                             &arg0_interpreter,
+                                             &arg1_interpreter,
+                                             &arg2_interpreter,
+                                             &arg3_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_at_unpack(m_expected,
+                                                                (size_t)len,
+                                                                &arg0_codec,
+                                                                &arg1_codec,
+                                                                &arg2_codec,
+                                                                &arg3_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void receive_at_cancel_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint32_t       arg0             = (uint32_t)rand_get();
+        uint32_t       arg0_interpreter = 0;
+        uint32_t       arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_receive_at_cancel_pack(m_packed,
+                                                                   sizeof(m_packed),
+                                                                   arg0);
+
+        CHECK("RECEIVE_AT_CANCEL pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_receive_at_cancel_pack(m_packed,
+                                                                       (size_t)len - 1U,
+                                                                       arg0);
+
+            CHECK("RECEIVE_AT_CANCEL pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_receive_at_cancel_unpack(m_expected,
+                                                                         cut,
+                                                                         &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("RECEIVE_AT_CANCEL unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("RECEIVE_AT_CANCEL unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_at_cancel_pack(m_packed,
+                                                                     sizeof(m_packed),
+                                                                     arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_at_cancel_unpack(m_expected,
+                                                                       (size_t)len,
+                                                                       &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void receive_at_cancel_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_receive_at_cancel_ret_pack(m_packed,
+                                                                       sizeof(m_packed),
+                                                                       arg0);
+
+        CHECK("RECEIVE_AT_CANCEL_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_receive_at_cancel_ret_pack(m_packed,
+                                                                           (size_t)len - 1U,
+                                                                           arg0);
+
+            CHECK("RECEIVE_AT_CANCEL_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_receive_at_cancel_ret_unpack(m_expected,
+                                                                             cut,
+                                                                             &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("RECEIVE_AT_CANCEL_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("RECEIVE_AT_CANCEL_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_at_cancel_ret_pack(m_packed,
+                                                                         sizeof(m_packed),
+                                                                         arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_CANCEL_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_at_cancel_ret_unpack(m_expected,
+                                                                           (size_t)len,
+                                                                           &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void receive_at_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_receive_at_ret_pack(m_packed,
+                                                                sizeof(m_packed),
+                                                                arg0);
+
+        CHECK("RECEIVE_AT_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_receive_at_ret_pack(m_packed,
+                                                                    (size_t)len - 1U,
+                                                                    arg0);
+
+            CHECK("RECEIVE_AT_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_receive_at_ret_unpack(m_expected,
+                                                                      cut,
+                                                                      &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("RECEIVE_AT_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("RECEIVE_AT_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_at_ret_pack(m_packed,
+                                                                  sizeof(m_packed),
+                                                                  arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_RECEIVE_AT_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_at_ret_unpack(m_expected,
+                                                                    (size_t)len,
+                                                                    &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void receive_failed_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint32_t       arg1             = (uint32_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        uint32_t       arg1_interpreter = 0;
+        uint32_t       arg1_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_RECEIVE_FAILED,
+                                   arg0,
+                                   arg1);
+        codec_len = nrf_802154_spinel_codec_receive_failed_pack(m_packed,
+                                                                sizeof(m_packed),
+                                                                arg0,
+                                                                arg1);
+
+        CHECK("RECEIVE_FAILED pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_receive_failed_pack(m_packed,
+                                                                    (size_t)len - 1U,
+                                                                    arg0,
+                                                                    arg1);
+
+            CHECK("RECEIVE_FAILED pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_RECEIVE_FAILED,
+                                                                    &arg0_interpreter,
+                                                                    &arg1_interpreter);
+            codec_len = nrf_802154_spinel_codec_receive_failed_unpack(m_expected,
+                                                                      cut,
+                                                                      &arg0_codec,
+                                                                      &arg1_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("RECEIVE_FAILED unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("RECEIVE_FAILED unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  (arg1_codec == arg1_interpreter) &&
+                  (arg1_codec == arg1));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_RECEIVE_FAILED,
+                                           arg0,
+                                           arg1);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_failed_pack(m_packed,
+                                                                  sizeof(m_packed),
+                                                                  arg0,
+                                                                  arg1);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_RECEIVE_FAILED,
+                                             &arg0_interpreter,
+                                             &arg1_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_failed_unpack(m_expected,
+                                                                    (size_t)len,
+                                                                    &arg0_codec,
+                                                                    &arg1_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void receive_periodic_start_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t         arg0                 = (uint8_t)rand_get();
+        uint64_t        arg1                 = (uint64_t)rand64_get();
+        uint32_t        arg2                 = (uint32_t)rand_get();
+        uint32_t        arg3                 = (uint32_t)rand_get();
+        size_t          arg4_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg4_data[TEST_DATA_MAX_LEN];
+        uint8_t         arg0_interpreter     = 0;
+        uint8_t         arg0_codec           = 0;
+        uint64_t        arg1_interpreter     = 0;
+        uint64_t        arg1_codec           = 0;
+        uint32_t        arg2_interpreter     = 0;
+        uint32_t        arg2_codec           = 0;
+        uint32_t        arg3_interpreter     = 0;
+        uint32_t        arg3_codec           = 0;
+        const uint8_t * p_arg4_interpreter   = NULL;
+        const void    * p_arg4_codec         = NULL;
+        unsigned int    arg4_len_interpreter = 0U;
+        size_t          arg4_len_codec       = 0U;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg4_data, arg4_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_START,
+                                   arg0,
+                                   arg1,
+                                   arg2,
+                                   arg3,
+                                   arg4_data,
+                                   (unsigned int)arg4_len);
+        codec_len = nrf_802154_spinel_codec_receive_periodic_start_pack(m_packed,
+                                                                        sizeof(m_packed),
+                                                                        arg0,
+                                                                        arg1,
+                                                                        arg2,
+                                                                        arg3,
+                                                                        arg4_data,
+                                                                        arg4_len);
+
+        CHECK("RECEIVE_PERIODIC_START pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_receive_periodic_start_pack(m_packed,
+                                                                            (size_t)len - 1U,
+                                                                            arg0,
+                                                                            arg1,
+                                                                            arg2,
+                                                                            arg3,
+                                                                            arg4_data,
+                                                                            arg4_len);
+
+            CHECK("RECEIVE_PERIODIC_START pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_START,
+                                                                    &arg0_interpreter,
+                                                                    &arg1_interpreter,
+                                                                    &arg2_interpreter,
+                                                                    &arg3_interpreter,
+                                                                    &p_arg4_interpreter,
+                                                                    &arg4_len_interpreter);
+            codec_len = nrf_802154_spinel_codec_receive_periodic_start_unpack(m_expected,
+                                                                              cut,
+                                                                              &arg0_codec,
+                                                                              &arg1_codec,
+                                                                              &arg2_codec,
+                                                                              &arg3_codec,
+                                                                              &p_arg4_codec,
+                                                                              &arg4_len_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("RECEIVE_PERIODIC_START unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("RECEIVE_PERIODIC_START unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  (arg1_codec == arg1_interpreter) &&
+                  (arg1_codec == arg1) &&
+                  (arg2_codec == arg2_interpreter) &&
+                  (arg2_codec == arg2) &&
+                  (arg3_codec == arg3_interpreter) &&
+                  (arg3_codec == arg3) &&
+                  ((const void *)p_arg4_interpreter == p_arg4_codec) &&
+                  (arg4_len_interpreter == arg4_len_codec));
+        }
+
+        CHECK("RECEIVE_PERIODIC_START unpacked data",
+              (arg4_len_codec == arg4_len) &&
+              (memcmp(p_arg4_codec, arg4_data, arg4_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_START,
+                                           arg0,
+                                           arg1,
+                                           arg2,
+                                           arg3,
+                                           arg4_data,
+                                           (unsigned int)arg4_len);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_periodic_start_pack(m_packed,
+                                                                          sizeof(m_packed),
+                                                                          arg0,
+                                                                          arg1,
+                                                                          arg2,
+                                                                          arg3,
+                                                                          arg4_data,
+                                                                          arg4_len);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_START,
+                                             &arg0_interpreter,
+                                             &arg1_interpreter,
+                                             &arg2_interpreter,
+                                             &arg3_interpreter,
+                                             &p_arg4_interpreter,
+                                             &arg4_len_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_periodic_start_unpack(m_expected,
+                                                                            (size_t)len,
+                                                                            &arg0_codec,
+                                                                            &arg1_codec,
+                                                                            &arg2_codec,
+                                                                            &arg3_codec,
+                                                                            &p_arg4_codec,
+                                                                            &arg4_len_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void receive_periodic_start_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_START_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_receive_periodic_start_ret_pack(m_packed,
+                                                                            sizeof(m_packed),
+                                                                            arg0);
+
+        CHECK("RECEIVE_PERIODIC_START_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_receive_periodic_start_ret_pack(m_packed,
+                                                                                (size_t)len - 1U,
+                                                                                arg0);
+
+            CHECK("RECEIVE_PERIODIC_START_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_START_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_receive_periodic_start_ret_unpack(m_expected,
+                                                                                  cut,
+                                                                                  &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("RECEIVE_PERIODIC_START_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("RECEIVE_PERIODIC_START_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_START_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_periodic_start_ret_pack(m_packed,
+                                                                              sizeof(m_packed),
+                                                                              arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_START_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_periodic_start_ret_unpack(m_expected,
+                                                                                (size_t)len,
+                                                                                &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void receive_periodic_stats_get_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STATS_GET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_receive_periodic_stats_get_pack(m_packed,
+                                                                            sizeof(m_packed),
+                                                                            arg0);
+
+        CHECK("RECEIVE_PERIODIC_STATS_GET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_receive_periodic_stats_get_pack(m_packed,
+                                                                                (size_t)len - 1U,
+                                                                                arg0);
+
+            CHECK("RECEIVE_PERIODIC_STATS_GET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STATS_GET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_receive_periodic_stats_get_unpack(m_expected,
+                                                                                  cut,
+                                                                                  &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("RECEIVE_PERIODIC_STATS_GET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("RECEIVE_PERIODIC_STATS_GET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STATS_GET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_periodic_stats_get_pack(m_packed,
+                                                                              sizeof(m_packed),
+                                                                              arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STATS_GET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_periodic_stats_get_unpack(m_expected,
+                                                                                (size_t)len,
+                                                                                &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void receive_periodic_stats_get_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        uint32_t       arg1             = (uint32_t)rand_get();
+        uint32_t       arg2             = (uint32_t)rand_get();
+        uint32_t       arg3             = (uint32_t)rand_get();
+        uint32_t       arg4             = (uint32_t)rand_get();
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        uint32_t       arg1_interpreter = 0;
+        uint32_t       arg1_codec       = 0;
+        uint32_t       arg2_interpreter = 0;
+        uint32_t       arg2_codec       = 0;
+        uint32_t       arg3_interpreter = 0;
+        uint32_t       arg3_codec       = 0;
+        uint32_t       arg4_interpreter = 0;
+        uint32_t       arg4_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STATS_GET_RET,
+                                   arg0,
+                                   arg1,
+                                   arg2,
+                                   arg3,
+                                   arg4);
+        codec_len = nrf_802154_spinel_codec_receive_periodic_stats_get_ret_pack(m_packed,
+                                                                                sizeof(m_packed),
+                                                                                arg0,
+                                                                                arg1,
+                                                                                arg2,
+                                                                                arg3,
+                                                                                arg4);
+
+        CHECK("RECEIVE_PERIODIC_STATS_GET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_receive_periodic_stats_get_ret_pack(m_packed,
+                                                                                    (size_t)len - 1U,
+                                                                                    arg0,
+                                                                                    arg1,
+                                                                                    arg2,
+                                                                                    arg3,
+                                                                                    arg4);
+
+            CHECK("RECEIVE_PERIODIC_STATS_GET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STATS_GET_RET,
+                                                                    &arg0_interpreter,
+                                                                    &arg1_interpreter,
+                                                                    &arg2_interpreter,
+                                                                    &arg3_interpreter,
+                                                                    &arg4_interpreter);
+            codec_len = nrf_802154_spinel_codec_receive_periodic_stats_get_ret_unpack(m_expected,
+                                                                                      cut,
+                                                                                      &arg0_codec,
+                                                                                      &arg1_codec,
+                                                                                      &arg2_codec,
+                                                                                      &arg3_codec,
+                                                                                      &arg4_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("RECEIVE_PERIODIC_STATS_GET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("RECEIVE_PERIODIC_STATS_GET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  (arg1_codec == arg1_interpreter) &&
+                  (arg1_codec == arg1) &&
+                  (arg2_codec == arg2_interpreter) &&
+                  (arg2_codec == arg2) &&
+                  (arg3_codec == arg3_interpreter) &&
+                  (arg3_codec == arg3) &&
+                  (arg4_codec == arg4_interpreter) &&
+                  (arg4_codec == arg4));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STATS_GET_RET,
+                                           arg0,
+                                           arg1,
+                                           arg2,
+                                           arg3,
+                                           arg4);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_periodic_stats_get_ret_pack(m_packed,
+                                                                                  sizeof(m_packed),
+                                                                                  arg0,
+                                                                                  arg1,
+                                                                                  arg2,
+                                                                                  arg3,
+                                                                                  arg4);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STATS_GET_RET,
+                                             &arg0_interpreter,
+                                             &arg1_interpreter,
+                                             &arg2_interpreter,
+                                             &arg3_interpreter,
+                                             &arg4_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_periodic_stats_get_ret_unpack(m_expected,
+                                                                                    (size_t)len,
+                                                                                    &arg0_codec,
+                                                                                    &arg1_codec,
+                                                                                    &arg2_codec,
+                                                                                    &arg3_codec,
+                                                                                    &arg4_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void receive_periodic_stop_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STOP,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_receive_periodic_stop_pack(m_packed,
+                                                                       sizeof(m_packed),
+                                                                       arg0);
+
+        CHECK("RECEIVE_PERIODIC_STOP pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_receive_periodic_stop_pack(m_packed,
+                                                                           (size_t)len - 1U,
+                                                                           arg0);
+
+            CHECK("RECEIVE_PERIODIC_STOP pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STOP,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_receive_periodic_stop_unpack(m_expected,
+                                                                             cut,
+                                                                             &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("RECEIVE_PERIODIC_STOP unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("RECEIVE_PERIODIC_STOP unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STOP,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_periodic_stop_pack(m_packed,
+                                                                         sizeof(m_packed),
+                                                                         arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STOP,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_periodic_stop_unpack(m_expected,
+                                                                           (size_t)len,
+                                                                           &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void receive_periodic_stop_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STOP_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_receive_periodic_stop_ret_pack(m_packed,
+                                                                           sizeof(m_packed),
+                                                                           arg0);
+
+        CHECK("RECEIVE_PERIODIC_STOP_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_receive_periodic_stop_ret_pack(m_packed,
+                                                                               (size_t)len - 1U,
+                                                                               arg0);
+
+            CHECK("RECEIVE_PERIODIC_STOP_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STOP_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_receive_periodic_stop_ret_unpack(m_expected,
+                                                                                 cut,
+                                                                                 &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("RECEIVE_PERIODIC_STOP_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("RECEIVE_PERIODIC_STOP_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STOP_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_periodic_stop_ret_pack(m_packed,
+                                                                             sizeof(m_packed),
+                                                                             arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_RECEIVE_PERIODIC_STOP_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_periodic_stop_ret_unpack(m_expected,
+                                                                               (size_t)len,
+                                                                               &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void receive_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_RECEIVE_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_receive_ret_pack(m_packed,
+                                                             sizeof(m_packed),
+                                                             arg0);
+
+        CHECK("RECEIVE_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_receive_ret_pack(m_packed,
+                                                                 (size_t)len - 1U,
+                                                                 arg0);
+
+            CHECK("RECEIVE_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_RECEIVE_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_receive_ret_unpack(m_expected,
+                                                                   cut,
+                                                                   &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("RECEIVE_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("RECEIVE_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_RECEIVE_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_ret_pack(m_packed,
+                                                               sizeof(m_packed),
+                                                               arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_RECEIVE_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_receive_ret_unpack(m_expected,
+                                                                 (size_t)len,
+                                                                 &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void retransmission_config_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg1             = (uint8_t)rand_get();
+        uint8_t        arg2             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        uint8_t        arg1_interpreter = 0;
+        uint8_t        arg1_codec       = 0;
+        uint8_t        arg2_interpreter = 0;
+        uint8_t        arg2_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_RETRANSMISSION_CONFIG_SET,
+                                   arg0,
+                                   arg1,
+                                   arg2);
+        codec_len = nrf_802154_spinel_codec_retransmission_config_set_pack(m_packed,
+                                                                           sizeof(m_packed),
+                                                                           arg0,
+                                                                           arg1,
+                                                                           arg2);
+
+        CHECK("RETRANSMISSION_CONFIG_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_retransmission_config_set_pack(m_packed,
+                                                                               (size_t)len - 1U,
+                                                                               arg0,
+                                                                               arg1,
+                                                                               arg2);
+
+            CHECK("RETRANSMISSION_CONFIG_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_RETRANSMISSION_CONFIG_SET,
+                                                                    &arg0_interpreter,
+                                                                    &arg1_interpreter,
+                                                                    &arg2_interpreter);
+            codec_len = nrf_802154_spinel_codec_retransmission_config_set_unpack(m_expected,
+                                                                                 cut,
+                                                                                 &arg0_codec,
+                                                                                 &arg1_codec,
+                                                                                 &arg2_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("RETRANSMISSION_CONFIG_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("RETRANSMISSION_CONFIG_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  (arg1_codec == arg1_interpreter) &&
+                  (arg1_codec == arg1) &&
+                  (arg2_codec == arg2_interpreter) &&
+                  (arg2_codec == arg2));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_RETRANSMISSION_CONFIG_SET,
+                                           arg0,
+                                           arg1,
+                                           arg2);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_retransmission_config_set_pack(m_packed,
+                                                                             sizeof(m_packed),
+                                                                             arg0,
+                                                                             arg1,
+                                                                             arg2);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_RETRANSMISSION_CONFIG_SET,
+                                             &arg0_interpreter,
+                                             &arg1_interpreter,
+                                             &arg2_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_retransmission_config_set_unpack(m_expected,
+                                                                               (size_t)len,
+                                                                               &arg0_codec,
+                                                                               &arg1_codec,
+                                                                               &arg2_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void retransmission_config_set_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_RETRANSMISSION_CONFIG_SET_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_retransmission_config_set_ret_pack(m_packed,
+                                                                               sizeof(m_packed),
+                                                                               arg0);
+
+        CHECK("RETRANSMISSION_CONFIG_SET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_retransmission_config_set_ret_pack(m_packed,
+                                                                                   (size_t)len - 1U,
+                                                                                   arg0);
+
+            CHECK("RETRANSMISSION_CONFIG_SET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_RETRANSMISSION_CONFIG_SET_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_retransmission_config_set_ret_unpack(m_expected,
+                                                                                     cut,
+                                                                                     &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("RETRANSMISSION_CONFIG_SET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("RETRANSMISSION_CONFIG_SET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_RETRANSMISSION_CONFIG_SET_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_retransmission_config_set_ret_pack(m_packed,
+                                                                                 sizeof(m_packed),
+                                                                                 arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_RETRANSMISSION_CONFIG_SET_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_retransmission_config_set_ret_unpack(m_expected,
+                                                                                   (size_t)len,
+                                                                                   &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void rx_on_when_idle_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_RX_ON_WHEN_IDLE_SET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_rx_on_when_idle_set_pack(m_packed,
+                                                                     sizeof(m_packed),
+                                                                     arg0);
+
+        CHECK("RX_ON_WHEN_IDLE_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_rx_on_when_idle_set_pack(m_packed,
+                                                                         (size_t)len - 1U,
+                                                                         arg0);
+
+            CHECK("RX_ON_WHEN_IDLE_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_RX_ON_WHEN_IDLE_SET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_rx_on_when_idle_set_unpack(m_expected,
+                                                                           cut,
+                                                                           &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("RX_ON_WHEN_IDLE_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("RX_ON_WHEN_IDLE_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_RX_ON_WHEN_IDLE_SET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_rx_on_when_idle_set_pack(m_packed,
+                                                                       sizeof(m_packed),
+                                                                       arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_RX_ON_WHEN_IDLE_SET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_rx_on_when_idle_set_unpack(m_expected,
+                                                                         (size_t)len,
+                                                                         &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void security_error_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_SECURITY_ERROR_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_security_error_ret_pack(m_packed,
+                                                                    sizeof(m_packed),
+                                                                    arg0);
+
+        CHECK("SECURITY_ERROR_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_security_error_ret_pack(m_packed,
+                                                                        (size_t)len - 1U,
+                                                                        arg0);
+
+            CHECK("SECURITY_ERROR_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_SECURITY_ERROR_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_security_error_ret_unpack(m_expected,
+                                                                          cut,
+                                                                          &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("SECURITY_ERROR_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("SECURITY_ERROR_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_SECURITY_ERROR_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_security_error_ret_pack(m_packed,
+                                                                      sizeof(m_packed),
+                                                                      arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_SECURITY_ERROR_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_security_error_ret_unpack(m_expected,
+                                                                        (size_t)len,
+                                                                        &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void security_global_frame_counter_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint32_t       arg0             = (uint32_t)rand_get();
+        uint32_t       arg0_interpreter = 0;
+        uint32_t       arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_security_global_frame_counter_set_pack(m_packed,
+                                                                                   sizeof(m_packed),
+                                                                                   arg0);
+
+        CHECK("SECURITY_GLOBAL_FRAME_COUNTER_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_security_global_frame_counter_set_pack(m_packed,
+                                                                                       (size_t)len - 1U,
+                                                                                       arg0);
+
+            CHECK("SECURITY_GLOBAL_FRAME_COUNTER_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_security_global_frame_counter_set_unpack(m_expected,
+                                                                                         cut,
+                                                                                         &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("SECURITY_GLOBAL_FRAME_COUNTER_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("SECURITY_GLOBAL_FRAME_COUNTER_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_security_global_frame_counter_set_pack(m_packed,
+                                                                                     sizeof(m_packed),
+                                                                                     arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_SECURITY_GLOBAL_FRAME_COUNTER_SET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_security_global_frame_counter_set_unpack(m_expected,
+                                                                                       (size_t)len,
+                                                                                       &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void security_key_remove_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t         arg0                 = (uint8_t)rand_get();
+        size_t          arg1_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg1_data[TEST_DATA_MAX_LEN];
+        uint8_t         arg0_interpreter     = 0;
+        uint8_t         arg0_codec           = 0;
+        const uint8_t * p_arg1_interpreter   = NULL;
+        const void    * p_arg1_codec         = NULL;
+        unsigned int    arg1_len_interpreter = 0U;
+        size_t          arg1_len_codec       = 0U;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg1_data, arg1_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE,
+                                   arg0,
+                                   arg1_data,
+                                   (unsigned int)arg1_len);
+        codec_len = nrf_802154_spinel_codec_security_key_remove_pack(m_packed,
+                                                                     sizeof(m_packed),
+                                                                     arg0,
+                                                                     arg1_data,
+                                                                     arg1_len);
+
+        CHECK("SECURITY_KEY_REMOVE pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_security_key_remove_pack(m_packed,
+                                                                         (size_t)len - 1U,
+                                                                         arg0,
+                                                                         arg1_data,
+                                                                         arg1_len);
+
+            CHECK("SECURITY_KEY_REMOVE pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE,
+                                                                    &arg0_interpreter,
+                                                                    &p_arg1_interpreter,
+                                                                    &arg1_len_interpreter);
+            codec_len = nrf_802154_spinel_codec_security_key_remove_unpack(m_expected,
+                                                                           cut,
+                                                                           &arg0_codec,
+                                                                           &p_arg1_codec,
+                                                                           &arg1_len_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("SECURITY_KEY_REMOVE unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("SECURITY_KEY_REMOVE unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  ((const void *)p_arg1_interpreter == p_arg1_codec) &&
+                  (arg1_len_interpreter == arg1_len_codec));
+        }
+
+        CHECK("SECURITY_KEY_REMOVE unpacked data",
+              (arg1_len_codec == arg1_len) &&
+              (memcmp(p_arg1_codec, arg1_data, arg1_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE,
+                                           arg0,
+                                           arg1_data,
+                                           (unsigned int)arg1_len);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_security_key_remove_pack(m_packed,
+                                                                       sizeof(m_packed),
+                                                                       arg0,
+                                                                       arg1_data,
+                                                                       arg1_len);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE,
+                                             &arg0_interpreter,
+                                             &p_arg1_interpreter,
+                                             &arg1_len_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_security_key_remove_unpack(m_expected,
+                                                                         (size_t)len,
+                                                                         &arg0_codec,
+                                                                         &p_arg1_codec,
+                                                                         &arg1_len_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void security_key_remove_all_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("SECURITY_KEY_REMOVE_ALL pack",
+          (nrf_802154_spinel_codec_security_key_remove_all_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_REMOVE_ALL) == 0));
+    CHECK("SECURITY_KEY_REMOVE_ALL unpack", nrf_802154_spinel_codec_security_key_remove_all_unpack(m_expected, 0U) == 0);
+}
+
+static void security_key_store_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        size_t          arg0_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg1                 = (uint8_t)rand_get();
+        size_t          arg2_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint32_t        arg3                 = (uint32_t)rand_get();
+        uint32_t        arg4                 = (uint32_t)rand_get();
+        bool            arg5                 = (rand_get() & 1U) != 0U;
+        uint8_t         arg0_data[TEST_DATA_MAX_LEN];
+        uint8_t         arg2_data[TEST_DATA_MAX_LEN];
+        const uint8_t * p_arg0_interpreter   = NULL;
+        const void    * p_arg0_codec         = NULL;
+        unsigned int    arg0_len_interpreter = 0U;
+        size_t          arg0_len_codec       = 0U;
+        uint8_t         arg1_interpreter     = 0;
+        uint8_t         arg1_codec           = 0;
+        const uint8_t * p_arg2_interpreter   = NULL;
+        const void    * p_arg2_codec         = NULL;
+        unsigned int    arg2_len_interpreter = 0U;
+        size_t          arg2_len_codec       = 0U;
+        uint32_t        arg3_interpreter     = 0;
+        uint32_t        arg3_codec           = 0;
+        uint32_t        arg4_interpreter     = 0;
+        uint32_t        arg4_codec           = 0;
+        bool            arg5_interpreter     = false;
+        bool            arg5_codec           = false;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg0_data, arg0_len);
+        data_fill(arg2_data, arg2_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_STORE,
+                                   arg0_data,
+                                   (unsigned int)arg0_len,
+                                   arg1,
+                                   arg2_data,
+                                   (unsigned int)arg2_len,
+                                   arg3,
+                                   arg4,
+                                   arg5);
+        codec_len = nrf_802154_spinel_codec_security_key_store_pack(m_packed,
+                                                                    sizeof(m_packed),
+                                                                    arg0_data,
+                                                                    arg0_len,
+                                                                    arg1,
+                                                                    arg2_data,
+                                                                    arg2_len,
+                                                                    arg3,
+                                                                    arg4,
+                                                                    arg5);
+
+        CHECK("SECURITY_KEY_STORE pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_security_key_store_pack(m_packed,
+                                                                        (size_t)len - 1U,
+                                                                        arg0_data,
+                                                                        arg0_len,
+                                                                        arg1,
+                                                                        arg2_data,
+                                                                        arg2_len,
+                                                                        arg3,
+                                                                        arg4,
+                                                                        arg5);
+
+            CHECK("SECURITY_KEY_STORE pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_STORE,
+                                                                    &p_arg0_interpreter,
+                                                                    &arg0_len_interpreter,
+                                                                    &arg1_interpreter,
+                                                                    &p_arg2_interpreter,
+                                                                    &arg2_len_interpreter,
+                                                                    &arg3_interpreter,
+                                                                    &arg4_interpreter,
+                                                                    &arg5_interpreter);
+            codec_len = nrf_802154_spinel_codec_security_key_store_unpack(m_expected,
+                                                                          cut,
+                                                                          &p_arg0_codec,
+                                                                          &arg0_len_codec,
+                                                                          &arg1_codec,
+                                                                          &p_arg2_codec,
+                                                                          &arg2_len_codec,
+                                                                          &arg3_codec,
+                                                                          &arg4_codec,
+                                                                          &arg5_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("SECURITY_KEY_STORE unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("SECURITY_KEY_STORE unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  ((const void *)p_arg0_interpreter == p_arg0_codec) &&
+                  (arg0_len_interpreter == arg0_len_codec) &&
+                  (arg1_codec == arg1_interpreter) &&
+                  (arg1_codec == arg1) &&
+                  ((const void *)p_arg2_interpreter == p_arg2_codec) &&
+                  (arg2_len_interpreter == arg2_len_codec) &&
+                  (arg3_codec == arg3_interpreter) &&
+                  (arg3_codec == arg3) &&
+                  (arg4_codec == arg4_interpreter) &&
+                  (arg4_codec == arg4) &&
+                  (arg5_codec == arg5_interpreter) &&
+                  (arg5_codec == arg5));
+        }
+
+        CHECK("SECURITY_KEY_STORE unpacked data",
+              (arg0_len_codec == arg0_len) &&
+              (memcmp(p_arg0_codec, arg0_data, arg0_len) == 0));
+        CHECK("SECURITY_KEY_STORE unpacked data",
+              (arg2_len_codec == arg2_len) &&
+              (memcmp(p_arg2_codec, arg2_data, arg2_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_STORE,
+                                           arg0_data,
+                                           (unsigned int)arg0_len,
+                                           arg1,
+                                           arg2_data,
+                                           (unsigned int)arg2_len,
+                                           arg3,
+                                           arg4,
+                                           arg5);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_security_key_store_pack(m_packed,
+                                                                      sizeof(m_packed),
+                                                                      arg0_data,
+                                                                      arg0_len,
+                                                                      arg1,
+                                                                      arg2_data,
+                                                                      arg2_len,
+                                                                      arg3,
+                                                                      arg4,
+                                                                      arg5);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_SECURITY_KEY_STORE,
+                                             &p_arg0_interpreter,
+                                             &arg0_len_interpreter,
+                                             &arg1_interpreter,
+                                             &p_arg2_interpreter,
+                                             &arg2_len_interpreter,
+                                             &arg3_interpreter,
+                                             &arg4_interpreter,
+                                             &arg5_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_security_key_store_unpack(m_expected,
+                                                                        (size_t)len,
+                                                                        &p_arg0_codec,
+                                                                        &arg0_len_codec,
+                                                                        &arg1_codec,
+                                                                        &p_arg2_codec,
+                                                                        &arg2_len_codec,
+                                                                        &arg3_codec,
+                                                                        &arg4_codec,
+                                                                        &arg5_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void short_address_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        size_t          arg0_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg0_data[TEST_DATA_MAX_LEN];
+        const uint8_t * p_arg0_interpreter   = NULL;
+        const void    * p_arg0_codec         = NULL;
+        unsigned int    arg0_len_interpreter = 0U;
+        size_t          arg0_len_codec       = 0U;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg0_data, arg0_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_SHORT_ADDRESS_SET,
+                                   arg0_data,
+                                   (unsigned int)arg0_len);
+        codec_len = nrf_802154_spinel_codec_short_address_set_pack(m_packed,
+                                                                   sizeof(m_packed),
+                                                                   arg0_data,
+                                                                   arg0_len);
+
+        CHECK("SHORT_ADDRESS_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_short_address_set_pack(m_packed,
+                                                                       (size_t)len - 1U,
+                                                                       arg0_data,
+                                                                       arg0_len);
+
+            CHECK("SHORT_ADDRESS_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_SHORT_ADDRESS_SET,
+                                                                    &p_arg0_interpreter,
+                                                                    &arg0_len_interpreter);
+            codec_len = nrf_802154_spinel_codec_short_address_set_unpack(m_expected,
+                                                                         cut,
+                                                                         &p_arg0_codec,
+                                                                         &arg0_len_codec);
+
+            // The last data field is not prefixed, so it can be cut short
+            if ((cut < (size_t)len) && (codec_len < 0))
+            {
+                CHECK("SHORT_ADDRESS_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("SHORT_ADDRESS_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  ((const void *)p_arg0_interpreter == p_arg0_codec) &&
+                  (arg0_len_interpreter == arg0_len_codec));
+        }
+
+        CHECK("SHORT_ADDRESS_SET unpacked data",
+              (arg0_len_codec == arg0_len) &&
+              (memcmp(p_arg0_codec, arg0_data, arg0_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_SHORT_ADDRESS_SET,
+                                           arg0_data,
+                                           (unsigned int)arg0_len);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_short_address_set_pack(m_packed,
+                                                                     sizeof(m_packed),
+                                                                     arg0_data,
+                                                                     arg0_len);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_SHORT_ADDRESS_SET,
+                                             &p_arg0_interpreter,
+                                             &arg0_len_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_short_address_set_unpack(m_expected,
+                                                                       (size_t)len,
+                                                                       &p_arg0_codec,
+                                                                       &arg0_len_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void sleep_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("SLEEP pack",
+          (nrf_802154_spinel_codec_sleep_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_SLEEP) == 0));
+    CHECK("SLEEP unpack", nrf_802154_spinel_codec_sleep_unpack(m_expected, 0U) == 0);
+}
+
+static void sleep_if_idle_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("SLEEP_IF_IDLE pack",
+          (nrf_802154_spinel_codec_sleep_if_idle_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_SLEEP_IF_IDLE) == 0));
+    CHECK("SLEEP_IF_IDLE unpack", nrf_802154_spinel_codec_sleep_if_idle_unpack(m_expected, 0U) == 0);
+}
+
+static void sleep_if_idle_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_SLEEP_IF_IDLE_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_sleep_if_idle_ret_pack(m_packed,
+                                                                   sizeof(m_packed),
+                                                                   arg0);
+
+        CHECK("SLEEP_IF_IDLE_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_sleep_if_idle_ret_pack(m_packed,
+                                                                       (size_t)len - 1U,
+                                                                       arg0);
+
+            CHECK("SLEEP_IF_IDLE_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_SLEEP_IF_IDLE_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_sleep_if_idle_ret_unpack(m_expected,
+                                                                         cut,
+                                                                         &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("SLEEP_IF_IDLE_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("SLEEP_IF_IDLE_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_SLEEP_IF_IDLE_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_sleep_if_idle_ret_pack(m_packed,
+                                                                     sizeof(m_packed),
+                                                                     arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_SLEEP_IF_IDLE_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_sleep_if_idle_ret_unpack(m_expected,
+                                                                       (size_t)len,
+                                                                       &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void sleep_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_SLEEP_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_sleep_ret_pack(m_packed,
+                                                           sizeof(m_packed),
+                                                           arg0);
+
+        CHECK("SLEEP_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_sleep_ret_pack(m_packed,
+                                                               (size_t)len - 1U,
+                                                               arg0);
+
+            CHECK("SLEEP_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_SLEEP_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_sleep_ret_unpack(m_expected,
+                                                                 cut,
+                                                                 &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("SLEEP_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("SLEEP_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_SLEEP_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_sleep_ret_pack(m_packed,
+                                                             sizeof(m_packed),
+                                                             arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_SLEEP_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_sleep_ret_unpack(m_expected,
+                                                               (size_t)len,
+                                                               &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void src_addr_matching_method_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_SRC_ADDR_MATCHING_METHOD_SET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_src_addr_matching_method_set_pack(m_packed,
+                                                                              sizeof(m_packed),
+                                                                              arg0);
+
+        CHECK("SRC_ADDR_MATCHING_METHOD_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_src_addr_matching_method_set_pack(m_packed,
+                                                                                  (size_t)len - 1U,
+                                                                                  arg0);
+
+            CHECK("SRC_ADDR_MATCHING_METHOD_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_SRC_ADDR_MATCHING_METHOD_SET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_src_addr_matching_method_set_unpack(m_expected,
+                                                                                    cut,
+                                                                                    &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("SRC_ADDR_MATCHING_METHOD_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("SRC_ADDR_MATCHING_METHOD_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_SRC_ADDR_MATCHING_METHOD_SET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_src_addr_matching_method_set_pack(m_packed,
+                                                                                sizeof(m_packed),
+                                                                                arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_SRC_ADDR_MATCHING_METHOD_SET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_src_addr_matching_method_set_unpack(m_expected,
+                                                                                  (size_t)len,
+                                                                                  &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void stat_timestamps_get_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("STAT_TIMESTAMPS_GET pack",
+          (nrf_802154_spinel_codec_stat_timestamps_get_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_STAT_TIMESTAMPS_GET) == 0));
+    CHECK("STAT_TIMESTAMPS_GET unpack", nrf_802154_spinel_codec_stat_timestamps_get_unpack(m_expected, 0U) == 0);
+}
+
+static void stat_timestamps_get_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint64_t       arg0             = (uint64_t)rand64_get();
+        uint64_t       arg1             = (uint64_t)rand64_get();
+        uint64_t       arg2             = (uint64_t)rand64_get();
+        uint64_t       arg3             = (uint64_t)rand64_get();
+        uint64_t       arg4             = (uint64_t)rand64_get();
+        uint64_t       arg5             = (uint64_t)rand64_get();
+        uint64_t       arg0_interpreter = 0;
+        uint64_t       arg0_codec       = 0;
+        uint64_t       arg1_interpreter = 0;
+        uint64_t       arg1_codec       = 0;
+        uint64_t       arg2_interpreter = 0;
+        uint64_t       arg2_codec       = 0;
+        uint64_t       arg3_interpreter = 0;
+        uint64_t       arg3_codec       = 0;
+        uint64_t       arg4_interpreter = 0;
+        uint64_t       arg4_codec       = 0;
+        uint64_t       arg5_interpreter = 0;
+        uint64_t       arg5_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_STAT_TIMESTAMPS_GET_RET,
+                                   arg0,
+                                   arg1,
+                                   arg2,
+                                   arg3,
+                                   arg4,
+                                   arg5);
+        codec_len = nrf_802154_spinel_codec_stat_timestamps_get_ret_pack(m_packed,
+                                                                         sizeof(m_packed),
+                                                                         arg0,
+                                                                         arg1,
+                                                                         arg2,
+                                                                         arg3,
+                                                                         arg4,
+                                                                         arg5);
+
+        CHECK("STAT_TIMESTAMPS_GET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_stat_timestamps_get_ret_pack(m_packed,
+                                                                             (size_t)len - 1U,
+                                                                             arg0,
+                                                                             arg1,
+                                                                             arg2,
+                                                                             arg3,
+                                                                             arg4,
+                                                                             arg5);
+
+            CHECK("STAT_TIMESTAMPS_GET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_STAT_TIMESTAMPS_GET_RET,
+                                                                    &arg0_interpreter,
+                                                                    &arg1_interpreter,
+                                                                    &arg2_interpreter,
+                                                                    &arg3_interpreter,
+                                                                    &arg4_interpreter,
+                                                                    &arg5_interpreter);
+            codec_len = nrf_802154_spinel_codec_stat_timestamps_get_ret_unpack(m_expected,
+                                                                               cut,
+                                                                               &arg0_codec,
+                                                                               &arg1_codec,
+                                                                               &arg2_codec,
+                                                                               &arg3_codec,
+                                                                               &arg4_codec,
+                                                                               &arg5_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("STAT_TIMESTAMPS_GET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("STAT_TIMESTAMPS_GET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  (arg1_codec == arg1_interpreter) &&
+                  (arg1_codec == arg1) &&
+                  (arg2_codec == arg2_interpreter) &&
+                  (arg2_codec == arg2) &&
+                  (arg3_codec == arg3_interpreter) &&
+                  (arg3_codec == arg3) &&
+                  (arg4_codec == arg4_interpreter) &&
+                  (arg4_codec == arg4) &&
+                  (arg5_codec == arg5_interpreter) &&
+                  (arg5_codec == arg5));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_STAT_TIMESTAMPS_GET_RET,
+                                           arg0,
+                                           arg1,
+                                           arg2,
+                                           arg3,
+                                           arg4,
+                                           arg5);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_stat_timestamps_get_ret_pack(m_packed,
+                                                                           sizeof(m_packed),
+                                                                           arg0,
+                                                                           arg1,
+                                                                           arg2,
+                                                                           arg3,
+                                                                           arg4,
+                                                                           arg5);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_STAT_TIMESTAMPS_GET_RET,
+                                             &arg0_interpreter,
+                                             &arg1_interpreter,
+                                             &arg2_interpreter,
+                                             &arg3_interpreter,
+                                             &arg4_interpreter,
+                                             &arg5_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_stat_timestamps_get_ret_unpack(m_expected,
+                                                                             (size_t)len,
+                                                                             &arg0_codec,
+                                                                             &arg1_codec,
+                                                                             &arg2_codec,
+                                                                             &arg3_codec,
+                                                                             &arg4_codec,
+                                                                             &arg5_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void test_mode_csmaca_backoff_get_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("TEST_MODE_CSMACA_BACKOFF_GET pack",
+          (nrf_802154_spinel_codec_test_mode_csmaca_backoff_get_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET) == 0));
+    CHECK("TEST_MODE_CSMACA_BACKOFF_GET unpack", nrf_802154_spinel_codec_test_mode_csmaca_backoff_get_unpack(m_expected, 0U) == 0);
+}
+
+static void test_mode_csmaca_backoff_get_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_test_mode_csmaca_backoff_get_ret_pack(m_packed,
+                                                                                  sizeof(m_packed),
+                                                                                  arg0);
+
+        CHECK("TEST_MODE_CSMACA_BACKOFF_GET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_test_mode_csmaca_backoff_get_ret_pack(m_packed,
+                                                                                      (size_t)len - 1U,
+                                                                                      arg0);
+
+            CHECK("TEST_MODE_CSMACA_BACKOFF_GET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_test_mode_csmaca_backoff_get_ret_unpack(m_expected,
+                                                                                        cut,
+                                                                                        &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("TEST_MODE_CSMACA_BACKOFF_GET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TEST_MODE_CSMACA_BACKOFF_GET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_test_mode_csmaca_backoff_get_ret_pack(m_packed,
+                                                                                    sizeof(m_packed),
+                                                                                    arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TEST_MODE_CSMACA_BACKOFF_GET_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_test_mode_csmaca_backoff_get_ret_unpack(m_expected,
+                                                                                      (size_t)len,
+                                                                                      &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void test_mode_csmaca_backoff_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TEST_MODE_CSMACA_BACKOFF_SET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_test_mode_csmaca_backoff_set_pack(m_packed,
+                                                                              sizeof(m_packed),
+                                                                              arg0);
+
+        CHECK("TEST_MODE_CSMACA_BACKOFF_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_test_mode_csmaca_backoff_set_pack(m_packed,
+                                                                                  (size_t)len - 1U,
+                                                                                  arg0);
+
+            CHECK("TEST_MODE_CSMACA_BACKOFF_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TEST_MODE_CSMACA_BACKOFF_SET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_test_mode_csmaca_backoff_set_unpack(m_expected,
+                                                                                    cut,
+                                                                                    &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("TEST_MODE_CSMACA_BACKOFF_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TEST_MODE_CSMACA_BACKOFF_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TEST_MODE_CSMACA_BACKOFF_SET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_test_mode_csmaca_backoff_set_pack(m_packed,
+                                                                                sizeof(m_packed),
+                                                                                arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TEST_MODE_CSMACA_BACKOFF_SET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_test_mode_csmaca_backoff_set_unpack(m_expected,
+                                                                                  (size_t)len,
+                                                                                  &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void time_get_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("TIME_GET pack",
+          (nrf_802154_spinel_codec_time_get_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_TIME_GET) == 0));
+    CHECK("TIME_GET unpack", nrf_802154_spinel_codec_time_get_unpack(m_expected, 0U) == 0);
+}
+
+static void time_get_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint64_t       arg0             = (uint64_t)rand64_get();
+        uint64_t       arg0_interpreter = 0;
+        uint64_t       arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TIME_GET_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_time_get_ret_pack(m_packed,
+                                                              sizeof(m_packed),
+                                                              arg0);
+
+        CHECK("TIME_GET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_time_get_ret_pack(m_packed,
+                                                                  (size_t)len - 1U,
+                                                                  arg0);
+
+            CHECK("TIME_GET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TIME_GET_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_time_get_ret_unpack(m_expected,
+                                                                    cut,
+                                                                    &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("TIME_GET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TIME_GET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TIME_GET_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_time_get_ret_pack(m_packed,
+                                                                sizeof(m_packed),
+                                                                arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TIME_GET_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_time_get_ret_unpack(m_expected,
+                                                                  (size_t)len,
+                                                                  &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void transmitted_raw_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint32_t        arg0                  = (uint32_t)rand_get();
+        size_t          arg1_len              = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        bool            arg2                  = (rand_get() & 1U) != 0U;
+        bool            arg3                  = (rand_get() & 1U) != 0U;
+        uint8_t         arg4                  = (uint8_t)rand_get();
+        uint8_t         arg5                  = (uint8_t)rand_get();
+        uint8_t         arg6                  = (uint8_t)rand_get();
+        uint8_t         arg7                  = (uint8_t)rand_get();
+        int8_t          arg8                  = (int8_t)rand_get();
+        uint8_t         arg9                  = (uint8_t)rand_get();
+        uint64_t        arg10                 = (uint64_t)rand64_get();
+        uint32_t        arg11                 = (uint32_t)rand_get();
+        size_t          arg12_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg1_data[TEST_DATA_MAX_LEN];
+        uint8_t         arg12_data[TEST_DATA_MAX_LEN];
+        uint32_t        arg0_interpreter      = 0;
+        uint32_t        arg0_codec            = 0;
+        const uint8_t * p_arg1_interpreter    = NULL;
+        const void    * p_arg1_codec          = NULL;
+        unsigned int    arg1_len_interpreter  = 0U;
+        size_t          arg1_len_codec        = 0U;
+        bool            arg2_interpreter      = false;
+        bool            arg2_codec            = false;
+        bool            arg3_interpreter      = false;
+        bool            arg3_codec            = false;
+        uint8_t         arg4_interpreter      = 0;
+        uint8_t         arg4_codec            = 0;
+        uint8_t         arg5_interpreter      = 0;
+        uint8_t         arg5_codec            = 0;
+        uint8_t         arg6_interpreter      = 0;
+        uint8_t         arg6_codec            = 0;
+        uint8_t         arg7_interpreter      = 0;
+        uint8_t         arg7_codec            = 0;
+        int8_t          arg8_interpreter      = 0;
+        int8_t          arg8_codec            = 0;
+        uint8_t         arg9_interpreter      = 0;
+        uint8_t         arg9_codec            = 0;
+        uint64_t        arg10_interpreter     = 0;
+        uint64_t        arg10_codec           = 0;
+        uint32_t        arg11_interpreter     = 0;
+        uint32_t        arg11_codec           = 0;
+        const uint8_t * p_arg12_interpreter   = NULL;
+        const void    * p_arg12_codec         = NULL;
+        unsigned int    arg12_len_interpreter = 0U;
+        size_t          arg12_len_codec       = 0U;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg1_data, arg1_len);
+        data_fill(arg12_data, arg12_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TRANSMITTED_RAW,
+                                   arg0,
+                                   arg1_data,
+                                   (unsigned int)arg1_len,
+                                   arg2,
+                                   arg3,
+                                   arg4,
+                                   arg5,
+                                   arg6,
+                                   arg7,
+                                   arg8,
+                                   arg9,
+                                   arg10,
+                                   arg11,
+                                   arg12_data,
+                                   (unsigned int)arg12_len);
+        codec_len = nrf_802154_spinel_codec_transmitted_raw_pack(m_packed,
+                                                                 sizeof(m_packed),
+                                                                 arg0,
+                                                                 arg1_data,
+                                                                 arg1_len,
+                                                                 arg2,
+                                                                 arg3,
+                                                                 arg4,
+                                                                 arg5,
+                                                                 arg6,
+                                                                 arg7,
+                                                                 arg8,
+                                                                 arg9,
+                                                                 arg10,
+                                                                 arg11,
+                                                                 arg12_data,
+                                                                 arg12_len);
+
+        CHECK("TRANSMITTED_RAW pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_transmitted_raw_pack(m_packed,
+                                                                     (size_t)len - 1U,
+                                                                     arg0,
+                                                                     arg1_data,
+                                                                     arg1_len,
+                                                                     arg2,
+                                                                     arg3,
+                                                                     arg4,
+                                                                     arg5,
+                                                                     arg6,
+                                                                     arg7,
+                                                                     arg8,
+                                                                     arg9,
+                                                                     arg10,
+                                                                     arg11,
+                                                                     arg12_data,
+                                                                     arg12_len);
+
+            CHECK("TRANSMITTED_RAW pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TRANSMITTED_RAW,
+                                                                    &arg0_interpreter,
+                                                                    &p_arg1_interpreter,
+                                                                    &arg1_len_interpreter,
+                                                                    &arg2_interpreter,
+                                                                    &arg3_interpreter,
+                                                                    &arg4_interpreter,
+                                                                    &arg5_interpreter,
+                                                                    &arg6_interpreter,
+                                                                    &arg7_interpreter,
+                                                                    &arg8_interpreter,
+                                                                    &arg9_interpreter,
+                                                                    &arg10_interpreter,
+                                                                    &arg11_interpreter,
+                                                                    &p_arg12_interpreter,
+                                                                    &arg12_len_interpreter);
+            codec_len = nrf_802154_spinel_codec_transmitted_raw_unpack(m_expected,
+                                                                       cut,
+                                                                       &arg0_codec,
+                                                                       &p_arg1_codec,
+                                                                       &arg1_len_codec,
+                                                                       &arg2_codec,
+                                                                       &arg3_codec,
+                                                                       &arg4_codec,
+                                                                       &arg5_codec,
+                                                                       &arg6_codec,
+                                                                       &arg7_codec,
+                                                                       &arg8_codec,
+                                                                       &arg9_codec,
+                                                                       &arg10_codec,
+                                                                       &arg11_codec,
+                                                                       &p_arg12_codec,
+                                                                       &arg12_len_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("TRANSMITTED_RAW unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TRANSMITTED_RAW unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  ((const void *)p_arg1_interpreter == p_arg1_codec) &&
+                  (arg1_len_interpreter == arg1_len_codec) &&
+                  (arg2_codec == arg2_interpreter) &&
+                  (arg2_codec == arg2) &&
+                  (arg3_codec == arg3_interpreter) &&
+                  (arg3_codec == arg3) &&
+                  (arg4_codec == arg4_interpreter) &&
+                  (arg4_codec == arg4) &&
+                  (arg5_codec == arg5_interpreter) &&
+                  (arg5_codec == arg5) &&
+                  (arg6_codec == arg6_interpreter) &&
+                  (arg6_codec == arg6) &&
+                  (arg7_codec == arg7_interpreter) &&
+                  (arg7_codec == arg7) &&
+                  (arg8_codec == arg8_interpreter) &&
+                  (arg8_codec == arg8) &&
+                  (arg9_codec == arg9_interpreter) &&
+                  (arg9_codec == arg9) &&
+                  (arg10_codec == arg10_interpreter) &&
+                  (arg10_codec == arg10) &&
+                  (arg11_codec == arg11_interpreter) &&
+                  (arg11_codec == arg11) &&
+                  ((const void *)p_arg12_interpreter == p_arg12_codec) &&
+                  (arg12_len_interpreter == arg12_len_codec));
+        }
+
+        CHECK("TRANSMITTED_RAW unpacked data",
+              (arg1_len_codec == arg1_len) &&
+              (memcmp(p_arg1_codec, arg1_data, arg1_len) == 0));
+        CHECK("TRANSMITTED_RAW unpacked data",
+              (arg12_len_codec == arg12_len) &&
+              (memcmp(p_arg12_codec, arg12_data, arg12_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TRANSMITTED_RAW,
+                                           arg0,
+                                           arg1_data,
+                                           (unsigned int)arg1_len,
+                                           arg2,
+                                           arg3,
+                                           arg4,
+                                           arg5,
+                                           arg6,
+                                           arg7,
+                                           arg8,
+                                           arg9,
+                                           arg10,
+                                           arg11,
+                                           arg12_data,
+                                           (unsigned int)arg12_len);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_transmitted_raw_pack(m_packed,
+                                                                   sizeof(m_packed),
+                                                                   arg0,
+                                                                   arg1_data,
+                                                                   arg1_len,
+                                                                   arg2,
+                                                                   arg3,
+                                                                   arg4,
+                                                                   arg5,
+                                                                   arg6,
+                                                                   arg7,
+                                                                   arg8,
+                                                                   arg9,
+                                                                   arg10,
+                                                                   arg11,
+                                                                   arg12_data,
+                                                                   arg12_len);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TRANSMITTED_RAW,
+                                             &arg0_interpreter,
+                                             &p_arg1_interpreter,
+                                             &arg1_len_interpreter,
+                                             &arg2_interpreter,
+                                             &arg3_interpreter,
+                                             &arg4_interpreter,
+                                             &arg5_interpreter,
+                                             &arg6_interpreter,
+                                             &arg7_interpreter,
+                                             &arg8_interpreter,
+                                             &arg9_interpreter,
+                                             &arg10_interpreter,
+                                             &arg11_interpreter,
+                                             &p_arg12_interpreter,
+                                             &arg12_len_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_transmitted_raw_unpack(m_expected,
+                                                                     (size_t)len,
+                                                                     &arg0_codec,
+                                                                     &p_arg1_codec,
+                                                                     &arg1_len_codec,
+                                                                     &arg2_codec,
+                                                                     &arg3_codec,
+                                                                     &arg4_codec,
+                                                                     &arg5_codec,
+                                                                     &arg6_codec,
+                                                                     &arg7_codec,
+                                                                     &arg8_codec,
+                                                                     &arg9_codec,
+                                                                     &arg10_codec,
+                                                                     &arg11_codec,
+                                                                     &p_arg12_codec,
+                                                                     &arg12_len_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void transmit_at_cancel_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("TRANSMIT_AT_CANCEL pack",
+          (nrf_802154_spinel_codec_transmit_at_cancel_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_TRANSMIT_AT_CANCEL) == 0));
+    CHECK("TRANSMIT_AT_CANCEL unpack", nrf_802154_spinel_codec_transmit_at_cancel_unpack(m_expected, 0U) == 0);
+}
+
+static void transmit_at_cancel_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TRANSMIT_AT_CANCEL_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_transmit_at_cancel_ret_pack(m_packed,
+                                                                        sizeof(m_packed),
+                                                                        arg0);
+
+        CHECK("TRANSMIT_AT_CANCEL_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_transmit_at_cancel_ret_pack(m_packed,
+                                                                            (size_t)len - 1U,
+                                                                            arg0);
+
+            CHECK("TRANSMIT_AT_CANCEL_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TRANSMIT_AT_CANCEL_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_transmit_at_cancel_ret_unpack(m_expected,
+                                                                              cut,
+                                                                              &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("TRANSMIT_AT_CANCEL_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TRANSMIT_AT_CANCEL_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TRANSMIT_AT_CANCEL_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_transmit_at_cancel_ret_pack(m_packed,
+                                                                          sizeof(m_packed),
+                                                                          arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TRANSMIT_AT_CANCEL_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_transmit_at_cancel_ret_unpack(m_expected,
+                                                                            (size_t)len,
+                                                                            &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void transmit_csma_ca_raw_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool            arg0                 = (rand_get() & 1U) != 0U;
+        bool            arg1                 = (rand_get() & 1U) != 0U;
+        bool            arg2                 = (rand_get() & 1U) != 0U;
+        int8_t          arg3                 = (int8_t)rand_get();
+        bool            arg4                 = (rand_get() & 1U) != 0U;
+        uint8_t         arg5                 = (uint8_t)rand_get();
+        uint32_t        arg6                 = (uint32_t)rand_get();
+        size_t          arg7_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg7_data[TEST_DATA_MAX_LEN];
+        bool            arg0_interpreter     = false;
+        bool            arg0_codec           = false;
+        bool            arg1_interpreter     = false;
+        bool            arg1_codec           = false;
+        bool            arg2_interpreter     = false;
+        bool            arg2_codec           = false;
+        int8_t          arg3_interpreter     = 0;
+        int8_t          arg3_codec           = 0;
+        bool            arg4_interpreter     = false;
+        bool            arg4_codec           = false;
+        uint8_t         arg5_interpreter     = 0;
+        uint8_t         arg5_codec           = 0;
+        uint32_t        arg6_interpreter     = 0;
+        uint32_t        arg6_codec           = 0;
+        const uint8_t * p_arg7_interpreter   = NULL;
+        const void    * p_arg7_codec         = NULL;
+        unsigned int    arg7_len_interpreter = 0U;
+        size_t          arg7_len_codec       = 0U;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg7_data, arg7_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW,
+                                   arg0,
+                                   arg1,
+                                   arg2,
+                                   arg3,
+                                   arg4,
+                                   arg5,
+                                   arg6,
+                                   arg7_data,
+                                   (unsigned int)arg7_len);
+        codec_len = nrf_802154_spinel_codec_transmit_csma_ca_raw_pack(m_packed,
+                                                                      sizeof(m_packed),
+                                                                      arg0,
+                                                                      arg1,
+                                                                      arg2,
+                                                                      arg3,
+                                                                      arg4,
+                                                                      arg5,
+                                                                      arg6,
+                                                                      arg7_data,
+                                                                      arg7_len);
+
+        CHECK("TRANSMIT_CSMA_CA_RAW pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_transmit_csma_ca_raw_pack(m_packed,
+                                                                          (size_t)len - 1U,
+                                                                          arg0,
+                                                                          arg1,
+                                                                          arg2,
+                                                                          arg3,
+                                                                          arg4,
+                                                                          arg5,
+                                                                          arg6,
+                                                                          arg7_data,
+                                                                          arg7_len);
+
+            CHECK("TRANSMIT_CSMA_CA_RAW pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW,
+                                                                    &arg0_interpreter,
+                                                                    &arg1_interpreter,
+                                                                    &arg2_interpreter,
+                                                                    &arg3_interpreter,
+                                                                    &arg4_interpreter,
+                                                                    &arg5_interpreter,
+                                                                    &arg6_interpreter,
+                                                                    &p_arg7_interpreter,
+                                                                    &arg7_len_interpreter);
+            codec_len = nrf_802154_spinel_codec_transmit_csma_ca_raw_unpack(m_expected,
+                                                                            cut,
+                                                                            &arg0_codec,
+                                                                            &arg1_codec,
+                                                                            &arg2_codec,
+                                                                            &arg3_codec,
+                                                                            &arg4_codec,
+                                                                            &arg5_codec,
+                                                                            &arg6_codec,
+                                                                            &p_arg7_codec,
+                                                                            &arg7_len_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("TRANSMIT_CSMA_CA_RAW unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TRANSMIT_CSMA_CA_RAW unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  (arg1_codec == arg1_interpreter) &&
+                  (arg1_codec == arg1) &&
+                  (arg2_codec == arg2_interpreter) &&
+                  (arg2_codec == arg2) &&
+                  (arg3_codec == arg3_interpreter) &&
+                  (arg3_codec == arg3) &&
+                  (arg4_codec == arg4_interpreter) &&
+                  (arg4_codec == arg4) &&
+                  (arg5_codec == arg5_interpreter) &&
+                  (arg5_codec == arg5) &&
+                  (arg6_codec == arg6_interpreter) &&
+                  (arg6_codec == arg6) &&
+                  ((const void *)p_arg7_interpreter == p_arg7_codec) &&
+                  (arg7_len_interpreter == arg7_len_codec));
+        }
+
+        CHECK("TRANSMIT_CSMA_CA_RAW unpacked data",
+              (arg7_len_codec == arg7_len) &&
+              (memcmp(p_arg7_codec, arg7_data, arg7_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW,
+                                           arg0,
+                                           arg1,
+                                           arg2,
+                                           arg3,
+                                           arg4,
+                                           arg5,
+                                           arg6,
+                                           arg7_data,
+                                           (unsigned int)arg7_len);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_transmit_csma_ca_raw_pack(m_packed,
+                                                                        sizeof(m_packed),
+                                                                        arg0,
+                                                                        arg1,
+                                                                        arg2,
+                                                                        arg3,
+                                                                        arg4,
+                                                                        arg5,
+                                                                        arg6,
+                                                                        arg7_data,
+                                                                        arg7_len);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW,
+                                             &arg0_interpreter,
+                                             &arg1_interpreter,
+                                             &arg2_interpreter,
+                                             &arg3_interpreter,
+                                             &arg4_interpreter,
+                                             &arg5_interpreter,
+                                             &arg6_interpreter,
+                                             &p_arg7_interpreter,
+                                             &arg7_len_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_transmit_csma_ca_raw_unpack(m_expected,
+                                                                          (size_t)len,
+                                                                          &arg0_codec,
+                                                                          &arg1_codec,
+                                                                          &arg2_codec,
+                                                                          &arg3_codec,
+                                                                          &arg4_codec,
+                                                                          &arg5_codec,
+                                                                          &arg6_codec,
+                                                                          &p_arg7_codec,
+                                                                          &arg7_len_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void transmit_csma_ca_raw_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_transmit_csma_ca_raw_ret_pack(m_packed,
+                                                                          sizeof(m_packed),
+                                                                          arg0);
+
+        CHECK("TRANSMIT_CSMA_CA_RAW_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_transmit_csma_ca_raw_ret_pack(m_packed,
+                                                                              (size_t)len - 1U,
+                                                                              arg0);
+
+            CHECK("TRANSMIT_CSMA_CA_RAW_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_transmit_csma_ca_raw_ret_unpack(m_expected,
+                                                                                cut,
+                                                                                &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("TRANSMIT_CSMA_CA_RAW_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TRANSMIT_CSMA_CA_RAW_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_transmit_csma_ca_raw_ret_pack(m_packed,
+                                                                            sizeof(m_packed),
+                                                                            arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TRANSMIT_CSMA_CA_RAW_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_transmit_csma_ca_raw_ret_unpack(m_expected,
+                                                                              (size_t)len,
+                                                                              &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void transmit_failed_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint32_t        arg0                 = (uint32_t)rand_get();
+        size_t          arg1_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg2                 = (uint8_t)rand_get();
+        bool            arg3                 = (rand_get() & 1U) != 0U;
+        bool            arg4                 = (rand_get() & 1U) != 0U;
+        uint8_t         arg5                 = (uint8_t)rand_get();
+        uint8_t         arg6                 = (uint8_t)rand_get();
+        uint8_t         arg7                 = (uint8_t)rand_get();
+        uint8_t         arg1_data[TEST_DATA_MAX_LEN];
+        uint32_t        arg0_interpreter     = 0;
+        uint32_t        arg0_codec           = 0;
+        const uint8_t * p_arg1_interpreter   = NULL;
+        const void    * p_arg1_codec         = NULL;
+        unsigned int    arg1_len_interpreter = 0U;
+        size_t          arg1_len_codec       = 0U;
+        uint8_t         arg2_interpreter     = 0;
+        uint8_t         arg2_codec           = 0;
+        bool            arg3_interpreter     = false;
+        bool            arg3_codec           = false;
+        bool            arg4_interpreter     = false;
+        bool            arg4_codec           = false;
+        uint8_t         arg5_interpreter     = 0;
+        uint8_t         arg5_codec           = 0;
+        uint8_t         arg6_interpreter     = 0;
+        uint8_t         arg6_codec           = 0;
+        uint8_t         arg7_interpreter     = 0;
+        uint8_t         arg7_codec           = 0;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg1_data, arg1_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED,
+                                   arg0,
+                                   arg1_data,
+                                   (unsigned int)arg1_len,
+                                   arg2,
+                                   arg3,
+                                   arg4,
+                                   arg5,
+                                   arg6,
+                                   arg7);
+        codec_len = nrf_802154_spinel_codec_transmit_failed_pack(m_packed,
+                                                                 sizeof(m_packed),
+                                                                 arg0,
+                                                                 arg1_data,
+                                                                 arg1_len,
+                                                                 arg2,
+                                                                 arg3,
+                                                                 arg4,
+                                                                 arg5,
+                                                                 arg6,
+                                                                 arg7);
+
+        CHECK("TRANSMIT_FAILED pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_transmit_failed_pack(m_packed,
+                                                                     (size_t)len - 1U,
+                                                                     arg0,
+                                                                     arg1_data,
+                                                                     arg1_len,
+                                                                     arg2,
+                                                                     arg3,
+                                                                     arg4,
+                                                                     arg5,
+                                                                     arg6,
+                                                                     arg7);
+
+            CHECK("TRANSMIT_FAILED pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED,
+                                                                    &arg0_interpreter,
+                                                                    &p_arg1_interpreter,
+                                                                    &arg1_len_interpreter,
+                                                                    &arg2_interpreter,
+                                                                    &arg3_interpreter,
+                                                                    &arg4_interpreter,
+                                                                    &arg5_interpreter,
+                                                                    &arg6_interpreter,
+                                                                    &arg7_interpreter);
+            codec_len = nrf_802154_spinel_codec_transmit_failed_unpack(m_expected,
+                                                                       cut,
+                                                                       &arg0_codec,
+                                                                       &p_arg1_codec,
+                                                                       &arg1_len_codec,
+                                                                       &arg2_codec,
+                                                                       &arg3_codec,
+                                                                       &arg4_codec,
+                                                                       &arg5_codec,
+                                                                       &arg6_codec,
+                                                                       &arg7_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("TRANSMIT_FAILED unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TRANSMIT_FAILED unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  ((const void *)p_arg1_interpreter == p_arg1_codec) &&
+                  (arg1_len_interpreter == arg1_len_codec) &&
+                  (arg2_codec == arg2_interpreter) &&
+                  (arg2_codec == arg2) &&
+                  (arg3_codec == arg3_interpreter) &&
+                  (arg3_codec == arg3) &&
+                  (arg4_codec == arg4_interpreter) &&
+                  (arg4_codec == arg4) &&
+                  (arg5_codec == arg5_interpreter) &&
+                  (arg5_codec == arg5) &&
+                  (arg6_codec == arg6_interpreter) &&
+                  (arg6_codec == arg6) &&
+                  (arg7_codec == arg7_interpreter) &&
+                  (arg7_codec == arg7));
+        }
+
+        CHECK("TRANSMIT_FAILED unpacked data",
+              (arg1_len_codec == arg1_len) &&
+              (memcmp(p_arg1_codec, arg1_data, arg1_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED,
+                                           arg0,
+                                           arg1_data,
+                                           (unsigned int)arg1_len,
+                                           arg2,
+                                           arg3,
+                                           arg4,
+                                           arg5,
+                                           arg6,
+                                           arg7);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_transmit_failed_pack(m_packed,
+                                                                   sizeof(m_packed),
+                                                                   arg0,
+                                                                   arg1_data,
+                                                                   arg1_len,
+                                                                   arg2,
+                                                                   arg3,
+                                                                   arg4,
+                                                                   arg5,
+                                                                   arg6,
+                                                                   arg7);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TRANSMIT_FAILED,
+                                             &arg0_interpreter,
+                                             &p_arg1_interpreter,
+                                             &arg1_len_interpreter,
+                                             &arg2_interpreter,
+                                             &arg3_interpreter,
+                                             &arg4_interpreter,
+                                             &arg5_interpreter,
+                                             &arg6_interpreter,
+                                             &arg7_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_transmit_failed_unpack(m_expected,
+                                                                     (size_t)len,
+                                                                     &arg0_codec,
+                                                                     &p_arg1_codec,
+                                                                     &arg1_len_codec,
+                                                                     &arg2_codec,
+                                                                     &arg3_codec,
+                                                                     &arg4_codec,
+                                                                     &arg5_codec,
+                                                                     &arg6_codec,
+                                                                     &arg7_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void transmit_raw_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool            arg0                 = (rand_get() & 1U) != 0U;
+        bool            arg1                 = (rand_get() & 1U) != 0U;
+        bool            arg2                 = (rand_get() & 1U) != 0U;
+        bool            arg3                 = (rand_get() & 1U) != 0U;
+        int8_t          arg4                 = (int8_t)rand_get();
+        bool            arg5                 = (rand_get() & 1U) != 0U;
+        uint8_t         arg6                 = (uint8_t)rand_get();
+        uint32_t        arg7                 = (uint32_t)rand_get();
+        size_t          arg8_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg8_data[TEST_DATA_MAX_LEN];
+        bool            arg0_interpreter     = false;
+        bool            arg0_codec           = false;
+        bool            arg1_interpreter     = false;
+        bool            arg1_codec           = false;
+        bool            arg2_interpreter     = false;
+        bool            arg2_codec           = false;
+        bool            arg3_interpreter     = false;
+        bool            arg3_codec           = false;
+        int8_t          arg4_interpreter     = 0;
+        int8_t          arg4_codec           = 0;
+        bool            arg5_interpreter     = false;
+        bool            arg5_codec           = false;
+        uint8_t         arg6_interpreter     = 0;
+        uint8_t         arg6_codec           = 0;
+        uint32_t        arg7_interpreter     = 0;
+        uint32_t        arg7_codec           = 0;
+        const uint8_t * p_arg8_interpreter   = NULL;
+        const void    * p_arg8_codec         = NULL;
+        unsigned int    arg8_len_interpreter = 0U;
+        size_t          arg8_len_codec       = 0U;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg8_data, arg8_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW,
+                                   arg0,
+                                   arg1,
+                                   arg2,
+                                   arg3,
+                                   arg4,
+                                   arg5,
+                                   arg6,
+                                   arg7,
+                                   arg8_data,
+                                   (unsigned int)arg8_len);
+        codec_len = nrf_802154_spinel_codec_transmit_raw_pack(m_packed,
+                                                              sizeof(m_packed),
+                                                              arg0,
+                                                              arg1,
+                                                              arg2,
+                                                              arg3,
+                                                              arg4,
+                                                              arg5,
+                                                              arg6,
+                                                              arg7,
+                                                              arg8_data,
+                                                              arg8_len);
+
+        CHECK("TRANSMIT_RAW pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_transmit_raw_pack(m_packed,
+                                                                  (size_t)len - 1U,
+                                                                  arg0,
+                                                                  arg1,
+                                                                  arg2,
+                                                                  arg3,
+                                                                  arg4,
+                                                                  arg5,
+                                                                  arg6,
+                                                                  arg7,
+                                                                  arg8_data,
+                                                                  arg8_len);
+
+            CHECK("TRANSMIT_RAW pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW,
+                                                                    &arg0_interpreter,
+                                                                    &arg1_interpreter,
+                                                                    &arg2_interpreter,
+                                                                    &arg3_interpreter,
+                                                                    &arg4_interpreter,
+                                                                    &arg5_interpreter,
+                                                                    &arg6_interpreter,
+                                                                    &arg7_interpreter,
+                                                                    &p_arg8_interpreter,
+                                                                    &arg8_len_interpreter);
+            codec_len = nrf_802154_spinel_codec_transmit_raw_unpack(m_expected,
+                                                                    cut,
+                                                                    &arg0_codec,
+                                                                    &arg1_codec,
+                                                                    &arg2_codec,
+                                                                    &arg3_codec,
+                                                                    &arg4_codec,
+                                                                    &arg5_codec,
+                                                                    &arg6_codec,
+                                                                    &arg7_codec,
+                                                                    &p_arg8_codec,
+                                                                    &arg8_len_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("TRANSMIT_RAW unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TRANSMIT_RAW unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  (arg1_codec == arg1_interpreter) &&
+                  (arg1_codec == arg1) &&
+                  (arg2_codec == arg2_interpreter) &&
+                  (arg2_codec == arg2) &&
+                  (arg3_codec == arg3_interpreter) &&
+                  (arg3_codec == arg3) &&
+                  (arg4_codec == arg4_interpreter) &&
+                  (arg4_codec == arg4) &&
+                  (arg5_codec == arg5_interpreter) &&
+                  (arg5_codec == arg5) &&
+                  (arg6_codec == arg6_interpreter) &&
+                  (arg6_codec == arg6) &&
+                  (arg7_codec == arg7_interpreter) &&
+                  (arg7_codec == arg7) &&
+                  ((const void *)p_arg8_interpreter == p_arg8_codec) &&
+                  (arg8_len_interpreter == arg8_len_codec));
+        }
+
+        CHECK("TRANSMIT_RAW unpacked data",
+              (arg8_len_codec == arg8_len) &&
+              (memcmp(p_arg8_codec, arg8_data, arg8_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW,
+                                           arg0,
+                                           arg1,
+                                           arg2,
+                                           arg3,
+                                           arg4,
+                                           arg5,
+                                           arg6,
+                                           arg7,
+                                           arg8_data,
+                                           (unsigned int)arg8_len);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_transmit_raw_pack(m_packed,
+                                                                sizeof(m_packed),
+                                                                arg0,
+                                                                arg1,
+                                                                arg2,
+                                                                arg3,
+                                                                arg4,
+                                                                arg5,
+                                                                arg6,
+                                                                arg7,
+                                                                arg8_data,
+                                                                arg8_len);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW,
+                                             &arg0_interpreter,
+                                             &arg1_interpreter,
+                                             &arg2_interpreter,
+                                             &arg3_interpreter,
+                                             &arg4_interpreter,
+                                             &arg5_interpreter,
+                                             &arg6_interpreter,
+                                             &arg7_interpreter,
+                                             &p_arg8_interpreter,
+                                             &arg8_len_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_transmit_raw_unpack(m_expected,
+                                                                  (size_t)len,
+                                                                  &arg0_codec,
+                                                                  &arg1_codec,
+                                                                  &arg2_codec,
+                                                                  &arg3_codec,
+                                                                  &arg4_codec,
+                                                                  &arg5_codec,
+                                                                  &arg6_codec,
+                                                                  &arg7_codec,
+                                                                  &p_arg8_codec,
+                                                                  &arg8_len_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void transmit_raw_at_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool            arg0                 = (rand_get() & 1U) != 0U;
+        bool            arg1                 = (rand_get() & 1U) != 0U;
+        bool            arg2                 = (rand_get() & 1U) != 0U;
+        uint8_t         arg3                 = (uint8_t)rand_get();
+        bool            arg4                 = (rand_get() & 1U) != 0U;
+        int8_t          arg5                 = (int8_t)rand_get();
+        uint8_t         arg6                 = (uint8_t)rand_get();
+        uint64_t        arg7                 = (uint64_t)rand64_get();
+        uint32_t        arg8                 = (uint32_t)rand_get();
+        size_t          arg9_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg9_data[TEST_DATA_MAX_LEN];
+        bool            arg0_interpreter     = false;
+        bool            arg0_codec           = false;
+        bool            arg1_interpreter     = false;
+        bool            arg1_codec           = false;
+        bool            arg2_interpreter     = false;
+        bool            arg2_codec           = false;
+        uint8_t         arg3_interpreter     = 0;
+        uint8_t         arg3_codec           = 0;
+        bool            arg4_interpreter     = false;
+        bool            arg4_codec           = false;
+        int8_t          arg5_interpreter     = 0;
+        int8_t          arg5_codec           = 0;
+        uint8_t         arg6_interpreter     = 0;
+        uint8_t         arg6_codec           = 0;
+        uint64_t        arg7_interpreter     = 0;
+        uint64_t        arg7_codec           = 0;
+        uint32_t        arg8_interpreter     = 0;
+        uint32_t        arg8_codec           = 0;
+        const uint8_t * p_arg9_interpreter   = NULL;
+        const void    * p_arg9_codec         = NULL;
+        unsigned int    arg9_len_interpreter = 0U;
+        size_t          arg9_len_codec       = 0U;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg9_data, arg9_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT,
+                                   arg0,
+                                   arg1,
+                                   arg2,
+                                   arg3,
+                                   arg4,
+                                   arg5,
+                                   arg6,
+                                   arg7,
+                                   arg8,
+                                   arg9_data,
+                                   (unsigned int)arg9_len);
+        codec_len = nrf_802154_spinel_codec_transmit_raw_at_pack(m_packed,
+                                                                 sizeof(m_packed),
+                                                                 arg0,
+                                                                 arg1,
+                                                                 arg2,
+                                                                 arg3,
+                                                                 arg4,
+                                                                 arg5,
+                                                                 arg6,
+                                                                 arg7,
+                                                                 arg8,
+                                                                 arg9_data,
+                                                                 arg9_len);
+
+        CHECK("TRANSMIT_RAW_AT pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_transmit_raw_at_pack(m_packed,
+                                                                     (size_t)len - 1U,
+                                                                     arg0,
+                                                                     arg1,
+                                                                     arg2,
+                                                                     arg3,
+                                                                     arg4,
+                                                                     arg5,
+                                                                     arg6,
+                                                                     arg7,
+                                                                     arg8,
+                                                                     arg9_data,
+                                                                     arg9_len);
+
+            CHECK("TRANSMIT_RAW_AT pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT,
+                                                                    &arg0_interpreter,
+                                                                    &arg1_interpreter,
+                                                                    &arg2_interpreter,
+                                                                    &arg3_interpreter,
+                                                                    &arg4_interpreter,
+                                                                    &arg5_interpreter,
+                                                                    &arg6_interpreter,
+                                                                    &arg7_interpreter,
+                                                                    &arg8_interpreter,
+                                                                    &p_arg9_interpreter,
+                                                                    &arg9_len_interpreter);
+            codec_len = nrf_802154_spinel_codec_transmit_raw_at_unpack(m_expected,
+                                                                       cut,
+                                                                       &arg0_codec,
+                                                                       &arg1_codec,
+                                                                       &arg2_codec,
+                                                                       &arg3_codec,
+                                                                       &arg4_codec,
+                                                                       &arg5_codec,
+                                                                       &arg6_codec,
+                                                                       &arg7_codec,
+                                                                       &arg8_codec,
+                                                                       &p_arg9_codec,
+                                                                       &arg9_len_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("TRANSMIT_RAW_AT unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TRANSMIT_RAW_AT unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  (arg1_codec == arg1_interpreter) &&
+                  (arg1_codec == arg1) &&
+                  (arg2_codec == arg2_interpreter) &&
+                  (arg2_codec == arg2) &&
+                  (arg3_codec == arg3_interpreter) &&
+                  (arg3_codec == arg3) &&
+                  (arg4_codec == arg4_interpreter) &&
+                  (arg4_codec == arg4) &&
+                  (arg5_codec == arg5_interpreter) &&
+                  (arg5_codec == arg5) &&
+                  (arg6_codec == arg6_interpreter) &&
+                  (arg6_codec == arg6) &&
+                  (arg7_codec == arg7_interpreter) &&
+                  (arg7_codec == arg7) &&
+                  (arg8_codec == arg8_interpreter) &&
+                  (arg8_codec == arg8) &&
+                  ((const void *)p_arg9_interpreter == p_arg9_codec) &&
+                  (arg9_len_interpreter == arg9_len_codec));
+        }
+
+        CHECK("TRANSMIT_RAW_AT unpacked data",
+              (arg9_len_codec == arg9_len) &&
+              (memcmp(p_arg9_codec, arg9_data, arg9_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT,
+                                           arg0,
+                                           arg1,
+                                           arg2,
+                                           arg3,
+                                           arg4,
+                                           arg5,
+                                           arg6,
+                                           arg7,
+                                           arg8,
+                                           arg9_data,
+                                           (unsigned int)arg9_len);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_transmit_raw_at_pack(m_packed,
+                                                                   sizeof(m_packed),
+                                                                   arg0,
+                                                                   arg1,
+                                                                   arg2,
+                                                                   arg3,
+                                                                   arg4,
+                                                                   arg5,
+                                                                   arg6,
+                                                                   arg7,
+                                                                   arg8,
+                                                                   arg9_data,
+                                                                   arg9_len);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT,
+                                             &arg0_interpreter,
+                                             &arg1_interpreter,
+                                             &arg2_interpreter,
+                                             &arg3_interpreter,
+                                             &arg4_interpreter,
+                                             &arg5_interpreter,
+                                             &arg6_interpreter,
+                                             &arg7_interpreter,
+                                             &arg8_interpreter,
+                                             &p_arg9_interpreter,
+                                             &arg9_len_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_transmit_raw_at_unpack(m_expected,
+                                                                     (size_t)len,
+                                                                     &arg0_codec,
+                                                                     &arg1_codec,
+                                                                     &arg2_codec,
+                                                                     &arg3_codec,
+                                                                     &arg4_codec,
+                                                                     &arg5_codec,
+                                                                     &arg6_codec,
+                                                                     &arg7_codec,
+                                                                     &arg8_codec,
+                                                                     &p_arg9_codec,
+                                                                     &arg9_len_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void transmit_raw_at_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_transmit_raw_at_ret_pack(m_packed,
+                                                                     sizeof(m_packed),
+                                                                     arg0);
+
+        CHECK("TRANSMIT_RAW_AT_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_transmit_raw_at_ret_pack(m_packed,
+                                                                         (size_t)len - 1U,
+                                                                         arg0);
+
+            CHECK("TRANSMIT_RAW_AT_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_transmit_raw_at_ret_unpack(m_expected,
+                                                                           cut,
+                                                                           &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("TRANSMIT_RAW_AT_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TRANSMIT_RAW_AT_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_transmit_raw_at_ret_pack(m_packed,
+                                                                       sizeof(m_packed),
+                                                                       arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_AT_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_transmit_raw_at_ret_unpack(m_expected,
+                                                                         (size_t)len,
+                                                                         &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void transmit_raw_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_transmit_raw_ret_pack(m_packed,
+                                                                  sizeof(m_packed),
+                                                                  arg0);
+
+        CHECK("TRANSMIT_RAW_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_transmit_raw_ret_pack(m_packed,
+                                                                      (size_t)len - 1U,
+                                                                      arg0);
+
+            CHECK("TRANSMIT_RAW_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_transmit_raw_ret_unpack(m_expected,
+                                                                        cut,
+                                                                        &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("TRANSMIT_RAW_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TRANSMIT_RAW_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_transmit_raw_ret_pack(m_packed,
+                                                                    sizeof(m_packed),
+                                                                    arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TRANSMIT_RAW_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_transmit_raw_ret_unpack(m_expected,
+                                                                      (size_t)len,
+                                                                      &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void tx_ack_started_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        size_t          arg0_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg0_data[TEST_DATA_MAX_LEN];
+        const uint8_t * p_arg0_interpreter   = NULL;
+        const void    * p_arg0_codec         = NULL;
+        unsigned int    arg0_len_interpreter = 0U;
+        size_t          arg0_len_codec       = 0U;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg0_data, arg0_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TX_ACK_STARTED,
+                                   arg0_data,
+                                   (unsigned int)arg0_len);
+        codec_len = nrf_802154_spinel_codec_tx_ack_started_pack(m_packed,
+                                                                sizeof(m_packed),
+                                                                arg0_data,
+                                                                arg0_len);
+
+        CHECK("TX_ACK_STARTED pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_tx_ack_started_pack(m_packed,
+                                                                    (size_t)len - 1U,
+                                                                    arg0_data,
+                                                                    arg0_len);
+
+            CHECK("TX_ACK_STARTED pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TX_ACK_STARTED,
+                                                                    &p_arg0_interpreter,
+                                                                    &arg0_len_interpreter);
+            codec_len = nrf_802154_spinel_codec_tx_ack_started_unpack(m_expected,
+                                                                      cut,
+                                                                      &p_arg0_codec,
+                                                                      &arg0_len_codec);
+
+            // The last data field is not prefixed, so it can be cut short
+            if ((cut < (size_t)len) && (codec_len < 0))
+            {
+                CHECK("TX_ACK_STARTED unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TX_ACK_STARTED unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  ((const void *)p_arg0_interpreter == p_arg0_codec) &&
+                  (arg0_len_interpreter == arg0_len_codec));
+        }
+
+        CHECK("TX_ACK_STARTED unpacked data",
+              (arg0_len_codec == arg0_len) &&
+              (memcmp(p_arg0_codec, arg0_data, arg0_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TX_ACK_STARTED,
+                                           arg0_data,
+                                           (unsigned int)arg0_len);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_tx_ack_started_pack(m_packed,
+                                                                  sizeof(m_packed),
+                                                                  arg0_data,
+                                                                  arg0_len);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TX_ACK_STARTED,
+                                             &p_arg0_interpreter,
+                                             &arg0_len_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_tx_ack_started_unpack(m_expected,
+                                                                    (size_t)len,
+                                                                    &p_arg0_codec,
+                                                                    &arg0_len_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void tx_power_get_test(uint32_t runs)
+{
+    uint32_t run = 0U;
+
+    (void)runs;
+
+    CHECK("TX_POWER_GET pack",
+          (nrf_802154_spinel_codec_tx_power_get_pack(m_packed, sizeof(m_packed)) == 0) &&
+          (spinel_datatype_pack(m_expected,
+                                sizeof(m_expected),
+                                SPINEL_DATATYPE_NRF_802154_TX_POWER_GET) == 0));
+    CHECK("TX_POWER_GET unpack", nrf_802154_spinel_codec_tx_power_get_unpack(m_expected, 0U) == 0);
+}
+
+static void tx_power_get_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        int8_t         arg0             = (int8_t)rand_get();
+        int8_t         arg0_interpreter = 0;
+        int8_t         arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TX_POWER_GET_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_tx_power_get_ret_pack(m_packed,
+                                                                  sizeof(m_packed),
+                                                                  arg0);
+
+        CHECK("TX_POWER_GET_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_tx_power_get_ret_pack(m_packed,
+                                                                      (size_t)len - 1U,
+                                                                      arg0);
+
+            CHECK("TX_POWER_GET_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TX_POWER_GET_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_tx_power_get_ret_unpack(m_expected,
+                                                                        cut,
+                                                                        &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("TX_POWER_GET_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TX_POWER_GET_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TX_POWER_GET_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_tx_power_get_ret_pack(m_packed,
+                                                                    sizeof(m_packed),
+                                                                    arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TX_POWER_GET_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_tx_power_get_ret_unpack(m_expected,
+                                                                      (size_t)len,
+                                                                      &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void tx_power_set_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        int8_t         arg0             = (int8_t)rand_get();
+        int8_t         arg0_interpreter = 0;
+        int8_t         arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TX_POWER_SET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_tx_power_set_pack(m_packed,
+                                                              sizeof(m_packed),
+                                                              arg0);
+
+        CHECK("TX_POWER_SET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_tx_power_set_pack(m_packed,
+                                                                  (size_t)len - 1U,
+                                                                  arg0);
+
+            CHECK("TX_POWER_SET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TX_POWER_SET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_tx_power_set_unpack(m_expected,
+                                                                    cut,
+                                                                    &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("TX_POWER_SET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TX_POWER_SET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TX_POWER_SET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_tx_power_set_pack(m_packed,
+                                                                sizeof(m_packed),
+                                                                arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TX_POWER_SET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_tx_power_set_unpack(m_expected,
+                                                                  (size_t)len,
+                                                                  &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void tx_queue_cancel_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint32_t       arg0             = (uint32_t)rand_get();
+        uint32_t       arg0_interpreter = 0;
+        uint32_t       arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TX_QUEUE_CANCEL,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_tx_queue_cancel_pack(m_packed,
+                                                                 sizeof(m_packed),
+                                                                 arg0);
+
+        CHECK("TX_QUEUE_CANCEL pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_tx_queue_cancel_pack(m_packed,
+                                                                     (size_t)len - 1U,
+                                                                     arg0);
+
+            CHECK("TX_QUEUE_CANCEL pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TX_QUEUE_CANCEL,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_tx_queue_cancel_unpack(m_expected,
+                                                                       cut,
+                                                                       &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("TX_QUEUE_CANCEL unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TX_QUEUE_CANCEL unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TX_QUEUE_CANCEL,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_tx_queue_cancel_pack(m_packed,
+                                                                   sizeof(m_packed),
+                                                                   arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TX_QUEUE_CANCEL,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_tx_queue_cancel_unpack(m_expected,
+                                                                     (size_t)len,
+                                                                     &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void tx_queue_cancel_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool           arg0             = (rand_get() & 1U) != 0U;
+        bool           arg0_interpreter = false;
+        bool           arg0_codec       = false;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TX_QUEUE_CANCEL_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_tx_queue_cancel_ret_pack(m_packed,
+                                                                     sizeof(m_packed),
+                                                                     arg0);
+
+        CHECK("TX_QUEUE_CANCEL_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_tx_queue_cancel_ret_pack(m_packed,
+                                                                         (size_t)len - 1U,
+                                                                         arg0);
+
+            CHECK("TX_QUEUE_CANCEL_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TX_QUEUE_CANCEL_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_tx_queue_cancel_ret_unpack(m_expected,
+                                                                           cut,
+                                                                           &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("TX_QUEUE_CANCEL_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TX_QUEUE_CANCEL_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TX_QUEUE_CANCEL_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_tx_queue_cancel_ret_pack(m_packed,
+                                                                       sizeof(m_packed),
+                                                                       arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TX_QUEUE_CANCEL_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_tx_queue_cancel_ret_unpack(m_expected,
+                                                                         (size_t)len,
+                                                                         &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void tx_queue_enqueue_raw_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t         arg0                 = (uint8_t)rand_get();
+        size_t          arg1_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg1_data[TEST_DATA_MAX_LEN];
+        uint8_t         arg0_interpreter     = 0;
+        uint8_t         arg0_codec           = 0;
+        const uint8_t * p_arg1_interpreter   = NULL;
+        const void    * p_arg1_codec         = NULL;
+        unsigned int    arg1_len_interpreter = 0U;
+        size_t          arg1_len_codec       = 0U;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg1_data, arg1_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW,
+                                   arg0,
+                                   arg1_data,
+                                   (unsigned int)arg1_len);
+        codec_len = nrf_802154_spinel_codec_tx_queue_enqueue_raw_pack(m_packed,
+                                                                      sizeof(m_packed),
+                                                                      arg0,
+                                                                      arg1_data,
+                                                                      arg1_len);
+
+        CHECK("TX_QUEUE_ENQUEUE_RAW pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_tx_queue_enqueue_raw_pack(m_packed,
+                                                                          (size_t)len - 1U,
+                                                                          arg0,
+                                                                          arg1_data,
+                                                                          arg1_len);
+
+            CHECK("TX_QUEUE_ENQUEUE_RAW pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW,
+                                                                    &arg0_interpreter,
+                                                                    &p_arg1_interpreter,
+                                                                    &arg1_len_interpreter);
+            codec_len = nrf_802154_spinel_codec_tx_queue_enqueue_raw_unpack(m_expected,
+                                                                            cut,
+                                                                            &arg0_codec,
+                                                                            &p_arg1_codec,
+                                                                            &arg1_len_codec);
+
+            // The last data field is not prefixed, so it can be cut short
+            if ((cut < (size_t)len) && (codec_len < 0))
+            {
+                CHECK("TX_QUEUE_ENQUEUE_RAW unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TX_QUEUE_ENQUEUE_RAW unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  ((const void *)p_arg1_interpreter == p_arg1_codec) &&
+                  (arg1_len_interpreter == arg1_len_codec));
+        }
+
+        CHECK("TX_QUEUE_ENQUEUE_RAW unpacked data",
+              (arg1_len_codec == arg1_len) &&
+              (memcmp(p_arg1_codec, arg1_data, arg1_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW,
+                                           arg0,
+                                           arg1_data,
+                                           (unsigned int)arg1_len);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_tx_queue_enqueue_raw_pack(m_packed,
+                                                                        sizeof(m_packed),
+                                                                        arg0,
+                                                                        arg1_data,
+                                                                        arg1_len);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW,
+                                             &arg0_interpreter,
+                                             &p_arg1_interpreter,
+                                             &arg1_len_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_tx_queue_enqueue_raw_unpack(m_expected,
+                                                                          (size_t)len,
+                                                                          &arg0_codec,
+                                                                          &p_arg1_codec,
+                                                                          &arg1_len_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void tx_queue_enqueue_raw_entry_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        bool            arg0                  = (rand_get() & 1U) != 0U;
+        bool            arg1                  = (rand_get() & 1U) != 0U;
+        bool            arg2                  = (rand_get() & 1U) != 0U;
+        bool            arg3                  = (rand_get() & 1U) != 0U;
+        uint8_t         arg4                  = (uint8_t)rand_get();
+        bool            arg5                  = (rand_get() & 1U) != 0U;
+        int8_t          arg6                  = (int8_t)rand_get();
+        bool            arg7                  = (rand_get() & 1U) != 0U;
+        uint8_t         arg8                  = (uint8_t)rand_get();
+        uint32_t        arg9                  = (uint32_t)rand_get();
+        size_t          arg10_len             = rand_get() % (TEST_DATA_MAX_LEN + 1U);
+        uint8_t         arg10_data[TEST_DATA_MAX_LEN];
+        bool            arg0_interpreter      = false;
+        bool            arg0_codec            = false;
+        bool            arg1_interpreter      = false;
+        bool            arg1_codec            = false;
+        bool            arg2_interpreter      = false;
+        bool            arg2_codec            = false;
+        bool            arg3_interpreter      = false;
+        bool            arg3_codec            = false;
+        uint8_t         arg4_interpreter      = 0;
+        uint8_t         arg4_codec            = 0;
+        bool            arg5_interpreter      = false;
+        bool            arg5_codec            = false;
+        int8_t          arg6_interpreter      = 0;
+        int8_t          arg6_codec            = 0;
+        bool            arg7_interpreter      = false;
+        bool            arg7_codec            = false;
+        uint8_t         arg8_interpreter      = 0;
+        uint8_t         arg8_codec            = 0;
+        uint32_t        arg9_interpreter      = 0;
+        uint32_t        arg9_codec            = 0;
+        const uint8_t * p_arg10_interpreter   = NULL;
+        const void    * p_arg10_codec         = NULL;
+        unsigned int    arg10_len_interpreter = 0U;
+        size_t          arg10_len_codec       = 0U;
+        spinel_ssize_t  len;
+        spinel_ssize_t  codec_len;
+
+        data_fill(arg10_data, arg10_len);
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW_ENTRY,
+                                   arg0,
+                                   arg1,
+                                   arg2,
+                                   arg3,
+                                   arg4,
+                                   arg5,
+                                   arg6,
+                                   arg7,
+                                   arg8,
+                                   arg9,
+                                   arg10_data,
+                                   (unsigned int)arg10_len);
+        codec_len = nrf_802154_spinel_codec_tx_queue_enqueue_raw_entry_pack(m_packed,
+                                                                            sizeof(m_packed),
+                                                                            arg0,
+                                                                            arg1,
+                                                                            arg2,
+                                                                            arg3,
+                                                                            arg4,
+                                                                            arg5,
+                                                                            arg6,
+                                                                            arg7,
+                                                                            arg8,
+                                                                            arg9,
+                                                                            arg10_data,
+                                                                            arg10_len);
+
+        CHECK("TX_QUEUE_ENQUEUE_RAW_ENTRY pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_tx_queue_enqueue_raw_entry_pack(m_packed,
+                                                                                (size_t)len - 1U,
+                                                                                arg0,
+                                                                                arg1,
+                                                                                arg2,
+                                                                                arg3,
+                                                                                arg4,
+                                                                                arg5,
+                                                                                arg6,
+                                                                                arg7,
+                                                                                arg8,
+                                                                                arg9,
+                                                                                arg10_data,
+                                                                                arg10_len);
+
+            CHECK("TX_QUEUE_ENQUEUE_RAW_ENTRY pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW_ENTRY,
+                                                                    &arg0_interpreter,
+                                                                    &arg1_interpreter,
+                                                                    &arg2_interpreter,
+                                                                    &arg3_interpreter,
+                                                                    &arg4_interpreter,
+                                                                    &arg5_interpreter,
+                                                                    &arg6_interpreter,
+                                                                    &arg7_interpreter,
+                                                                    &arg8_interpreter,
+                                                                    &arg9_interpreter,
+                                                                    &p_arg10_interpreter,
+                                                                    &arg10_len_interpreter);
+            codec_len = nrf_802154_spinel_codec_tx_queue_enqueue_raw_entry_unpack(m_expected,
+                                                                                  cut,
+                                                                                  &arg0_codec,
+                                                                                  &arg1_codec,
+                                                                                  &arg2_codec,
+                                                                                  &arg3_codec,
+                                                                                  &arg4_codec,
+                                                                                  &arg5_codec,
+                                                                                  &arg6_codec,
+                                                                                  &arg7_codec,
+                                                                                  &arg8_codec,
+                                                                                  &arg9_codec,
+                                                                                  &p_arg10_codec,
+                                                                                  &arg10_len_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("TX_QUEUE_ENQUEUE_RAW_ENTRY unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TX_QUEUE_ENQUEUE_RAW_ENTRY unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0) &&
+                  (arg1_codec == arg1_interpreter) &&
+                  (arg1_codec == arg1) &&
+                  (arg2_codec == arg2_interpreter) &&
+                  (arg2_codec == arg2) &&
+                  (arg3_codec == arg3_interpreter) &&
+                  (arg3_codec == arg3) &&
+                  (arg4_codec == arg4_interpreter) &&
+                  (arg4_codec == arg4) &&
+                  (arg5_codec == arg5_interpreter) &&
+                  (arg5_codec == arg5) &&
+                  (arg6_codec == arg6_interpreter) &&
+                  (arg6_codec == arg6) &&
+                  (arg7_codec == arg7_interpreter) &&
+                  (arg7_codec == arg7) &&
+                  (arg8_codec == arg8_interpreter) &&
+                  (arg8_codec == arg8) &&
+                  (arg9_codec == arg9_interpreter) &&
+                  (arg9_codec == arg9) &&
+                  ((const void *)p_arg10_interpreter == p_arg10_codec) &&
+                  (arg10_len_interpreter == arg10_len_codec));
+        }
+
+        CHECK("TX_QUEUE_ENQUEUE_RAW_ENTRY unpacked data",
+              (arg10_len_codec == arg10_len) &&
+              (memcmp(p_arg10_codec, arg10_data, arg10_len) == 0));
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW_ENTRY,
+                                           arg0,
+                                           arg1,
+                                           arg2,
+                                           arg3,
+                                           arg4,
+                                           arg5,
+                                           arg6,
+                                           arg7,
+                                           arg8,
+                                           arg9,
+                                           arg10_data,
+                                           (unsigned int)arg10_len);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_tx_queue_enqueue_raw_entry_pack(m_packed,
+                                                                              sizeof(m_packed),
+                                                                              arg0,
+                                                                              arg1,
+                                                                              arg2,
+                                                                              arg3,
+                                                                              arg4,
+                                                                              arg5,
+                                                                              arg6,
+                                                                              arg7,
+                                                                              arg8,
+                                                                              arg9,
+                                                                              arg10_data,
+                                                                              arg10_len);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW_ENTRY,
+                                             &arg0_interpreter,
+                                             &arg1_interpreter,
+                                             &arg2_interpreter,
+                                             &arg3_interpreter,
+                                             &arg4_interpreter,
+                                             &arg5_interpreter,
+                                             &arg6_interpreter,
+                                             &arg7_interpreter,
+                                             &arg8_interpreter,
+                                             &arg9_interpreter,
+                                             &p_arg10_interpreter,
+                                             &arg10_len_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_tx_queue_enqueue_raw_entry_unpack(m_expected,
+                                                                                (size_t)len,
+                                                                                &arg0_codec,
+                                                                                &arg1_codec,
+                                                                                &arg2_codec,
+                                                                                &arg3_codec,
+                                                                                &arg4_codec,
+                                                                                &arg5_codec,
+                                                                                &arg6_codec,
+                                                                                &arg7_codec,
+                                                                                &arg8_codec,
+                                                                                &arg9_codec,
+                                                                                &p_arg10_codec,
+                                                                                &arg10_len_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static void tx_queue_enqueue_raw_ret_test(uint32_t runs)
+{
+    for (uint32_t run = 0U; run < runs; run++)
+    {
+        uint8_t        arg0             = (uint8_t)rand_get();
+        uint8_t        arg0_interpreter = 0;
+        uint8_t        arg0_codec       = 0;
+        spinel_ssize_t len;
+        spinel_ssize_t codec_len;
+
+        len = spinel_datatype_pack(m_expected,
+                                   sizeof(m_expected),
+                                   SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW_RET,
+                                   arg0);
+        codec_len = nrf_802154_spinel_codec_tx_queue_enqueue_raw_ret_pack(m_packed,
+                                                                          sizeof(m_packed),
+                                                                          arg0);
+
+        CHECK("TX_QUEUE_ENQUEUE_RAW_RET pack",
+              (len >= 0) && (codec_len == len) &&
+              (memcmp(m_expected, m_packed, (size_t)len) == 0));
+
+        if (len > 0)
+        {
+            codec_len = nrf_802154_spinel_codec_tx_queue_enqueue_raw_ret_pack(m_packed,
+                                                                              (size_t)len - 1U,
+                                                                              arg0);
+
+            CHECK("TX_QUEUE_ENQUEUE_RAW_RET pack to a short buffer", codec_len < 0);
+        }
+
+        for (size_t cut = 0U; cut <= (size_t)len; cut++)
+        {
+            spinel_ssize_t interpreter_len = spinel_datatype_unpack(m_expected,
+                                                                    (spinel_size_t)cut,
+                                                                    SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW_RET,
+                                                                    &arg0_interpreter);
+            codec_len = nrf_802154_spinel_codec_tx_queue_enqueue_raw_ret_unpack(m_expected,
+                                                                                cut,
+                                                                                &arg0_codec);
+
+            if (cut < (size_t)len)
+            {
+                CHECK("TX_QUEUE_ENQUEUE_RAW_RET unpack of truncated data", codec_len < 0);
+                continue;
+            }
+
+            CHECK("TX_QUEUE_ENQUEUE_RAW_RET unpack",
+                  (codec_len == (spinel_ssize_t)cut) &&
+                  (interpreter_len == codec_len) &&
+                  (arg0_codec == arg0_interpreter) &&
+                  (arg0_codec == arg0));
+        }
+
+        uint64_t start = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_pack(m_expected,
+                                           sizeof(m_expected),
+                                           SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW_RET,
+                                           arg0);
+        }
+
+        uint64_t pack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_tx_queue_enqueue_raw_ret_pack(m_packed,
+                                                                            sizeof(m_packed),
+                                                                            arg0);
+        }
+
+        uint64_t pack_codec = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += spinel_datatype_unpack(m_expected,
+                                             (spinel_size_t)len,
+                                             SPINEL_DATATYPE_NRF_802154_TX_QUEUE_ENQUEUE_RAW_RET,
+                                             &arg0_interpreter);
+        }
+
+        uint64_t unpack_interpreter = time_get();
+
+        for (uint32_t i = 0U; i < TEST_BENCH_REPEAT; i++)
+        {
+            m_sink += nrf_802154_spinel_codec_tx_queue_enqueue_raw_ret_unpack(m_expected,
+                                                                              (size_t)len,
+                                                                              &arg0_codec);
+        }
+
+        m_times.pack_interpreter   += pack_interpreter - start;
+        m_times.pack_codec         += pack_codec - pack_interpreter;
+        m_times.unpack_interpreter += unpack_interpreter - pack_codec;
+        m_times.unpack_codec       += time_get() - unpack_interpreter;
+    }
+}
+
+static const test_t m_tests[] =
+{
+    {"ACK_DATA_CLEAR",                     ack_data_clear_test},
+    {"ACK_DATA_CLEAR_RET",                 ack_data_clear_ret_test},
+    {"ACK_DATA_REMOVE_ALL",                ack_data_remove_all_test},
+    {"ACK_DATA_SET",                       ack_data_set_test},
+    {"ACK_DATA_SET_RET",                   ack_data_set_ret_test},
+    {"AUTO_PENDING_BIT_SET",               auto_pending_bit_set_test},
+    {"BUFFER_FREE_RAW",                    buffer_free_raw_test},
+    {"CAPABILITIES_GET",                   capabilities_get_test},
+    {"CAPABILITIES_GET_RET",               capabilities_get_ret_test},
+    {"CCA",                                cca_test},
+    {"CCA_CFG_GET",                        cca_cfg_get_test},
+    {"CCA_CFG_GET_RET",                    cca_cfg_get_ret_test},
+    {"CCA_CFG_SET",                        cca_cfg_set_test},
+    {"CCA_DONE",                           cca_done_test},
+    {"CCA_FAILED",                         cca_failed_test},
+    {"CCA_RET",                            cca_ret_test},
+    {"CHANNEL_GET",                        channel_get_test},
+    {"CHANNEL_GET_RET",                    channel_get_ret_test},
+    {"CHANNEL_SET",                        channel_set_test},
+    {"CONTINUOUS_CARRIER",                 continuous_carrier_test},
+    {"CONTINUOUS_CARRIER_RET",             continuous_carrier_ret_test},
+    {"CSL_WRITER_ANCHOR_TIME_SET",         csl_writer_anchor_time_set_test},
+    {"CSL_WRITER_PERIOD_SET",              csl_writer_period_set_test},
+    {"CSMA_CA_BACKOFF_POLICY_SET",         csma_ca_backoff_policy_set_test},
+    {"CSMA_CA_BACKOFF_POLICY_SET_RET",     csma_ca_backoff_policy_set_ret_test},
+    {"CSMA_CA_MAX_BACKOFFS_GET",           csma_ca_max_backoffs_get_test},
+    {"CSMA_CA_MAX_BACKOFFS_GET_RET",       csma_ca_max_backoffs_get_ret_test},
+    {"CSMA_CA_MAX_BACKOFFS_SET",           csma_ca_max_backoffs_set_test},
+    {"CSMA_CA_MAX_BE_GET",                 csma_ca_max_be_get_test},
+    {"CSMA_CA_MAX_BE_GET_RET",             csma_ca_max_be_get_ret_test},
+    {"CSMA_CA_MAX_BE_SET",                 csma_ca_max_be_set_test},
+    {"CSMA_CA_MAX_BE_SET_RET",             csma_ca_max_be_set_ret_test},
+    {"CSMA_CA_MIN_BE_GET",                 csma_ca_min_be_get_test},
+    {"CSMA_CA_MIN_BE_GET_RET",             csma_ca_min_be_get_ret_test},
+    {"CSMA_CA_MIN_BE_SET",                 csma_ca_min_be_set_test},
+    {"CSMA_CA_MIN_BE_SET_RET",             csma_ca_min_be_set_ret_test},
+    {"ENERGY_DETECTED",                    energy_detected_test},
+    {"ENERGY_DETECTED_SWEEP",              energy_detected_sweep_test},
+    {"ENERGY_DETECTION",                   energy_detection_test},
+    {"ENERGY_DETECTION_FAILED",            energy_detection_failed_test},
+    {"ENERGY_DETECTION_RET",               energy_detection_ret_test},
+    {"ENERGY_DETECTION_SWEEP",             energy_detection_sweep_test},
+    {"ENERGY_DETECTION_SWEEP_CHANNEL",     energy_detection_sweep_channel_test},
+    {"ENERGY_DETECTION_SWEEP_RET",         energy_detection_sweep_ret_test},
+    {"EXTENDED_ADDRESS_SET",               extended_address_set_test},
+    {"IFS_MIN_LIFS_PERIOD_GET",            ifs_min_lifs_period_get_test},
+    {"IFS_MIN_LIFS_PERIOD_GET_RET",        ifs_min_lifs_period_get_ret_test},
+    {"IFS_MIN_LIFS_PERIOD_SET",            ifs_min_lifs_period_set_test},
+    {"IFS_MIN_SIFS_PERIOD_GET",            ifs_min_sifs_period_get_test},
+    {"IFS_MIN_SIFS_PERIOD_GET_RET",        ifs_min_sifs_period_get_ret_test},
+    {"IFS_MIN_SIFS_PERIOD_SET",            ifs_min_sifs_period_set_test},
+    {"IFS_MODE_GET",                       ifs_mode_get_test},
+    {"IFS_MODE_GET_RET",                   ifs_mode_get_ret_test},
+    {"IFS_MODE_SET",                       ifs_mode_set_test},
+    {"IFS_MODE_SET_RET",                   ifs_mode_set_ret_test},
+    {"MODULATED_CARRIER",                  modulated_carrier_test},
+    {"MODULATED_CARRIER_RET",              modulated_carrier_ret_test},
+    {"PAN_COORD_GET",                      pan_coord_get_test},
+    {"PAN_COORD_GET_RET",                  pan_coord_get_ret_test},
+    {"PAN_COORD_SET",                      pan_coord_set_test},
+    {"PAN_ID_SET",                         pan_id_set_test},
+    {"PENDING_BIT_FOR_ADDR_CLEAR",         pending_bit_for_addr_clear_test},
+    {"PENDING_BIT_FOR_ADDR_CLEAR_RET",     pending_bit_for_addr_clear_ret_test},
+    {"PENDING_BIT_FOR_ADDR_RESET",         pending_bit_for_addr_reset_test},
+    {"PENDING_BIT_FOR_ADDR_SET",           pending_bit_for_addr_set_test},
+    {"PENDING_BIT_FOR_ADDR_SET_RET",       pending_bit_for_addr_set_ret_test},
+    {"PROMISCUOUS_SET",                    promiscuous_set_test},
+    {"RECEIVE",                            receive_test},
+    {"RECEIVED_TIMESTAMP_RAW",             received_timestamp_raw_test},
+    {"RECEIVED_TIMESTAMP_RAW_BATCH",       received_timestamp_raw_batch_test},
+    {"RECEIVED_TIMESTAMP_RAW_BATCH_ENTRY", received_timestamp_raw_batch_entry_test},
+    {"RECEIVE_AT",                         receive_at_test},
+    {"RECEIVE_AT_CANCEL",                  receive_at_cancel_test},
+    {"RECEIVE_AT_CANCEL_RET",              receive_at_cancel_ret_test},
+    {"RECEIVE_AT_RET",                     receive_at_ret_test},
+    {"RECEIVE_FAILED",                     receive_failed_test},
+    {"RECEIVE_PERIODIC_START",             receive_periodic_start_test},
+    {"RECEIVE_PERIODIC_START_RET",         receive_periodic_start_ret_test},
+    {"RECEIVE_PERIODIC_STATS_GET",         receive_periodic_stats_get_test},
+    {"RECEIVE_PERIODIC_STATS_GET_RET",     receive_periodic_stats_get_ret_test},
+    {"RECEIVE_PERIODIC_STOP",              receive_periodic_stop_test},
+    {"RECEIVE_PERIODIC_STOP_RET",          receive_periodic_stop_ret_test},
+    {"RECEIVE_RET",                        receive_ret_test},
+    {"RETRANSMISSION_CONFIG_SET",          retransmission_config_set_test},
+    {"RETRANSMISSION_CONFIG_SET_RET",      retransmission_config_set_ret_test},
+    {"RX_ON_WHEN_IDLE_SET",                rx_on_when_idle_set_test},
+    {"SECURITY_ERROR_RET",                 security_error_ret_test},
+    {"SECURITY_GLOBAL_FRAME_COUNTER_SET",  security_global_frame_counter_set_test},
+    {"SECURITY_KEY_REMOVE",                security_key_remove_test},
+    {"SECURITY_KEY_REMOVE_ALL",            security_key_remove_all_test},
+    {"SECURITY_KEY_STORE",                 security_key_store_test},
+    {"SHORT_ADDRESS_SET",                  short_address_set_test},
+    {"SLEEP",                              sleep_test},
+    {"SLEEP_IF_IDLE",                      sleep_if_idle_test},
+    {"SLEEP_IF_IDLE_RET",                  sleep_if_idle_ret_test},
+    {"SLEEP_RET",                          sleep_ret_test},
+    {"SRC_ADDR_MATCHING_METHOD_SET",       src_addr_matching_method_set_test},
+    {"STAT_TIMESTAMPS_GET",                stat_timestamps_get_test},
+    {"STAT_TIMESTAMPS_GET_RET",            stat_timestamps_get_ret_test},
+    {"TEST_MODE_CSMACA_BACKOFF_GET",       test_mode_csmaca_backoff_get_test},
+    {"TEST_MODE_CSMACA_BACKOFF_GET_RET",   test_mode_csmaca_backoff_get_ret_test},
+    {"TEST_MODE_CSMACA_BACKOFF_SET",       test_mode_csmaca_backoff_set_test},
+    {"TIME_GET",                           time_get_test},
+    {"TIME_GET_RET",                       time_get_ret_test},
+    {"TRANSMITTED_RAW",                    transmitted_raw_test},
+    {"TRANSMIT_AT_CANCEL",                 transmit_at_cancel_test},
+    {"TRANSMIT_AT_CANCEL_RET",             transmit_at_cancel_ret_test},
+    {"TRANSMIT_CSMA_CA_RAW",               transmit_csma_ca_raw_test},
+    {"TRANSMIT_CSMA_CA_RAW_RET",           transmit_csma_ca_raw_ret_test},
+    {"TRANSMIT_FAILED",                    transmit_failed_test},
+    {"TRANSMIT_RAW",                       transmit_raw_test},
+    {"TRANSMIT_RAW_AT",                    transmit_raw_at_test},
+    {"TRANSMIT_RAW_AT_RET",                transmit_raw_at_ret_test},
+    {"TRANSMIT_RAW_RET",                   transmit_raw_ret_test},
+    {"TX_ACK_STARTED",                     tx_ack_started_test},
+    {"TX_POWER_GET",                       tx_power_get_test},
+    {"TX_POWER_GET_RET",                   tx_power_get_ret_test},
+    {"TX_POWER_SET",                       tx_power_set_test},
+    {"TX_QUEUE_CANCEL",                    tx_queue_cancel_test},
+    {"TX_QUEUE_CANCEL_RET",                tx_queue_cancel_ret_test},
+    {"TX_QUEUE_ENQUEUE_RAW",               tx_queue_enqueue_raw_test},
+    {"TX_QUEUE_ENQUEUE_RAW_ENTRY",         tx_queue_enqueue_raw_entry_test},
+    {"TX_QUEUE_ENQUEUE_RAW_RET",           tx_queue_enqueue_raw_ret_test},
+};
+
+static double ns_per_call(uint64_t time, uint32_t runs)
+{
+    return (double)time / ((double)runs * TEST_BENCH_REPEAT);
+}
+
+int main(int argc, char ** argv)
+{
+    uint32_t     runs    = 2000U;
+    uint32_t     seed    = 0x2545f491U;
+    bool         verbose = false;
+    test_times_t total   = {0};
+    int          opt     = 1;
+
+    while (opt < argc)
+    {
+        if (strcmp(argv[opt], "-v") == 0)
+        {
+            verbose = true;
+            opt++;
+            continue;
+        }
+
+        if (opt + 1 >= argc)
+        {
+            break;
+        }
+
+        unsigned long value = strtoul(argv[opt + 1], NULL, 0);
+
+        if (strcmp(argv[opt], "-r") == 0)
+        {
+            runs = (uint32_t)value;
+        }
+        else if (strcmp(argv[opt], "-s") == 0)
+        {
+            seed = (uint32_t)value;
+        }
+        else
+        {
+            break;
+        }
+
+        opt += 2;
+    }
+
+    if ((opt != argc) || (runs == 0U) || (seed == 0U))
+    {
+        fprintf(stderr, "Usage: %s [-r <runs per data type>] [-s <seed>] [-v]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    m_rng = seed;
+
+    if (verbose)
+    {
+        printf("%-40s %19s %19s\n", "data type", "pack [ns]", "unpack [ns]");
+    }
+
+    uint32_t timed_runs = 0U;
+
+    for (size_t i = 0U; i < sizeof(m_tests) / sizeof(m_tests[0]); i++)
+    {
+        memset(&m_times, 0, sizeof(m_times));
+
+        m_tests[i].test(runs);
+
+        if (verbose)
+        {
+            printf("%-40s %9.1f -> %6.1f %9.1f -> %6.1f\n", m_tests[i].p_name,
+                   ns_per_call(m_times.pack_interpreter, runs),
+                   ns_per_call(m_times.pack_codec, runs),
+                   ns_per_call(m_times.unpack_interpreter, runs),
+                   ns_per_call(m_times.unpack_codec, runs));
+        }
+
+        // Data types without fields are not measured
+        timed_runs += (m_times.pack_interpreter != 0U) ? runs : 0U;
+
+        total.pack_interpreter   += m_times.pack_interpreter;
+        total.pack_codec         += m_times.pack_codec;
+        total.unpack_interpreter += m_times.unpack_interpreter;
+        total.unpack_codec       += m_times.unpack_codec;
+    }
+
+    printf("%u data types, %u runs each\n",
+           (unsigned)(sizeof(m_tests) / sizeof(m_tests[0])), (unsigned)runs);
+    printf("pack:   %6.1f ns interpreted, %6.1f ns precompiled per call\n",
+           ns_per_call(total.pack_interpreter, timed_runs),
+           ns_per_call(total.pack_codec, timed_runs));
+    printf("unpack: %6.1f ns interpreted, %6.1f ns precompiled per call\n",
+           ns_per_call(total.unpack_interpreter, timed_runs),
+           ns_per_call(total.unpack_codec, timed_runs));
+
+    if (m_violations != 0U)
+    {
+        printf("\n%llu checks failed\n", (unsigned long long)m_violations);
+        return EXIT_FAILURE;
+    }
+
+    printf("\nAll checks passed\n");
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,635 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run stress test of the statistics.
+ *
+ * The test links nrf_802154_stats.c unchanged and runs it the way the driver and the higher layer
+ * do on the device. The main thread plays the thread mode of the higher layer: it keeps taking
+ * snapshots and reading the counters with the legacy API, subtracting what it read. Interrupts are
+ * emulated with signals of periodic timers, so that they hit the thread at arbitrary points.
+ * The driver interrupt records the events of a frame. A higher priority interrupt takes snapshots too, preempting the driver in the middle
+ * of its updates. The MCU critical section blocks both signals.
+ *
+ * Every snapshot must be consistent: the counters and histograms that the driver updates from
+ * one critical section must agree, and the distributions of every source must add up to its
+ * number of frames. Unless the higher priority interrupt takes snapshots too, a snapshot taken
+ * from thread mode must see whole driver events. At the end, the snapshots and the legacy reader
+ * must each have seen every event exactly once. The test
+ * also checks the replacement of sources in a full table, and that snapshots and the legacy
+ * counters do not disturb each other. The program exits with a failure if any check fails.
+ *
+ * <cmsis> must provide a host version of the CMSIS core header whose __get_PRIMASK(),
+ * __set_PRIMASK() and __disable_irq() call sim_primask_get(), sim_primask_set() and
+ * sim_irq_disable(), defined by this file.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -DNRF_802154_STATS_HISTOGRAMS_ENABLED=1 \
+ *         -o stats_stress ../../utils/nrf_802154_stats_stress.c driver/src/nrf_802154_stats.c \
+ *         -Icommon/include -Idriver/include -Idriver/src -Isl/include \
+ *         -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis> -lrt
+ *
+ * Usage:
+ *
+ *     stats_stress [-n <driver events>]
+ */
+
+#include <signal.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_stats.h"
+
+#if !NRF_802154_STATS_HISTOGRAMS_ENABLED
+#error "The test requires NRF_802154_STATS_HISTOGRAMS_ENABLED=1"
+#endif
+
+#define SIM_DRIVER_SIGNAL  SIGUSR1 ///< Signal emulating the driver interrupt.
+#define SIM_READER_SIGNAL  SIGUSR2 ///< Signal emulating the higher priority reader interrupt.
+#define SIM_DRIVER_PERIOD  10000    ///< Period of the driver interrupt, in nanoseconds.
+#define SIM_READER_PERIOD  73000    ///< Period of the reader interrupt, in nanoseconds.
+#define SIM_IRQ_SNAPSHOTS  16U      ///< Capacity of the queue of snapshots taken in the interrupt.
+#define SIM_SOURCES        8U      ///< Number of sources the driver receives frames from.
+#define SIM_PREFILL_FRAMES 64U     ///< Frames recorded from each source before the test.
+#define SIM_HEAVY_ADDR     0xF0U
+
+#if NRF_802154_STATS_RX_SOURCES_NUM < SIM_SOURCES
+#error "The source table must fit all sources"
+#endif
+
+#define CHECK(cond)                                                     \
+    do                                                                  \
+    {                                                                   \
+        if (!(cond))                                                    \
+        {                                                               \
+            printf("  check failed at line %d: %s\n", __LINE__, #cond); \
+            m_failures++;                                               \
+        }                                                               \
+    }                                                                   \
+    while (0)
+
+/**
+ * @brief Execution priorities of the emulated contexts.
+ */
+typedef enum
+{
+    SIM_PRIO_THREAD, ///< Thread mode.
+    SIM_PRIO_DRIVER, ///< Driver interrupt.
+    SIM_PRIO_READER, ///< Reader interrupt.
+} sim_prio_t;
+
+/**
+ * @brief Sums of the events seen in snapshots.
+ */
+typedef struct
+{
+    uint64_t frames;    ///< Received frames.
+    uint64_t cca;       ///< CCA attempts.
+    uint64_t acks;      ///< Ack turnarounds.
+    uint64_t backoffs;  ///< Finished CSMA-CA procedures.
+    uint64_t sources;   ///< Frames in the source table.
+    uint32_t snapshots; ///< Number of snapshots.
+} sim_sums_t;
+
+static uint32_t              m_failures;              ///< Number of failed checks.
+static uint32_t              m_events = 100000U;      ///< Driver events to emulate per scenario.
+static volatile sig_atomic_t m_prio;                  ///< Priority of the running context.
+static volatile uint32_t     m_primask;               ///< Emulated PRIMASK.
+static volatile uint32_t     m_driver_events;         ///< Driver events handled so far.
+static volatile uint32_t     m_reader_irqs;           ///< Reader interrupts handled so far.
+
+/**@brief Snapshots taken in the interrupt, checked later in thread mode. */
+static nrf_802154_stat_snapshot_t m_irq_snapshots[SIM_IRQ_SNAPSHOTS];
+static volatile uint32_t          m_irq_snapshots_wr;
+static volatile uint32_t          m_irq_snapshots_rd;
+
+static sim_sums_t        m_thread_sums;               ///< Sums of snapshots taken in thread mode.
+static sim_sums_t        m_irq_sums;                  ///< Sums of snapshots taken in the interrupt.
+static volatile uint32_t m_snapshots_busy;            ///< Snapshots rejected in the interrupt.
+static uint64_t          m_legacy_frames;             ///< Frames seen by the legacy reader.
+
+/**
+ * @brief Gets the signals of the interrupts with priority higher than @p prio.
+ */
+static void irq_signals_get(sigset_t * p_set, sim_prio_t prio)
+{
+    sigemptyset(p_set);
+
+    if (prio < SIM_PRIO_DRIVER)
+    {
+        sigaddset(p_set, SIM_DRIVER_SIGNAL);
+    }
+
+    if (prio < SIM_PRIO_READER)
+    {
+        sigaddset(p_set, SIM_READER_SIGNAL);
+    }
+}
+
+uint32_t sim_primask_get(void)
+{
+    return m_primask;
+}
+
+void sim_irq_disable(void)
+{
+    sigset_t set;
+
+    irq_signals_get(&set, SIM_PRIO_THREAD);
+    sigprocmask(SIG_BLOCK, &set, NULL);
+    m_primask = 1U;
+}
+
+void sim_primask_set(uint32_t primask)
+{
+    m_primask = primask;
+
+    if (primask == 0U)
+    {
+        sigset_t set;
+
+        // Interrupts of the same or lower priority stay blocked by the running one.
+        irq_signals_get(&set, (sim_prio_t)m_prio);
+        sigprocmask(SIG_UNBLOCK, &set, NULL);
+    }
+}
+
+/**
+ * @brief Fills the address of a source and returns its length.
+ */
+static uint8_t source_addr_get(uint32_t source, uint8_t * p_addr)
+{
+    memset(p_addr, 0, 8);
+    p_addr[0] = (uint8_t)source;
+    p_addr[1] = 0xAA;
+
+    return (source & 1U) ? 8U : 2U;
+}
+
+/**
+ * @brief Checks a snapshot and adds it to the sums.
+ *
+ * @param[in]    p_snapshot  Snapshot to check.
+ * @param[in]    whole       If the snapshot must see whole driver events.
+ * @param[inout] p_sums      Sums to add the snapshot to.
+ */
+static void snapshot_consume(const nrf_802154_stat_snapshot_t * p_snapshot,
+                             bool                               whole,
+                             sim_sums_t                       * p_sums)
+{
+    const nrf_802154_stat_histograms_t * p_histograms = &p_snapshot->histograms;
+    uint64_t                             attempts     = 0U;
+    uint64_t                             busy         = 0U;
+    uint64_t                             acks         = 0U;
+    uint64_t                             backoffs     = 0U;
+
+    for (uint32_t i = 0; i < NRF_802154_STAT_CCA_CHANNELS; i++)
+    {
+        attempts += p_histograms->cca_attempts[i];
+        busy     += p_histograms->cca_busy[i];
+    }
+
+    for (uint32_t i = 0; i < NRF_802154_STAT_ACK_TURNAROUND_BINS; i++)
+    {
+        acks += p_histograms->ack_turnaround[i];
+    }
+
+    for (uint32_t i = 0; i < NRF_802154_STAT_CSMACA_BACKOFFS_BINS; i++)
+    {
+        backoffs += p_histograms->csmaca_backoffs[i];
+    }
+
+    // The driver updates these from one critical section.
+    CHECK(p_snapshot->counters.received_frames == p_snapshot->counters.cca_failed_attempts);
+    CHECK(attempts == p_snapshot->counters.received_frames);
+    CHECK(busy <= attempts);
+
+    if (whole)
+    {
+        CHECK(acks == attempts);
+        CHECK(backoffs == attempts);
+    }
+
+    for (uint32_t i = 0; i < NRF_802154_STATS_RX_SOURCES_NUM; i++)
+    {
+        const nrf_802154_stat_rx_source_t * p_entry = &p_histograms->rx_sources[i];
+        uint64_t                            rssi    = 0U;
+        uint64_t                            lqi     = 0U;
+
+        for (uint32_t b = 0; b < NRF_802154_STAT_RSSI_BINS; b++)
+        {
+            rssi += p_entry->rssi[b];
+        }
+
+        for (uint32_t b = 0; b < NRF_802154_STAT_LQI_BINS; b++)
+        {
+            lqi += p_entry->lqi[b];
+        }
+
+        CHECK((rssi == p_entry->frames) && (lqi == p_entry->frames));
+        CHECK((p_entry->frames == 0U) || (p_entry->addr_len != 0U));
+
+        p_sums->sources += p_entry->frames;
+    }
+
+    p_sums->frames   += p_snapshot->counters.received_frames;
+    p_sums->cca      += attempts;
+    p_sums->acks     += acks;
+    p_sums->backoffs += backoffs;
+    p_sums->snapshots++;
+}
+
+/**
+ * @brief Driver interrupt: records the events of a received frame.
+ */
+static void driver_irq_handler(int sig)
+{
+    nrf_802154_mcu_critical_state_t mcu_cs;
+    sim_prio_t                      prio = (sim_prio_t)m_prio;
+    uint32_t                        i    = m_driver_events;
+    uint8_t                         addr[8];
+    uint8_t                         addr_len = source_addr_get(i % SIM_SOURCES, addr);
+
+    (void)sig;
+    m_prio = SIM_PRIO_DRIVER;
+
+    nrf_802154_mcu_critical_enter(mcu_cs);
+    nrf_802154_stat_counter_increment(received_frames);
+    nrf_802154_stat_counter_increment(cca_failed_attempts);
+    nrf_802154_stat_cca_record(11U + (i & 15U), (i & 1U) != 0U);
+    nrf_802154_mcu_critical_exit(mcu_cs);
+
+    nrf_802154_stat_rx_source_record(addr, addr_len, (int8_t)(-100 + (int32_t)(i % 80U)),
+                                     (uint8_t)i);
+    nrf_802154_stat_ack_turnaround_record(i % 700U);
+    nrf_802154_stat_csmaca_backoffs_record((uint8_t)(i % 10U));
+
+    m_driver_events = i + 1U;
+    m_prio          = prio;
+}
+
+/**
+ * @brief Reader interrupt: takes a snapshot if there is room for it in the queue.
+ */
+static void reader_irq_handler(int sig)
+{
+    sim_prio_t prio = (sim_prio_t)m_prio;
+    uint32_t   wr   = m_irq_snapshots_wr;
+
+    (void)sig;
+    m_prio = SIM_PRIO_READER;
+
+    if (wr - m_irq_snapshots_rd < SIM_IRQ_SNAPSHOTS)
+    {
+        if (nrf_802154_stat_snapshot_take(&m_irq_snapshots[wr % SIM_IRQ_SNAPSHOTS]))
+        {
+            m_irq_snapshots_wr = wr + 1U;
+        }
+        else
+        {
+            m_snapshots_busy++;
+        }
+    }
+
+    m_reader_irqs++;
+    m_prio = prio;
+}
+
+/**
+ * @brief Checks the snapshots taken in the interrupt.
+ */
+static void irq_snapshots_consume(void)
+{
+    while (m_irq_snapshots_rd != m_irq_snapshots_wr)
+    {
+        uint32_t rd = m_irq_snapshots_rd;
+
+        snapshot_consume(&m_irq_snapshots[rd % SIM_IRQ_SNAPSHOTS], false, &m_irq_sums);
+        m_irq_snapshots_rd = rd + 1U;
+    }
+}
+
+/**
+ * @brief Starts a periodic timer raising the given signal.
+ */
+static timer_t irq_timer_start(int sig, long period_ns)
+{
+    struct sigevent   event = {0};
+    struct itimerspec spec  = {0};
+    timer_t           timer;
+
+    event.sigev_notify          = SIGEV_SIGNAL;
+    event.sigev_signo           = sig;
+    spec.it_value.tv_nsec       = period_ns;
+    spec.it_interval.tv_nsec    = period_ns;
+
+    if ((timer_create(CLOCK_MONOTONIC, &event, &timer) != 0) ||
+        (timer_settime(timer, 0, &spec, NULL) != 0))
+    {
+        perror("timer");
+        exit(EXIT_FAILURE);
+    }
+
+    return timer;
+}
+
+/**
+ * @brief Checks the replacement of sources when the table is full.
+ *
+ * Must run first, on an empty table.
+ */
+static void eviction_test(void)
+{
+    nrf_802154_stat_snapshot_t snapshot;
+    uint8_t                    addr[2] = {0};
+    bool                       heavy   = false;
+
+    printf("eviction\n");
+
+    addr[0] = SIM_HEAVY_ADDR;
+
+    for (uint32_t i = 0; i < 3U; i++)
+    {
+        nrf_802154_stat_rx_source_record(addr, sizeof(addr), -50, 255);
+    }
+
+    for (uint32_t i = 0; i < NRF_802154_STATS_RX_SOURCES_NUM + 4U; i++)
+    {
+        addr[0] = (uint8_t)i;
+        nrf_802154_stat_rx_source_record(addr, sizeof(addr), -95, 0);
+    }
+
+    CHECK(nrf_802154_stat_snapshot_take(&snapshot));
+
+    for (uint32_t i = 0; i < NRF_802154_STATS_RX_SOURCES_NUM; i++)
+    {
+        const nrf_802154_stat_rx_source_t * p_entry = &snapshot.histograms.rx_sources[i];
+
+        if ((p_entry->addr[0] == SIM_HEAVY_ADDR) && (p_entry->frames == 3U) &&
+            (p_entry->rssi[5] == 3U) && (p_entry->lqi[NRF_802154_STAT_LQI_BINS - 1] == 3U))
+        {
+            heavy = true;
+        }
+    }
+
+    // The first source is the most frequent one, the others replace each other.
+    CHECK(heavy);
+    CHECK(snapshot.histograms.rx_sources_replaced == 5U);
+
+    // Sources stay in the table, but are reported only when heard since the previous snapshot.
+    CHECK(nrf_802154_stat_snapshot_take(&snapshot));
+    CHECK(snapshot.histograms.rx_sources_replaced == 0U);
+
+    for (uint32_t i = 0; i < NRF_802154_STATS_RX_SOURCES_NUM; i++)
+    {
+        CHECK(snapshot.histograms.rx_sources[i].addr_len == 0U);
+    }
+}
+
+/**
+ * @brief Puts the sources of the driver events in the table, so that they never replace each other.
+ */
+static void sources_prefill(void)
+{
+    nrf_802154_stat_snapshot_t snapshot;
+    uint8_t                    addr[8];
+
+    for (uint32_t source = 0; source < SIM_SOURCES; source++)
+    {
+        uint8_t addr_len = source_addr_get(source, addr);
+
+        for (uint32_t i = 0; i < SIM_PREFILL_FRAMES; i++)
+        {
+            nrf_802154_stat_rx_source_record(addr, addr_len, -60, 100);
+        }
+    }
+
+    CHECK(nrf_802154_stat_snapshot_take(&snapshot));
+    CHECK(snapshot.histograms.rx_sources_replaced == SIM_SOURCES);
+}
+
+/**
+ * @brief Emulates the driver and the readers and checks that every event was seen once.
+ *
+ * @param[in]  preempting_reader  If the reader interrupt takes snapshots too. Such a snapshot can
+ *                                split a driver event, so then the snapshots taken in thread mode
+ *                                are not required to see whole driver events.
+ */
+static void stress_test(bool preempting_reader)
+{
+    struct sigaction           action = {0};
+    timer_t                    driver_timer;
+    timer_t                    reader_timer;
+    sigset_t                   set;
+    nrf_802154_stat_snapshot_t snapshot;
+    nrf_802154_stat_counters_t counters;
+    uint32_t                   first_event = m_driver_events;
+    uint32_t                   events;
+    uint32_t                   iteration = 0U;
+
+    printf("stress, %s\n", preempting_reader ? "preempting reader" : "thread mode reader");
+
+    memset(&m_thread_sums, 0, sizeof(m_thread_sums));
+    memset(&m_irq_sums, 0, sizeof(m_irq_sums));
+    m_snapshots_busy = 0U;
+    m_legacy_frames  = 0U;
+    m_reader_irqs    = 0U;
+
+    nrf_802154_stat_counters_reset();
+    CHECK(nrf_802154_stat_snapshot_take(&snapshot));
+
+    // The reader interrupt preempts the driver interrupt, but not the other way round.
+    action.sa_handler = driver_irq_handler;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIM_DRIVER_SIGNAL, &action, NULL);
+
+    action.sa_handler = reader_irq_handler;
+    sigaddset(&action.sa_mask, SIM_DRIVER_SIGNAL);
+    sigaction(SIM_READER_SIGNAL, &action, NULL);
+
+    driver_timer = irq_timer_start(SIM_DRIVER_SIGNAL, SIM_DRIVER_PERIOD);
+
+    if (preempting_reader)
+    {
+        reader_timer = irq_timer_start(SIM_READER_SIGNAL, SIM_READER_PERIOD);
+    }
+
+    while ((m_driver_events - first_event < m_events) || (preempting_reader && (m_reader_irqs == 0U)))
+    {
+        if (nrf_802154_stat_snapshot_take(&snapshot))
+        {
+            snapshot_consume(&snapshot, !preempting_reader, &m_thread_sums);
+        }
+
+        irq_snapshots_consume();
+
+        if ((iteration++ & 1U) != 0U)
+        {
+            nrf_802154_stat_counters_get(&counters);
+            nrf_802154_stat_counters_subtract(&counters);
+            m_legacy_frames += counters.received_frames;
+        }
+    }
+
+    // Stop the interrupts. Driver events past the requested number are counted as well.
+    irq_signals_get(&set, SIM_PRIO_THREAD);
+    sigprocmask(SIG_BLOCK, &set, NULL);
+    timer_delete(driver_timer);
+
+    if (preempting_reader)
+    {
+        timer_delete(reader_timer);
+    }
+
+    action.sa_handler = SIG_IGN;
+    sigaction(SIM_DRIVER_SIGNAL, &action, NULL);
+    sigaction(SIM_READER_SIGNAL, &action, NULL);
+    sigprocmask(SIG_UNBLOCK, &set, NULL);
+
+    irq_snapshots_consume();
+    CHECK(nrf_802154_stat_snapshot_take(&snapshot));
+    snapshot_consume(&snapshot, !preempting_reader, &m_thread_sums);
+
+    nrf_802154_stat_counters_get(&counters);
+    m_legacy_frames += counters.received_frames;
+
+    events = m_driver_events - first_event;
+
+    printf("  %u events, %u snapshots in thread mode, %u in the interrupt, %u rejected\n",
+           (unsigned)events, (unsigned)m_thread_sums.snapshots, (unsigned)m_irq_sums.snapshots,
+           (unsigned)m_snapshots_busy);
+
+    CHECK(m_thread_sums.frames + m_irq_sums.frames == events);
+    CHECK(m_thread_sums.cca + m_irq_sums.cca == events);
+    CHECK(m_thread_sums.acks + m_irq_sums.acks == events);
+    CHECK(m_thread_sums.backoffs + m_irq_sums.backoffs == events);
+    CHECK(m_thread_sums.sources + m_irq_sums.sources == events);
+    CHECK(m_legacy_frames == events);
+}
+
+/**
+ * @brief Checks that snapshots and the legacy counters do not disturb each other.
+ */
+static void legacy_test(void)
+{
+    nrf_802154_stat_snapshot_t snapshot;
+    nrf_802154_stat_counters_t counters;
+    nrf_802154_stat_counters_t delta = {0};
+
+    printf("legacy\n");
+
+    nrf_802154_stat_counters_reset();
+    nrf_802154_stat_counters_get(&counters);
+    CHECK(counters.received_frames == 0U);
+
+    nrf_802154_stat_counter_increment(received_frames);
+    nrf_802154_stat_counter_increment(received_frames);
+    nrf_802154_stat_counter_add(ifs_delay_us, 100U);
+
+    // A snapshot does not reset the legacy counters.
+    CHECK(nrf_802154_stat_snapshot_take(&snapshot));
+    CHECK(snapshot.counters.received_frames == 2U);
+    CHECK(snapshot.counters.ifs_delay_us == 100U);
+
+    nrf_802154_stat_counters_get(&counters);
+    CHECK(counters.received_frames == 2U);
+    CHECK(counters.ifs_delay_us == 100U);
+
+    // Subtracting and resetting does not change what the next snapshot reports.
+    delta.received_frames = 1U;
+    nrf_802154_stat_counters_subtract(&delta);
+    nrf_802154_stat_counter_increment(received_frames);
+
+    nrf_802154_stat_counters_get(&counters);
+    CHECK(counters.received_frames == 2U);
+
+    nrf_802154_stat_counters_reset();
+    nrf_802154_stat_counter_increment(received_frames);
+
+    CHECK(nrf_802154_stat_snapshot_take(&snapshot));
+    CHECK(snapshot.counters.received_frames == 2U);
+    CHECK(snapshot.counters.ifs_delay_us == 0U);
+
+    nrf_802154_stat_counters_get(&counters);
+    CHECK(counters.received_frames == 1U);
+    CHECK(counters.ifs_delay_us == 0U);
+}
+
+int main(int argc, char ** argv)
+{
+    int opt = 1;
+
+    while (opt + 1 < argc)
+    {
+        unsigned long value = strtoul(argv[opt + 1], NULL, 0);
+
+        if (strcmp(argv[opt], "-n") == 0)
+        {
+            m_events = (uint32_t)value;
+        }
+        else
+        {
+            break;
+        }
+
+        opt += 2;
+    }
+
+    if (opt != argc)
+    {
+        fprintf(stderr, "Usage: %s [-n <driver events>]\n", argv[0]);
+        return EXIT_FAILURE;
+    }
+
+    eviction_test();
+    sources_prefill();
+    stress_test(false);
+    stress_test(true);
+    legacy_test();
+
+    if (m_failures != 0U)
+    {
+        printf("\n%u checks failed\n", (unsigned)m_failures);
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,616 @@
+/*
+ * Copyright (c) 2025, Nordic Semiconductor ASA
+ * All rights reserved.
+ *
+ * SPDX-License-Identifier: BSD-3-Clause
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * 1. Redistributions of source code must retain the above copyright notice, this
+ *    list of conditions and the following disclaimer.
+ *
+ * 2. Redistributions in binary form must reproduce the above copyright
+ *    notice, this list of conditions and the following disclaimer in the
+ *    documentation and/or other materials provided with the distribution.
+ *
+ * 3. Neither the name of Nordic Semiconductor ASA nor the names of its
+ *    contributors may be used to endorse or promote products derived from this
+ *    software without specific prior written permission.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS"
+ * AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE
+ * IMPLIED WARRANTIES OF MERCHANTABILITY, AND FITNESS FOR A PARTICULAR PURPOSE
+ * ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT HOLDER OR CONTRIBUTORS BE
+ * LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR
+ * CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF
+ * SUBSTITUTE GOODS OR SERVICES; LOSS OF USE, DATA, OR PROFITS; OR BUSINESS
+ * INTERRUPTION) HOWEVER CAUSED AND ON ANY THEORY OF LIABILITY, WHETHER IN
+ * CONTRACT, STRICT LIABILITY, OR TORT (INCLUDING NEGLIGENCE OR OTHERWISE)
+ * ARISING IN ANY WAY OUT OF THE USE OF THIS SOFTWARE, EVEN IF ADVISED OF THE
+ * POSSIBILITY OF SUCH DAMAGE.
+ *
+ */
+
+/**
+ * @file
+ *   Host-run throughput benchmark for the transmit queue.
+ *
+ * The benchmark links nrf_802154_tx_queue.c unchanged and replaces the rest of the driver with
+ * a model of a single transmitter. It compares three ways of sending a stream of frames:
+ *
+ * - request: the higher layer requests each transmission with nrf_802154_transmit_raw after the
+ *   result of the previous frame has been notified, and retransmits failed frames itself,
+ * - queue:   the higher layer fills the transmit queue and then adds one frame per notified
+ *   result; the driver chains the frames and retransmits them,
+ * - batch:   as queue, but the results are notified with nrf_802154_tx_queue_done and the higher
+ *   layer refills the whole queue at once. Batch notifications are not serialized, so this mode
+ *   is run only with the local latency profile.
+ *
+ * The higher layer reacts to a notification after the notification latency and its request
+ * reaches the driver after the request latency. The local profile models a higher layer on the
+ * radio core, the serialized profile models a higher layer on the application core that talks to
+ * the driver through the spinel serialization. Every started frame takes the radio ramp-up time,
+ * the CCA, the frame itself and the Ack or the Ack timeout. Every run is done twice: with
+ * consecutive frames separated at least by the IFS, as required by IEEE 802.15.4, and without
+ * any spacing enforced by the driver. The IFS hides the latency of the higher layer as long as
+ * it is shorter than the IFS. Ack losses are drawn from a seeded generator, so a run is
+ * reproducible and every mode faces the same losses.
+ *
+ * Build from the drivers/nrf_802154 directory:
+ *
+ *     gcc -O2 -DNRF52840_XXAA -DNRF_802154_TX_QUEUE_ENABLED=1 -DNRF_802154_USE_RAW_API=1 \
+ *         -o tx_queue_bench ../../utils/nrf_802154_tx_queue_bench.c \
+ *         driver/src/mac_features/nrf_802154_tx_queue.c \
+ *         -Icommon/include -Idriver/include -Idriver/src -Idriver/src/mac_features -Isl/include \
+ *         -Isl/sl_opensource/include -I<nrfx> -I<nrfx>/mdk -I<nrfx>/templates -I<cmsis>
+ *
+ * Usage:
+ *
+ *     tx_queue_bench [-f <frames>] [-l <psdu length>[,<psdu length>...]] [-e <ack loss %>]
+ *                    [-r <max retries>] [-s <seed>]
+ */
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "nrf_802154.h"
+#include "nrf_802154_co.h"
+#include "nrf_802154_const.h"
+#include "nrf_802154_config.h"
+#include "nrf_802154_notification.h"
+#include "mac_features/nrf_802154_tx_queue.h"
+
+#define SIM_OCTET_TIME    (PHY_SYMBOLS_PER_OCTET * PHY_US_PER_SYMBOL) ///< Duration of one octet, in microseconds.
+#define SIM_SHR_PHR_TIME  ((PHY_SHR_SYMBOLS * PHY_US_PER_SYMBOL) + SIM_OCTET_TIME)
+#define SIM_ACK_TIME      (SIM_SHR_PHR_TIME + IMM_ACK_LENGTH * SIM_OCTET_TIME)
+#define SIM_RAMP_UP_TIME  40U                                         ///< Radio ramp-up time, in microseconds.
+#define SIM_CCA_TIME      128U                                        ///< CCA time, in microseconds.
+#define SIM_NO_ACK_TIME   NRF_802154_PRECISE_ACK_TIMEOUT_DEFAULT_TIMEOUT
+#define SIM_EVENTS_MAX    (4U * NRF_802154_TX_QUEUE_SIZE)             ///< Capacity of the event list.
+#define SIM_BUFFERS_NUM   (2U * NRF_802154_TX_QUEUE_SIZE)             ///< Number of frame buffers.
+#define SIM_TIME_NEVER    UINT64_MAX
+
+/**
+ * @brief Ways of sending frames compared by the benchmark.
+ */
+typedef enum
+{
+    SIM_MODE_REQUEST, ///< One transmit request per frame.
+    SIM_MODE_QUEUE,   ///< Transmit queue with a notification per frame.
+    SIM_MODE_BATCH,   ///< Transmit queue with batch notifications.
+} sim_mode_t;
+
+/**
+ * @brief Latencies between the driver and the higher layer.
+ */
+typedef struct
+{
+    const char * p_name;
+    uint32_t     notify_us;  ///< From a notification in the driver to the higher layer acting on it.
+    uint32_t     request_us; ///< From a request of the higher layer to the driver acting on it.
+} sim_profile_t;
+
+/**
+ * @brief Actions of the higher layer.
+ */
+typedef enum
+{
+    SIM_EVENT_NOTIFIED, ///< The higher layer handles a notified result.
+    SIM_EVENT_REQUEST,  ///< A request with a single frame reaches the driver.
+    SIM_EVENT_FILL,     ///< A request that fills the transmit queue reaches the driver.
+} sim_event_kind_t;
+
+typedef struct
+{
+    uint64_t         time;
+    sim_event_kind_t kind;
+    uint8_t        * p_frame;  ///< Frame concerned by the event.
+    bool             failed;   ///< If the notified result was a failure.
+} sim_event_t;
+
+typedef struct
+{
+    uint64_t busy_us;    ///< Time the radio spent on the frames and their Acks.
+    uint64_t delivered;  ///< Frames acknowledged by the receiver.
+    uint64_t failed;     ///< Frames dropped after all retries.
+    uint64_t attempts;   ///< Transmission attempts.
+    uint64_t bytes;      ///< PSDU octets of the delivered frames.
+    uint64_t wakeups;    ///< Notification callouts called.
+    uint64_t end;        ///< Time when the last result was handled.
+} sim_result_t;
+
+static const sim_profile_t m_profiles[] =
+{
+    {"local",      20U,  15U },
+    {"serialized", 180U, 250U},
+};
+
+static uint32_t    m_rng;
+static uint64_t    m_now;
+static sim_event_t m_events[SIM_EVENTS_MAX];
+static size_t      m_events_len;
+
+static uint8_t  m_buffers[SIM_BUFFERS_NUM][MAX_PACKET_SIZE + 1U];
+static uint8_t  m_attempts[SIM_BUFFERS_NUM]; ///< Attempts of the frames sent by the higher layer.
+static uint8_t  m_ack[IMM_ACK_LENGTH + 1U];
+static uint32_t m_ack_loss;                  ///< Probability of losing the Ack, in 1/65536.
+static uint8_t  m_max_retries;
+static bool     m_ifs;                       ///< If the IFS is enforced between frames.
+
+static const sim_profile_t * mp_profile;
+static sim_mode_t            m_mode;
+static sim_result_t          m_result;
+static uint32_t              m_frames_left;  ///< Frames not passed to the driver yet.
+static uint32_t              m_results_left; ///< Frames whose final result has not been handled yet.
+static uint8_t               m_psdu_length;
+static uint32_t              m_next_buffer;
+
+static uint8_t                             * mp_radio_frame; ///< Frame on air, NULL if the radio is idle.
+static nrf_802154_transmitted_frame_props_t  m_radio_props;
+static bool                                  m_radio_acked;
+static uint64_t                              m_radio_done;
+static uint64_t                              m_radio_free;   ///< End of the last frame plus the IFS.
+
+static uint32_t xorshift32(uint32_t * p_state)
+{
+    uint32_t x = *p_state;
+
+    x        ^= x << 13;
+    x        ^= x >> 17;
+    x        ^= x << 5;
+    *p_state  = x;
+
+    return x;
+}
+
+static size_t buffer_idx(const uint8_t * p_frame)
+{
+    return (size_t)(p_frame - &m_buffers[0][0]) / sizeof(m_buffers[0]);
+}
+
+static void event_add(uint64_t time, sim_event_kind_t kind, uint8_t * p_frame, bool failed)
+{
+    size_t idx = m_events_len;
+
+    if (m_events_len >= SIM_EVENTS_MAX)
+    {
+        fprintf(stderr, "Event list overflow\n");
+        exit(EXIT_FAILURE);
+    }
+
+    // Keep the list sorted by time, events at the same time are handled in order of addition
+    while ((idx > 0U) && (m_events[idx - 1U].time > time))
+    {
+        m_events[idx] = m_events[idx - 1U];
+        idx--;
+    }
+
+    m_events[idx] = (sim_event_t){time, kind, p_frame, failed};
+    m_events_len++;
+}
+
+static uint8_t * frame_build(void)
+{
+    uint8_t * p_frame = m_buffers[m_next_buffer];
+
+    m_next_buffer = (m_next_buffer + 1U) % SIM_BUFFERS_NUM;
+
+    memset(p_frame, 0, sizeof(m_buffers[0]));
+    p_frame[PHR_OFFSET]                 = m_psdu_length;
+    p_frame[FRAME_TYPE_OFFSET]          = FRAME_TYPE_DATA | ACK_REQUEST_BIT;
+    m_attempts[buffer_idx(p_frame)]     = 0U;
+
+    return p_frame;
+}
+
+static bool radio_start(uint8_t * p_data, const nrf_802154_transmitted_frame_props_t * p_props,
+                        bool cca)
+{
+    if (mp_radio_frame != NULL)
+    {
+        return false;
+    }
+
+    uint64_t start = (m_now > m_radio_free) ? m_now : m_radio_free;
+    uint64_t air   = SIM_RAMP_UP_TIME + (cca ? SIM_CCA_TIME : 0U) +
+                     SIM_SHR_PHR_TIME + (uint64_t)p_data[PHR_OFFSET] * SIM_OCTET_TIME;
+    uint64_t ifs   = !m_ifs ? 0U :
+                     (p_data[PHR_OFFSET] > MAX_SIFS_FRAME_SIZE) ?
+                     MIN_LIFS_PERIOD_US : MIN_SIFS_PERIOD_US;
+
+    m_radio_acked = (xorshift32(&m_rng) & 0xffffU) >= m_ack_loss;
+    air          += ACK_IFS + (m_radio_acked ? SIM_ACK_TIME : SIM_NO_ACK_TIME);
+
+    mp_radio_frame    = p_data;
+    m_radio_props     = *p_props;
+    m_radio_done      = start + air;
+    m_radio_free      = m_radio_done + ifs;
+    m_result.busy_us += air;
+    m_result.attempts++;
+
+    return true;
+}
+
+static void radio_done(void)
+{
+    uint8_t                           * p_frame  = mp_radio_frame;
+    nrf_802154_transmit_done_metadata_t metadata = {};
+
+    mp_radio_frame       = NULL;
+    m_now                = m_radio_done;
+    metadata.frame_props = m_radio_props;
+
+    if (m_radio_acked)
+    {
+        metadata.data.transmitted.p_ack = m_ack;
+        nrf_802154_co_transmitted_raw(p_frame, &metadata);
+    }
+    else
+    {
+        // Same as the failure notification of the core
+        (void)nrf_802154_tx_queue_tx_failed_hook(p_frame, NRF_802154_TX_ERROR_NO_ACK);
+        nrf_802154_notify_transmit_failed(p_frame, NRF_802154_TX_ERROR_NO_ACK, &metadata);
+    }
+}
+
+bool nrf_802154_transmit_raw(uint8_t                              * p_data,
+                             const nrf_802154_transmit_metadata_t * p_metadata)
+{
+    return radio_start(p_data, &p_metadata->frame_props, p_metadata->cca);
+}
+
+bool nrf_802154_transmit_csma_ca_raw(uint8_t                                      * p_data,
+                                     const nrf_802154_transmit_csma_ca_metadata_t * p_metadata)
+{
+    return radio_start(p_data, &p_metadata->frame_props, true);
+}
+
+void nrf_802154_buffer_free_raw(uint8_t * p_data)
+{
+    (void)p_data;
+}
+
+void nrf_802154_core_hooks_tx_prepared_discard(const uint8_t * p_frame)
+{
+    (void)p_frame;
+}
+
+// Same as the direct notification of the driver
+void nrf_802154_notify_transmit_failed(uint8_t                                   * p_frame,
+                                       nrf_802154_tx_error_t                       error,
+                                       const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    nrf_802154_co_transmit_failed(p_frame, error, p_metadata);
+}
+
+// Same as the notification exit point of the driver
+void nrf_802154_co_transmitted_raw(uint8_t                                   * p_frame,
+                                   const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    if (!nrf_802154_tx_queue_transmitted_hook(p_frame, p_metadata))
+    {
+        nrf_802154_transmitted_raw(p_frame, p_metadata);
+    }
+}
+
+void nrf_802154_co_transmit_failed(uint8_t                                   * p_frame,
+                                   nrf_802154_tx_error_t                       error,
+                                   const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    if (!nrf_802154_tx_queue_transmit_failed_hook(p_frame, error, p_metadata))
+    {
+        nrf_802154_transmit_failed(p_frame, error, p_metadata);
+    }
+}
+
+void nrf_802154_transmitted_raw(uint8_t                                   * p_frame,
+                                const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    (void)p_metadata;
+    m_result.wakeups++;
+    event_add(m_now + mp_profile->notify_us, SIM_EVENT_NOTIFIED, p_frame, false);
+}
+
+void nrf_802154_transmit_failed(uint8_t                                   * p_frame,
+                                nrf_802154_tx_error_t                       error,
+                                const nrf_802154_transmit_done_metadata_t * p_metadata)
+{
+    (void)error;
+    (void)p_metadata;
+    m_result.wakeups++;
+    event_add(m_now + mp_profile->notify_us, SIM_EVENT_NOTIFIED, p_frame, true);
+}
+
+void nrf_802154_tx_queue_done(const nrf_802154_tx_queue_result_t * p_results, uint8_t count)
+{
+    m_result.wakeups++;
+
+    for (uint8_t i = 0U; i < count; i++)
+    {
+        event_add(m_now + mp_profile->notify_us, SIM_EVENT_NOTIFIED, p_results[i].p_data,
+                  p_results[i].error != NRF_802154_TX_ERROR_NONE);
+    }
+
+    // The queue is refilled once, after the whole batch has been handled
+    event_add(m_now + mp_profile->notify_us + mp_profile->request_us, SIM_EVENT_FILL, NULL,
+              false);
+}
+
+static void request_handle(uint8_t * p_frame, bool fill)
+{
+    if (m_mode == SIM_MODE_REQUEST)
+    {
+        nrf_802154_transmit_metadata_t metadata =
+        {
+            .frame_props = NRF_802154_TRANSMITTED_FRAME_PROPS_DEFAULT_INIT,
+            .cca         = true,
+        };
+
+        m_attempts[buffer_idx(p_frame)]++;
+
+        if (!nrf_802154_transmit_raw(p_frame, &metadata))
+        {
+            fprintf(stderr, "Transmit request refused\n");
+            exit(EXIT_FAILURE);
+        }
+
+        return;
+    }
+
+    nrf_802154_tx_queue_entry_t entries[NRF_802154_TX_QUEUE_SIZE];
+    uint8_t                     count = 0U;
+    uint8_t                     room  = NRF_802154_TX_QUEUE_SIZE - nrf_802154_tx_queue_count_get();
+
+    if (!fill)
+    {
+        room = (room > 0U) ? 1U : 0U;
+    }
+
+    while ((count < room) && (m_frames_left > 0U))
+    {
+        entries[count] = (nrf_802154_tx_queue_entry_t)
+        {
+            .p_data   = frame_build(),
+            .metadata =
+            {
+                .frame_props = NRF_802154_TRANSMITTED_FRAME_PROPS_DEFAULT_INIT,
+                .cca         = true,
+                .max_retries = m_max_retries,
+            },
+        };
+        count++;
+        m_frames_left--;
+    }
+
+    if (nrf_802154_tx_queue_push(entries, count) != count)
+    {
+        fprintf(stderr, "Frames refused by the transmit queue\n");
+        exit(EXIT_FAILURE);
+    }
+}
+
+static void notified_handle(uint8_t * p_frame, bool failed)
+{
+    if ((m_mode == SIM_MODE_REQUEST) && failed &&
+        (m_attempts[buffer_idx(p_frame)] <= m_max_retries))
+    {
+        event_add(m_now + mp_profile->request_us, SIM_EVENT_REQUEST, p_frame, false);
+        return;
+    }
+
+    if (failed)
+    {
+        m_result.failed++;
+    }
+    else
+    {
+        m_result.delivered++;
+        m_result.bytes += p_frame[PHR_OFFSET];
+    }
+
+    m_results_left--;
+    m_result.end = m_now;
+
+    if ((m_mode == SIM_MODE_REQUEST) && (m_frames_left > 0U))
+    {
+        m_frames_left--;
+        event_add(m_now + mp_profile->request_us, SIM_EVENT_REQUEST, frame_build(), false);
+    }
+    else if ((m_mode == SIM_MODE_QUEUE) && (m_frames_left > 0U))
+    {
+        event_add(m_now + mp_profile->request_us, SIM_EVENT_REQUEST, NULL, false);
+    }
+}
+
+static void simulate(sim_mode_t            mode,
+                     const sim_profile_t * p_profile,
+                     uint32_t              frames,
+                     uint8_t               length,
+                     uint32_t              seed)
+{
+    m_rng          = seed;
+    m_now          = 0U;
+    m_events_len   = 0U;
+    m_mode         = mode;
+    mp_profile     = p_profile;
+    m_frames_left  = frames;
+    m_results_left = frames;
+    m_psdu_length  = length;
+    m_next_buffer  = 0U;
+    mp_radio_frame = NULL;
+    m_radio_free   = 0U;
+    memset(&m_result, 0, sizeof(m_result));
+
+    nrf_802154_tx_queue_init();
+    (void)nrf_802154_tx_queue_batch_mode_set(mode == SIM_MODE_BATCH);
+
+    if (mode == SIM_MODE_REQUEST)
+    {
+        m_frames_left--;
+        event_add(p_profile->request_us, SIM_EVENT_REQUEST, frame_build(), false);
+    }
+    else
+    {
+        event_add(p_profile->request_us, SIM_EVENT_FILL, NULL, false);
+    }
+
+    while (m_results_left > 0U)
+    {
+        uint64_t radio_time = (mp_radio_frame != NULL) ? m_radio_done : SIM_TIME_NEVER;
+
+        if ((m_events_len > 0U) && (m_events[0].time <= radio_time))
+        {
+            sim_event_t event = m_events[0];
+
+            m_events_len--;
+            memmove(&m_events[0], &m_events[1], m_events_len * sizeof(m_events[0]));
+            m_now = event.time;
+
+            if (event.kind == SIM_EVENT_NOTIFIED)
+            {
+                notified_handle(event.p_frame, event.failed);
+            }
+            else
+            {
+                request_handle(event.p_frame, event.kind == SIM_EVENT_FILL);
+            }
+        }
+        else if (radio_time != SIM_TIME_NEVER)
+        {
+            radio_done();
+        }
+        else
+        {
+            fprintf(stderr, "Simulation stalled with %u results pending\n", m_results_left);
+            exit(EXIT_FAILURE);
+        }
+    }
+}
+
+static void result_print(const char * p_mode, const sim_profile_t * p_profile, uint8_t length)
+{
+    double seconds = (double)m_result.end / 1e6;
+
+    printf("%-10s %-3s %-8s %4u %10.1f %9.1f %8.1f %7.1f %9.3f %8.3f %7llu\n",
+           p_profile->p_name,
+           m_ifs ? "on" : "off",
+           p_mode,
+           length,
+           (double)m_result.bytes * 8.0 / 1000.0 / seconds,
+           (double)m_result.delivered / seconds,
+           100.0 * (double)m_result.busy_us / (double)m_result.end,
+           (double)(m_result.end - m_result.busy_us) / (double)m_result.attempts,
+           (double)m_result.attempts / (double)(m_result.delivered + m_result.failed),
+           (double)m_result.wakeups / (double)(m_result.delivered + m_result.failed),
+           (unsigned long long)m_result.failed);
+}
+
+static void usage(const char * p_program)
+{
+    fprintf(stderr,
+            "Usage: %s [-f <frames>] [-l <psdu length>[,<psdu length>...]] [-e <ack loss %%>] "
+            "[-r <max retries>] [-s <seed>]\n",
+            p_program);
+    exit(EXIT_FAILURE);
+}
+
+int main(int argc, char ** argv)
+{
+    const char * p_lengths = "20,127";
+    unsigned     frames    = 10000U;
+    double       loss      = 5.0;
+    unsigned     retries   = 3U;
+    uint32_t     seed      = 1U;
+
+    for (int i = 1; i < argc; i++)
+    {
+        if ((i + 1 >= argc) || (argv[i][0] != '-'))
+        {
+            usage(argv[0]);
+        }
+
+        switch (argv[i][1])
+        {
+            case 'f': frames    = (unsigned)strtoul(argv[++i], NULL, 0);  break;
+            case 'l': p_lengths = argv[++i];                              break;
+            case 'e': loss      = strtod(argv[++i], NULL);                break;
+            case 'r': retries   = (unsigned)strtoul(argv[++i], NULL, 0);  break;
+            case 's': seed      = (uint32_t)strtoul(argv[++i], NULL, 0);  break;
+            default:  usage(argv[0]);
+        }
+    }
+
+    if ((frames == 0U) || (loss < 0.0) || (loss >= 100.0) || (retries > UINT8_MAX) ||
+        (seed == 0U))
+    {
+        fprintf(stderr, "Invalid arguments: frames must be positive, loss below 100, "
+                        "retries at most %u and seed non-zero\n", UINT8_MAX);
+        return EXIT_FAILURE;
+    }
+
+    m_ack_loss    = (uint32_t)(loss * 65536.0 / 100.0);
+    m_max_retries = (uint8_t)retries;
+
+    printf("%-10s %-3s %-8s %4s %10s %9s %8s %7s %9s %8s %7s\n",
+           "profile", "ifs", "mode", "len", "kbit/s", "frames/s", "air[%]", "gap[us]", "attempts",
+           "wakeups", "failed");
+
+    for (size_t run = 0U; run < 2U * (sizeof(m_profiles) / sizeof(m_profiles[0])); run++)
+    {
+        size_t p = run / 2U;
+
+        m_ifs = ((run % 2U) == 0U);
+
+        for (const char * p_list = p_lengths; *p_list != '\0'; )
+        {
+            char        * p_end;
+            unsigned long length = strtoul(p_list, &p_end, 0);
+
+            if ((p_end == p_list) || (length < 5U) || (length > MAX_PACKET_SIZE))
+            {
+                fprintf(stderr, "Invalid length, allowed 5 to %u\n", MAX_PACKET_SIZE);
+                return EXIT_FAILURE;
+            }
+
+            simulate(SIM_MODE_REQUEST, &m_profiles[p], frames, (uint8_t)length, seed);
+            result_print("request", &m_profiles[p], (uint8_t)length);
+            simulate(SIM_MODE_QUEUE, &m_profiles[p], frames, (uint8_t)length, seed);
+            result_print("queue", &m_profiles[p], (uint8_t)length);
+
+            // Batch notifications are available on the radio core only
+            if (p == 0U)
+            {
+                simulate(SIM_MODE_BATCH, &m_profiles[p], frames, (uint8_t)length, seed);
+                result_print("batch", &m_profiles[p], (uint8_t)length);
+            }
+
+            p_list = (*p_end == ',') ? (p_end + 1) : p_end;
+        }
+    }
+
+    return EXIT_SUCCESS;
+}